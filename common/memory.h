@@ -113,6 +113,14 @@ extern "C" {
 	memcpy( (void *) destination, (void *) source, count )
 #endif
 
+/* Memory move
+ * memmove is provided by the same header as memcpy
+ */
+#if defined( HAVE_MEMCPY ) || defined( WINAPI )
+#define memory_move( destination, source, count ) \
+	memmove( (void *) destination, (void *) source, count )
+#endif
+
 /* Memory set
  */
 #if defined( HAVE_MEMSET ) || defined( WINAPI )
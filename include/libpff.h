@@ -263,6 +263,104 @@ int libpff_file_recover_items(
      uint8_t recovery_flags,
      libpff_error_t **error );
 
+/* Sets the recovery progress callback function
+ * The callback function is called by libpff_file_recover_items when the recovery stage changes
+ * and at most once per second otherwise. The callback function should return 1 to continue
+ * the recovery or 0 to cancel it. A NULL callback function removes the callback
+ * Returns 1 if successful or -1 on error
+ */
+LIBPFF_EXTERN \
+int libpff_file_set_recovery_progress_callback(
+     libpff_file_t *file,
+     int (*callback_function)(
+            libpff_file_t *file,
+            intptr_t *callback_data ),
+     intptr_t *callback_data,
+     libpff_error_t **error );
+
+/* Sets the recovery checkpoint file
+ * The recovery state is stored in the checkpoint file periodically and when the recovery
+ * is cancelled, a subsequent libpff_file_recover_items continues where it stopped
+ * Returns 1 if successful or -1 on error
+ */
+LIBPFF_EXTERN \
+int libpff_file_set_recovery_checkpoint_file(
+     libpff_file_t *file,
+     const char *filename,
+     libpff_error_t **error );
+
+#if defined( LIBPFF_HAVE_WIDE_CHARACTER_TYPE )
+/* Sets the recovery checkpoint file
+ * Returns 1 if successful or -1 on error
+ */
+LIBPFF_EXTERN \
+int libpff_file_set_recovery_checkpoint_file_wide(
+     libpff_file_t *file,
+     const wchar_t *filename,
+     libpff_error_t **error );
+#endif
+
+/* Retrieves the recovery progress
+ * The offset and number of bytes refer to the scan of the unallocated space
+ * This function is intended to be called from the recovery progress callback function
+ * or after the recovery
+ * Returns 1 if successful or -1 on error
+ */
+LIBPFF_EXTERN \
+int libpff_file_get_recovery_progress(
+     libpff_file_t *file,
+     uint8_t *stage,
+     off64_t *current_offset,
+     size64_t *bytes_scanned,
+     size64_t *bytes_to_scan,
+     uint64_t *bytes_per_second,
+     libpff_error_t **error );
+
+/* Retrieves a specific recovery counter
+ * The number of candidates contains the number of candidates found
+ * the number of validated contains the number of candidates that passed validation
+ * Returns 1 if successful or -1 on error
+ */
+LIBPFF_EXTERN \
+int libpff_file_get_recovery_counter(
+     libpff_file_t *file,
+     int counter,
+     uint64_t *number_of_candidates,
+     uint64_t *number_of_validated,
+     libpff_error_t **error );
+
+/* Retrieves a specific statistic
+ * The statistics are maintained since the file was opened or the statistics were reset
+ * Returns 1 if successful or -1 on error
+ */
+LIBPFF_EXTERN \
+int libpff_file_get_statistics(
+     libpff_file_t *file,
+     int statistic,
+     uint64_t *value,
+     libpff_error_t **error );
+
+/* Retrieves the statistics of a specific cache
+ * An eviction is counted when a cached value is replaced by another value
+ * Returns 1 if successful or -1 on error
+ */
+LIBPFF_EXTERN \
+int libpff_file_get_cache_statistics(
+     libpff_file_t *file,
+     int cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
+     libpff_error_t **error );
+
+/* Resets the statistics
+ * Returns 1 if successful or -1 on error
+ */
+LIBPFF_EXTERN \
+int libpff_file_reset_statistics(
+     libpff_file_t *file,
+     libpff_error_t **error );
+
 /* Retrieves the file size
  * Returns 1 if successful or -1 on error
  */
@@ -518,6 +616,16 @@ int libpff_item_get_identifier(
      uint32_t *identifier,
      libpff_error_t **error );
 
+/* Retrieves the data identifier
+ * The data identifier changes when the data of the item is rewritten
+ * Returns 1 if successful or -1 on error
+ */
+LIBPFF_EXTERN \
+int libpff_item_get_data_identifier(
+     libpff_item_t *item,
+     uint64_t *data_identifier,
+     libpff_error_t **error );
+
 /* Retrieves the number of sets values
  * Returns 1 if successful or -1 on error
  */
@@ -1265,6 +1373,65 @@ int libpff_folder_get_sub_message(
      libpff_item_t **sub_message,
      libpff_error_t **error );
 
+/* Retrieves the item type of the sub message for the specific index from a folder
+ * The item type is determined from the folder contents table without reading the sub message,
+ * which allows to filter the sub messages by item type before retrieving them
+ * Returns 1 if successful, 0 if the folder contents table does not contain the message class or -1 on error
+ */
+LIBPFF_EXTERN \
+int libpff_folder_get_sub_message_type(
+     libpff_item_t *folder,
+     int sub_message_index,
+     uint8_t *sub_message_type,
+     libpff_error_t **error );
+
+/* Retrieves the boolean value of a specific entry of the sub message for the specific index from a folder
+ * The value is retrieved from the folder contents table without reading the sub message
+ * Returns 1 if successful, 0 if the folder contents table does not contain the entry or -1 on error
+ */
+LIBPFF_EXTERN \
+int libpff_folder_get_sub_message_entry_value_boolean(
+     libpff_item_t *folder,
+     int sub_message_index,
+     uint32_t entry_type,
+     uint8_t *entry_value,
+     libpff_error_t **error );
+
+/* Retrieves the 32-bit value of a specific entry of the sub message for the specific index from a folder
+ * The value is retrieved from the folder contents table without reading the sub message
+ * Returns 1 if successful, 0 if the folder contents table does not contain the entry or -1 on error
+ */
+LIBPFF_EXTERN \
+int libpff_folder_get_sub_message_entry_value_32bit(
+     libpff_item_t *folder,
+     int sub_message_index,
+     uint32_t entry_type,
+     uint32_t *entry_value,
+     libpff_error_t **error );
+
+/* Retrieves the filetime value of a specific entry of the sub message for the specific index from a folder
+ * The value is retrieved from the folder contents table without reading the sub message
+ * Returns 1 if successful, 0 if the folder contents table does not contain the entry or -1 on error
+ */
+LIBPFF_EXTERN \
+int libpff_folder_get_sub_message_entry_value_filetime(
+     libpff_item_t *folder,
+     int sub_message_index,
+     uint32_t entry_type,
+     uint64_t *filetime,
+     libpff_error_t **error );
+
+/* Retrieves the modification time of the sub message for the specific index from a folder
+ * The modification time is retrieved from the folder contents table without reading the sub message
+ * Returns 1 if successful, 0 if the folder contents table does not contain the modification time or -1 on error
+ */
+LIBPFF_EXTERN \
+int libpff_folder_get_sub_message_modification_time(
+     libpff_item_t *folder,
+     int sub_message_index,
+     uint64_t *modification_time,
+     libpff_error_t **error );
+
 /* Retrieves the sub message from a folder for the specific UTF-8 encoded name
  * This function uses the PidTagDisplayName MAPI property as the name
  * Returns 1 if successful, 0 if no such sub message or -1 on error
@@ -1843,6 +2010,48 @@ int libpff_message_get_html_body(
      size_t size,
      libpff_error_t **error );
 
+/* Reads data from the current offset of the HTML message body into a buffer
+ * The data is read as stored, without an added end of string character
+ * Returns the number of bytes read, 0 at the end of the body or -1 on error
+ */
+LIBPFF_EXTERN \
+ssize_t libpff_message_html_body_read_buffer(
+         libpff_item_t *message,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libpff_error_t **error );
+
+/* Seeks a certain offset of the HTML message body
+ * Returns the offset if seek is successful or -1 on error
+ */
+LIBPFF_EXTERN \
+off64_t libpff_message_html_body_seek_offset(
+         libpff_item_t *message,
+         off64_t offset,
+         int whence,
+         libpff_error_t **error );
+
+/* Reads data from the current offset of the RTF message body into a buffer
+ * The compressed RTF is decompressed in bounded parts, without an added end of string character
+ * Returns the number of bytes read, 0 at the end of the body or -1 on error
+ */
+LIBPFF_EXTERN \
+ssize_t libpff_message_rtf_body_read_buffer(
+         libpff_item_t *message,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libpff_error_t **error );
+
+/* Seeks a certain offset of the RTF message body
+ * Returns the offset if seek is successful or -1 on error
+ */
+LIBPFF_EXTERN \
+off64_t libpff_message_rtf_body_seek_offset(
+         libpff_item_t *message,
+         off64_t offset,
+         int whence,
+         libpff_error_t **error );
+
 /* Retrieves the message reminder time
  * Returns 1 if successful, 0 if the item does not contain such value or -1 on error
  */
@@ -2773,6 +2982,29 @@ off64_t libpff_attachment_data_seek_offset(
          int whence,
          libpff_error_t **error );
 
+/* Retrieves the number of attachment data extents
+ * An extent is a range in the file that contains the attachment data as-is,
+ * extents are only available if the data is stored unencrypted in data blocks
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+LIBPFF_EXTERN \
+int libpff_attachment_get_number_of_data_extents(
+     libpff_item_t *attachment,
+     int *number_of_extents,
+     libpff_error_t **error );
+
+/* Retrieves a specific attachment data extent
+ * The extent offset is relative to the start of the file
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+LIBPFF_EXTERN \
+int libpff_attachment_get_data_extent_by_index(
+     libpff_item_t *attachment,
+     int extent_index,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     libpff_error_t **error );
+
 #if defined( LIBPFF_HAVE_BFIO )
 /* Retrieves the attachment data file io handle
  * Returns 1 if successful, 0 if the item does not contain such value or -1 on error
@@ -62,6 +62,55 @@ enum LIBPFF_RECOVERY_FLAGS
 	LIBPFF_RECOVERY_FLAG_SCAN_FOR_FRAGMENTS		= 0x02
 };
 
+/* The recovery stages
+ */
+enum LIBPFF_RECOVERY_STAGES
+{
+	LIBPFF_RECOVERY_STAGE_NONE		= 0,
+	LIBPFF_RECOVERY_STAGE_INDEX_TREES	= 1,
+	LIBPFF_RECOVERY_STAGE_UNALLOCATED_SPACE	= 2,
+	LIBPFF_RECOVERY_STAGE_ITEMS		= 3,
+	LIBPFF_RECOVERY_STAGE_COMPLETED		= 4
+};
+
+/* The recovery counters
+ */
+enum LIBPFF_RECOVERY_COUNTERS
+{
+	LIBPFF_RECOVERY_COUNTER_INDEX_NODES	= 0,
+	LIBPFF_RECOVERY_COUNTER_DATA_BLOCKS	= 1,
+	LIBPFF_RECOVERY_COUNTER_LOCAL_DESCRIPTORS	= 2,
+	LIBPFF_RECOVERY_COUNTER_ITEMS		= 3
+};
+
+/* The statistics
+ */
+enum LIBPFF_STATISTICS
+{
+	LIBPFF_STATISTIC_NUMBER_OF_BYTES_READ		= 0,
+	LIBPFF_STATISTIC_NUMBER_OF_READ_OPERATIONS	= 1,
+	LIBPFF_STATISTIC_NUMBER_OF_BYTES_DECRYPTED	= 2,
+	LIBPFF_STATISTIC_NUMBER_OF_BYTES_CRC_CHECKED	= 3,
+	LIBPFF_STATISTIC_NUMBER_OF_BYTES_DECOMPRESSED	= 4,
+	LIBPFF_STATISTIC_NUMBER_OF_TABLES_READ		= 5,
+	LIBPFF_STATISTIC_NUMBER_OF_BUFFER_POOL_HITS	= 6,
+	LIBPFF_STATISTIC_NUMBER_OF_BUFFER_POOL_ALLOCATIONS	= 7,
+	LIBPFF_STATISTIC_BUFFER_POOL_PEAK_USED_SIZE	= 8
+};
+
+/* The caches for which statistics are maintained
+ */
+enum LIBPFF_CACHES
+{
+	LIBPFF_CACHE_INDEX_NODES			= 0,
+	LIBPFF_CACHE_DESCRIPTOR_INDEX_VALUES		= 1,
+	LIBPFF_CACHE_OFFSET_INDEX_VALUES		= 2,
+	LIBPFF_CACHE_DATA_BLOCKS			= 3,
+	LIBPFF_CACHE_LOCAL_DESCRIPTORS			= 4,
+	LIBPFF_CACHE_ITEM_VALUES			= 5,
+	LIBPFF_CACHE_LOCAL_DESCRIPTOR_NODES		= 6
+};
+
 /* The file types
  */
 enum LIBPFF_FILE_TYPES
@@ -226,6 +226,7 @@ enum LIBPFF_ENTRY_TYPES
 	LIBPFF_ENTRY_TYPE_MESSAGE_SIZE						= 0x0e08,
 
 	LIBPFF_ENTRY_TYPE_MESSAGE_STATUS					= 0x0e17,
+	LIBPFF_ENTRY_TYPE_MESSAGE_HAS_ATTACHMENTS				= 0x0e1b,
 
 	LIBPFF_ENTRY_TYPE_ATTACHMENT_SIZE					= 0x0e20,
 
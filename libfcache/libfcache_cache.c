@@ -246,6 +246,8 @@ int libfcache_cache_clone(
 
 		return( -1 );
 	}
+	( (libfcache_internal_cache_t *) *destination_cache )->statistics = internal_source_cache->statistics;
+
 	return( 1 );
 }
 
@@ -372,6 +374,74 @@ int libfcache_cache_clear(
 	return( 1 );
 }
 
+/* Sets the statistics of the cache
+ * The statistics are not managed by the cache, a NULL value disables the statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_set_statistics(
+     libfcache_cache_t *cache,
+     libfcache_cache_statistics_t *statistics,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_t *internal_cache = NULL;
+	static char *function                     = "libfcache_cache_set_statistics";
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfcache_internal_cache_t *) cache;
+
+	internal_cache->statistics = statistics;
+
+	return( 1 );
+}
+
+/* Updates the statistics of the cache with the result of a lookup
+ * Returns 1 if successful or -1 on error
+ */
+int libfcache_cache_update_statistics(
+     libfcache_cache_t *cache,
+     uint8_t cache_hit,
+     libcerror_error_t **error )
+{
+	libfcache_internal_cache_t *internal_cache = NULL;
+	static char *function                     = "libfcache_cache_update_statistics";
+
+	if( cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfcache_internal_cache_t *) cache;
+
+	if( internal_cache->statistics != NULL )
+	{
+		if( cache_hit != 0 )
+		{
+			internal_cache->statistics->number_of_hits += 1;
+		}
+		else
+		{
+			internal_cache->statistics->number_of_misses += 1;
+		}
+	}
+	return( 1 );
+}
+
 /* Retrieves the cache value for the specific index
  * Returns 1 if successful or -1 on error
  */
@@ -501,6 +571,12 @@ int libfcache_cache_set_value_by_index(
 		}
 		internal_cache->number_of_cache_values++;
 	}
+	else if( ( internal_cache->statistics != NULL )
+	      && ( cache_value->value != NULL )
+	      && ( cache_value->value != value ) )
+	{
+		internal_cache->statistics->number_of_evictions += 1;
+	}
 	if( libfcache_cache_value_set_value(
 	     cache_value,
 	     value,
@@ -36,6 +36,23 @@
 extern "C" {
 #endif
 
+typedef struct libfcache_cache_statistics libfcache_cache_statistics_t;
+
+struct libfcache_cache_statistics
+{
+	/* The number of lookups that found the value in the cache
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of lookups that did not find the value in the cache
+	 */
+	uint64_t number_of_misses;
+
+	/* The number of cache values that were replaced by another value
+	 */
+	uint64_t number_of_evictions;
+};
+
 typedef struct libfcache_internal_cache libfcache_internal_cache_t;
 
 struct libfcache_internal_cache
@@ -47,6 +64,11 @@ struct libfcache_internal_cache
 	/* The number of cache values
 	 */
 	int number_of_cache_values;
+
+	/* The statistics
+	 * The statistics are not managed by the cache and can be shared by multiple caches
+	 */
+	libfcache_cache_statistics_t *statistics;
 };
 
 LIBFCACHE_EXTERN \
@@ -81,6 +103,16 @@ int libfcache_cache_get_number_of_cache_values(
      int *number_of_values,
      libcerror_error_t **error );
 
+int libfcache_cache_set_statistics(
+     libfcache_cache_t *cache,
+     libfcache_cache_statistics_t *statistics,
+     libcerror_error_t **error );
+
+int libfcache_cache_update_statistics(
+     libfcache_cache_t *cache,
+     uint8_t cache_hit,
+     libcerror_error_t **error );
+
 /* Cache value functions
  */
 int libfcache_cache_get_value_by_index(
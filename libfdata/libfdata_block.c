@@ -209,7 +209,7 @@ int libfdata_block_free(
 		{
 			if( internal_block->io_handle != NULL )
 			{
-				if( internal_block->free_io_handle == NULL )
+				if( internal_block->free_io_handle != NULL )
 				{
 					if( internal_block->free_io_handle(
 					     &( internal_block->io_handle ),
@@ -685,6 +685,7 @@ int libfdata_block_get_data(
 	size_t data_offset                        = 0;
 	ssize_t read_count                        = 0;
 	uint32_t segment_flags                    = 0;
+	uint8_t cache_hit                         = 0;
 	int number_of_cache_values                = 0;
 	int number_of_segments                    = 0;
 	int segment_index                         = 0;
@@ -795,12 +796,30 @@ int libfdata_block_get_data(
 
 		return( -1 );
 	}
+	if( ( number_of_cache_values == 1 )
+	 && ( cache_value != NULL )
+	 && ( data_buffer != NULL )
+	 && ( data_block_size == (size64_t) data_buffer_size ) )
+	{
+		cache_hit = 1;
+	}
+	if( libfcache_cache_update_statistics(
+	     cache,
+	     cache_hit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update cache statistics.",
+		 function );
+
+		return( -1 );
+	}
 	/* Read all the data in a single cache value
 	 */
-	if( ( number_of_cache_values != 1 )
-	 || ( cache_value == NULL )
-	 || ( data_buffer == NULL )
-	 || ( data_block_size != (size64_t) data_buffer_size ) )
+	if( cache_hit == 0 )
 	{
 		if( data_block_size > (size64_t) SSIZE_MAX )
 		{
@@ -1169,8 +1188,24 @@ int libfdata_block_get_segment_data(
 	}
 	/* All the data has been cached in a single cache value
 	 */
-	if( data_block_size == (size64_t) data_buffer_size )
+	if( ( data_buffer != NULL )
+	 && ( data_block_size == (size64_t) data_buffer_size ) )
 	{
+		if( libfcache_cache_update_statistics(
+		     cache,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update cache statistics.",
+			 function );
+
+			return( -1 );
+		}
+
 		if( data_size == NULL )
 		{
 			libcerror_error_set(
@@ -1452,8 +1487,24 @@ int libfdata_block_get_segment_data_at_offset(
 	}
 	/* All the data has been cached in a single cache value
 	 */
-	if( data_block_size == (size64_t) data_buffer_size )
+	if( ( data_buffer != NULL )
+	 && ( data_block_size == (size64_t) data_buffer_size ) )
 	{
+		if( libfcache_cache_update_statistics(
+		     cache,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update cache statistics.",
+			 function );
+
+			return( -1 );
+		}
+
 		if( data_offset > (off64_t) SSIZE_MAX )
 		{
 			libcerror_error_set(
@@ -1737,8 +1788,24 @@ int libfdata_block_get_segment_data_at_value_index(
 	}
 	/* All the data has been cached in a single cache value
 	 */
-	if( data_block_size == (size64_t) data_buffer_size )
+	if( ( data_buffer != NULL )
+	 && ( data_block_size == (size64_t) data_buffer_size ) )
 	{
+		if( libfcache_cache_update_statistics(
+		     cache,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update cache statistics.",
+			 function );
+
+			return( -1 );
+		}
+
 		if( data_size == NULL )
 		{
 			libcerror_error_set(
@@ -2265,12 +2332,20 @@ ssize_t libfdata_block_read_buffer(
          libcerror_error_t **error )
 {
 	libfdata_internal_block_t *internal_block = NULL;
+	libfdata_list_element_t *segment          = NULL;
 	uint8_t *segment_data                     = NULL;
 	static char *function                     = "libfdata_block_read_buffer";
+	off64_t segment_offset                    = 0;
 	size64_t data_block_size                  = 0;
+	size64_t segment_size                     = 0;
 	size_t buffer_offset                      = 0;
 	size_t read_size                          = 0;
 	size_t segment_data_size                  = 0;
+	ssize_t read_count                        = 0;
+	uint32_t segment_flags                    = 0;
+	uint8_t read_directly                     = 0;
+	int number_of_cache_values                = 0;
+	int number_of_segments                    = 0;
 
 	if( block == NULL )
 	{
@@ -2339,8 +2414,132 @@ ssize_t libfdata_block_read_buffer(
 	{
 		buffer_size = (size_t) ( data_block_size - internal_block->data_offset );
 	}
+	if( libfdata_list_get_number_of_elements(
+	     internal_block->segments_list,
+	     &number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of segments.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_cache_get_number_of_cache_values(
+	     cache,
+	     &number_of_cache_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache values.",
+		 function );
+
+		return( -1 );
+	}
+	/* A segment that fits entirely in the remaining buffer is read directly into
+	 * the buffer, which bypasses the cache and the additional copy of the segment data
+	 * A block with a single segment or a single cache value is typically already cached
+	 */
+	if( ( number_of_segments > 1 )
+	 && ( number_of_cache_values > 1 ) )
+	{
+		read_directly = 1;
+	}
 	while( buffer_size > 0 )
 	{
+		if( ( read_directly != 0 )
+		 && ( internal_block->segment_data_offset == 0 ) )
+		{
+			if( libfdata_list_get_element_by_index(
+			     internal_block->segments_list,
+			     internal_block->segment_index,
+			     &segment,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve element: %d from segments list.",
+				 function,
+				 internal_block->segment_index );
+
+				return( -1 );
+			}
+			if( libfdata_list_element_get_data_range(
+			     segment,
+			     &segment_offset,
+			     &segment_size,
+			     &segment_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve segment: %d.",
+				 function,
+				 internal_block->segment_index );
+
+				return( -1 );
+			}
+			if( ( segment_size > 0 )
+			 && ( segment_size <= (size64_t) buffer_size ) )
+			{
+				if( libbfio_handle_seek_offset(
+				     file_io_handle,
+				     segment_offset,
+				     SEEK_SET,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_SEEK_FAILED,
+					 "%s: unable to seek segment offset: %" PRIi64 ".",
+					 function,
+					 segment_offset );
+
+					return( -1 );
+				}
+				read_size = (size_t) segment_size;
+
+				read_count = internal_block->read_segment_data(
+					      internal_block->io_handle,
+					      file_io_handle,
+					      internal_block->segment_index,
+					      &( buffer[ buffer_offset ] ),
+					      read_size,
+					      0,
+					      error );
+
+				if( read_count != (ssize_t) read_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read segment: %d data.",
+					 function,
+					 internal_block->segment_index );
+
+					return( -1 );
+				}
+				internal_block->data_offset   += read_size;
+				internal_block->segment_index += 1;
+
+				buffer_size   -= read_size;
+				buffer_offset += read_size;
+
+				continue;
+			}
+		}
 		if( libfdata_block_get_segment_data(
 		     block,
 		     file_io_handle,
@@ -74,6 +74,8 @@ int libfdata_block_reference_initialize(
 	           libfdata_block_clone,
 	     (int (*)(intptr_t *, int *, libcerror_error_t **))
 	           libfdata_block_get_number_of_segments,
+	     (int (*)(intptr_t *, int, off64_t *, size64_t *, uint32_t *, libcerror_error_t **))
+	           libfdata_block_get_segment_by_index,
 	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **))
 	           libfdata_block_get_size,
 	     (int (*)(intptr_t *, libbfio_handle_t *, libfcache_cache_t *, uint8_t **, size_t *, libcerror_error_t **))
@@ -143,6 +143,7 @@ int libfdata_buffer_reference_initialize(
 		          libfdata_buffer_reference_clone,
 		     (int (*)(intptr_t *, int *, libcerror_error_t **))
 		          libfdata_buffer_reference_get_number_of_segments,
+		     NULL,
 		     (int (*)(intptr_t *, size64_t *, libcerror_error_t **))
 		          libfdata_buffer_reference_get_size,
 		     (int (*)(intptr_t *, libbfio_handle_t *, libfcache_cache_t *, uint8_t **, size_t *, libcerror_error_t **))
@@ -820,7 +821,7 @@ ssize_t libfdata_buffer_reference_read_buffer(
 	}
 	if( memory_copy(
 	     buffer,
-	     buffer_reference->data,
+	     &( buffer_reference->data[ buffer_reference->data_offset ] ),
 	     buffer_size ) == NULL )
 	{
 		libcerror_error_set(
@@ -1946,6 +1946,20 @@ int libfdata_list_get_element_value(
 		{
 			result = 1;
 		}
+		if( libfcache_cache_update_statistics(
+		     cache,
+		     (uint8_t) result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update cache statistics.",
+			 function );
+
+			return( -1 );
+		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -49,6 +49,13 @@ int libfdata_reference_initialize(
             intptr_t *data_handle,
             int *number_of_segments,
             libcerror_error_t **error ),
+     int (*get_segment_by_index)(
+            intptr_t *data_handle,
+            int segment_index,
+            off64_t *segment_offset,
+            size64_t *segment_size,
+            uint32_t *segment_flags,
+            libcerror_error_t **error ),
      int (*get_size)(
             intptr_t *data_handle,
             size64_t *size,
@@ -171,6 +178,7 @@ int libfdata_reference_initialize(
 	internal_reference->free_data_handle                = free_data_handle;
 	internal_reference->clone_data_handle               = clone_data_handle;
 	internal_reference->get_number_of_segments          = get_number_of_segments;
+	internal_reference->get_segment_by_index            = get_segment_by_index;
 	internal_reference->get_size                        = get_size;
 	internal_reference->get_data                        = get_data;
 	internal_reference->get_segment_data                = get_segment_data;
@@ -337,6 +345,7 @@ int libfdata_reference_clone(
 	     internal_source_reference->free_data_handle,
 	     internal_source_reference->clone_data_handle,
 	     internal_source_reference->get_number_of_segments,
+	     internal_source_reference->get_segment_by_index,
 	     internal_source_reference->get_size,
 	     internal_source_reference->get_data,
 	     internal_source_reference->get_segment_data,
@@ -482,6 +491,59 @@ int libfdata_reference_get_number_of_segments(
 	return( 1 );
 }
 
+/* Retrieves the offset and size of a specific segment
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfdata_reference_get_segment_by_index(
+     libfdata_reference_t *reference,
+     int segment_index,
+     off64_t *segment_offset,
+     size64_t *segment_size,
+     uint32_t *segment_flags,
+     libcerror_error_t **error )
+{
+	libfdata_internal_reference_t *internal_reference = NULL;
+	static char *function                             = "libfdata_reference_get_segment_by_index";
+
+	if( reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reference.",
+		 function );
+
+		return( -1 );
+	}
+	internal_reference = (libfdata_internal_reference_t *) reference;
+
+	if( ( internal_reference->data_handle == NULL )
+	 || ( internal_reference->get_segment_by_index == NULL ) )
+	{
+		return( 0 );
+	}
+	if( internal_reference->get_segment_by_index(
+	     internal_reference->data_handle,
+	     segment_index,
+	     segment_offset,
+	     segment_size,
+	     segment_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve segment: %d.",
+		 function,
+		 segment_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Data functions
  */
 
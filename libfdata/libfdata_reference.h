@@ -67,6 +67,16 @@ struct libfdata_internal_reference
 	       int *number_of_segments,
 	       libcerror_error_t **error );
 
+	/* Function to retrieve a specific segment
+	 */
+	int (*get_segment_by_index)(
+	       intptr_t *data_handle,
+	       int segment_index,
+	       off64_t *segment_offset,
+	       size64_t *segment_size,
+	       uint32_t *segment_flags,
+	       libcerror_error_t **error );
+
 	/* Function to retrieve the size
 	 */
 	int (*get_size)(
@@ -155,6 +165,13 @@ int libfdata_reference_initialize(
             intptr_t *data_handle,
             int *number_of_segments,
             libcerror_error_t **error ),
+     int (*get_segment_by_index)(
+            intptr_t *data_handle,
+            int segment_index,
+            off64_t *segment_offset,
+            size64_t *segment_size,
+            uint32_t *segment_flags,
+            libcerror_error_t **error ),
      int (*get_size)(
             intptr_t *data_handle,
             size64_t *size,
@@ -237,6 +254,15 @@ int libfdata_reference_get_number_of_segments(
 /* Data functions
  */
 LIBFDATA_EXTERN \
+int libfdata_reference_get_segment_by_index(
+     libfdata_reference_t *reference,
+     int segment_index,
+     off64_t *segment_offset,
+     size64_t *segment_size,
+     uint32_t *segment_flags,
+     libcerror_error_t **error );
+
+LIBFDATA_EXTERN \
 int libfdata_reference_get_size(
      libfdata_reference_t *reference,
      size64_t *size,
@@ -913,6 +913,20 @@ int libfdata_vector_get_element_value_by_index(
 		{
 			result = 1;
 		}
+		if( libfcache_cache_update_statistics(
+		     cache,
+		     (uint8_t) result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update cache statistics.",
+			 function );
+
+			return( -1 );
+		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -665,3 +665,539 @@ int libfmapi_lzfu_decompress(
 	return( 1 );
 }
 
+/* Reads the LZFu header from the start of the compressed data
+ * Returns 1 on success or -1 on error
+ */
+int libfmapi_lzfu_read_header(
+     libfmapi_lzfu_header_t *lzfu_header,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfmapi_lzfu_read_header";
+
+	if( lzfu_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid LZFu header.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size < sizeof( libfmapi_lzfu_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( compressed_data[ 0 ] ),
+	 lzfu_header->compressed_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( compressed_data[ 4 ] ),
+	 lzfu_header->uncompressed_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( compressed_data[ 8 ] ),
+	 lzfu_header->signature );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( compressed_data[ 12 ] ),
+	 lzfu_header->crc );
+
+	if( ( lzfu_header->signature != LIBFMAPI_LZFU_SIGNATURE_COMPRESSED )
+	 && ( lzfu_header->signature != LIBFMAPI_LZFU_SIGNATURE_UNCOMPRESSED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression signature: 0x%08" PRIx32 ".",
+		 function,
+		 lzfu_header->signature );
+
+		return( -1 );
+	}
+	/* The compressed data size includes 12 bytes of the header
+	 */
+	if( lzfu_header->compressed_data_size < 12 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a LZFu decompression stream
+ * The compressed data should contain at least the LZFu header
+ * Returns 1 if successful or -1 on error
+ */
+int libfmapi_lzfu_stream_initialize(
+     libfmapi_lzfu_stream_t **lzfu_stream,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfmapi_lzfu_stream_initialize";
+
+	if( lzfu_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid LZFu stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *lzfu_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid LZFu stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*lzfu_stream = memory_allocate_structure(
+	                libfmapi_lzfu_stream_t );
+
+	if( *lzfu_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create LZFu stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *lzfu_stream,
+	     0,
+	     sizeof( libfmapi_lzfu_stream_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear LZFu stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfmapi_lzfu_read_header(
+	     &( ( *lzfu_stream )->header ),
+	     compressed_data,
+	     compressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read LZFu header.",
+		 function );
+
+		goto on_error;
+	}
+	( *lzfu_stream )->compressed_data_size = (size_t) ( *lzfu_stream )->header.compressed_data_size - 12;
+
+	if( memory_copy(
+	     ( *lzfu_stream )->lz_buffer,
+	     libfmapi_lzfu_rtf_dictionary,
+	     207 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to initialize lz buffer.",
+		 function );
+
+		goto on_error;
+	}
+	( *lzfu_stream )->lz_buffer_iterator = 207;
+
+	return( 1 );
+
+on_error:
+	if( *lzfu_stream != NULL )
+	{
+		memory_free(
+		 *lzfu_stream );
+
+		*lzfu_stream = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a LZFu decompression stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfmapi_lzfu_stream_free(
+     libfmapi_lzfu_stream_t **lzfu_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "libfmapi_lzfu_stream_free";
+
+	if( lzfu_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid LZFu stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *lzfu_stream != NULL )
+	{
+		memory_free(
+		 *lzfu_stream );
+
+		*lzfu_stream = NULL;
+	}
+	return( 1 );
+}
+
+/* Decompresses the next part of the compressed data of a LZFu stream
+ * The compressed data is the data directly following the previously consumed data,
+ * the first call should pass the data directly following the LZFu header
+ * On return compressed data consumed contains the number of compressed bytes consumed
+ * and uncompressed data size the number of uncompressed bytes produced
+ * Less compressed data is consumed when the uncompressed data is full
+ * The weak CRC is verified once all compressed data has been consumed
+ * Returns 1 on success or -1 on error
+ */
+int libfmapi_lzfu_stream_decompress(
+     libfmapi_lzfu_stream_t *lzfu_stream,
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_consumed,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function             = "libfmapi_lzfu_stream_decompress";
+	size_t compressed_data_iterator   = 0;
+	size_t uncompressed_data_iterator = 0;
+	size_t copy_size                  = 0;
+	uint16_t reference_value          = 0;
+	uint8_t byte_value                = 0;
+
+	if( lzfu_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid LZFu stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_consumed == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data consumed.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Never consume data beyond the end of the compressed data
+	 */
+	if( compressed_data_size > ( lzfu_stream->compressed_data_size - lzfu_stream->compressed_data_offset ) )
+	{
+		compressed_data_size = lzfu_stream->compressed_data_size - lzfu_stream->compressed_data_offset;
+	}
+	if( lzfu_stream->header.signature == LIBFMAPI_LZFU_SIGNATURE_UNCOMPRESSED )
+	{
+		copy_size = compressed_data_size;
+
+		if( copy_size > *uncompressed_data_size )
+		{
+			copy_size = *uncompressed_data_size;
+		}
+		if( copy_size > ( (size_t) lzfu_stream->header.uncompressed_data_size - lzfu_stream->uncompressed_data_offset ) )
+		{
+			copy_size = (size_t) lzfu_stream->header.uncompressed_data_size - lzfu_stream->uncompressed_data_offset;
+		}
+		if( memory_copy(
+		     uncompressed_data,
+		     compressed_data,
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy uncompressed data.",
+			 function );
+
+			return( -1 );
+		}
+		compressed_data_iterator   = copy_size;
+		uncompressed_data_iterator = copy_size;
+
+		lzfu_stream->uncompressed_data_offset += copy_size;
+
+		/* Skip trailing data once all uncompressed data was produced
+		 */
+		if( lzfu_stream->uncompressed_data_offset >= (size_t) lzfu_stream->header.uncompressed_data_size )
+		{
+			compressed_data_iterator = compressed_data_size;
+		}
+		lzfu_stream->compressed_data_offset += compressed_data_iterator;
+
+		*compressed_data_consumed = compressed_data_iterator;
+		*uncompressed_data_size   = uncompressed_data_iterator;
+
+		return( 1 );
+	}
+	while( compressed_data_iterator <= compressed_data_size )
+	{
+		/* Copy the remainder of a pending reference first
+		 */
+		while( lzfu_stream->reference_size > 0 )
+		{
+			if( lzfu_stream->uncompressed_data_offset >= (size_t) lzfu_stream->header.uncompressed_data_size )
+			{
+				lzfu_stream->reference_size = 0;
+
+				break;
+			}
+			if( uncompressed_data_iterator >= *uncompressed_data_size )
+			{
+				break;
+			}
+			byte_value = lzfu_stream->lz_buffer[ lzfu_stream->reference_offset ];
+
+			lzfu_stream->lz_buffer[ lzfu_stream->lz_buffer_iterator++ ] = byte_value;
+			uncompressed_data[ uncompressed_data_iterator++ ]             = byte_value;
+
+			lzfu_stream->reference_offset++;
+			lzfu_stream->reference_size--;
+			lzfu_stream->uncompressed_data_offset++;
+
+			/* Make sure the lz buffer iterator and reference offset wrap around
+			 */
+			lzfu_stream->lz_buffer_iterator %= 4096;
+			lzfu_stream->reference_offset   %= 4096;
+
+			lzfu_stream->lz_buffer[ lzfu_stream->lz_buffer_iterator ] = 0;
+		}
+		if( compressed_data_iterator >= compressed_data_size )
+		{
+			break;
+		}
+		/* Once the end marker was found or all uncompressed data was produced
+		 * the remaining compressed data is only consumed for the CRC
+		 */
+		if( ( lzfu_stream->end_of_data != 0 )
+		 || ( lzfu_stream->uncompressed_data_offset >= (size_t) lzfu_stream->header.uncompressed_data_size ) )
+		{
+			compressed_data_iterator = compressed_data_size;
+
+			break;
+		}
+		if( ( lzfu_stream->reference_size > 0 )
+		 || ( uncompressed_data_iterator >= *uncompressed_data_size ) )
+		{
+			break;
+		}
+		if( lzfu_stream->flag_byte_bit_mask == 0 )
+		{
+			lzfu_stream->flag_byte          = compressed_data[ compressed_data_iterator++ ];
+			lzfu_stream->flag_byte_bit_mask = 0x01;
+
+			continue;
+		}
+		/* Check if the byte value is a literal or a reference
+		 */
+		if( ( lzfu_stream->flag_byte & lzfu_stream->flag_byte_bit_mask ) == 0 )
+		{
+			byte_value = compressed_data[ compressed_data_iterator++ ];
+
+			lzfu_stream->lz_buffer[ lzfu_stream->lz_buffer_iterator++ ] = byte_value;
+			uncompressed_data[ uncompressed_data_iterator++ ]             = byte_value;
+
+			lzfu_stream->uncompressed_data_offset++;
+
+			/* Make sure the lz buffer iterator wraps around
+			 */
+			lzfu_stream->lz_buffer_iterator %= 4096;
+
+			lzfu_stream->lz_buffer[ lzfu_stream->lz_buffer_iterator ] = 0;
+		}
+		else if( lzfu_stream->has_reference_byte == 0 )
+		{
+			/* The reference can be split over successive compressed data
+			 */
+			lzfu_stream->reference_byte     = compressed_data[ compressed_data_iterator++ ];
+			lzfu_stream->has_reference_byte = 1;
+
+			continue;
+		}
+		else
+		{
+			reference_value   = (uint16_t) lzfu_stream->reference_byte << 8;
+			reference_value  |= (uint16_t) compressed_data[ compressed_data_iterator++ ];
+
+			lzfu_stream->has_reference_byte = 0;
+
+			/* A reference to the current position in the lz buffer marks the end of the data
+			 */
+			if( ( reference_value >> 4 ) == lzfu_stream->lz_buffer_iterator )
+			{
+				lzfu_stream->end_of_data = 1;
+			}
+			else
+			{
+				lzfu_stream->reference_offset = reference_value >> 4;
+				lzfu_stream->reference_size   = ( reference_value & 0x000f ) + 2;
+			}
+		}
+		lzfu_stream->flag_byte_bit_mask <<= 1;
+	}
+	if( compressed_data_iterator > 0 )
+	{
+		if( libfmapi_crc32_weak_calculate(
+		     &( lzfu_stream->calculated_crc ),
+		     compressed_data,
+		     compressed_data_iterator,
+		     lzfu_stream->calculated_crc,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate weak CRC.",
+			 function );
+
+			return( -1 );
+		}
+		lzfu_stream->compressed_data_offset += compressed_data_iterator;
+
+		if( ( lzfu_stream->compressed_data_offset == lzfu_stream->compressed_data_size )
+		 && ( lzfu_stream->header.crc != lzfu_stream->calculated_crc ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: mismatch in checksum ( %" PRIu32 " != %" PRIu32 " ).",
+			 function,
+			 lzfu_stream->header.crc,
+			 lzfu_stream->calculated_crc );
+
+			return( -1 );
+		}
+	}
+	*compressed_data_consumed = compressed_data_iterator;
+	*uncompressed_data_size   = uncompressed_data_iterator;
+
+	return( 1 );
+}
+
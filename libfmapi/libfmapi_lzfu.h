@@ -54,6 +54,69 @@ struct libfmapi_lzfu_header
 	uint32_t crc;
 };
 
+/* The LZFu decompression stream
+ */
+typedef struct libfmapi_lzfu_stream libfmapi_lzfu_stream_t;
+
+struct libfmapi_lzfu_stream
+{
+	/* The LZFu header
+	 */
+	libfmapi_lzfu_header_t header;
+
+	/* The size of the compressed data after the header
+	 */
+	size_t compressed_data_size;
+
+	/* The number of compressed bytes consumed
+	 */
+	size_t compressed_data_offset;
+
+	/* The number of uncompressed bytes produced
+	 */
+	size_t uncompressed_data_offset;
+
+	/* The calculated CRC of the consumed compressed data
+	 */
+	uint32_t calculated_crc;
+
+	/* The lz buffer
+	 */
+	uint8_t lz_buffer[ 4096 ];
+
+	/* The lz buffer iterator
+	 */
+	uint16_t lz_buffer_iterator;
+
+	/* The offset of the pending reference in the lz buffer
+	 */
+	uint16_t reference_offset;
+
+	/* The number of bytes of the pending reference still to be copied
+	 */
+	uint16_t reference_size;
+
+	/* The first byte of a reference that was split over input buffers
+	 */
+	uint8_t reference_byte;
+
+	/* Value to indicate the reference byte is set
+	 */
+	uint8_t has_reference_byte;
+
+	/* The current flag byte
+	 */
+	uint8_t flag_byte;
+
+	/* The bit mask of the next flag in the flag byte, 0 if a new flag byte is needed
+	 */
+	uint8_t flag_byte_bit_mask;
+
+	/* Value to indicate the end of the compressed data was reached
+	 */
+	uint8_t end_of_data;
+};
+
 int libfmapi_lzfu_get_uncompressed_data_size(
      uint8_t *compressed_data, 
      size_t compressed_data_size,
@@ -74,6 +137,31 @@ int libfmapi_lzfu_decompress(
      size_t compressed_data_size,
      libcerror_error_t **error );
 
+int libfmapi_lzfu_read_header(
+     libfmapi_lzfu_header_t *lzfu_header,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error );
+
+int libfmapi_lzfu_stream_initialize(
+     libfmapi_lzfu_stream_t **lzfu_stream,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error );
+
+int libfmapi_lzfu_stream_free(
+     libfmapi_lzfu_stream_t **lzfu_stream,
+     libcerror_error_t **error );
+
+int libfmapi_lzfu_stream_decompress(
+     libfmapi_lzfu_stream_t *lzfu_stream,
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_consumed,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -34,6 +34,51 @@
 
 #include "pff_allocation_table.h"
 
+/* Counts the number of leading zero bits of a non-zero 64-bit value
+ * Returns the number of leading zero bits
+ */
+int libpff_allocation_table_count_leading_zeros(
+     uint64_t value )
+{
+	int number_of_bits = 0;
+
+#if defined( __GNUC__ )
+	number_of_bits = __builtin_clzll(
+	                  (unsigned long long) value );
+#else
+	if( ( value & 0xffffffff00000000ULL ) == 0 )
+	{
+		number_of_bits += 32;
+		value         <<= 32;
+	}
+	if( ( value & 0xffff000000000000ULL ) == 0 )
+	{
+		number_of_bits += 16;
+		value         <<= 16;
+	}
+	if( ( value & 0xff00000000000000ULL ) == 0 )
+	{
+		number_of_bits += 8;
+		value         <<= 8;
+	}
+	if( ( value & 0xf000000000000000ULL ) == 0 )
+	{
+		number_of_bits += 4;
+		value         <<= 4;
+	}
+	if( ( value & 0xc000000000000000ULL ) == 0 )
+	{
+		number_of_bits += 2;
+		value         <<= 2;
+	}
+	if( ( value & 0x8000000000000000ULL ) == 0 )
+	{
+		number_of_bits += 1;
+	}
+#endif
+	return( number_of_bits );
+}
+
 /* Reads an allocation table
  * Returns 1 if successful or -1 on error
  */
@@ -42,9 +87,11 @@ int libpff_allocation_table_read(
      libbfio_handle_t *file_io_handle,
      off64_t allocation_table_offset,
      uint8_t file_type,
+     libpff_io_statistics_t *io_statistics,
      libcerror_error_t **error )
 {
-	uint8_t *allocation_table_data     = NULL;
+	uint8_t allocation_table_data[ 512 ];
+
 	uint8_t *table_data                = NULL;
 	static char *function              = "libpff_allocation_table_read";
 	off64_t back_pointer_offset        = 0;
@@ -53,13 +100,15 @@ int libpff_allocation_table_read(
 	size_t unallocated_size            = 0;
 	size_t allocation_block_size       = 0;
 	ssize_t read_count                 = 0;
+	uint64_t allocation_table_entry    = 0;
+	uint64_t shifted_table_entry       = 0;
 	uint32_t stored_crc                = 0;
 	uint32_t calculated_crc            = 0;
 	uint16_t table_iterator            = 0;
-	uint8_t bit_iterator               = 0;
-	uint8_t allocation_table_entry     = 0;
 	uint8_t allocation_table_type      = 0;
 	uint8_t allocation_table_type_copy = 0;
+	int bit_index                      = 0;
+	int number_of_bits                 = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	uint16_t value_16bit           = 0;
@@ -123,20 +172,6 @@ int libpff_allocation_table_read(
 	{
 		read_size = sizeof( pff_allocation_table_64bit_t );
 	}
-	allocation_table_data = (uint8_t *) memory_allocate(
-	                                     sizeof( uint8_t ) * read_size );
-
-	if( allocation_table_data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create alloction table data.",
-		 function );
-
-		return( -1 );
-	}
 	read_count = libbfio_handle_read_buffer(
 	              file_io_handle,
 	              allocation_table_data,
@@ -152,11 +187,13 @@ int libpff_allocation_table_read(
 		 "%s: unable to read allocation table.",
 		 function );
 
-		memory_free(
-		 allocation_table_data );
-
 		return( -1 );
 	}
+	if( io_statistics != NULL )
+	{
+		io_statistics->number_of_bytes_read      += (uint64_t) read_count;
+		io_statistics->number_of_read_operations += 1;
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -266,11 +303,12 @@ int libpff_allocation_table_read(
 		 "%s: unable to calculate weak CRC.",
 		 function );
 
-		memory_free(
-		 allocation_table_data );
-
 		return( -1 );
 	}
+	if( io_statistics != NULL )
+	{
+		io_statistics->number_of_bytes_crc_checked += 496;
+	}
 	if( stored_crc != calculated_crc )
 	{
 		libcerror_error_set(
@@ -284,9 +322,6 @@ int libpff_allocation_table_read(
 
 		/* TODO implement error tollerance
 		 */
-		memory_free(
-		 allocation_table_data );
-
 		return( -1 );
 	}
 	if( allocation_table_type != allocation_table_type_copy )
@@ -302,9 +337,6 @@ int libpff_allocation_table_read(
 
 		/* TODO implement error tollerance
 		 */
-		memory_free(
-		 allocation_table_data );
-
 		return( -1 );
 	}
 	if( ( allocation_table_type != LIBPFF_ALLOCATION_TABLE_TYPE_DATA )
@@ -320,9 +352,6 @@ int libpff_allocation_table_read(
 
 		/* TODO implement error tollerance
 		 */
-		memory_free(
-		 allocation_table_data );
-
 		return( -1 );
 	}
 	if( allocation_table_type == LIBPFF_ALLOCATION_TABLE_TYPE_PAGE )
@@ -334,51 +363,81 @@ int libpff_allocation_table_read(
 	{
 		allocation_block_size = 64;
 	}
+	/* Scan the allocation table 64 bits at a time, the most significant bit
+	 * of the first byte represents the first allocation block
+	 */
 	for( table_iterator = 0;
 	     table_iterator < 496;
-	     table_iterator++ )
+	     table_iterator += 8 )
 	{
-		allocation_table_entry = table_data[ table_iterator ];
+		byte_stream_copy_to_uint64_big_endian(
+		 &( table_data[ table_iterator ] ),
+		 allocation_table_entry );
 
-		for( bit_iterator = 0;
-		     bit_iterator < 8;
-		     bit_iterator++ )
+		for( bit_index = 0;
+		     bit_index < 64;
+		     bit_index += number_of_bits )
 		{
-			if( ( allocation_table_entry & 0x80 ) == 0 )
+			shifted_table_entry = allocation_table_entry << bit_index;
+
+			if( ( shifted_table_entry & LIBPFF_ALLOCATION_TABLE_MOST_SIGNIFICANT_BIT ) == 0 )
 			{
+				/* Determine the number of unallocated blocks
+				 */
+				if( shifted_table_entry == 0 )
+				{
+					number_of_bits = 64 - bit_index;
+				}
+				else
+				{
+					number_of_bits = libpff_allocation_table_count_leading_zeros(
+					                  shifted_table_entry );
+				}
 				if( unallocated_size == 0 )
 				{
-					unallocated_offset = back_pointer_offset;
+					unallocated_offset = back_pointer_offset + (off64_t) ( bit_index * allocation_block_size );
 				}
-				unallocated_size += allocation_block_size;
+				unallocated_size += number_of_bits * allocation_block_size;
 			}
-			else if( unallocated_size > 0 )
+			else
 			{
-				if( libpff_offset_list_append_offset(
-				     unallocated_block_list,
-				     unallocated_offset,
-				     unallocated_size,
-				     1,
-				     error ) != 1 )
+				/* Determine the number of allocated blocks
+				 * the bits shifted in are 0 so the inverse contains at least bit index leading zeros
+				 * the inverse of a fully allocated entry is 0 for which the leading zeros are undefined
+				 */
+				if( ~shifted_table_entry == 0 )
 				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append unallocated block to list.",
-					 function );
-
-					memory_free(
-					 allocation_table_data );
+					number_of_bits = 64 - bit_index;
+				}
+				else
+				{
+					number_of_bits = libpff_allocation_table_count_leading_zeros(
+					                  ~shifted_table_entry );
+				}
 
-					return( -1 );
+				if( unallocated_size > 0 )
+				{
+					if( libpff_offset_list_append_offset(
+					     unallocated_block_list,
+					     unallocated_offset,
+					     unallocated_size,
+					     1,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to append unallocated block to list.",
+						 function );
+
+						return( -1 );
+					}
+					unallocated_size = 0;
 				}
-				unallocated_size = 0;
 			}
-			allocation_table_entry <<= 1;
-
-			back_pointer_offset += allocation_block_size;
 		}
+		back_pointer_offset += (off64_t) ( 64 * allocation_block_size );
 	}
 	if( unallocated_size > 0 )
 	{
@@ -400,9 +459,6 @@ int libpff_allocation_table_read(
 		}
 		unallocated_size = 0;
 	}
-	memory_free(
-	 allocation_table_data );
-
 	return( 1 );
 }
 
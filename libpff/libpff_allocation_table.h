@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libpff_io_statistics.h"
 #include "libpff_libbfio.h"
 #include "libpff_libcerror.h"
 #include "libpff_offset_list.h"
@@ -36,11 +37,17 @@ extern "C" {
 #define LIBPFF_ALLOCATION_TABLE_TYPE_PAGE	0x83
 #define LIBPFF_ALLOCATION_TABLE_TYPE_DATA	0x84
 
+#define LIBPFF_ALLOCATION_TABLE_MOST_SIGNIFICANT_BIT	0x8000000000000000ULL
+
+int libpff_allocation_table_count_leading_zeros(
+     uint64_t value );
+
 int libpff_allocation_table_read(
      libpff_offset_list_t *unallocated_block_list,
      libbfio_handle_t *file_io_handle,
      off64_t allocation_table_offset,
      uint8_t file_type,
+     libpff_io_statistics_t *io_statistics,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
@@ -0,0 +1,301 @@
+/*
+ * Arena functions
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libpff_arena.h"
+#include "libpff_definitions.h"
+#include "libpff_libcerror.h"
+#include "libpff_libcnotify.h"
+
+/* The size of the block header rounded up to the alignment
+ */
+#define LIBPFF_ARENA_BLOCK_HEADER_SIZE \
+	( ( sizeof( libpff_arena_block_t ) + ( LIBPFF_ARENA_ALIGNMENT - 1 ) ) & ~( (size_t) LIBPFF_ARENA_ALIGNMENT - 1 ) )
+
+/* Initializes the arena
+ * The blocks are allocated on demand
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_arena_initialize(
+     libpff_arena_t **arena,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_arena_initialize";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*arena = memory_allocate_structure(
+	          libpff_arena_t );
+
+	if( *arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *arena,
+	     0,
+	     sizeof( libpff_arena_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear arena.",
+		 function );
+
+		goto on_error;
+	}
+	( *arena )->block_size = block_size;
+
+	return( 1 );
+
+on_error:
+	if( *arena != NULL )
+	{
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees the arena and all the memory allocated from it
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_arena_free(
+     libpff_arena_t **arena,
+     libcerror_error_t **error )
+{
+	libpff_arena_block_t *arena_block = NULL;
+	libpff_arena_block_t *next_block  = NULL;
+	static char *function             = "libpff_arena_free";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: number of allocations\t: %d in %d blocks of %" PRIu64 " bytes\n",
+			 function,
+			 ( *arena )->number_of_allocations,
+			 ( *arena )->number_of_blocks,
+			 ( *arena )->allocated_size );
+		}
+#endif
+		arena_block = ( *arena )->blocks;
+
+		while( arena_block != NULL )
+		{
+			next_block = arena_block->next_block;
+
+			memory_free(
+			 arena_block );
+
+			arena_block = next_block;
+		}
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+	}
+	return( 1 );
+}
+
+/* Allocates memory from the arena
+ * The memory is cleared and remains valid until the arena is freed
+ * Allocations larger than a quarter of the block size get a block of their own
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_arena_allocate(
+     libpff_arena_t *arena,
+     size_t size,
+     void **memory,
+     libcerror_error_t **error )
+{
+	libpff_arena_block_t *arena_block = NULL;
+	static char *function             = "libpff_arena_allocate";
+	size_t aligned_size               = 0;
+	size_t data_size                  = 0;
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size_t) ( SSIZE_MAX - LIBPFF_ARENA_BLOCK_HEADER_SIZE - LIBPFF_ARENA_ALIGNMENT ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory.",
+		 function );
+
+		return( -1 );
+	}
+	aligned_size = ( size + ( LIBPFF_ARENA_ALIGNMENT - 1 ) ) & ~( (size_t) LIBPFF_ARENA_ALIGNMENT - 1 );
+
+	arena_block = arena->blocks;
+
+	if( ( arena_block == NULL )
+	 || ( aligned_size > ( arena_block->data_size - arena_block->used_data_size ) ) )
+	{
+		if( aligned_size > ( arena->block_size / 4 ) )
+		{
+			data_size = aligned_size;
+		}
+		else
+		{
+			data_size = arena->block_size;
+		}
+		arena_block = (libpff_arena_block_t *) memory_allocate(
+		                                        LIBPFF_ARENA_BLOCK_HEADER_SIZE + data_size );
+
+		if( arena_block == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create arena block.",
+			 function );
+
+			return( -1 );
+		}
+		arena_block->data_size      = data_size;
+		arena_block->used_data_size = 0;
+		arena_block->data           = &( ( (uint8_t *) arena_block )[ LIBPFF_ARENA_BLOCK_HEADER_SIZE ] );
+
+		/* A block of its own is added behind the current block
+		 * so that the remainder of the current block is still used
+		 */
+		if( ( data_size != arena->block_size )
+		 && ( arena->blocks != NULL ) )
+		{
+			arena_block->next_block   = arena->blocks->next_block;
+			arena->blocks->next_block = arena_block;
+		}
+		else
+		{
+			arena_block->next_block = arena->blocks;
+			arena->blocks           = arena_block;
+		}
+		arena->number_of_blocks += 1;
+		arena->allocated_size   += data_size;
+	}
+	*memory = (void *) &( arena_block->data[ arena_block->used_data_size ] );
+
+	if( memory_set(
+	     *memory,
+	     0,
+	     size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear memory.",
+		 function );
+
+		*memory = NULL;
+
+		return( -1 );
+	}
+	arena_block->used_data_size += aligned_size;
+	arena->number_of_allocations += 1;
+
+	return( 1 );
+}
+
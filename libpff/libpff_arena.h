@@ -0,0 +1,102 @@
+/*
+ * Arena functions
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBPFF_ARENA_H )
+#define _LIBPFF_ARENA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libpff_definitions.h"
+#include "libpff_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libpff_arena_block libpff_arena_block_t;
+
+struct libpff_arena_block
+{
+	/* The next block
+	 */
+	libpff_arena_block_t *next_block;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The used data size
+	 */
+	size_t used_data_size;
+
+	/* The data
+	 */
+	uint8_t *data;
+};
+
+typedef struct libpff_arena libpff_arena_t;
+
+struct libpff_arena
+{
+	/* The blocks
+	 * the first block is the block allocations are made from
+	 */
+	libpff_arena_block_t *blocks;
+
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The number of blocks
+	 */
+	int number_of_blocks;
+
+	/* The number of allocations
+	 */
+	int number_of_allocations;
+
+	/* The allocated size
+	 */
+	size64_t allocated_size;
+};
+
+int libpff_arena_initialize(
+     libpff_arena_t **arena,
+     size_t block_size,
+     libcerror_error_t **error );
+
+int libpff_arena_free(
+     libpff_arena_t **arena,
+     libcerror_error_t **error );
+
+int libpff_arena_allocate(
+     libpff_arena_t *arena,
+     size_t size,
+     void **memory,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
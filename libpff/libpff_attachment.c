@@ -179,37 +179,39 @@ int libpff_attachment_get_type(
 	return( 1 );
 }
 
-/* Retrieves the attachment data size
+/* Retrieves the attachment data reference
+ * The reference is resolved once and kept in the item, so that sequential reads
+ * do not need to look up the attachment data object entry on every call
+ * The item keeps its own clone of the attachment data object value reference,
+ * since the read offset of the reference must not be shared with other items
  * Returns 1 if successful, 0 if the item does not contain such value or -1 on error
  */
-int libpff_attachment_get_data_size(
-     libpff_item_t *attachment,
-     size64_t *size,
+int libpff_attachment_get_data_reference(
+     libpff_internal_item_t *internal_item,
+     libfdata_reference_t **data_reference,
+     libfcache_cache_t **data_cache,
      libcerror_error_t **error )
 {
 	libfcache_cache_t *value_data_cache        = NULL;
 	libfdata_reference_t *value_data_reference = NULL;
-	libpff_internal_item_t *internal_item      = NULL;
 	uint8_t *value_data                        = NULL;
-	static char *function                      = "libpff_attachment_get_data_size";
+	static char *function                      = "libpff_attachment_get_data_reference";
 	size_t value_data_size                     = 0;
-	uint32_t value_type                        = 0;
 	uint32_t embedded_object_data_identifier   = 0;
+	uint32_t value_type                        = 0;
 	int result                                 = 0;
 
-	if( attachment == NULL )
+	if( internal_item == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid attachment.",
+		 "%s: invalid internal item.",
 		 function );
 
 		return( -1 );
 	}
-	internal_item = (libpff_internal_item_t *) attachment;
-
 	if( internal_item->internal_file == NULL )
 	{
 		libcerror_error_set(
@@ -254,17 +256,42 @@ int libpff_attachment_get_data_size(
 
 		return( -1 );
 	}
-	if( size == NULL )
+	if( data_reference == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid size.",
+		 "%s: invalid data reference.",
 		 function );
 
 		return( -1 );
 	}
+	if( data_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->embedded_object_data_reference != NULL )
+	{
+		*data_reference = internal_item->embedded_object_data_reference;
+		*data_cache     = internal_item->embedded_object_data_cache;
+
+		return( 1 );
+	}
+	if( internal_item->attachment_data_reference != NULL )
+	{
+		*data_reference = internal_item->attachment_data_reference;
+		*data_cache     = internal_item->attachment_data_cache;
+
+		return( 1 );
+	}
 	result = libpff_item_values_get_entry_value(
 	          internal_item->item_values,
 	          internal_item->internal_file->name_to_id_map_list,
@@ -297,100 +324,118 @@ int libpff_attachment_get_data_size(
 	 */
 	if( value_type == LIBPFF_VALUE_TYPE_OBJECT )
 	{
-		if( internal_item->embedded_object_data_reference == NULL )
+		if( libfdata_reference_get_data(
+		     value_data_reference,
+		     internal_item->file_io_handle,
+		     value_data_cache,
+		     &value_data,
+		     &value_data_size,
+		     error ) != 1 )
 		{
-			if( libfdata_reference_get_data(
-			     value_data_reference,
-			     internal_item->file_io_handle,
-			     value_data_cache,
-			     &value_data,
-			     &value_data_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve embedded object data.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve embedded object data.",
+			 function );
 
-				return( -1 );
-			}
-			if( value_data == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing embedded object data.",
-				 function );
+			return( -1 );
+		}
+		if( value_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing embedded object data.",
+			 function );
 
-				return( -1 );
-			}
-			/* The descriptor identifier is located in the local descriptors tree
-			 */
-			byte_stream_copy_to_uint32_little_endian(
-			 value_data,
+			return( -1 );
+		}
+		/* The descriptor identifier is located in the local descriptors tree
+		 */
+		byte_stream_copy_to_uint32_little_endian(
+		 value_data,
+		 embedded_object_data_identifier );
+
+		if( libpff_item_values_read_local_descriptor_data(
+		     internal_item->item_values,
+		     internal_item->internal_file->io_handle,
+		     internal_item->file_io_handle,
+		     embedded_object_data_identifier,
+		     &( internal_item->embedded_object_data_reference ),
+		     &( internal_item->embedded_object_data_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read embedded object: %" PRIu32 ".",
+			 function,
 			 embedded_object_data_identifier );
 
-			if( libpff_item_values_read_local_descriptor_data(
-			     internal_item->item_values,
-			     internal_item->internal_file->io_handle,
-			     internal_item->file_io_handle,
-			     embedded_object_data_identifier,
-			     &( internal_item->embedded_object_data_reference ),
-			     &( internal_item->embedded_object_data_cache ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to read embedded object: %" PRIu32 ".",
-				 function,
-				 embedded_object_data_identifier );
-
-				return( -1 );
-			}
+			return( -1 );
 		}
-		value_data_reference = internal_item->embedded_object_data_reference;
-		value_data_cache     = internal_item->embedded_object_data_cache;
+		*data_reference = internal_item->embedded_object_data_reference;
+		*data_cache     = internal_item->embedded_object_data_cache;
+
+		return( 1 );
 	}
-	if( libfdata_reference_get_size(
+	if( libfdata_reference_clone(
+	     &( internal_item->attachment_data_reference ),
 	     value_data_reference,
-	     size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value data size.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create attachment data reference.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
+	if( libfcache_cache_clone(
+	     &( internal_item->attachment_data_cache ),
+	     value_data_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create attachment data cache.",
+		 function );
+
+		goto on_error;
+	}
+	*data_reference = internal_item->attachment_data_reference;
+	*data_cache     = internal_item->attachment_data_cache;
+
 	return( 1 );
+
+on_error:
+	if( internal_item->attachment_data_reference != NULL )
+	{
+		libfdata_reference_free(
+		 &( internal_item->attachment_data_reference ),
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Reads attachment data from the current offset into a buffer
- * Returns the number of bytes read or -1 on error
+/* Retrieves the attachment data size
+ * Returns 1 if successful, 0 if the item does not contain such value or -1 on error
  */
-ssize_t libpff_attachment_data_read_buffer(
-         libpff_item_t *attachment,
-         uint8_t *buffer,
-         size_t buffer_size,
-         libcerror_error_t **error )
+int libpff_attachment_get_data_size(
+     libpff_item_t *attachment,
+     size64_t *size,
+     libcerror_error_t **error )
 {
 	libfcache_cache_t *value_data_cache        = NULL;
 	libfdata_reference_t *value_data_reference = NULL;
-	libpff_internal_item_t *internal_item      = NULL;
-	uint8_t *value_data                        = NULL;
-	static char *function                      = "libpff_attachment_data_read_buffer";
-	size_t value_data_size                     = 0;
-	ssize_t read_count                         = 0;
-	uint32_t embedded_object_data_identifier   = 0;
-	uint32_t value_type                        = 0;
+	static char *function                      = "libpff_attachment_get_data_size";
 	int result                                 = 0;
 
 	if( attachment == NULL )
@@ -404,63 +449,90 @@ ssize_t libpff_attachment_data_read_buffer(
 
 		return( -1 );
 	}
-	internal_item = (libpff_internal_item_t *) attachment;
-
-	if( internal_item->internal_file == NULL )
+	if( size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid attachment - missing internal file.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_item->item_values == NULL )
+	result = libpff_attachment_get_data_reference(
+	          (libpff_internal_item_t *) attachment,
+	          &value_data_reference,
+	          &value_data_cache,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid attachment - missing item values.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve attachment data reference.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_item->item_tree_node == NULL )
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfdata_reference_get_size(
+	     value_data_reference,
+	     size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid internal item - missing item tree node.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value data size.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_item->item_tree_node->value == NULL )
+	return( 1 );
+}
+
+/* Reads attachment data from the current offset into a buffer
+ * Segments that fit entirely in the buffer are read and decrypted in place,
+ * so large buffer sizes (e.g. 1 MiB) avoid the intermediate segment cache copy
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libpff_attachment_data_read_buffer(
+         libpff_item_t *attachment,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libfcache_cache_t *value_data_cache        = NULL;
+	libfdata_reference_t *value_data_reference = NULL;
+	libpff_internal_item_t *internal_item      = NULL;
+	static char *function                      = "libpff_attachment_data_read_buffer";
+	ssize_t read_count                         = 0;
+	int result                                 = 0;
+
+	if( attachment == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid internal item - invalid item tree node - missing value.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attachment.",
 		 function );
 
 		return( -1 );
 	}
-	result = libpff_item_values_get_entry_value(
-	          internal_item->item_values,
-	          internal_item->internal_file->name_to_id_map_list,
-	          internal_item->internal_file->io_handle,
-	          internal_item->file_io_handle,
-	          0,
-	          LIBPFF_ENTRY_TYPE_ATTACHMENT_DATA_OBJECT,
-	          &value_type,
+	internal_item = (libpff_internal_item_t *) attachment;
+
+	result = libpff_attachment_get_data_reference(
+	          internal_item,
 	          &value_data_reference,
 	          &value_data_cache,
-	          LIBPFF_ENTRY_VALUE_FLAG_MATCH_ANY_VALUE_TYPE,
 	          error );
 
 	if( result == -1 )
@@ -469,7 +541,7 @@ ssize_t libpff_attachment_data_read_buffer(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve entry value.",
+		 "%s: unable to retrieve attachment data reference.",
 		 function );
 
 		return( -1 );
@@ -478,69 +550,6 @@ ssize_t libpff_attachment_data_read_buffer(
 	{
 		return( 0 );
 	}
-	/* The OLE attachment method could refer to an OLE embedded object
-	 */
-	if( value_type == LIBPFF_VALUE_TYPE_OBJECT )
-	{
-		if( internal_item->embedded_object_data_reference == NULL )
-		{
-			if( libfdata_reference_get_data(
-			     value_data_reference,
-			     internal_item->file_io_handle,
-			     value_data_cache,
-			     &value_data,
-			     &value_data_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve embedded object data.",
-				 function );
-
-				return( -1 );
-			}
-			if( value_data == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: invalid entry embedded object data.",
-				 function );
-
-				return( -1 );
-			}
-			/* The descriptor identifier is located in the local descriptors tree
-			 */
-			byte_stream_copy_to_uint32_little_endian(
-			 value_data,
-			 embedded_object_data_identifier );
-
-			if( libpff_item_values_read_local_descriptor_data(
-			     internal_item->item_values,
-			     internal_item->internal_file->io_handle,
-			     internal_item->file_io_handle,
-			     embedded_object_data_identifier,
-			     &( internal_item->embedded_object_data_reference ),
-			     &( internal_item->embedded_object_data_cache ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to read embedded object: %" PRIu32 ".",
-				 function,
-				 embedded_object_data_identifier );
-
-				return( -1 );
-			}
-		}
-		value_data_reference = internal_item->embedded_object_data_reference;
-		value_data_cache     = internal_item->embedded_object_data_cache;
-	}
 	read_count = libfdata_reference_read_buffer(
 	              value_data_reference,
 	              internal_item->file_io_handle,
@@ -574,12 +583,7 @@ off64_t libpff_attachment_data_seek_offset(
 {
 	libfcache_cache_t *value_data_cache        = NULL;
 	libfdata_reference_t *value_data_reference = NULL;
-	libpff_internal_item_t *internal_item      = NULL;
-	uint8_t *value_data                        = NULL;
 	static char *function                      = "libpff_attachment_data_seek_offset";
-	size_t value_data_size                     = 0;
-	uint32_t embedded_object_data_identifier   = 0;
-	uint32_t value_type                        = 0;
 	int result                                 = 0;
 
 	if( attachment == NULL )
@@ -593,63 +597,137 @@ off64_t libpff_attachment_data_seek_offset(
 
 		return( -1 );
 	}
-	internal_item = (libpff_internal_item_t *) attachment;
+	result = libpff_attachment_get_data_reference(
+	          (libpff_internal_item_t *) attachment,
+	          &value_data_reference,
+	          &value_data_cache,
+	          error );
 
-	if( internal_item->internal_file == NULL )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid attachment - missing internal file.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve attachment data reference.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_item->item_values == NULL )
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	offset = libfdata_reference_seek_offset(
+	          value_data_reference,
+	          offset,
+	          whence,
+	          error );
+
+	if( offset == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid attachment - missing item values.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset in value data reference.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_item->item_tree_node == NULL )
+	return( offset );
+}
+
+/* Retrieves the number of attachment data extents
+ * An extent is a range in the file that contains the attachment data as-is,
+ * extents are only available if the data is stored unencrypted in data blocks
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libpff_attachment_get_number_of_data_extents(
+     libpff_item_t *attachment,
+     int *number_of_extents,
+     libcerror_error_t **error )
+{
+	libfcache_cache_t *value_data_cache        = NULL;
+	libfdata_reference_t *value_data_reference = NULL;
+	libpff_internal_item_t *internal_item      = NULL;
+	static char *function                      = "libpff_attachment_get_number_of_data_extents";
+	off64_t extent_offset                      = 0;
+	size64_t extent_size                       = 0;
+	uint32_t extent_flags                      = 0;
+	int result                                 = 0;
+
+	if( attachment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attachment.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libpff_internal_item_t *) attachment;
+
+	if( number_of_extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	result = libpff_attachment_get_data_reference(
+	          internal_item,
+	          &value_data_reference,
+	          &value_data_cache,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid internal item - missing item tree node.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve attachment data reference.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_item->item_tree_node->value == NULL )
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( internal_item->internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid internal item - invalid item tree node - missing value.",
+		 "%s: invalid attachment - invalid internal file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	result = libpff_item_values_get_entry_value(
-	          internal_item->item_values,
-	          internal_item->internal_file->name_to_id_map_list,
-	          internal_item->internal_file->io_handle,
-	          internal_item->file_io_handle,
+	/* The data on disk only equals the attachment data if it is not encrypted
+	 */
+	if( ( internal_item->internal_file->io_handle->encryption_type != LIBPFF_ENCRYPTION_TYPE_NONE )
+	 || ( internal_item->internal_file->io_handle->force_decryption != 0 ) )
+	{
+		return( 0 );
+	}
+	/* Only data stored in data blocks has segments that map onto the file
+	 */
+	result = libfdata_reference_get_segment_by_index(
+	          value_data_reference,
 	          0,
-	          LIBPFF_ENTRY_TYPE_ATTACHMENT_DATA_OBJECT,
-	          &value_type,
-	          &value_data_reference,
-	          &value_data_cache,
-	          LIBPFF_ENTRY_VALUE_FLAG_MATCH_ANY_VALUE_TYPE,
+	          &extent_offset,
+	          &extent_size,
+	          &extent_flags,
 	          error );
 
 	if( result == -1 )
@@ -658,7 +736,7 @@ off64_t libpff_attachment_data_seek_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve entry value.",
+		 "%s: unable to retrieve value data segment: 0.",
 		 function );
 
 		return( -1 );
@@ -667,87 +745,109 @@ off64_t libpff_attachment_data_seek_offset(
 	{
 		return( 0 );
 	}
-	/* The OLE attachment method could refer to an OLE embedded object
-	 */
-	if( value_type == LIBPFF_VALUE_TYPE_OBJECT )
+	if( libfdata_reference_get_number_of_segments(
+	     value_data_reference,
+	     number_of_extents,
+	     error ) != 1 )
 	{
-		if( internal_item->embedded_object_data_reference == NULL )
-		{
-			if( libfdata_reference_get_data(
-			     value_data_reference,
-			     internal_item->file_io_handle,
-			     value_data_cache,
-			     &value_data,
-			     &value_data_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve embedded object data.",
-				 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of value data segments.",
+		 function );
 
-				return( -1 );
-			}
-			if( value_data == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: invalid entry embedded object data.",
-				 function );
+		return( -1 );
+	}
+	return( 1 );
+}
 
-				return( -1 );
-			}
-			/* The descriptor identifier is located in the local descriptors tree
-			 */
-			byte_stream_copy_to_uint32_little_endian(
-			 value_data,
-			 embedded_object_data_identifier );
+/* Retrieves a specific attachment data extent
+ * The extent offset is relative to the start of the file
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libpff_attachment_get_data_extent_by_index(
+     libpff_item_t *attachment,
+     int extent_index,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     libcerror_error_t **error )
+{
+	libfcache_cache_t *value_data_cache        = NULL;
+	libfdata_reference_t *value_data_reference = NULL;
+	static char *function                      = "libpff_attachment_get_data_extent_by_index";
+	uint32_t extent_flags                      = 0;
+	int number_of_extents                      = 0;
+	int result                                 = 0;
 
-			if( libpff_item_values_read_local_descriptor_data(
-			     internal_item->item_values,
-			     internal_item->internal_file->io_handle,
-			     internal_item->file_io_handle,
-			     embedded_object_data_identifier,
-			     &( internal_item->embedded_object_data_reference ),
-			     &( internal_item->embedded_object_data_cache ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to read embedded object: %" PRIu32 ".",
-				 function,
-				 embedded_object_data_identifier );
+	result = libpff_attachment_get_number_of_data_extents(
+	          attachment,
+	          &number_of_extents,
+	          error );
 
-				return( -1 );
-			}
-		}
-		value_data_reference = internal_item->embedded_object_data_reference;
-		value_data_cache     = internal_item->embedded_object_data_cache;
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data extents.",
+		 function );
+
+		return( -1 );
 	}
-	offset = libfdata_reference_seek_offset(
-	          value_data_reference,
-	          offset,
-	          whence,
-	          error );
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( ( extent_index < 0 )
+	 || ( extent_index >= number_of_extents ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid extent index value out of bounds.",
+		 function );
 
-	if( offset == -1 )
+		return( -1 );
+	}
+	/* The reference was resolved by libpff_attachment_get_number_of_data_extents
+	 */
+	if( libpff_attachment_get_data_reference(
+	     (libpff_internal_item_t *) attachment,
+	     &value_data_reference,
+	     &value_data_cache,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset in value data reference.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve attachment data reference.",
 		 function );
 
 		return( -1 );
 	}
-	return( offset );
+	if( libfdata_reference_get_segment_by_index(
+	     value_data_reference,
+	     extent_index,
+	     extent_offset,
+	     extent_size,
+	     &extent_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value data segment: %d.",
+		 function,
+		 extent_index );
+
+		return( -1 );
+	}
+	return( 1 );
 }
 
 /* Retrieves the attachment data file IO handle
@@ -26,8 +26,11 @@
 #include <types.h>
 
 #include "libpff_extern.h"
+#include "libpff_item.h"
 #include "libpff_libbfio.h"
 #include "libpff_libcerror.h"
+#include "libpff_libfcache.h"
+#include "libpff_libfdata.h"
 #include "libpff_types.h"
 
 #if defined( __cplusplus )
@@ -40,6 +43,12 @@ int libpff_attachment_get_type(
      int *attachment_type,
      libcerror_error_t **error );
 
+int libpff_attachment_get_data_reference(
+     libpff_internal_item_t *internal_item,
+     libfdata_reference_t **data_reference,
+     libfcache_cache_t **data_cache,
+     libcerror_error_t **error );
+
 LIBPFF_EXTERN \
 int libpff_attachment_get_data_size(
      libpff_item_t *attachment,
@@ -60,6 +69,20 @@ off64_t libpff_attachment_data_seek_offset(
          int whence,
          libcerror_error_t **error );
 
+LIBPFF_EXTERN \
+int libpff_attachment_get_number_of_data_extents(
+     libpff_item_t *attachment,
+     int *number_of_extents,
+     libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+int libpff_attachment_get_data_extent_by_index(
+     libpff_item_t *attachment,
+     int extent_index,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     libcerror_error_t **error );
+
 LIBPFF_EXTERN \
 int libpff_attachment_get_data_file_io_handle(
      libpff_item_t *attachment,
@@ -0,0 +1,423 @@
+/*
+ * Buffer pool functions
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libpff_buffer_pool.h"
+#include "libpff_definitions.h"
+#include "libpff_libcerror.h"
+
+/* Initializes the buffer pool
+ * The hits, allocations and peak used size of the buffer pool are counted in the IO statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_buffer_pool_initialize(
+     libpff_buffer_pool_t **buffer_pool,
+     libpff_io_statistics_t *io_statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_buffer_pool_initialize";
+
+	if( buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid buffer pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*buffer_pool = memory_allocate_structure(
+	                libpff_buffer_pool_t );
+
+	if( *buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *buffer_pool,
+	     0,
+	     sizeof( libpff_buffer_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buffer pool.",
+		 function );
+
+		goto on_error;
+	}
+	( *buffer_pool )->io_statistics = io_statistics;
+
+	return( 1 );
+
+on_error:
+	if( *buffer_pool != NULL )
+	{
+		memory_free(
+		 *buffer_pool );
+
+		*buffer_pool = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees the buffer pool and its free buffers
+ * Buffers that are still in use are not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_buffer_pool_free(
+     libpff_buffer_pool_t **buffer_pool,
+     libcerror_error_t **error )
+{
+	uint8_t *free_buffer  = NULL;
+	uint8_t *next_buffer  = NULL;
+	static char *function = "libpff_buffer_pool_free";
+	int size_class        = 0;
+
+	if( buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer_pool != NULL )
+	{
+		for( size_class = 0;
+		     size_class < LIBPFF_BUFFER_POOL_NUMBER_OF_SIZE_CLASSES;
+		     size_class++ )
+		{
+			free_buffer = ( *buffer_pool )->free_buffers[ size_class ];
+
+			while( free_buffer != NULL )
+			{
+				next_buffer = *( (uint8_t **) free_buffer );
+
+				memory_free(
+				 free_buffer );
+
+				free_buffer = next_buffer;
+			}
+		}
+		memory_free(
+		 *buffer_pool );
+
+		*buffer_pool = NULL;
+	}
+	return( 1 );
+}
+
+/* Determines the size class of a buffer size
+ * Returns 1 if successful, 0 if the buffer size exceeds the largest size class or -1 on error
+ */
+int libpff_buffer_pool_get_size_class(
+     size_t buffer_size,
+     int *size_class,
+     size_t *size_class_buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function        = "libpff_buffer_pool_get_size_class";
+	size_t maximum_buffer_size   = LIBPFF_BUFFER_POOL_MINIMUM_BUFFER_SIZE;
+	int size_class_iterator      = 0;
+
+	if( size_class == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size class.",
+		 function );
+
+		return( -1 );
+	}
+	if( size_class_buffer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size class buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	for( size_class_iterator = 0;
+	     size_class_iterator < LIBPFF_BUFFER_POOL_NUMBER_OF_SIZE_CLASSES;
+	     size_class_iterator++ )
+	{
+		if( buffer_size <= maximum_buffer_size )
+		{
+			*size_class             = size_class_iterator;
+			*size_class_buffer_size = maximum_buffer_size;
+
+			return( 1 );
+		}
+		maximum_buffer_size *= 2;
+	}
+	return( 0 );
+}
+
+/* Retrieves a buffer of at least the buffer size from the buffer pool
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_buffer_pool_get_buffer(
+     libpff_buffer_pool_t *buffer_pool,
+     size_t buffer_size,
+     uint8_t **buffer,
+     libcerror_error_t **error )
+{
+	static char *function         = "libpff_buffer_pool_get_buffer";
+	size_t size_class_buffer_size = 0;
+	int size_class                = 0;
+	int result                    = 0;
+
+	if( buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = libpff_buffer_pool_get_size_class(
+	          buffer_size,
+	          &size_class,
+	          &size_class_buffer_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size class.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		/* Buffers larger than the largest size class are not pooled
+		 */
+		size_class_buffer_size = buffer_size;
+	}
+	else if( buffer_pool->free_buffers[ size_class ] != NULL )
+	{
+		*buffer = buffer_pool->free_buffers[ size_class ];
+
+		buffer_pool->free_buffers[ size_class ] = *( (uint8_t **) *buffer );
+
+		buffer_pool->number_of_free_buffers[ size_class ] -= 1;
+
+		if( buffer_pool->io_statistics != NULL )
+		{
+			buffer_pool->io_statistics->number_of_buffer_pool_hits += 1;
+		}
+	}
+	if( *buffer == NULL )
+	{
+		*buffer = (uint8_t *) memory_allocate(
+		                       sizeof( uint8_t ) * size_class_buffer_size );
+
+		if( *buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( buffer_pool->io_statistics != NULL )
+		{
+			buffer_pool->io_statistics->number_of_buffer_pool_allocations += 1;
+		}
+	}
+	buffer_pool->used_size += size_class_buffer_size;
+
+	if( buffer_pool->io_statistics != NULL )
+	{
+		if( buffer_pool->used_size > buffer_pool->io_statistics->buffer_pool_peak_used_size )
+		{
+			buffer_pool->io_statistics->buffer_pool_peak_used_size = buffer_pool->used_size;
+		}
+	}
+	return( 1 );
+}
+
+/* Releases a buffer that was retrieved from the buffer pool
+ * The buffer size must be the size the buffer was retrieved with
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_buffer_pool_release_buffer(
+     libpff_buffer_pool_t *buffer_pool,
+     uint8_t **buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "libpff_buffer_pool_release_buffer";
+	size_t size_class_buffer_size = 0;
+	int size_class                = 0;
+	int result                    = 0;
+
+	if( buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer == NULL )
+	{
+		return( 1 );
+	}
+	result = libpff_buffer_pool_get_size_class(
+	          buffer_size,
+	          &size_class,
+	          &size_class_buffer_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size class.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		size_class_buffer_size = buffer_size;
+	}
+	if( buffer_pool->used_size >= size_class_buffer_size )
+	{
+		buffer_pool->used_size -= size_class_buffer_size;
+	}
+	else
+	{
+		buffer_pool->used_size = 0;
+	}
+	if( ( result != 0 )
+	 && ( buffer_pool->number_of_free_buffers[ size_class ] < LIBPFF_BUFFER_POOL_MAXIMUM_NUMBER_OF_FREE_BUFFERS ) )
+	{
+		*( (uint8_t **) *buffer ) = buffer_pool->free_buffers[ size_class ];
+
+		buffer_pool->free_buffers[ size_class ] = *buffer;
+
+		buffer_pool->number_of_free_buffers[ size_class ] += 1;
+	}
+	else
+	{
+		memory_free(
+		 *buffer );
+	}
+	*buffer = NULL;
+
+	return( 1 );
+}
+
@@ -0,0 +1,91 @@
+/*
+ * Buffer pool functions
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBPFF_BUFFER_POOL_H )
+#define _LIBPFF_BUFFER_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libpff_definitions.h"
+#include "libpff_io_statistics.h"
+#include "libpff_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libpff_buffer_pool libpff_buffer_pool_t;
+
+struct libpff_buffer_pool
+{
+	/* The free buffers per size class
+	 * the start of a free buffer contains a reference to the next free buffer
+	 */
+	uint8_t *free_buffers[ LIBPFF_BUFFER_POOL_NUMBER_OF_SIZE_CLASSES ];
+
+	/* The number of free buffers per size class
+	 */
+	int number_of_free_buffers[ LIBPFF_BUFFER_POOL_NUMBER_OF_SIZE_CLASSES ];
+
+	/* The size of the buffers currently in use
+	 */
+	size64_t used_size;
+
+	/* The IO statistics
+	 * the IO statistics are not managed by the buffer pool
+	 */
+	libpff_io_statistics_t *io_statistics;
+};
+
+int libpff_buffer_pool_initialize(
+     libpff_buffer_pool_t **buffer_pool,
+     libpff_io_statistics_t *io_statistics,
+     libcerror_error_t **error );
+
+int libpff_buffer_pool_free(
+     libpff_buffer_pool_t **buffer_pool,
+     libcerror_error_t **error );
+
+int libpff_buffer_pool_get_size_class(
+     size_t buffer_size,
+     int *size_class,
+     size_t *size_class_buffer_size,
+     libcerror_error_t **error );
+
+int libpff_buffer_pool_get_buffer(
+     libpff_buffer_pool_t *buffer_pool,
+     size_t buffer_size,
+     uint8_t **buffer,
+     libcerror_error_t **error );
+
+int libpff_buffer_pool_release_buffer(
+     libpff_buffer_pool_t *buffer_pool,
+     uint8_t **buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
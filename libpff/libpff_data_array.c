@@ -351,20 +351,23 @@ int libpff_data_array_read_entries(
      uint32_t *total_data_size,
      libcerror_error_t **error )
 {
-	libpff_data_array_entry_t *data_array_entry = NULL;
-	libpff_index_value_t *offset_index_value    = NULL;
-	uint8_t *sub_array_data                     = NULL;
-	static char *function                       = "libpff_data_array_read_entries";
-	size_t sub_array_data_size                  = 0;
-	ssize_t read_count                          = 0;
-	uint64_t array_entry_identifier             = 0;
-	uint32_t calculated_total_data_size         = 0;
-	uint32_t sub_total_data_size                = 0;
-	uint16_t array_entry_iterator               = 0;
-	uint16_t number_of_array_entries            = 0;
-	uint8_t array_entries_level                 = 0;
-	uint8_t sub_flags                           = 0;
-	int previous_number_of_data_array_entries   = 0;
+	libpff_data_array_entry_t *data_array_entry             = NULL;
+	libpff_data_array_identifier_t *array_entry_identifiers = NULL;
+	libpff_index_value_t *offset_index_value                = NULL;
+	uint8_t *sub_array_data                                 = NULL;
+	static char *function                                   = "libpff_data_array_read_entries";
+	size_t array_entry_size                                 = 0;
+	size_t sub_array_data_size                              = 0;
+	ssize_t read_count                                      = 0;
+	uint64_t array_entry_identifier                         = 0;
+	uint32_t calculated_total_data_size                     = 0;
+	uint32_t sub_total_data_size                            = 0;
+	uint16_t array_entry_iterator                           = 0;
+	uint16_t array_entry_index                              = 0;
+	uint16_t number_of_array_entries                        = 0;
+	uint8_t array_entries_level                             = 0;
+	uint8_t sub_flags                                       = 0;
+	int previous_number_of_data_array_entries               = 0;
 
 	if( io_handle == NULL )
 	{
@@ -501,6 +504,25 @@ int libpff_data_array_read_entries(
 
 		return( -1 );
 	}
+	if( io_handle->file_type == LIBPFF_FILE_TYPE_32BIT )
+	{
+		array_entry_size = 4;
+	}
+	else
+	{
+		array_entry_size = 8;
+	}
+	if( ( (size_t) number_of_array_entries * array_entry_size ) > array_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: number of array entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
 	if( data_array->data_size == 0 )
 	{
 		data_array->data_size = *total_data_size;
@@ -551,25 +573,83 @@ int libpff_data_array_read_entries(
 			return( -1 );
 		}
 	}
+	if( ( array_entries_level == 1 )
+	 && ( number_of_array_entries > 0 ) )
+	{
+		/* The entry identifiers are resolved in identifier order, so that consecutive
+		 * lookups traverse the same offset index nodes which are then cached
+		 */
+		array_entry_identifiers = (libpff_data_array_identifier_t *) memory_allocate(
+		                                                              sizeof( libpff_data_array_identifier_t ) * number_of_array_entries );
+
+		if( array_entry_identifiers == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create array entry identifiers.",
+			 function );
+
+			goto on_error;
+		}
+		for( array_entry_iterator = 0;
+		     array_entry_iterator < number_of_array_entries;
+		     array_entry_iterator++ )
+		{
+			if( io_handle->file_type == LIBPFF_FILE_TYPE_32BIT )
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 array_data,
+				 array_entry_identifier );
+
+				array_data += 4;
+			}
+			else if( io_handle->file_type == LIBPFF_FILE_TYPE_64BIT )
+			{
+				byte_stream_copy_to_uint64_little_endian(
+				 array_data,
+				 array_entry_identifier );
+
+				array_data += 8;
+			}
+			array_entry_identifiers[ array_entry_iterator ].identifier  = array_entry_identifier;
+			array_entry_identifiers[ array_entry_iterator ].entry_index = array_entry_iterator;
+		}
+		qsort(
+		 array_entry_identifiers,
+		 (size_t) number_of_array_entries,
+		 sizeof( libpff_data_array_identifier_t ),
+		 &libpff_data_array_identifier_compare );
+	}
 	for( array_entry_iterator = 0;
 	     array_entry_iterator < number_of_array_entries;
 	     array_entry_iterator++ )
 	{
-		if( io_handle->file_type == LIBPFF_FILE_TYPE_32BIT )
+		if( array_entries_level == 1 )
 		{
-			byte_stream_copy_to_uint32_little_endian(
-			 array_data,
-			 array_entry_identifier );
-
-			array_data += 4;
+			array_entry_identifier = array_entry_identifiers[ array_entry_iterator ].identifier;
+			array_entry_index      = array_entry_identifiers[ array_entry_iterator ].entry_index;
 		}
-		else if( io_handle->file_type == LIBPFF_FILE_TYPE_64BIT )
+		else
 		{
-			byte_stream_copy_to_uint64_little_endian(
-			 array_data,
-			 array_entry_identifier );
+			if( io_handle->file_type == LIBPFF_FILE_TYPE_32BIT )
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 array_data,
+				 array_entry_identifier );
 
-			array_data += 8;
+				array_data += 4;
+			}
+			else if( io_handle->file_type == LIBPFF_FILE_TYPE_64BIT )
+			{
+				byte_stream_copy_to_uint64_little_endian(
+				 array_data,
+				 array_entry_identifier );
+
+				array_data += 8;
+			}
+			array_entry_index = array_entry_iterator;
 		}
 		/* TODO handle multiple recovered offset index values */
 		if( libpff_io_handle_get_offset_index_value_by_identifier(
@@ -589,7 +669,7 @@ int libpff_data_array_read_entries(
 			 function,
 			 array_entry_identifier );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( offset_index_value == NULL )
 		{
@@ -600,7 +680,7 @@ int libpff_data_array_read_entries(
 			 "%s: missing offset index value.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -608,7 +688,7 @@ int libpff_data_array_read_entries(
 			libcnotify_printf(
 			 "%s: array entry: %03" PRIu16 " at level: %" PRIu8 " identifier: %" PRIu64 " (%s) at offset: %" PRIi64 " of size: %" PRIu32 "\n",
 			 function,
-			 array_entry_iterator,
+			 array_entry_index,
 			 array_entries_level,
 			 offset_index_value->identifier,
 			 ( ( offset_index_value->identifier & LIBPFF_OFFSET_INDEX_IDENTIFIER_FLAG_INTERNAL ) ? "internal" : "external" ),
@@ -625,7 +705,7 @@ int libpff_data_array_read_entries(
 			 "%s: invalid file offset value out of bounds.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 #if UINT32_MAX > SSIZE_MAX
 		if( offset_index_value->data_size > (size32_t) SSIZE_MAX )
@@ -637,7 +717,7 @@ int libpff_data_array_read_entries(
 			 "%s: data size value exceeds maximum.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 #endif
 		if( array_entries_level == 1 )
@@ -653,11 +733,11 @@ int libpff_data_array_read_entries(
 				 calculated_total_data_size + offset_index_value->data_size,
 				 data_array->data_size );
 
-				return( -1 );
+				goto on_error;
 			}
 			if( libfdata_block_set_segment_by_index(
 			     descriptor_data_block,
-			     previous_number_of_data_array_entries + (int) array_entry_iterator,
+			     previous_number_of_data_array_entries + (int) array_entry_index,
 			     offset_index_value->file_offset,
 			     (size64_t) offset_index_value->data_size,
 			     0,
@@ -669,9 +749,9 @@ int libpff_data_array_read_entries(
 				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
 				 "%s: unable to set descriptor data block segment: %d.",
 				 function,
-				 previous_number_of_data_array_entries + (int) array_entry_iterator );
+				 previous_number_of_data_array_entries + (int) array_entry_index );
 
-				return( -1 );
+				goto on_error;
 			}
 			if( libpff_data_array_entry_initialize(
 			     &data_array_entry,
@@ -684,13 +764,13 @@ int libpff_data_array_read_entries(
 				 "%s: unable to create data array entry.",
 				 function );
 
-				return( -1 );
+				goto on_error;
 			}
 			data_array_entry->data_identifier = offset_index_value->identifier;
 
 			if( libpff_array_set_entry_by_index(
 			     data_array->entries,
-			     previous_number_of_data_array_entries + (int) array_entry_iterator,
+			     previous_number_of_data_array_entries + (int) array_entry_index,
 			     (intptr_t *) data_array_entry,
 			     error ) != 1 )
 			{
@@ -700,13 +780,13 @@ int libpff_data_array_read_entries(
 				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
 				 "%s: unable to set data array entry: %d.",
 				 function,
-				 previous_number_of_data_array_entries + (int) array_entry_iterator );
+				 previous_number_of_data_array_entries + (int) array_entry_index );
 
 				libpff_data_array_entry_free(
 				 &data_array_entry,
 				 NULL );
 
-				return( -1 );
+				goto on_error;
 			}
 			data_array_entry = NULL;
 
@@ -739,7 +819,7 @@ int libpff_data_array_read_entries(
 				 function,
 				 offset_index_value->file_offset );
 
-				return( -1 );
+				goto on_error;
 			}
 			sub_array_data = (uint8_t *) memory_allocate(
 			                              sizeof( uint8_t ) * offset_index_value->data_size );
@@ -753,7 +833,7 @@ int libpff_data_array_read_entries(
 				 "%s: unable to create sub array data.",
 				 function );
 
-				return( -1 );
+				goto on_error;
 			}
 			read_count = libpff_data_block_read(
 				      file_io_handle,
@@ -762,6 +842,7 @@ int libpff_data_array_read_entries(
 				      sub_array_data,
 				      offset_index_value->data_size,
 				      &sub_flags,
+				      &( io_handle->statistics ),
 				      error );
 
 			if( read_count != (ssize_t) offset_index_value->data_size )
@@ -776,7 +857,7 @@ int libpff_data_array_read_entries(
 				memory_free(
 				 sub_array_data );
 
-				return( -1 );
+				goto on_error;
 			}
 			sub_array_data_size = (size_t) offset_index_value->data_size;
 
@@ -801,7 +882,7 @@ int libpff_data_array_read_entries(
 				memory_free(
 				 sub_array_data );
 
-				return( -1 );
+				goto on_error;
 			}
 			memory_free(
 			 sub_array_data );
@@ -820,9 +901,44 @@ int libpff_data_array_read_entries(
 		 *total_data_size,
 		 calculated_total_data_size );
 
-		return( -1 );
+		goto on_error;
+	}
+	if( array_entry_identifiers != NULL )
+	{
+		memory_free(
+		 array_entry_identifiers );
 	}
 	return( 1 );
+
+on_error:
+	if( array_entry_identifiers != NULL )
+	{
+		memory_free(
+		 array_entry_identifiers );
+	}
+	return( -1 );
+}
+
+/* Compares two data array identifiers
+ * Used as the qsort comparison function
+ * Returns -1 if first is less than second, 0 if equal or 1 if greater
+ */
+int libpff_data_array_identifier_compare(
+     const void *first_identifier,
+     const void *second_identifier )
+{
+	uint64_t first_value  = ( (libpff_data_array_identifier_t *) first_identifier )->identifier;
+	uint64_t second_value = ( (libpff_data_array_identifier_t *) second_identifier )->identifier;
+
+	if( first_value < second_value )
+	{
+		return( -1 );
+	}
+	else if( first_value > second_value )
+	{
+		return( 1 );
+	}
+	return( 0 );
 }
 
 /* Reads the data array entry data
@@ -922,6 +1038,7 @@ ssize_t libpff_data_array_read_entry_data(
 		      data,
 		      data_size,
 		      &( data_array_entry->flags ),
+		      &( data_array->io_handle->statistics ),
 		      error );
 
 	if( read_count != (ssize_t) data_size )
@@ -1195,6 +1312,12 @@ int libpff_data_array_decrypt_entry_data(
 
 			return( -1 );
 		}
+		/* Data without encryption is passed through unchanged
+		 */
+		if( encryption_type != LIBPFF_ENCRYPTION_TYPE_NONE )
+		{
+			data_array->io_handle->statistics.number_of_bytes_decrypted += (uint64_t) data_size;
+		}
 		if( force_decryption != 0 )
 		{
 			/* Test if the data contains an unencrypted table
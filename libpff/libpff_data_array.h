@@ -40,6 +40,21 @@ enum LIBPFF_DATA_ARRAY_FLAGS
 	LIBPFF_DATA_ARRAY_FLAG_DECRYPTION_FORCED	= 0x02,
 };
 
+typedef struct libpff_data_array_identifier libpff_data_array_identifier_t;
+
+/* An array entry identifier used to resolve the entries in identifier order
+ */
+struct libpff_data_array_identifier
+{
+	/* The (data) identifier
+	 */
+	uint64_t identifier;
+
+	/* The index of the entry in the array
+	 */
+	uint16_t entry_index;
+};
+
 typedef struct libpff_data_array libpff_data_array_t;
 
 struct libpff_data_array
@@ -106,6 +121,10 @@ int libpff_data_array_read_entries(
      uint32_t *total_data_size,
      libcerror_error_t **error );
 
+int libpff_data_array_identifier_compare(
+     const void *first_identifier,
+     const void *second_identifier );
+
 ssize_t libpff_data_array_read_entry_data(
          intptr_t *io_handle,
          libbfio_handle_t *file_io_handle,
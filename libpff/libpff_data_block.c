@@ -283,6 +283,7 @@ ssize_t libpff_data_block_read_data(
 	              data,
 	              data_size,
 	              &( data_block->flags ),
+	              &( data_block->io_handle->statistics ),
 	              error );
 
 	if( read_count != (ssize_t) data_size )
@@ -326,9 +327,11 @@ ssize_t libpff_data_block_read(
          uint8_t *data,
          size_t data_size,
          uint8_t *flags,
+         libpff_io_statistics_t *io_statistics,
          libcerror_error_t **error )
 {
-	uint8_t *data_block_data         = NULL;
+	uint8_t data_block_data[ 128 ];
+
 	uint8_t *data_block_footer       = NULL;
 	static char *function            = "libpff_data_block_read";
 	size_t data_block_size           = 0;
@@ -413,6 +416,11 @@ ssize_t libpff_data_block_read(
 
 			return( -1 );
 		}
+		if( io_statistics != NULL )
+		{
+			io_statistics->number_of_bytes_read      += (uint64_t) read_count;
+			io_statistics->number_of_read_operations += 1;
+		}
 	}
 	if( ( *flags & LIBPFF_DATA_BLOCK_FLAG_VALIDATED ) == 0 )
 	{
@@ -432,16 +440,16 @@ ssize_t libpff_data_block_read(
 			}
 			data_block_padding_size = data_block_size - data_size;
 
-			data_block_data = (uint8_t *) memory_allocate(
-						       sizeof( uint8_t ) * data_block_padding_size );
-
-			if( data_block_data == NULL )
+			/* The padding and footer are at most 64 + footer size bytes
+			 * and are read into a buffer on the stack
+			 */
+			if( data_block_padding_size > 128 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create remaining data block data.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: data block padding size value out of bounds.",
 				 function );
 
 				return( -1 );
@@ -461,11 +469,13 @@ ssize_t libpff_data_block_read(
 				 "%s: unable to read remaining data block data.",
 				 function );
 
-				memory_free(
-				 data_block_data );
-
 				return( -1 );
 			}
+			if( io_statistics != NULL )
+			{
+				io_statistics->number_of_bytes_read      += (uint64_t) read_count;
+				io_statistics->number_of_read_operations += 1;
+			}
 			data_block_padding_size -= data_block_footer_size;
 
 			data_block_footer = &( data_block_data[ data_block_padding_size ] );
@@ -568,9 +578,6 @@ ssize_t libpff_data_block_read(
 				 "\n" );
 			}
 #endif
-			memory_free(
-			 data_block_data );
-
 			if( data_block_data_size != 0 )
 			{
 				if( data_size != (size_t) data_block_data_size )
@@ -608,6 +615,10 @@ ssize_t libpff_data_block_read(
 
 					return( -1 );
 				}
+				if( io_statistics != NULL )
+				{
+					io_statistics->number_of_bytes_crc_checked += (uint64_t) data_size;
+				}
 				if( stored_crc != calculated_crc )
 				{
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -812,6 +823,12 @@ int libpff_data_block_decrypt_data(
 
 			return( -1 );
 		}
+		/* Data without encryption is passed through unchanged
+		 */
+		if( encryption_type != LIBPFF_ENCRYPTION_TYPE_NONE )
+		{
+			data_block->io_handle->statistics.number_of_bytes_decrypted += (uint64_t) data_size;
+		}
 		if( force_decryption != 0 )
 		{
 			/* Test if the data contains an unencrypted table
@@ -96,6 +96,7 @@ ssize_t libpff_data_block_read(
          uint8_t *data,
          size_t data_size,
          uint8_t *flags,
+         libpff_io_statistics_t *io_statistics,
          libcerror_error_t **error );
 
 int libpff_data_block_decrypt_data(
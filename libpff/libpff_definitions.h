@@ -77,6 +77,55 @@ enum LIBPFF_RECOVERY_FLAGS
 	LIBPFF_RECOVERY_FLAG_SCAN_FOR_FRAGMENTS				= 0x02
 };
 
+/* The recovery stages
+ */
+enum LIBPFF_RECOVERY_STAGES
+{
+	LIBPFF_RECOVERY_STAGE_NONE					= 0,
+	LIBPFF_RECOVERY_STAGE_INDEX_TREES				= 1,
+	LIBPFF_RECOVERY_STAGE_UNALLOCATED_SPACE				= 2,
+	LIBPFF_RECOVERY_STAGE_ITEMS					= 3,
+	LIBPFF_RECOVERY_STAGE_COMPLETED					= 4
+};
+
+/* The recovery counters
+ */
+enum LIBPFF_RECOVERY_COUNTERS
+{
+	LIBPFF_RECOVERY_COUNTER_INDEX_NODES				= 0,
+	LIBPFF_RECOVERY_COUNTER_DATA_BLOCKS				= 1,
+	LIBPFF_RECOVERY_COUNTER_LOCAL_DESCRIPTORS			= 2,
+	LIBPFF_RECOVERY_COUNTER_ITEMS					= 3
+};
+
+/* The statistics
+ */
+enum LIBPFF_STATISTICS
+{
+	LIBPFF_STATISTIC_NUMBER_OF_BYTES_READ				= 0,
+	LIBPFF_STATISTIC_NUMBER_OF_READ_OPERATIONS			= 1,
+	LIBPFF_STATISTIC_NUMBER_OF_BYTES_DECRYPTED			= 2,
+	LIBPFF_STATISTIC_NUMBER_OF_BYTES_CRC_CHECKED			= 3,
+	LIBPFF_STATISTIC_NUMBER_OF_BYTES_DECOMPRESSED			= 4,
+	LIBPFF_STATISTIC_NUMBER_OF_TABLES_READ				= 5,
+	LIBPFF_STATISTIC_NUMBER_OF_BUFFER_POOL_HITS			= 6,
+	LIBPFF_STATISTIC_NUMBER_OF_BUFFER_POOL_ALLOCATIONS		= 7,
+	LIBPFF_STATISTIC_BUFFER_POOL_PEAK_USED_SIZE			= 8
+};
+
+/* The caches for which statistics are maintained
+ */
+enum LIBPFF_CACHES
+{
+	LIBPFF_CACHE_INDEX_NODES					= 0,
+	LIBPFF_CACHE_DESCRIPTOR_INDEX_VALUES				= 1,
+	LIBPFF_CACHE_OFFSET_INDEX_VALUES				= 2,
+	LIBPFF_CACHE_DATA_BLOCKS					= 3,
+	LIBPFF_CACHE_LOCAL_DESCRIPTORS					= 4,
+	LIBPFF_CACHE_ITEM_VALUES					= 5,
+	LIBPFF_CACHE_LOCAL_DESCRIPTOR_NODES				= 6
+};
+
 /* The file types
  */
 enum LIBPFF_FILE_TYPES
@@ -314,11 +363,39 @@ enum LIBPFF_ITEM_FLAGS
 #define LIBPFF_MAXIMUM_CACHE_ENTRIES_INDEX_NODES			16384
 #define LIBPFF_MAXIMUM_CACHE_ENTRIES_DESCRIPTOR_INDEX_VALUES		8192 - 3
 #define LIBPFF_MAXIMUM_CACHE_ENTRIES_OFFSET_INDEX_VALUES		32768 - 3
-#define LIBPFF_MAXIMUM_CACHE_ENTRIES_LOCAL_DESCRIPTORS_NODES		256
+#define LIBPFF_MAXIMUM_CACHE_ENTRIES_LOCAL_DESCRIPTORS_NODES		1024
 #define LIBPFF_MAXIMUM_CACHE_ENTRIES_LOCAL_DESCRIPTORS_VALUES		128 - 3
 #define LIBPFF_MAXIMUM_CACHE_ENTRIES_DATA_ARRAY				8
 #define LIBPFF_MAXIMUM_CACHE_ENTRIES_DATA_BLOCK				1
-#define LIBPFF_MAXIMUM_CACHE_ENTRIES_ITEM				8
+#define LIBPFF_MAXIMUM_CACHE_ENTRIES_ITEM				64
+
+/* The buffer pool definitions
+ * The size classes are 512, 1024, 2048, 4096 and 8192 bytes
+ */
+#define LIBPFF_BUFFER_POOL_MINIMUM_BUFFER_SIZE				512
+#define LIBPFF_BUFFER_POOL_NUMBER_OF_SIZE_CLASSES			5
+#define LIBPFF_BUFFER_POOL_MAXIMUM_NUMBER_OF_FREE_BUFFERS		64
+
+/* The arena definitions
+ */
+#define LIBPFF_ARENA_ALIGNMENT						8
+#define LIBPFF_TABLE_ARENA_BLOCK_SIZE					8192
+
+/* The recovery progress definitions
+ * The report interval is in seconds
+ */
+#define LIBPFF_RECOVERY_PROGRESS_NUMBER_OF_COUNTERS			4
+#define LIBPFF_RECOVERY_PROGRESS_REPORT_INTERVAL			1
+
+/* The recovery checkpoint definitions
+ * The checkpoint interval is in seconds
+ */
+#define LIBPFF_RECOVERY_CHECKPOINT_INTERVAL				60
+#define LIBPFF_RECOVERY_CHECKPOINT_NUMBER_OF_BUFFERED_RECORDS		64
+
+/* The statistics definitions
+ */
+#define LIBPFF_STATISTICS_NUMBER_OF_CACHES				7
 
 
 /* LibPFF performance patch: limits number of records per table up to 64KB. 
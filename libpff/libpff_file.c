@@ -40,6 +40,8 @@
 #include "libpff_list_type.h"
 #include "libpff_name_to_id_map.h"
 #include "libpff_offset_list.h"
+#include "libpff_recovery_checkpoint.h"
+#include "libpff_recovery_progress.h"
 #include "libpff_tree_type.h"
 #include "libpff_types.h"
 
@@ -671,6 +673,19 @@ int libpff_file_close(
 	internal_file->file_io_handle                    = NULL;
 	internal_file->file_io_handle_created_in_library = 0;
 
+	if( libpff_io_handle_clear_caches(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear IO handle caches.",
+		 function );
+
+		result = -1;
+	}
 	if( internal_file->item_tree_root_node != NULL )
 	{
 		if( libpff_tree_node_free(
@@ -1161,6 +1176,737 @@ int libpff_file_recover_items(
 	return( result );
 }
 
+/* Sets the recovery progress callback function
+ * The callback function is called by libpff_file_recover_items when the recovery stage changes
+ * and at most once per second otherwise. The callback function should return 1 to continue
+ * the recovery or 0 to cancel it. A NULL callback function removes the callback
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_file_set_recovery_progress_callback(
+     libpff_file_t *file,
+     int (*callback_function)(
+            libpff_file_t *file,
+            intptr_t *callback_data ),
+     intptr_t *callback_data,
+     libcerror_error_t **error )
+{
+	libpff_internal_file_t *internal_file = NULL;
+	static char *function                 = "libpff_file_set_recovery_progress_callback";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libpff_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->recovery_progress == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - invalid IO handle - missing recovery progress.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->io_handle->recovery_progress->file              = file;
+	internal_file->io_handle->recovery_progress->callback_function = callback_function;
+	internal_file->io_handle->recovery_progress->callback_data     = callback_data;
+
+	return( 1 );
+}
+
+/* Sets the recovery checkpoint file
+ * The recovered index values and the scan offset are stored in the checkpoint file
+ * at most once per minute and when the recovery is cancelled, so that
+ * a subsequent libpff_file_recover_items using the same file continues where it stopped
+ * The checkpoint file is created if it does not exist
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_file_set_recovery_checkpoint_file(
+     libpff_file_t *file,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle      = NULL;
+	libpff_internal_file_t *internal_file = NULL;
+	static char *function                 = "libpff_file_set_recovery_checkpoint_file";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libpff_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create checkpoint file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     libcstring_narrow_string_length(
+	      filename ) + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in checkpoint file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     file_io_handle,
+	     LIBBFIO_OPEN_READ_WRITE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open checkpoint file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( internal_file->io_handle->recovery_checkpoint != NULL )
+	{
+		if( libpff_recovery_checkpoint_free(
+		     &( internal_file->io_handle->recovery_checkpoint ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free recovery checkpoint.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libpff_recovery_checkpoint_initialize(
+	     &( internal_file->io_handle->recovery_checkpoint ),
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create recovery checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Sets the recovery checkpoint file
+ * The recovered index values and the scan offset are stored in the checkpoint file
+ * at most once per minute and when the recovery is cancelled, so that
+ * a subsequent libpff_file_recover_items using the same file continues where it stopped
+ * The checkpoint file is created if it does not exist
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_file_set_recovery_checkpoint_file_wide(
+     libpff_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle      = NULL;
+	libpff_internal_file_t *internal_file = NULL;
+	static char *function                 = "libpff_file_set_recovery_checkpoint_file_wide";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libpff_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create checkpoint file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     libcstring_wide_string_length(
+	      filename ) + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in checkpoint file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     file_io_handle,
+	     LIBBFIO_OPEN_READ_WRITE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open checkpoint file: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( internal_file->io_handle->recovery_checkpoint != NULL )
+	{
+		if( libpff_recovery_checkpoint_free(
+		     &( internal_file->io_handle->recovery_checkpoint ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free recovery checkpoint.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libpff_recovery_checkpoint_initialize(
+	     &( internal_file->io_handle->recovery_checkpoint ),
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create recovery checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif
+
+/* Retrieves the recovery progress
+ * The offset and number of bytes refer to the scan of the unallocated space
+ * This function is intended to be called from the recovery progress callback function
+ * or after the recovery
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_file_get_recovery_progress(
+     libpff_file_t *file,
+     uint8_t *stage,
+     off64_t *current_offset,
+     size64_t *bytes_scanned,
+     size64_t *bytes_to_scan,
+     uint64_t *bytes_per_second,
+     libcerror_error_t **error )
+{
+	libpff_internal_file_t *internal_file         = NULL;
+	libpff_recovery_progress_t *recovery_progress = NULL;
+	static char *function                         = "libpff_file_get_recovery_progress";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libpff_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	recovery_progress = internal_file->io_handle->recovery_progress;
+
+	if( recovery_progress == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - invalid IO handle - missing recovery progress.",
+		 function );
+
+		return( -1 );
+	}
+	if( stage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stage.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( bytes_scanned == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bytes scanned.",
+		 function );
+
+		return( -1 );
+	}
+	if( bytes_to_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bytes to scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_recovery_progress_get_bytes_per_second(
+	     recovery_progress,
+	     bytes_per_second,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve bytes per second.",
+		 function );
+
+		return( -1 );
+	}
+	*stage          = recovery_progress->stage;
+	*current_offset = recovery_progress->current_offset;
+	*bytes_scanned  = recovery_progress->bytes_scanned;
+	*bytes_to_scan  = recovery_progress->bytes_to_scan;
+
+	if( *bytes_scanned > *bytes_to_scan )
+	{
+		*bytes_scanned = *bytes_to_scan;
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific recovery counter
+ * The number of candidates contains the number of candidates found
+ * the number of validated contains the number of candidates that passed validation
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_file_get_recovery_counter(
+     libpff_file_t *file,
+     int counter,
+     uint64_t *number_of_candidates,
+     uint64_t *number_of_validated,
+     libcerror_error_t **error )
+{
+	libpff_internal_file_t *internal_file = NULL;
+	static char *function                 = "libpff_file_get_recovery_counter";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libpff_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->recovery_progress == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - invalid IO handle - missing recovery progress.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( counter < 0 )
+	 || ( counter >= LIBPFF_RECOVERY_PROGRESS_NUMBER_OF_COUNTERS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid counter value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_candidates == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of candidates.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_validated == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of validated.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_candidates = internal_file->io_handle->recovery_progress->number_of_candidates[ counter ];
+	*number_of_validated  = internal_file->io_handle->recovery_progress->number_of_validated[ counter ];
+
+	return( 1 );
+}
+
+/* Retrieves a specific statistic
+ * The statistics are maintained since the file was opened or the statistics were reset
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_file_get_statistics(
+     libpff_file_t *file,
+     int statistic,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	libpff_internal_file_t *internal_file = NULL;
+	static char *function                 = "libpff_file_get_statistics";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libpff_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_io_statistics_get_value(
+	     &( internal_file->io_handle->statistics ),
+	     statistic,
+	     value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistic: %d.",
+		 function,
+		 statistic );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the statistics of a specific cache
+ * An eviction is counted when a cached value is replaced by another value
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_file_get_cache_statistics(
+     libpff_file_t *file,
+     int cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
+     libcerror_error_t **error )
+{
+	libpff_internal_file_t *internal_file = NULL;
+	static char *function                 = "libpff_file_get_cache_statistics";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libpff_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_io_statistics_get_cache_values(
+	     &( internal_file->io_handle->statistics ),
+	     cache,
+	     number_of_hits,
+	     number_of_misses,
+	     number_of_evictions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics of cache: %d.",
+		 function,
+		 cache );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Resets the statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_file_reset_statistics(
+     libpff_file_t *file,
+     libcerror_error_t **error )
+{
+	libpff_internal_file_t *internal_file = NULL;
+	static char *function                 = "libpff_file_reset_statistics";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libpff_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_io_statistics_clear(
+	     &( internal_file->io_handle->statistics ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset statistics.",
+		 function );
+
+		return( -1 );
+	}
+	/* The peak used size restarts at the size of the buffer pool buffers still in use
+	 */
+	if( internal_file->io_handle->buffer_pool != NULL )
+	{
+		internal_file->io_handle->statistics.buffer_pool_peak_used_size = internal_file->io_handle->buffer_pool->used_size;
+	}
+	return( 1 );
+}
+
 /* Retrieves the file size
  * Returns 1 if successful or -1 on error
  */
@@ -149,6 +149,68 @@ int libpff_file_recover_items(
      uint8_t recovery_flags,
      libcerror_error_t **error );
 
+LIBPFF_EXTERN \
+int libpff_file_set_recovery_progress_callback(
+     libpff_file_t *file,
+     int (*callback_function)(
+            libpff_file_t *file,
+            intptr_t *callback_data ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+int libpff_file_set_recovery_checkpoint_file(
+     libpff_file_t *file,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+LIBPFF_EXTERN \
+int libpff_file_set_recovery_checkpoint_file_wide(
+     libpff_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+#endif
+
+LIBPFF_EXTERN \
+int libpff_file_get_recovery_progress(
+     libpff_file_t *file,
+     uint8_t *stage,
+     off64_t *current_offset,
+     size64_t *bytes_scanned,
+     size64_t *bytes_to_scan,
+     uint64_t *bytes_per_second,
+     libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+int libpff_file_get_recovery_counter(
+     libpff_file_t *file,
+     int counter,
+     uint64_t *number_of_candidates,
+     uint64_t *number_of_validated,
+     libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+int libpff_file_get_statistics(
+     libpff_file_t *file,
+     int statistic,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+int libpff_file_get_cache_statistics(
+     libpff_file_t *file,
+     int cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
+     libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+int libpff_file_reset_statistics(
+     libpff_file_t *file,
+     libcerror_error_t **error );
+
 LIBPFF_EXTERN \
 int libpff_file_get_size(
      libpff_file_t *file,
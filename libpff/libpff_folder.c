@@ -510,6 +510,151 @@ int libpff_folder_determine_sub_messages(
 	return( 1 );
 }
 
+/* Determines the item type of a sub message from the message class in the folder contents table
+ * Returns 1 if successful, 0 if the folder contents table does not contain the message class or -1 on error
+ */
+int libpff_folder_determine_sub_message_type(
+     libpff_internal_item_t *internal_item,
+     int sub_message_index,
+     uint8_t *sub_message_type,
+     libcerror_error_t **error )
+{
+	libfcache_cache_t *value_data_cache        = NULL;
+	libfdata_reference_t *value_data_reference = NULL;
+	uint8_t *value_data                        = NULL;
+	static char *function                      = "libpff_folder_determine_sub_message_type";
+	size_t value_data_size                     = 0;
+	uint32_t value_type                        = 0;
+	uint8_t is_ascii_string                    = 0;
+	int result                                 = 0;
+
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal item.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal item - missing internal file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal item - invalid internal file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_message_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub message type.",
+		 function );
+
+		return( -1 );
+	}
+	*sub_message_type = LIBPFF_ITEM_TYPE_UNDEFINED;
+
+	if( internal_item->sub_item_values[ LIBPFF_FOLDER_SUB_ITEM_SUB_MESSAGES ] == NULL )
+	{
+		return( 0 );
+	}
+	/* The rows of the folder contents table contain the message class of the sub messages
+	 */
+	result = libpff_item_values_get_entry_value(
+	          internal_item->sub_item_values[ LIBPFF_FOLDER_SUB_ITEM_SUB_MESSAGES ],
+	          internal_item->internal_file->name_to_id_map_list,
+	          internal_item->internal_file->io_handle,
+	          internal_item->file_io_handle,
+	          sub_message_index,
+	          LIBPFF_ENTRY_TYPE_MESSAGE_CLASS,
+	          &value_type,
+	          &value_data_reference,
+	          &value_data_cache,
+	          LIBPFF_ENTRY_VALUE_FLAG_MATCH_ANY_VALUE_TYPE,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve message class of sub message: %d.",
+		 function,
+		 sub_message_index );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( ( value_type != LIBPFF_VALUE_TYPE_STRING_ASCII )
+	 && ( value_type != LIBPFF_VALUE_TYPE_STRING_UNICODE ) )
+	{
+		return( 0 );
+	}
+	if( value_type == LIBPFF_VALUE_TYPE_STRING_ASCII )
+	{
+		is_ascii_string = 1;
+	}
+	if( libfdata_reference_get_data(
+	     value_data_reference,
+	     internal_item->file_io_handle,
+	     value_data_cache,
+	     &value_data,
+	     &value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value data reference data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_item_get_type_from_message_class(
+	     value_data,
+	     value_data_size,
+	     is_ascii_string,
+	     internal_item->internal_file->io_handle->ascii_codepage,
+	     sub_message_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine item type from message class.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Determine if the item has sub associated contents
  * Returns 1 if successful or -1 on error
  */
@@ -2535,11 +2680,475 @@ int libpff_folder_get_sub_message(
 
 			return( -1 );
 		}
-		( (libpff_internal_item_t *) *sub_message )->type = LIBPFF_ITEM_TYPE_UNDEFINED;
+		/* Use the message class in the folder contents table to determine the sub message type
+		 * so that the sub message item values do not need to be read to determine its type
+		 */
+		if( libpff_folder_determine_sub_message_type(
+		     internal_item,
+		     sub_message_index,
+		     &( ( (libpff_internal_item_t *) *sub_message )->type ),
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine sub message: %d type.",
+			 function,
+			 sub_message_index );
+
+			libpff_item_free(
+			 sub_message,
+			 NULL );
+
+			return( -1 );
+		}
 	}
 	return( 1 );
 }
 
+/* Retrieves the item type of the sub message for the specific index from a folder
+ * The item type is determined from the folder contents table without reading the sub message,
+ * which allows to filter the sub messages by item type before retrieving them
+ * Returns 1 if successful, 0 if the folder contents table does not contain the message class or -1 on error
+ */
+int libpff_folder_get_sub_message_type(
+     libpff_item_t *folder,
+     int sub_message_index,
+     uint8_t *sub_message_type,
+     libcerror_error_t **error )
+{
+	libpff_internal_item_t *internal_item = NULL;
+	static char *function                 = "libpff_folder_get_sub_message_type";
+	int result                            = 0;
+
+	if( folder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid folder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libpff_internal_item_t *) folder;
+
+	if( internal_item->type == LIBPFF_ITEM_TYPE_UNDEFINED )
+	{
+		if( libpff_item_determine_type(
+		     internal_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine item type.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_item->type != LIBPFF_ITEM_TYPE_FOLDER )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type: 0x%08" PRIx32 "",
+		 function,
+		 internal_item->type );
+
+		return( -1 );
+	}
+	if( internal_item->sub_item_values[ LIBPFF_FOLDER_SUB_ITEM_SUB_MESSAGES ] == NULL )
+	{
+		if( libpff_folder_determine_sub_messages(
+		     internal_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine sub messages.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	result = libpff_folder_determine_sub_message_type(
+	          internal_item,
+	          sub_message_index,
+	          sub_message_type,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine sub message: %d type.",
+		 function,
+		 sub_message_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the value data of a specific entry of the sub message for the specific index from a folder
+ * The value data is retrieved from the folder contents table without reading the sub message
+ * Returns 1 if successful, 0 if the folder contents table does not contain the entry or -1 on error
+ */
+int libpff_folder_get_sub_message_entry_value_data(
+     libpff_item_t *folder,
+     int sub_message_index,
+     uint32_t entry_type,
+     uint32_t value_type,
+     uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error )
+{
+	libfcache_cache_t *value_data_cache        = NULL;
+	libfdata_reference_t *value_data_reference = NULL;
+	libpff_internal_item_t *internal_item      = NULL;
+	static char *function                      = "libpff_folder_get_sub_message_entry_value_data";
+	int result                                 = 0;
+
+	if( folder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid folder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libpff_internal_item_t *) folder;
+
+	if( internal_item->internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid folder - missing internal file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->type == LIBPFF_ITEM_TYPE_UNDEFINED )
+	{
+		if( libpff_item_determine_type(
+		     internal_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine item type.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_item->type != LIBPFF_ITEM_TYPE_FOLDER )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type: 0x%08" PRIx32 "",
+		 function,
+		 internal_item->type );
+
+		return( -1 );
+	}
+	if( internal_item->sub_item_values[ LIBPFF_FOLDER_SUB_ITEM_SUB_MESSAGES ] == NULL )
+	{
+		if( libpff_folder_determine_sub_messages(
+		     internal_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine sub messages.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_item->sub_item_values[ LIBPFF_FOLDER_SUB_ITEM_SUB_MESSAGES ] == NULL )
+	{
+		return( 0 );
+	}
+	/* The rows of the folder contents table contain a subset of the entries of the sub messages
+	 */
+	result = libpff_item_values_get_entry_value(
+	          internal_item->sub_item_values[ LIBPFF_FOLDER_SUB_ITEM_SUB_MESSAGES ],
+	          internal_item->internal_file->name_to_id_map_list,
+	          internal_item->internal_file->io_handle,
+	          internal_item->file_io_handle,
+	          sub_message_index,
+	          entry_type,
+	          &value_type,
+	          &value_data_reference,
+	          &value_data_cache,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: 0x%04" PRIx32 " of sub message: %d.",
+		 function,
+		 entry_type,
+		 sub_message_index );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfdata_reference_get_data(
+	     value_data_reference,
+	     internal_item->file_io_handle,
+	     value_data_cache,
+	     value_data,
+	     value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value data reference data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the boolean value of a specific entry of the sub message for the specific index from a folder
+ * The value is retrieved from the folder contents table without reading the sub message
+ * Returns 1 if successful, 0 if the folder contents table does not contain the entry or -1 on error
+ */
+int libpff_folder_get_sub_message_entry_value_boolean(
+     libpff_item_t *folder,
+     int sub_message_index,
+     uint32_t entry_type,
+     uint8_t *entry_value,
+     libcerror_error_t **error )
+{
+	uint8_t *value_data    = NULL;
+	static char *function  = "libpff_folder_get_sub_message_entry_value_boolean";
+	size_t value_data_size = 0;
+	int result             = 0;
+
+	result = libpff_folder_get_sub_message_entry_value_data(
+	          folder,
+	          sub_message_index,
+	          entry_type,
+	          LIBPFF_VALUE_TYPE_BOOLEAN,
+	          &value_data,
+	          &value_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry value data.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libpff_value_type_copy_to_boolean(
+		     value_data,
+		     value_data_size,
+		     entry_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_GENERIC,
+			 "%s: unable to set boolean entry value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the 32-bit value of a specific entry of the sub message for the specific index from a folder
+ * The value is retrieved from the folder contents table without reading the sub message
+ * Returns 1 if successful, 0 if the folder contents table does not contain the entry or -1 on error
+ */
+int libpff_folder_get_sub_message_entry_value_32bit(
+     libpff_item_t *folder,
+     int sub_message_index,
+     uint32_t entry_type,
+     uint32_t *entry_value,
+     libcerror_error_t **error )
+{
+	uint8_t *value_data    = NULL;
+	static char *function  = "libpff_folder_get_sub_message_entry_value_32bit";
+	size_t value_data_size = 0;
+	int result             = 0;
+
+	result = libpff_folder_get_sub_message_entry_value_data(
+	          folder,
+	          sub_message_index,
+	          entry_type,
+	          LIBPFF_VALUE_TYPE_INTEGER_32BIT_SIGNED,
+	          &value_data,
+	          &value_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry value data.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libpff_value_type_copy_to_32bit(
+		     value_data,
+		     value_data_size,
+		     entry_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_GENERIC,
+			 "%s: unable to set 32-bit entry value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the filetime value of a specific entry of the sub message for the specific index from a folder
+ * The value is retrieved from the folder contents table without reading the sub message
+ * Returns 1 if successful, 0 if the folder contents table does not contain the entry or -1 on error
+ */
+int libpff_folder_get_sub_message_entry_value_filetime(
+     libpff_item_t *folder,
+     int sub_message_index,
+     uint32_t entry_type,
+     uint64_t *filetime,
+     libcerror_error_t **error )
+{
+	uint8_t *value_data    = NULL;
+	static char *function  = "libpff_folder_get_sub_message_entry_value_filetime";
+	size_t value_data_size = 0;
+	int result             = 0;
+
+	result = libpff_folder_get_sub_message_entry_value_data(
+	          folder,
+	          sub_message_index,
+	          entry_type,
+	          LIBPFF_VALUE_TYPE_FILETIME,
+	          &value_data,
+	          &value_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry value data.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libpff_value_type_copy_to_64bit(
+		     value_data,
+		     value_data_size,
+		     filetime,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_GENERIC,
+			 "%s: unable to set filetime entry value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the modification time of the sub message for the specific index from a folder
+ * The modification time is retrieved from the folder contents table without reading the sub message
+ * Returns 1 if successful, 0 if the folder contents table does not contain the modification time or -1 on error
+ */
+int libpff_folder_get_sub_message_modification_time(
+     libpff_item_t *folder,
+     int sub_message_index,
+     uint64_t *modification_time,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_folder_get_sub_message_modification_time";
+	int result            = 0;
+
+	result = libpff_folder_get_sub_message_entry_value_filetime(
+	          folder,
+	          sub_message_index,
+	          LIBPFF_ENTRY_TYPE_MESSAGE_MODIFICATION_TIME,
+	          modification_time,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve modification time of sub message: %d.",
+		 function,
+		 sub_message_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves the sub message from a folder for the specific UTF-8 encoded name
  * This function uses the PidTagDisplayName MAPI property as the name
  * Returns 1 if successful, 0 if no such sub message or -1 on error
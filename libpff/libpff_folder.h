@@ -48,6 +48,12 @@ int libpff_folder_determine_sub_messages(
      libpff_internal_item_t *internal_item,
      libcerror_error_t **error );
 
+int libpff_folder_determine_sub_message_type(
+     libpff_internal_item_t *internal_item,
+     int sub_message_index,
+     uint8_t *sub_message_type,
+     libcerror_error_t **error );
+
 int libpff_folder_determine_sub_associated_contents(
      libpff_internal_item_t *internal_item,
      libcerror_error_t **error );
@@ -104,6 +110,53 @@ int libpff_folder_get_sub_message(
      libpff_item_t **sub_message,
      libcerror_error_t **error );
 
+LIBPFF_EXTERN \
+int libpff_folder_get_sub_message_type(
+     libpff_item_t *folder,
+     int sub_message_index,
+     uint8_t *sub_message_type,
+     libcerror_error_t **error );
+
+int libpff_folder_get_sub_message_entry_value_data(
+     libpff_item_t *folder,
+     int sub_message_index,
+     uint32_t entry_type,
+     uint32_t value_type,
+     uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+int libpff_folder_get_sub_message_entry_value_boolean(
+     libpff_item_t *folder,
+     int sub_message_index,
+     uint32_t entry_type,
+     uint8_t *entry_value,
+     libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+int libpff_folder_get_sub_message_entry_value_32bit(
+     libpff_item_t *folder,
+     int sub_message_index,
+     uint32_t entry_type,
+     uint32_t *entry_value,
+     libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+int libpff_folder_get_sub_message_entry_value_filetime(
+     libpff_item_t *folder,
+     int sub_message_index,
+     uint32_t entry_type,
+     uint64_t *filetime,
+     libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+int libpff_folder_get_sub_message_modification_time(
+     libpff_item_t *folder,
+     int sub_message_index,
+     uint64_t *modification_time,
+     libcerror_error_t **error );
+
 LIBPFF_EXTERN \
 int libpff_folder_get_sub_message_by_utf8_name(
      libpff_item_t *folder,
@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libpff_buffer_pool.h"
 #include "libpff_definitions.h"
 #include "libpff_index_node.h"
 #include "libpff_libbfio.h"
@@ -113,6 +114,7 @@ int libpff_index_node_free(
      libcerror_error_t **error )
 {
 	static char *function = "libpff_index_node_free";
+	int result            = 1;
 
 	if( index_node == NULL )
 	{
@@ -129,15 +131,36 @@ int libpff_index_node_free(
 	{
 		if( ( *index_node )->data != NULL )
 		{
-			memory_free(
-			 ( *index_node )->data );
+			if( ( *index_node )->buffer_pool != NULL )
+			{
+				if( libpff_buffer_pool_release_buffer(
+				     ( *index_node )->buffer_pool,
+				     &( ( *index_node )->data ),
+				     ( *index_node )->data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to release index node data.",
+					 function );
+
+					result = -1;
+				}
+			}
+			else
+			{
+				memory_free(
+				 ( *index_node )->data );
+			}
 		}
 		memory_free(
 		 *index_node );
 
 		*index_node = NULL;
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Retrieves the data of a specific entry
@@ -222,6 +245,8 @@ int libpff_index_node_read(
      libbfio_handle_t *file_io_handle,
      off64_t node_offset,
      uint8_t file_type,
+     libpff_buffer_pool_t *buffer_pool,
+     libpff_io_statistics_t *io_statistics,
      libcerror_error_t **error )
 {
 	uint8_t *index_node_data                     = NULL;
@@ -286,19 +311,41 @@ int libpff_index_node_read(
 		index_node->data_size                 = sizeof( pff_index_node_64bit_t );
 		index_node->maximum_entries_data_size = 488;
 	}
-	index_node->data = (uint8_t *) memory_allocate(
-	                                sizeof( uint8_t ) * index_node->data_size );
-
-	if( index_node->data == NULL )
+	if( buffer_pool != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create index node data.",
-		 function );
+		if( libpff_buffer_pool_get_buffer(
+		     buffer_pool,
+		     index_node->data_size,
+		     &( index_node->data ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve index node data from buffer pool.",
+			 function );
+
+			return( -1 );
+		}
+		index_node->buffer_pool = buffer_pool;
+	}
+	else
+	{
+		index_node->data = (uint8_t *) memory_allocate(
+		                                sizeof( uint8_t ) * index_node->data_size );
 
-		return( -1 );
+		if( index_node->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create index node data.",
+			 function );
+
+			return( -1 );
+		}
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -343,6 +390,11 @@ int libpff_index_node_read(
 
 		return( -1 );
 	}
+	if( io_statistics != NULL )
+	{
+		io_statistics->number_of_bytes_read      += (uint64_t) read_count;
+		io_statistics->number_of_read_operations += 1;
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -557,6 +609,17 @@ int libpff_index_node_read(
 
 		return( -1 );
 	}
+	if( io_statistics != NULL )
+	{
+		if( file_type == LIBPFF_FILE_TYPE_32BIT )
+		{
+			io_statistics->number_of_bytes_crc_checked += 500;
+		}
+		else
+		{
+			io_statistics->number_of_bytes_crc_checked += 496;
+		}
+	}
 	if( stored_crc != calculated_crc )
 	{
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -873,3 +936,82 @@ int libpff_index_node_read(
 	return( 1 );
 }
 
+/* Determines if the data could contain an index node
+ * Only checks the index node type and type copy, which are also checked by libpff_index_node_read,
+ * to cheaply reject data before the index node is read
+ * Returns 1 if the data could contain an index node, 0 if not or -1 on error
+ */
+int libpff_index_node_check_type(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t file_type,
+     libcerror_error_t **error )
+{
+	static char *function        = "libpff_index_node_check_type";
+	uint8_t index_node_type      = 0;
+	uint8_t index_node_type_copy = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_type == LIBPFF_FILE_TYPE_32BIT )
+	{
+		if( data_size < sizeof( pff_index_node_32bit_t ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		index_node_type      = ( (pff_index_node_32bit_t *) data )->type;
+		index_node_type_copy = ( (pff_index_node_32bit_t *) data )->type_copy;
+	}
+	else if( file_type == LIBPFF_FILE_TYPE_64BIT )
+	{
+		if( data_size < sizeof( pff_index_node_64bit_t ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		index_node_type      = ( (pff_index_node_64bit_t *) data )->type;
+		index_node_type_copy = ( (pff_index_node_64bit_t *) data )->type_copy;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( index_node_type == LIBPFF_INDEX_TYPE_DESCRIPTOR )
+	 || ( index_node_type == LIBPFF_INDEX_TYPE_OFFSET )
+	 || ( index_node_type_copy == LIBPFF_INDEX_TYPE_DESCRIPTOR )
+	 || ( index_node_type_copy == LIBPFF_INDEX_TYPE_OFFSET ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
@@ -25,6 +25,8 @@
 #include <common.h>
 #include <types.h>
 
+#include "libpff_buffer_pool.h"
+#include "libpff_io_statistics.h"
 #include "libpff_libbfio.h"
 #include "libpff_libcerror.h"
 
@@ -75,6 +77,10 @@ struct libpff_index_node
 	/* The back pointer
 	 */
 	uint64_t back_pointer;
+
+	/* The buffer pool the node data was retrieved from
+	 */
+	libpff_buffer_pool_t *buffer_pool;
 };
 
 int libpff_index_node_initialize(
@@ -96,6 +102,14 @@ int libpff_index_node_read(
      libbfio_handle_t *file_io_handle,
      off64_t node_offset,
      uint8_t file_type,
+     libpff_buffer_pool_t *buffer_pool,
+     libpff_io_statistics_t *io_statistics,
+     libcerror_error_t **error );
+
+int libpff_index_node_check_type(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t file_type,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
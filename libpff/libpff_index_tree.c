@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <memory.h>
 #include <types.h>
 
 #include "libpff_definitions.h"
@@ -30,6 +31,15 @@
 #include "libpff_libcnotify.h"
 #include "libpff_libfcache.h"
 #include "libpff_libfdata.h"
+#include "libpff_recovered_index_values.h"
+
+/* The maximum number of sub nodes of a bulk inserted branch node
+ */
+#define LIBPFF_INDEX_TREE_MAXIMUM_NUMBER_OF_SUB_NODES	512
+
+/* The preferred number of sub nodes of a bulk inserted branch node
+ */
+#define LIBPFF_INDEX_TREE_NUMBER_OF_SPLIT_SUB_NODES	256
 
 /* Retrieves the number of leaf nodes for the specific identifier
  * Returns 1 if successful or -1 on error
@@ -1379,3 +1389,478 @@ int libpff_index_tree_insert_value(
 	return( 1 );
 }
 
+/* Appends recovered index values as leaf nodes to an index tree node
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_index_tree_node_append_recovered_values(
+     libfdata_tree_node_t *index_tree_node,
+     libpff_recovered_index_value_t *recovered_index_values,
+     int first_value_index,
+     int last_value_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_index_tree_node_append_recovered_values";
+	int sub_node_index    = 0;
+	int value_index       = 0;
+
+	if( recovered_index_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered index values.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = first_value_index;
+	     value_index < last_value_index;
+	     value_index++ )
+	{
+		if( libfdata_tree_node_append_sub_node(
+		     index_tree_node,
+		     &sub_node_index,
+		     recovered_index_values[ value_index ].node_data_offset,
+		     recovered_index_values[ value_index ].node_data_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append index value: %" PRIu64 " to index tree node.",
+			 function,
+			 recovered_index_values[ value_index ].identifier );
+
+			return( -1 );
+		}
+		if( libfdata_tree_node_set_leaf_sub_node(
+		     index_tree_node,
+		     sub_node_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set leaf in index tree sub node: %d.",
+			 function,
+			 sub_node_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends groups of recovered index values to an index tree node
+ * Every group is stored in a virtual branch node, if there are more groups
+ * than fit in a branch node the groups are divided over multiple levels of virtual branch nodes
+ * The index tree node must already contain the first 2 values of the first group
+ * since a virtual branch node can only be created by splitting the sub nodes
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_index_tree_node_append_recovered_value_groups(
+     libfdata_tree_node_t *index_tree_node,
+     libbfio_handle_t *file_io_handle,
+     libfcache_cache_t *cache,
+     libpff_recovered_index_value_t *recovered_index_values,
+     int *group_value_indexes,
+     int first_group_index,
+     int number_of_groups,
+     libcerror_error_t **error )
+{
+	libfdata_tree_node_t *index_tree_sub_node = NULL;
+	static char *function                     = "libpff_index_tree_node_append_recovered_value_groups";
+	int chunk_index                           = 0;
+	int group_index                           = 0;
+	int number_of_chunk_groups                = 0;
+	int number_of_chunks                      = 0;
+	int number_of_groups_per_chunk            = 0;
+
+	if( group_value_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid group value indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_groups <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of groups value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_groups == 1 )
+	{
+		if( libpff_index_tree_node_append_recovered_values(
+		     index_tree_node,
+		     recovered_index_values,
+		     group_value_indexes[ first_group_index ] + 2,
+		     group_value_indexes[ first_group_index + 1 ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append recovered values of group: %d.",
+			 function,
+			 first_group_index );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( number_of_groups <= LIBPFF_INDEX_TREE_MAXIMUM_NUMBER_OF_SUB_NODES )
+	{
+		number_of_groups_per_chunk = 1;
+	}
+	else
+	{
+		number_of_groups_per_chunk = ( number_of_groups + LIBPFF_INDEX_TREE_NUMBER_OF_SPLIT_SUB_NODES - 1 )
+		                           / LIBPFF_INDEX_TREE_NUMBER_OF_SPLIT_SUB_NODES;
+	}
+	number_of_chunks = ( number_of_groups + number_of_groups_per_chunk - 1 )
+	                 / number_of_groups_per_chunk;
+
+	/* Add the first 2 values of every other chunk so that splitting
+	 * results in a virtual branch node per chunk
+	 */
+	for( chunk_index = 1;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		group_index = first_group_index + ( chunk_index * number_of_groups_per_chunk );
+
+		if( libpff_index_tree_node_append_recovered_values(
+		     index_tree_node,
+		     recovered_index_values,
+		     group_value_indexes[ group_index ],
+		     group_value_indexes[ group_index ] + 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append first recovered values of group: %d.",
+			 function,
+			 group_index );
+
+			return( -1 );
+		}
+	}
+	if( libfdata_tree_node_split_sub_nodes(
+	     index_tree_node,
+	     number_of_chunks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to split index tree node.",
+		 function );
+
+		return( -1 );
+	}
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		group_index            = first_group_index + ( chunk_index * number_of_groups_per_chunk );
+		number_of_chunk_groups = number_of_groups - ( chunk_index * number_of_groups_per_chunk );
+
+		if( number_of_chunk_groups > number_of_groups_per_chunk )
+		{
+			number_of_chunk_groups = number_of_groups_per_chunk;
+		}
+		if( libfdata_tree_node_get_sub_node_by_index(
+		     index_tree_node,
+		     file_io_handle,
+		     cache,
+		     chunk_index,
+		     &index_tree_sub_node,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub node: %d from index tree node.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+		if( libpff_index_tree_node_append_recovered_value_groups(
+		     index_tree_sub_node,
+		     file_io_handle,
+		     cache,
+		     recovered_index_values,
+		     group_value_indexes,
+		     group_index,
+		     number_of_chunk_groups,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append recovered value groups to sub node: %d.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Inserts recovered index values to the index tree
+ * The recovered index values are sorted and deduplicated in advance
+ * If the index tree is empty the leaf nodes are appended in a single pass,
+ * otherwise every value is inserted individually
+ * The leaf nodes are grouped in virtual branch nodes, values with the same identifier
+ * are kept in the same group since the index tree is searched one branch at a time
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_index_tree_insert_recovered_values(
+     libfdata_tree_t *index_tree,
+     libbfio_handle_t *file_io_handle,
+     libfcache_cache_t *cache,
+     libpff_recovered_index_values_t *recovered_index_values,
+     libcerror_error_t **error )
+{
+	libfdata_tree_node_t *index_tree_root_node            = NULL;
+	libpff_recovered_index_value_t *recovered_index_value = NULL;
+	int *group_value_indexes                              = NULL;
+	static char *function                                 = "libpff_index_tree_insert_recovered_values";
+	int group_value_index                                 = 0;
+	int number_of_groups                                  = 0;
+	int number_of_sub_nodes                               = 0;
+	int value_index                                       = 0;
+
+	if( index_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovered_index_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered index values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_recovered_index_values_sort(
+	     recovered_index_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to sort recovered index values.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovered_index_values->number_of_values == 0 )
+	{
+		return( 1 );
+	}
+	if( libfdata_tree_get_root_node(
+	     index_tree,
+	     &index_tree_root_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root node from index tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_tree_node_get_number_of_sub_nodes(
+	     index_tree_root_node,
+	     file_io_handle,
+	     cache,
+	     &number_of_sub_nodes,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub nodes from root node.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sub_nodes != 0 )
+	{
+		for( value_index = 0;
+		     value_index < recovered_index_values->number_of_values;
+		     value_index++ )
+		{
+			recovered_index_value = &( recovered_index_values->values[ value_index ] );
+
+			if( libpff_index_tree_insert_value(
+			     index_tree,
+			     file_io_handle,
+			     cache,
+			     recovered_index_value->identifier,
+			     recovered_index_value->node_data_offset,
+			     recovered_index_value->node_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert index value: %" PRIu64 ".",
+				 function,
+				 recovered_index_value->identifier );
+
+				return( -1 );
+			}
+		}
+		return( 1 );
+	}
+	if( recovered_index_values->number_of_values <= LIBPFF_INDEX_TREE_MAXIMUM_NUMBER_OF_SUB_NODES )
+	{
+		if( libpff_index_tree_node_append_recovered_values(
+		     index_tree_root_node,
+		     recovered_index_values->values,
+		     0,
+		     recovered_index_values->number_of_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append recovered values to root node.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	/* Determine the groups of values, a group ends at the first change
+	 * of identifier after the preferred number of values
+	 */
+	group_value_indexes = (int *) memory_allocate(
+	                               sizeof( int ) * ( ( recovered_index_values->number_of_values / LIBPFF_INDEX_TREE_NUMBER_OF_SPLIT_SUB_NODES ) + 2 ) );
+
+	if( group_value_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create group value indexes.",
+		 function );
+
+		return( -1 );
+	}
+	group_value_indexes[ 0 ] = 0;
+	number_of_groups         = 1;
+
+	for( value_index = 1;
+	     value_index < recovered_index_values->number_of_values;
+	     value_index++ )
+	{
+		group_value_index = group_value_indexes[ number_of_groups - 1 ];
+
+		if( ( ( value_index - group_value_index ) >= LIBPFF_INDEX_TREE_NUMBER_OF_SPLIT_SUB_NODES )
+		 && ( recovered_index_values->values[ value_index ].identifier != recovered_index_values->values[ value_index - 1 ].identifier ) )
+		{
+			group_value_indexes[ number_of_groups++ ] = value_index;
+		}
+	}
+	/* Every group requires at least 2 values to be split into a virtual branch node
+	 */
+	if( ( number_of_groups > 1 )
+	 && ( ( recovered_index_values->number_of_values - group_value_indexes[ number_of_groups - 1 ] ) < 2 ) )
+	{
+		number_of_groups--;
+	}
+	group_value_indexes[ number_of_groups ] = recovered_index_values->number_of_values;
+
+	if( libpff_index_tree_node_append_recovered_values(
+	     index_tree_root_node,
+	     recovered_index_values->values,
+	     0,
+	     2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append first recovered values to root node.",
+		 function );
+
+		goto on_error;
+	}
+	if( libpff_index_tree_node_append_recovered_value_groups(
+	     index_tree_root_node,
+	     file_io_handle,
+	     cache,
+	     recovered_index_values->values,
+	     group_value_indexes,
+	     0,
+	     number_of_groups,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append recovered value groups to root node.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 group_value_indexes );
+
+	return( 1 );
+
+on_error:
+	if( group_value_indexes != NULL )
+	{
+		memory_free(
+		 group_value_indexes );
+	}
+	return( -1 );
+}
+
@@ -30,6 +30,7 @@
 #include "libpff_libcerror.h"
 #include "libpff_libfcache.h"
 #include "libpff_libfdata.h"
+#include "libpff_recovered_index_values.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -95,6 +96,30 @@ int libpff_index_tree_insert_value(
      size64_t node_data_size,
      libcerror_error_t **error );
 
+int libpff_index_tree_node_append_recovered_values(
+     libfdata_tree_node_t *index_tree_node,
+     libpff_recovered_index_value_t *recovered_index_values,
+     int first_value_index,
+     int last_value_index,
+     libcerror_error_t **error );
+
+int libpff_index_tree_node_append_recovered_value_groups(
+     libfdata_tree_node_t *index_tree_node,
+     libbfio_handle_t *file_io_handle,
+     libfcache_cache_t *cache,
+     libpff_recovered_index_value_t *recovered_index_values,
+     int *group_value_indexes,
+     int first_group_index,
+     int number_of_groups,
+     libcerror_error_t **error );
+
+int libpff_index_tree_insert_recovered_values(
+     libfdata_tree_t *index_tree,
+     libbfio_handle_t *file_io_handle,
+     libfcache_cache_t *cache,
+     libpff_recovered_index_values_t *recovered_index_values,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -25,6 +25,7 @@
 #include <types.h>
 
 #include "libpff_allocation_table.h"
+#include "libpff_buffer_pool.h"
 #include "libpff_codepage.h"
 #include "libpff_data_array.h"
 #include "libpff_data_block.h"
@@ -48,6 +49,9 @@
 #include "libpff_local_descriptors.h"
 #include "libpff_local_descriptors_tree.h"
 #include "libpff_offset_list.h"
+#include "libpff_recovered_index_values.h"
+#include "libpff_recovery_checkpoint.h"
+#include "libpff_recovery_progress.h"
 #include "libpff_tree_type.h"
 #include "libpff_unused.h"
 
@@ -61,8 +65,16 @@
 #define LIBPFF_IO_HANDLE_RECOVERED_DESCRIPTOR_INDEX_TREE_ROOT_OFFSET	3
 #define LIBPFF_IO_HANDLE_RECOVERED_OFFSET_INDEX_TREE_ROOT_OFFSET	4
 
+/* The size of the window used to scan for index nodes during recovery
+ */
+#define LIBPFF_IO_HANDLE_RECOVERY_SCAN_WINDOW_SIZE			65536
+
 const uint8_t pff_file_signature[ 4 ] = { 0x21, 0x42, 0x44, 0x4e };
 
+/* An empty 64 bytes block, used to reject empty data block positions during recovery
+ */
+static const uint8_t libpff_io_handle_empty_block[ 64 ] = { 0 };
+
 /* Initialize an IO handle
  * Make sure the value io_handle is pointing to is set to NULL
  * Returns 1 if successful or -1 on error
@@ -123,6 +135,89 @@ int libpff_io_handle_initialize(
 
 		goto on_error;
 	}
+	if( libpff_buffer_pool_initialize(
+	     &( ( *io_handle )->buffer_pool ),
+	     &( ( *io_handle )->statistics ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create buffer pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( libpff_recovery_progress_initialize(
+	     &( ( *io_handle )->recovery_progress ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create recovery progress.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_cache_initialize(
+	     &( ( *io_handle )->local_descriptor_nodes_cache ),
+	     LIBPFF_MAXIMUM_CACHE_ENTRIES_LOCAL_DESCRIPTORS_NODES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create local descriptor nodes cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_cache_set_statistics(
+	     ( *io_handle )->local_descriptor_nodes_cache,
+	     &( ( *io_handle )->statistics.cache_statistics[ LIBPFF_CACHE_LOCAL_DESCRIPTOR_NODES ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set local descriptor nodes cache statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_cache_initialize(
+	     &( ( *io_handle )->item_tables_cache ),
+	     LIBPFF_MAXIMUM_CACHE_ENTRIES_ITEM,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item tables cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_cache_set_statistics(
+	     ( *io_handle )->item_tables_cache,
+	     &( ( *io_handle )->statistics.cache_statistics[ LIBPFF_CACHE_ITEM_VALUES ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set item tables cache statistics.",
+		 function );
+
+		goto on_error;
+	}
 	( *io_handle )->ascii_codepage = LIBPFF_CODEPAGE_WINDOWS_1252;
 
 	return( 1 );
@@ -130,6 +225,30 @@ int libpff_io_handle_initialize(
 on_error:
 	if( *io_handle != NULL )
 	{
+		if( ( *io_handle )->item_tables_cache != NULL )
+		{
+			libfcache_cache_free(
+			 &( ( *io_handle )->item_tables_cache ),
+			 NULL );
+		}
+		if( ( *io_handle )->local_descriptor_nodes_cache != NULL )
+		{
+			libfcache_cache_free(
+			 &( ( *io_handle )->local_descriptor_nodes_cache ),
+			 NULL );
+		}
+		if( ( *io_handle )->recovery_progress != NULL )
+		{
+			libpff_recovery_progress_free(
+			 &( ( *io_handle )->recovery_progress ),
+			 NULL );
+		}
+		if( ( *io_handle )->buffer_pool != NULL )
+		{
+			libpff_buffer_pool_free(
+			 &( ( *io_handle )->buffer_pool ),
+			 NULL );
+		}
 		memory_free(
 		 *io_handle );
 
@@ -289,6 +408,89 @@ int libpff_io_handle_free(
 				result = -1;
 			}
 		}
+		if( ( *io_handle )->item_tables_cache != NULL )
+		{
+			if( libfcache_cache_free(
+			     &( ( *io_handle )->item_tables_cache ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free item tables cache.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *io_handle )->local_descriptor_nodes_cache != NULL )
+		{
+			if( libfcache_cache_free(
+			     &( ( *io_handle )->local_descriptor_nodes_cache ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free local descriptor nodes cache.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* The buffer pool is freed last since the index and local descriptor nodes
+		 * release their data to the pool when they are freed
+		 */
+		if( ( *io_handle )->buffer_pool != NULL )
+		{
+			if( libpff_buffer_pool_free(
+			     &( ( *io_handle )->buffer_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free buffer pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *io_handle )->recovery_progress != NULL )
+		{
+			if( libpff_recovery_progress_free(
+			     &( ( *io_handle )->recovery_progress ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free recovery progress.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *io_handle )->recovery_checkpoint != NULL )
+		{
+			if( libpff_recovery_checkpoint_free(
+			     &( ( *io_handle )->recovery_checkpoint ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free recovery checkpoint.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *io_handle );
 
@@ -297,6 +499,61 @@ int libpff_io_handle_free(
 	return( result );
 }
 
+/* Clears the caches of the IO handle that contain values of the file
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_io_handle_clear_caches(
+     libpff_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_io_handle_clear_caches";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->item_tables_cache != NULL )
+	{
+		if( libfcache_cache_clear(
+		     io_handle->item_tables_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear item tables cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( io_handle->local_descriptor_nodes_cache != NULL )
+	{
+		if( libfcache_cache_clear(
+		     io_handle->local_descriptor_nodes_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear local descriptor nodes cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
 /* Reads the file header
  * Returns 1 if successful or -1 on error
  */
@@ -428,6 +685,9 @@ int libpff_io_handle_read_file_header(
 
 		goto on_error;
 	}
+	io_handle->statistics.number_of_bytes_read      += (uint64_t) read_count;
+	io_handle->statistics.number_of_read_operations += 1;
+
 	file_header_data = &( file_header[ sizeof( pff_file_header_t ) ] );
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -639,6 +899,8 @@ int libpff_io_handle_read_file_header(
 
 		goto on_error;
 	}
+	io_handle->statistics.number_of_bytes_crc_checked += 471;
+
 	if( stored_crc != calculated_crc )
 	{
 		libcerror_error_set(
@@ -1112,6 +1374,8 @@ int libpff_io_handle_read_file_header(
 
 			goto on_error;
 		}
+		io_handle->statistics.number_of_bytes_crc_checked += 516;
+
 		if( stored_crc != calculated_crc )
 		{
 			libcerror_error_set(
@@ -1201,6 +1465,20 @@ int libpff_io_handle_read_file_header(
 
 			goto on_error;
 		}
+		if( libfcache_cache_set_statistics(
+		     io_handle->index_nodes_cache,
+		     &( io_handle->statistics.cache_statistics[ LIBPFF_CACHE_INDEX_NODES ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set index nodes cache statistics.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	/* Create the descriptor index tree
 	 */
@@ -1277,6 +1555,20 @@ int libpff_io_handle_read_file_header(
 
 			goto on_error;
 		}
+		if( libfcache_cache_set_statistics(
+		     io_handle->descriptor_index_tree_cache,
+		     &( io_handle->statistics.cache_statistics[ LIBPFF_CACHE_DESCRIPTOR_INDEX_VALUES ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set descriptor index tree cache statistics.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	/* Create the offset index tree
 	 */
@@ -1353,6 +1645,20 @@ int libpff_io_handle_read_file_header(
 
 			goto on_error;
 		}
+		if( libfcache_cache_set_statistics(
+		     io_handle->offset_index_tree_cache,
+		     &( io_handle->statistics.cache_statistics[ LIBPFF_CACHE_OFFSET_INDEX_VALUES ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set offset index tree cache statistics.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	return( 1 );
 
@@ -1411,6 +1717,7 @@ int libpff_io_handle_read_unallocated_data_blocks(
 		     file_io_handle,
 		     allocation_table_offset,
 		     (int) io_handle->file_type,
+		     &( io_handle->statistics ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1462,6 +1769,7 @@ int libpff_io_handle_read_unallocated_page_blocks(
 		     file_io_handle,
 		     allocation_table_offset,
 		     (int) io_handle->file_type,
+		     &( io_handle->statistics ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1679,6 +1987,8 @@ int libpff_io_handle_read_index_node(
 	     file_io_handle,
 	     element_data_offset,
 	     ( (libpff_io_handle_t *) io_handle )->file_type,
+	     ( (libpff_io_handle_t *) io_handle )->buffer_pool,
+	     &( ( (libpff_io_handle_t *) io_handle )->statistics ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1775,12 +2085,17 @@ int libpff_io_handle_read_local_descriptor_node(
 
 		return( -1 );
 	}
+	/* The node is stored in a cache of the caller that can outlive the IO handle
+	 * hence its data is not retrieved from the buffer pool
+	 */
 	if( libpff_local_descriptor_node_read(
 	     local_descriptor_node,
 	     file_io_handle,
 	     element_data_offset,
 	     (size32_t) element_data_size,
 	     ( (libpff_io_handle_t *) io_handle )->file_type,
+	     NULL,
+	     &( ( (libpff_io_handle_t *) io_handle )->statistics ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1821,20 +2136,27 @@ int libpff_io_handle_read_local_descriptor_node(
 	return( 1 );
 }
 
-/* Retrieves a descriptor index value for a specific identifier
- * Returns 1 if successful, 0 if no index value was found or -1 on error
+/* Retrieves a local descriptor node
+ * The nodes are cached in the local descriptor nodes cache of the IO handle,
+ * which is shared by all the local descriptors, using the node offset as key
+ * The node is managed by the cache and remains valid until the next call
+ * Returns 1 if successful or -1 on error
  */
-int libpff_io_handle_get_descriptor_index_value_by_identifier(
+int libpff_io_handle_get_local_descriptor_node(
      libpff_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     uint32_t descriptor_identifier,
-     uint8_t recovered,
-     libpff_index_value_t **descriptor_index_value,
+     off64_t node_offset,
+     size32_t node_size,
+     libpff_local_descriptor_node_t **local_descriptor_node,
      libcerror_error_t **error )
 {
-	static char *function      = "libpff_io_handle_get_descriptor_index_value_by_identifier";
-	int number_of_index_values = 0;
-	int result                 = 0;
+	libfcache_cache_value_t *cache_value = NULL;
+	static char *function                = "libpff_io_handle_get_local_descriptor_node";
+	off64_t cache_value_offset           = (off64_t) -1;
+	time_t cache_value_size              = 0;
+	int cache_entry_index                = 0;
+	int number_of_cache_entries          = 0;
+	uint8_t cache_hit                    = 0;
 
 	if( io_handle == NULL )
 	{
@@ -1847,29 +2169,257 @@ int libpff_io_handle_get_descriptor_index_value_by_identifier(
 
 		return( -1 );
 	}
-	if( recovered == 0 )
+	if( io_handle->local_descriptor_nodes_cache == NULL )
 	{
-		result = libpff_index_tree_get_value_by_identifier(
-			  io_handle->descriptor_index_tree,
-			  file_io_handle,
-			  io_handle->descriptor_index_tree_cache,
-			  descriptor_identifier,
-			  0,
-			  descriptor_index_value,
-			  error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve descriptor index value: %" PRIu32 ".",
-			 function,
-			 descriptor_identifier );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing local descriptor nodes cache.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
+	}
+	if( node_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid node offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( local_descriptor_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid local descriptor node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_cache_get_number_of_entries(
+	     io_handle->local_descriptor_nodes_cache,
+	     &number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_cache_entries <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of cache entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The nodes are stored in blocks that are aligned to 64 bytes
+	 */
+	cache_entry_index = (int) ( ( node_offset / 64 ) % number_of_cache_entries );
+
+	if( libfcache_cache_get_value_by_index(
+	     io_handle->local_descriptor_nodes_cache,
+	     cache_entry_index,
+	     &cache_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache entry: %d.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	if( cache_value != NULL )
+	{
+		/* The node size is stored as the (otherwise unused) cache value timestamp
+		 */
+		if( libfcache_cache_value_get_identifier(
+		     cache_value,
+		     &cache_value_offset,
+		     &cache_value_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value identifier.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( cache_value_offset == node_offset )
+		 && ( cache_value_size == (time_t) node_size ) )
+		{
+			cache_hit = 1;
+		}
+	}
+	if( libfcache_cache_update_statistics(
+	     io_handle->local_descriptor_nodes_cache,
+	     cache_hit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update cache statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_hit != 0 )
+	{
+		if( libfcache_cache_value_get_value(
+		     cache_value,
+		     (intptr_t **) local_descriptor_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve local descriptor node from cache value.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	*local_descriptor_node = NULL;
+
+	if( libpff_local_descriptor_node_initialize(
+	     local_descriptor_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create local descriptor node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_local_descriptor_node_read(
+	     *local_descriptor_node,
+	     file_io_handle,
+	     node_offset,
+	     node_size,
+	     io_handle->file_type,
+	     io_handle->buffer_pool,
+	     &( io_handle->statistics ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read local descriptor node at offset: %" PRIi64 ".",
+		 function,
+		 node_offset );
+
+		goto on_error;
+	}
+	if( libfcache_cache_set_value_by_index(
+	     io_handle->local_descriptor_nodes_cache,
+	     cache_entry_index,
+	     node_offset,
+	     (time_t) node_size,
+	     (intptr_t *) *local_descriptor_node,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libpff_local_descriptor_node_free,
+	     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set local descriptor node in cache entry: %d.",
+		 function,
+		 cache_entry_index );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *local_descriptor_node != NULL )
+	{
+		libpff_local_descriptor_node_free(
+		 local_descriptor_node,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a descriptor index value for a specific identifier
+ * Returns 1 if successful, 0 if no index value was found or -1 on error
+ */
+int libpff_io_handle_get_descriptor_index_value_by_identifier(
+     libpff_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t descriptor_identifier,
+     uint8_t recovered,
+     libpff_index_value_t **descriptor_index_value,
+     libcerror_error_t **error )
+{
+	static char *function      = "libpff_io_handle_get_descriptor_index_value_by_identifier";
+	int number_of_index_values = 0;
+	int result                 = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovered == 0 )
+	{
+		result = libpff_index_tree_get_value_by_identifier(
+			  io_handle->descriptor_index_tree,
+			  file_io_handle,
+			  io_handle->descriptor_index_tree_cache,
+			  descriptor_identifier,
+			  0,
+			  descriptor_index_value,
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve descriptor index value: %" PRIu32 ".",
+			 function,
+			 descriptor_identifier );
+
+			return( -1 );
+		}
 	}
 	else
 	{
@@ -2418,6 +2968,7 @@ int libpff_io_handle_read_descriptor_data_block(
 	              data_buffer,
 	              (size_t) offset_index_value->data_size,
 	              &( data_block->flags ),
+	              &( io_handle->statistics ),
 	              error );
 
 	if( read_count != (ssize_t) offset_index_value->data_size )
@@ -2531,6 +3082,20 @@ int libpff_io_handle_read_descriptor_data_block(
 
 			goto on_error;
 		}
+		if( libfcache_cache_set_statistics(
+		     *descriptor_data_cache,
+		     &( io_handle->statistics.cache_statistics[ LIBPFF_CACHE_DATA_BLOCKS ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set descriptor data cache statistics.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	else
 	{
@@ -2599,6 +3164,20 @@ int libpff_io_handle_read_descriptor_data_block(
 
 			goto on_error;
 		}
+		if( libfcache_cache_set_statistics(
+		     *descriptor_data_cache,
+		     &( io_handle->statistics.cache_statistics[ LIBPFF_CACHE_DATA_BLOCKS ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set descriptor data cache statistics.",
+			 function );
+
+			goto on_error;
+		}
 		if( libfdata_block_set_segment_data(
 		     *descriptor_data_block,
 		     *descriptor_data_cache,
@@ -2617,6 +3196,23 @@ int libpff_io_handle_read_descriptor_data_block(
 
 			goto on_error;
 		}
+		/* The data block was read without a cache lookup
+		 * so it counts as a miss of the descriptor data cache
+		 */
+		if( libfcache_cache_update_statistics(
+		     *descriptor_data_cache,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update descriptor data cache statistics.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	return( 1 );
 
@@ -2717,6 +3313,60 @@ on_error:
 	return( -1 );
 }
 
+/* Writes the recovery checkpoint if one was set
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_io_handle_write_recovery_checkpoint(
+     libpff_io_handle_t *io_handle,
+     uint8_t stage,
+     off64_t scan_offset,
+     uint8_t recovery_flags,
+     libpff_recovered_index_values_t *recovered_descriptor_index_values,
+     libpff_recovered_index_values_t *recovered_offset_index_values,
+     uint8_t force_write,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_io_handle_write_recovery_checkpoint";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->recovery_checkpoint == NULL )
+	{
+		return( 1 );
+	}
+	if( libpff_recovery_checkpoint_write(
+	     io_handle->recovery_checkpoint,
+	     stage,
+	     scan_offset,
+	     io_handle->file_size,
+	     io_handle->file_type,
+	     recovery_flags,
+	     recovered_descriptor_index_values,
+	     recovered_offset_index_values,
+	     force_write,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write recovery checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Scans for recoverable items
  * By default only the unallocated space is checked for recoverable items
  * Returns 1 if successful or -1 on error
@@ -2736,11 +3386,14 @@ int libpff_io_handle_recover_items(
 	libpff_index_value_t *descriptor_index_value               = NULL;
 	libpff_index_value_t *offset_index_value                   = NULL;
 	libpff_item_descriptor_t *item_descriptor                  = NULL;
+	libpff_recovered_index_values_t *descriptor_index_values   = NULL;
+	libpff_recovered_index_values_t *offset_index_values       = NULL;
 	libpff_tree_node_t *item_tree_node                         = NULL;
 	uint8_t *block_buffer                                      = NULL;
 	static char *function                                      = "libpff_io_handle_recover_items";
 	ssize_t read_count                                         = 0;
 	uint8_t data_block_read_flags                              = 0;
+	uint8_t resume_stage                                       = LIBPFF_RECOVERY_STAGE_NONE;
 	int data_identifier_value_index                            = 0;
 	int index_value_iterator                                   = 0;
 	int local_descriptors_identifier_value_index               = 0;
@@ -2936,36 +3589,229 @@ int libpff_io_handle_recover_items(
                 return( -1 );
 	}
 #endif
-	if( libpff_io_handle_recover_index_nodes(
-	     io_handle,
-	     file_io_handle,
+	if( libpff_recovery_progress_start(
+	     io_handle->recovery_progress,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to recover index nodes.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start recovery progress.",
 		 function );
 
 		return( -1 );
 	}
-	if( libpff_io_handle_recover_data_blocks(
-	     io_handle,
+	/* The recoverable index values are gathered first and inserted
+	 * into the recovered index trees in a single pass afterwards
+	 */
+	if( libpff_recovered_index_values_initialize(
+	     &descriptor_index_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create recovered descriptor index values.",
+		 function );
+
+		goto on_error;
+	}
+	if( libpff_recovered_index_values_initialize(
+	     &offset_index_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create recovered offset index values.",
+		 function );
+
+		goto on_error;
+	}
+	result = libpff_recovery_progress_set_stage(
+	          io_handle->recovery_progress,
+	          LIBPFF_RECOVERY_STAGE_INDEX_TREES,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set recovery progress stage.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		io_handle->abort = 1;
+	}
+	/* A checkpoint of a previous recovery provides the index values
+	 * recovered so far and the stage to resume in
+	 */
+	if( io_handle->recovery_checkpoint != NULL )
+	{
+		if( libpff_recovery_checkpoint_read(
+		     io_handle->recovery_checkpoint,
+		     io_handle->file_size,
+		     io_handle->file_type,
+		     recovery_flags,
+		     descriptor_index_values,
+		     offset_index_values,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read recovery checkpoint.",
+			 function );
+
+			goto on_error;
+		}
+		resume_stage = io_handle->recovery_checkpoint->stage;
+	}
+	if( resume_stage < LIBPFF_RECOVERY_STAGE_UNALLOCATED_SPACE )
+	{
+		if( libpff_io_handle_recover_index_nodes(
+		     io_handle,
+		     file_io_handle,
+		     descriptor_index_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to recover index nodes.",
+			 function );
+
+			goto on_error;
+		}
+		if( libpff_io_handle_write_recovery_checkpoint(
+		     io_handle,
+		     LIBPFF_RECOVERY_STAGE_UNALLOCATED_SPACE,
+		     0,
+		     recovery_flags,
+		     descriptor_index_values,
+		     offset_index_values,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write recovery checkpoint.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( resume_stage < LIBPFF_RECOVERY_STAGE_ITEMS )
+	{
+		if( libpff_io_handle_recover_data_blocks(
+		     io_handle,
+		     file_io_handle,
+		     unallocated_data_block_list,
+		     unallocated_page_block_list,
+		     descriptor_index_values,
+		     offset_index_values,
+		     recovery_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to recover data blocks.",
+			 function );
+
+			goto on_error;
+		}
+		if( libpff_io_handle_write_recovery_checkpoint(
+		     io_handle,
+		     LIBPFF_RECOVERY_STAGE_ITEMS,
+		     (off64_t) io_handle->file_size,
+		     recovery_flags,
+		     descriptor_index_values,
+		     offset_index_values,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write recovery checkpoint.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libpff_index_tree_insert_recovered_values(
+	     io_handle->recovered_descriptor_index_tree,
 	     file_io_handle,
-	     unallocated_data_block_list,
-	     unallocated_page_block_list,
-	     recovery_flags,
+	     io_handle->descriptor_index_tree_cache,
+	     descriptor_index_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to recover data blocks.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert recovered descriptor index values.",
 		 function );
 
-		return( -1 );
+		goto on_error;
+	}
+	if( libpff_recovered_index_values_free(
+	     &descriptor_index_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free recovered descriptor index values.",
+		 function );
+
+		goto on_error;
+	}
+	if( libpff_index_tree_insert_recovered_values(
+	     io_handle->recovered_offset_index_tree,
+	     file_io_handle,
+	     io_handle->offset_index_tree_cache,
+	     offset_index_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert recovered offset index values.",
+		 function );
+
+		goto on_error;
+	}
+	if( libpff_recovered_index_values_free(
+	     &offset_index_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free recovered offset index values.",
+		 function );
+
+		goto on_error;
 	}
 	block_buffer = (uint8_t *) memory_allocate(
 	                            sizeof( uint8_t ) * 8192 );
@@ -3004,10 +3850,61 @@ int libpff_io_handle_recover_items(
 
 		return( -1 );
 	}
+	result = libpff_recovery_progress_set_stage(
+	          io_handle->recovery_progress,
+	          LIBPFF_RECOVERY_STAGE_ITEMS,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set recovery progress stage.",
+		 function );
+
+		memory_free(
+		 block_buffer );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		io_handle->abort = 1;
+	}
 	for( recovered_descriptor_index_value_iterator = 0;
 	     recovered_descriptor_index_value_iterator < number_of_recovered_descriptor_index_values;
 	     recovered_descriptor_index_value_iterator++ )
 	{
+		result = libpff_recovery_progress_report(
+		          io_handle->recovery_progress,
+		          0,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to report recovery progress.",
+			 function );
+
+			libpff_list_empty(
+			 recovered_item_list,
+			 (int (*)(intptr_t **, libcerror_error_t **)) &libpff_item_tree_node_free_recovered,
+			 NULL );
+			memory_free(
+			 block_buffer );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			io_handle->abort = 1;
+		}
 		if( io_handle->abort != 0 )
 		{
 			memory_free(
@@ -3015,6 +3912,8 @@ int libpff_io_handle_recover_items(
 
 			return( -1 );
 		}
+		io_handle->recovery_progress->number_of_candidates[ LIBPFF_RECOVERY_COUNTER_ITEMS ] += 1;
+
 		if( libfdata_tree_get_leaf_node_by_index(
 		     io_handle->recovered_descriptor_index_tree,
 		     file_io_handle,
@@ -3199,6 +4098,7 @@ int libpff_io_handle_recover_items(
 						      block_buffer,
 						      offset_index_value->data_size,
 						      &data_block_read_flags,
+						      &( io_handle->statistics ),
 						      error );
 
 					if( read_count != (ssize_t) offset_index_value->data_size )
@@ -3314,6 +4214,8 @@ int libpff_io_handle_recover_items(
 					{
 						/* Check if local descriptors are readable
 						 */
+						io_handle->recovery_progress->number_of_candidates[ LIBPFF_RECOVERY_COUNTER_LOCAL_DESCRIPTORS ] += 1;
+
 						result = libpff_io_handle_recover_local_descriptors(
 							  io_handle,
 							  file_io_handle,
@@ -3341,6 +4243,8 @@ int libpff_io_handle_recover_items(
 						}
 						else if( result != 0 )
 						{
+							io_handle->recovery_progress->number_of_validated[ LIBPFF_RECOVERY_COUNTER_LOCAL_DESCRIPTORS ] += 1;
+
 							break;
 						}
 					}
@@ -3523,11 +4427,34 @@ int libpff_io_handle_recover_items(
 				return( -1 );
 			}
 			item_tree_node = NULL;
+
+			io_handle->recovery_progress->number_of_validated[ LIBPFF_RECOVERY_COUNTER_ITEMS ] += 1;
 		}
 	}
 	memory_free(
 	 block_buffer );
 
+	if( libpff_recovery_progress_set_stage(
+	     io_handle->recovery_progress,
+	     LIBPFF_RECOVERY_STAGE_COMPLETED,
+	     0,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set recovery progress stage.",
+		 function );
+
+		libpff_list_empty(
+		 recovered_item_list,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libpff_item_tree_node_free_recovered,
+		 NULL );
+
+		return( -1 );
+	}
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libbfio_handle_set_track_offsets_read(
 	     file_io_handle,
@@ -3550,6 +4477,21 @@ int libpff_io_handle_recover_items(
 	 * what about 'encryption' ?
 	 */
 	return( 1 );
+
+on_error:
+	if( offset_index_values != NULL )
+	{
+		libpff_recovered_index_values_free(
+		 &offset_index_values,
+		 NULL );
+	}
+	if( descriptor_index_values != NULL )
+	{
+		libpff_recovered_index_values_free(
+		 &descriptor_index_values,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Scans for recoverable index nodes
@@ -3558,6 +4500,7 @@ int libpff_io_handle_recover_items(
 int libpff_io_handle_recover_index_nodes(
      libpff_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
+     libpff_recovered_index_values_t *recovered_descriptor_index_values,
      libcerror_error_t **error )
 {
 	libfdata_tree_node_t *deleted_index_leaf_node = NULL;
@@ -3568,8 +4511,6 @@ int libpff_io_handle_recover_index_nodes(
 	size64_t node_data_size                       = 0;
 	uint32_t node_data_flags                      = 0;
 	int deleted_index_value_iterator              = 0;
-	int index_value_iterator                      = 0;
-	int number_of_index_values                    = 0;
 	int number_of_deleted_index_values            = 0;
 	int result                                    = 0;
 
@@ -3607,6 +4548,26 @@ int libpff_io_handle_recover_index_nodes(
 	     deleted_index_value_iterator < number_of_deleted_index_values;
 	     deleted_index_value_iterator++ )
 	{
+		result = libpff_recovery_progress_report(
+		          io_handle->recovery_progress,
+		          0,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to report recovery progress.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			io_handle->abort = 1;
+		}
 		if( io_handle->abort != 0 )
 		{
 			return( -1 );
@@ -3713,120 +4674,50 @@ int libpff_io_handle_recover_index_nodes(
 				continue;
 			}
 		}
-		/* Check for duplicates
+		/* Add the recovered descriptor index value to the recovered values
+		 * duplicates are removed when the recovered index tree is built
 		 */
-		if( libpff_index_tree_get_number_of_leaf_nodes_by_identifier(
-		     io_handle->recovered_descriptor_index_tree,
-		     file_io_handle,
-		     io_handle->descriptor_index_tree_cache,
-		     deleted_index_value->identifier,
-		     &number_of_index_values,
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: decriptor index value: %d identifier: %" PRIu64 " is recoverable.\n",
+			 function,
+			 deleted_index_value_iterator,
+			 deleted_index_value->identifier );
+		}
+#endif
+		if( libfdata_tree_node_get_data_range(
+		     deleted_index_leaf_node,
+		     &node_data_offset,
+		     &node_data_size,
+		     &node_data_flags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of recovered descriptor index values for identifier: %" PRIu64 ".",
+			 "%s: unable to retrieve deleted descriptor leaf node: %d range.",
 			 function,
-			 deleted_index_value->identifier );
+			 deleted_index_value_iterator );
 
 			return( -1 );
 		}
-		result = 0;
-
-		for( index_value_iterator = 0;
-		     index_value_iterator < number_of_index_values;
-		     index_value_iterator++ )
-		{
-			result = libpff_index_tree_get_value_by_identifier(
-				  io_handle->recovered_descriptor_index_tree,
-				  file_io_handle,
-				  io_handle->descriptor_index_tree_cache,
-				  deleted_index_value->identifier,
-				  index_value_iterator,
-				  &index_value,
-				  error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve recovered descriptor index value for identifier: %" PRIu64 ".",
-				 function,
-				 deleted_index_value->identifier );
-
-				return( -1 );
-			}
-			else if( result != 0 )
-			{
-				/* TODO what about parent changes ? */
-				if( ( deleted_index_value->data_identifier == index_value->data_identifier )
-				 && ( deleted_index_value->local_descriptors_identifier == index_value->local_descriptors_identifier ) )
-				{
-					break;
-				}
-				result = 0;
-			}
-		}
-		if( result != 0 )
-		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: deleted descriptor index value: %" PRIu64 " matches existing recovered item value.\n",
-				 function,
-				 deleted_index_value->identifier );
-			}
-#endif
-			continue;
-		}
-		/* Add the recovered descriptor index values to the index tree
-		 */
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: decriptor index value: %d identifier: %" PRIu64 " is recoverable.\n",
-			 function,
-			 deleted_index_value_iterator,
-			 deleted_index_value->identifier );
-		}
-#endif
-		if( libfdata_tree_node_get_data_range(
-		     deleted_index_leaf_node,
-		     &node_data_offset,
-		     &node_data_size,
-		     &node_data_flags,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve deleted descriptor leaf node: %d range.",
-			 function,
-			 deleted_index_value_iterator );
-
-			return( -1 );
-		}
-		if( libpff_index_tree_insert_value(
-		     io_handle->recovered_descriptor_index_tree,
-		     file_io_handle,
-		     io_handle->descriptor_index_tree_cache,
-		     deleted_index_value->identifier,
-		     node_data_offset,
-		     node_data_size,
-		     error ) != 1 )
+		if( libpff_recovered_index_values_append_value(
+		     recovered_descriptor_index_values,
+		     deleted_index_value->identifier,
+		     deleted_index_value->data_identifier,
+		     deleted_index_value->local_descriptors_identifier,
+		     node_data_offset,
+		     node_data_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to insert descriptor index value: %" PRIu64 " to recovered index tree.",
+			 "%s: unable to append descriptor index value: %" PRIu64 " to recovered values.",
 			 function,
 			 deleted_index_value->identifier );
 
@@ -3858,6 +4749,26 @@ fprintf( stderr, "O:\n" );
 	     deleted_index_value_iterator < number_of_deleted_index_values;
 	     deleted_index_value_iterator++ )
 	{
+		result = libpff_recovery_progress_report(
+		          io_handle->recovery_progress,
+		          0,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to report recovery progress.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			io_handle->abort = 1;
+		}
 		if( io_handle->abort != 0 )
 		{
 			return( -1 );
@@ -4128,38 +5039,51 @@ int libpff_io_handle_recover_data_blocks(
      libbfio_handle_t *file_io_handle,
      libpff_offset_list_t *unallocated_data_block_list,
      libpff_offset_list_t *unallocated_page_block_list,
+     libpff_recovered_index_values_t *recovered_descriptor_index_values,
+     libpff_recovered_index_values_t *recovered_offset_index_values,
      uint8_t recovery_flags,
      libcerror_error_t **error )
 {
-	libpff_index_value_t *index_value                          = NULL;
-	libpff_list_element_t *unallocated_data_block_list_element = NULL;
-	libpff_list_element_t *unallocated_page_block_list_element = NULL;
 	uint8_t *block_buffer                                      = NULL;
 	uint8_t *data_block_footer                                 = NULL;
+	uint8_t *scan_window                                       = NULL;
 	static char *function                                      = "libpff_io_handle_recover_data_blocks";
 	off64_t block_buffer_data_offset                           = 0;
 	off64_t block_offset                                       = 0;
 	off64_t data_block_offset                                  = 0;
 	off64_t page_block_offset                                  = 0;
+	off64_t resume_offset                                      = 0;
+	off64_t scan_window_offset                                 = -1;
 	size64_t block_size                                        = 0;
+	size64_t bytes_to_scan                                     = 0;
 	size64_t data_block_size                                   = 0;
 	size64_t page_block_size                                   = 0;
+	size64_t range_size                                        = 0;
+	size64_t scanned_size                                      = 0;
 	size_t block_buffer_offset                                 = 0;
 	size_t block_buffer_size_available                         = 0;
 	size_t data_block_data_offset                              = 0;
 	size_t read_size                                           = 0;
 	size_t scan_block_size                                     = 0;
+	size_t scan_window_size                                    = 0;
 	ssize_t read_count                                         = 0;
 	uint64_t data_block_back_pointer                           = 0;
+	uint64_t number_of_data_block_candidates                   = 0;
+	uint64_t number_of_data_block_crc_mismatches               = 0;
+	uint64_t number_of_empty_data_block_positions              = 0;
+	uint64_t number_of_invalid_data_block_footers              = 0;
+	uint64_t number_of_rejected_index_nodes                    = 0;
+	uint64_t number_of_scanned_data_block_positions            = 0;
+	uint64_t number_of_scanned_index_nodes                     = 0;
 	uint32_t data_block_calculated_crc                         = 0;
 	uint32_t data_block_stored_crc                             = 0;
 	uint16_t data_block_data_size                              = 0;
 	uint8_t supported_recovery_flags                           = 0;
-	int index_value_iterator                                   = 0;
-	int number_of_index_values                                 = 0;
+	int is_data_block                                          = 0;
 	int number_of_unallocated_data_blocks                      = 0;
 	int number_of_unallocated_page_blocks                      = 0;
 	int result                                                 = 0;
+	int unallocated_block_iterator                             = 0;
 	int unallocated_data_block_iterator                        = 0;
 	int unallocated_page_block_iterator                        = 0;
 
@@ -4231,8 +5155,6 @@ int libpff_io_handle_recover_data_blocks(
 
 			return( -1 );
 		}
-		unallocated_data_block_list_element = unallocated_data_block_list->first_element;
-
 		if( libpff_offset_list_get_number_of_elements(
 		     unallocated_page_block_list,
 		     &number_of_unallocated_page_blocks,
@@ -4247,7 +5169,90 @@ int libpff_io_handle_recover_data_blocks(
 
 			return( -1 );
 		}
-		unallocated_page_block_list_element = unallocated_page_block_list->first_element;
+	}
+	/* Determine the number of bytes to scan for the recovery progress
+	 */
+	if( ( recovery_flags & LIBPFF_RECOVERY_FLAG_IGNORE_ALLOCATION_DATA ) == 0 )
+	{
+		for( unallocated_block_iterator = 0;
+		     unallocated_block_iterator < number_of_unallocated_data_blocks;
+		     unallocated_block_iterator++ )
+		{
+			if( libpff_offset_list_get_offset(
+			     unallocated_data_block_list,
+			     unallocated_block_iterator,
+			     &data_block_offset,
+			     &data_block_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve unallocated data block list element: %d.",
+				 function,
+				 unallocated_block_iterator );
+
+				return( -1 );
+			}
+			bytes_to_scan += data_block_size;
+		}
+		for( unallocated_block_iterator = 0;
+		     unallocated_block_iterator < number_of_unallocated_page_blocks;
+		     unallocated_block_iterator++ )
+		{
+			if( libpff_offset_list_get_offset(
+			     unallocated_page_block_list,
+			     unallocated_block_iterator,
+			     &page_block_offset,
+			     &page_block_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve unallocated page block list element: %d.",
+				 function,
+				 unallocated_block_iterator );
+
+				return( -1 );
+			}
+			bytes_to_scan += page_block_size;
+		}
+	}
+	else
+	{
+		bytes_to_scan = io_handle->file_size;
+	}
+	result = libpff_recovery_progress_set_stage(
+	          io_handle->recovery_progress,
+	          LIBPFF_RECOVERY_STAGE_UNALLOCATED_SPACE,
+	          bytes_to_scan,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set recovery progress stage.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		io_handle->abort = 1;
+	}
+	/* The index values of the ranges before the resume offset
+	 * were read from the recovery checkpoint
+	 */
+	if( ( io_handle->recovery_checkpoint != NULL )
+	 && ( io_handle->recovery_checkpoint->stage == LIBPFF_RECOVERY_STAGE_UNALLOCATED_SPACE ) )
+	{
+		resume_offset = io_handle->recovery_checkpoint->scan_offset;
 	}
 	if( ( recovery_flags & LIBPFF_RECOVERY_FLAG_SCAN_FOR_FRAGMENTS ) == 0 )
 	{
@@ -4257,8 +5262,10 @@ int libpff_io_handle_recover_data_blocks(
 	{
 		scan_block_size = 64;
 	}
+	/* The scan window is stored behind the block buffer
+	 */
 	block_buffer = (uint8_t *) memory_allocate(
-	                            sizeof( uint8_t ) * ( 8192 * 2 ) );
+	                            sizeof( uint8_t ) * ( ( 8192 * 2 ) + LIBPFF_IO_HANDLE_RECOVERY_SCAN_WINDOW_SIZE ) );
 
 	if( block_buffer == NULL )
 	{
@@ -4271,6 +5278,8 @@ int libpff_io_handle_recover_data_blocks(
 
 		return( -1 );
 	}
+	scan_window = &( block_buffer[ 8192 * 2 ] );
+
 	if( ( number_of_unallocated_data_blocks > 0 )
 	 || ( number_of_unallocated_page_blocks > 0 )
 	 || ( ( recovery_flags & LIBPFF_RECOVERY_FLAG_IGNORE_ALLOCATION_DATA ) != 0 ) )
@@ -4283,6 +5292,27 @@ int libpff_io_handle_recover_data_blocks(
 		{
 			if( io_handle->abort != 0 )
 			{
+				if( block_offset < resume_offset )
+				{
+					block_offset = resume_offset;
+				}
+				if( libpff_io_handle_write_recovery_checkpoint(
+				     io_handle,
+				     LIBPFF_RECOVERY_STAGE_UNALLOCATED_SPACE,
+				     block_offset,
+				     recovery_flags,
+				     recovered_descriptor_index_values,
+				     recovered_offset_index_values,
+				     1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write recovery checkpoint.",
+					 function );
+				}
 				memory_free(
 				 block_buffer );
 
@@ -4296,28 +5326,18 @@ int libpff_io_handle_recover_data_blocks(
 					{
 						/* Retrieve the next unallocated data range
 						 */
-						if( unallocated_data_block_list_element == NULL )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-							 "%s: corruption detected for unallocated data block list element: %d.",
-							 function,
-							 unallocated_data_block_iterator );
-
-							memory_free(
-							 block_buffer );
-
-							return( -1 );
-						}
-						if( unallocated_data_block_list_element->value == NULL )
+						if( libpff_offset_list_get_offset(
+						     unallocated_data_block_list,
+						     unallocated_data_block_iterator,
+						     &data_block_offset,
+						     &data_block_size,
+						     error ) != 1 )
 						{
 							libcerror_error_set(
 							 error,
 							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-							 "%s: missing offset values for unallocate data block list element: %d.",
+							 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+							 "%s: unable to retrieve unallocated data block list element: %d.",
 							 function,
 							 unallocated_data_block_iterator );
 
@@ -4326,11 +5346,6 @@ int libpff_io_handle_recover_data_blocks(
 
 							return( -1 );
 						}
-						data_block_offset = ( (libpff_offset_list_value_t *) unallocated_data_block_list_element->value )->offset;
-						data_block_size   = ( (libpff_offset_list_value_t *) unallocated_data_block_list_element->value )->size;
-
-						unallocated_data_block_list_element = unallocated_data_block_list_element->next_element;
-
 						unallocated_data_block_iterator++;
 					}
 					else
@@ -4345,13 +5360,18 @@ int libpff_io_handle_recover_data_blocks(
 					{
 						/* Retrieve the next unallocated data range
 						 */
-						if( unallocated_page_block_list_element == NULL )
+						if( libpff_offset_list_get_offset(
+						     unallocated_page_block_list,
+						     unallocated_page_block_iterator,
+						     &page_block_offset,
+						     &page_block_size,
+						     error ) != 1 )
 						{
 							libcerror_error_set(
 							 error,
 							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-							 "%s: corruption detected for unallocated page block list element: %d.",
+							 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+							 "%s: unable to retrieve unallocated page block list element: %d.",
 							 function,
 							 unallocated_page_block_iterator );
 
@@ -4360,26 +5380,6 @@ int libpff_io_handle_recover_data_blocks(
 
 							return( -1 );
 						}
-						if( unallocated_page_block_list_element->value == NULL )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-							 "%s: missing offset values for unallocate page block list element: %d.",
-							 function,
-							 unallocated_page_block_iterator );
-
-							memory_free(
-							 block_buffer );
-
-							return( -1 );
-						}
-						page_block_offset = ( (libpff_offset_list_value_t *) unallocated_page_block_list_element->value )->offset;
-						page_block_size   = ( (libpff_offset_list_value_t *) unallocated_page_block_list_element->value )->size;
-
-						unallocated_page_block_list_element = unallocated_page_block_list_element->next_element;
-
 						unallocated_page_block_iterator++;
 					}
 					else
@@ -4432,29 +5432,230 @@ int libpff_io_handle_recover_data_blocks(
 				block_offset  = ( ( block_offset / scan_block_size ) + 1 ) * scan_block_size;
 				block_size   -= block_size % scan_block_size;
 			}
+			if( block_offset < resume_offset )
+			{
+				if( (size64_t) ( resume_offset - block_offset ) >= block_size )
+				{
+					block_offset += block_size;
+					scanned_size += block_size;
+
+					continue;
+				}
+				scanned_size += resume_offset - block_offset;
+				block_size   -= resume_offset - block_offset;
+				block_offset  = resume_offset;
+			}
 			if( block_size < scan_block_size )
 			{
 				block_offset += block_size;
+				scanned_size += block_size;
 
 				continue;
 			}
+			range_size = block_size;
+
 			while( block_size >= scan_block_size )
 			{
+				if( ( block_offset % LIBPFF_IO_HANDLE_RECOVERY_SCAN_WINDOW_SIZE ) == 0 )
+				{
+					io_handle->recovery_progress->current_offset = block_offset;
+					io_handle->recovery_progress->bytes_scanned  = scanned_size + ( range_size - block_size );
+
+					if( libpff_io_handle_write_recovery_checkpoint(
+					     io_handle,
+					     LIBPFF_RECOVERY_STAGE_UNALLOCATED_SPACE,
+					     block_offset,
+					     recovery_flags,
+					     recovered_descriptor_index_values,
+					     recovered_offset_index_values,
+					     0,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_WRITE_FAILED,
+						 "%s: unable to write recovery checkpoint.",
+						 function );
+
+						memory_free(
+						 block_buffer );
+
+						return( -1 );
+					}
+					result = libpff_recovery_progress_report(
+					          io_handle->recovery_progress,
+					          0,
+					          error );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GENERIC,
+						 "%s: unable to report recovery progress.",
+						 function );
+
+						memory_free(
+						 block_buffer );
+
+						return( -1 );
+					}
+					else if( ( result == 0 )
+					      || ( io_handle->abort != 0 ) )
+					{
+						io_handle->abort = 1;
+
+						if( libpff_io_handle_write_recovery_checkpoint(
+						     io_handle,
+						     LIBPFF_RECOVERY_STAGE_UNALLOCATED_SPACE,
+						     block_offset,
+						     recovery_flags,
+						     recovered_descriptor_index_values,
+						     recovered_offset_index_values,
+						     1,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_IO,
+							 LIBCERROR_IO_ERROR_WRITE_FAILED,
+							 "%s: unable to write recovery checkpoint.",
+							 function );
+						}
+						memory_free(
+						 block_buffer );
+
+						return( -1 );
+					}
+				}
 				/* The index nodes are 512 bytes of size and 512 bytes aligned
 				 */
 				if( ( block_size >= 512 )
 				 && ( ( block_offset % 512 ) == 0 ) )
 				{
-					/* Scan for index values in the index node
+					/* Read the data ahead into the scan window so that the index node
+					 * candidates can be checked without a read per candidate
 					 */
-					result = libpff_io_handle_recover_index_values(
-						  io_handle,
-						  file_io_handle,
-						  unallocated_data_block_list,
-						  block_offset,
-						  recovery_flags,
-						  error );
+					if( ( block_offset < scan_window_offset )
+					 || ( ( block_offset + 512 ) > ( scan_window_offset + (off64_t) scan_window_size ) ) )
+					{
+						if( ( recovery_flags & LIBPFF_RECOVERY_FLAG_IGNORE_ALLOCATION_DATA ) == 0 )
+						{
+							read_size = LIBPFF_IO_HANDLE_RECOVERY_SCAN_WINDOW_SIZE;
 
+							if( (size64_t) read_size > block_size )
+							{
+								read_size = (size_t) block_size;
+							}
+						}
+						else
+						{
+							read_size = LIBPFF_IO_HANDLE_RECOVERY_SCAN_WINDOW_SIZE;
+
+							if( (size64_t) read_size > ( io_handle->file_size - block_offset ) )
+							{
+								read_size = (size_t) ( io_handle->file_size - block_offset );
+							}
+						}
+						scan_window_offset = block_offset;
+						scan_window_size   = 0;
+
+						if( libbfio_handle_seek_offset(
+						     file_io_handle,
+						     block_offset,
+						     SEEK_SET,
+						     error ) == -1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_IO,
+							 LIBCERROR_IO_ERROR_SEEK_FAILED,
+							 "%s: unable to seek scan window offset: %" PRIi64 ".",
+							 function,
+							 block_offset );
+
+							memory_free(
+							 block_buffer );
+
+							return( -1 );
+						}
+						read_count = libbfio_handle_read_buffer(
+						              file_io_handle,
+						              scan_window,
+						              read_size,
+						              error );
+
+						if( read_count == -1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_IO,
+							 LIBCERROR_IO_ERROR_READ_FAILED,
+							 "%s: unable to read scan window.",
+							 function );
+
+							memory_free(
+							 block_buffer );
+
+							return( -1 );
+						}
+						io_handle->statistics.number_of_bytes_read      += (uint64_t) read_count;
+						io_handle->statistics.number_of_read_operations += 1;
+						scan_window_size = (size_t) read_count;
+					}
+					number_of_scanned_index_nodes++;
+
+					/* Only read the index node if the index node type in the scan window matches
+					 */
+					if( ( block_offset + 512 ) <= ( scan_window_offset + (off64_t) scan_window_size ) )
+					{
+						result = libpff_index_node_check_type(
+						          &( scan_window[ block_offset - scan_window_offset ] ),
+						          512,
+						          io_handle->file_type,
+						          error );
+					}
+					else
+					{
+						result = 1;
+					}
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to determine if index node at offset: %" PRIi64 " is supported.",
+						 function,
+						 block_offset );
+
+						memory_free(
+						 block_buffer );
+
+						return( -1 );
+					}
+					else if( result == 0 )
+					{
+						number_of_rejected_index_nodes++;
+					}
+					else
+					{
+						io_handle->recovery_progress->number_of_candidates[ LIBPFF_RECOVERY_COUNTER_INDEX_NODES ] += 1;
+
+						/* Scan for index values in the index node
+						 */
+						result = libpff_io_handle_recover_index_values(
+							  io_handle,
+							  file_io_handle,
+							  unallocated_data_block_list,
+							  recovered_descriptor_index_values,
+							  recovered_offset_index_values,
+							  block_offset,
+							  recovery_flags,
+							  error );
+					}
 					if( result == -1 )
 					{
 						libcerror_error_set(
@@ -4472,6 +5673,8 @@ int libpff_io_handle_recover_data_blocks(
 					}
 					else if( result == 1 )
 					{
+						io_handle->recovery_progress->number_of_validated[ LIBPFF_RECOVERY_COUNTER_INDEX_NODES ] += 1;
+
 						block_offset += 512;
 						block_size   -= 512;
 
@@ -4553,197 +5756,151 @@ int libpff_io_handle_recover_data_blocks(
 
 						return( -1 );
 					}
+					io_handle->statistics.number_of_bytes_read      += (uint64_t) read_count;
+					io_handle->statistics.number_of_read_operations += 1;
 					block_buffer_size_available = read_size;
 				}
 				if( block_buffer_size_available >= 64 )
 				{
 					/* Scan the block for a data block footer
 					 */
-					data_block_footer = &( block_buffer[ block_buffer_offset ] );
+					data_block_footer  = &( block_buffer[ block_buffer_offset ] );
+					is_data_block      = 0;
+
+					number_of_scanned_data_block_positions++;
 
-					if( io_handle->file_type == LIBPFF_FILE_TYPE_32BIT )
+					/* Most of the unallocated space is empty, reject these positions
+					 * before the data block footer is parsed
+					 */
+					if( memory_compare(
+					     data_block_footer,
+					     libpff_io_handle_empty_block,
+					     64 ) == 0 )
 					{
-						data_block_footer += 64 - sizeof( pff_block_footer_32bit_t );
-
-						byte_stream_copy_to_uint16_little_endian(
-						 ( (pff_block_footer_32bit_t *) data_block_footer )->size,
-						 data_block_data_size );
-						byte_stream_copy_to_uint32_little_endian(
-						 ( (pff_block_footer_32bit_t *) data_block_footer )->back_pointer,
-						 data_block_back_pointer );
-						byte_stream_copy_to_uint32_little_endian(
-						 ( (pff_block_footer_32bit_t *) data_block_footer )->crc,
-						 data_block_stored_crc );
+						number_of_empty_data_block_positions++;
 					}
-					else if( io_handle->file_type == LIBPFF_FILE_TYPE_64BIT )
+					else
 					{
-						data_block_footer += 64 - sizeof( pff_block_footer_64bit_t );
-
-						byte_stream_copy_to_uint16_little_endian(
-						 ( (pff_block_footer_64bit_t *) data_block_footer )->size,
-						 data_block_data_size );
-						byte_stream_copy_to_uint32_little_endian(
-						 ( (pff_block_footer_64bit_t *) data_block_footer )->crc,
-						 data_block_stored_crc );
-						byte_stream_copy_to_uint64_little_endian(
-						 ( (pff_block_footer_64bit_t *) data_block_footer )->back_pointer,
-						 data_block_back_pointer );
+						if( io_handle->file_type == LIBPFF_FILE_TYPE_32BIT )
+						{
+							data_block_footer += 64 - sizeof( pff_block_footer_32bit_t );
+
+							byte_stream_copy_to_uint16_little_endian(
+							 ( (pff_block_footer_32bit_t *) data_block_footer )->size,
+							 data_block_data_size );
+							byte_stream_copy_to_uint32_little_endian(
+							 ( (pff_block_footer_32bit_t *) data_block_footer )->back_pointer,
+							 data_block_back_pointer );
+							byte_stream_copy_to_uint32_little_endian(
+							 ( (pff_block_footer_32bit_t *) data_block_footer )->crc,
+							 data_block_stored_crc );
+						}
+						else if( io_handle->file_type == LIBPFF_FILE_TYPE_64BIT )
+						{
+							data_block_footer += 64 - sizeof( pff_block_footer_64bit_t );
+
+							byte_stream_copy_to_uint16_little_endian(
+							 ( (pff_block_footer_64bit_t *) data_block_footer )->size,
+							 data_block_data_size );
+							byte_stream_copy_to_uint32_little_endian(
+							 ( (pff_block_footer_64bit_t *) data_block_footer )->crc,
+							 data_block_stored_crc );
+							byte_stream_copy_to_uint64_little_endian(
+							 ( (pff_block_footer_64bit_t *) data_block_footer )->back_pointer,
+							 data_block_back_pointer );
+						}
+						/* Check if back pointer itself is not empty but the upper 32-bit are
+						 * and if the data block data is stored in the block buffer
+						 */
+						if( ( data_block_back_pointer != 0 )
+						 && ( ( data_block_back_pointer >> 32 ) == 0 )
+						 && ( (size_t) data_block_data_size < read_size )
+						 && ( (size_t) ( ( data_block_data_size / 64 ) * 64 ) <= block_buffer_offset ) )
+						{
+							io_handle->recovery_progress->number_of_candidates[ LIBPFF_RECOVERY_COUNTER_DATA_BLOCKS ] += 1;
+
+							is_data_block = 1;
+						}
+						else
+						{
+							number_of_invalid_data_block_footers++;
+						}
 					}
-					/* Check if back pointer itself is not empty but the upper 32-bit are
-					 */
-					if( ( data_block_back_pointer != 0 )
-					 && ( ( data_block_back_pointer >> 32 ) == 0 ) )
+					if( ( is_data_block != 0 )
+					 && ( data_block_stored_crc != 0 ) )
 					{
 						data_block_data_offset = block_buffer_offset - ( ( data_block_data_size / 64 ) * 64 );
 
-						if( (size_t) data_block_data_size < read_size )
+						if( libfmapi_crc32_weak_calculate(
+						     &data_block_calculated_crc,
+						     &( block_buffer[ data_block_data_offset ] ),
+						     data_block_data_size,
+						     0,
+						     error ) != 1 )
 						{
-							/* Check for duplicates
-							 */
-							if( libpff_index_tree_get_number_of_leaf_nodes_by_identifier(
-							     io_handle->recovered_offset_index_tree,
-							     file_io_handle,
-							     io_handle->offset_index_tree_cache,
-							     data_block_back_pointer,
-							     &number_of_index_values,
-							     error ) != 1 )
-							{
-								libcerror_error_set(
-								 error,
-								 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-								 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-								 "%s: unable to retrieve number of recovered offset index values for identifier: %" PRIu64 ".",
-								 function,
-								 data_block_back_pointer );
-
-								memory_free(
-								 block_buffer );
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+							 "%s: unable to calculate CRC-32.",
+							 function );
 
-								return( -1 );
-							}
-							result = 0;
+							memory_free(
+							 block_buffer );
 
-							for( index_value_iterator = 0;
-							     index_value_iterator < number_of_index_values;
-							     index_value_iterator++ )
+							return( -1 );
+						}
+						io_handle->statistics.number_of_bytes_crc_checked += (uint64_t) data_block_data_size;
+						if( data_block_stored_crc != data_block_calculated_crc )
+						{
+#if defined( HAVE_DEBUG_OUTPUT )
+							if( libcnotify_verbose != 0 )
 							{
-								result = libpff_index_tree_get_value_by_identifier(
-									  io_handle->recovered_offset_index_tree,
-									  file_io_handle,
-									  io_handle->offset_index_tree_cache,
-									  data_block_back_pointer,
-									  index_value_iterator,
-									  &index_value,
-									  error );
-
-								if( result == -1 )
-								{
-									libcerror_error_set(
-									 error,
-									 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-									 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-									 "%s: unable to retrieve recovered offset index value for identifier: %" PRIu64 ".",
-									 function,
-									 data_block_back_pointer );
-
-									memory_free(
-									 block_buffer );
-
-									return( -1 );
-								}
-								else if( result != 0 )
-								{
-									if( ( (off64_t) ( block_buffer_data_offset + data_block_data_offset ) == index_value->file_offset )
-									 && ( (size32_t) data_block_data_size == index_value->data_size ) )
-									{
-										break;
-									}
-									result = 0;
-								}
+								libcnotify_printf(
+								 "%s: mismatch in data block: %" PRIu64 " CRC-32 ( %" PRIu32 " != %" PRIu32 " ).\n",
+								 function,
+								 data_block_back_pointer,
+								 data_block_stored_crc,
+								 data_block_calculated_crc );
 							}
-							if( result != 0 )
-							{
-#if defined( HAVE_DEBUG_OUTPUT )
-								if( libcnotify_verbose != 0 )
-								{
-									libcnotify_printf(
-									 "%s: recovered data block with identifier: %" PRIu64 " matches existing recovered item value.\n",
-									 function,
-									 data_block_back_pointer );
-								}
 #endif
-								block_offset += 64;
-								block_size   -= 64;
+							number_of_data_block_crc_mismatches++;
 
-								/* TODO reset block_buffer_offset and block_buffer_size_available ? */
+							is_data_block = 0;
+						}
+					}
+					if( is_data_block != 0 )
+					{
+						data_block_data_offset = block_buffer_offset - ( ( data_block_data_size / 64 ) * 64 );
 
-								continue;
-							}
-							if( data_block_stored_crc != 0 )
-							{
-								if( libfmapi_crc32_weak_calculate(
-								     &data_block_calculated_crc,
-								     &( block_buffer[ data_block_data_offset ] ),
-								     data_block_data_size,
-								     0,
-								     error ) != 1 )
-								{
-									libcerror_error_set(
-									 error,
-									 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-									 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-									 "%s: unable to calculate CRC-32.",
-									 function );
-
-									memory_free(
-									 block_buffer );
-
-									return( -1 );
-								}
-								if( data_block_stored_crc != data_block_calculated_crc )
-								{
-#if defined( HAVE_DEBUG_OUTPUT )
-									if( libcnotify_verbose != 0 )
-									{
-										libcnotify_printf(
-										 "%s: mismatch in data block: %" PRIu64 " CRC-32 ( %" PRIu32 " != %" PRIu32 " ).\n",
-										 function,
-										 data_block_back_pointer,
-										 data_block_stored_crc,
-										 data_block_calculated_crc );
-									}
-#endif
-									block_offset += 64;
-									block_size   -= 64;
+						number_of_data_block_candidates++;
 
-									continue;
-								}
-							}
-							/* TODO consider data block as fragment */
+						io_handle->recovery_progress->number_of_validated[ LIBPFF_RECOVERY_COUNTER_DATA_BLOCKS ] += 1;
 
-							data_block_data_size   = ( ( data_block_data_size / 64 ) + 1 ) * 64;
+						/* TODO consider data block as fragment */
+
+						data_block_data_size = ( ( data_block_data_size / 64 ) + 1 ) * 64;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-							if( libcnotify_verbose != 0 )
-							{
-								libcnotify_printf(
-								 "%s: data block back pointer: 0x%08" PRIx64 "\n",
-								 function,
-								 data_block_back_pointer );
+						if( libcnotify_verbose != 0 )
+						{
+							libcnotify_printf(
+							 "%s: data block back pointer: 0x%08" PRIx64 "\n",
+							 function,
+							 data_block_back_pointer );
 
-								libcnotify_printf(
-								 "%s: data block data at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIzd "\n",
-								 function,
-								 block_buffer_data_offset + data_block_data_offset,
-								 block_buffer_data_offset + data_block_data_offset,
-								 data_block_data_size );
-								libcnotify_print_data(
-								 &( block_buffer[ data_block_data_offset ] ),
-								 data_block_data_size,
-								 0 );
-							}
-#endif
+							libcnotify_printf(
+							 "%s: data block data at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIzd "\n",
+							 function,
+							 block_buffer_data_offset + data_block_data_offset,
+							 block_buffer_data_offset + data_block_data_offset,
+							 data_block_data_size );
+							libcnotify_print_data(
+							 &( block_buffer[ data_block_data_offset ] ),
+							 data_block_data_size,
+							 0 );
 						}
+#endif
 					}
 					block_buffer_offset         += 64;
 					block_buffer_size_available -= 64;
@@ -4756,8 +5913,32 @@ int libpff_io_handle_recover_data_blocks(
 				block_offset += scan_block_size;
 				block_size   -= scan_block_size;
 			}
+			scanned_size += range_size - block_size;
+		}
+	}
+	io_handle->recovery_progress->bytes_scanned = scanned_size;
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: number of index nodes\t\t: %" PRIu64 " scanned, %" PRIu64 " rejected by type\n",
+		 function,
+		 number_of_scanned_index_nodes,
+		 number_of_rejected_index_nodes );
+
+		if( ( recovery_flags & LIBPFF_RECOVERY_FLAG_SCAN_FOR_FRAGMENTS ) != 0 )
+		{
+			libcnotify_printf(
+			 "%s: number of data block positions\t: %" PRIu64 " scanned, %" PRIu64 " empty, %" PRIu64 " invalid footer, %" PRIu64 " CRC mismatch, %" PRIu64 " candidates\n",
+			 function,
+			 number_of_scanned_data_block_positions,
+			 number_of_empty_data_block_positions,
+			 number_of_invalid_data_block_footers,
+			 number_of_data_block_crc_mismatches,
+			 number_of_data_block_candidates );
 		}
 	}
+#endif
 	memory_free(
 	 block_buffer );
 
@@ -4771,6 +5952,8 @@ int libpff_io_handle_recover_index_values(
      libpff_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libpff_offset_list_t *unallocated_data_block_list,
+     libpff_recovered_index_values_t *recovered_descriptor_index_values,
+     libpff_recovered_index_values_t *recovered_offset_index_values,
      size64_t node_offset,
      uint8_t recovery_flags,
      libcerror_error_t **error )
@@ -4786,8 +5969,6 @@ int libpff_io_handle_recover_index_values(
 	uint64_t index_value_local_descriptors_identifier = 0;
 	uint16_t index_value_data_size                    = 0;
 	uint8_t entry_index                               = 0;
-	int index_value_iterator                          = 0;
-	int number_of_index_values                        = 0;
 	int result                                        = 0;
 
 	if( io_handle == NULL )
@@ -4819,6 +6000,8 @@ int libpff_io_handle_recover_index_values(
 	     file_io_handle,
 	     node_offset,
 	     ( (libpff_io_handle_t *) io_handle )->file_type,
+	     ( (libpff_io_handle_t *) io_handle )->buffer_pool,
+	     &( ( (libpff_io_handle_t *) io_handle )->statistics ),
 	     error ) != 1 )
 	{
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -5140,118 +6323,6 @@ int libpff_io_handle_recover_index_values(
 					}
 				}
 			}
-			/* Check for duplicates
-			 */
-			if( index_node->type == LIBPFF_INDEX_TYPE_DESCRIPTOR )
-			{
-				result = libpff_index_tree_get_number_of_leaf_nodes_by_identifier(
-					  io_handle->recovered_descriptor_index_tree,
-					  file_io_handle,
-					  io_handle->descriptor_index_tree_cache,
-					  index_value_identifier,
-					  &number_of_index_values,
-					  error );
-			}
-			else if( index_node->type == LIBPFF_INDEX_TYPE_OFFSET )
-			{
-				result = libpff_index_tree_get_number_of_leaf_nodes_by_identifier(
-					  io_handle->recovered_offset_index_tree,
-					  file_io_handle,
-					  io_handle->offset_index_tree_cache,
-					  index_value_identifier,
-					  &number_of_index_values,
-					  error );
-			}
-			if( result != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve number of recovered %s index values for identifier: %" PRIu64 ".",
-				 function,
-				 index_string,
-				 index_value_identifier );
-
-				return( -1 );
-			}
-			result = 0;
-
-			for( index_value_iterator = 0;
-			     index_value_iterator < number_of_index_values;
-			     index_value_iterator++ )
-			{
-				if( index_node->type == LIBPFF_INDEX_TYPE_DESCRIPTOR )
-				{
-					result = libpff_index_tree_get_value_by_identifier(
-						  io_handle->recovered_descriptor_index_tree,
-						  file_io_handle,
-						  io_handle->descriptor_index_tree_cache,
-						  index_value_identifier,
-						  index_value_iterator,
-						  &index_value,
-						  error );
-				}
-				else if( index_node->type == LIBPFF_INDEX_TYPE_OFFSET )
-				{
-					result = libpff_index_tree_get_value_by_identifier(
-						  io_handle->recovered_offset_index_tree,
-						  file_io_handle,
-						  io_handle->offset_index_tree_cache,
-						  index_value_identifier,
-						  index_value_iterator,
-						  &index_value,
-						  error );
-				}
-				if( result == -1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve recovered %s index value for identifier: %" PRIu64 ".",
-					 function,
-					 index_string,
-					 index_value_identifier );
-
-					return( -1 );
-				}
-				else if( result != 0 )
-				{
-					if( index_node->type == LIBPFF_INDEX_TYPE_DESCRIPTOR )
-					{
-						/* TODO what about parent changes ? */
-						if( ( index_value_data_identifier == index_value->data_identifier )
-						 && ( index_value_local_descriptors_identifier == index_value->local_descriptors_identifier ) )
-						{
-							break;
-						}
-					}
-					else if( index_node->type == LIBPFF_INDEX_TYPE_OFFSET )
-					{
-						if( ( index_value_file_offset == index_value->file_offset )
-						 && ( (size32_t) index_value_data_size == index_value->data_size ) )
-						{
-							break;
-						}
-					}
-					result = 0;
-				}
-			}
-			if( result != 0 )
-			{
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: recovered %s index value: %" PRIu64 " matches existing item value.\n",
-					 function,
-					 index_string,
-					 index_value_identifier );
-				}
-#endif
-				continue;
-			}
 			/* Check if the offset index value is unallocated according to the
 			 * unallocated data block list
 			 */
@@ -5310,7 +6381,8 @@ int libpff_io_handle_recover_index_values(
 				}
 #endif
 			}
-			/* Move the recovered node to the index
+			/* Add the recovered index value to the recovered values
+			 * duplicates are removed when the recovered index tree is built
 			 */
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
@@ -5325,22 +6397,22 @@ int libpff_io_handle_recover_index_values(
 #endif
 			if( index_node->type == LIBPFF_INDEX_TYPE_DESCRIPTOR )
 			{
-				result = libpff_index_tree_insert_value(
-					  io_handle->recovered_descriptor_index_tree,
-					  file_io_handle,
-					  io_handle->descriptor_index_tree_cache,
+				result = libpff_recovered_index_values_append_value(
+					  recovered_descriptor_index_values,
 					  index_value_identifier,
+					  index_value_data_identifier,
+					  index_value_local_descriptors_identifier,
 					  node_offset,
 				          (size64_t) entry_index,
 					  error );
 			}
 			else if( index_node->type == LIBPFF_INDEX_TYPE_OFFSET )
 			{
-				result = libpff_index_tree_insert_value(
-					  io_handle->recovered_offset_index_tree,
-					  file_io_handle,
-					  io_handle->offset_index_tree_cache,
+				result = libpff_recovered_index_values_append_value(
+					  recovered_offset_index_values,
 					  index_value_identifier,
+					  (uint64_t) index_value_file_offset,
+					  (uint64_t) index_value_data_size,
 					  node_offset,
 				          (size64_t) entry_index,
 					  error );
@@ -5351,7 +6423,7 @@ int libpff_io_handle_recover_index_values(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to insert %s index value: %" PRIu64 " to recovered index tree.",
+				 "%s: unable to append %s index value: %" PRIu64 " to recovered values.",
 				 function,
 				 index_string,
 				 index_value_identifier );
@@ -5484,6 +6556,8 @@ int libpff_io_handle_recover_local_descriptors(
 	     offset_index_value->file_offset,
 	     offset_index_value->data_size,
 	     ( (libpff_io_handle_t *) io_handle )->file_type,
+	     ( (libpff_io_handle_t *) io_handle )->buffer_pool,
+	     &( ( (libpff_io_handle_t *) io_handle )->statistics ),
 	     error ) != 1 )
 	{
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -25,13 +25,19 @@
 #include <common.h>
 #include <types.h>
 
+#include "libpff_buffer_pool.h"
 #include "libpff_index_value.h"
+#include "libpff_io_statistics.h"
 #include "libpff_libbfio.h"
 #include "libpff_libcerror.h"
 #include "libpff_libfcache.h"
 #include "libpff_libfdata.h"
 #include "libpff_list_type.h"
+#include "libpff_local_descriptor_node.h"
 #include "libpff_offset_list.h"
+#include "libpff_recovered_index_values.h"
+#include "libpff_recovery_checkpoint.h"
+#include "libpff_recovery_progress.h"
 #include "libpff_tree_type.h"
 
 #if defined( __cplusplus )
@@ -76,6 +82,32 @@ struct libpff_io_handle
 	 */
 	libfcache_cache_t *offset_index_tree_cache;
 
+	/* The local descriptor nodes cache
+	 * shared by the local descriptors of all the items
+	 */
+	libfcache_cache_t *local_descriptor_nodes_cache;
+
+	/* The item tables cache
+	 * shared by the item values of all the items
+	 */
+	libfcache_cache_t *item_tables_cache;
+
+	/* The buffer pool
+	 */
+	libpff_buffer_pool_t *buffer_pool;
+
+	/* The recovery progress
+	 */
+	libpff_recovery_progress_t *recovery_progress;
+
+	/* The recovery checkpoint
+	 */
+	libpff_recovery_checkpoint_t *recovery_checkpoint;
+
+	/* The IO statistics
+	 */
+	libpff_io_statistics_t statistics;
+
 	/* The file size
 	 */
 	size64_t file_size;
@@ -117,6 +149,10 @@ int libpff_io_handle_free(
      libpff_io_handle_t **io_handle,
      libcerror_error_t **error );
 
+int libpff_io_handle_clear_caches(
+     libpff_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
 int libpff_io_handle_read_file_header(
      libpff_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
@@ -165,6 +201,14 @@ int libpff_io_handle_read_local_descriptor_node(
      uint8_t read_flags,
      libcerror_error_t **error );
 
+int libpff_io_handle_get_local_descriptor_node(
+     libpff_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t node_offset,
+     size32_t node_size,
+     libpff_local_descriptor_node_t **local_descriptor_node,
+     libcerror_error_t **error );
+
 int libpff_io_handle_get_descriptor_index_value_by_identifier(
      libpff_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
@@ -222,9 +266,20 @@ int libpff_io_handle_recover_items(
      uint8_t recovery_flags,
      libcerror_error_t **error );
 
+int libpff_io_handle_write_recovery_checkpoint(
+     libpff_io_handle_t *io_handle,
+     uint8_t stage,
+     off64_t scan_offset,
+     uint8_t recovery_flags,
+     libpff_recovered_index_values_t *recovered_descriptor_index_values,
+     libpff_recovered_index_values_t *recovered_offset_index_values,
+     uint8_t force_write,
+     libcerror_error_t **error );
+
 int libpff_io_handle_recover_index_nodes(
      libpff_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
+     libpff_recovered_index_values_t *recovered_descriptor_index_values,
      libcerror_error_t **error );
 
 int libpff_io_handle_recover_data_blocks(
@@ -232,6 +287,8 @@ int libpff_io_handle_recover_data_blocks(
      libbfio_handle_t *file_io_handle,
      libpff_offset_list_t *unallocated_data_block_list,
      libpff_offset_list_t *unallocated_page_block_list,
+     libpff_recovered_index_values_t *recovered_descriptor_index_values,
+     libpff_recovered_index_values_t *recovered_offset_index_values,
      uint8_t recovery_flags,
      libcerror_error_t **error );
 
@@ -239,6 +296,8 @@ int libpff_io_handle_recover_index_values(
      libpff_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libpff_offset_list_t *unallocated_data_block_list,
+     libpff_recovered_index_values_t *recovered_descriptor_index_values,
+     libpff_recovered_index_values_t *recovered_offset_index_values,
      size64_t node_offset,
      uint8_t recovery_flags,
      libcerror_error_t **error );
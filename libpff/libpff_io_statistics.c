@@ -0,0 +1,229 @@
+/*
+ * IO statistics functions
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libpff_definitions.h"
+#include "libpff_io_statistics.h"
+#include "libpff_libcerror.h"
+#include "libpff_libfcache.h"
+
+/* Clears the IO statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_io_statistics_clear(
+     libpff_io_statistics_t *io_statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_io_statistics_clear";
+
+	if( io_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     io_statistics,
+	     0,
+	     sizeof( libpff_io_statistics_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear IO statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific statistic value
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_io_statistics_get_value(
+     libpff_io_statistics_t *io_statistics,
+     int statistic,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_io_statistics_get_value";
+
+	if( io_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	switch( statistic )
+	{
+		case LIBPFF_STATISTIC_NUMBER_OF_BYTES_READ:
+			*value = io_statistics->number_of_bytes_read;
+			break;
+
+		case LIBPFF_STATISTIC_NUMBER_OF_READ_OPERATIONS:
+			*value = io_statistics->number_of_read_operations;
+			break;
+
+		case LIBPFF_STATISTIC_NUMBER_OF_BYTES_DECRYPTED:
+			*value = io_statistics->number_of_bytes_decrypted;
+			break;
+
+		case LIBPFF_STATISTIC_NUMBER_OF_BYTES_CRC_CHECKED:
+			*value = io_statistics->number_of_bytes_crc_checked;
+			break;
+
+		case LIBPFF_STATISTIC_NUMBER_OF_BYTES_DECOMPRESSED:
+			*value = io_statistics->number_of_bytes_decompressed;
+			break;
+
+		case LIBPFF_STATISTIC_NUMBER_OF_TABLES_READ:
+			*value = io_statistics->number_of_tables_read;
+			break;
+
+		case LIBPFF_STATISTIC_NUMBER_OF_BUFFER_POOL_HITS:
+			*value = io_statistics->number_of_buffer_pool_hits;
+			break;
+
+		case LIBPFF_STATISTIC_NUMBER_OF_BUFFER_POOL_ALLOCATIONS:
+			*value = io_statistics->number_of_buffer_pool_allocations;
+			break;
+
+		case LIBPFF_STATISTIC_BUFFER_POOL_PEAK_USED_SIZE:
+			*value = io_statistics->buffer_pool_peak_used_size;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported statistic: %d.",
+			 function,
+			 statistic );
+
+			return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the statistic values of a specific cache
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_io_statistics_get_cache_values(
+     libpff_io_statistics_t *io_statistics,
+     int cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_io_statistics_get_cache_values";
+
+	if( io_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cache < 0 )
+	 || ( cache >= LIBPFF_STATISTICS_NUMBER_OF_CACHES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported cache: %d.",
+		 function,
+		 cache );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_evictions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of evictions.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_hits      = io_statistics->cache_statistics[ cache ].number_of_hits;
+	*number_of_misses    = io_statistics->cache_statistics[ cache ].number_of_misses;
+	*number_of_evictions = io_statistics->cache_statistics[ cache ].number_of_evictions;
+
+	return( 1 );
+}
+
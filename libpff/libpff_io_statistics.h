@@ -0,0 +1,105 @@
+/*
+ * IO statistics functions
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBPFF_IO_STATISTICS_H )
+#define _LIBPFF_IO_STATISTICS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libpff_definitions.h"
+#include "libpff_libcerror.h"
+#include "libpff_libfcache.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libpff_io_statistics libpff_io_statistics_t;
+
+struct libpff_io_statistics
+{
+	/* The number of bytes read
+	 */
+	uint64_t number_of_bytes_read;
+
+	/* The number of read operations
+	 */
+	uint64_t number_of_read_operations;
+
+	/* The number of bytes decrypted
+	 */
+	uint64_t number_of_bytes_decrypted;
+
+	/* The number of bytes of which the CRC was checked
+	 */
+	uint64_t number_of_bytes_crc_checked;
+
+	/* The number of (LZFu) decompressed bytes
+	 */
+	uint64_t number_of_bytes_decompressed;
+
+	/* The number of tables read
+	 */
+	uint64_t number_of_tables_read;
+
+	/* The number of buffers retrieved from the free buffers of the buffer pool
+	 */
+	uint64_t number_of_buffer_pool_hits;
+
+	/* The number of buffers the buffer pool needed to allocate
+	 */
+	uint64_t number_of_buffer_pool_allocations;
+
+	/* The peak size of the buffer pool buffers in use
+	 */
+	uint64_t buffer_pool_peak_used_size;
+
+	/* The cache statistics
+	 */
+	libfcache_cache_statistics_t cache_statistics[ LIBPFF_STATISTICS_NUMBER_OF_CACHES ];
+};
+
+int libpff_io_statistics_clear(
+     libpff_io_statistics_t *io_statistics,
+     libcerror_error_t **error );
+
+int libpff_io_statistics_get_value(
+     libpff_io_statistics_t *io_statistics,
+     int statistic,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+int libpff_io_statistics_get_cache_values(
+     libpff_io_statistics_t *io_statistics,
+     int cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -390,6 +390,22 @@ int libpff_item_free(
 				}
 			}
 		}
+		if( internal_item->rtf_body_stream != NULL )
+		{
+			if( libfmapi_lzfu_stream_free(
+			     &( internal_item->rtf_body_stream ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free RTF body stream.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( internal_item->embedded_object_data_reference != NULL )
 		{
 			if( libfdata_reference_free(
@@ -422,6 +438,38 @@ int libpff_item_free(
 				result = -1;
 			}
 		}
+		if( internal_item->attachment_data_reference != NULL )
+		{
+			if( libfdata_reference_free(
+			     &( internal_item->attachment_data_reference ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free attachment data reference.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_item->attachment_data_cache != NULL )
+		{
+			if( libfcache_cache_free(
+			     &( internal_item->attachment_data_cache ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free attachment data cache.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 internal_item );
 	}
@@ -512,6 +560,295 @@ int libpff_item_clone(
 	return( 1 );
 }
 
+/* The message classes that map to an item type
+ * The entries with a prefix match are tried in order after the exact matches
+ */
+static libpff_item_message_class_t libpff_item_message_classes[] = {
+	{ "IPM",						3,	LIBPFF_ITEM_TYPE_COMMON,		0 },
+	{ "IPM.FAX",						7,	LIBPFF_ITEM_TYPE_FAX,			0 },
+	{ "IPM.Note",						8,	LIBPFF_ITEM_TYPE_EMAIL,			0 },
+	{ "IPM.Post",						8,	LIBPFF_ITEM_TYPE_POSTING_NOTE,		0 },
+	{ "IPM.Task",						8,	LIBPFF_ITEM_TYPE_TASK,			0 },
+	{ "IPM.Contact",					11,	LIBPFF_ITEM_TYPE_CONTACT,		0 },
+	{ "IPM.Activity",					12,	LIBPFF_ITEM_TYPE_ACTIVITY,		0 },
+	{ "IPM.DistList",					12,	LIBPFF_ITEM_TYPE_DISTRIBUTION_LIST,	0 },
+	{ "IPM.Note.Fax",					12,	LIBPFF_ITEM_TYPE_FAX,			0 },
+	{ "IPM.Post.RSS",					12,	LIBPFF_ITEM_TYPE_RSS_FEED,		0 },
+	{ "IPM.StickyNote",					14,	LIBPFF_ITEM_TYPE_NOTE,			0 },
+	{ "IPM.Appointment",					15,	LIBPFF_ITEM_TYPE_APPOINTMENT,		0 },
+	{ "IPM.Note.Voicemail",					18,	LIBPFF_ITEM_TYPE_VOICEMAIL,		0 },
+	{ "IPM.Note.Mobile.SMS",				19,	LIBPFF_ITEM_TYPE_SMS,			0 },
+	{ "IPM.Note.Mobile.MMS",				19,	LIBPFF_ITEM_TYPE_MMS,			0 },
+	{ "IPM.Conflict.Message",				20,	LIBPFF_ITEM_TYPE_CONFLICT_MESSAGE,	0 },
+	{ "IPM.OLE.CLASS.{00061055-0000-0000-C000-000000000046}",	52,	LIBPFF_ITEM_TYPE_APPOINTMENT,		0 },
+	{ "IPM.Sharing",					11,	LIBPFF_ITEM_TYPE_SHARING,		1 },
+	{ "IPM.Document",					12,	LIBPFF_ITEM_TYPE_DOCUMENT,		1 },
+	{ "IPM.Note.SMIME",					14,	LIBPFF_ITEM_TYPE_EMAIL_SMIME,		1 },
+	{ "IPM.TaskRequest",					15,	LIBPFF_ITEM_TYPE_TASK_REQUEST,		1 },
+	{ "REPORT.IPM.Note",					15,	LIBPFF_ITEM_TYPE_EMAIL,			1 },
+	{ "IPM.Configuration",					17,	LIBPFF_ITEM_TYPE_CONFIGURATION,		1 },
+	{ "IPM.Schedule.Meeting",				20,	LIBPFF_ITEM_TYPE_MEETING,		1 },
+	{ "REPORT.IPM.Schedule.Meeting",			27,	LIBPFF_ITEM_TYPE_MEETING,		1 },
+
+	/* Consider any remaining IPM.Note as an e-mail
+	 * should catch IPM.Note.StorageQuotaWarning
+	 */
+	{ "IPM.Note.",						9,	LIBPFF_ITEM_TYPE_EMAIL,			1 },
+
+	{ NULL,							0,	LIBPFF_ITEM_TYPE_UNDEFINED,		0 } };
+
+/* Compares the start of a message class with a string case insensitive
+ * The message class is either a byte stream or an UTF-16 little-endian stream
+ * Returns 1 if the message class starts with the string, 0 if not
+ */
+int libpff_item_message_class_compare(
+     const uint8_t *message_class,
+     size_t message_class_length,
+     uint8_t character_size,
+     const char *string,
+     size_t string_length )
+{
+	size_t character_index   = 0;
+	uint16_t character       = 0;
+	uint8_t string_character = 0;
+
+	if( message_class_length < string_length )
+	{
+		return( 0 );
+	}
+	for( character_index = 0;
+	     character_index < string_length;
+	     character_index++ )
+	{
+		if( character_size == 2 )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( message_class[ character_index * 2 ] ),
+			 character );
+		}
+		else
+		{
+			character = message_class[ character_index ];
+		}
+		if( ( character >= (uint16_t) 'a' )
+		 && ( character <= (uint16_t) 'z' ) )
+		{
+			character -= (uint16_t) ( 'a' - 'A' );
+		}
+		string_character = (uint8_t) string[ character_index ];
+
+		if( ( string_character >= (uint8_t) 'a' )
+		 && ( string_character <= (uint8_t) 'z' ) )
+		{
+			string_character -= (uint8_t) ( 'a' - 'A' );
+		}
+		if( character != (uint16_t) string_character )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Determines the item type from the message class value data
+ * The message class is matched without converting it into an UTF-8 string
+ * The item type is set to undefined if the message class is not supported
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_item_get_type_from_message_class(
+     uint8_t *value_data,
+     size_t value_data_size,
+     uint8_t is_ascii_string,
+     uint32_t ascii_codepage,
+     uint8_t *item_type,
+     libcerror_error_t **error )
+{
+	uint8_t *message_class      = NULL;
+	uint8_t *utf8_string        = NULL;
+	static char *function       = "libpff_item_get_type_from_message_class";
+	size_t message_class_length = 0;
+	size_t utf8_string_size     = 0;
+	uint8_t character_size      = 1;
+	int message_class_index     = 0;
+	int result                  = 0;
+
+	if( item_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item type.",
+		 function );
+
+		return( -1 );
+	}
+	*item_type = LIBPFF_ITEM_TYPE_UNDEFINED;
+
+	/* Internally an empty string is represented by a NULL reference
+	 */
+	if( value_data == NULL )
+	{
+		return( 1 );
+	}
+	/* Codepage 1200 represents Unicode
+	 * If the codepage is 1200 find out if the string is encoded in UTF-8 or UTF-16 little-endian
+	 */
+	if( ( is_ascii_string != 0 )
+	 && ( ascii_codepage == 1200 ) )
+	{
+		result = libpff_value_type_string_contains_zero_bytes(
+			  value_data,
+			  value_data_size,
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if value type contains zero bytes.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			is_ascii_string = 0;
+		}
+	}
+	/* Codepage 65000 represents UTF-7 which can encode the ASCII characters
+	 * in multiple ways, hence the message class is converted into UTF-8 first
+	 */
+	if( ( is_ascii_string != 0 )
+	 && ( ascii_codepage == 65000 ) )
+	{
+		if( libpff_value_type_get_utf8_string_size(
+		     value_data,
+		     value_data_size,
+		     is_ascii_string,
+		     ascii_codepage,
+		     &utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string size.",
+			 function );
+
+			goto on_error;
+		}
+		if( utf8_string_size == 0 )
+		{
+			return( 1 );
+		}
+		utf8_string = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * utf8_string_size );
+
+		if( utf8_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-8 string.",
+			 function );
+
+			goto on_error;
+		}
+		if( libpff_value_type_copy_to_utf8_string(
+		     value_data,
+		     value_data_size,
+		     is_ascii_string,
+		     ascii_codepage,
+		     utf8_string,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_GENERIC,
+			 "%s: unable to set UTF-8 string.",
+			 function );
+
+			goto on_error;
+		}
+		message_class        = utf8_string;
+		message_class_length = utf8_string_size;
+	}
+	else
+	{
+		if( is_ascii_string == 0 )
+		{
+			character_size = 2;
+		}
+		message_class        = value_data;
+		message_class_length = value_data_size / character_size;
+	}
+	/* Ignore the end of string characters
+	 */
+	while( message_class_length > 0 )
+	{
+		if( character_size == 2 )
+		{
+			if( ( message_class[ ( message_class_length * 2 ) - 2 ] != 0 )
+			 || ( message_class[ ( message_class_length * 2 ) - 1 ] != 0 ) )
+			{
+				break;
+			}
+		}
+		else if( message_class[ message_class_length - 1 ] != 0 )
+		{
+			break;
+		}
+		message_class_length--;
+	}
+	/* The message classes are all ASCII, hence any non ASCII character
+	 * in the codepage encoded message class prevents a match
+	 */
+	for( message_class_index = 0;
+	     libpff_item_message_classes[ message_class_index ].string != NULL;
+	     message_class_index++ )
+	{
+		if( libpff_item_message_classes[ message_class_index ].match_prefix == 0 )
+		{
+			if( message_class_length != libpff_item_message_classes[ message_class_index ].length )
+			{
+				continue;
+			}
+		}
+		if( libpff_item_message_class_compare(
+		     message_class,
+		     message_class_length,
+		     character_size,
+		     libpff_item_message_classes[ message_class_index ].string,
+		     libpff_item_message_classes[ message_class_index ].length ) != 0 )
+		{
+			*item_type = libpff_item_message_classes[ message_class_index ].item_type;
+
+			break;
+		}
+	}
+	if( utf8_string != NULL )
+	{
+		memory_free(
+		 utf8_string );
+	}
+	return( 1 );
+
+on_error:
+	if( utf8_string != NULL )
+	{
+		memory_free(
+		 utf8_string );
+	}
+	return( -1 );
+}
+
 /* Determines the item type
  * Returns 1 if successful or -1 on error
  */
@@ -522,9 +859,7 @@ int libpff_item_determine_type(
 	libfcache_cache_t *value_data_cache        = NULL;
 	libfdata_reference_t *value_data_reference = NULL;
 	uint8_t *value_data                        = NULL;
-	char *item_type_string                     = NULL;
 	static char *function                      = "libpff_item_determine_type";
-	size_t item_type_string_size               = 0;
 	size_t value_data_size                     = 0;
 	uint32_t value_type                        = 0;
 	uint8_t is_ascii_string                    = 0;
@@ -589,390 +924,77 @@ int libpff_item_determine_type(
 		 "%s: unable to retrieve entry value.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	else if( result == 0 )
 	{
 		/* The item does not contain a message class and therefore is a folder
 		 */
 		internal_item->type = LIBPFF_ITEM_TYPE_FOLDER;
+
+		return( 1 );
 	}
-	else
+	if( ( value_type != LIBPFF_VALUE_TYPE_STRING_ASCII )
+	 && ( value_type != LIBPFF_VALUE_TYPE_STRING_UNICODE ) )
 	{
-		if( ( value_type != LIBPFF_VALUE_TYPE_STRING_ASCII )
-		 && ( value_type != LIBPFF_VALUE_TYPE_STRING_UNICODE ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported string value type: 0x%04" PRIx32 ".",
-			 function,
-			 value_type );
-
-			goto on_error;
-		}
-		if( value_type == LIBPFF_VALUE_TYPE_STRING_ASCII )
-		{
-			is_ascii_string = 1;
-		}
-		if( libfdata_reference_get_data(
-		     value_data_reference,
-		     internal_item->file_io_handle,
-		     value_data_cache,
-		     &value_data,
-		     &value_data_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value data reference data.",
-			 function );
-
-			goto on_error;
-		}
-		if( libpff_value_type_get_utf8_string_size(
-		     value_data,
-		     value_data_size,
-		     is_ascii_string,
-		     internal_item->internal_file->io_handle->ascii_codepage,
-		     &item_type_string_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve UTF-8 string size.",
-			 function );
-
-			goto on_error;
-		}
-		if( item_type_string_size > 0 )
-		{
-			item_type_string = libcstring_narrow_string_allocate(
-			                    item_type_string_size );
-
-			if( item_type_string == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create item type string.",
-				 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported string value type: 0x%04" PRIx32 ".",
+		 function,
+		 value_type );
 
-				goto on_error;
-			}
-			if( libpff_value_type_copy_to_utf8_string(
-			     value_data,
-			     value_data_size,
-			     is_ascii_string,
-			     internal_item->internal_file->io_handle->ascii_codepage,
-			     (uint8_t *) item_type_string,
-			     item_type_string_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-				 LIBCERROR_CONVERSION_ERROR_GENERIC,
-				 "%s: unable to set UTF-8 string.",
-				 function );
+		return( -1 );
+	}
+	if( value_type == LIBPFF_VALUE_TYPE_STRING_ASCII )
+	{
+		is_ascii_string = 1;
+	}
+	if( libfdata_reference_get_data(
+	     value_data_reference,
+	     internal_item->file_io_handle,
+	     value_data_cache,
+	     &value_data,
+	     &value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value data reference data.",
+		 function );
 
-				goto on_error;
-			}
-			if( item_type_string_size == 4 )
-			{
-				if( libcstring_narrow_string_compare_no_case(
-				     item_type_string,
-				     "IPM",
-				     3 ) == 0 )
-				{
-					internal_item->type = LIBPFF_ITEM_TYPE_COMMON;
-				}
-			}
-			else if( item_type_string_size == 8 )
-			{
-				if( libcstring_narrow_string_compare_no_case(
-				     item_type_string,
-				     "IPM.FAX",
-				     7 ) == 0 )
-				{
-					internal_item->type = LIBPFF_ITEM_TYPE_FAX;
-				}
-			}
-			else if( item_type_string_size == 9 )
-			{
-				if( libcstring_narrow_string_compare_no_case(
-				     item_type_string,
-				     "IPM.Note",
-				     8 ) == 0 )
-				{
-					internal_item->type = LIBPFF_ITEM_TYPE_EMAIL;
-				}
-				else if( libcstring_narrow_string_compare_no_case(
-					  item_type_string,
-					  "IPM.Post",
-					  8 ) == 0 )
-				{
-					internal_item->type = LIBPFF_ITEM_TYPE_POSTING_NOTE;
-				}
-				else if( libcstring_narrow_string_compare_no_case(
-					  item_type_string,
-					  "IPM.Task",
-					  8 ) == 0 )
-				{
-					internal_item->type = LIBPFF_ITEM_TYPE_TASK;
-				}
-			}
-			else if( item_type_string_size == 12 )
-			{
-				if( libcstring_narrow_string_compare_no_case(
-				     item_type_string,
-				     "IPM.Contact",
-				     11 ) == 0 )
-				{
-					internal_item->type = LIBPFF_ITEM_TYPE_CONTACT;
-				}
-			}
-			else if( item_type_string_size == 13 )
-			{
-				if( libcstring_narrow_string_compare_no_case(
-				     item_type_string,
-				     "IPM.Activity",
-				     12 ) == 0 )
-				{
-					internal_item->type = LIBPFF_ITEM_TYPE_ACTIVITY;
-				}
-				else if( libcstring_narrow_string_compare_no_case(
-					  item_type_string,
-					  "IPM.DistList",
-					  12 ) == 0 )
-				{
-					internal_item->type = LIBPFF_ITEM_TYPE_DISTRIBUTION_LIST;
-				}
-				else if( libcstring_narrow_string_compare_no_case(
-					  item_type_string,
-					  "IPM.Note.Fax",
-					  12 ) == 0 )
-				{
-					internal_item->type = LIBPFF_ITEM_TYPE_FAX;
-				}
-				else if( libcstring_narrow_string_compare_no_case(
-					  item_type_string,
-					  "IPM.Post.RSS",
-					  12 ) == 0 )
-				{
-					internal_item->type = LIBPFF_ITEM_TYPE_RSS_FEED;
-				}
-			}
-			else if( item_type_string_size == 15 )
-			{
-				if( libcstring_narrow_string_compare_no_case(
-				     item_type_string,
-				     "IPM.StickyNote",
-				     15 ) == 0 )
-				{
-					internal_item->type = LIBPFF_ITEM_TYPE_NOTE;
-				}
-			}
-			else if( item_type_string_size == 16 )
-			{
-				if( libcstring_narrow_string_compare_no_case(
-				     item_type_string,
-				     "IPM.Appointment",
-				     15 ) == 0 )
-				{
-					internal_item->type = LIBPFF_ITEM_TYPE_APPOINTMENT;
-				}
-			}
-			else if( item_type_string_size == 19 )
-			{
-				if( libcstring_narrow_string_compare_no_case(
-				     item_type_string,
-				     "IPM.Note.Voicemail",
-				     18 ) == 0 )
-				{
-					internal_item->type = LIBPFF_ITEM_TYPE_VOICEMAIL;
-				}
-			}
-			else if( item_type_string_size == 20 )
-			{
-				if( libcstring_narrow_string_compare_no_case(
-				     item_type_string,
-				     "IPM.Note.Mobile.SMS",
-				     19 ) == 0 )
-				{
-					internal_item->type = LIBPFF_ITEM_TYPE_SMS;
-				}
-				else if( libcstring_narrow_string_compare_no_case(
-					  item_type_string,
-					  "IPM.Note.Mobile.MMS",
-					  19 ) == 0 )
-				{
-					internal_item->type = LIBPFF_ITEM_TYPE_MMS;
-				}
-			}
-			else if( item_type_string_size == 21 )
-			{
-				if( libcstring_narrow_string_compare_no_case(
-				     item_type_string,
-				     "IPM.Conflict.Message",
-				     20 ) == 0 )
-				{
-					internal_item->type = LIBPFF_ITEM_TYPE_CONFLICT_MESSAGE;
-				}
-			}
-			else if( item_type_string_size == 53 )
-			{
-				if( libcstring_narrow_string_compare_no_case(
-				     item_type_string,
-				     "IPM.OLE.CLASS.{00061055-0000-0000-C000-000000000046}",
-				     52 ) == 0 )
-				{
-					internal_item->type = LIBPFF_ITEM_TYPE_APPOINTMENT;
-				}
-			}
-			if( internal_item->type == LIBPFF_ITEM_TYPE_UNDEFINED )
-			{
-				if( item_type_string_size >= 12 )
-				{
-					if( libcstring_narrow_string_compare_no_case(
-					     item_type_string,
-					     "IPM.Sharing",
-					     11 ) == 0 )
-					{
-						internal_item->type = LIBPFF_ITEM_TYPE_SHARING;
-					}
-				}
-			}
-			if( internal_item->type == LIBPFF_ITEM_TYPE_UNDEFINED )
-			{
-				if( item_type_string_size >= 13 )
-				{
-					if( libcstring_narrow_string_compare_no_case(
-					     item_type_string,
-					     "IPM.Document",
-					     12 ) == 0 )
-					{
-						internal_item->type = LIBPFF_ITEM_TYPE_DOCUMENT;
-					}
-				}
-			}
-			if( internal_item->type == LIBPFF_ITEM_TYPE_UNDEFINED )
-			{
-				if( item_type_string_size >= 15 )
-				{
-					if( libcstring_narrow_string_compare_no_case(
-					     item_type_string,
-					     "IPM.Note.SMIME",
-					     14 ) == 0 )
-					{
-						internal_item->type = LIBPFF_ITEM_TYPE_EMAIL_SMIME;
-					}
-				}
-			}
-			if( internal_item->type == LIBPFF_ITEM_TYPE_UNDEFINED )
-			{
-				if( item_type_string_size >= 16 )
-				{
-					if( libcstring_narrow_string_compare_no_case(
-					     item_type_string,
-					     "IPM.TaskRequest",
-					     15 ) == 0 )
-					{
-						internal_item->type = LIBPFF_ITEM_TYPE_TASK_REQUEST;
-					}
-					else if( libcstring_narrow_string_compare_no_case(
-						  item_type_string,
-						  "REPORT.IPM.Note",
-						  15 ) == 0 )
-					{
-						internal_item->type = LIBPFF_ITEM_TYPE_EMAIL;
-					}
-				}
-			}
-			if( internal_item->type == LIBPFF_ITEM_TYPE_UNDEFINED )
-			{
-				if( item_type_string_size >= 18 )
-				{
-					if( libcstring_narrow_string_compare_no_case(
-					     item_type_string,
-					     "IPM.Configuration",
-					     17 ) == 0 )
-					{
-						internal_item->type = LIBPFF_ITEM_TYPE_CONFIGURATION;
-					}
-				}
-			}
-			if( internal_item->type == LIBPFF_ITEM_TYPE_UNDEFINED )
-			{
-				if( item_type_string_size >= 21 )
-				{
-					if( libcstring_narrow_string_compare_no_case(
-					     item_type_string,
-					     "IPM.Schedule.Meeting",
-					     20 ) == 0 )
-					{
-						internal_item->type = LIBPFF_ITEM_TYPE_MEETING;
-					}
-				}
-			}
-			if( internal_item->type == LIBPFF_ITEM_TYPE_UNDEFINED )
-			{
-				if( item_type_string_size >= 28 )
-				{
-					if( libcstring_narrow_string_compare_no_case(
-					     item_type_string,
-					     "REPORT.IPM.Schedule.Meeting",
-					     27 ) == 0 )
-					{
-						internal_item->type = LIBPFF_ITEM_TYPE_MEETING;
-					}
-				}
-			}
-			if( internal_item->type == LIBPFF_ITEM_TYPE_UNDEFINED )
-			{
-				/* Consider any remaining IPM.Note as an e-mail
-				 * should catch IPM.Note.StorageQuotaWarning
-				 */
-				if( item_type_string_size >= 10 )
-				{
-					if( libcstring_narrow_string_compare_no_case(
-					     item_type_string,
-					     "IPM.Note.",
-					     9 ) == 0 )
-					{
-						internal_item->type = LIBPFF_ITEM_TYPE_EMAIL;
-					}
-				}
-			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( ( libcnotify_verbose != 0 )
-			 && ( internal_item->type == LIBPFF_ITEM_TYPE_UNDEFINED ) )
-			{
-				libcnotify_printf(
-				 "%s: unsupported item type: %s\n",
-				 function,
-				 item_type_string );
-			}
-#endif
-			memory_free(
-			 item_type_string );
-		}
+		return( -1 );
 	}
-	return( 1 );
+	if( libpff_item_get_type_from_message_class(
+	     value_data,
+	     value_data_size,
+	     is_ascii_string,
+	     internal_item->internal_file->io_handle->ascii_codepage,
+	     &( internal_item->type ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine item type from message class.",
+		 function );
 
-on_error:
-	if( item_type_string != NULL )
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( ( libcnotify_verbose != 0 )
+	 && ( internal_item->type == LIBPFF_ITEM_TYPE_UNDEFINED ) )
 	{
-		memory_free(
-		 item_type_string );
+		libcnotify_printf(
+		 "%s: unsupported item type.\n",
+		 function );
 	}
-	return( -1 );
+#endif
+	return( 1 );
 }
 
 /* Retrieves the identifier
@@ -1016,6 +1038,58 @@ int libpff_item_get_identifier(
 	return( 1 );
 }
 
+/* Retrieves the data identifier
+ * The data identifier changes when the data of the item is rewritten
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_item_get_data_identifier(
+     libpff_item_t *item,
+     uint64_t *data_identifier,
+     libcerror_error_t **error )
+{
+	libpff_internal_item_t *internal_item = NULL;
+	static char *function                 = "libpff_item_get_data_identifier";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libpff_internal_item_t *) item;
+
+	if( internal_item->item_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing item values.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data identifier.",
+		 function );
+
+		return( -1 );
+	}
+	*data_identifier = internal_item->item_values->data_identifier;
+
+	return( 1 );
+}
+
 /* Retrieves the number of sets values
  * Returns 1 if successful or -1 on error
  */
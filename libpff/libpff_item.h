@@ -33,6 +33,7 @@
 #include "libpff_libcerror.h"
 #include "libpff_libfcache.h"
 #include "libpff_libfdata.h"
+#include "libpff_libfmapi.h"
 #include "libpff_multi_value.h"
 #include "libpff_tree_type.h"
 #include "libpff_types.h"
@@ -49,6 +50,27 @@ extern "C" {
 
 #define LIBPFF_ITEM_NUMBER_OF_SUB_ITEMS			4
 
+typedef struct libpff_item_message_class libpff_item_message_class_t;
+
+struct libpff_item_message_class
+{
+	/* The message class string
+	 */
+	const char *string;
+
+	/* The message class string length
+	 */
+	size_t length;
+
+	/* The item type
+	 */
+	uint8_t item_type;
+
+	/* Value to indicate the message class string is matched as a prefix
+	 */
+	uint8_t match_prefix;
+};
+
 typedef struct libpff_internal_item libpff_internal_item_t;
 
 struct libpff_internal_item
@@ -96,6 +118,24 @@ struct libpff_internal_item
 	/* Embedded object data cache
 	 */
 	libfcache_cache_t *embedded_object_data_cache;
+
+	/* The attachment data reference
+	 * this is a clone of the attachment data object value reference
+	 * so that the item has its own read offset
+	 */
+	libfdata_reference_t *attachment_data_reference;
+
+	/* The attachment data cache
+	 */
+	libfcache_cache_t *attachment_data_cache;
+
+	/* The HTML body data offset
+	 */
+	off64_t html_body_offset;
+
+	/* The RTF body LZFu decompression stream
+	 */
+	libfmapi_lzfu_stream_t *rtf_body_stream;
 };
 
 int libpff_item_initialize(
@@ -118,6 +158,21 @@ int libpff_item_clone(
      libpff_item_t *source_item,
      libcerror_error_t **error );
 
+int libpff_item_message_class_compare(
+     const uint8_t *message_class,
+     size_t message_class_length,
+     uint8_t character_size,
+     const char *string,
+     size_t string_length );
+
+int libpff_item_get_type_from_message_class(
+     uint8_t *value_data,
+     size_t value_data_size,
+     uint8_t is_ascii_string,
+     uint32_t ascii_codepage,
+     uint8_t *item_type,
+     libcerror_error_t **error );
+
 int libpff_item_determine_type(
      libpff_internal_item_t *internal_item,
      libcerror_error_t **error );
@@ -128,6 +183,12 @@ int libpff_item_get_identifier(
      uint32_t *identifier,
      libcerror_error_t **error );
 
+LIBPFF_EXTERN \
+int libpff_item_get_data_identifier(
+     libpff_item_t *item,
+     uint64_t *data_identifier,
+     libcerror_error_t **error );
+
 LIBPFF_EXTERN \
 int libpff_item_get_number_of_sets(
      libpff_item_t *item,
@@ -204,6 +204,7 @@ int libpff_item_tree_get_sub_node_by_identifier(
 	libpff_tree_node_t *sub_tree_node         = NULL;
 	static char *function                     = "libpff_item_tree_get_sub_node_by_identifier";
 	int sub_node_iterator                     = 0;
+	int sub_node_index                        = 0;
 	int result                                = 0;
 
 	if( item_tree_node == NULL )
@@ -252,8 +253,20 @@ int libpff_item_tree_get_sub_node_by_identifier(
 	}
 	if( item_tree_node->number_of_sub_nodes > 0 )
 	{
-		sub_tree_node = item_tree_node->first_sub_node;
-
+		/* Start the search after the most recently retrieved sub node
+		 * the sub items are commonly retrieved in the order of the sub nodes
+		 */
+		if( ( item_tree_node->current_sub_node != NULL )
+		 && ( item_tree_node->current_sub_node->next_node != NULL ) )
+		{
+			sub_tree_node  = item_tree_node->current_sub_node->next_node;
+			sub_node_index = item_tree_node->current_sub_node_index + 1;
+		}
+		else
+		{
+			sub_tree_node  = item_tree_node->first_sub_node;
+			sub_node_index = 0;
+		}
 		for( sub_node_iterator = 0;
 		     sub_node_iterator < item_tree_node->number_of_sub_nodes;
 		     sub_node_iterator++ )
@@ -266,7 +279,7 @@ int libpff_item_tree_get_sub_node_by_identifier(
 				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
 				 "%s: corruption detected for sub node: %d.",
 				 function,
-				 sub_node_iterator );
+				 sub_node_index );
 
 				return( -1 );
 			}
@@ -278,7 +291,7 @@ int libpff_item_tree_get_sub_node_by_identifier(
 				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
 				 "%s: missing value for sub node: %d.",
 				 function,
-				 sub_node_iterator );
+				 sub_node_index );
 
 				return( -1 );
 			}
@@ -286,11 +299,24 @@ int libpff_item_tree_get_sub_node_by_identifier(
 
 			if( item_descriptor->descriptor_identifier == sub_node_identifier )
 			{
+				item_tree_node->current_sub_node       = sub_tree_node;
+				item_tree_node->current_sub_node_index = sub_node_index;
+
 				*sub_node = sub_tree_node;
 
 				return( 1 );
 			}
 			sub_tree_node = sub_tree_node->next_node;
+
+			sub_node_index++;
+
+			/* Wrap around to the first sub node
+			 */
+			if( sub_node_index >= item_tree_node->number_of_sub_nodes )
+			{
+				sub_tree_node  = item_tree_node->first_sub_node;
+				sub_node_index = 0;
+			}
 		}
 	}
 	return( result );
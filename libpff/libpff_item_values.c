@@ -147,7 +147,7 @@ int libpff_item_values_free(
 	{
 		if( ( *item_values )->table != NULL )
 		{
-			if( libpff_table_free(
+			if( libpff_table_release(
 			     &( ( *item_values )->table ),
 			     error ) != 1 )
 			{
@@ -155,7 +155,7 @@ int libpff_item_values_free(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free table.",
+				 "%s: unable to release table.",
 				 function );
 
 				result = -1;
@@ -231,6 +231,10 @@ int libpff_item_values_clone_copy(
 }
 
 /* Reads the item values for a specific descriptor
+ * The table is kept in the item tables cache of the IO handle, so that re-reading
+ * the item values of a recently used item does not read the table again
+ * On a cache hit the cached table is cloned, since the value data references
+ * and caches of the record entries hold a read offset that cannot be shared
  * Returns 1 if successful or -1 on error
  */
 int libpff_item_values_read(
@@ -241,7 +245,12 @@ int libpff_item_values_read(
      int debug_item_type,
      libcerror_error_t **error )
 {
-	static char *function = "libpff_item_values_read";
+	libfcache_cache_value_t *cache_value = NULL;
+	libpff_table_t *cached_table         = NULL;
+	static char *function                = "libpff_item_values_read";
+	int cache_entry_index                = 0;
+	int number_of_cache_entries          = 0;
+	uint8_t cache_hit                    = 0;
 
 	if( item_values == NULL )
 	{
@@ -265,6 +274,118 @@ int libpff_item_values_read(
 
 		return( -1 );
 	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* Recovered item values are not cached since their descriptor identifier
+	 * is not unique
+	 */
+	if( ( io_handle->item_tables_cache != NULL )
+	 && ( item_values->recovered == 0 ) )
+	{
+		if( libfcache_cache_get_number_of_entries(
+		     io_handle->item_tables_cache,
+		     &number_of_cache_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of cache entries.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( number_of_cache_entries > 0 )
+	{
+		/* The lower 5 bits of the descriptor identifier contain the node identifier type
+		 */
+		cache_entry_index = (int) ( ( item_values->descriptor_identifier >> 5 ) % number_of_cache_entries );
+
+		if( libfcache_cache_get_value_by_index(
+		     io_handle->item_tables_cache,
+		     cache_entry_index,
+		     &cache_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache entry: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		if( cache_value != NULL )
+		{
+			if( libfcache_cache_value_get_value(
+			     cache_value,
+			     (intptr_t **) &cached_table,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve table from cache value.",
+				 function );
+
+				return( -1 );
+			}
+			if( ( cached_table != NULL )
+			 && ( cached_table->descriptor_identifier == item_values->descriptor_identifier )
+			 && ( cached_table->data_identifier == item_values->data_identifier )
+			 && ( cached_table->local_descriptors_identifier == item_values->local_descriptors_identifier )
+			 && ( cached_table->recovered == 0 ) )
+			{
+				cache_hit = 1;
+			}
+		}
+		if( libfcache_cache_update_statistics(
+		     io_handle->item_tables_cache,
+		     cache_hit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update cache statistics.",
+			 function );
+
+			return( -1 );
+		}
+		if( cache_hit != 0 )
+		{
+			if( libpff_table_clone(
+			     &( item_values->table ),
+			     cached_table,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to clone cached table.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+	}
 	if( libpff_table_initialize(
 	     &( item_values->table ),
 	     item_values->descriptor_identifier,
@@ -297,13 +418,65 @@ int libpff_item_values_read(
 		 "%s: unable to read table.",
 		 function );
 
-		libpff_table_free(
-		 &( item_values->table ),
-		 NULL );
+		goto on_error;
+	}
+	if( number_of_cache_entries > 0 )
+	{
+		/* The cache holds its own reference to the table which is released
+		 * when the cache value is replaced
+		 */
+		if( libpff_table_add_reference(
+		     item_values->table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add reference to table.",
+			 function );
 
-		return( -1 );
+			goto on_error;
+		}
+		if( libfcache_cache_set_value_by_index(
+		     io_handle->item_tables_cache,
+		     cache_entry_index,
+		     (off64_t) item_values->descriptor_identifier,
+		     0,
+		     (intptr_t *) item_values->table,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libpff_table_release,
+		     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set table in cache entry: %d.",
+			 function,
+			 cache_entry_index );
+
+			/* Release the reference of the cache
+			 */
+			cached_table = item_values->table;
+
+			libpff_table_release(
+			 &cached_table,
+			 NULL );
+
+			goto on_error;
+		}
 	}
 	return( 1 );
+
+on_error:
+	if( item_values->table != NULL )
+	{
+		libpff_table_release(
+		 &( item_values->table ),
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Retrieves the local descriptor value for the specific identifier
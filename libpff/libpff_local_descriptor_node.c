@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libpff_buffer_pool.h"
 #include "libpff_definitions.h"
 #include "libpff_libbfio.h"
 #include "libpff_libcerror.h"
@@ -113,6 +114,7 @@ int libpff_local_descriptor_node_free(
      libcerror_error_t **error )
 {
 	static char *function = "libpff_local_descriptor_node_free";
+	int result            = 1;
 
 	if( local_descriptor_node == NULL )
 	{
@@ -129,15 +131,36 @@ int libpff_local_descriptor_node_free(
 	{
 		if( ( *local_descriptor_node )->data != NULL )
 		{
-			memory_free(
-			 ( *local_descriptor_node )->data );
+			if( ( *local_descriptor_node )->buffer_pool != NULL )
+			{
+				if( libpff_buffer_pool_release_buffer(
+				     ( *local_descriptor_node )->buffer_pool,
+				     &( ( *local_descriptor_node )->data ),
+				     ( *local_descriptor_node )->data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to release local descriptor node data.",
+					 function );
+
+					result = -1;
+				}
+			}
+			else
+			{
+				memory_free(
+				 ( *local_descriptor_node )->data );
+			}
 		}
 		memory_free(
 		 *local_descriptor_node );
 
 		*local_descriptor_node = NULL;
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Retrieves the data of a specific entry
@@ -212,6 +235,8 @@ int libpff_local_descriptor_node_read(
      off64_t node_offset,
      size32_t node_size,
      uint8_t file_type,
+     libpff_buffer_pool_t *buffer_pool,
+     libpff_io_statistics_t *io_statistics,
      libcerror_error_t **error )
 {
 	uint8_t *local_descriptor_node_data       = NULL;
@@ -284,19 +309,41 @@ int libpff_local_descriptor_node_read(
 	}
 	local_descriptor_node->data_size = (size_t) node_size;
 
-	local_descriptor_node->data = (uint8_t *) memory_allocate(
-	                                           sizeof( uint8_t ) * local_descriptor_node->data_size );
+	if( buffer_pool != NULL )
+	{
+		if( libpff_buffer_pool_get_buffer(
+		     buffer_pool,
+		     local_descriptor_node->data_size,
+		     &( local_descriptor_node->data ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve local descriptor node data from buffer pool.",
+			 function );
 
-	if( local_descriptor_node->data == NULL )
+			return( -1 );
+		}
+		local_descriptor_node->buffer_pool = buffer_pool;
+	}
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create local descriptor node data.",
-		 function );
+		local_descriptor_node->data = (uint8_t *) memory_allocate(
+		                                           sizeof( uint8_t ) * local_descriptor_node->data_size );
 
-		return( -1 );
+		if( local_descriptor_node->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create local descriptor node data.",
+			 function );
+
+			return( -1 );
+		}
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -341,6 +388,11 @@ int libpff_local_descriptor_node_read(
 
 		return( -1 );
 	}
+	if( io_statistics != NULL )
+	{
+		io_statistics->number_of_bytes_read      += (uint64_t) read_count;
+		io_statistics->number_of_read_operations += 1;
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -25,6 +25,8 @@
 #include <common.h>
 #include <types.h>
 
+#include "libpff_buffer_pool.h"
+#include "libpff_io_statistics.h"
 #include "libpff_libbfio.h"
 #include "libpff_libcerror.h"
 
@@ -63,6 +65,10 @@ struct libpff_local_descriptor_node
 	/* The maximum entries data size
 	 */
 	uint16_t maximum_entries_data_size;
+
+	/* The buffer pool the node data was retrieved from
+	 */
+	libpff_buffer_pool_t *buffer_pool;
 };
 
 int libpff_local_descriptor_node_initialize(
@@ -85,6 +91,8 @@ int libpff_local_descriptor_node_read(
      off64_t node_offset,
      size32_t node_size,
      uint8_t file_type,
+     libpff_buffer_pool_t *buffer_pool,
+     libpff_io_statistics_t *io_statistics,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
@@ -136,20 +136,6 @@ int libpff_local_descriptors_initialize(
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
-	     &( ( *local_descriptors )->local_descriptor_nodes_cache ),
-	     LIBPFF_MAXIMUM_CACHE_ENTRIES_LOCAL_DESCRIPTORS_NODES,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create local descriptor nodes cache.",
-		 function );
-
-		goto on_error;
-	}
 	if( libfdata_list_append_element(
 	     ( *local_descriptors )->local_descriptor_nodes_list,
 	     &element_index,
@@ -177,12 +163,6 @@ int libpff_local_descriptors_initialize(
 on_error:
 	if( *local_descriptors != NULL )
 	{
-		if( ( *local_descriptors )->local_descriptor_nodes_cache != NULL )
-		{
-			libfcache_cache_free(
-			 &( ( *local_descriptors )->local_descriptor_nodes_cache ),
-			 NULL );
-		}
 		if( ( *local_descriptors )->local_descriptor_nodes_list != NULL )
 		{
 			libfdata_list_free(
@@ -233,19 +213,6 @@ int libpff_local_descriptors_free(
 
 			result = -1;
 		}
-		if( libfcache_cache_free(
-		     &( ( *local_descriptors )->local_descriptor_nodes_cache ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free local descriptor nodes cache.",
-			 function );
-
-			result = -1;
-		}
 		memory_free(
 		 *local_descriptors );
 
@@ -328,8 +295,11 @@ int libpff_local_descriptors_read_node(
 	libpff_local_descriptor_node_t *local_descriptor_node       = NULL;
 	uint8_t *node_entry_data                                    = NULL;
 	static char *function                                       = "libpff_local_descriptors_read_node";
+	off64_t local_descriptor_node_offset                        = 0;
 	off64_t node_data_offset                                    = 0;
+	size64_t local_descriptor_node_size                         = 0;
 	uint64_t local_descriptor_sub_node_identifier               = 0;
+	uint32_t local_descriptor_node_flags                        = 0;
 	uint16_t entry_index                                        = 0;
 	int element_index                                           = 0;
 	int local_descriptor_node_list_element_index                = 0;
@@ -384,12 +354,43 @@ int libpff_local_descriptors_read_node(
 
 		return( -1 );
 	}
-	if( libfdata_list_element_get_element_value(
+	if( libfdata_list_element_get_data_range(
 	     local_descriptor_node_list_element,
+	     &local_descriptor_node_offset,
+	     &local_descriptor_node_size,
+	     &local_descriptor_node_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve local descriptor node list element at offset: %" PRIi64 " data range.",
+		 function,
+		 node_offset );
+
+		return( -1 );
+	}
+	if( local_descriptor_node_size > (size64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: local descriptor node size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The local descriptor nodes are cached by the IO handle
+	 * so that they are shared between the items
+	 */
+	if( libpff_io_handle_get_local_descriptor_node(
+	     local_descriptors->io_handle,
 	     file_io_handle,
-	     local_descriptors->local_descriptor_nodes_cache,
-	     (intptr_t **) &local_descriptor_node,
-	     0,
+	     local_descriptor_node_offset,
+	     (size32_t) local_descriptor_node_size,
+	     &local_descriptor_node,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -585,6 +586,9 @@ int libpff_local_descriptors_read_node_entry(
 	libpff_local_descriptor_node_t *local_descriptor_node       = NULL;
 	uint8_t *node_entry_data                                    = NULL;
 	static char *function                                       = "libpff_local_descriptors_read_node_entry";
+	off64_t local_descriptor_node_offset                        = 0;
+	size64_t local_descriptor_node_size                         = 0;
+	uint32_t local_descriptor_node_flags                        = 0;
 	int local_descriptor_node_list_element_index                = 0;
 
 	if( local_descriptors == NULL )
@@ -649,12 +653,43 @@ int libpff_local_descriptors_read_node_entry(
 
 		return( -1 );
 	}
-	if( libfdata_list_element_get_element_value(
+	if( libfdata_list_element_get_data_range(
 	     local_descriptor_node_list_element,
+	     &local_descriptor_node_offset,
+	     &local_descriptor_node_size,
+	     &local_descriptor_node_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve local descriptor node list element at offset: %" PRIi64 " data range.",
+		 function,
+		 node_offset );
+
+		return( -1 );
+	}
+	if( local_descriptor_node_size > (size64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: local descriptor node size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The local descriptor nodes are cached by the IO handle
+	 * so that they are shared between the items
+	 */
+	if( libpff_io_handle_get_local_descriptor_node(
+	     local_descriptors->io_handle,
 	     file_io_handle,
-	     local_descriptors->local_descriptor_nodes_cache,
-	     (intptr_t **) &local_descriptor_node,
-	     0,
+	     local_descriptor_node_offset,
+	     (size32_t) local_descriptor_node_size,
+	     &local_descriptor_node,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
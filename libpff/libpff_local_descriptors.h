@@ -45,13 +45,10 @@ struct libpff_local_descriptors
 	libpff_io_handle_t *io_handle;
 
 	/* The local descriptor nodes list
+	 * the nodes are cached by the IO handle
 	 */
 	libfdata_list_t *local_descriptor_nodes_list;
 
-	/* The local descriptor nodes cache
-	 */
-	libfcache_cache_t *local_descriptor_nodes_cache;
-
 	/* The root node offset
 	 */
 	off64_t root_node_offset;
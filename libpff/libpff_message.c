@@ -2446,6 +2446,7 @@ int libpff_message_get_plain_text_body(
 
 /* Retrieves the RTF message body size
  * Size includes the end of string character
+ * The size is determined from the LZFu header without decompressing the body
  * Returns 1 if successful, 0 if the item does not contain such value or -1 on error
  */
 int libpff_message_get_rtf_body_size(
@@ -2453,10 +2454,16 @@ int libpff_message_get_rtf_body_size(
      size_t *size,
      libcerror_error_t **error )
 {
-	uint8_t *value_data   = NULL;
-	static char *function = "libpff_message_get_rtf_body_size";
-	uint32_t value_type   = LIBPFF_VALUE_TYPE_BINARY_DATA;
-	int result            = 0;
+	libfmapi_lzfu_header_t lzfu_header;
+	uint8_t lzfu_header_data[ sizeof( libfmapi_lzfu_header_t ) ];
+
+	libfcache_cache_t *value_data_cache        = NULL;
+	libfdata_reference_t *value_data_reference = NULL;
+	libpff_internal_item_t *internal_item      = NULL;
+	static char *function                      = "libpff_message_get_rtf_body_size";
+	size64_t value_data_size                   = 0;
+	uint32_t value_type                        = LIBPFF_VALUE_TYPE_BINARY_DATA;
+	int result                                 = 0;
 
 	if( message == NULL )
 	{
@@ -2469,6 +2476,8 @@ int libpff_message_get_rtf_body_size(
 
 		return( -1 );
 	}
+	internal_item = (libpff_internal_item_t *) message;
+
 	if( size == NULL )
 	{
 		libcerror_error_set(
@@ -2480,14 +2489,13 @@ int libpff_message_get_rtf_body_size(
 
 		return( -1 );
 	}
-	result = libpff_item_get_entry_value(
-		  message,
-		  0,
-		  LIBPFF_ENTRY_TYPE_MESSAGE_BODY_COMPRESSED_RTF,
-		  &value_type,
-		  &value_data,
-		  size,
-		  0,
+	result = libpff_message_get_body_reference(
+	          internal_item,
+	          LIBPFF_ENTRY_TYPE_MESSAGE_BODY_COMPRESSED_RTF,
+	          &value_type,
+	          0,
+	          &value_data_reference,
+	          &value_data_cache,
 	          error );
 
 	if( result == -1 )
@@ -2505,15 +2513,60 @@ int libpff_message_get_rtf_body_size(
 	{
 		return( 0 );
 	}
-	if( value_data == NULL )
+	if( libfdata_reference_get_size(
+	     value_data_reference,
+	     &value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size == 0 )
 	{
 		*size = 0;
+
+		return( 1 );
+	}
+	if( value_data_size < (size64_t) sizeof( libfmapi_lzfu_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: value data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_message_read_body_data_at_offset(
+	     internal_item,
+	     value_data_reference,
+	     value_data_cache,
+	     0,
+	     lzfu_header_data,
+	     sizeof( libfmapi_lzfu_header_t ),
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read LZFu header data.",
+		 function );
+
+		return( -1 );
 	}
-	else if( libfmapi_lzfu_get_uncompressed_data_size(
-	          value_data,
-	          *size,
-	          size,
-	          error ) != 1 )
+	if( libfmapi_lzfu_read_header(
+	     &lzfu_header,
+	     lzfu_header_data,
+	     sizeof( libfmapi_lzfu_header_t ),
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -2524,6 +2577,25 @@ int libpff_message_get_rtf_body_size(
 
 		return( -1 );
 	}
+	/* The compressed data size includes 12 bytes of the header
+	 */
+	if( (size64_t) ( lzfu_header.compressed_data_size - 12 ) != ( value_data_size - sizeof( libfmapi_lzfu_header_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: mismatch in compressed data size (%" PRIu32 " != %" PRIu64 ").",
+		 function,
+		 lzfu_header.compressed_data_size - 12,
+		 value_data_size - sizeof( libfmapi_lzfu_header_t ) );
+
+		return( -1 );
+	}
+	/* Compensate for the 2 trailing zero bytes
+	 */
+	*size = (size_t) lzfu_header.uncompressed_data_size + 2;
+
 	return( 1 );
 }
 
@@ -2538,11 +2610,12 @@ int libpff_message_get_rtf_body(
      size_t size,
      libcerror_error_t **error )
 {
-	uint8_t *value_data    = NULL;
-	static char *function  = "libpff_message_get_rtf_body";
-	size_t value_data_size = 0;
-	uint32_t value_type    = LIBPFF_VALUE_TYPE_BINARY_DATA;
-	int result             = 0;
+	libpff_internal_item_t *internal_item = NULL;
+	uint8_t *value_data                   = NULL;
+	static char *function                 = "libpff_message_get_rtf_body";
+	size_t value_data_size                = 0;
+	uint32_t value_type                   = LIBPFF_VALUE_TYPE_BINARY_DATA;
+	int result                            = 0;
 
 	if( message == NULL )
 	{
@@ -2607,11 +2680,19 @@ int libpff_message_get_rtf_body(
 
 		return( -1 );
 	}
+	internal_item = (libpff_internal_item_t *) message;
+
+	if( ( internal_item->internal_file != NULL )
+	 && ( internal_item->internal_file->io_handle != NULL ) )
+	{
+		internal_item->internal_file->io_handle->statistics.number_of_bytes_decompressed += (uint64_t) size;
+	}
 	return( 1 );
 }
 
 /* Retrieves the HTML message body size
  * Size includes the end of string character
+ * Only the trailing bytes of the body are read to determine the end of string character
  * Returns 1 if successful, 0 if the item does not contain such value or -1 on error
  */
 int libpff_message_get_html_body_size(
@@ -2619,12 +2700,16 @@ int libpff_message_get_html_body_size(
      size_t *size,
      libcerror_error_t **error )
 {
-	libpff_internal_item_t *internal_item = NULL;
-	uint8_t *value_data                   = NULL;
-	static char *function                 = "libpff_message_get_html_body_size";
-	size_t value_data_size                = 0;
-	uint32_t value_type                   = 0;
-	int result                            = 0;
+	uint8_t trailing_data[ 2 ];
+
+	libfcache_cache_t *value_data_cache        = NULL;
+	libfdata_reference_t *value_data_reference = NULL;
+	libpff_internal_item_t *internal_item      = NULL;
+	static char *function                      = "libpff_message_get_html_body_size";
+	size64_t value_data_size                   = 0;
+	size_t trailing_data_size                  = 0;
+	uint32_t value_type                        = 0;
+	int result                                 = 0;
 
 	if( message == NULL )
 	{
@@ -2661,14 +2746,13 @@ int libpff_message_get_html_body_size(
 
 		return( -1 );
 	}
-	result = libpff_item_get_entry_value(
-		  message,
-		  0,
-		  LIBPFF_ENTRY_TYPE_MESSAGE_BODY_HTML,
-		  &value_type,
-		  &value_data,
-		  &value_data_size,
-		  1,
+	result = libpff_message_get_body_reference(
+	          internal_item,
+	          LIBPFF_ENTRY_TYPE_MESSAGE_BODY_HTML,
+	          &value_type,
+	          LIBPFF_ENTRY_VALUE_FLAG_MATCH_ANY_VALUE_TYPE,
+	          &value_data_reference,
+	          &value_data_cache,
 	          error );
 
 	if( result == -1 )
@@ -2686,45 +2770,38 @@ int libpff_message_get_html_body_size(
 	{
 		return( 0 );
 	}
-	if( value_data == NULL )
-	{
-		return( 0 );
-	}
-	if( value_type == LIBPFF_VALUE_TYPE_STRING_ASCII )
+	if( libfdata_reference_get_size(
+	     value_data_reference,
+	     &value_data_size,
+	     error ) != 1 )
 	{
-		*size = value_data_size;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value data size.",
+		 function );
 
-		if( value_data[ value_data_size - 1 ] != 0 )
-		{
-			/* Add the end of string byte
-			 */
-			*size += 1;
-		}
+		return( -1 );
 	}
-	else if( value_type == LIBPFF_VALUE_TYPE_STRING_UNICODE )
+	if( value_data_size == 0 )
 	{
-		*size = value_data_size;
-
-		if( ( value_data[ value_data_size - 1 ] != 0 )
-		 || ( value_data[ value_data_size - 2 ] != 0 ) )
-		{
-			/* Add the end of string byte
-			 */
-			*size += 2;
-		}
+		return( 0 );
 	}
-	else if( value_type == LIBPFF_VALUE_TYPE_BINARY_DATA )
+	if( value_data_size > (size64_t) SSIZE_MAX )
 	{
-		*size = value_data_size;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: value data size value exceeds maximum.",
+		 function );
 
-		if( value_data[ value_data_size - 1 ] != 0 )
-		{
-			/* Add the end of string byte
-			 */
-			*size += 1;
-		}
+		return( -1 );
 	}
-	else
+	if( ( value_type != LIBPFF_VALUE_TYPE_STRING_ASCII )
+	 && ( value_type != LIBPFF_VALUE_TYPE_STRING_UNICODE )
+	 && ( value_type != LIBPFF_VALUE_TYPE_BINARY_DATA ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -2736,6 +2813,50 @@ int libpff_message_get_html_body_size(
 
 		return( -1 );
 	}
+	trailing_data_size = 2;
+
+	if( value_data_size < 2 )
+	{
+		trailing_data_size = 1;
+	}
+	trailing_data[ 0 ] = 0xff;
+
+	if( libpff_message_read_body_data_at_offset(
+	     internal_item,
+	     value_data_reference,
+	     value_data_cache,
+	     (off64_t) ( value_data_size - trailing_data_size ),
+	     &( trailing_data[ 2 - trailing_data_size ] ),
+	     trailing_data_size,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read trailing value data.",
+		 function );
+
+		return( -1 );
+	}
+	*size = (size_t) value_data_size;
+
+	if( value_type == LIBPFF_VALUE_TYPE_STRING_UNICODE )
+	{
+		if( ( trailing_data[ 1 ] != 0 )
+		 || ( trailing_data[ 0 ] != 0 ) )
+		{
+			/* Add the end of string byte
+			 */
+			*size += 2;
+		}
+	}
+	else if( trailing_data[ 1 ] != 0 )
+	{
+		/* Add the end of string byte
+		 */
+		*size += 1;
+	}
 	return( 1 );
 }
 
@@ -2921,3 +3042,834 @@ int libpff_message_get_html_body(
 	return( 1 );
 }
 
+/* Retrieves the data reference of a message body value
+ * Returns 1 if successful, 0 if the item does not contain such value or -1 on error
+ */
+int libpff_message_get_body_reference(
+     libpff_internal_item_t *internal_item,
+     uint32_t entry_type,
+     uint32_t *value_type,
+     uint8_t flags,
+     libfdata_reference_t **value_data_reference,
+     libfcache_cache_t **value_data_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_message_get_body_reference";
+	int result            = 0;
+
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal item.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal item - missing internal file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->item_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal item - missing item values.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data reference.",
+		 function );
+
+		return( -1 );
+	}
+	result = libpff_item_values_get_entry_value(
+	          internal_item->item_values,
+	          internal_item->internal_file->name_to_id_map_list,
+	          internal_item->internal_file->io_handle,
+	          internal_item->file_io_handle,
+	          0,
+	          entry_type,
+	          value_type,
+	          value_data_reference,
+	          value_data_cache,
+	          flags,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry value.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( *value_data_reference == NULL )
+		{
+			result = 0;
+		}
+	}
+	return( result );
+}
+
+/* Reads message body value data at a specific offset into a buffer
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libpff_message_read_body_data_at_offset(
+         libpff_internal_item_t *internal_item,
+         libfdata_reference_t *value_data_reference,
+         libfcache_cache_t *value_data_cache,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	static char *function = "libpff_message_read_body_data_at_offset";
+	ssize_t read_count    = 0;
+
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal item.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_reference_seek_offset(
+	     value_data_reference,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " in value data reference.",
+		 function,
+		 offset );
+
+		return( -1 );
+	}
+	read_count = libfdata_reference_read_buffer(
+	              value_data_reference,
+	              internal_item->file_io_handle,
+	              value_data_cache,
+	              buffer,
+	              buffer_size,
+	              error );
+
+	if( read_count != (ssize_t) buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer from value data reference.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Reads data from the current offset of the HTML message body into a buffer
+ * The data is read as stored, without an added end of string character,
+ * so that large bodies can be copied without reading the full value into memory
+ * Returns the number of bytes read, 0 at the end of the body or -1 on error
+ */
+ssize_t libpff_message_html_body_read_buffer(
+         libpff_item_t *message,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libfcache_cache_t *value_data_cache        = NULL;
+	libfdata_reference_t *value_data_reference = NULL;
+	libpff_internal_item_t *internal_item      = NULL;
+	static char *function                      = "libpff_message_html_body_read_buffer";
+	size64_t value_data_size                   = 0;
+	ssize_t read_count                         = 0;
+	uint32_t value_type                        = 0;
+	int result                                 = 0;
+
+	if( message == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libpff_internal_item_t *) message;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = libpff_message_get_body_reference(
+	          internal_item,
+	          LIBPFF_ENTRY_TYPE_MESSAGE_BODY_HTML,
+	          &value_type,
+	          LIBPFF_ENTRY_VALUE_FLAG_MATCH_ANY_VALUE_TYPE,
+	          &value_data_reference,
+	          &value_data_cache,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve HTML body reference.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfdata_reference_get_size(
+	     value_data_reference,
+	     &value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) internal_item->html_body_offset >= value_data_size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) buffer_size > ( value_data_size - internal_item->html_body_offset ) )
+	{
+		buffer_size = (size_t) ( value_data_size - internal_item->html_body_offset );
+	}
+	read_count = libpff_message_read_body_data_at_offset(
+	              internal_item,
+	              value_data_reference,
+	              value_data_cache,
+	              internal_item->html_body_offset,
+	              buffer,
+	              buffer_size,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read HTML body data.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item->html_body_offset += (off64_t) read_count;
+
+	return( read_count );
+}
+
+/* Seeks a certain offset of the HTML message body
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libpff_message_html_body_seek_offset(
+         libpff_item_t *message,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	libfcache_cache_t *value_data_cache        = NULL;
+	libfdata_reference_t *value_data_reference = NULL;
+	libpff_internal_item_t *internal_item      = NULL;
+	static char *function                      = "libpff_message_html_body_seek_offset";
+	size64_t value_data_size                   = 0;
+	uint32_t value_type                        = 0;
+	int result                                 = 0;
+
+	if( message == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libpff_internal_item_t *) message;
+
+	result = libpff_message_get_body_reference(
+	          internal_item,
+	          LIBPFF_ENTRY_TYPE_MESSAGE_BODY_HTML,
+	          &value_type,
+	          LIBPFF_ENTRY_VALUE_FLAG_MATCH_ANY_VALUE_TYPE,
+	          &value_data_reference,
+	          &value_data_cache,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve HTML body reference.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libfdata_reference_get_size(
+		     value_data_reference,
+		     &value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value data size.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += internal_item->html_body_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) value_data_size;
+	}
+	else if( whence != SEEK_SET )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item->html_body_offset = offset;
+
+	return( offset );
+}
+
+/* Creates the LZFu decompression stream of the RTF message body
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_message_initialize_rtf_body_stream(
+     libpff_internal_item_t *internal_item,
+     libfdata_reference_t *value_data_reference,
+     libfcache_cache_t *value_data_cache,
+     libcerror_error_t **error )
+{
+	uint8_t lzfu_header_data[ sizeof( libfmapi_lzfu_header_t ) ];
+
+	static char *function    = "libpff_message_initialize_rtf_body_stream";
+	size64_t value_data_size = 0;
+
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal item.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_reference_get_size(
+	     value_data_reference,
+	     &value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size < (size64_t) sizeof( libfmapi_lzfu_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: value data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_message_read_body_data_at_offset(
+	     internal_item,
+	     value_data_reference,
+	     value_data_cache,
+	     0,
+	     lzfu_header_data,
+	     sizeof( libfmapi_lzfu_header_t ),
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read LZFu header data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfmapi_lzfu_stream_initialize(
+	     &( internal_item->rtf_body_stream ),
+	     lzfu_header_data,
+	     sizeof( libfmapi_lzfu_header_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create LZFu stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) internal_item->rtf_body_stream->compressed_data_size != ( value_data_size - sizeof( libfmapi_lzfu_header_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: mismatch in compressed data size (%" PRIzd " != %" PRIu64 ").",
+		 function,
+		 internal_item->rtf_body_stream->compressed_data_size,
+		 value_data_size - sizeof( libfmapi_lzfu_header_t ) );
+
+		libfmapi_lzfu_stream_free(
+		 &( internal_item->rtf_body_stream ),
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads data from the current offset of the RTF message body into a buffer
+ * The compressed RTF is decompressed in bounded parts, without an added end of string character,
+ * so that large bodies can be copied without decompressing the full value into memory
+ * Returns the number of bytes read, 0 at the end of the body or -1 on error
+ */
+ssize_t libpff_message_rtf_body_read_buffer(
+         libpff_item_t *message,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	uint8_t compressed_data[ 4096 ];
+
+	libfcache_cache_t *value_data_cache        = NULL;
+	libfdata_reference_t *value_data_reference = NULL;
+	libfmapi_lzfu_stream_t *lzfu_stream        = NULL;
+	libpff_internal_item_t *internal_item      = NULL;
+	static char *function                      = "libpff_message_rtf_body_read_buffer";
+	size_t buffer_offset                       = 0;
+	size_t compressed_data_consumed            = 0;
+	size_t compressed_data_size                = 0;
+	size_t uncompressed_data_size              = 0;
+	uint32_t value_type                        = LIBPFF_VALUE_TYPE_BINARY_DATA;
+	int result                                 = 0;
+
+	if( message == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libpff_internal_item_t *) message;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = libpff_message_get_body_reference(
+	          internal_item,
+	          LIBPFF_ENTRY_TYPE_MESSAGE_BODY_COMPRESSED_RTF,
+	          &value_type,
+	          0,
+	          &value_data_reference,
+	          &value_data_cache,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve RTF body reference.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( internal_item->rtf_body_stream == NULL )
+	{
+		if( libpff_message_initialize_rtf_body_stream(
+		     internal_item,
+		     value_data_reference,
+		     value_data_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create RTF body stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	lzfu_stream = internal_item->rtf_body_stream;
+
+	/* The remaining compressed data is consumed after the last uncompressed byte
+	 * was produced so that the CRC is verified at the end of the body
+	 */
+	while( lzfu_stream->compressed_data_offset < lzfu_stream->compressed_data_size )
+	{
+		if( ( buffer_offset >= buffer_size )
+		 && ( lzfu_stream->uncompressed_data_offset < (size_t) lzfu_stream->header.uncompressed_data_size )
+		 && ( lzfu_stream->end_of_data == 0 ) )
+		{
+			break;
+		}
+		compressed_data_size = lzfu_stream->compressed_data_size - lzfu_stream->compressed_data_offset;
+
+		if( compressed_data_size > sizeof( compressed_data ) )
+		{
+			compressed_data_size = sizeof( compressed_data );
+		}
+		if( libpff_message_read_body_data_at_offset(
+		     internal_item,
+		     value_data_reference,
+		     value_data_cache,
+		     (off64_t) ( sizeof( libfmapi_lzfu_header_t ) + lzfu_stream->compressed_data_offset ),
+		     compressed_data,
+		     compressed_data_size,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed RTF body data.",
+			 function );
+
+			return( -1 );
+		}
+		uncompressed_data_size = buffer_size - buffer_offset;
+
+		if( libfmapi_lzfu_stream_decompress(
+		     lzfu_stream,
+		     compressed_data,
+		     compressed_data_size,
+		     &compressed_data_consumed,
+		     &( buffer[ buffer_offset ] ),
+		     &uncompressed_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress RTF body data.",
+			 function );
+
+			return( -1 );
+		}
+		buffer_offset += uncompressed_data_size;
+
+		if( ( compressed_data_consumed == 0 )
+		 && ( uncompressed_data_size == 0 ) )
+		{
+			break;
+		}
+	}
+	if( ( internal_item->internal_file->io_handle != NULL )
+	 && ( buffer_offset > 0 ) )
+	{
+		internal_item->internal_file->io_handle->statistics.number_of_bytes_decompressed += (uint64_t) buffer_offset;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Seeks a certain offset of the RTF message body
+ * Since the data is LZFu compressed seeking backwards restarts the decompression
+ * and seeking forwards decompresses the data in between
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libpff_message_rtf_body_seek_offset(
+         libpff_item_t *message,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	uint8_t skip_buffer[ 4096 ];
+
+	libfcache_cache_t *value_data_cache        = NULL;
+	libfdata_reference_t *value_data_reference = NULL;
+	libpff_internal_item_t *internal_item      = NULL;
+	static char *function                      = "libpff_message_rtf_body_seek_offset";
+	size_t read_size                           = 0;
+	ssize_t read_count                         = 0;
+	uint32_t value_type                        = LIBPFF_VALUE_TYPE_BINARY_DATA;
+	int result                                 = 0;
+
+	if( message == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libpff_internal_item_t *) message;
+
+	result = libpff_message_get_body_reference(
+	          internal_item,
+	          LIBPFF_ENTRY_TYPE_MESSAGE_BODY_COMPRESSED_RTF,
+	          &value_type,
+	          0,
+	          &value_data_reference,
+	          &value_data_cache,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve RTF body reference.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( internal_item->rtf_body_stream == NULL )
+	{
+		if( libpff_message_initialize_rtf_body_stream(
+		     internal_item,
+		     value_data_reference,
+		     value_data_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create RTF body stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += (off64_t) internal_item->rtf_body_stream->uncompressed_data_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) internal_item->rtf_body_stream->header.uncompressed_data_size;
+	}
+	else if( whence != SEEK_SET )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( offset > (off64_t) internal_item->rtf_body_stream->header.uncompressed_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < (off64_t) internal_item->rtf_body_stream->uncompressed_data_offset )
+	{
+		if( libfmapi_lzfu_stream_free(
+		     &( internal_item->rtf_body_stream ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free RTF body stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( libpff_message_initialize_rtf_body_stream(
+		     internal_item,
+		     value_data_reference,
+		     value_data_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create RTF body stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	while( offset > (off64_t) internal_item->rtf_body_stream->uncompressed_data_offset )
+	{
+		read_size = sizeof( skip_buffer );
+
+		if( (off64_t) read_size > ( offset - (off64_t) internal_item->rtf_body_stream->uncompressed_data_offset ) )
+		{
+			read_size = (size_t) ( offset - (off64_t) internal_item->rtf_body_stream->uncompressed_data_offset );
+		}
+		read_count = libpff_message_rtf_body_read_buffer(
+		              message,
+		              skip_buffer,
+		              read_size,
+		              error );
+
+		if( read_count <= 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to skip RTF body data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( offset );
+}
+
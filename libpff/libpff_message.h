@@ -28,6 +28,8 @@
 #include "libpff_extern.h"
 #include "libpff_item.h"
 #include "libpff_libcerror.h"
+#include "libpff_libfcache.h"
+#include "libpff_libfdata.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -135,6 +137,58 @@ int libpff_message_get_html_body(
      size_t size,
      libcerror_error_t **error );
 
+int libpff_message_get_body_reference(
+     libpff_internal_item_t *internal_item,
+     uint32_t entry_type,
+     uint32_t *value_type,
+     uint8_t flags,
+     libfdata_reference_t **value_data_reference,
+     libfcache_cache_t **value_data_cache,
+     libcerror_error_t **error );
+
+ssize_t libpff_message_read_body_data_at_offset(
+         libpff_internal_item_t *internal_item,
+         libfdata_reference_t *value_data_reference,
+         libfcache_cache_t *value_data_cache,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+ssize_t libpff_message_html_body_read_buffer(
+         libpff_item_t *message,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+off64_t libpff_message_html_body_seek_offset(
+         libpff_item_t *message,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int libpff_message_initialize_rtf_body_stream(
+     libpff_internal_item_t *internal_item,
+     libfdata_reference_t *value_data_reference,
+     libfcache_cache_t *value_data_cache,
+     libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+ssize_t libpff_message_rtf_body_read_buffer(
+         libpff_item_t *message,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+off64_t libpff_message_rtf_body_seek_offset(
+         libpff_item_t *message,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -9,12 +9,12 @@
  * it under the terms of the GNU Lesser General Public License as published by
  * the Free Software Foundation, either version 3 of the License, or
  * (at your option) any later version.
- * 
+ *
  * This software is distributed in the hope that it will be useful,
  * but WITHOUT ANY WARRANTY; without even the implied warranty of
  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
  * GNU General Public License for more details.
- * 
+ *
  * You should have received a copy of the GNU Lesser General Public License
  * along with this software.  If not, see <http://www.gnu.org/licenses/>.
  */
@@ -24,189 +24,8 @@
 #include <types.h>
 
 #include "libpff_libcerror.h"
-#include "libpff_list_type.h"
 #include "libpff_offset_list.h"
 
-/* Creates an offset list value
- * Returns 1 if successful or -1 on error
- */
-int libpff_offset_list_value_initialize(
-     libpff_offset_list_value_t **offset_list_value,
-     libcerror_error_t **error )
-{
-	static char *function = "libpff_offset_list_value_initialize";
-
-	if( offset_list_value == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid offset list value.",
-		 function );
-
-		return( -1 );
-	}
-	if( *offset_list_value != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid offset list value value already set.",
-		 function );
-
-		return( -1 );
-	}
-	*offset_list_value = memory_allocate_structure(
-	                      libpff_offset_list_value_t );
-
-	if( *offset_list_value == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create offset list value.",
-		 function );
-
-		goto on_error;
-	}
-	if( memory_set(
-	     *offset_list_value,
-	     0,
-	     sizeof( libpff_offset_list_value_t ) ) == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear offset list value.",
-		 function );
-
-		goto on_error;
-	}
-	return( 1 );
-
-on_error:
-	if( *offset_list_value != NULL )
-	{
-		memory_free(
-		 *offset_list_value );
-
-		*offset_list_value = NULL;
-	}
-	return( -1 );
-}
-
-/* Frees an offset list value
- */
-int libpff_offset_list_value_free(
-     libpff_offset_list_value_t **offset_list_value,
-     libcerror_error_t **error )
-{
-	static char *function = "libpff_offset_list_value_free";
-
-	if( offset_list_value == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid offset list value.",
-		 function );
-
-		return( -1 );
-	}
-	if( *offset_list_value != NULL )
-	{
-		memory_free(
-		 *offset_list_value );
-
-		*offset_list_value = NULL;
-	}
-	return( 1 );
-}
-
-/* Clones the offset list value
- * Returns 1 if successful or -1 on error
- */
-int libpff_offset_list_value_clone(
-     libpff_offset_list_value_t **destination_offset_list_value,
-     libpff_offset_list_value_t *source_offset_list_value,
-     libcerror_error_t **error )
-{
-	static char *function = "libpff_offset_list_value_clone";
-
-	if( destination_offset_list_value == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid destination offset list value.",
-		 function );
-
-		return( -1 );
-	}
-	if( *destination_offset_list_value != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid destination offset list value value already set.",
-		 function );
-
-		return( -1 );
-	}
-	if( source_offset_list_value == NULL )
-	{
-		*destination_offset_list_value = NULL;
-
-		return( 1 );
-	}
-	*destination_offset_list_value = memory_allocate_structure(
-	                                  libpff_offset_list_value_t );
-
-	if( *destination_offset_list_value == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create destination offset list value.",
-		 function );
-
-		goto on_error;
-	}
-	if( memory_copy(
-	     *destination_offset_list_value,
-	     source_offset_list_value,
-	     sizeof( libpff_offset_list_value_t ) ) == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy source to destination offset list value.",
-		 function );
-
-		goto on_error;
-	}
-	return( 1 );
-
-on_error:
-	if( *destination_offset_list_value != NULL )
-	{
-		memory_free(
-		 *destination_offset_list_value );
-
-		*destination_offset_list_value = NULL;
-	}
-	return( -1 );
-}
-
 /* Creates an offset list
  * Returns 1 if successful or -1 on error
  */
@@ -287,7 +106,6 @@ int libpff_offset_list_free(
      libcerror_error_t **error )
 {
 	static char *function = "libpff_offset_list_free";
-	int result            = 1;
 
 	if( offset_list == NULL )
 	{
@@ -302,39 +120,27 @@ int libpff_offset_list_free(
 	}
 	if( *offset_list != NULL )
 	{
-		result = libpff_offset_list_empty(
-		          *offset_list,
-		          error );
-
-		if( result != 1 )
+		if( ( *offset_list )->values != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to empty offset list.",
-			 function );
+			memory_free(
+			 ( *offset_list )->values );
 		}
 		memory_free(
 		 *offset_list );
 
 		*offset_list = NULL;
 	}
-	return( result );
+	return( 1 );
 }
 
-/* Empties an offset list and frees the elements
+/* Empties an offset list
  * Returns 1 if successful or -1 on error
  */
 int libpff_offset_list_empty(
      libpff_offset_list_t *offset_list,
      libcerror_error_t **error )
 {
-	libpff_list_element_t *list_element = NULL;
-	static char *function                 = "libpff_offset_list_empty";
-	int element_index                     = 0;
-	int number_of_elements                = 0;
-	int result                            = 1;
+	static char *function = "libpff_offset_list_empty";
 
 	if( offset_list == NULL )
 	{
@@ -347,62 +153,9 @@ int libpff_offset_list_empty(
 
 		return( -1 );
 	}
-	if( offset_list->number_of_elements > 0 )
-	{
-		number_of_elements = offset_list->number_of_elements;
-
-		for( element_index = 0;
-		     element_index < number_of_elements;
-		     element_index++ )
-		{
-			list_element = offset_list->first_element;
-
-			if( list_element == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: corruption detected in element: %d.",
-				 function,
-				 element_index );
-
-				return( -1 );
-			}
-			offset_list->first_element = list_element->next_element;
-
-			if( offset_list->last_element == list_element )
-			{
-				offset_list->last_element = list_element->next_element;
-			}
-			offset_list->number_of_elements -= 1;
-
-			if( list_element->next_element != NULL )
-			{
-				list_element->next_element->previous_element = NULL;
-			}
-			list_element->next_element = NULL;
+	offset_list->number_of_elements = 0;
 
-			if( libpff_list_element_free(
-			     &list_element,
-			     (int (*)(intptr_t **, libcerror_error_t **)) &libpff_offset_list_value_free,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free element: %d.",
-				 function,
-				 element_index );
-
-				result = -1;
-			}
-		}
-		offset_list->current_element       = NULL;
-		offset_list->current_element_index = 0;
-	}
-	return( result );
+	return( 1 );
 }
 
 /* Clones the offset list
@@ -413,11 +166,7 @@ int libpff_offset_list_clone(
      libpff_offset_list_t *source_offset_list,
      libcerror_error_t **error )
 {
-	libpff_list_element_t *destination_list_element = NULL;
-	libpff_list_element_t *source_list_element      = NULL;
-	libpff_offset_list_value_t *destination_value   = NULL;
-	static char *function                             = "libpff_offset_list_clone";
-	int element_index                                 = 0;
+	static char *function = "libpff_offset_list_clone";
 
 	if( destination_offset_list == NULL )
 	{
@@ -460,120 +209,125 @@ int libpff_offset_list_clone(
 
 		goto on_error;
 	}
-	if( *destination_offset_list == NULL )
+	if( source_offset_list->number_of_elements > 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing destination offset list.",
-		 function );
-
-		goto on_error;
-	}
-	source_list_element = source_offset_list->first_element;
-
-	for( element_index = 0;
-	     element_index < source_offset_list->number_of_elements;
-	     element_index++ )
-	{
-		if( source_list_element == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: corruption detected in source offset list element: %d.",
-			 function,
-			 element_index );
-
-			goto on_error;
-		}
-		if( libpff_list_element_initialize(
-		     &destination_list_element,
+		if( libpff_offset_list_resize(
+		     *destination_offset_list,
+		     source_offset_list->number_of_elements,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create destination list element: %d.",
-			 function,
-			 element_index );
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize destination offset list.",
+			 function );
 
 			goto on_error;
 		}
-		if( libpff_offset_list_value_clone(
-		     &destination_value,
-		     (libpff_offset_list_value_t *) source_list_element->value,
-		     error ) != 1 )
+		if( memory_copy(
+		     ( *destination_offset_list )->values,
+		     source_offset_list->values,
+		     sizeof( libpff_offset_list_value_t ) * source_offset_list->number_of_elements ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to clone value of offset list element: %d.",
-			 function,
-			 element_index );
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy values.",
+			 function );
 
 			goto on_error;
 		}
-		if( libpff_list_element_set_value(
-		     destination_list_element,
-		     (intptr_t *) destination_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to set value of destination list element: %d.",
-			 function,
-			 element_index );
+		( *destination_offset_list )->number_of_elements = source_offset_list->number_of_elements;
+	}
+	return( 1 );
 
-			goto on_error;
-		}
-		destination_value = NULL;
+on_error:
+	if( *destination_offset_list != NULL )
+	{
+		libpff_offset_list_free(
+		 destination_offset_list,
+		 NULL );
+	}
+	return( -1 );
+}
 
-		if( ( *destination_offset_list )->first_element == NULL )
-		{
-			( *destination_offset_list )->first_element = destination_list_element;
-		}
-		if( ( *destination_offset_list )->last_element != NULL )
-		{
-			( *destination_offset_list )->last_element->next_element = destination_list_element;
-			destination_list_element->previous_element               = ( *destination_offset_list )->last_element;
-		}
-		( *destination_offset_list )->last_element        = destination_list_element;
-		( *destination_offset_list )->number_of_elements += 1;
+/* Resizes the offset list to hold at least the number of elements
+ * The number of allocated elements is doubled to keep appends amortized constant
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_offset_list_resize(
+     libpff_offset_list_t *offset_list,
+     int number_of_elements,
+     libcerror_error_t **error )
+{
+	void *reallocation               = NULL;
+	static char *function            = "libpff_offset_list_resize";
+	int number_of_allocated_elements = 0;
 
-		destination_list_element = NULL;
+	if( offset_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset list.",
+		 function );
 
-		source_list_element = source_list_element->next_element;
+		return( -1 );
 	}
-	return( 1 );
+	if( ( number_of_elements < 0 )
+	 || ( (size_t) number_of_elements > ( (size_t) SSIZE_MAX / ( 2 * sizeof( libpff_offset_list_value_t ) ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of elements value out of bounds.",
+		 function );
 
-on_error:
-	if( destination_value != NULL )
+		return( -1 );
+	}
+	if( number_of_elements <= offset_list->number_of_allocated_elements )
 	{
-		libpff_offset_list_value_free(
-		 &destination_value,
-		 NULL );
+		return( 1 );
 	}
-	if( destination_list_element != NULL )
+	number_of_allocated_elements = offset_list->number_of_allocated_elements;
+
+	if( number_of_allocated_elements < 16 )
 	{
-		libpff_list_element_free(
-		 &destination_list_element,
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libpff_offset_list_value_free,
-		 NULL );
+		number_of_allocated_elements = 16;
 	}
-	if( *destination_offset_list != NULL )
+	while( number_of_allocated_elements < number_of_elements )
 	{
-		libpff_offset_list_free(
-		 destination_offset_list,
-		 NULL );
+		if( number_of_allocated_elements > ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_elements = number_of_elements;
+
+			break;
+		}
+		number_of_allocated_elements *= 2;
 	}
-	return( -1 );
+	reallocation = memory_reallocate(
+	                offset_list->values,
+	                sizeof( libpff_offset_list_value_t ) * number_of_allocated_elements );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize values.",
+		 function );
+
+		return( -1 );
+	}
+	offset_list->values                       = (libpff_offset_list_value_t *) reallocation;
+	offset_list->number_of_allocated_elements = number_of_allocated_elements;
+
+	return( 1 );
 }
 
 /* Retrieves the number of elements in the offset list
@@ -613,7 +367,46 @@ int libpff_offset_list_get_number_of_elements(
 	return( 1 );
 }
 
+/* Determines the index of the first element of which the end offset is
+ * greater than (or equal to if include_adjacent is set) the offset value
+ * Returns the element index, which is the number of elements if there is no such element
+ */
+int libpff_offset_list_find_element_index(
+     libpff_offset_list_t *offset_list,
+     off64_t offset_value,
+     uint8_t include_adjacent )
+{
+	libpff_offset_list_value_t *offset_list_value = NULL;
+	off64_t end_offset                            = 0;
+	int lower_index                               = 0;
+	int middle_index                              = 0;
+	int upper_index                               = 0;
+
+	upper_index = offset_list->number_of_elements;
+
+	while( lower_index < upper_index )
+	{
+		middle_index      = lower_index + ( ( upper_index - lower_index ) / 2 );
+		offset_list_value = &( offset_list->values[ middle_index ] );
+		end_offset        = offset_list_value->offset + (off64_t) offset_list_value->size;
+
+		if( ( end_offset > offset_value )
+		 || ( ( include_adjacent != 0 )
+		  &&  ( end_offset == offset_value ) ) )
+		{
+			upper_index = middle_index;
+		}
+		else
+		{
+			lower_index = middle_index + 1;
+		}
+	}
+	return( lower_index );
+}
+
 /* Appends an offset
+ * The elements are kept sorted by offset, if merge ranges is set overlapping
+ * and adjacent ranges are merged into a single range
  * Returns 1 if successful, or -1 on error
  */
 int libpff_offset_list_append_offset(
@@ -623,17 +416,12 @@ int libpff_offset_list_append_offset(
      uint8_t merge_ranges,
      libcerror_error_t **error )
 {
-	libpff_list_element_t *last_list_element      = NULL;
-	libpff_list_element_t *list_element           = NULL;
-	libpff_list_element_t *remove_element         = NULL;
 	libpff_offset_list_value_t *offset_list_value = NULL;
-	static char *function                           = "libpff_offset_list_append_offset";
-	off64_t last_offset                             = 0;
-	off64_t last_range_offset                       = 0;
-	int create_list_element                         = 0;
-	int element_index                               = 0;
-	int merge_next_list_element_check               = 0;
-	int merge_previous_list_element_check           = 0;
+	static char *function                         = "libpff_offset_list_append_offset";
+	off64_t last_offset                           = 0;
+	off64_t last_range_offset                     = 0;
+	int element_index                             = 0;
+	int last_element_index                        = 0;
 
 	if( offset_list == NULL )
 	{
@@ -657,7 +445,7 @@ int libpff_offset_list_append_offset(
 
 		return( -1 );
 	}
-	if( size > (size64_t) INT64_MAX )
+	if( size > (size64_t) ( INT64_MAX - offset ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -668,610 +456,129 @@ int libpff_offset_list_append_offset(
 
 		return( -1 );
 	}
-	create_list_element = 1;
+	last_offset   = offset + (off64_t) size;
+	element_index = offset_list->number_of_elements;
 
-	/* Check if new range should be merged with an existing range
+	/* Check the last element first, most often the list will be filled linear
 	 */
-        if( merge_ranges == 0 )
-        {
-                last_list_element = offset_list->last_element;
-        }
-	else if( offset_list->number_of_elements > 0 )
+	if( offset_list->number_of_elements > 0 )
 	{
-		last_offset = offset + size;
-
-		/* Check the last element first, most often the list will be filled linear 
-		 */
-		list_element = offset_list->last_element;
-
-		if( list_element == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: corruption detected for list element: %d.",
-			 function,
-			 offset_list->number_of_elements - 1 );
-
-			return( -1 );
-		}
-		if( list_element->value == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing offset list value for list element: %d.",
-			 function,
-			 offset_list->number_of_elements - 1 );
-
-			return( -1 );
-		}
-		offset_list_value = (libpff_offset_list_value_t *) list_element->value;
+		offset_list_value = &( offset_list->values[ offset_list->number_of_elements - 1 ] );
+		last_range_offset = offset_list_value->offset + (off64_t) offset_list_value->size;
 
-		last_range_offset = offset_list_value->offset + offset_list_value->size;
-
-		/* Check if the offset range overlaps at the end of the last offset range
-		 */
-		if( ( offset >= offset_list_value->offset )
+		if( ( merge_ranges != 0 )
+		 && ( offset >= offset_list_value->offset )
 		 && ( offset <= last_range_offset ) )
 		{
 			if( last_offset > last_range_offset )
 			{
-				offset_list_value->size += (size64_t) ( last_offset - last_range_offset );
+				offset_list_value->size = (size64_t) ( last_offset - offset_list_value->offset );
 			}
-			create_list_element           = 0;
-			merge_next_list_element_check = 1;
+			return( 1 );
 		}
-		/* Check if the offset range overlaps at the beginning of the last offset range
-		 */
-		else if( ( last_offset >= offset_list_value->offset )
-		      && ( last_offset <= last_range_offset ) )
+		if( offset < offset_list_value->offset )
 		{
-			if( offset < offset_list_value->offset )
-			{
-				offset_list_value->offset  = offset;
-				offset_list_value->size   += (size64_t) ( offset_list_value->offset - offset );
-			}
-			create_list_element               = 0;
-			merge_previous_list_element_check = 1;
+			element_index = libpff_offset_list_find_element_index(
+			                 offset_list,
+			                 offset,
+			                 merge_ranges );
 		}
-		/* Check if the offset range overlaps the last offset range entirely
+	}
+	if( merge_ranges != 0 )
+	{
+		/* Determine the elements that overlap or are adjacent to the range
 		 */
-		else if( ( offset < offset_list_value->offset )
-		      && ( last_offset > last_range_offset ) )
-		{
-			offset_list_value->offset = offset;
-			offset_list_value->size   = size;
+		last_element_index = element_index;
 
-			create_list_element               = 0;
-			merge_previous_list_element_check = 1;
-		}
-		/* Check if the offset range is beyond the last range
-		 */
-		else if( last_offset > last_range_offset )
+		while( last_element_index < offset_list->number_of_elements )
 		{
-			last_list_element = list_element;
-		}
-		else if( offset_list->number_of_elements > 1 )
-		{
-			if( last_offset > ( last_range_offset / 2 ) )
+			if( offset_list->values[ last_element_index ].offset > last_offset )
 			{
-				list_element = list_element->previous_element;
-
-				for( element_index = ( offset_list->number_of_elements - 2 );
-				     element_index >= 0;
-				     element_index-- )
-				{
-					if( list_element == NULL )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-						 "%s: corruption detected for list element: %d.",
-						 function,
-						 element_index );
-
-						return( -1 );
-					}
-					if( list_element->value == NULL )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-						 "%s: missing offset list value for list element: %d.",
-						 function,
-						 element_index );
-
-						return( -1 );
-					}
-					offset_list_value = (libpff_offset_list_value_t *) list_element->value;
-
-					last_range_offset = offset_list_value->offset + offset_list_value->size;
-
-					/* Check if the offset range overlaps at the end of an existing offset range
-					 */
-					if( ( offset >= offset_list_value->offset )
-					 && ( offset <= last_range_offset ) )
-					{
-						if( last_offset > last_range_offset )
-						{
-							offset_list_value->size += (size64_t) ( last_offset - last_range_offset );
-						}
-						create_list_element           = 0;
-						merge_next_list_element_check = 1;
-					}
-					/* Check if the offset range overlaps at the beginning of an existing offset range
-					 */
-					else if( ( last_offset >= offset_list_value->offset )
-					      && ( last_offset <= last_range_offset ) )
-					{
-						if( offset < offset_list_value->offset )
-						{
-							offset_list_value->offset  = offset;
-							offset_list_value->size   += (size64_t) ( offset_list_value->offset - offset );
-						}
-						create_list_element               = 0;
-						merge_previous_list_element_check = 1;
-					}
-					/* Check if the offset range overlaps an existing offset range entirely
-					 */
-					else if( ( offset < offset_list_value->offset )
-					      && ( last_offset > last_range_offset ) )
-					{
-						offset_list_value->offset = offset;
-						offset_list_value->size   = size;
-
-						create_list_element               = 0;
-						merge_next_list_element_check     = 1;
-						merge_previous_list_element_check = 1;
-					}
-					if( create_list_element == 0 )
-					{
-						break;
-					}
-					/* Check if the offset range belongs after the exising offset range
-					 */
-					if( last_offset > last_range_offset )
-					{
-						last_list_element = list_element;
-
-						break;
-					}
-					last_list_element = list_element;
-					list_element      = list_element->previous_element;
-				}
-			}
-			else
-			{
-				list_element = offset_list->first_element;
-
-				for( element_index = 0;
-				     element_index < ( offset_list->number_of_elements - 1 );
-				     element_index++ )
-				{
-					if( list_element == NULL )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-						 "%s: corruption detected for list element: %d.",
-						 function,
-						 element_index );
-
-						return( -1 );
-					}
-					if( list_element->value == NULL )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-						 "%s: missing offset list value for list element: %d.",
-						 function,
-						 element_index );
-
-						return( -1 );
-					}
-					offset_list_value = (libpff_offset_list_value_t *) list_element->value;
-
-					last_range_offset = offset_list_value->offset + offset_list_value->size;
-
-					/* Check if the offset range overlaps at the end of an existing offset range
-					 */
-					if( ( offset >= offset_list_value->offset )
-					 && ( offset <= last_range_offset ) )
-					{
-						if( last_offset > last_range_offset )
-						{
-							offset_list_value->size += (size64_t) ( last_offset - last_range_offset );
-						}
-						create_list_element           = 0;
-						merge_next_list_element_check = 1;
-					}
-					/* Check if the offset range overlaps at the beginning of an existing offset range
-					 */
-					else if( ( last_offset >= offset_list_value->offset )
-					      && ( last_offset <= last_range_offset ) )
-					{
-						if( offset < offset_list_value->offset )
-						{
-							offset_list_value->offset  = offset;
-							offset_list_value->size   += (size64_t) ( offset_list_value->offset - offset );
-						}
-						create_list_element               = 0;
-						merge_previous_list_element_check = 1;
-					}
-					/* Check if the offset range overlaps an existing offset range entirely
-					 */
-					else if( ( offset < offset_list_value->offset )
-					      && ( last_offset > last_range_offset ) )
-					{
-						offset_list_value->offset = offset;
-						offset_list_value->size   = size;
-
-						create_list_element               = 0;
-						merge_next_list_element_check     = 1;
-						merge_previous_list_element_check = 1;
-					}
-					if( create_list_element == 0 )
-					{
-						break;
-					}
-					/* Check if the offset range belongs before the current offset range
-					 */
-					if( last_offset < last_range_offset )
-					{
-                                        	last_list_element = list_element->previous_element;
-
-						break;
-					}
-                                        last_list_element = list_element;
-                                        list_element      = list_element->next_element;
-				}
+				break;
 			}
+			last_element_index++;
 		}
-		/* Check if the current range should be merged with the previous range
-		 */
-		if( merge_previous_list_element_check != 0 )
+		if( last_element_index > element_index )
 		{
-			if( list_element == NULL )
+			last_range_offset = offset_list->values[ last_element_index - 1 ].offset
+			                  + (off64_t) offset_list->values[ last_element_index - 1 ].size;
+
+			if( last_offset < last_range_offset )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: invalid list element.",
-				 function );
-
-				return( -1 );
+				last_offset = last_range_offset;
 			}
-			if( list_element->previous_element != NULL )
-			{
-				if( list_element->previous_element->value == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing offset list value for previous list element.",
-					 function );
-
-					return( -1 );
-				}
-				last_offset = ( (libpff_offset_list_value_t *) list_element->previous_element->value )->offset
-				            + ( (libpff_offset_list_value_t *) list_element->previous_element->value )->size;
+			offset_list_value = &( offset_list->values[ element_index ] );
 
-				if( last_offset == offset_list_value->offset )
-				{
-					/* Merge offset range with previous
-					 */
-					offset_list_value->offset  = ( (libpff_offset_list_value_t *) list_element->previous_element->value )->offset;
-					offset_list_value->size   += ( (libpff_offset_list_value_t *) list_element->previous_element->value )->size;
-
-					/* Remove previous list element
-					 */
-					remove_element = list_element->previous_element;
-
-					if( remove_element == offset_list->first_element )
-					{
-						offset_list->first_element = remove_element->next_element;
-					}
-					if( remove_element == offset_list->last_element )
-					{
-						offset_list->last_element = remove_element->previous_element;
-					}
-					if( remove_element->next_element != NULL )
-					{
-						remove_element->next_element->previous_element = remove_element->previous_element;
-					}
-					if( remove_element->previous_element != NULL )
-					{
-						remove_element->previous_element->next_element = remove_element->next_element;
-					}
-					remove_element->next_element     = NULL;
-					remove_element->previous_element = NULL;
-					offset_list->number_of_elements -= 1;
-
-					if( libpff_list_element_free(
-					     &remove_element,
-					     (int (*)(intptr_t **, libcerror_error_t **)) &libpff_offset_list_value_free,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-						 "%s: unable to free element: %d.",
-						 function,
-						 element_index );
-
-						return( -1 );
-					}
-				}
-			}
-		}
-		/* Check if the current range should be merged with the next range
-		 */
-		if( merge_next_list_element_check != 0 )
-		{
-			if( list_element == NULL )
+			if( offset < offset_list_value->offset )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: invalid list element.",
-				 function );
-
-				return( -1 );
+				offset_list_value->offset = offset;
 			}
-			if( list_element->next_element != NULL )
+			offset_list_value->size = (size64_t) ( last_offset - offset_list_value->offset );
+
+			/* Remove the elements that were merged
+			 */
+			if( last_element_index < offset_list->number_of_elements )
 			{
-				if( list_element->next_element->value == NULL )
+				if( memory_move(
+				     &( offset_list->values[ element_index + 1 ] ),
+				     &( offset_list->values[ last_element_index ] ),
+				     sizeof( libpff_offset_list_value_t ) * ( offset_list->number_of_elements - last_element_index ) ) == NULL )
 				{
 					libcerror_error_set(
 					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing offset list value for next list element.",
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to move values.",
 					 function );
 
 					return( -1 );
 				}
-				last_offset = offset_list_value->offset + offset_list_value->size;
-
-				if( last_offset == ( (libpff_offset_list_value_t *) list_element->next_element->value )->offset )
-				{
-					/* Merge offset range with next
-					 */
-					offset_list_value->size += ( (libpff_offset_list_value_t *) list_element->next_element->value )->size;
-
-					/* Remove next list element
-					 */
-					remove_element = list_element->next_element;
-
-					if( remove_element == offset_list->first_element )
-					{
-						offset_list->first_element = remove_element->next_element;
-					}
-					if( remove_element == offset_list->last_element )
-					{
-						offset_list->last_element = remove_element->previous_element;
-					}
-					if( remove_element->next_element != NULL )
-					{
-						remove_element->next_element->previous_element = remove_element->previous_element;
-					}
-					if( remove_element->previous_element != NULL )
-					{
-						remove_element->previous_element->next_element = remove_element->next_element;
-					}
-					remove_element->next_element     = NULL;
-					remove_element->previous_element = NULL;
-					offset_list->number_of_elements -= 1;
-
-					if( libpff_list_element_free(
-					     &remove_element,
-					     (int (*)(intptr_t **, libcerror_error_t **)) &libpff_offset_list_value_free,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-						 "%s: unable to free element: %d.",
-						 function,
-						 element_index );
-
-						return( -1 );
-					}
-				}
 			}
+			offset_list->number_of_elements -= last_element_index - element_index - 1;
+
+			return( 1 );
 		}
 	}
-	if( create_list_element != 0 )
+	if( libpff_offset_list_resize(
+	     offset_list,
+	     offset_list->number_of_elements + 1,
+	     error ) != 1 )
 	{
-		offset_list_value = NULL;
-
-		if( libpff_offset_list_value_initialize(
-		     &offset_list_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create offset list value.",
-			 function );
-
-			return( -1 );
-		}
-		if( offset_list_value == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing offset list value.",
-			 function );
-
-			return( -1 );
-		}
-		offset_list_value->offset = offset;
-		offset_list_value->size   = size;
-
-		list_element = NULL;
-
-		if( libpff_list_element_initialize(
-		     &list_element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create list element.",
-			 function );
-
-			libpff_offset_list_value_free(
-			 &offset_list_value,
-			 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize offset list.",
+		 function );
 
-			return( -1 );
-		}
-		if( list_element == NULL )
+		return( -1 );
+	}
+	if( element_index < offset_list->number_of_elements )
+	{
+		if( memory_move(
+		     &( offset_list->values[ element_index + 1 ] ),
+		     &( offset_list->values[ element_index ] ),
+		     sizeof( libpff_offset_list_value_t ) * ( offset_list->number_of_elements - element_index ) ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing list element.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to move values.",
 			 function );
 
-			libpff_offset_list_value_free(
-			 &offset_list_value,
-			 NULL );
-
 			return( -1 );
 		}
-		list_element->value = (intptr_t *) offset_list_value;
-
-		if( offset_list->number_of_elements == 0 )
-		{
-			if( offset_list->first_element != NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: corruption detected - first element already set.",
-				 function );
-
-				libpff_list_element_free(
-				 &list_element,
-				 (int (*)(intptr_t **, libcerror_error_t **)) &libpff_offset_list_value_free,
-				 NULL );
-
-				return( -1 );
-			}
-			if( offset_list->last_element != NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: corruption detected - last element already set.",
-				 function );
-
-				libpff_list_element_free(
-				 &list_element,
-				 (int (*)(intptr_t **, libcerror_error_t **)) &libpff_offset_list_value_free,
-				 NULL );
-
-				return( -1 );
-			}
-			offset_list->first_element = list_element;
-			offset_list->last_element  = list_element;
-		}
-		else
-		{
-			if( offset_list->first_element == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: corruption detected - missing first.",
-				 function );
-
-				libpff_list_element_free(
-				 &list_element,
-				 (int (*)(intptr_t **, libcerror_error_t **)) &libpff_offset_list_value_free,
-				 NULL );
-
-				return( -1 );
-			}
-			if( offset_list->last_element == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: corruption detected - missing last.",
-				 function );
-
-				libpff_list_element_free(
-				 &list_element,
-				 (int (*)(intptr_t **, libcerror_error_t **)) &libpff_offset_list_value_free,
-				 NULL );
-
-				return( -1 );
-			}
-			if( last_list_element == NULL )
-			{
-				offset_list->first_element->previous_element = list_element;
-				list_element->next_element                   = offset_list->first_element;
-
-				offset_list->first_element = list_element;
-			}
-			else
-			{
-				list_element->previous_element = last_list_element;
-				list_element->next_element     = last_list_element->next_element;
+	}
+	offset_list->values[ element_index ].offset = offset;
+	offset_list->values[ element_index ].size   = size;
 
-				if( last_list_element == offset_list->last_element )
-				{
-					offset_list->last_element = list_element;
-				}
-				else if( last_list_element->next_element == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: corruption detected - missing next in last list element.",
-					 function );
+	offset_list->number_of_elements += 1;
 
-					return( -1 );
-				}
-				else
-				{
-					last_list_element->next_element->previous_element = list_element;
-				}
-				last_list_element->next_element = list_element;
-			}
-		}
-		offset_list->number_of_elements++;
-	}
 	return( 1 );
 }
 
-/* Retrieves a specific offset
+/* Retrieves the values of a specific element
  * Returns 1 if successful or -1 on error
  */
 int libpff_offset_list_get_offset(
@@ -1281,8 +588,7 @@ int libpff_offset_list_get_offset(
      size64_t *size,
      libcerror_error_t **error )
 {
-	libpff_offset_list_value_t *offset_list_value = NULL;
-	static char *function                           = "libpff_offset_list_get_offset";
+	static char *function = "libpff_offset_list_get_offset";
 
 	if( offset_list == NULL )
 	{
@@ -1329,142 +635,14 @@ int libpff_offset_list_get_offset(
 
 		return( -1 );
 	}
-	if( ( offset_list->current_element != NULL )
-	 && ( offset_list->current_element_index != index ) )
-	{
-		if( index < offset_list->current_element_index )
-		{
-			if( ( offset_list->current_element_index - index ) < ( offset_list->number_of_elements / 2 ) )
-			{
-				while( offset_list->current_element_index > index )
-				{
-					if( offset_list->current_element == NULL )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-						 "%s: corruption detected in element: %d.",
-						 function,
-						 offset_list->current_element_index );
-
-						return( -1 );
-					}
-					offset_list->current_element = offset_list->current_element->next_element;
-
-					offset_list->current_element_index--;
-				}
-			}
-		}
-		else
-		{
-			if( ( index - offset_list->current_element_index ) < ( offset_list->number_of_elements / 2 ) )
-			{
-				while( offset_list->current_element_index < index )
-				{
-					if( offset_list->current_element == NULL )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-						 "%s: corruption detected in element: %d.",
-						 function,
-						 offset_list->current_element_index );
-
-						return( -1 );
-					}
-					offset_list->current_element = offset_list->current_element->next_element;
-
-					offset_list->current_element_index++;
-				}
-			}
-		}
-	}
-	if( ( offset_list->current_element == NULL )
-	 || ( offset_list->current_element_index != index ) )
-	{
-		if( index < ( offset_list->number_of_elements / 2 ) )
-		{
-			offset_list->current_element = offset_list->first_element;
-
-			for( offset_list->current_element_index = 0;
-			     offset_list->current_element_index < index;
-			     offset_list->current_element_index++ )
-			{
-				if( offset_list->current_element == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: corruption detected in element: %d.",
-					 function,
-					 offset_list->current_element_index );
-
-					return( -1 );
-				}
-				offset_list->current_element = offset_list->current_element->next_element;
-			}
-		}
-		else
-		{
-			offset_list->current_element = offset_list->last_element;
-
-			for( offset_list->current_element_index = ( offset_list->number_of_elements - 1 );
-			     offset_list->current_element_index > index;
-			     offset_list->current_element_index-- )
-			{
-				if( offset_list->current_element == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: corruption detected in element: %d.",
-					 function,
-					 offset_list->current_element_index );
-
-					return( -1 );
-				}
-				offset_list->current_element = offset_list->current_element->previous_element;
-			}
-		}
-	}
-	if( offset_list->current_element == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing offset list element: %d.",
-		 function,
-		 offset_list->current_element_index );
-
-		return( -1 );
-	}
-	if( offset_list->current_element->value == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing offset list value for list element: %d.",
-		 function,
-		 offset_list->current_element_index );
-
-		return( -1 );
-	}
-	offset_list_value = (libpff_offset_list_value_t *) offset_list->current_element->value;
-
-	*offset = offset_list_value->offset;
-	*size   = offset_list_value->size;
+	*offset = offset_list->values[ index ].offset;
+	*size   = offset_list->values[ index ].size;
 
 	return( 1 );
 }
 
-/* Retrieves a specific offset by its value
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Retrieves the values of the element that contains the offset value
+ * Returns 1 if successful, 0 if no element was found or -1 on error
  */
 int libpff_offset_list_get_offset_by_value(
      libpff_offset_list_t *offset_list,
@@ -1473,10 +651,8 @@ int libpff_offset_list_get_offset_by_value(
      size64_t *size,
      libcerror_error_t **error )
 {
-	libpff_list_element_t *list_element           = NULL;
-	libpff_offset_list_value_t *offset_list_value = NULL;
-	static char *function                           = "libpff_offset_list_get_offset_by_value";
-	int element_index                               = 0;
+	static char *function = "libpff_offset_list_get_offset_by_value";
+	int element_index     = 0;
 
 	if( offset_list == NULL )
 	{
@@ -1511,49 +687,23 @@ int libpff_offset_list_get_offset_by_value(
 
 		return( -1 );
 	}
-	list_element = offset_list->first_element;
+	element_index = libpff_offset_list_find_element_index(
+	                 offset_list,
+	                 offset_value,
+	                 0 );
 
-	for( element_index = 0;
-	     element_index < offset_list->number_of_elements;
-	     element_index++ )
+	if( element_index >= offset_list->number_of_elements )
 	{
-		if( list_element == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: corruption detected for list element: %d.",
-			 function,
-			 element_index );
-
-			return( -1 );
-		}
-		if( list_element->value == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing offset list value for list element: %d.",
-			 function,
-			 element_index );
-
-			return( -1 );
-		}
-		offset_list_value = (libpff_offset_list_value_t *) list_element->value;
-
-		if( ( offset_value >= offset_list_value->offset )
-		 && ( offset_value < (off64_t) ( offset_list_value->offset + offset_list_value->size ) ) )
-		{
-			*offset = offset_list_value->offset;
-			*size   = offset_list_value->size;
-
-			return( 1 );
-		}
-		list_element = list_element->next_element;
+		return( 0 );
 	}
-	return( 0 );
+	if( offset_value < offset_list->values[ element_index ].offset )
+	{
+		return( 0 );
+	}
+	*offset = offset_list->values[ element_index ].offset;
+	*size   = offset_list->values[ element_index ].size;
+
+	return( 1 );
 }
 
 /* Determines if a certain offset range is present in the list
@@ -1565,11 +715,9 @@ int libpff_offset_list_range_is_present(
      size64_t size,
      libcerror_error_t **error )
 {
-	libpff_list_element_t *list_element           = NULL;
-	libpff_offset_list_value_t *offset_list_value = NULL;
-	static char *function                           = "libpff_offset_list_range_is_present";
-	off64_t last_offset                             = 0;
-	int element_index                               = 0;
+	static char *function = "libpff_offset_list_range_is_present";
+	off64_t last_offset   = 0;
+	int element_index     = 0;
 
 	if( offset_list == NULL )
 	{
@@ -1604,50 +752,24 @@ int libpff_offset_list_range_is_present(
 
 		return( -1 );
 	}
-	last_offset  = offset + size;
-	list_element = offset_list->first_element;
-
-	for( element_index = 0;
-	     element_index < offset_list->number_of_elements;
-	     element_index++ )
-	{
-		if( list_element == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: corruption detected for list element: %d.",
-			 function,
-			 element_index );
+	last_offset = offset + size;
 
-			return( -1 );
-		}
-		if( list_element->value == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing offset list value for list element: %d.",
-			 function,
-			 element_index );
-
-			return( -1 );
-		}
-		offset_list_value = (libpff_offset_list_value_t *) list_element->value;
+	/* The first element that ends after the offset is the only
+	 * element that can overlap the start of the range
+	 */
+	element_index = libpff_offset_list_find_element_index(
+	                 offset_list,
+	                 offset,
+	                 0 );
 
-		if( ( offset >= offset_list_value->offset )
-		 && ( offset < (off64_t) ( offset_list_value->offset + offset_list_value->size ) ) )
-		{
-			return( 1 );
-		}
-		if( ( offset_list_value->offset >= offset )
-		 && ( offset_list_value->offset < last_offset ) )
-		{
-			return( 1 );
-		}
-		list_element = list_element->next_element;
+	if( element_index >= offset_list->number_of_elements )
+	{
+		return( 0 );
+	}
+	if( ( offset_list->values[ element_index ].offset <= offset )
+	 || ( offset_list->values[ element_index ].offset < last_offset ) )
+	{
+		return( 1 );
 	}
 	return( 0 );
 }
@@ -26,7 +26,6 @@
 #include <types.h>
 
 #include "libpff_libcerror.h"
-#include "libpff_list_type.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -53,36 +52,15 @@ struct libpff_offset_list
 	 */
 	int number_of_elements;
 
-	/* The first element
+	/* The number of allocated elements
 	 */
-	libpff_list_element_t *first_element;
+	int number_of_allocated_elements;
 
-	/* The last element
+	/* The values sorted by offset
 	 */
-	libpff_list_element_t *last_element;
-
-	/* The current list element
-	 */
-	libpff_list_element_t *current_element;
-
-	/* The current list element index
-	 */
-	int current_element_index;
+	libpff_offset_list_value_t *values;
 };
 
-int libpff_offset_list_value_initialize(
-     libpff_offset_list_value_t **offset_list_value,
-     libcerror_error_t **error );
-
-int libpff_offset_list_value_free(
-     libpff_offset_list_value_t **offset_list_value,
-     libcerror_error_t **error );
-
-int libpff_offset_list_value_clone(
-     libpff_offset_list_value_t **destination_offset_list_value,
-     libpff_offset_list_value_t *source_offset_list_value,
-     libcerror_error_t **error );
-
 int libpff_offset_list_initialize(
      libpff_offset_list_t **offset_list,
      libcerror_error_t **error );
@@ -100,11 +78,21 @@ int libpff_offset_list_clone(
      libpff_offset_list_t *source_offset_list,
      libcerror_error_t **error );
 
+int libpff_offset_list_resize(
+     libpff_offset_list_t *offset_list,
+     int number_of_elements,
+     libcerror_error_t **error );
+
 int libpff_offset_list_get_number_of_elements(
      libpff_offset_list_t *offset_list,
      int *number_of_elements,
      libcerror_error_t **error );
 
+int libpff_offset_list_find_element_index(
+     libpff_offset_list_t *offset_list,
+     off64_t offset_value,
+     uint8_t include_adjacent );
+
 int libpff_offset_list_append_offset(
      libpff_offset_list_t *offset_list,
      off64_t offset,
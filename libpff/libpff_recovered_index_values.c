@@ -0,0 +1,431 @@
+/*
+ * Recovered index values functions
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libpff_libcerror.h"
+#include "libpff_libcnotify.h"
+#include "libpff_recovered_index_values.h"
+
+/* Initializes the recovered index values
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recovered_index_values_initialize(
+     libpff_recovered_index_values_t **recovered_index_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_recovered_index_values_initialize";
+
+	if( recovered_index_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered index values.",
+		 function );
+
+		return( -1 );
+	}
+	if( *recovered_index_values != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid recovered index values value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*recovered_index_values = memory_allocate_structure(
+	                           libpff_recovered_index_values_t );
+
+	if( *recovered_index_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create recovered index values.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *recovered_index_values,
+	     0,
+	     sizeof( libpff_recovered_index_values_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear recovered index values.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *recovered_index_values != NULL )
+	{
+		memory_free(
+		 *recovered_index_values );
+
+		*recovered_index_values = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees the recovered index values
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recovered_index_values_free(
+     libpff_recovered_index_values_t **recovered_index_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_recovered_index_values_free";
+
+	if( recovered_index_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered index values.",
+		 function );
+
+		return( -1 );
+	}
+	if( *recovered_index_values != NULL )
+	{
+		if( ( *recovered_index_values )->values != NULL )
+		{
+			memory_free(
+			 ( *recovered_index_values )->values );
+		}
+		memory_free(
+		 *recovered_index_values );
+
+		*recovered_index_values = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes the recovered index values
+ * The allocated number of values is grown by doubling to keep appending linear
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recovered_index_values_resize(
+     libpff_recovered_index_values_t *recovered_index_values,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	void *reallocation             = NULL;
+	static char *function          = "libpff_recovered_index_values_resize";
+	int number_of_allocated_values = 0;
+
+	if( recovered_index_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered index values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_values < 0 )
+	 || ( (size_t) number_of_values > ( (size_t) SSIZE_MAX / ( 2 * sizeof( libpff_recovered_index_value_t ) ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values <= recovered_index_values->number_of_allocated_values )
+	{
+		return( 1 );
+	}
+	number_of_allocated_values = recovered_index_values->number_of_allocated_values;
+
+	if( number_of_allocated_values < 256 )
+	{
+		number_of_allocated_values = 256;
+	}
+	while( number_of_allocated_values < number_of_values )
+	{
+		if( number_of_allocated_values > ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_values = number_of_values;
+
+			break;
+		}
+		number_of_allocated_values *= 2;
+	}
+	reallocation = memory_reallocate(
+	                recovered_index_values->values,
+	                sizeof( libpff_recovered_index_value_t ) * number_of_allocated_values );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize values.",
+		 function );
+
+		return( -1 );
+	}
+	recovered_index_values->values                     = (libpff_recovered_index_value_t *) reallocation;
+	recovered_index_values->number_of_allocated_values = number_of_allocated_values;
+
+	return( 1 );
+}
+
+/* Retrieves the number of recovered index values
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recovered_index_values_get_number_of_values(
+     libpff_recovered_index_values_t *recovered_index_values,
+     int *number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_recovered_index_values_get_number_of_values";
+
+	if( recovered_index_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered index values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of values.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_values = recovered_index_values->number_of_values;
+
+	return( 1 );
+}
+
+/* Appends a recovered index value
+ * Duplicates are allowed and removed by libpff_recovered_index_values_sort
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recovered_index_values_append_value(
+     libpff_recovered_index_values_t *recovered_index_values,
+     uint64_t identifier,
+     uint64_t first_value,
+     uint64_t second_value,
+     off64_t node_data_offset,
+     size64_t node_data_size,
+     libcerror_error_t **error )
+{
+	libpff_recovered_index_value_t *recovered_index_value = NULL;
+	static char *function                                 = "libpff_recovered_index_values_append_value";
+
+	if( recovered_index_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered index values.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovered_index_values->number_of_values == INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_recovered_index_values_resize(
+	     recovered_index_values,
+	     recovered_index_values->number_of_values + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize recovered index values.",
+		 function );
+
+		return( -1 );
+	}
+	recovered_index_value = &( recovered_index_values->values[ recovered_index_values->number_of_values ] );
+
+	recovered_index_value->identifier       = identifier;
+	recovered_index_value->first_value      = first_value;
+	recovered_index_value->second_value     = second_value;
+	recovered_index_value->node_data_offset = node_data_offset;
+	recovered_index_value->node_data_size   = node_data_size;
+	recovered_index_value->sequence_number  = recovered_index_values->number_of_values;
+
+	recovered_index_values->number_of_values += 1;
+
+	return( 1 );
+}
+
+/* Sorts the recovered index values by identifier and removes the duplicates
+ * Values with the same identifier remain in the order they were appended
+ * A value is considered a duplicate if an earlier value has the same identifier,
+ * first and second value
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recovered_index_values_sort(
+     libpff_recovered_index_values_t *recovered_index_values,
+     libcerror_error_t **error )
+{
+	libpff_recovered_index_value_t *recovered_index_value = NULL;
+	static char *function                                 = "libpff_recovered_index_values_sort";
+	int compare_value_index                               = 0;
+	int first_value_index                                 = 0;
+	int number_of_values                                  = 0;
+	int value_index                                       = 0;
+
+	if( recovered_index_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered index values.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovered_index_values->number_of_values <= 1 )
+	{
+		return( 1 );
+	}
+	qsort(
+	 recovered_index_values->values,
+	 (size_t) recovered_index_values->number_of_values,
+	 sizeof( libpff_recovered_index_value_t ),
+	 &libpff_recovered_index_value_compare );
+
+	for( value_index = 0;
+	     value_index < recovered_index_values->number_of_values;
+	     value_index++ )
+	{
+		recovered_index_value = &( recovered_index_values->values[ value_index ] );
+
+		if( ( number_of_values == 0 )
+		 || ( recovered_index_values->values[ number_of_values - 1 ].identifier != recovered_index_value->identifier ) )
+		{
+			first_value_index = number_of_values;
+		}
+		/* The number of values with the same identifier is expected to be small
+		 */
+		for( compare_value_index = first_value_index;
+		     compare_value_index < number_of_values;
+		     compare_value_index++ )
+		{
+			if( ( recovered_index_values->values[ compare_value_index ].first_value == recovered_index_value->first_value )
+			 && ( recovered_index_values->values[ compare_value_index ].second_value == recovered_index_value->second_value ) )
+			{
+				break;
+			}
+		}
+		if( compare_value_index < number_of_values )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: recovered index value: %" PRIu64 " matches existing recovered item value.\n",
+				 function,
+				 recovered_index_value->identifier );
+			}
+#endif
+			continue;
+		}
+		if( number_of_values != value_index )
+		{
+			recovered_index_values->values[ number_of_values ] = *recovered_index_value;
+		}
+		number_of_values++;
+	}
+	recovered_index_values->number_of_values = number_of_values;
+
+	return( 1 );
+}
+
+/* Compares two recovered index values by identifier and sequence number
+ * Used as the qsort comparison function
+ * Returns -1 if first is less than second, 0 if equal or 1 if greater
+ */
+int libpff_recovered_index_value_compare(
+     const void *first_recovered_index_value,
+     const void *second_recovered_index_value )
+{
+	libpff_recovered_index_value_t *first_value  = (libpff_recovered_index_value_t *) first_recovered_index_value;
+	libpff_recovered_index_value_t *second_value = (libpff_recovered_index_value_t *) second_recovered_index_value;
+
+	if( first_value->identifier < second_value->identifier )
+	{
+		return( -1 );
+	}
+	else if( first_value->identifier > second_value->identifier )
+	{
+		return( 1 );
+	}
+	if( first_value->sequence_number < second_value->sequence_number )
+	{
+		return( -1 );
+	}
+	else if( first_value->sequence_number > second_value->sequence_number )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
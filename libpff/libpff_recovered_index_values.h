@@ -0,0 +1,125 @@
+/*
+ * Recovered index values functions
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBPFF_RECOVERED_INDEX_VALUES_H )
+#define _LIBPFF_RECOVERED_INDEX_VALUES_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libpff_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libpff_recovered_index_value libpff_recovered_index_value_t;
+
+struct libpff_recovered_index_value
+{
+	/* The identifier
+	 */
+	uint64_t identifier;
+
+	/* The first value used to detect duplicates
+	 * contains the data identifier of a descriptor index value
+	 * or the file offset of an offset index value
+	 */
+	uint64_t first_value;
+
+	/* The second value used to detect duplicates
+	 * contains the local descriptors identifier of a descriptor index value
+	 * or the data size of an offset index value
+	 */
+	uint64_t second_value;
+
+	/* The (index) node data offset
+	 */
+	off64_t node_data_offset;
+
+	/* The (index) node data size
+	 * contains the index node entry
+	 */
+	size64_t node_data_size;
+
+	/* The order in which the value was appended
+	 */
+	int sequence_number;
+};
+
+typedef struct libpff_recovered_index_values libpff_recovered_index_values_t;
+
+struct libpff_recovered_index_values
+{
+	/* The number of values
+	 */
+	int number_of_values;
+
+	/* The number of allocated values
+	 */
+	int number_of_allocated_values;
+
+	/* The values
+	 */
+	libpff_recovered_index_value_t *values;
+};
+
+int libpff_recovered_index_values_initialize(
+     libpff_recovered_index_values_t **recovered_index_values,
+     libcerror_error_t **error );
+
+int libpff_recovered_index_values_free(
+     libpff_recovered_index_values_t **recovered_index_values,
+     libcerror_error_t **error );
+
+int libpff_recovered_index_values_resize(
+     libpff_recovered_index_values_t *recovered_index_values,
+     int number_of_values,
+     libcerror_error_t **error );
+
+int libpff_recovered_index_values_get_number_of_values(
+     libpff_recovered_index_values_t *recovered_index_values,
+     int *number_of_values,
+     libcerror_error_t **error );
+
+int libpff_recovered_index_values_append_value(
+     libpff_recovered_index_values_t *recovered_index_values,
+     uint64_t identifier,
+     uint64_t first_value,
+     uint64_t second_value,
+     off64_t node_data_offset,
+     size64_t node_data_size,
+     libcerror_error_t **error );
+
+int libpff_recovered_index_values_sort(
+     libpff_recovered_index_values_t *recovered_index_values,
+     libcerror_error_t **error );
+
+int libpff_recovered_index_value_compare(
+     const void *first_recovered_index_value,
+     const void *second_recovered_index_value );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -0,0 +1,893 @@
+/*
+ * Recovery checkpoint functions
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libpff_definitions.h"
+#include "libpff_libbfio.h"
+#include "libpff_libcerror.h"
+#include "libpff_libcnotify.h"
+#include "libpff_libfmapi.h"
+#include "libpff_recovered_index_values.h"
+#include "libpff_recovery_checkpoint.h"
+
+const uint8_t libpff_recovery_checkpoint_signature[ 8 ] = { 'p', 'f', 'f', 'r', 'c', 'k', 'p', 0x01 };
+
+/* Initializes the recovery checkpoint
+ * The recovery checkpoint takes over the management of the file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recovery_checkpoint_initialize(
+     libpff_recovery_checkpoint_t **recovery_checkpoint,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_recovery_checkpoint_initialize";
+
+	if( recovery_checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovery checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( *recovery_checkpoint != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid recovery checkpoint value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	*recovery_checkpoint = memory_allocate_structure(
+	                        libpff_recovery_checkpoint_t );
+
+	if( *recovery_checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create recovery checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *recovery_checkpoint,
+	     0,
+	     sizeof( libpff_recovery_checkpoint_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear recovery checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	( *recovery_checkpoint )->file_io_handle = file_io_handle;
+	( *recovery_checkpoint )->stage          = LIBPFF_RECOVERY_STAGE_NONE;
+	( *recovery_checkpoint )->record_offset  = (off64_t) sizeof( libpff_recovery_checkpoint_header_t );
+
+	return( 1 );
+
+on_error:
+	if( *recovery_checkpoint != NULL )
+	{
+		memory_free(
+		 *recovery_checkpoint );
+
+		*recovery_checkpoint = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees the recovery checkpoint
+ * Closes and frees the file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recovery_checkpoint_free(
+     libpff_recovery_checkpoint_t **recovery_checkpoint,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_recovery_checkpoint_free";
+	int result            = 1;
+
+	if( recovery_checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovery checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( *recovery_checkpoint != NULL )
+	{
+		if( libbfio_handle_close(
+		     ( *recovery_checkpoint )->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		if( libbfio_handle_free(
+		     &( ( *recovery_checkpoint )->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *recovery_checkpoint );
+
+		*recovery_checkpoint = NULL;
+	}
+	return( result );
+}
+
+/* Reads the recovery checkpoint
+ * The recovered index values stored in the checkpoint are appended to the recovered index values
+ * Returns 1 if successful, 0 if the checkpoint file is empty or -1 on error
+ */
+int libpff_recovery_checkpoint_read(
+     libpff_recovery_checkpoint_t *recovery_checkpoint,
+     size64_t file_size,
+     uint8_t file_type,
+     uint8_t recovery_flags,
+     libpff_recovered_index_values_t *recovered_descriptor_index_values,
+     libpff_recovered_index_values_t *recovered_offset_index_values,
+     libcerror_error_t **error )
+{
+	libpff_recovery_checkpoint_header_t header;
+	libpff_recovery_checkpoint_record_t records[ LIBPFF_RECOVERY_CHECKPOINT_NUMBER_OF_BUFFERED_RECORDS ];
+
+	libpff_recovery_checkpoint_record_t *record  = NULL;
+	libpff_recovered_index_values_t *index_values = NULL;
+	static char *function                         = "libpff_recovery_checkpoint_read";
+	size64_t checkpoint_file_size                 = 0;
+	size64_t stored_file_size                     = 0;
+	size64_t node_data_size                       = 0;
+	size_t read_size                              = 0;
+	ssize_t read_count                            = 0;
+	off64_t node_data_offset                      = 0;
+	off64_t scan_offset                           = 0;
+	uint64_t first_value                          = 0;
+	uint64_t identifier                           = 0;
+	uint64_t second_value                         = 0;
+	uint32_t calculated_crc                       = 0;
+	uint32_t number_of_descriptor_index_values    = 0;
+	uint32_t number_of_offset_index_values        = 0;
+	uint32_t number_of_records                    = 0;
+	uint32_t record_index                         = 0;
+	uint32_t stored_crc                           = 0;
+	int buffered_record_index                     = 0;
+	int number_of_buffered_records                = 0;
+
+	if( recovery_checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovery checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovered_descriptor_index_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered descriptor index values.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovered_offset_index_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered offset index values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     recovery_checkpoint->file_io_handle,
+	     &checkpoint_file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve checkpoint file size.",
+		 function );
+
+		return( -1 );
+	}
+	if( checkpoint_file_size == 0 )
+	{
+		return( 0 );
+	}
+	if( libbfio_handle_seek_offset(
+	     recovery_checkpoint->file_io_handle,
+	     0,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek checkpoint header offset: 0.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer(
+	              recovery_checkpoint->file_io_handle,
+	              (uint8_t *) &header,
+	              sizeof( libpff_recovery_checkpoint_header_t ),
+	              error );
+
+	if( read_count != (ssize_t) sizeof( libpff_recovery_checkpoint_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read checkpoint header.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     header.signature,
+	     libpff_recovery_checkpoint_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_SIGNATURE_MISMATCH,
+		 "%s: invalid checkpoint signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 header.crc,
+	 stored_crc );
+
+	if( libfmapi_crc32_weak_calculate(
+	     &calculated_crc,
+	     &( ( (uint8_t *) &header )[ 12 ] ),
+	     sizeof( libpff_recovery_checkpoint_header_t ) - 12,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unable to calculate CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_crc != calculated_crc )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in checkpoint header CRC-32 ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
+		 function,
+		 stored_crc,
+		 calculated_crc );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 header.file_size,
+	 stored_file_size );
+
+	if( ( stored_file_size != file_size )
+	 || ( header.file_type != file_type )
+	 || ( header.recovery_flags != recovery_flags ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: checkpoint does not match the file or recovery flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( header.stage != LIBPFF_RECOVERY_STAGE_INDEX_TREES )
+	 && ( header.stage != LIBPFF_RECOVERY_STAGE_UNALLOCATED_SPACE )
+	 && ( header.stage != LIBPFF_RECOVERY_STAGE_ITEMS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported checkpoint stage: %" PRIu8 ".",
+		 function,
+		 header.stage );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 header.scan_offset,
+	 scan_offset );
+	byte_stream_copy_to_uint32_little_endian(
+	 header.number_of_descriptor_index_values,
+	 number_of_descriptor_index_values );
+	byte_stream_copy_to_uint32_little_endian(
+	 header.number_of_offset_index_values,
+	 number_of_offset_index_values );
+
+	if( ( scan_offset < 0 )
+	 || ( (size64_t) scan_offset > file_size )
+	 || ( number_of_descriptor_index_values > (uint32_t) INT_MAX )
+	 || ( number_of_offset_index_values > (uint32_t) INT_MAX )
+	 || ( number_of_descriptor_index_values > ( (uint32_t) INT_MAX - number_of_offset_index_values ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid checkpoint header value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_records = number_of_descriptor_index_values + number_of_offset_index_values;
+
+	if( ( (size64_t) number_of_records * sizeof( libpff_recovery_checkpoint_record_t ) )
+	 > ( checkpoint_file_size - sizeof( libpff_recovery_checkpoint_header_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value exceeds checkpoint file size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Records past the number of records in the header were written
+	 * after the last completed checkpoint and are ignored
+	 */
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( buffered_record_index >= number_of_buffered_records )
+		{
+			number_of_buffered_records = LIBPFF_RECOVERY_CHECKPOINT_NUMBER_OF_BUFFERED_RECORDS;
+
+			if( (uint32_t) number_of_buffered_records > ( number_of_records - record_index ) )
+			{
+				number_of_buffered_records = (int) ( number_of_records - record_index );
+			}
+			read_size = sizeof( libpff_recovery_checkpoint_record_t ) * number_of_buffered_records;
+
+			read_count = libbfio_handle_read_buffer(
+			              recovery_checkpoint->file_io_handle,
+			              (uint8_t *) records,
+			              read_size,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read checkpoint records.",
+				 function );
+
+				return( -1 );
+			}
+			buffered_record_index = 0;
+		}
+		record = &( records[ buffered_record_index++ ] );
+
+		if( record->index_type == LIBPFF_INDEX_TYPE_DESCRIPTOR )
+		{
+			index_values = recovered_descriptor_index_values;
+		}
+		else if( record->index_type == LIBPFF_INDEX_TYPE_OFFSET )
+		{
+			index_values = recovered_offset_index_values;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported checkpoint record: %" PRIu32 " index type: 0x%02" PRIx8 ".",
+			 function,
+			 record_index,
+			 record->index_type );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 record->identifier,
+		 identifier );
+		byte_stream_copy_to_uint64_little_endian(
+		 record->first_value,
+		 first_value );
+		byte_stream_copy_to_uint64_little_endian(
+		 record->second_value,
+		 second_value );
+		byte_stream_copy_to_uint64_little_endian(
+		 record->node_data_offset,
+		 node_data_offset );
+		byte_stream_copy_to_uint64_little_endian(
+		 record->node_data_size,
+		 node_data_size );
+
+		if( libpff_recovered_index_values_append_value(
+		     index_values,
+		     identifier,
+		     first_value,
+		     second_value,
+		     node_data_offset,
+		     node_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append checkpoint record: %" PRIu32 ".",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+	}
+	if( ( recovered_descriptor_index_values->number_of_values != (int) number_of_descriptor_index_values )
+	 || ( recovered_offset_index_values->number_of_values != (int) number_of_offset_index_values ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: mismatch in number of checkpoint records per index type.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: resuming recovery in stage: %" PRIu8 " at offset: %" PRIi64 " with: %" PRIu32 " descriptor and: %" PRIu32 " offset index values.\n",
+		 function,
+		 header.stage,
+		 scan_offset,
+		 number_of_descriptor_index_values,
+		 number_of_offset_index_values );
+	}
+#endif
+	recovery_checkpoint->stage                             = header.stage;
+	recovery_checkpoint->scan_offset                       = scan_offset;
+	recovery_checkpoint->number_of_descriptor_index_values = (int) number_of_descriptor_index_values;
+	recovery_checkpoint->number_of_offset_index_values     = (int) number_of_offset_index_values;
+	recovery_checkpoint->record_offset                     = (off64_t) ( sizeof( libpff_recovery_checkpoint_header_t )
+	                                                       + ( (size64_t) number_of_records * sizeof( libpff_recovery_checkpoint_record_t ) ) );
+
+	return( 1 );
+}
+
+/* Appends the records of the recovered index values not yet stored in the checkpoint file
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recovery_checkpoint_write_records(
+     libpff_recovery_checkpoint_t *recovery_checkpoint,
+     libpff_recovered_index_values_t *recovered_index_values,
+     uint8_t index_type,
+     int first_value_index,
+     libcerror_error_t **error )
+{
+	libpff_recovery_checkpoint_record_t records[ LIBPFF_RECOVERY_CHECKPOINT_NUMBER_OF_BUFFERED_RECORDS ];
+
+	libpff_recovered_index_value_t *recovered_index_value = NULL;
+	libpff_recovery_checkpoint_record_t *record           = NULL;
+	static char *function                                 = "libpff_recovery_checkpoint_write_records";
+	size_t write_size                                     = 0;
+	ssize_t write_count                                   = 0;
+	int number_of_buffered_records                        = 0;
+	int value_index                                       = 0;
+
+	if( recovery_checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovery checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovered_index_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered index values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_value_index < 0 )
+	 || ( first_value_index > recovered_index_values->number_of_values ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first value index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     records,
+	     0,
+	     sizeof( libpff_recovery_checkpoint_record_t ) * LIBPFF_RECOVERY_CHECKPOINT_NUMBER_OF_BUFFERED_RECORDS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear records.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = first_value_index;
+	     value_index < recovered_index_values->number_of_values;
+	     value_index++ )
+	{
+		recovered_index_value = &( recovered_index_values->values[ value_index ] );
+		record                = &( records[ number_of_buffered_records++ ] );
+
+		record->index_type = index_type;
+
+		byte_stream_copy_from_uint64_little_endian(
+		 record->identifier,
+		 recovered_index_value->identifier );
+		byte_stream_copy_from_uint64_little_endian(
+		 record->first_value,
+		 recovered_index_value->first_value );
+		byte_stream_copy_from_uint64_little_endian(
+		 record->second_value,
+		 recovered_index_value->second_value );
+		byte_stream_copy_from_uint64_little_endian(
+		 record->node_data_offset,
+		 recovered_index_value->node_data_offset );
+		byte_stream_copy_from_uint64_little_endian(
+		 record->node_data_size,
+		 recovered_index_value->node_data_size );
+
+		if( ( number_of_buffered_records == LIBPFF_RECOVERY_CHECKPOINT_NUMBER_OF_BUFFERED_RECORDS )
+		 || ( ( value_index + 1 ) == recovered_index_values->number_of_values ) )
+		{
+			write_size = sizeof( libpff_recovery_checkpoint_record_t ) * number_of_buffered_records;
+
+			write_count = libbfio_handle_write_buffer(
+			               recovery_checkpoint->file_io_handle,
+			               (uint8_t *) records,
+			               write_size,
+			               error );
+
+			if( write_count != (ssize_t) write_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write checkpoint records.",
+				 function );
+
+				return( -1 );
+			}
+			recovery_checkpoint->record_offset += (off64_t) write_size;
+
+			number_of_buffered_records = 0;
+		}
+	}
+	return( 1 );
+}
+
+/* Writes the recovery checkpoint
+ * The records of the new recovered index values are appended before the header is updated
+ * so that an interrupted write leaves the previous checkpoint intact
+ * Unless forced the checkpoint is written at most once per checkpoint interval
+ * Returns 1 if successful, 0 if not written or -1 on error
+ */
+int libpff_recovery_checkpoint_write(
+     libpff_recovery_checkpoint_t *recovery_checkpoint,
+     uint8_t stage,
+     off64_t scan_offset,
+     size64_t file_size,
+     uint8_t file_type,
+     uint8_t recovery_flags,
+     libpff_recovered_index_values_t *recovered_descriptor_index_values,
+     libpff_recovered_index_values_t *recovered_offset_index_values,
+     uint8_t force_write,
+     libcerror_error_t **error )
+{
+	libpff_recovery_checkpoint_header_t header;
+
+	static char *function = "libpff_recovery_checkpoint_write";
+	time_t current_time   = 0;
+	ssize_t write_count   = 0;
+	uint32_t crc          = 0;
+
+	if( recovery_checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovery checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovered_descriptor_index_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered descriptor index values.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovered_offset_index_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered offset index values.",
+		 function );
+
+		return( -1 );
+	}
+	current_time = time( NULL );
+
+	if( ( force_write == 0 )
+	 && ( ( current_time - recovery_checkpoint->last_write_time ) < LIBPFF_RECOVERY_CHECKPOINT_INTERVAL ) )
+	{
+		return( 0 );
+	}
+	if( libbfio_handle_seek_offset(
+	     recovery_checkpoint->file_io_handle,
+	     recovery_checkpoint->record_offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek checkpoint record offset: %" PRIi64 ".",
+		 function,
+		 recovery_checkpoint->record_offset );
+
+		return( -1 );
+	}
+	if( libpff_recovery_checkpoint_write_records(
+	     recovery_checkpoint,
+	     recovered_descriptor_index_values,
+	     LIBPFF_INDEX_TYPE_DESCRIPTOR,
+	     recovery_checkpoint->number_of_descriptor_index_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write recovered descriptor index values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_recovery_checkpoint_write_records(
+	     recovery_checkpoint,
+	     recovered_offset_index_values,
+	     LIBPFF_INDEX_TYPE_OFFSET,
+	     recovery_checkpoint->number_of_offset_index_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write recovered offset index values.",
+		 function );
+
+		return( -1 );
+	}
+	recovery_checkpoint->number_of_descriptor_index_values = recovered_descriptor_index_values->number_of_values;
+	recovery_checkpoint->number_of_offset_index_values     = recovered_offset_index_values->number_of_values;
+
+	if( memory_set(
+	     &header,
+	     0,
+	     sizeof( libpff_recovery_checkpoint_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear header.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     header.signature,
+	     libpff_recovery_checkpoint_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	header.stage          = stage;
+	header.recovery_flags = recovery_flags;
+	header.file_type      = file_type;
+
+	byte_stream_copy_from_uint64_little_endian(
+	 header.file_size,
+	 file_size );
+	byte_stream_copy_from_uint64_little_endian(
+	 header.scan_offset,
+	 scan_offset );
+	byte_stream_copy_from_uint32_little_endian(
+	 header.number_of_descriptor_index_values,
+	 recovery_checkpoint->number_of_descriptor_index_values );
+	byte_stream_copy_from_uint32_little_endian(
+	 header.number_of_offset_index_values,
+	 recovery_checkpoint->number_of_offset_index_values );
+
+	if( libfmapi_crc32_weak_calculate(
+	     &crc,
+	     &( ( (uint8_t *) &header )[ 12 ] ),
+	     sizeof( libpff_recovery_checkpoint_header_t ) - 12,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unable to calculate CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 header.crc,
+	 crc );
+
+	if( libbfio_handle_seek_offset(
+	     recovery_checkpoint->file_io_handle,
+	     0,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek checkpoint header offset: 0.",
+		 function );
+
+		return( -1 );
+	}
+	write_count = libbfio_handle_write_buffer(
+	               recovery_checkpoint->file_io_handle,
+	               (uint8_t *) &header,
+	               sizeof( libpff_recovery_checkpoint_header_t ),
+	               error );
+
+	if( write_count != (ssize_t) sizeof( libpff_recovery_checkpoint_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write checkpoint header.",
+		 function );
+
+		return( -1 );
+	}
+	recovery_checkpoint->stage           = stage;
+	recovery_checkpoint->scan_offset     = scan_offset;
+	recovery_checkpoint->last_write_time = current_time;
+
+	return( 1 );
+}
+
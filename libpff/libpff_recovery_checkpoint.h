@@ -0,0 +1,215 @@
+/*
+ * Recovery checkpoint functions
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBPFF_RECOVERY_CHECKPOINT_H )
+#define _LIBPFF_RECOVERY_CHECKPOINT_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( TIME_WITH_SYS_TIME )
+#include <sys/time.h>
+#include <time.h>
+#elif defined( HAVE_SYS_TIME_H )
+#include <sys/time.h>
+#else
+#include <time.h>
+#endif
+
+#include "libpff_definitions.h"
+#include "libpff_libbfio.h"
+#include "libpff_libcerror.h"
+#include "libpff_recovered_index_values.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libpff_recovery_checkpoint_header libpff_recovery_checkpoint_header_t;
+
+struct libpff_recovery_checkpoint_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Contains: "pffrckp\x01"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* A weak CRC32 of the header data after the CRC
+	 * Consists of 4 bytes
+	 */
+	uint8_t crc[ 4 ];
+
+	/* The stage the recovery is resumed in
+	 * Consists of 1 byte
+	 */
+	uint8_t stage;
+
+	/* The recovery flags
+	 * Consists of 1 byte
+	 */
+	uint8_t recovery_flags;
+
+	/* The file type
+	 * Consists of 1 byte
+	 */
+	uint8_t file_type;
+
+	/* Padding
+	 * Consists of 1 byte
+	 */
+	uint8_t padding1;
+
+	/* The size of the recovered file
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_size[ 8 ];
+
+	/* The offset the unallocated space scan is resumed at
+	 * Consists of 8 bytes
+	 */
+	uint8_t scan_offset[ 8 ];
+
+	/* The number of recovered descriptor index values
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_descriptor_index_values[ 4 ];
+
+	/* The number of recovered offset index values
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_offset_index_values[ 4 ];
+
+	/* Padding
+	 * Consists of 24 bytes
+	 */
+	uint8_t padding2[ 24 ];
+};
+
+typedef struct libpff_recovery_checkpoint_record libpff_recovery_checkpoint_record_t;
+
+struct libpff_recovery_checkpoint_record
+{
+	/* The index type
+	 * Consists of 1 byte
+	 */
+	uint8_t index_type;
+
+	/* Padding
+	 * Consists of 7 bytes
+	 */
+	uint8_t padding1[ 7 ];
+
+	/* The identifier
+	 * Consists of 8 bytes
+	 */
+	uint8_t identifier[ 8 ];
+
+	/* The first value
+	 * Consists of 8 bytes
+	 */
+	uint8_t first_value[ 8 ];
+
+	/* The second value
+	 * Consists of 8 bytes
+	 */
+	uint8_t second_value[ 8 ];
+
+	/* The (index) node data offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t node_data_offset[ 8 ];
+
+	/* The (index) node data size
+	 * Consists of 8 bytes
+	 */
+	uint8_t node_data_size[ 8 ];
+};
+
+typedef struct libpff_recovery_checkpoint libpff_recovery_checkpoint_t;
+
+struct libpff_recovery_checkpoint
+{
+	/* The checkpoint file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The stage the recovery is resumed in
+	 */
+	uint8_t stage;
+
+	/* The offset the unallocated space scan is resumed at
+	 */
+	off64_t scan_offset;
+
+	/* The number of recovered descriptor index values stored in the checkpoint file
+	 */
+	int number_of_descriptor_index_values;
+
+	/* The number of recovered offset index values stored in the checkpoint file
+	 */
+	int number_of_offset_index_values;
+
+	/* The offset of the next record in the checkpoint file
+	 */
+	off64_t record_offset;
+
+	/* The time the checkpoint was last written
+	 */
+	time_t last_write_time;
+};
+
+int libpff_recovery_checkpoint_initialize(
+     libpff_recovery_checkpoint_t **recovery_checkpoint,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libpff_recovery_checkpoint_free(
+     libpff_recovery_checkpoint_t **recovery_checkpoint,
+     libcerror_error_t **error );
+
+int libpff_recovery_checkpoint_read(
+     libpff_recovery_checkpoint_t *recovery_checkpoint,
+     size64_t file_size,
+     uint8_t file_type,
+     uint8_t recovery_flags,
+     libpff_recovered_index_values_t *recovered_descriptor_index_values,
+     libpff_recovered_index_values_t *recovered_offset_index_values,
+     libcerror_error_t **error );
+
+int libpff_recovery_checkpoint_write(
+     libpff_recovery_checkpoint_t *recovery_checkpoint,
+     uint8_t stage,
+     off64_t scan_offset,
+     size64_t file_size,
+     uint8_t file_type,
+     uint8_t recovery_flags,
+     libpff_recovered_index_values_t *recovered_descriptor_index_values,
+     libpff_recovered_index_values_t *recovered_offset_index_values,
+     uint8_t force_write,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
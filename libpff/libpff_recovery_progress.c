@@ -0,0 +1,354 @@
+/*
+ * Recovery progress functions
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libpff_definitions.h"
+#include "libpff_libcerror.h"
+#include "libpff_recovery_progress.h"
+
+/* Initializes the recovery progress
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recovery_progress_initialize(
+     libpff_recovery_progress_t **recovery_progress,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_recovery_progress_initialize";
+
+	if( recovery_progress == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovery progress.",
+		 function );
+
+		return( -1 );
+	}
+	if( *recovery_progress != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid recovery progress value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*recovery_progress = memory_allocate_structure(
+	                      libpff_recovery_progress_t );
+
+	if( *recovery_progress == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create recovery progress.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *recovery_progress,
+	     0,
+	     sizeof( libpff_recovery_progress_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear recovery progress.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *recovery_progress != NULL )
+	{
+		memory_free(
+		 *recovery_progress );
+
+		*recovery_progress = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees the recovery progress
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recovery_progress_free(
+     libpff_recovery_progress_t **recovery_progress,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_recovery_progress_free";
+
+	if( recovery_progress == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovery progress.",
+		 function );
+
+		return( -1 );
+	}
+	if( *recovery_progress != NULL )
+	{
+		/* The file and callback data are not managed by the recovery progress
+		 */
+		memory_free(
+		 *recovery_progress );
+
+		*recovery_progress = NULL;
+	}
+	return( 1 );
+}
+
+/* Starts the recovery progress
+ * Clears the values of a previous recovery but retains the callback
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recovery_progress_start(
+     libpff_recovery_progress_t *recovery_progress,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_recovery_progress_start";
+
+	if( recovery_progress == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovery progress.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     recovery_progress->number_of_candidates,
+	     0,
+	     sizeof( uint64_t ) * LIBPFF_RECOVERY_PROGRESS_NUMBER_OF_COUNTERS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear number of candidates.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     recovery_progress->number_of_validated,
+	     0,
+	     sizeof( uint64_t ) * LIBPFF_RECOVERY_PROGRESS_NUMBER_OF_COUNTERS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear number of validated.",
+		 function );
+
+		return( -1 );
+	}
+	recovery_progress->stage            = LIBPFF_RECOVERY_STAGE_NONE;
+	recovery_progress->current_offset   = 0;
+	recovery_progress->bytes_scanned    = 0;
+	recovery_progress->bytes_to_scan    = 0;
+	recovery_progress->start_time       = time( NULL );
+	recovery_progress->scan_start_time  = 0;
+	recovery_progress->scan_end_time    = 0;
+	recovery_progress->last_report_time = recovery_progress->start_time;
+
+	return( 1 );
+}
+
+/* Sets the current stage
+ * The bytes to scan only apply to the unallocated space stage
+ * The progress is always reported when the stage changes
+ * Returns 1 if successful, 0 if the callback function requested to cancel or -1 on error
+ */
+int libpff_recovery_progress_set_stage(
+     libpff_recovery_progress_t *recovery_progress,
+     uint8_t stage,
+     size64_t bytes_to_scan,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_recovery_progress_set_stage";
+
+	if( recovery_progress == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovery progress.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( stage != LIBPFF_RECOVERY_STAGE_INDEX_TREES )
+	 && ( stage != LIBPFF_RECOVERY_STAGE_UNALLOCATED_SPACE )
+	 && ( stage != LIBPFF_RECOVERY_STAGE_ITEMS )
+	 && ( stage != LIBPFF_RECOVERY_STAGE_COMPLETED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported stage.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovery_progress->stage == LIBPFF_RECOVERY_STAGE_UNALLOCATED_SPACE )
+	{
+		recovery_progress->scan_end_time = time( NULL );
+	}
+	if( stage == LIBPFF_RECOVERY_STAGE_UNALLOCATED_SPACE )
+	{
+		recovery_progress->current_offset  = 0;
+		recovery_progress->bytes_scanned   = 0;
+		recovery_progress->bytes_to_scan   = bytes_to_scan;
+		recovery_progress->scan_start_time = time( NULL );
+		recovery_progress->scan_end_time   = 0;
+	}
+	recovery_progress->stage = stage;
+
+	return( libpff_recovery_progress_report(
+	         recovery_progress,
+	         1,
+	         error ) );
+}
+
+/* Reports the progress to the callback function
+ * Unless forced the callback function is called at most once per report interval
+ * Returns 1 if successful, 0 if the callback function requested to cancel or -1 on error
+ */
+int libpff_recovery_progress_report(
+     libpff_recovery_progress_t *recovery_progress,
+     uint8_t force_report,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_recovery_progress_report";
+	time_t current_time   = 0;
+
+	if( recovery_progress == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovery progress.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovery_progress->callback_function == NULL )
+	{
+		return( 1 );
+	}
+	current_time = time( NULL );
+
+	if( ( force_report == 0 )
+	 && ( ( current_time - recovery_progress->last_report_time ) < LIBPFF_RECOVERY_PROGRESS_REPORT_INTERVAL ) )
+	{
+		return( 1 );
+	}
+	recovery_progress->last_report_time = current_time;
+
+	if( recovery_progress->callback_function(
+	     recovery_progress->file,
+	     recovery_progress->callback_data ) != 1 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the throughput of the unallocated space scan
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recovery_progress_get_bytes_per_second(
+     libpff_recovery_progress_t *recovery_progress,
+     uint64_t *bytes_per_second,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_recovery_progress_get_bytes_per_second";
+	time_t current_time   = 0;
+
+	if( recovery_progress == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovery progress.",
+		 function );
+
+		return( -1 );
+	}
+	if( bytes_per_second == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bytes per second.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovery_progress->scan_end_time != 0 )
+	{
+		current_time = recovery_progress->scan_end_time;
+	}
+	else
+	{
+		current_time = time( NULL );
+	}
+	if( recovery_progress->scan_start_time == 0 )
+	{
+		*bytes_per_second = 0;
+	}
+	else if( current_time > recovery_progress->scan_start_time )
+	{
+		*bytes_per_second = (uint64_t) recovery_progress->bytes_scanned
+		                  / (uint64_t) ( current_time - recovery_progress->scan_start_time );
+	}
+	else
+	{
+		*bytes_per_second = (uint64_t) recovery_progress->bytes_scanned;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,137 @@
+/*
+ * Recovery progress functions
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBPFF_RECOVERY_PROGRESS_H )
+#define _LIBPFF_RECOVERY_PROGRESS_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( TIME_WITH_SYS_TIME )
+#include <sys/time.h>
+#include <time.h>
+#elif defined( HAVE_SYS_TIME_H )
+#include <sys/time.h>
+#else
+#include <time.h>
+#endif
+
+#include "libpff_definitions.h"
+#include "libpff_libcerror.h"
+#include "libpff_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libpff_recovery_progress libpff_recovery_progress_t;
+
+struct libpff_recovery_progress
+{
+	/* The current stage
+	 */
+	uint8_t stage;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The number of bytes of the unallocated space scanned
+	 */
+	size64_t bytes_scanned;
+
+	/* The number of bytes of the unallocated space to scan
+	 */
+	size64_t bytes_to_scan;
+
+	/* The number of candidates per counter
+	 */
+	uint64_t number_of_candidates[ LIBPFF_RECOVERY_PROGRESS_NUMBER_OF_COUNTERS ];
+
+	/* The number of validated candidates per counter
+	 */
+	uint64_t number_of_validated[ LIBPFF_RECOVERY_PROGRESS_NUMBER_OF_COUNTERS ];
+
+	/* The time the recovery started
+	 */
+	time_t start_time;
+
+	/* The time the unallocated space scan started
+	 */
+	time_t scan_start_time;
+
+	/* The time the unallocated space scan completed
+	 */
+	time_t scan_end_time;
+
+	/* The time the progress was last reported
+	 */
+	time_t last_report_time;
+
+	/* The file passed to the callback function
+	 */
+	libpff_file_t *file;
+
+	/* The callback function
+	 */
+	int (*callback_function)(
+	       libpff_file_t *file,
+	       intptr_t *callback_data );
+
+	/* The callback data
+	 */
+	intptr_t *callback_data;
+};
+
+int libpff_recovery_progress_initialize(
+     libpff_recovery_progress_t **recovery_progress,
+     libcerror_error_t **error );
+
+int libpff_recovery_progress_free(
+     libpff_recovery_progress_t **recovery_progress,
+     libcerror_error_t **error );
+
+int libpff_recovery_progress_start(
+     libpff_recovery_progress_t *recovery_progress,
+     libcerror_error_t **error );
+
+int libpff_recovery_progress_set_stage(
+     libpff_recovery_progress_t *recovery_progress,
+     uint8_t stage,
+     size64_t bytes_to_scan,
+     libcerror_error_t **error );
+
+int libpff_recovery_progress_report(
+     libpff_recovery_progress_t *recovery_progress,
+     uint8_t force_report,
+     libcerror_error_t **error );
+
+int libpff_recovery_progress_get_bytes_per_second(
+     libpff_recovery_progress_t *recovery_progress,
+     uint64_t *bytes_per_second,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libpff_arena.h"
 #include "libpff_array_type.h"
 #include "libpff_column_definition.h"
 #include "libpff_data_array.h"
@@ -52,11 +53,13 @@
 #include "pff_table.h"
 
 /* Initializes the table index values
+ * The table index values are allocated from the arena of the table
  * Returns 1 if successful or -1 on error
  */
 int libpff_table_index_values_initialize(
      libpff_table_index_values_t **table_index_values,
      uint16_t number_of_values,
+     libpff_arena_t *arena,
      libcerror_error_t **error )
 {
 	static char *function          = "libpff_table_index_values_initialize";
@@ -84,10 +87,16 @@ int libpff_table_index_values_initialize(
 
 		return( -1 );
 	}
-	*table_index_values = memory_allocate_structure(
-	                       libpff_table_index_values_t );
+	/* The values are stored directly after the structure
+	 */
+	table_index_values_size = sizeof( libpff_table_index_values_t )
+	                        + ( sizeof( libpff_table_index_value_t ) * number_of_values );
 
-	if( *table_index_values == NULL )
+	if( libpff_arena_allocate(
+	     arena,
+	     table_index_values_size,
+	     (void **) table_index_values,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -96,114 +105,21 @@ int libpff_table_index_values_initialize(
 		 "%s: unable to create table index values.",
 		 function );
 
-		goto on_error;
-	}
-	if( memory_set(
-	     *table_index_values,
-	     0,
-	     sizeof( libpff_table_index_values_t ) ) == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear table index values.",
-		 function );
-
-		memory_free(
-		 *table_index_values );
-
-		*table_index_values = NULL;
-
 		return( -1 );
 	}
-/* TODO replace by array type ? */
-	table_index_values_size = sizeof( libpff_table_index_value_t ) * number_of_values;
-
-	( *table_index_values )->value = (libpff_table_index_value_t *) memory_allocate(
-	                                                                 table_index_values_size );
-
-	if( ( *table_index_values )->value == NULL )
+	if( number_of_values > 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create table index values.",
-		 function );
-
-		goto on_error;
-	}
-	if( memory_set(
-	     ( *table_index_values )->value,
-	     0,
-	     table_index_values_size ) == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear table index values.",
-		 function );
-
-		goto on_error;
+		( *table_index_values )->value = (libpff_table_index_value_t *) &( ( *table_index_values )[ 1 ] );
 	}
 	( *table_index_values )->number_of_values = number_of_values;
 
 	return( 1 );
-
-on_error:
-	if( *table_index_values != NULL )
-	{
-		if( ( *table_index_values )->value != NULL )
-		{
-			memory_free(
-			 ( *table_index_values )->value );
-		}
-		memory_free(
-		 *table_index_values );
-
-		*table_index_values = NULL;
-	}
-	return( -1 );
-}
-
-/* Frees table index values
- * Returns 1 if successful or -1 on error
- */
-int libpff_table_index_values_free(
-     libpff_table_index_values_t **table_index_values,
-     libcerror_error_t **error )
-{
-	static char *function = "libpff_table_index_values_free";
-
-	if( table_index_values == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid table index values.",
-		 function );
-
-		return( -1 );
-	}
-	if( *table_index_values != NULL )
-	{
-		if( ( *table_index_values )->value != NULL )
-		{
-			memory_free(
-			 ( *table_index_values )->value );
-		}
-		memory_free(
-		 *table_index_values );
-
-		*table_index_values = NULL;
-	}
-	return( 1 );
 }
 
 /* Resizes the record entries
+ * The record entries of the sets are allocated from the arena of the table,
+ * when the number of entries grows the entries are copied to a larger allocation
+ * and the previous allocation is reclaimed when the table is freed
  * Returns 1 if successful or -1 on error
  */
 int libpff_record_entries_resize(
@@ -212,9 +128,10 @@ int libpff_record_entries_resize(
      int number_of_entries,
      libcerror_error_t **error )
 {
-	static char *function = "libpff_record_entries_resize";
-	void *reallocation    = NULL;
-	int set_iterator      = 0;
+	libpff_record_entry_t *record_entries = NULL;
+	static char *function                 = "libpff_record_entries_resize";
+	void *reallocation                    = NULL;
+	int set_iterator                      = 0;
 
 	if( table == NULL )
 	{
@@ -249,6 +166,56 @@ int libpff_record_entries_resize(
 
 		return( -1 );
 	}
+	if( number_of_entries < table->number_of_entries )
+	{
+		number_of_entries = table->number_of_entries;
+	}
+	if( number_of_entries > table->number_of_entries )
+	{
+		for( set_iterator = 0;
+		     set_iterator < table->number_of_sets;
+		     set_iterator++ )
+		{
+			record_entries = NULL;
+
+			if( libpff_arena_allocate(
+			     table->arena,
+			     sizeof( libpff_record_entry_t ) * number_of_entries,
+			     (void **) &record_entries,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize record entries for set: %d.",
+				 function,
+				 set_iterator );
+
+				return( -1 );
+			}
+			if( table->number_of_entries > 0 )
+			{
+				if( memory_copy(
+				     record_entries,
+				     table->entry[ set_iterator ],
+				     sizeof( libpff_record_entry_t ) * table->number_of_entries ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy record entries for set: %d.",
+					 function,
+					 set_iterator );
+
+					return( -1 );
+				}
+			}
+			table->entry[ set_iterator ] = record_entries;
+		}
+		table->number_of_entries = number_of_entries;
+	}
 	if( number_of_sets > table->number_of_sets )
 	{
 		reallocation = memory_reallocate(
@@ -286,10 +253,11 @@ int libpff_record_entries_resize(
 		     set_iterator < number_of_sets;
 		     set_iterator++ )
 		{
-			table->entry[ set_iterator ] = (libpff_record_entry_t *) memory_allocate(
-			                                                          sizeof( libpff_record_entry_t ) * table->number_of_entries );
-
-			if( table->entry[ set_iterator ] == NULL )
+			if( libpff_arena_allocate(
+			     table->arena,
+			     sizeof( libpff_record_entry_t ) * table->number_of_entries,
+			     (void **) &( table->entry[ set_iterator ] ),
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
@@ -301,67 +269,9 @@ int libpff_record_entries_resize(
 
 				return( -1 );
 			}
-			if( memory_set(
-			     table->entry[ set_iterator ],
-			     0,
-			     sizeof( libpff_record_entry_t ) * table->number_of_entries ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-				 "%s: unable to clear record entries for set: %d.",
-				 function,
-				 set_iterator );
-
-				return( -1 );
-			}
 		}
 		table->number_of_sets = number_of_sets;
 	}
-	if( ( table->number_of_sets > 0 )
-	 && ( number_of_entries > table->number_of_entries ) )
-	{
-		for( set_iterator = 0;
-		     set_iterator < table->number_of_sets;
-		     set_iterator++ )
-		{
-			reallocation = memory_reallocate(
-			                table->entry[ set_iterator ],
-			                sizeof( libpff_record_entry_t ) * number_of_entries );
-
-			if( reallocation == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to resize record entries for set: %d.",
-				 function,
-				 set_iterator );
-
-				return( -1 );
-			}
-			table->entry[ set_iterator ] = (libpff_record_entry_t *) reallocation;
-
-			if( memory_set(
-			     &( ( table->entry[ set_iterator ] )[ table->number_of_entries ] ),
-			     0,
-			     sizeof( libpff_record_entry_t ) * ( number_of_entries - table->number_of_entries ) ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-				 "%s: unable to clear record entries for set: %d.",
-				 function,
-				 set_iterator );
-
-				return( -1 );
-			}
-		}
-		table->number_of_entries = number_of_entries;
-	}
 	return( 1 );
 }
 
@@ -465,10 +375,11 @@ int libpff_record_entries_clone(
 
 			break;
 		}
-		destination->entry[ set_iterator ] = (libpff_record_entry_t *) memory_allocate(
-		                                                                sizeof( libpff_record_entry_t ) * source->number_of_entries );
-
-		if( destination->entry[ set_iterator ] == NULL )
+		if( libpff_arena_allocate(
+		     destination->arena,
+		     sizeof( libpff_record_entry_t ) * source->number_of_entries,
+		     (void **) &( destination->entry[ set_iterator ] ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -482,23 +393,6 @@ int libpff_record_entries_clone(
 
 			break;
 		}
-		if( memory_set(
-		     destination->entry[ set_iterator ],
-		     0,
-		     sizeof( libpff_record_entry_t ) * source->number_of_entries ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to clear destination table set: %d entries.",
-			 function,
-			 set_iterator );
-
-			result = -1;
-
-			break;
-		}
 		for( entry_iterator = 0;
 		     entry_iterator < source->number_of_entries;
 		     entry_iterator++ )
@@ -521,6 +415,9 @@ int libpff_record_entries_clone(
 
 				break;
 			}
+			( destination->entry[ set_iterator ] )[ entry_iterator ].name_to_id_map_entry = ( source->entry[ set_iterator ] )[ entry_iterator ].name_to_id_map_entry;
+			( destination->entry[ set_iterator ] )[ entry_iterator ].flags                = ( source->entry[ set_iterator ] )[ entry_iterator ].flags;
+
 			if( libfdata_reference_clone(
 			     &( ( destination->entry[ set_iterator ] )[ entry_iterator ].value_data_reference ),
 			     ( source->entry[ set_iterator ] )[ entry_iterator ].value_data_reference,
@@ -602,8 +499,6 @@ int libpff_record_entries_clone(
 					}
 					entry_iterator--;
 				}
-				memory_free(
-				 destination->entry[ set_iterator ] );
 			}
 			entry_iterator = source->number_of_entries - 1;
 
@@ -685,6 +580,20 @@ int libpff_table_initialize(
 
 		goto on_error;
 	}
+	if( libpff_arena_initialize(
+	     &( ( *table )->arena ),
+	     LIBPFF_TABLE_ARENA_BLOCK_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
 	if( libpff_array_initialize(
 	     &( ( *table )->index ),
 	     0,
@@ -703,12 +612,19 @@ int libpff_table_initialize(
 	( *table )->data_identifier              = data_identifier;
 	( *table )->local_descriptors_identifier = local_descriptors_identifier;
 	( *table )->recovered                    = recovered;
+	( *table )->number_of_references         = 1;
 
 	return( 1 );
 
 on_error:
 	if( *table != NULL )
 	{
+		if( ( *table )->arena != NULL )
+		{
+			libpff_arena_free(
+			 &( ( *table )->arena ),
+			 NULL );
+		}
 		memory_free(
 		 *table );
 
@@ -806,11 +722,13 @@ int libpff_table_free(
 				result = -1;
 			}
 		}
+		/* The table index values are freed together with the arena
+		 */
 		if( ( *table )->index != NULL )
 		{
 			if( libpff_array_free(
 			     &( ( *table )->index ),
-			     (int (*)(intptr_t **, libcerror_error_t **)) &libpff_table_index_values_free,
+			     NULL,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -887,14 +805,28 @@ int libpff_table_free(
 						}
 					}
 				}
-				memory_free(
-				 ( *table )->entry[ set_iterator ] );
 			}
 			memory_free(
 			 ( *table )->entry );
 
 			( *table )->entry = NULL;
 		}
+		if( ( *table )->arena != NULL )
+		{
+			if( libpff_arena_free(
+			     &( ( *table )->arena ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free arena.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *table );
 
@@ -903,6 +835,88 @@ int libpff_table_free(
 	return( result );
 }
 
+/* Adds a reference to a table
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_table_add_reference(
+     libpff_table_t *table,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_table_add_reference";
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( table->number_of_references >= INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid table - number of references value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	table->number_of_references += 1;
+
+	return( 1 );
+}
+
+/* Releases a reference to a table
+ * The table is freed when its last reference is released
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_table_release(
+     libpff_table_t **table,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_table_release";
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *table != NULL )
+	{
+		( *table )->number_of_references -= 1;
+
+		if( ( *table )->number_of_references <= 0 )
+		{
+			if( libpff_table_free(
+			     table,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free table.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		*table = NULL;
+	}
+	return( 1 );
+}
+
 /* Clones the existing table
  * Returns 1 if successful or -1 on error
  */
@@ -1004,6 +1018,10 @@ int libpff_table_clone(
 
 		goto on_error;
 	}
+	( *destination_table )->recovered_data_identifier_value_index              = source_table->recovered_data_identifier_value_index;
+	( *destination_table )->recovered_local_descriptors_identifier_value_index = source_table->recovered_local_descriptors_identifier_value_index;
+	( *destination_table )->flags                                              = source_table->flags;
+
 	return( 1 );
 
 on_error:
@@ -2219,6 +2237,20 @@ int libpff_table_read(
 			}
 			return( -1 );
 		}
+		if( libfcache_cache_set_statistics(
+		     table->local_descriptors_cache,
+		     &( io_handle->statistics.cache_statistics[ LIBPFF_CACHE_LOCAL_DESCRIPTORS ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set local descriptors cache statistics.",
+			 function );
+
+			return( -1 );
+		}
 	}
 	if( libpff_io_handle_read_descriptor_data_block(
 	     io_handle,
@@ -2518,6 +2550,8 @@ int libpff_table_read(
 
 		return( -1 );
 	}
+	io_handle->statistics.number_of_tables_read += 1;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -2579,7 +2613,7 @@ int libpff_table_read_index(
 	if( libpff_array_resize(
 	     table->index,
 	     number_of_table_array_entries,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libpff_table_index_values_free,
+	     NULL,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2733,6 +2767,7 @@ int libpff_table_read_index(
 		if( libpff_table_index_values_initialize(
 		     &table_index_values,
 		     table_number_of_index_offsets,
+		     table->arena,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -2885,12 +2920,6 @@ int libpff_table_read_index(
 	return( 1 );
 
 on_error:
-	if( table_index_values != NULL )
-	{
-		libpff_table_index_values_free(
-		 &table_index_values,
-		 NULL );
-	}
 	return( -1 );
 }
 
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libpff_arena.h"
 #include "libpff_array_type.h"
 #include "libpff_io_handle.h"
 #include "libpff_libbfio.h"
@@ -147,6 +148,15 @@ struct libpff_table
 	/* The flags
 	 */
 	uint8_t flags;
+
+	/* The arena of the table scoped allocations
+	 */
+	libpff_arena_t *arena;
+
+	/* The number of references to the table
+	 * the table is shared by the item values and the item tables cache
+	 */
+	int number_of_references;
 };
 
 typedef struct libpff_table_values_array_entry libpff_table_values_array_entry_t;
@@ -165,10 +175,7 @@ struct libpff_table_values_array_entry
 int libpff_table_index_values_initialize(
      libpff_table_index_values_t **table_index_values,
      uint16_t number_of_values,
-     libcerror_error_t **error );
-
-int libpff_table_index_values_free(
-     libpff_table_index_values_t **table_index_values,
+     libpff_arena_t *arena,
      libcerror_error_t **error );
 
 int libpff_table_entries_resize(
@@ -194,6 +201,14 @@ int libpff_table_free(
      libpff_table_t **table,
      libcerror_error_t **error );
 
+int libpff_table_add_reference(
+     libpff_table_t *table,
+     libcerror_error_t **error );
+
+int libpff_table_release(
+     libpff_table_t **table,
+     libcerror_error_t **error );
+
 int libpff_table_clone(
      libpff_table_t **destination_table,
      libpff_table_t *source_table,
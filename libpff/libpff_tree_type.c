@@ -779,53 +779,75 @@ int libpff_tree_node_insert_node(
 
 			return( -1 );
 		}
-		sub_node = parent_node->first_sub_node;
+		/* Values are commonly inserted in order, hence compare
+		 * with the last sub node first to prevent a list walk
+		 */
+		result = value_compare_function(
+		          node->value,
+		          parent_node->last_sub_node->value,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare last sub node.",
+			 function );
 
-		for( sub_node_iterator = 0;
-		     sub_node_iterator < parent_node->number_of_sub_nodes;
-		     sub_node_iterator++ )
+			return( -1 );
+		}
+		if( result != LIBPFF_TREE_NODE_COMPARE_GREATER )
 		{
-			result = value_compare_function(
-			          node->value,
-			          sub_node->value,
-			          error );
+			sub_node = parent_node->first_sub_node;
 
-			if( result == -1 )
+			for( sub_node_iterator = 0;
+			     sub_node_iterator < parent_node->number_of_sub_nodes;
+			     sub_node_iterator++ )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to compare sub node: %d.",
-				 function,
-				 sub_node_iterator );
+				result = value_compare_function(
+				          node->value,
+				          sub_node->value,
+				          error );
 
-				return( -1 );
-			}
-			else if( result == LIBPFF_TREE_NODE_COMPARE_EQUAL )
-			{
-				if( ( insert_flags & LIBPFF_TREE_NODE_INSERT_FLAG_UNIQUE_ENTRIES ) != 0 )
+				if( result == -1 )
 				{
-					return( 0 );
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to compare sub node: %d.",
+					 function,
+					 sub_node_iterator );
+
+					return( -1 );
 				}
-			}
-			else if( result == LIBPFF_TREE_NODE_COMPARE_LESS )
-			{
-				break;
-			}
-			else if( result != LIBPFF_TREE_NODE_COMPARE_GREATER )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported value compare function return value: %d.",
-				 function,
-				 result );
+				else if( result == LIBPFF_TREE_NODE_COMPARE_EQUAL )
+				{
+					if( ( insert_flags & LIBPFF_TREE_NODE_INSERT_FLAG_UNIQUE_ENTRIES ) != 0 )
+					{
+						return( 0 );
+					}
+				}
+				else if( result == LIBPFF_TREE_NODE_COMPARE_LESS )
+				{
+					break;
+				}
+				else if( result != LIBPFF_TREE_NODE_COMPARE_GREATER )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+					 "%s: unsupported value compare function return value: %d.",
+					 function,
+					 result );
 
-				return( -1 );
+					return( -1 );
+				}
+				sub_node = sub_node->next_node;
 			}
-			sub_node = sub_node->next_node;
 		}
 		if( result == LIBPFF_TREE_NODE_COMPARE_LESS )
 		{
@@ -865,6 +887,10 @@ int libpff_tree_node_insert_node(
 
 	parent_node->number_of_sub_nodes += 1;
 
+	/* The insert can change the index of the most recently retrieved sub node
+	 */
+	parent_node->current_sub_node = NULL;
+
 	return( 1 );
 }
 
@@ -1068,6 +1094,8 @@ int libpff_tree_node_remove_node(
 
 	parent_node->number_of_sub_nodes -= 1;
 
+	parent_node->current_sub_node = NULL;
+
 	return( 1 );
 }
 
@@ -1118,7 +1146,7 @@ int libpff_tree_node_get_sub_node_by_index(
      libcerror_error_t **error )
 {
 	static char *function = "libpff_tree_node_get_sub_node_by_index";
-	int result            = -1;
+	int distance          = 0;
 	int sub_node_iterator = 0;
 
 	if( node == NULL )
@@ -1155,68 +1183,75 @@ int libpff_tree_node_get_sub_node_by_index(
 
 		return( -1 );
 	}
-	/* Check if the sub nodes should be searched front to back
-	 * or back to front
+	/* Start the search from the first sub node, the last sub node
+	 * or the most recently retrieved sub node, whichever is closest
+	 * so that retrieving the sub nodes in sequence does not require
+	 * a list walk per sub node
 	 */
 	if( sub_node_index < ( node->number_of_sub_nodes / 2 ) )
 	{
-		*sub_node = node->first_sub_node;
-
-		for( sub_node_iterator = 0;
-		     sub_node_iterator < node->number_of_sub_nodes;
-		     sub_node_iterator++ )
+		*sub_node         = node->first_sub_node;
+		sub_node_iterator = 0;
+		distance          = sub_node_index;
+	}
+	else
+	{
+		*sub_node         = node->last_sub_node;
+		sub_node_iterator = node->number_of_sub_nodes - 1;
+		distance          = sub_node_iterator - sub_node_index;
+	}
+	if( node->current_sub_node != NULL )
+	{
+		if( ( sub_node_index >= node->current_sub_node_index )
+		 && ( ( sub_node_index - node->current_sub_node_index ) < distance ) )
 		{
-			if( *sub_node == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: corruption detected for sub node: %d.",
-				 function,
-				 sub_node_iterator );
-
-				return( -1 );
-			}
-			if( sub_node_iterator == sub_node_index )
-			{
-				result = 1;
-
-				break;
-			}	
-			*sub_node = ( *sub_node )->next_node;
+			*sub_node         = node->current_sub_node;
+			sub_node_iterator = node->current_sub_node_index;
+		}
+		else if( ( sub_node_index < node->current_sub_node_index )
+		      && ( ( node->current_sub_node_index - sub_node_index ) < distance ) )
+		{
+			*sub_node         = node->current_sub_node;
+			sub_node_iterator = node->current_sub_node_index;
 		}
 	}
-	else
+	while( sub_node_iterator != sub_node_index )
 	{
-		*sub_node = node->last_sub_node;
-
-		for( sub_node_iterator = ( node->number_of_sub_nodes - 1 );
-		     sub_node_iterator >= 0;
-		     sub_node_iterator-- )
+		if( *sub_node == NULL )
 		{
-			if( *sub_node == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: corruption detected for sub node: %d.",
-				 function,
-				 sub_node_iterator );
-
-				return( -1 );
-			}
-			if( sub_node_iterator == sub_node_index )
-			{
-				result = 1;
+			break;
+		}
+		if( sub_node_iterator < sub_node_index )
+		{
+			*sub_node = ( *sub_node )->next_node;
 
-				break;
-			}	
+			sub_node_iterator++;
+		}
+		else
+		{
 			*sub_node = ( *sub_node )->previous_node;
+
+			sub_node_iterator--;
 		}
 	}
-	return( result );
+	if( *sub_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: corruption detected for sub node: %d.",
+		 function,
+		 sub_node_iterator );
+
+		node->current_sub_node = NULL;
+
+		return( -1 );
+	}
+	node->current_sub_node       = *sub_node;
+	node->current_sub_node_index = sub_node_index;
+
+	return( 1 );
 }
 
 /* Retrieves a list of all the leaf nodes
@@ -90,6 +90,14 @@ struct libpff_tree_node
 	 */
 	int number_of_sub_nodes;
 
+	/* The most recently retrieved sub node
+	 */
+	libpff_tree_node_t *current_sub_node;
+
+	/* The index of the most recently retrieved sub node
+	 */
+	int current_sub_node_index;
+
 	/* The node value
 	 */
 	intptr_t *value;
@@ -0,0 +1,115 @@
+/*
+ * Codepage lookup table functions
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBUNA_CODEPAGE_TABLE_H )
+#define _LIBUNA_CODEPAGE_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libuna_libcerror.h"
+#include "libuna_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The copy from byte stream function of a double byte codepage
+ */
+typedef int (*libuna_codepage_table_copy_from_byte_stream_t)(
+               libuna_unicode_character_t *unicode_character,
+               const uint8_t *byte_stream,
+               size_t byte_stream_size,
+               size_t *byte_stream_index,
+               libcerror_error_t **error );
+
+extern const uint16_t libuna_codepage_table_ascii_base_0x80[ 128 ];
+
+extern const uint16_t libuna_codepage_table_iso_8859_1_base_0x80[ 128 ];
+
+extern const uint16_t libuna_codepage_table_iso_8859_2_base_0x80[ 128 ];
+
+extern const uint16_t libuna_codepage_table_iso_8859_3_base_0x80[ 128 ];
+
+extern const uint16_t libuna_codepage_table_iso_8859_4_base_0x80[ 128 ];
+
+extern const uint16_t libuna_codepage_table_iso_8859_5_base_0x80[ 128 ];
+
+extern const uint16_t libuna_codepage_table_iso_8859_6_base_0x80[ 128 ];
+
+extern const uint16_t libuna_codepage_table_iso_8859_7_base_0x80[ 128 ];
+
+extern const uint16_t libuna_codepage_table_iso_8859_8_base_0x80[ 128 ];
+
+extern const uint16_t libuna_codepage_table_iso_8859_9_base_0x80[ 128 ];
+
+extern const uint16_t libuna_codepage_table_iso_8859_10_base_0x80[ 128 ];
+
+extern const uint16_t libuna_codepage_table_iso_8859_11_base_0x80[ 128 ];
+
+extern const uint16_t libuna_codepage_table_iso_8859_13_base_0x80[ 128 ];
+
+extern const uint16_t libuna_codepage_table_iso_8859_14_base_0x80[ 128 ];
+
+extern const uint16_t libuna_codepage_table_iso_8859_15_base_0x80[ 128 ];
+
+extern const uint16_t libuna_codepage_table_iso_8859_16_base_0x80[ 128 ];
+
+extern const uint16_t libuna_codepage_table_koi8_r_base_0x80[ 128 ];
+
+extern const uint16_t libuna_codepage_table_koi8_u_base_0x80[ 128 ];
+
+extern const uint16_t libuna_codepage_table_windows_874_base_0x80[ 128 ];
+
+extern const uint16_t libuna_codepage_table_windows_1250_base_0x80[ 128 ];
+
+extern const uint16_t libuna_codepage_table_windows_1251_base_0x80[ 128 ];
+
+extern const uint16_t libuna_codepage_table_windows_1252_base_0x80[ 128 ];
+
+extern const uint16_t libuna_codepage_table_windows_1253_base_0x80[ 128 ];
+
+extern const uint16_t libuna_codepage_table_windows_1254_base_0x80[ 128 ];
+
+extern const uint16_t libuna_codepage_table_windows_1255_base_0x80[ 128 ];
+
+extern const uint16_t libuna_codepage_table_windows_1256_base_0x80[ 128 ];
+
+extern const uint16_t libuna_codepage_table_windows_1257_base_0x80[ 128 ];
+
+extern const uint16_t libuna_codepage_table_windows_1258_base_0x80[ 128 ];
+
+int libuna_codepage_table_get_byte_stream_decoder(
+     int codepage,
+     const uint16_t **byte_stream_to_unicode_base_0x80,
+     libuna_codepage_table_copy_from_byte_stream_t *copy_from_byte_stream,
+     libcerror_error_t **error );
+
+size_t libuna_codepage_table_get_ascii_run_size(
+        const uint8_t *byte_stream,
+        size_t byte_stream_size );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
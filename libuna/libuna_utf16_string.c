@@ -22,6 +22,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libuna_codepage_table.h"
 #include "libuna_definitions.h"
 #include "libuna_libcerror.h"
 #include "libuna_types.h"
@@ -38,9 +39,14 @@ int libuna_utf16_string_size_from_byte_stream(
      size_t *utf16_string_size,
      libcerror_error_t **error )
 {
-	static char *function                        = "libuna_utf16_string_size_from_byte_stream";
-	size_t byte_stream_index                     = 0;
-	libuna_unicode_character_t unicode_character = 0;
+	libuna_codepage_table_copy_from_byte_stream_t copy_from_byte_stream = NULL;
+	const uint16_t *byte_stream_to_unicode_base_0x80                    = NULL;
+	static char *function                                               = "libuna_utf16_string_size_from_byte_stream";
+	size_t ascii_run_size                                               = 0;
+	size_t byte_stream_index                                            = 0;
+	libuna_unicode_character_t unicode_character                       = 0;
+	uint8_t byte_stream_character                                       = 0;
+	int result                                                          = 0;
 
 	if( byte_stream == NULL )
 	{
@@ -83,26 +89,86 @@ int libuna_utf16_string_size_from_byte_stream(
 	{
 		*utf16_string_size += 1;
 	}
+	if( libuna_codepage_table_get_byte_stream_decoder(
+	     codepage,
+	     &byte_stream_to_unicode_base_0x80,
+	     &copy_from_byte_stream,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve byte stream decoder.",
+		 function );
+
+		return( -1 );
+	}
 	while( byte_stream_index < byte_stream_size )
 	{
-		/* Convert the byte stream bytes into a Unicode character
+		/* Runs of 7-bit ASCII characters require a single UTF-16 character word each
 		 */
-		if( libuna_unicode_character_copy_from_byte_stream(
-		     &unicode_character,
-		     byte_stream,
-		     byte_stream_size,
-		     &byte_stream_index,
-		     codepage,
-		     error ) != 1 )
+		if( ( ( byte_stream_to_unicode_base_0x80 != NULL )
+		  || ( copy_from_byte_stream != NULL ) )
+		 && ( byte_stream[ byte_stream_index ] < 0x80 ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to copy Unicode character from byte stream.",
-			 function );
+			ascii_run_size = libuna_codepage_table_get_ascii_run_size(
+			                  &( byte_stream[ byte_stream_index ] ),
+			                  byte_stream_size - byte_stream_index );
 
-			return( -1 );
+			*utf16_string_size += ascii_run_size;
+			byte_stream_index  += ascii_run_size;
+
+			continue;
+		}
+		/* Convert the byte stream bytes into a Unicode character
+		 */
+		if( byte_stream_to_unicode_base_0x80 != NULL )
+		{
+			byte_stream_character = byte_stream[ byte_stream_index ];
+
+			if( byte_stream_character < 0x80 )
+			{
+				unicode_character = byte_stream_character;
+			}
+			else
+			{
+				unicode_character = byte_stream_to_unicode_base_0x80[ byte_stream_character - 0x80 ];
+			}
+			byte_stream_index += 1;
+		}
+		else
+		{
+			if( copy_from_byte_stream != NULL )
+			{
+				result = copy_from_byte_stream(
+				          &unicode_character,
+				          byte_stream,
+				          byte_stream_size,
+				          &byte_stream_index,
+				          error );
+			}
+			else
+			{
+				result = libuna_unicode_character_copy_from_byte_stream(
+				          &unicode_character,
+				          byte_stream,
+				          byte_stream_size,
+				          &byte_stream_index,
+				          codepage,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+				 "%s: unable to copy Unicode character from byte stream.",
+				 function );
+
+				return( -1 );
+			}
 		}
 		/* Determine how many UTF-16 character byte words are required
 		 */
@@ -171,10 +237,15 @@ int libuna_utf16_string_with_index_copy_from_byte_stream(
      int codepage,
      libcerror_error_t **error )
 {
-	static char *function                        = "libuna_utf16_string_with_index_copy_from_byte_stream";
-	size_t byte_stream_index                     = 0;
-	libuna_unicode_character_t unicode_character = 0;
-	uint8_t zero_byte                            = 0;
+	libuna_codepage_table_copy_from_byte_stream_t copy_from_byte_stream = NULL;
+	const uint16_t *byte_stream_to_unicode_base_0x80                    = NULL;
+	static char *function                                               = "libuna_utf16_string_with_index_copy_from_byte_stream";
+	size_t ascii_run_size                                               = 0;
+	size_t byte_stream_index                                            = 0;
+	libuna_unicode_character_t unicode_character                       = 0;
+	uint8_t byte_stream_character                                       = 0;
+	uint8_t zero_byte                                                   = 0;
+	int result                                                          = 0;
 
 	if( utf16_string == NULL )
 	{
@@ -237,26 +308,104 @@ int libuna_utf16_string_with_index_copy_from_byte_stream(
 	{
 		zero_byte = 1;
 	}
+	if( libuna_codepage_table_get_byte_stream_decoder(
+	     codepage,
+	     &byte_stream_to_unicode_base_0x80,
+	     &copy_from_byte_stream,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve byte stream decoder.",
+		 function );
+
+		return( -1 );
+	}
 	while( byte_stream_index < byte_stream_size )
 	{
+		/* Runs of 7-bit ASCII characters are copied directly
+		 */
+		if( ( ( byte_stream_to_unicode_base_0x80 != NULL )
+		  || ( copy_from_byte_stream != NULL ) )
+		 && ( byte_stream[ byte_stream_index ] < 0x80 ) )
+		{
+			ascii_run_size = libuna_codepage_table_get_ascii_run_size(
+			                  &( byte_stream[ byte_stream_index ] ),
+			                  byte_stream_size - byte_stream_index );
+
+			if( ( *utf16_string_index > utf16_string_size )
+			 || ( ascii_run_size > ( utf16_string_size - *utf16_string_index ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: UTF-16 string too small.",
+				 function );
+
+				return( -1 );
+			}
+			while( ascii_run_size > 0 )
+			{
+				utf16_string[ *utf16_string_index ] = (libuna_utf16_character_t) byte_stream[ byte_stream_index ];
+
+				*utf16_string_index += 1;
+				byte_stream_index   += 1;
+				ascii_run_size      -= 1;
+			}
+
+			continue;
+		}
 		/* Convert the byte stream bytes into a Unicode character
 		 */
-		if( libuna_unicode_character_copy_from_byte_stream(
-		     &unicode_character,
-		     byte_stream,
-		     byte_stream_size,
-		     &byte_stream_index,
-		     codepage,
-		     error ) != 1 )
+		if( byte_stream_to_unicode_base_0x80 != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to copy Unicode character from byte stream.",
-			 function );
-
-			return( -1 );
+			byte_stream_character = byte_stream[ byte_stream_index ];
+
+			if( byte_stream_character < 0x80 )
+			{
+				unicode_character = byte_stream_character;
+			}
+			else
+			{
+				unicode_character = byte_stream_to_unicode_base_0x80[ byte_stream_character - 0x80 ];
+			}
+			byte_stream_index += 1;
+		}
+		else
+		{
+			if( copy_from_byte_stream != NULL )
+			{
+				result = copy_from_byte_stream(
+				          &unicode_character,
+				          byte_stream,
+				          byte_stream_size,
+				          &byte_stream_index,
+				          error );
+			}
+			else
+			{
+				result = libuna_unicode_character_copy_from_byte_stream(
+				          &unicode_character,
+				          byte_stream,
+				          byte_stream_size,
+				          &byte_stream_index,
+				          codepage,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+				 "%s: unable to copy Unicode character from byte stream.",
+				 function );
+
+				return( -1 );
+			}
 		}
 		/* Convert the Unicode character into UTF-16 character byte words
 		 */
@@ -308,11 +457,15 @@ int libuna_utf16_string_compare_with_byte_stream(
      int codepage,
      libcerror_error_t **error )
 {
-	static char *function                                    = "libuna_utf16_string_compare_with_byte_stream";
-	size_t byte_stream_index                                 = 0;
-	size_t utf16_string_index                                = 0;
-	libuna_unicode_character_t utf16_unicode_character       = 0;
-	libuna_unicode_character_t byte_stream_unicode_character = 0;
+	libuna_codepage_table_copy_from_byte_stream_t copy_from_byte_stream = NULL;
+	const uint16_t *byte_stream_to_unicode_base_0x80                    = NULL;
+	static char *function                                               = "libuna_utf16_string_compare_with_byte_stream";
+	size_t byte_stream_index                                            = 0;
+	size_t utf16_string_index                                           = 0;
+	libuna_unicode_character_t utf16_unicode_character                  = 0;
+	libuna_unicode_character_t byte_stream_unicode_character            = 0;
+	uint8_t byte_stream_character                                       = 0;
+	int result                                                          = 0;
 
 	if( utf16_string == NULL )
 	{
@@ -368,6 +521,21 @@ int libuna_utf16_string_compare_with_byte_stream(
 	{
 		byte_stream_size -= 1;
 	}
+	if( libuna_codepage_table_get_byte_stream_decoder(
+	     codepage,
+	     &byte_stream_to_unicode_base_0x80,
+	     &copy_from_byte_stream,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve byte stream decoder.",
+		 function );
+
+		return( -1 );
+	}
 	while( ( utf16_string_index < utf16_string_size )
 	    && ( byte_stream_index < byte_stream_size ) )
 	{
@@ -391,22 +559,52 @@ int libuna_utf16_string_compare_with_byte_stream(
 		}
 		/* Convert the byte stream bytes into a Unicode character
 		 */
-		if( libuna_unicode_character_copy_from_byte_stream(
-		     &byte_stream_unicode_character,
-		     byte_stream,
-		     byte_stream_size,
-		     &byte_stream_index,
-		     codepage,
-		     error ) != 1 )
+		if( byte_stream_to_unicode_base_0x80 != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to copy Unicode character from byte stream.",
-			 function );
-
-			return( -1 );
+			byte_stream_character = byte_stream[ byte_stream_index ];
+
+			if( byte_stream_character < 0x80 )
+			{
+				byte_stream_unicode_character = byte_stream_character;
+			}
+			else
+			{
+				byte_stream_unicode_character = byte_stream_to_unicode_base_0x80[ byte_stream_character - 0x80 ];
+			}
+			byte_stream_index += 1;
+		}
+		else
+		{
+			if( copy_from_byte_stream != NULL )
+			{
+				result = copy_from_byte_stream(
+				          &byte_stream_unicode_character,
+				          byte_stream,
+				          byte_stream_size,
+				          &byte_stream_index,
+				          error );
+			}
+			else
+			{
+				result = libuna_unicode_character_copy_from_byte_stream(
+				          &byte_stream_unicode_character,
+				          byte_stream,
+				          byte_stream_size,
+				          &byte_stream_index,
+				          codepage,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+				 "%s: unable to copy Unicode character from byte stream.",
+				 function );
+
+				return( -1 );
+			}
 		}
 		if( utf16_unicode_character != byte_stream_unicode_character )
 		{
@@ -20,8 +20,10 @@
  */
 
 #include <common.h>
+#include <memory.h>
 #include <types.h>
 
+#include "libuna_codepage_table.h"
 #include "libuna_definitions.h"
 #include "libuna_libcerror.h"
 #include "libuna_types.h"
@@ -38,9 +40,14 @@ int libuna_utf8_string_size_from_byte_stream(
      size_t *utf8_string_size,
      libcerror_error_t **error )
 {
-	static char *function                        = "libuna_utf8_string_size_from_byte_stream";
-	size_t byte_stream_index                     = 0;
-	libuna_unicode_character_t unicode_character = 0;
+	libuna_codepage_table_copy_from_byte_stream_t copy_from_byte_stream = NULL;
+	const uint16_t *byte_stream_to_unicode_base_0x80                    = NULL;
+	static char *function                                               = "libuna_utf8_string_size_from_byte_stream";
+	size_t ascii_run_size                                               = 0;
+	size_t byte_stream_index                                            = 0;
+	libuna_unicode_character_t unicode_character                       = 0;
+	uint8_t byte_stream_character                                       = 0;
+	int result                                                          = 0;
 
 	if( byte_stream == NULL )
 	{
@@ -83,26 +90,86 @@ int libuna_utf8_string_size_from_byte_stream(
 	{
 		*utf8_string_size += 1;
 	}
+	if( libuna_codepage_table_get_byte_stream_decoder(
+	     codepage,
+	     &byte_stream_to_unicode_base_0x80,
+	     &copy_from_byte_stream,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve byte stream decoder.",
+		 function );
+
+		return( -1 );
+	}
 	while( byte_stream_index < byte_stream_size )
 	{
-		/* Convert the byte stream bytes into a Unicode character
+		/* Runs of 7-bit ASCII characters require a single UTF-8 character byte each
 		 */
-		if( libuna_unicode_character_copy_from_byte_stream(
-		     &unicode_character,
-		     byte_stream,
-		     byte_stream_size,
-		     &byte_stream_index,
-		     codepage,
-		     error ) != 1 )
+		if( ( ( byte_stream_to_unicode_base_0x80 != NULL )
+		  || ( copy_from_byte_stream != NULL ) )
+		 && ( byte_stream[ byte_stream_index ] < 0x80 ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to copy Unicode character from byte stream.",
-			 function );
+			ascii_run_size = libuna_codepage_table_get_ascii_run_size(
+			                  &( byte_stream[ byte_stream_index ] ),
+			                  byte_stream_size - byte_stream_index );
 
-			return( -1 );
+			*utf8_string_size += ascii_run_size;
+			byte_stream_index += ascii_run_size;
+
+			continue;
+		}
+		/* Convert the byte stream bytes into a Unicode character
+		 */
+		if( byte_stream_to_unicode_base_0x80 != NULL )
+		{
+			byte_stream_character = byte_stream[ byte_stream_index ];
+
+			if( byte_stream_character < 0x80 )
+			{
+				unicode_character = byte_stream_character;
+			}
+			else
+			{
+				unicode_character = byte_stream_to_unicode_base_0x80[ byte_stream_character - 0x80 ];
+			}
+			byte_stream_index += 1;
+		}
+		else
+		{
+			if( copy_from_byte_stream != NULL )
+			{
+				result = copy_from_byte_stream(
+				          &unicode_character,
+				          byte_stream,
+				          byte_stream_size,
+				          &byte_stream_index,
+				          error );
+			}
+			else
+			{
+				result = libuna_unicode_character_copy_from_byte_stream(
+				          &unicode_character,
+				          byte_stream,
+				          byte_stream_size,
+				          &byte_stream_index,
+				          codepage,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+				 "%s: unable to copy Unicode character from byte stream.",
+				 function );
+
+				return( -1 );
+			}
 		}
 		/* Determine how many UTF-8 character bytes are required
 		 */
@@ -171,10 +238,15 @@ int libuna_utf8_string_with_index_copy_from_byte_stream(
      int codepage,
      libcerror_error_t **error )
 {
-	static char *function                        = "libuna_utf8_string_with_index_copy_from_byte_stream";
-	size_t byte_stream_index                     = 0;
-	libuna_unicode_character_t unicode_character = 0;
-	uint8_t zero_byte                            = 0;
+	libuna_codepage_table_copy_from_byte_stream_t copy_from_byte_stream = NULL;
+	const uint16_t *byte_stream_to_unicode_base_0x80                    = NULL;
+	static char *function                                               = "libuna_utf8_string_with_index_copy_from_byte_stream";
+	size_t ascii_run_size                                               = 0;
+	size_t byte_stream_index                                            = 0;
+	libuna_unicode_character_t unicode_character                       = 0;
+	uint8_t byte_stream_character                                       = 0;
+	uint8_t zero_byte                                                   = 0;
+	int result                                                          = 0;
 
 	if( utf8_string == NULL )
 	{
@@ -237,26 +309,103 @@ int libuna_utf8_string_with_index_copy_from_byte_stream(
 	{
 		zero_byte = 1;
 	}
+	if( libuna_codepage_table_get_byte_stream_decoder(
+	     codepage,
+	     &byte_stream_to_unicode_base_0x80,
+	     &copy_from_byte_stream,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve byte stream decoder.",
+		 function );
+
+		return( -1 );
+	}
 	while( byte_stream_index < byte_stream_size )
 	{
+		/* Runs of 7-bit ASCII characters are copied directly
+		 */
+		if( ( ( byte_stream_to_unicode_base_0x80 != NULL )
+		  || ( copy_from_byte_stream != NULL ) )
+		 && ( byte_stream[ byte_stream_index ] < 0x80 ) )
+		{
+			ascii_run_size = libuna_codepage_table_get_ascii_run_size(
+			                  &( byte_stream[ byte_stream_index ] ),
+			                  byte_stream_size - byte_stream_index );
+
+			if( ( *utf8_string_index > utf8_string_size )
+			 || ( ascii_run_size > ( utf8_string_size - *utf8_string_index ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: UTF-8 string too small.",
+				 function );
+
+				return( -1 );
+			}
+			memory_copy(
+			 &( utf8_string[ *utf8_string_index ] ),
+			 &( byte_stream[ byte_stream_index ] ),
+			 ascii_run_size );
+
+			*utf8_string_index += ascii_run_size;
+			byte_stream_index  += ascii_run_size;
+
+			continue;
+		}
 		/* Convert the byte stream bytes into a Unicode character
 		 */
-		if( libuna_unicode_character_copy_from_byte_stream(
-		     &unicode_character,
-		     byte_stream,
-		     byte_stream_size,
-		     &byte_stream_index,
-		     codepage,
-		     error ) != 1 )
+		if( byte_stream_to_unicode_base_0x80 != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to copy Unicode character from byte stream.",
-			 function );
-
-			return( -1 );
+			byte_stream_character = byte_stream[ byte_stream_index ];
+
+			if( byte_stream_character < 0x80 )
+			{
+				unicode_character = byte_stream_character;
+			}
+			else
+			{
+				unicode_character = byte_stream_to_unicode_base_0x80[ byte_stream_character - 0x80 ];
+			}
+			byte_stream_index += 1;
+		}
+		else
+		{
+			if( copy_from_byte_stream != NULL )
+			{
+				result = copy_from_byte_stream(
+				          &unicode_character,
+				          byte_stream,
+				          byte_stream_size,
+				          &byte_stream_index,
+				          error );
+			}
+			else
+			{
+				result = libuna_unicode_character_copy_from_byte_stream(
+				          &unicode_character,
+				          byte_stream,
+				          byte_stream_size,
+				          &byte_stream_index,
+				          codepage,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+				 "%s: unable to copy Unicode character from byte stream.",
+				 function );
+
+				return( -1 );
+			}
 		}
 		/* Convert the Unicode character into UTF-8 character bytes
 		 */
@@ -308,11 +457,15 @@ int libuna_utf8_string_compare_with_byte_stream(
      int codepage,
      libcerror_error_t **error )
 {
-	static char *function                                    = "libuna_utf8_string_compare_with_byte_stream";
-	size_t byte_stream_index                                 = 0;
-	size_t utf8_string_index                                 = 0;
-	libuna_unicode_character_t utf8_unicode_character        = 0;
-	libuna_unicode_character_t byte_stream_unicode_character = 0;
+	libuna_codepage_table_copy_from_byte_stream_t copy_from_byte_stream = NULL;
+	const uint16_t *byte_stream_to_unicode_base_0x80                    = NULL;
+	static char *function                                               = "libuna_utf8_string_compare_with_byte_stream";
+	size_t byte_stream_index                                            = 0;
+	size_t utf8_string_index                                            = 0;
+	libuna_unicode_character_t utf8_unicode_character                   = 0;
+	libuna_unicode_character_t byte_stream_unicode_character            = 0;
+	uint8_t byte_stream_character                                       = 0;
+	int result                                                          = 0;
 
 	if( utf8_string == NULL )
 	{
@@ -368,6 +521,21 @@ int libuna_utf8_string_compare_with_byte_stream(
 	{
 		byte_stream_size -= 1;
 	}
+	if( libuna_codepage_table_get_byte_stream_decoder(
+	     codepage,
+	     &byte_stream_to_unicode_base_0x80,
+	     &copy_from_byte_stream,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve byte stream decoder.",
+		 function );
+
+		return( -1 );
+	}
 	while( ( utf8_string_index < utf8_string_size )
 	    && ( byte_stream_index < byte_stream_size ) )
 	{
@@ -391,22 +559,52 @@ int libuna_utf8_string_compare_with_byte_stream(
 		}
 		/* Convert the byte stream bytes into a Unicode character
 		 */
-		if( libuna_unicode_character_copy_from_byte_stream(
-		     &byte_stream_unicode_character,
-		     byte_stream,
-		     byte_stream_size,
-		     &byte_stream_index,
-		     codepage,
-		     error ) != 1 )
+		if( byte_stream_to_unicode_base_0x80 != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to copy Unicode character from byte stream.",
-			 function );
-
-			return( -1 );
+			byte_stream_character = byte_stream[ byte_stream_index ];
+
+			if( byte_stream_character < 0x80 )
+			{
+				byte_stream_unicode_character = byte_stream_character;
+			}
+			else
+			{
+				byte_stream_unicode_character = byte_stream_to_unicode_base_0x80[ byte_stream_character - 0x80 ];
+			}
+			byte_stream_index += 1;
+		}
+		else
+		{
+			if( copy_from_byte_stream != NULL )
+			{
+				result = copy_from_byte_stream(
+				          &byte_stream_unicode_character,
+				          byte_stream,
+				          byte_stream_size,
+				          &byte_stream_index,
+				          error );
+			}
+			else
+			{
+				result = libuna_unicode_character_copy_from_byte_stream(
+				          &byte_stream_unicode_character,
+				          byte_stream,
+				          byte_stream_size,
+				          &byte_stream_index,
+				          codepage,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+				 "%s: unable to copy Unicode character from byte stream.",
+				 function );
+
+				return( -1 );
+			}
 		}
 		if( utf8_unicode_character != byte_stream_unicode_character )
 		{
@@ -0,0 +1,1782 @@
+/* 
+ * Archive file
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include <time.h>
+
+#include "archive_file.h"
+#include "pfftools_libcerror.h"
+#include "pfftools_libcfile.h"
+#include "pfftools_libcpath.h"
+#include "pfftools_libcstring.h"
+#include "pfftools_libuna.h"
+
+/* Initializes the archive file
+ * Returns 1 if successful or -1 on error
+ */
+int archive_file_initialize(
+     archive_file_t **archive_file,
+     libcerror_error_t **error )
+{
+	static char *function = "archive_file_initialize";
+
+	if( archive_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *archive_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid archive file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*archive_file = memory_allocate_structure(
+	                 archive_file_t );
+
+	if( *archive_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create archive file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *archive_file,
+	     0,
+	     sizeof( archive_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear archive file.",
+		 function );
+
+		memory_free(
+		 *archive_file );
+
+		*archive_file = NULL;
+
+		return( -1 );
+	}
+	if( libcfile_file_initialize(
+	     &( ( *archive_file )->file_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *archive_file )->buffer = (uint8_t *) memory_allocate(
+	                                         sizeof( uint8_t ) * ARCHIVE_FILE_BUFFER_SIZE );
+
+	if( ( *archive_file )->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *archive_file != NULL )
+	{
+		if( ( *archive_file )->file_handle != NULL )
+		{
+			libcfile_file_free(
+			 &( ( *archive_file )->file_handle ),
+			 NULL );
+		}
+		memory_free(
+		 *archive_file );
+
+		*archive_file = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees the archive file and its elements
+ * Returns 1 if successful or -1 on error
+ */
+int archive_file_free(
+     archive_file_t **archive_file,
+     libcerror_error_t **error )
+{
+	static char *function = "archive_file_free";
+	int result            = 1;
+
+	if( archive_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *archive_file != NULL )
+	{
+		if( libcfile_file_free(
+		     &( ( *archive_file )->file_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file handle.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *archive_file )->buffer != NULL )
+		{
+			memory_free(
+			 ( *archive_file )->buffer );
+		}
+		if( ( *archive_file )->directory_hashes != NULL )
+		{
+			memory_free(
+			 ( *archive_file )->directory_hashes );
+		}
+		memory_free(
+		 *archive_file );
+
+		*archive_file = NULL;
+	}
+	return( result );
+}
+
+/* Opens the archive file
+ * Returns 1 if successful or -1 on error
+ */
+int archive_file_open(
+     archive_file_t *archive_file,
+     const libcstring_system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "archive_file_open";
+
+	if( archive_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcfile_file_open_wide(
+	     archive_file->file_handle,
+	     filename,
+	     LIBCFILE_OPEN_WRITE,
+	     error ) != 1 )
+#else
+	if( libcfile_file_open(
+	     archive_file->file_handle,
+	     filename,
+	     LIBCFILE_OPEN_WRITE,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file handle.",
+		 function );
+
+		return( -1 );
+	}
+	archive_file->buffer_offset     = 0;
+	archive_file->modification_time = (uint64_t) time( NULL );
+
+	return( 1 );
+}
+
+/* Closes the archive file
+ * Writes the end of archive marker of 2 empty blocks
+ * Returns the 0 if succesful or -1 on error
+ */
+int archive_file_close(
+     archive_file_t *archive_file,
+     libcerror_error_t **error )
+{
+	static char *function = "archive_file_close";
+
+	if( archive_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive file.",
+		 function );
+
+		return( -1 );
+	}
+	if( archive_file->entry_is_open != 0 )
+	{
+		if( archive_file_close_entry(
+		     archive_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close entry.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( archive_file_write_padding(
+	     archive_file,
+	     2 * ARCHIVE_FILE_BLOCK_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write end of archive.",
+		 function );
+
+		return( -1 );
+	}
+	if( archive_file_flush(
+	     archive_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcfile_file_close(
+	     archive_file->file_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Writes the buffered data to the file handle
+ * Returns 1 if successful or -1 on error
+ */
+int archive_file_flush(
+     archive_file_t *archive_file,
+     libcerror_error_t **error )
+{
+	static char *function = "archive_file_flush";
+	ssize_t write_count   = 0;
+
+	if( archive_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive file.",
+		 function );
+
+		return( -1 );
+	}
+	if( archive_file->buffer_offset > 0 )
+	{
+		write_count = libcfile_file_write_buffer(
+		               archive_file->file_handle,
+		               archive_file->buffer,
+		               archive_file->buffer_offset,
+		               error );
+
+		if( write_count != (ssize_t) archive_file->buffer_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write buffer to file handle.",
+			 function );
+
+			return( -1 );
+		}
+		archive_file->buffer_offset = 0;
+	}
+	return( 1 );
+}
+
+/* Writes a buffer to the archive file
+ * The data is buffered unless the buffer is at least the size of the archive buffer
+ * Returns 1 if successful or -1 on error
+ */
+int archive_file_write_buffer(
+     archive_file_t *archive_file,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "archive_file_write_buffer";
+	size_t copy_size      = 0;
+	ssize_t write_count   = 0;
+
+	if( archive_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive file.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_size > 0 )
+	{
+		if( ( archive_file->buffer_offset == 0 )
+		 && ( buffer_size >= ARCHIVE_FILE_BUFFER_SIZE ) )
+		{
+			write_count = libcfile_file_write_buffer(
+			               archive_file->file_handle,
+			               buffer,
+			               buffer_size,
+			               error );
+
+			if( write_count != (ssize_t) buffer_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write buffer to file handle.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+		}
+		copy_size = ARCHIVE_FILE_BUFFER_SIZE - archive_file->buffer_offset;
+
+		if( copy_size > buffer_size )
+		{
+			copy_size = buffer_size;
+		}
+		if( memory_copy(
+		     &( archive_file->buffer[ archive_file->buffer_offset ] ),
+		     buffer,
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy buffer.",
+			 function );
+
+			return( -1 );
+		}
+		archive_file->buffer_offset += copy_size;
+		buffer                      += copy_size;
+		buffer_size                 -= copy_size;
+
+		if( archive_file->buffer_offset == ARCHIVE_FILE_BUFFER_SIZE )
+		{
+			if( archive_file_flush(
+			     archive_file,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to flush buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Writes padding of zero bytes to the archive file
+ * Returns 1 if successful or -1 on error
+ */
+int archive_file_write_padding(
+     archive_file_t *archive_file,
+     size64_t padding_size,
+     libcerror_error_t **error )
+{
+	uint8_t padding[ ARCHIVE_FILE_BLOCK_SIZE ];
+
+	static char *function = "archive_file_write_padding";
+	size_t write_size     = 0;
+
+	if( memory_set(
+	     padding,
+	     0,
+	     ARCHIVE_FILE_BLOCK_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear padding.",
+		 function );
+
+		return( -1 );
+	}
+	while( padding_size > 0 )
+	{
+		if( padding_size > (size64_t) ARCHIVE_FILE_BLOCK_SIZE )
+		{
+			write_size = ARCHIVE_FILE_BLOCK_SIZE;
+		}
+		else
+		{
+			write_size = (size_t) padding_size;
+		}
+		if( archive_file_write_buffer(
+		     archive_file,
+		     padding,
+		     write_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write padding.",
+			 function );
+
+			return( -1 );
+		}
+		padding_size -= write_size;
+	}
+	return( 1 );
+}
+
+/* Retrieves the archive entry name of a path
+ * The entry name is an UTF-8 string that uses / as the path separator
+ * Returns 1 if successful or -1 on error
+ */
+int archive_file_get_entry_name(
+     const libcstring_system_character_t *name,
+     uint8_t **entry_name,
+     size_t *entry_name_size,
+     libcerror_error_t **error )
+{
+	static char *function = "archive_file_get_entry_name";
+	size_t name_index     = 0;
+	size_t name_length    = 0;
+
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	int result            = 0;
+#endif
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry name.",
+		 function );
+
+		return( -1 );
+	}
+	if( *entry_name != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid entry name value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_name_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry name size.",
+		 function );
+
+		return( -1 );
+	}
+	name_length = libcstring_system_string_length(
+	               name );
+
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+#if SIZEOF_WCHAR_T == 4
+	result = libuna_utf8_string_size_from_utf32(
+	          (libuna_utf32_character_t *) name,
+	          name_length + 1,
+	          entry_name_size,
+	          error );
+#elif SIZEOF_WCHAR_T == 2
+	result = libuna_utf8_string_size_from_utf16(
+	          (libuna_utf16_character_t *) name,
+	          name_length + 1,
+	          entry_name_size,
+	          error );
+#else
+#error Unsupported size of wchar_t
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine entry name size.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	*entry_name_size = name_length + 1;
+#endif
+	*entry_name = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * *entry_name_size );
+
+	if( *entry_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry name.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+#if SIZEOF_WCHAR_T == 4
+	result = libuna_utf8_string_copy_from_utf32(
+	          (libuna_utf8_character_t *) *entry_name,
+	          *entry_name_size,
+	          (libuna_utf32_character_t *) name,
+	          name_length + 1,
+	          error );
+#elif SIZEOF_WCHAR_T == 2
+	result = libuna_utf8_string_copy_from_utf16(
+	          (libuna_utf8_character_t *) *entry_name,
+	          *entry_name_size,
+	          (libuna_utf16_character_t *) name,
+	          name_length + 1,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set entry name.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	if( memory_copy(
+	     *entry_name,
+	     name,
+	     name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		goto on_error;
+	}
+	( *entry_name )[ name_length ] = 0;
+#endif
+	for( name_index = 0;
+	     name_index < *entry_name_size;
+	     name_index++ )
+	{
+		if( ( *entry_name )[ name_index ] == (uint8_t) LIBCPATH_SEPARATOR )
+		{
+			( *entry_name )[ name_index ] = (uint8_t) '/';
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *entry_name != NULL )
+	{
+		memory_free(
+		 *entry_name );
+
+		*entry_name = NULL;
+	}
+	*entry_name_size = 0;
+
+	return( -1 );
+}
+
+/* Copies a value into a zero terminated octal field of a header
+ * Returns 1 if successful or -1 on error
+ */
+int archive_file_copy_octal_value(
+     uint8_t *field,
+     size_t field_size,
+     uint64_t value,
+     libcerror_error_t **error )
+{
+	static char *function = "archive_file_copy_octal_value";
+	size_t field_index    = 0;
+
+	if( field == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid field.",
+		 function );
+
+		return( -1 );
+	}
+	if( field_size < 2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid field size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	field_index = field_size - 1;
+
+	field[ field_index ] = 0;
+
+	while( field_index > 0 )
+	{
+		field_index--;
+
+		field[ field_index ] = (uint8_t) '0' + (uint8_t) ( value & 0x07 );
+
+		value >>= 3;
+	}
+	if( value != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a (GNU) long name entry
+ * The entry type is either long name or long link name
+ * Returns 1 if successful or -1 on error
+ */
+int archive_file_write_long_name(
+     archive_file_t *archive_file,
+     const uint8_t *name,
+     size_t name_size,
+     uint8_t entry_type,
+     libcerror_error_t **error )
+{
+	static char *function = "archive_file_write_long_name";
+
+	if( archive_file_write_header(
+	     archive_file,
+	     (uint8_t *) "././@LongLink",
+	     14,
+	     NULL,
+	     0,
+	     entry_type,
+	     (size64_t) name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write long name header.",
+		 function );
+
+		return( -1 );
+	}
+	if( archive_file_write_buffer(
+	     archive_file,
+	     name,
+	     name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write long name.",
+		 function );
+
+		return( -1 );
+	}
+	if( archive_file_write_padding(
+	     archive_file,
+	     ( ARCHIVE_FILE_BLOCK_SIZE - ( name_size % ARCHIVE_FILE_BLOCK_SIZE ) ) % ARCHIVE_FILE_BLOCK_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write long name padding.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes an entry header
+ * Entry and link names of 100 bytes or more are preceded by (GNU) long name entries
+ * The link name is only used by hard link entries and can be NULL otherwise
+ * Returns 1 if successful or -1 on error
+ */
+int archive_file_write_header(
+     archive_file_t *archive_file,
+     const uint8_t *entry_name,
+     size_t entry_name_size,
+     const uint8_t *link_name,
+     size_t link_name_size,
+     uint8_t entry_type,
+     size64_t entry_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t header[ ARCHIVE_FILE_BLOCK_SIZE ];
+
+	static char *function = "archive_file_write_header";
+	size_t header_index   = 0;
+	size_t link_length    = 0;
+	size_t name_length    = 0;
+	uint32_t checksum     = 0;
+	uint32_t mode         = 0;
+
+	if( archive_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive file.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_name_size == 0 )
+	 || ( entry_name_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( link_name != NULL )
+	{
+		if( ( link_name_size == 0 )
+		 || ( link_name_size > (size_t) SSIZE_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid link name size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		link_length = link_name_size - 1;
+
+		if( link_length >= 100 )
+		{
+			if( archive_file_write_long_name(
+			     archive_file,
+			     link_name,
+			     link_name_size,
+			     ARCHIVE_FILE_ENTRY_TYPE_LONG_LINK_NAME,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write long link name.",
+				 function );
+
+				return( -1 );
+			}
+			link_length = 100;
+		}
+	}
+	name_length = entry_name_size - 1;
+
+	if( name_length >= 100 )
+	{
+		if( archive_file_write_long_name(
+		     archive_file,
+		     entry_name,
+		     entry_name_size,
+		     ARCHIVE_FILE_ENTRY_TYPE_LONG_NAME,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write long name.",
+			 function );
+
+			return( -1 );
+		}
+		name_length = 100;
+	}
+	if( memory_set(
+	     header,
+	     0,
+	     ARCHIVE_FILE_BLOCK_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear header.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     header,
+	     entry_name,
+	     name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy entry name.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_type == ARCHIVE_FILE_ENTRY_TYPE_DIRECTORY )
+	{
+		mode = 0755;
+	}
+	else
+	{
+		mode = 0644;
+	}
+	if( ( archive_file_copy_octal_value(
+	       &( header[ 100 ] ),
+	       8,
+	       (uint64_t) mode,
+	       error ) != 1 )
+	 || ( archive_file_copy_octal_value(
+	       &( header[ 108 ] ),
+	       8,
+	       0,
+	       error ) != 1 )
+	 || ( archive_file_copy_octal_value(
+	       &( header[ 116 ] ),
+	       8,
+	       0,
+	       error ) != 1 )
+	 || ( archive_file_copy_octal_value(
+	       &( header[ 124 ] ),
+	       12,
+	       (uint64_t) entry_data_size,
+	       error ) != 1 )
+	 || ( archive_file_copy_octal_value(
+	       &( header[ 136 ] ),
+	       12,
+	       archive_file->modification_time,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set header values.",
+		 function );
+
+		return( -1 );
+	}
+	header[ 156 ] = entry_type;
+
+	if( link_length > 0 )
+	{
+		if( memory_copy(
+		     &( header[ 157 ] ),
+		     link_name,
+		     link_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy link name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+
+	/* The GNU magic and version: "ustar  "
+	 */
+	if( memory_copy(
+	     &( header[ 257 ] ),
+	     "ustar  ",
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy magic.",
+		 function );
+
+		return( -1 );
+	}
+	/* The checksum is calculated with the checksum field filled with spaces
+	 */
+	if( memory_set(
+	     &( header[ 148 ] ),
+	     (int) ' ',
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear checksum.",
+		 function );
+
+		return( -1 );
+	}
+	for( header_index = 0;
+	     header_index < ARCHIVE_FILE_BLOCK_SIZE;
+	     header_index++ )
+	{
+		checksum += header[ header_index ];
+	}
+	if( archive_file_copy_octal_value(
+	     &( header[ 148 ] ),
+	     7,
+	     (uint64_t) checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( archive_file_write_buffer(
+	     archive_file,
+	     header,
+	     ARCHIVE_FILE_BLOCK_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write header.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Calculates the (64-bit FNV-1a) hash of an entry name
+ * A trailing / is ignored
+ * Returns the hash, which is never 0
+ */
+uint64_t archive_file_get_name_hash(
+          const uint8_t *entry_name,
+          size_t entry_name_size )
+{
+	size_t name_index  = 0;
+	size_t name_length = 0;
+	uint64_t hash      = 0xcbf29ce484222325ULL;
+
+	if( ( entry_name == NULL )
+	 || ( entry_name_size == 0 ) )
+	{
+		return( 1 );
+	}
+	name_length = entry_name_size - 1;
+
+	if( ( name_length > 0 )
+	 && ( entry_name[ name_length - 1 ] == (uint8_t) '/' ) )
+	{
+		name_length--;
+	}
+	for( name_index = 0;
+	     name_index < name_length;
+	     name_index++ )
+	{
+		hash ^= entry_name[ name_index ];
+		hash *= 0x100000001b3ULL;
+	}
+	if( hash == 0 )
+	{
+		hash = 1;
+	}
+	return( hash );
+}
+
+/* Determines if a directory entry was added to the archive file
+ * Directories are tracked by the hash of their name
+ * Returns 1 if the directory exists, 0 if not or -1 on error
+ */
+int archive_file_directory_exists(
+     archive_file_t *archive_file,
+     const libcstring_system_character_t *name,
+     libcerror_error_t **error )
+{
+	uint8_t *entry_name    = NULL;
+	static char *function  = "archive_file_directory_exists";
+	size_t entry_name_size = 0;
+	size_t hash_index      = 0;
+	uint64_t hash          = 0;
+
+	if( archive_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive file.",
+		 function );
+
+		return( -1 );
+	}
+	if( archive_file->directory_hashes == NULL )
+	{
+		return( 0 );
+	}
+	if( archive_file_get_entry_name(
+	     name,
+	     &entry_name,
+	     &entry_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry name.",
+		 function );
+
+		return( -1 );
+	}
+	hash = archive_file_get_name_hash(
+	        entry_name,
+	        entry_name_size );
+
+	memory_free(
+	 entry_name );
+
+	hash_index = (size_t) ( hash % archive_file->directory_hashes_size );
+
+	while( archive_file->directory_hashes[ hash_index ] != 0 )
+	{
+		if( archive_file->directory_hashes[ hash_index ] == hash )
+		{
+			return( 1 );
+		}
+		hash_index = ( hash_index + 1 ) % archive_file->directory_hashes_size;
+	}
+	return( 0 );
+}
+
+/* Adds a directory entry to the archive file
+ * Returns 1 if successful or -1 on error
+ */
+int archive_file_add_directory(
+     archive_file_t *archive_file,
+     const libcstring_system_character_t *name,
+     libcerror_error_t **error )
+{
+	uint64_t *directory_hashes    = NULL;
+	uint8_t *directory_name       = NULL;
+	uint8_t *entry_name           = NULL;
+	static char *function         = "archive_file_add_directory";
+	size_t directory_hashes_size  = 0;
+	size_t entry_name_size        = 0;
+	size_t hash_index             = 0;
+	size_t previous_hash_index    = 0;
+	uint64_t hash                 = 0;
+
+	if( archive_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive file.",
+		 function );
+
+		return( -1 );
+	}
+	if( archive_file->entry_is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid archive file - entry already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( archive_file_get_entry_name(
+	     name,
+	     &entry_name,
+	     &entry_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry name.",
+		 function );
+
+		goto on_error;
+	}
+	/* The name of a directory entry ends with a /
+	 */
+	directory_name = (uint8_t *) memory_allocate(
+	                              sizeof( uint8_t ) * ( entry_name_size + 1 ) );
+
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory name.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     directory_name,
+	     entry_name,
+	     entry_name_size - 1 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory name.",
+		 function );
+
+		goto on_error;
+	}
+	directory_name[ entry_name_size - 1 ] = (uint8_t) '/';
+	directory_name[ entry_name_size ]     = 0;
+
+	memory_free(
+	 entry_name );
+
+	entry_name = NULL;
+
+	if( archive_file_write_header(
+	     archive_file,
+	     directory_name,
+	     entry_name_size + 1,
+	     NULL,
+	     0,
+	     ARCHIVE_FILE_ENTRY_TYPE_DIRECTORY,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write directory header.",
+		 function );
+
+		goto on_error;
+	}
+	hash = archive_file_get_name_hash(
+	        directory_name,
+	        entry_name_size + 1 );
+
+	memory_free(
+	 directory_name );
+
+	directory_name = NULL;
+
+	/* Keep the directory hashes table at most half full
+	 */
+	if( ( 2 * ( archive_file->number_of_directories + 1 ) ) > archive_file->directory_hashes_size )
+	{
+		if( archive_file->directory_hashes_size == 0 )
+		{
+			directory_hashes_size = 1024;
+		}
+		else
+		{
+			directory_hashes_size = 2 * archive_file->directory_hashes_size;
+		}
+		if( directory_hashes_size > (size_t) ( SSIZE_MAX / sizeof( uint64_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid directory hashes size value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		directory_hashes = (uint64_t *) memory_allocate(
+		                                 sizeof( uint64_t ) * directory_hashes_size );
+
+		if( directory_hashes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create directory hashes.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     directory_hashes,
+		     0,
+		     sizeof( uint64_t ) * directory_hashes_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear directory hashes.",
+			 function );
+
+			goto on_error;
+		}
+		for( previous_hash_index = 0;
+		     previous_hash_index < archive_file->directory_hashes_size;
+		     previous_hash_index++ )
+		{
+			if( archive_file->directory_hashes[ previous_hash_index ] == 0 )
+			{
+				continue;
+			}
+			hash_index = (size_t) ( archive_file->directory_hashes[ previous_hash_index ] % directory_hashes_size );
+
+			while( directory_hashes[ hash_index ] != 0 )
+			{
+				hash_index = ( hash_index + 1 ) % directory_hashes_size;
+			}
+			directory_hashes[ hash_index ] = archive_file->directory_hashes[ previous_hash_index ];
+		}
+		if( archive_file->directory_hashes != NULL )
+		{
+			memory_free(
+			 archive_file->directory_hashes );
+		}
+		archive_file->directory_hashes      = directory_hashes;
+		archive_file->directory_hashes_size = directory_hashes_size;
+
+		directory_hashes = NULL;
+	}
+	hash_index = (size_t) ( hash % archive_file->directory_hashes_size );
+
+	while( archive_file->directory_hashes[ hash_index ] != 0 )
+	{
+		if( archive_file->directory_hashes[ hash_index ] == hash )
+		{
+			break;
+		}
+		hash_index = ( hash_index + 1 ) % archive_file->directory_hashes_size;
+	}
+	if( archive_file->directory_hashes[ hash_index ] == 0 )
+	{
+		archive_file->directory_hashes[ hash_index ] = hash;
+
+		archive_file->number_of_directories += 1;
+	}
+	return( 1 );
+
+on_error:
+	if( directory_hashes != NULL )
+	{
+		memory_free(
+		 directory_hashes );
+	}
+	if( directory_name != NULL )
+	{
+		memory_free(
+		 directory_name );
+	}
+	if( entry_name != NULL )
+	{
+		memory_free(
+		 entry_name );
+	}
+	return( -1 );
+}
+
+/* Opens a file entry in the archive file
+ * The entry data size must be known in advance since it is stored in the header
+ * Returns 1 if successful or -1 on error
+ */
+int archive_file_open_entry(
+     archive_file_t *archive_file,
+     const libcstring_system_character_t *name,
+     size64_t entry_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *entry_name    = NULL;
+	static char *function  = "archive_file_open_entry";
+	size_t entry_name_size = 0;
+
+	if( archive_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive file.",
+		 function );
+
+		return( -1 );
+	}
+	if( archive_file->entry_is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid archive file - entry already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( archive_file_get_entry_name(
+	     name,
+	     &entry_name,
+	     &entry_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry name.",
+		 function );
+
+		goto on_error;
+	}
+	if( archive_file_write_header(
+	     archive_file,
+	     entry_name,
+	     entry_name_size,
+	     NULL,
+	     0,
+	     ARCHIVE_FILE_ENTRY_TYPE_FILE,
+	     entry_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write entry header.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 entry_name );
+
+	archive_file->entry_is_open     = 1;
+	archive_file->entry_data_size   = entry_data_size;
+	archive_file->entry_data_offset = 0;
+
+	return( 1 );
+
+on_error:
+	if( entry_name != NULL )
+	{
+		memory_free(
+		 entry_name );
+	}
+	return( -1 );
+}
+
+/* Writes data of the open entry to the archive file
+ * Returns 1 if successful or -1 on error
+ */
+int archive_file_write_entry_data(
+     archive_file_t *archive_file,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "archive_file_write_entry_data";
+
+	if( archive_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive file.",
+		 function );
+
+		return( -1 );
+	}
+	if( archive_file->entry_is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid archive file - missing open entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) buffer_size > ( archive_file->entry_data_size - archive_file->entry_data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds entry data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( archive_file_write_buffer(
+	     archive_file,
+	     buffer,
+	     buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write entry data.",
+		 function );
+
+		return( -1 );
+	}
+	archive_file->entry_data_offset += buffer_size;
+
+	return( 1 );
+}
+
+/* Closes the open entry of the archive file
+ * Entry data that was not written is filled with zero bytes
+ * so that the archive remains consistent
+ * Returns 1 if successful or -1 on error
+ */
+int archive_file_close_entry(
+     archive_file_t *archive_file,
+     libcerror_error_t **error )
+{
+	static char *function = "archive_file_close_entry";
+	size64_t padding_size = 0;
+
+	if( archive_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive file.",
+		 function );
+
+		return( -1 );
+	}
+	if( archive_file->entry_is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid archive file - missing open entry.",
+		 function );
+
+		return( -1 );
+	}
+	archive_file->entry_is_open = 0;
+
+	padding_size = archive_file->entry_data_size - archive_file->entry_data_offset;
+
+	if( ( archive_file->entry_data_size % ARCHIVE_FILE_BLOCK_SIZE ) != 0 )
+	{
+		padding_size += ARCHIVE_FILE_BLOCK_SIZE - ( archive_file->entry_data_size % ARCHIVE_FILE_BLOCK_SIZE );
+	}
+	if( archive_file_write_padding(
+	     archive_file,
+	     padding_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write entry padding.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Adds a hard link entry to the archive file
+ * The link target is the name of a file entry that was added before
+ * Returns 1 if successful or -1 on error
+ */
+int archive_file_add_link(
+     archive_file_t *archive_file,
+     const libcstring_system_character_t *name,
+     const libcstring_system_character_t *link_target,
+     libcerror_error_t **error )
+{
+	uint8_t *entry_name    = NULL;
+	uint8_t *link_name     = NULL;
+	static char *function  = "archive_file_add_link";
+	size_t entry_name_size = 0;
+	size_t link_name_size  = 0;
+
+	if( archive_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive file.",
+		 function );
+
+		return( -1 );
+	}
+	if( archive_file->entry_is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid archive file - entry already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( archive_file_get_entry_name(
+	     name,
+	     &entry_name,
+	     &entry_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry name.",
+		 function );
+
+		goto on_error;
+	}
+	if( archive_file_get_entry_name(
+	     link_target,
+	     &link_name,
+	     &link_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve link name.",
+		 function );
+
+		goto on_error;
+	}
+	if( archive_file_write_header(
+	     archive_file,
+	     entry_name,
+	     entry_name_size,
+	     link_name,
+	     link_name_size,
+	     ARCHIVE_FILE_ENTRY_TYPE_LINK,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write link header.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 link_name );
+	memory_free(
+	 entry_name );
+
+	return( 1 );
+
+on_error:
+	if( link_name != NULL )
+	{
+		memory_free(
+		 link_name );
+	}
+	if( entry_name != NULL )
+	{
+		memory_free(
+		 entry_name );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,202 @@
+/* 
+ * Archive file
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ARCHIVE_FILE_H )
+#define _ARCHIVE_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pfftools_libcerror.h"
+#include "pfftools_libcfile.h"
+#include "pfftools_libcstring.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The archive file is written in (GNU) tar format
+ * in blocks of 512 bytes
+ */
+#define ARCHIVE_FILE_BLOCK_SIZE		512
+
+/* Data is written to the file handle in large sequential chunks
+ */
+#define ARCHIVE_FILE_BUFFER_SIZE	( 1024 * 1024 )
+
+enum ARCHIVE_FILE_ENTRY_TYPES
+{
+	ARCHIVE_FILE_ENTRY_TYPE_FILE		= (uint8_t) '0',
+	ARCHIVE_FILE_ENTRY_TYPE_LINK		= (uint8_t) '1',
+	ARCHIVE_FILE_ENTRY_TYPE_DIRECTORY	= (uint8_t) '5',
+	ARCHIVE_FILE_ENTRY_TYPE_LONG_LINK_NAME	= (uint8_t) 'K',
+	ARCHIVE_FILE_ENTRY_TYPE_LONG_NAME	= (uint8_t) 'L'
+};
+
+typedef struct archive_file archive_file_t;
+
+struct archive_file
+{
+	/* The file handle
+	 */
+	libcfile_file_t *file_handle;
+
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The buffer offset
+	 */
+	size_t buffer_offset;
+
+	/* The modification time of the entries
+	 */
+	uint64_t modification_time;
+
+	/* Value to indicate an entry is open
+	 */
+	uint8_t entry_is_open;
+
+	/* The data size of the open entry
+	 */
+	size64_t entry_data_size;
+
+	/* The data offset of the open entry
+	 */
+	size64_t entry_data_offset;
+
+	/* The hashes of the names of the directory entries
+	 * used to determine if a directory already exists
+	 */
+	uint64_t *directory_hashes;
+
+	/* The number of directory hashes slots
+	 */
+	size_t directory_hashes_size;
+
+	/* The number of directories
+	 */
+	size_t number_of_directories;
+};
+
+int archive_file_initialize(
+     archive_file_t **archive_file,
+     libcerror_error_t **error );
+
+int archive_file_free(
+     archive_file_t **archive_file,
+     libcerror_error_t **error );
+
+int archive_file_open(
+     archive_file_t *archive_file,
+     const libcstring_system_character_t *filename,
+     libcerror_error_t **error );
+
+int archive_file_close(
+     archive_file_t *archive_file,
+     libcerror_error_t **error );
+
+int archive_file_flush(
+     archive_file_t *archive_file,
+     libcerror_error_t **error );
+
+int archive_file_write_buffer(
+     archive_file_t *archive_file,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int archive_file_write_padding(
+     archive_file_t *archive_file,
+     size64_t padding_size,
+     libcerror_error_t **error );
+
+int archive_file_get_entry_name(
+     const libcstring_system_character_t *name,
+     uint8_t **entry_name,
+     size_t *entry_name_size,
+     libcerror_error_t **error );
+
+int archive_file_copy_octal_value(
+     uint8_t *field,
+     size_t field_size,
+     uint64_t value,
+     libcerror_error_t **error );
+
+int archive_file_write_long_name(
+     archive_file_t *archive_file,
+     const uint8_t *name,
+     size_t name_size,
+     uint8_t entry_type,
+     libcerror_error_t **error );
+
+int archive_file_write_header(
+     archive_file_t *archive_file,
+     const uint8_t *entry_name,
+     size_t entry_name_size,
+     const uint8_t *link_name,
+     size_t link_name_size,
+     uint8_t entry_type,
+     size64_t entry_data_size,
+     libcerror_error_t **error );
+
+uint64_t archive_file_get_name_hash(
+          const uint8_t *entry_name,
+          size_t entry_name_size );
+
+int archive_file_directory_exists(
+     archive_file_t *archive_file,
+     const libcstring_system_character_t *name,
+     libcerror_error_t **error );
+
+int archive_file_add_directory(
+     archive_file_t *archive_file,
+     const libcstring_system_character_t *name,
+     libcerror_error_t **error );
+
+int archive_file_open_entry(
+     archive_file_t *archive_file,
+     const libcstring_system_character_t *name,
+     size64_t entry_data_size,
+     libcerror_error_t **error );
+
+int archive_file_write_entry_data(
+     archive_file_t *archive_file,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int archive_file_close_entry(
+     archive_file_t *archive_file,
+     libcerror_error_t **error );
+
+int archive_file_add_link(
+     archive_file_t *archive_file,
+     const libcstring_system_character_t *name,
+     const libcstring_system_character_t *link_target,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
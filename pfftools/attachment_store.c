@@ -0,0 +1,772 @@
+/* 
+ * Content addressed attachment store
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "attachment_store.h"
+#include "content_hash.h"
+#include "pfftools_libcerror.h"
+#include "pfftools_libcstring.h"
+
+/* The initial number of index slots
+ */
+#define ATTACHMENT_STORE_INITIAL_NUMBER_OF_SLOTS	1024
+
+/* Determines the index slot of a data size
+ */
+#define attachment_store_get_slot_index( data_size, number_of_slots ) \
+	(size_t) ( ( ( (uint64_t) ( data_size ) * 0x9e3779b97f4a7c15ULL ) >> 32 ) & ( (uint64_t) ( number_of_slots ) - 1 ) )
+
+/* Initializes the attachment store
+ * Returns 1 if successful or -1 on error
+ */
+int attachment_store_initialize(
+     attachment_store_t **attachment_store,
+     uint8_t use_sha256,
+     libcerror_error_t **error )
+{
+	static char *function = "attachment_store_initialize";
+
+	if( attachment_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attachment store.",
+		 function );
+
+		return( -1 );
+	}
+	if( *attachment_store != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid attachment store value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*attachment_store = memory_allocate_structure(
+	                     attachment_store_t );
+
+	if( *attachment_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create attachment store.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *attachment_store,
+	     0,
+	     sizeof( attachment_store_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear attachment store.",
+		 function );
+
+		memory_free(
+		 *attachment_store );
+
+		*attachment_store = NULL;
+
+		return( -1 );
+	}
+	if( content_hash_initialize(
+	     &( ( *attachment_store )->content_hash ),
+	     use_sha256,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create content hash.",
+		 function );
+
+		goto on_error;
+	}
+	( *attachment_store )->use_sha256 = use_sha256;
+
+	return( 1 );
+
+on_error:
+	if( *attachment_store != NULL )
+	{
+		memory_free(
+		 *attachment_store );
+
+		*attachment_store = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees the attachment store and its elements
+ * Returns 1 if successful or -1 on error
+ */
+int attachment_store_free(
+     attachment_store_t **attachment_store,
+     libcerror_error_t **error )
+{
+	static char *function = "attachment_store_free";
+	size_t entry_index    = 0;
+	int result            = 1;
+
+	if( attachment_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attachment store.",
+		 function );
+
+		return( -1 );
+	}
+	if( *attachment_store != NULL )
+	{
+		if( ( *attachment_store )->entries != NULL )
+		{
+			for( entry_index = 0;
+			     entry_index < ( *attachment_store )->number_of_entries;
+			     entry_index++ )
+			{
+				if( ( *attachment_store )->entries[ entry_index ].location != NULL )
+				{
+					memory_free(
+					 ( *attachment_store )->entries[ entry_index ].location );
+				}
+			}
+			memory_free(
+			 ( *attachment_store )->entries );
+		}
+		if( ( *attachment_store )->slots != NULL )
+		{
+			memory_free(
+			 ( *attachment_store )->slots );
+		}
+		if( content_hash_free(
+		     &( ( *attachment_store )->content_hash ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free content hash.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *attachment_store );
+
+		*attachment_store = NULL;
+	}
+	return( result );
+}
+
+/* Determines if data of a specific size was stored
+ * This allows to skip hashing data of a unique size before it is stored
+ * Returns 1 if data of the size was stored, 0 if not or -1 on error
+ */
+int attachment_store_has_data_size(
+     attachment_store_t *attachment_store,
+     size64_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "attachment_store_has_data_size";
+	size_t slot_index     = 0;
+	size_t slot_value     = 0;
+
+	if( attachment_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attachment store.",
+		 function );
+
+		return( -1 );
+	}
+	if( attachment_store->number_of_entries == 0 )
+	{
+		return( 0 );
+	}
+	slot_index = attachment_store_get_slot_index(
+	              data_size,
+	              attachment_store->number_of_slots );
+
+	for( slot_value = attachment_store->slots[ slot_index ];
+	     slot_value != 0;
+	     slot_value = attachment_store->slots[ slot_index ] )
+	{
+		if( attachment_store->entries[ slot_value - 1 ].data_size == data_size )
+		{
+			return( 1 );
+		}
+		slot_index = ( slot_index + 1 ) & ( attachment_store->number_of_slots - 1 );
+	}
+	return( 0 );
+}
+
+/* Starts hashing the current data
+ * Returns 1 if successful or -1 on error
+ */
+int attachment_store_start_data(
+     attachment_store_t *attachment_store,
+     libcerror_error_t **error )
+{
+	static char *function = "attachment_store_start_data";
+
+	if( attachment_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attachment store.",
+		 function );
+
+		return( -1 );
+	}
+	if( content_hash_reset(
+	     attachment_store->content_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset content hash.",
+		 function );
+
+		return( -1 );
+	}
+	attachment_store->digests_are_set = 0;
+
+	return( 1 );
+}
+
+/* Hashes a buffer of the current data
+ * Returns 1 if successful or -1 on error
+ */
+int attachment_store_update_data(
+     attachment_store_t *attachment_store,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "attachment_store_update_data";
+
+	if( attachment_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attachment store.",
+		 function );
+
+		return( -1 );
+	}
+	if( content_hash_update(
+	     attachment_store->content_hash,
+	     buffer,
+	     buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update content hash.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Finishes hashing the current data and sets its digests
+ * Returns 1 if successful or -1 on error
+ */
+int attachment_store_finish_data(
+     attachment_store_t *attachment_store,
+     libcerror_error_t **error )
+{
+	static char *function = "attachment_store_finish_data";
+
+	if( attachment_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attachment store.",
+		 function );
+
+		return( -1 );
+	}
+	if( content_hash_finalize(
+	     attachment_store->content_hash,
+	     &( attachment_store->fast_hash ),
+	     attachment_store->sha256_digest,
+	     CONTENT_HASH_SHA256_DIGEST_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to finalize content hash.",
+		 function );
+
+		return( -1 );
+	}
+	attachment_store->digests_are_set = 1;
+
+	return( 1 );
+}
+
+/* Retrieves the entry of stored data that matches the digests of the current data
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int attachment_store_get_entry(
+     attachment_store_t *attachment_store,
+     size64_t data_size,
+     attachment_store_entry_t **entry,
+     libcerror_error_t **error )
+{
+	attachment_store_entry_t *safe_entry = NULL;
+	static char *function                = "attachment_store_get_entry";
+	size_t slot_index                    = 0;
+	size_t slot_value                    = 0;
+
+	if( attachment_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attachment store.",
+		 function );
+
+		return( -1 );
+	}
+	if( attachment_store->digests_are_set == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid attachment store - missing digests.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( attachment_store->number_of_entries == 0 )
+	{
+		return( 0 );
+	}
+	slot_index = attachment_store_get_slot_index(
+	              data_size,
+	              attachment_store->number_of_slots );
+
+	for( slot_value = attachment_store->slots[ slot_index ];
+	     slot_value != 0;
+	     slot_value = attachment_store->slots[ slot_index ] )
+	{
+		safe_entry = &( attachment_store->entries[ slot_value - 1 ] );
+
+		if( ( safe_entry->data_size == data_size )
+		 && ( safe_entry->fast_hash == attachment_store->fast_hash ) )
+		{
+			if( ( attachment_store->use_sha256 == 0 )
+			 || ( memory_compare(
+			       safe_entry->sha256_digest,
+			       attachment_store->sha256_digest,
+			       CONTENT_HASH_SHA256_DIGEST_SIZE ) == 0 ) )
+			{
+				*entry = safe_entry;
+
+				return( 1 );
+			}
+		}
+		slot_index = ( slot_index + 1 ) & ( attachment_store->number_of_slots - 1 );
+	}
+	return( 0 );
+}
+
+/* Resizes the index slots and re-indexes the entries
+ * Returns 1 if successful or -1 on error
+ */
+int attachment_store_resize_slots(
+     attachment_store_t *attachment_store,
+     size_t number_of_slots,
+     libcerror_error_t **error )
+{
+	size_t *slots         = NULL;
+	static char *function = "attachment_store_resize_slots";
+	size_t entry_index    = 0;
+	size_t slot_index     = 0;
+
+	if( attachment_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attachment store.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_slots == 0 )
+	 || ( ( number_of_slots & ( number_of_slots - 1 ) ) != 0 )
+	 || ( number_of_slots <= attachment_store->number_of_entries )
+	 || ( number_of_slots > (size_t) ( SSIZE_MAX / sizeof( size_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of slots value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	slots = (size_t *) memory_allocate(
+	                    sizeof( size_t ) * number_of_slots );
+
+	if( slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slots.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     slots,
+	     0,
+	     sizeof( size_t ) * number_of_slots ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear slots.",
+		 function );
+
+		memory_free(
+		 slots );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < attachment_store->number_of_entries;
+	     entry_index++ )
+	{
+		slot_index = attachment_store_get_slot_index(
+		              attachment_store->entries[ entry_index ].data_size,
+		              number_of_slots );
+
+		while( slots[ slot_index ] != 0 )
+		{
+			slot_index = ( slot_index + 1 ) & ( number_of_slots - 1 );
+		}
+		slots[ slot_index ] = entry_index + 1;
+	}
+	if( attachment_store->slots != NULL )
+	{
+		memory_free(
+		 attachment_store->slots );
+	}
+	attachment_store->slots           = slots;
+	attachment_store->number_of_slots = number_of_slots;
+
+	return( 1 );
+}
+
+/* Adds an entry for the current data, using its digests, to the store
+ * The location is copied, it can be NULL if the data was stored in the blob file
+ * Returns 1 if successful or -1 on error
+ */
+int attachment_store_add_entry(
+     attachment_store_t *attachment_store,
+     size64_t data_size,
+     const libcstring_system_character_t *location,
+     size_t location_length,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	attachment_store_entry_t *entries = NULL;
+	attachment_store_entry_t *entry   = NULL;
+	static char *function             = "attachment_store_add_entry";
+	size_t entries_size               = 0;
+	size_t number_of_slots            = 0;
+	size_t slot_index                 = 0;
+
+	if( attachment_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attachment store.",
+		 function );
+
+		return( -1 );
+	}
+	if( attachment_store->digests_are_set == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid attachment store - missing digests.",
+		 function );
+
+		return( -1 );
+	}
+	if( location_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid location length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Keep the index slots at most half full
+	 */
+	if( ( ( attachment_store->number_of_entries + 1 ) * 2 ) > attachment_store->number_of_slots )
+	{
+		if( attachment_store->number_of_slots == 0 )
+		{
+			number_of_slots = ATTACHMENT_STORE_INITIAL_NUMBER_OF_SLOTS;
+		}
+		else
+		{
+			number_of_slots = attachment_store->number_of_slots * 2;
+		}
+		if( attachment_store_resize_slots(
+		     attachment_store,
+		     number_of_slots,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize slots.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( attachment_store->number_of_entries >= attachment_store->entries_size )
+	{
+		entries_size = attachment_store->number_of_slots / 2;
+
+		if( entries_size > (size_t) ( SSIZE_MAX / sizeof( attachment_store_entry_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid entries size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		entries = (attachment_store_entry_t *) memory_reallocate(
+		                                        attachment_store->entries,
+		                                        sizeof( attachment_store_entry_t ) * entries_size );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		attachment_store->entries      = entries;
+		attachment_store->entries_size = entries_size;
+	}
+	entry = &( attachment_store->entries[ attachment_store->number_of_entries ] );
+
+	if( memory_set(
+	     entry,
+	     0,
+	     sizeof( attachment_store_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( location != NULL )
+	{
+		entry->location = libcstring_system_string_allocate(
+		                   location_length + 1 );
+
+		if( entry->location == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create location.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcstring_system_string_copy(
+		     entry->location,
+		     location,
+		     location_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy location.",
+			 function );
+
+			memory_free(
+			 entry->location );
+
+			entry->location = NULL;
+
+			return( -1 );
+		}
+		entry->location[ location_length ] = 0;
+	}
+	entry->data_size = data_size;
+	entry->fast_hash = attachment_store->fast_hash;
+	entry->offset    = offset;
+
+	if( attachment_store->use_sha256 != 0 )
+	{
+		if( memory_copy(
+		     entry->sha256_digest,
+		     attachment_store->sha256_digest,
+		     CONTENT_HASH_SHA256_DIGEST_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy SHA-256 digest.",
+			 function );
+
+			if( entry->location != NULL )
+			{
+				memory_free(
+				 entry->location );
+
+				entry->location = NULL;
+			}
+			return( -1 );
+		}
+	}
+	slot_index = attachment_store_get_slot_index(
+	              data_size,
+	              attachment_store->number_of_slots );
+
+	while( attachment_store->slots[ slot_index ] != 0 )
+	{
+		slot_index = ( slot_index + 1 ) & ( attachment_store->number_of_slots - 1 );
+	}
+	attachment_store->number_of_entries += 1;
+
+	attachment_store->slots[ slot_index ] = attachment_store->number_of_entries;
+
+	return( 1 );
+}
+
+/* Counts duplicate data that was not stored
+ * Returns 1 if successful or -1 on error
+ */
+int attachment_store_add_duplicate(
+     attachment_store_t *attachment_store,
+     size64_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "attachment_store_add_duplicate";
+
+	if( attachment_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attachment store.",
+		 function );
+
+		return( -1 );
+	}
+	attachment_store->number_of_duplicates += 1;
+	attachment_store->duplicate_data_size  += data_size;
+
+	return( 1 );
+}
+
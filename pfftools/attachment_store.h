@@ -0,0 +1,174 @@
+/* 
+ * Content addressed attachment store
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _ATTACHMENT_STORE_H )
+#define _ATTACHMENT_STORE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "content_hash.h"
+#include "pfftools_libcerror.h"
+#include "pfftools_libcstring.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct attachment_store_entry attachment_store_entry_t;
+
+struct attachment_store_entry
+{
+	/* The data size
+	 */
+	size64_t data_size;
+
+	/* The fast hash of the data
+	 */
+	uint64_t fast_hash;
+
+	/* The SHA-256 digest of the data
+	 */
+	uint8_t sha256_digest[ CONTENT_HASH_SHA256_DIGEST_SIZE ];
+
+	/* The location the data was stored at
+	 * or NULL if the data was stored in the blob file
+	 */
+	libcstring_system_character_t *location;
+
+	/* The offset the data was stored at in the blob file
+	 */
+	off64_t offset;
+};
+
+typedef struct attachment_store attachment_store_t;
+
+struct attachment_store
+{
+	/* The content hash
+	 */
+	content_hash_t *content_hash;
+
+	/* Value to indicate the SHA-256 digest is compared
+	 */
+	uint8_t use_sha256;
+
+	/* The fast hash of the current data
+	 */
+	uint64_t fast_hash;
+
+	/* The SHA-256 digest of the current data
+	 */
+	uint8_t sha256_digest[ CONTENT_HASH_SHA256_DIGEST_SIZE ];
+
+	/* Value to indicate the digests of the current data are set
+	 */
+	uint8_t digests_are_set;
+
+	/* The entries of the stored data
+	 */
+	attachment_store_entry_t *entries;
+
+	/* The number of allocated entries
+	 */
+	size_t entries_size;
+
+	/* The number of entries
+	 */
+	size_t number_of_entries;
+
+	/* The index slots, that contain the entry index + 1 or 0 if empty,
+	 * the slot of an entry is determined by its data size
+	 */
+	size_t *slots;
+
+	/* The number of index slots, which is a power of 2
+	 */
+	size_t number_of_slots;
+
+	/* The number of duplicates
+	 */
+	uint64_t number_of_duplicates;
+
+	/* The size of the duplicate data that was not stored
+	 */
+	size64_t duplicate_data_size;
+};
+
+int attachment_store_initialize(
+     attachment_store_t **attachment_store,
+     uint8_t use_sha256,
+     libcerror_error_t **error );
+
+int attachment_store_free(
+     attachment_store_t **attachment_store,
+     libcerror_error_t **error );
+
+int attachment_store_has_data_size(
+     attachment_store_t *attachment_store,
+     size64_t data_size,
+     libcerror_error_t **error );
+
+int attachment_store_start_data(
+     attachment_store_t *attachment_store,
+     libcerror_error_t **error );
+
+int attachment_store_update_data(
+     attachment_store_t *attachment_store,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int attachment_store_finish_data(
+     attachment_store_t *attachment_store,
+     libcerror_error_t **error );
+
+int attachment_store_get_entry(
+     attachment_store_t *attachment_store,
+     size64_t data_size,
+     attachment_store_entry_t **entry,
+     libcerror_error_t **error );
+
+int attachment_store_resize_slots(
+     attachment_store_t *attachment_store,
+     size_t number_of_slots,
+     libcerror_error_t **error );
+
+int attachment_store_add_entry(
+     attachment_store_t *attachment_store,
+     size64_t data_size,
+     const libcstring_system_character_t *location,
+     size_t location_length,
+     off64_t offset,
+     libcerror_error_t **error );
+
+int attachment_store_add_duplicate(
+     attachment_store_t *attachment_store,
+     size64_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
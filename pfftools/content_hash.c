@@ -0,0 +1,662 @@
+/* 
+ * Content hash
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "content_hash.h"
+#include "pfftools_libcerror.h"
+
+/* The fast hash is the 64-bit xxHash of the data
+ */
+#define CONTENT_HASH_PRIME64_1	0x9e3779b185ebca87ULL
+#define CONTENT_HASH_PRIME64_2	0xc2b2ae3d27d4eb4fULL
+#define CONTENT_HASH_PRIME64_3	0x165667b19e3779f9ULL
+#define CONTENT_HASH_PRIME64_4	0x85ebca77c2b2ae63ULL
+#define CONTENT_HASH_PRIME64_5	0x27d4eb2f165667c5ULL
+
+#define content_hash_fast_hash_round( accumulator, value ) \
+	accumulator += ( value ) * CONTENT_HASH_PRIME64_2; \
+	accumulator  = byte_stream_bit_rotate_left_64bit( accumulator, 31 ); \
+	accumulator *= CONTENT_HASH_PRIME64_1
+
+#define content_hash_sha256_choice( x, y, z ) \
+	( ( ( x ) & ( y ) ) ^ ( ~( x ) & ( z ) ) )
+
+#define content_hash_sha256_majority( x, y, z ) \
+	( ( ( x ) & ( y ) ) ^ ( ( x ) & ( z ) ) ^ ( ( y ) & ( z ) ) )
+
+#define content_hash_sha256_sigma0( x ) \
+	( byte_stream_bit_rotate_right_32bit( x, 2 ) ^ byte_stream_bit_rotate_right_32bit( x, 13 ) ^ byte_stream_bit_rotate_right_32bit( x, 22 ) )
+
+#define content_hash_sha256_sigma1( x ) \
+	( byte_stream_bit_rotate_right_32bit( x, 6 ) ^ byte_stream_bit_rotate_right_32bit( x, 11 ) ^ byte_stream_bit_rotate_right_32bit( x, 25 ) )
+
+#define content_hash_sha256_schedule0( x ) \
+	( byte_stream_bit_rotate_right_32bit( x, 7 ) ^ byte_stream_bit_rotate_right_32bit( x, 18 ) ^ ( ( x ) >> 3 ) )
+
+#define content_hash_sha256_schedule1( x ) \
+	( byte_stream_bit_rotate_right_32bit( x, 17 ) ^ byte_stream_bit_rotate_right_32bit( x, 19 ) ^ ( ( x ) >> 10 ) )
+
+static const uint32_t content_hash_sha256_round_constants[ 64 ] = {
+	0x428a2f98UL, 0x71374491UL, 0xb5c0fbcfUL, 0xe9b5dba5UL, 0x3956c25bUL, 0x59f111f1UL, 0x923f82a4UL, 0xab1c5ed5UL,
+	0xd807aa98UL, 0x12835b01UL, 0x243185beUL, 0x550c7dc3UL, 0x72be5d74UL, 0x80deb1feUL, 0x9bdc06a7UL, 0xc19bf174UL,
+	0xe49b69c1UL, 0xefbe4786UL, 0x0fc19dc6UL, 0x240ca1ccUL, 0x2de92c6fUL, 0x4a7484aaUL, 0x5cb0a9dcUL, 0x76f988daUL,
+	0x983e5152UL, 0xa831c66dUL, 0xb00327c8UL, 0xbf597fc7UL, 0xc6e00bf3UL, 0xd5a79147UL, 0x06ca6351UL, 0x14292967UL,
+	0x27b70a85UL, 0x2e1b2138UL, 0x4d2c6dfcUL, 0x53380d13UL, 0x650a7354UL, 0x766a0abbUL, 0x81c2c92eUL, 0x92722c85UL,
+	0xa2bfe8a1UL, 0xa81a664bUL, 0xc24b8b70UL, 0xc76c51a3UL, 0xd192e819UL, 0xd6990624UL, 0xf40e3585UL, 0x106aa070UL,
+	0x19a4c116UL, 0x1e376c08UL, 0x2748774cUL, 0x34b0bcb5UL, 0x391c0cb3UL, 0x4ed8aa4aUL, 0x5b9cca4fUL, 0x682e6ff3UL,
+	0x748f82eeUL, 0x78a5636fUL, 0x84c87814UL, 0x8cc70208UL, 0x90befffaUL, 0xa4506cebUL, 0xbef9a3f7UL, 0xc67178f2UL };
+
+/* Initializes the content hash
+ * Returns 1 if successful or -1 on error
+ */
+int content_hash_initialize(
+     content_hash_t **content_hash,
+     uint8_t calculate_sha256,
+     libcerror_error_t **error )
+{
+	static char *function = "content_hash_initialize";
+
+	if( content_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid content hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( *content_hash != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid content hash value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*content_hash = memory_allocate_structure(
+	                 content_hash_t );
+
+	if( *content_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create content hash.",
+		 function );
+
+		return( -1 );
+	}
+	( *content_hash )->calculate_sha256 = calculate_sha256;
+
+	if( content_hash_reset(
+	     *content_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to reset content hash.",
+		 function );
+
+		memory_free(
+		 *content_hash );
+
+		*content_hash = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees the content hash
+ * Returns 1 if successful or -1 on error
+ */
+int content_hash_free(
+     content_hash_t **content_hash,
+     libcerror_error_t **error )
+{
+	static char *function = "content_hash_free";
+
+	if( content_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid content hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( *content_hash != NULL )
+	{
+		memory_free(
+		 *content_hash );
+
+		*content_hash = NULL;
+	}
+	return( 1 );
+}
+
+/* Resets the content hash to hash new data
+ * Returns 1 if successful or -1 on error
+ */
+int content_hash_reset(
+     content_hash_t *content_hash,
+     libcerror_error_t **error )
+{
+	static char *function = "content_hash_reset";
+
+	if( content_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid content hash.",
+		 function );
+
+		return( -1 );
+	}
+	content_hash->fast_hash_accumulators[ 0 ] = CONTENT_HASH_PRIME64_1 + CONTENT_HASH_PRIME64_2;
+	content_hash->fast_hash_accumulators[ 1 ] = CONTENT_HASH_PRIME64_2;
+	content_hash->fast_hash_accumulators[ 2 ] = 0;
+	content_hash->fast_hash_accumulators[ 3 ] = (uint64_t) 0 - CONTENT_HASH_PRIME64_1;
+	content_hash->fast_hash_buffer_size       = 0;
+	content_hash->data_size                   = 0;
+
+	content_hash->sha256_state[ 0 ]   = 0x6a09e667UL;
+	content_hash->sha256_state[ 1 ]   = 0xbb67ae85UL;
+	content_hash->sha256_state[ 2 ]   = 0x3c6ef372UL;
+	content_hash->sha256_state[ 3 ]   = 0xa54ff53aUL;
+	content_hash->sha256_state[ 4 ]   = 0x510e527fUL;
+	content_hash->sha256_state[ 5 ]   = 0x9b05688cUL;
+	content_hash->sha256_state[ 6 ]   = 0x1f83d9abUL;
+	content_hash->sha256_state[ 7 ]   = 0x5be0cd19UL;
+	content_hash->sha256_buffer_size  = 0;
+
+	return( 1 );
+}
+
+/* Hashes a stripe of 32 bytes into the fast hash accumulators
+ */
+void content_hash_fast_hash_stripe(
+      content_hash_t *content_hash,
+      const uint8_t *stripe )
+{
+	uint64_t value = 0;
+	int lane_index = 0;
+
+	for( lane_index = 0;
+	     lane_index < 4;
+	     lane_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( stripe[ lane_index * 8 ] ),
+		 value );
+
+		content_hash_fast_hash_round(
+		 content_hash->fast_hash_accumulators[ lane_index ],
+		 value );
+	}
+}
+
+/* Hashes a block of 64 bytes into the SHA-256 state
+ */
+void content_hash_sha256_block(
+      content_hash_t *content_hash,
+      const uint8_t *block )
+{
+	uint32_t schedule[ 64 ];
+	uint32_t values[ 8 ];
+
+	uint32_t value1 = 0;
+	uint32_t value2 = 0;
+	int index       = 0;
+
+	for( index = 0;
+	     index < 16;
+	     index++ )
+	{
+		byte_stream_copy_to_uint32_big_endian(
+		 &( block[ index * 4 ] ),
+		 schedule[ index ] );
+	}
+	for( index = 16;
+	     index < 64;
+	     index++ )
+	{
+		schedule[ index ] = content_hash_sha256_schedule1( schedule[ index - 2 ] )
+		                  + schedule[ index - 7 ]
+		                  + content_hash_sha256_schedule0( schedule[ index - 15 ] )
+		                  + schedule[ index - 16 ];
+	}
+	for( index = 0;
+	     index < 8;
+	     index++ )
+	{
+		values[ index ] = content_hash->sha256_state[ index ];
+	}
+	for( index = 0;
+	     index < 64;
+	     index++ )
+	{
+		value1 = values[ 7 ]
+		       + content_hash_sha256_sigma1( values[ 4 ] )
+		       + content_hash_sha256_choice( values[ 4 ], values[ 5 ], values[ 6 ] )
+		       + content_hash_sha256_round_constants[ index ]
+		       + schedule[ index ];
+
+		value2 = content_hash_sha256_sigma0( values[ 0 ] )
+		       + content_hash_sha256_majority( values[ 0 ], values[ 1 ], values[ 2 ] );
+
+		values[ 7 ] = values[ 6 ];
+		values[ 6 ] = values[ 5 ];
+		values[ 5 ] = values[ 4 ];
+		values[ 4 ] = values[ 3 ] + value1;
+		values[ 3 ] = values[ 2 ];
+		values[ 2 ] = values[ 1 ];
+		values[ 1 ] = values[ 0 ];
+		values[ 0 ] = value1 + value2;
+	}
+	for( index = 0;
+	     index < 8;
+	     index++ )
+	{
+		content_hash->sha256_state[ index ] += values[ index ];
+	}
+}
+
+/* Updates the content hash with the data in the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int content_hash_update(
+     content_hash_t *content_hash,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "content_hash_update";
+	size_t buffer_offset  = 0;
+	size_t copy_size      = 0;
+
+	if( content_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid content hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	content_hash->data_size += buffer_size;
+
+	/* Complete a partial stripe from a previous update first
+	 */
+	if( content_hash->fast_hash_buffer_size > 0 )
+	{
+		copy_size = 32 - content_hash->fast_hash_buffer_size;
+
+		if( copy_size > buffer_size )
+		{
+			copy_size = buffer_size;
+		}
+		if( memory_copy(
+		     &( content_hash->fast_hash_buffer[ content_hash->fast_hash_buffer_size ] ),
+		     buffer,
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to fast hash buffer.",
+			 function );
+
+			return( -1 );
+		}
+		content_hash->fast_hash_buffer_size += copy_size;
+		buffer_offset                        = copy_size;
+
+		if( content_hash->fast_hash_buffer_size == 32 )
+		{
+			content_hash_fast_hash_stripe(
+			 content_hash,
+			 content_hash->fast_hash_buffer );
+
+			content_hash->fast_hash_buffer_size = 0;
+		}
+	}
+	while( ( buffer_size - buffer_offset ) >= 32 )
+	{
+		content_hash_fast_hash_stripe(
+		 content_hash,
+		 &( buffer[ buffer_offset ] ) );
+
+		buffer_offset += 32;
+	}
+	if( buffer_offset < buffer_size )
+	{
+		if( memory_copy(
+		     &( content_hash->fast_hash_buffer[ content_hash->fast_hash_buffer_size ] ),
+		     &( buffer[ buffer_offset ] ),
+		     buffer_size - buffer_offset ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to fast hash buffer.",
+			 function );
+
+			return( -1 );
+		}
+		content_hash->fast_hash_buffer_size += buffer_size - buffer_offset;
+	}
+	if( content_hash->calculate_sha256 == 0 )
+	{
+		return( 1 );
+	}
+	buffer_offset = 0;
+
+	if( content_hash->sha256_buffer_size > 0 )
+	{
+		copy_size = 64 - content_hash->sha256_buffer_size;
+
+		if( copy_size > buffer_size )
+		{
+			copy_size = buffer_size;
+		}
+		if( memory_copy(
+		     &( content_hash->sha256_buffer[ content_hash->sha256_buffer_size ] ),
+		     buffer,
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to SHA-256 buffer.",
+			 function );
+
+			return( -1 );
+		}
+		content_hash->sha256_buffer_size += copy_size;
+		buffer_offset                     = copy_size;
+
+		if( content_hash->sha256_buffer_size == 64 )
+		{
+			content_hash_sha256_block(
+			 content_hash,
+			 content_hash->sha256_buffer );
+
+			content_hash->sha256_buffer_size = 0;
+		}
+	}
+	while( ( buffer_size - buffer_offset ) >= 64 )
+	{
+		content_hash_sha256_block(
+		 content_hash,
+		 &( buffer[ buffer_offset ] ) );
+
+		buffer_offset += 64;
+	}
+	if( buffer_offset < buffer_size )
+	{
+		if( memory_copy(
+		     &( content_hash->sha256_buffer[ content_hash->sha256_buffer_size ] ),
+		     &( buffer[ buffer_offset ] ),
+		     buffer_size - buffer_offset ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to SHA-256 buffer.",
+			 function );
+
+			return( -1 );
+		}
+		content_hash->sha256_buffer_size += buffer_size - buffer_offset;
+	}
+	return( 1 );
+}
+
+/* Finalizes the content hash and retrieves the digests
+ * The SHA-256 digest is only retrieved if it is calculated
+ * Returns 1 if successful or -1 on error
+ */
+int content_hash_finalize(
+     content_hash_t *content_hash,
+     uint64_t *fast_hash,
+     uint8_t *sha256_digest,
+     size_t sha256_digest_size,
+     libcerror_error_t **error )
+{
+	uint8_t *buffer       = NULL;
+	static char *function = "content_hash_finalize";
+	size_t buffer_index   = 0;
+	uint64_t hash         = 0;
+	uint64_t lane_value   = 0;
+	uint64_t value        = 0;
+	int lane_index        = 0;
+
+	if( content_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid content hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( fast_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fast hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( content_hash->calculate_sha256 != 0 )
+	{
+		if( sha256_digest == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid SHA-256 digest.",
+			 function );
+
+			return( -1 );
+		}
+		if( sha256_digest_size < CONTENT_HASH_SHA256_DIGEST_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid SHA-256 digest size value too small.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( content_hash->data_size >= 32 )
+	{
+		hash = byte_stream_bit_rotate_left_64bit( content_hash->fast_hash_accumulators[ 0 ], 1 )
+		     + byte_stream_bit_rotate_left_64bit( content_hash->fast_hash_accumulators[ 1 ], 7 )
+		     + byte_stream_bit_rotate_left_64bit( content_hash->fast_hash_accumulators[ 2 ], 12 )
+		     + byte_stream_bit_rotate_left_64bit( content_hash->fast_hash_accumulators[ 3 ], 18 );
+
+		for( lane_index = 0;
+		     lane_index < 4;
+		     lane_index++ )
+		{
+			lane_value = 0;
+
+			content_hash_fast_hash_round(
+			 lane_value,
+			 content_hash->fast_hash_accumulators[ lane_index ] );
+
+			hash ^= lane_value;
+			hash  = ( hash * CONTENT_HASH_PRIME64_1 ) + CONTENT_HASH_PRIME64_4;
+		}
+	}
+	else
+	{
+		hash = CONTENT_HASH_PRIME64_5;
+	}
+	hash += (uint64_t) content_hash->data_size;
+
+	buffer = content_hash->fast_hash_buffer;
+
+	while( ( content_hash->fast_hash_buffer_size - buffer_index ) >= 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( buffer[ buffer_index ] ),
+		 value );
+
+		buffer_index += 8;
+
+		lane_value = 0;
+
+		content_hash_fast_hash_round(
+		 lane_value,
+		 value );
+
+		hash ^= lane_value;
+		hash  = ( byte_stream_bit_rotate_left_64bit( hash, 27 ) * CONTENT_HASH_PRIME64_1 ) + CONTENT_HASH_PRIME64_4;
+	}
+	if( ( content_hash->fast_hash_buffer_size - buffer_index ) >= 4 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( buffer[ buffer_index ] ),
+		 value );
+
+		buffer_index += 4;
+
+		hash ^= value * CONTENT_HASH_PRIME64_1;
+		hash  = ( byte_stream_bit_rotate_left_64bit( hash, 23 ) * CONTENT_HASH_PRIME64_2 ) + CONTENT_HASH_PRIME64_3;
+	}
+	while( buffer_index < content_hash->fast_hash_buffer_size )
+	{
+		hash ^= (uint64_t) buffer[ buffer_index++ ] * CONTENT_HASH_PRIME64_5;
+		hash  = byte_stream_bit_rotate_left_64bit( hash, 11 ) * CONTENT_HASH_PRIME64_1;
+	}
+	hash ^= hash >> 33;
+	hash *= CONTENT_HASH_PRIME64_2;
+	hash ^= hash >> 29;
+	hash *= CONTENT_HASH_PRIME64_3;
+	hash ^= hash >> 32;
+
+	*fast_hash = hash;
+
+	if( content_hash->calculate_sha256 == 0 )
+	{
+		return( 1 );
+	}
+	/* The SHA-256 padding consists of a 1 bit, 0 bits and the data size in bits
+	 */
+	buffer       = content_hash->sha256_buffer;
+	buffer_index = content_hash->sha256_buffer_size;
+
+	buffer[ buffer_index++ ] = 0x80;
+
+	if( buffer_index > 56 )
+	{
+		while( buffer_index < 64 )
+		{
+			buffer[ buffer_index++ ] = 0;
+		}
+		content_hash_sha256_block(
+		 content_hash,
+		 buffer );
+
+		buffer_index = 0;
+	}
+	while( buffer_index < 56 )
+	{
+		buffer[ buffer_index++ ] = 0;
+	}
+	byte_stream_copy_from_uint64_big_endian(
+	 &( buffer[ 56 ] ),
+	 (uint64_t) content_hash->data_size << 3 );
+
+	content_hash_sha256_block(
+	 content_hash,
+	 buffer );
+
+	for( lane_index = 0;
+	     lane_index < 8;
+	     lane_index++ )
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 &( sha256_digest[ lane_index * 4 ] ),
+		 content_hash->sha256_state[ lane_index ] );
+	}
+	content_hash->sha256_buffer_size = 0;
+
+	return( 1 );
+}
+
@@ -0,0 +1,115 @@
+/* 
+ * Content hash
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _CONTENT_HASH_H )
+#define _CONTENT_HASH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pfftools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of a SHA-256 digest
+ */
+#define CONTENT_HASH_SHA256_DIGEST_SIZE		32
+
+typedef struct content_hash content_hash_t;
+
+struct content_hash
+{
+	/* The (64-bit xxHash) fast hash accumulators
+	 */
+	uint64_t fast_hash_accumulators[ 4 ];
+
+	/* The fast hash stripe buffer
+	 */
+	uint8_t fast_hash_buffer[ 32 ];
+
+	/* The number of bytes in the fast hash stripe buffer
+	 */
+	size_t fast_hash_buffer_size;
+
+	/* The total number of bytes hashed
+	 */
+	size64_t data_size;
+
+	/* Value to indicate the SHA-256 digest should be calculated
+	 */
+	uint8_t calculate_sha256;
+
+	/* The SHA-256 state
+	 */
+	uint32_t sha256_state[ 8 ];
+
+	/* The SHA-256 block buffer
+	 */
+	uint8_t sha256_buffer[ 64 ];
+
+	/* The number of bytes in the SHA-256 block buffer
+	 */
+	size_t sha256_buffer_size;
+};
+
+int content_hash_initialize(
+     content_hash_t **content_hash,
+     uint8_t calculate_sha256,
+     libcerror_error_t **error );
+
+int content_hash_free(
+     content_hash_t **content_hash,
+     libcerror_error_t **error );
+
+int content_hash_reset(
+     content_hash_t *content_hash,
+     libcerror_error_t **error );
+
+void content_hash_fast_hash_stripe(
+      content_hash_t *content_hash,
+      const uint8_t *stripe );
+
+void content_hash_sha256_block(
+      content_hash_t *content_hash,
+      const uint8_t *block );
+
+int content_hash_update(
+     content_hash_t *content_hash,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int content_hash_finalize(
+     content_hash_t *content_hash,
+     uint64_t *fast_hash,
+     uint8_t *sha256_digest,
+     size_t sha256_digest_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
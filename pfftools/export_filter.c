@@ -0,0 +1,1029 @@
+/* 
+ * Export filter functions
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "export_filter.h"
+#include "pfftools_libcerror.h"
+#include "pfftools_libcpath.h"
+#include "pfftools_libcstring.h"
+#include "pfftools_libpff.h"
+
+/* The number of 100th nano seconds in a day
+ */
+#define EXPORT_FILTER_FILETIME_DAY	(uint64_t) 864000000000ULL
+
+typedef struct export_filter_item_type_name export_filter_item_type_name_t;
+
+struct export_filter_item_type_name
+{
+	/* The name
+	 */
+	const libcstring_system_character_t *name;
+
+	/* The name length
+	 */
+	size_t name_length;
+
+	/* The item type
+	 */
+	uint8_t item_type;
+};
+
+/* The item type names that can be used in the item types filter
+ */
+const export_filter_item_type_name_t export_filter_item_type_names[] = {
+	{ _LIBCSTRING_SYSTEM_STRING( "activity" ),		8,	LIBPFF_ITEM_TYPE_ACTIVITY },
+	{ _LIBCSTRING_SYSTEM_STRING( "appointment" ),		11,	LIBPFF_ITEM_TYPE_APPOINTMENT },
+	{ _LIBCSTRING_SYSTEM_STRING( "common" ),		6,	LIBPFF_ITEM_TYPE_COMMON },
+	{ _LIBCSTRING_SYSTEM_STRING( "configuration" ),		13,	LIBPFF_ITEM_TYPE_CONFIGURATION },
+	{ _LIBCSTRING_SYSTEM_STRING( "conflict_message" ),	16,	LIBPFF_ITEM_TYPE_CONFLICT_MESSAGE },
+	{ _LIBCSTRING_SYSTEM_STRING( "contact" ),		7,	LIBPFF_ITEM_TYPE_CONTACT },
+	{ _LIBCSTRING_SYSTEM_STRING( "distribution_list" ),	17,	LIBPFF_ITEM_TYPE_DISTRIBUTION_LIST },
+	{ _LIBCSTRING_SYSTEM_STRING( "document" ),		8,	LIBPFF_ITEM_TYPE_DOCUMENT },
+	{ _LIBCSTRING_SYSTEM_STRING( "email" ),			5,	LIBPFF_ITEM_TYPE_EMAIL },
+	{ _LIBCSTRING_SYSTEM_STRING( "email_smime" ),		11,	LIBPFF_ITEM_TYPE_EMAIL_SMIME },
+	{ _LIBCSTRING_SYSTEM_STRING( "fax" ),			3,	LIBPFF_ITEM_TYPE_FAX },
+	{ _LIBCSTRING_SYSTEM_STRING( "meeting" ),		7,	LIBPFF_ITEM_TYPE_MEETING },
+	{ _LIBCSTRING_SYSTEM_STRING( "mms" ),			3,	LIBPFF_ITEM_TYPE_MMS },
+	{ _LIBCSTRING_SYSTEM_STRING( "note" ),			4,	LIBPFF_ITEM_TYPE_NOTE },
+	{ _LIBCSTRING_SYSTEM_STRING( "posting_note" ),		12,	LIBPFF_ITEM_TYPE_POSTING_NOTE },
+	{ _LIBCSTRING_SYSTEM_STRING( "rss_feed" ),		8,	LIBPFF_ITEM_TYPE_RSS_FEED },
+	{ _LIBCSTRING_SYSTEM_STRING( "sharing" ),		7,	LIBPFF_ITEM_TYPE_SHARING },
+	{ _LIBCSTRING_SYSTEM_STRING( "sms" ),			3,	LIBPFF_ITEM_TYPE_SMS },
+	{ _LIBCSTRING_SYSTEM_STRING( "task" ),			4,	LIBPFF_ITEM_TYPE_TASK },
+	{ _LIBCSTRING_SYSTEM_STRING( "task_request" ),		12,	LIBPFF_ITEM_TYPE_TASK_REQUEST },
+	{ _LIBCSTRING_SYSTEM_STRING( "unknown" ),		7,	LIBPFF_ITEM_TYPE_UNKNOWN },
+	{ _LIBCSTRING_SYSTEM_STRING( "voicemail" ),		9,	LIBPFF_ITEM_TYPE_VOICEMAIL },
+	{ NULL,							0,	LIBPFF_ITEM_TYPE_UNDEFINED } };
+
+/* Initializes the export filter
+ * Returns 1 if successful or -1 on error
+ */
+int export_filter_initialize(
+     export_filter_t **export_filter,
+     libcerror_error_t **error )
+{
+	static char *function = "export_filter_initialize";
+
+	if( export_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*export_filter = memory_allocate_structure(
+	                  export_filter_t );
+
+	if( *export_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export filter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *export_filter,
+	     0,
+	     sizeof( export_filter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear export filter.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *export_filter != NULL )
+	{
+		memory_free(
+		 *export_filter );
+
+		*export_filter = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees the export filter
+ * Returns 1 if successful or -1 on error
+ */
+int export_filter_free(
+     export_filter_t **export_filter,
+     libcerror_error_t **error )
+{
+	static char *function = "export_filter_free";
+
+	if( export_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_filter != NULL )
+	{
+		if( ( *export_filter )->folder_path_pattern != NULL )
+		{
+			memory_free(
+			 ( *export_filter )->folder_path_pattern );
+		}
+		memory_free(
+		 *export_filter );
+
+		*export_filter = NULL;
+	}
+	return( 1 );
+}
+
+/* Determines if any of the export filter criteria is set
+ * Returns 1 if set or 0 if not
+ */
+int export_filter_is_set(
+     export_filter_t *export_filter )
+{
+	if( export_filter == NULL )
+	{
+		return( 0 );
+	}
+	if( ( export_filter->folder_path_pattern != NULL )
+	 || ( export_filter->start_time != 0 )
+	 || ( export_filter->end_time != 0 )
+	 || ( export_filter->item_types != 0 )
+	 || ( export_filter->has_attachments != 0 ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Sets the folder path pattern
+ * The pattern is matched against the folder path relative to the export
+ * directory, where '*' matches any sequence of characters and '?' any single character
+ * Returns 1 if successful or -1 on error
+ */
+int export_filter_set_folder_path_pattern(
+     export_filter_t *export_filter,
+     const libcstring_system_character_t *folder_path_pattern,
+     libcerror_error_t **error )
+{
+	static char *function             = "export_filter_set_folder_path_pattern";
+	size_t folder_path_pattern_length = 0;
+
+	if( export_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( folder_path_pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid folder path pattern.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_filter->folder_path_pattern != NULL )
+	{
+		memory_free(
+		 export_filter->folder_path_pattern );
+
+		export_filter->folder_path_pattern        = NULL;
+		export_filter->folder_path_pattern_length = 0;
+	}
+	folder_path_pattern_length = libcstring_system_string_length(
+	                              folder_path_pattern );
+
+	/* Ignore a trailing path separator
+	 */
+	if( ( folder_path_pattern_length > 0 )
+	 && ( folder_path_pattern[ folder_path_pattern_length - 1 ] == (libcstring_system_character_t) LIBCPATH_SEPARATOR ) )
+	{
+		folder_path_pattern_length--;
+	}
+	export_filter->folder_path_pattern = libcstring_system_string_allocate(
+	                                      folder_path_pattern_length + 1 );
+
+	if( export_filter->folder_path_pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create folder path pattern.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcstring_system_string_copy(
+	     export_filter->folder_path_pattern,
+	     folder_path_pattern,
+	     folder_path_pattern_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy folder path pattern.",
+		 function );
+
+		memory_free(
+		 export_filter->folder_path_pattern );
+
+		export_filter->folder_path_pattern = NULL;
+
+		return( -1 );
+	}
+	export_filter->folder_path_pattern[ folder_path_pattern_length ] = 0;
+
+	export_filter->folder_path_pattern_length = folder_path_pattern_length;
+
+	return( 1 );
+}
+
+/* Copies a date and time string to a FILETIME
+ * The string is in the form: YYYY-MM-DD, YYYY-MM-DD HH:MM or YYYY-MM-DD HH:MM:SS
+ * where the date and time can also be separated by a 'T', the time is in UTC
+ * Returns 1 if successful, 0 if the string is not supported or -1 on error
+ */
+int export_filter_copy_time_from_string(
+     const libcstring_system_character_t *string,
+     uint64_t *filetime,
+     uint8_t *has_time_of_day,
+     libcerror_error_t **error )
+{
+	uint32_t values[ 6 ]              = { 0, 0, 0, 0, 0, 0 };
+	uint8_t days_per_month[ 12 ]      = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+	static char *function             = "export_filter_copy_time_from_string";
+	size_t number_of_digits           = 0;
+	size_t string_index               = 0;
+	size_t string_length              = 0;
+	uint64_t number_of_days           = 0;
+	uint32_t year                     = 0;
+	uint32_t year_of_era              = 0;
+	uint32_t day_of_year              = 0;
+	int value_index                   = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filetime.",
+		 function );
+
+		return( -1 );
+	}
+	if( has_time_of_day == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid has time of day.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = libcstring_system_string_length(
+	                 string );
+
+	/* The values are: year, month, day of month, hours, minutes and seconds
+	 * and are separated by respectively: '-', '-', ' ' or 'T', ':' and ':'
+	 */
+	for( string_index = 0;
+	     string_index <= string_length;
+	     string_index++ )
+	{
+		if( ( string_index < string_length )
+		 && ( string[ string_index ] >= (libcstring_system_character_t) '0' )
+		 && ( string[ string_index ] <= (libcstring_system_character_t) '9' ) )
+		{
+			if( number_of_digits >= 4 )
+			{
+				return( 0 );
+			}
+			values[ value_index ] *= 10;
+			values[ value_index ] += (uint32_t) ( string[ string_index ] - (libcstring_system_character_t) '0' );
+
+			number_of_digits++;
+
+			continue;
+		}
+		if( ( value_index == 0 )
+		 && ( number_of_digits != 4 ) )
+		{
+			return( 0 );
+		}
+		else if( ( value_index > 0 )
+		      && ( number_of_digits != 2 ) )
+		{
+			return( 0 );
+		}
+		value_index++;
+
+		if( string_index == string_length )
+		{
+			break;
+		}
+		if( value_index >= 6 )
+		{
+			return( 0 );
+		}
+		if( ( value_index == 1 )
+		 || ( value_index == 2 ) )
+		{
+			if( string[ string_index ] != (libcstring_system_character_t) '-' )
+			{
+				return( 0 );
+			}
+		}
+		else if( value_index == 3 )
+		{
+			if( ( string[ string_index ] != (libcstring_system_character_t) ' ' )
+			 && ( string[ string_index ] != (libcstring_system_character_t) 'T' ) )
+			{
+				return( 0 );
+			}
+		}
+		else if( string[ string_index ] != (libcstring_system_character_t) ':' )
+		{
+			return( 0 );
+		}
+		number_of_digits = 0;
+	}
+	/* A date without a time of day or a date with hours and minutes
+	 */
+	if( ( value_index != 3 )
+	 && ( value_index != 5 )
+	 && ( value_index != 6 ) )
+	{
+		return( 0 );
+	}
+	year = values[ 0 ];
+
+	if( ( year % 4 == 0 )
+	 && ( ( year % 100 != 0 )
+	  || ( year % 400 == 0 ) ) )
+	{
+		days_per_month[ 1 ] = 29;
+	}
+	/* FILETIME starts at January 1, 1601
+	 */
+	if( ( year < 1601 )
+	 || ( values[ 1 ] < 1 )
+	 || ( values[ 1 ] > 12 )
+	 || ( values[ 2 ] < 1 )
+	 || ( values[ 2 ] > days_per_month[ values[ 1 ] - 1 ] )
+	 || ( values[ 3 ] > 23 )
+	 || ( values[ 4 ] > 59 )
+	 || ( values[ 5 ] > 59 ) )
+	{
+		return( 0 );
+	}
+	/* Determine the number of days since January 1, 1601
+	 * using a calendar that starts in March so that the leap day is the last day of the year
+	 */
+	if( values[ 1 ] <= 2 )
+	{
+		year -= 1;
+	}
+	year -= 1600;
+
+	year_of_era = year % 400;
+
+	if( values[ 1 ] > 2 )
+	{
+		day_of_year = ( ( 153 * ( values[ 1 ] - 3 ) ) + 2 ) / 5;
+	}
+	else
+	{
+		day_of_year = ( ( 153 * ( values[ 1 ] + 9 ) ) + 2 ) / 5;
+	}
+	day_of_year += values[ 2 ] - 1;
+
+	number_of_days  = (uint64_t) ( year / 400 ) * 146097;
+	number_of_days += ( year_of_era * 365 ) + ( year_of_era / 4 ) - ( year_of_era / 100 ) + day_of_year;
+
+	/* March 1, 1600 is 306 days before January 1, 1601
+	 */
+	number_of_days -= 306;
+
+	*filetime  = number_of_days * EXPORT_FILTER_FILETIME_DAY;
+	*filetime += (uint64_t) ( ( values[ 3 ] * 3600 ) + ( values[ 4 ] * 60 ) + values[ 5 ] ) * 10000000UL;
+
+	*has_time_of_day = (uint8_t) ( value_index > 3 );
+
+	return( 1 );
+}
+
+/* Sets the start time from a date and time string
+ * Returns 1 if successful, 0 if the string is not supported or -1 on error
+ */
+int export_filter_set_start_time(
+     export_filter_t *export_filter,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function   = "export_filter_set_start_time";
+	uint64_t filetime       = 0;
+	uint8_t has_time_of_day = 0;
+	int result              = 0;
+
+	if( export_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export filter.",
+		 function );
+
+		return( -1 );
+	}
+	result = export_filter_copy_time_from_string(
+	          string,
+	          &filetime,
+	          &has_time_of_day,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to copy start time from string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		export_filter->start_time = filetime;
+	}
+	return( result );
+}
+
+/* Sets the end time from a date and time string
+ * A date without a time of day includes the whole day
+ * Returns 1 if successful, 0 if the string is not supported or -1 on error
+ */
+int export_filter_set_end_time(
+     export_filter_t *export_filter,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function   = "export_filter_set_end_time";
+	uint64_t filetime       = 0;
+	uint8_t has_time_of_day = 0;
+	int result              = 0;
+
+	if( export_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export filter.",
+		 function );
+
+		return( -1 );
+	}
+	result = export_filter_copy_time_from_string(
+	          string,
+	          &filetime,
+	          &has_time_of_day,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to copy end time from string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( has_time_of_day == 0 )
+		{
+			filetime += EXPORT_FILTER_FILETIME_DAY;
+		}
+		export_filter->end_time = filetime;
+	}
+	return( result );
+}
+
+/* Sets the item types from a comma separated list of item type names
+ * Returns 1 if successful, 0 if the string contains an unsupported name or -1 on error
+ */
+int export_filter_set_item_types(
+     export_filter_t *export_filter,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error )
+{
+	const export_filter_item_type_name_t *item_type_name = NULL;
+	static char *function                                = "export_filter_set_item_types";
+	size_t name_length                                   = 0;
+	size_t name_start_index                              = 0;
+	size_t string_index                                  = 0;
+	size_t string_length                                 = 0;
+	uint32_t item_types                                  = 0;
+
+	if( export_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = libcstring_system_string_length(
+	                 string );
+
+	for( string_index = 0;
+	     string_index <= string_length;
+	     string_index++ )
+	{
+		if( ( string_index < string_length )
+		 && ( string[ string_index ] != (libcstring_system_character_t) ',' ) )
+		{
+			continue;
+		}
+		name_length = string_index - name_start_index;
+
+		for( item_type_name = export_filter_item_type_names;
+		     item_type_name->name != NULL;
+		     item_type_name++ )
+		{
+			if( ( item_type_name->name_length == name_length )
+			 && ( libcstring_system_string_compare(
+			       &( string[ name_start_index ] ),
+			       item_type_name->name,
+			       name_length ) == 0 ) )
+			{
+				break;
+			}
+		}
+		if( item_type_name->name == NULL )
+		{
+			return( 0 );
+		}
+		item_types |= (uint32_t) 1 << item_type_name->item_type;
+
+		name_start_index = string_index + 1;
+	}
+	export_filter->item_types = item_types;
+
+	return( 1 );
+}
+
+/* Matches a string against a pattern
+ * where '*' matches any sequence of characters and '?' any single character
+ * Letters are matched case insensitive for the US-ASCII range
+ * Returns 1 if the string matches the pattern or 0 if not
+ */
+int export_filter_match_pattern(
+     const libcstring_system_character_t *pattern,
+     size_t pattern_length,
+     const libcstring_system_character_t *string,
+     size_t string_length )
+{
+	libcstring_system_character_t pattern_character = 0;
+	libcstring_system_character_t string_character  = 0;
+	size_t backtrack_pattern_index                  = 0;
+	size_t backtrack_string_index                   = 0;
+	size_t pattern_index                            = 0;
+	size_t string_index                             = 0;
+	uint8_t has_backtrack                           = 0;
+
+	if( ( pattern == NULL )
+	 || ( string == NULL ) )
+	{
+		return( 0 );
+	}
+	/* On a mismatch the last '*' is made to match one more character
+	 */
+	while( string_index < string_length )
+	{
+		if( pattern_index < pattern_length )
+		{
+			pattern_character = pattern[ pattern_index ];
+
+			if( pattern_character == (libcstring_system_character_t) '*' )
+			{
+				pattern_index++;
+
+				backtrack_pattern_index = pattern_index;
+				backtrack_string_index  = string_index;
+				has_backtrack           = 1;
+
+				continue;
+			}
+			string_character = string[ string_index ];
+
+			if( ( pattern_character >= (libcstring_system_character_t) 'A' )
+			 && ( pattern_character <= (libcstring_system_character_t) 'Z' ) )
+			{
+				pattern_character += (libcstring_system_character_t) ( 'a' - 'A' );
+			}
+			if( ( string_character >= (libcstring_system_character_t) 'A' )
+			 && ( string_character <= (libcstring_system_character_t) 'Z' ) )
+			{
+				string_character += (libcstring_system_character_t) ( 'a' - 'A' );
+			}
+			if( ( pattern_character == (libcstring_system_character_t) '?' )
+			 || ( pattern_character == string_character ) )
+			{
+				pattern_index++;
+				string_index++;
+
+				continue;
+			}
+		}
+		if( has_backtrack == 0 )
+		{
+			return( 0 );
+		}
+		backtrack_string_index++;
+
+		pattern_index = backtrack_pattern_index;
+		string_index  = backtrack_string_index;
+	}
+	while( ( pattern_index < pattern_length )
+	    && ( pattern[ pattern_index ] == (libcstring_system_character_t) '*' ) )
+	{
+		pattern_index++;
+	}
+	if( pattern_index != pattern_length )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines if a folder path matches the folder path pattern
+ * Returns 1 if the folder path matches or no pattern is set or 0 if not
+ */
+int export_filter_match_folder_path(
+     export_filter_t *export_filter,
+     const libcstring_system_character_t *folder_path,
+     size_t folder_path_length )
+{
+	if( export_filter == NULL )
+	{
+		return( 1 );
+	}
+	if( export_filter->folder_path_pattern == NULL )
+	{
+		return( 1 );
+	}
+	return( export_filter_match_pattern(
+	         export_filter->folder_path_pattern,
+	         export_filter->folder_path_pattern_length,
+	         folder_path,
+	         folder_path_length ) );
+}
+
+/* Retrieves the time of a sub message used by the time range filter
+ * This is the delivery time or, if not available, the client submit time
+ * The folder contents table is used before the sub message itself is read
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int export_filter_get_sub_message_time(
+     libpff_item_t *folder,
+     int sub_message_index,
+     libpff_item_t *sub_message,
+     uint64_t *filetime,
+     libcerror_error_t **error )
+{
+	static char *function = "export_filter_get_sub_message_time";
+	int result            = 0;
+
+	result = libpff_folder_get_sub_message_entry_value_filetime(
+	          folder,
+	          sub_message_index,
+	          LIBPFF_ENTRY_TYPE_MESSAGE_DELIVERY_TIME,
+	          filetime,
+	          error );
+
+	if( result == 0 )
+	{
+		result = libpff_folder_get_sub_message_entry_value_filetime(
+		          folder,
+		          sub_message_index,
+		          LIBPFF_ENTRY_TYPE_MESSAGE_CLIENT_SUBMIT_TIME,
+		          filetime,
+		          error );
+	}
+	if( result == 0 )
+	{
+		result = libpff_message_get_delivery_time(
+		          sub_message,
+		          filetime,
+		          error );
+	}
+	if( result == 0 )
+	{
+		result = libpff_message_get_client_submit_time(
+		          sub_message,
+		          filetime,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub message: %d time.",
+		 function,
+		 sub_message_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Determines if a sub message has attachments
+ * The folder contents table is used before the sub message itself is read
+ * Returns 1 if successful or -1 on error
+ */
+int export_filter_get_sub_message_has_attachments(
+     libpff_item_t *folder,
+     int sub_message_index,
+     libpff_item_t *sub_message,
+     uint8_t *has_attachments,
+     libcerror_error_t **error )
+{
+	static char *function  = "export_filter_get_sub_message_has_attachments";
+	uint32_t message_flags = 0;
+	int result             = 0;
+
+	if( has_attachments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid has attachments.",
+		 function );
+
+		return( -1 );
+	}
+	*has_attachments = 0;
+
+	result = libpff_folder_get_sub_message_entry_value_boolean(
+	          folder,
+	          sub_message_index,
+	          LIBPFF_ENTRY_TYPE_MESSAGE_HAS_ATTACHMENTS,
+	          has_attachments,
+	          error );
+
+	if( result == 0 )
+	{
+		result = libpff_folder_get_sub_message_entry_value_32bit(
+		          folder,
+		          sub_message_index,
+		          LIBPFF_ENTRY_TYPE_MESSAGE_FLAGS,
+		          &message_flags,
+		          error );
+
+		if( result == 0 )
+		{
+			result = libpff_message_get_flags(
+			          sub_message,
+			          &message_flags,
+			          error );
+		}
+		if( result == 1 )
+		{
+			if( ( message_flags & LIBPFF_MESSAGE_FLAG_HAS_ATTACHMENTS ) != 0 )
+			{
+				*has_attachments = 1;
+			}
+		}
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if sub message: %d has attachments.",
+		 function,
+		 sub_message_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines if a sub message matches the export filter
+ * The criteria are checked using the folder contents table where possible
+ * so that the sub message itself is only read when the table does not contain the value
+ * Returns 1 if the sub message matches, 0 if not or -1 on error
+ */
+int export_filter_match_sub_message(
+     export_filter_t *export_filter,
+     libpff_item_t *folder,
+     int sub_message_index,
+     libpff_item_t *sub_message,
+     libcerror_error_t **error )
+{
+	static char *function    = "export_filter_match_sub_message";
+	uint64_t filetime        = 0;
+	uint8_t has_attachments  = 0;
+	uint8_t sub_message_type = 0;
+	int result               = 0;
+
+	if( export_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export filter.",
+		 function );
+
+		return( -1 );
+	}
+	/* The item type of the sub message is determined from the folder contents table
+	 * when the sub message is retrieved
+	 */
+	if( export_filter->item_types != 0 )
+	{
+		if( libpff_item_get_type(
+		     sub_message,
+		     &sub_message_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub message: %d type.",
+			 function,
+			 sub_message_index );
+
+			return( -1 );
+		}
+		if( ( sub_message_type >= 32 )
+		 || ( ( export_filter->item_types & ( (uint32_t) 1 << sub_message_type ) ) == 0 ) )
+		{
+			return( 0 );
+		}
+	}
+	if( ( export_filter->start_time != 0 )
+	 || ( export_filter->end_time != 0 ) )
+	{
+		result = export_filter_get_sub_message_time(
+		          folder,
+		          sub_message_index,
+		          sub_message,
+		          &filetime,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub message: %d time.",
+			 function,
+			 sub_message_index );
+
+			return( -1 );
+		}
+		/* A sub message without a time does not match a time range
+		 */
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( ( export_filter->start_time != 0 )
+		 && ( filetime < export_filter->start_time ) )
+		{
+			return( 0 );
+		}
+		if( ( export_filter->end_time != 0 )
+		 && ( filetime >= export_filter->end_time ) )
+		{
+			return( 0 );
+		}
+	}
+	if( export_filter->has_attachments != 0 )
+	{
+		if( export_filter_get_sub_message_has_attachments(
+		     folder,
+		     sub_message_index,
+		     sub_message,
+		     &has_attachments,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if sub message: %d has attachments.",
+			 function,
+			 sub_message_index );
+
+			return( -1 );
+		}
+		if( has_attachments == 0 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,147 @@
+/* 
+ * Export filter functions
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXPORT_FILTER_H )
+#define _EXPORT_FILTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pfftools_libcerror.h"
+#include "pfftools_libcstring.h"
+#include "pfftools_libpff.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct export_filter export_filter_t;
+
+struct export_filter
+{
+	/* The folder path pattern
+	 * or NULL if the folder path is not filtered
+	 */
+	libcstring_system_character_t *folder_path_pattern;
+
+	/* The folder path pattern length
+	 */
+	size_t folder_path_pattern_length;
+
+	/* The start time, the first time included
+	 * Contains a FILETIME or 0 if not set
+	 */
+	uint64_t start_time;
+
+	/* The end time, the first time excluded
+	 * Contains a FILETIME or 0 if not set
+	 */
+	uint64_t end_time;
+
+	/* The item types, one bit per libpff item type
+	 * or 0 if the item type is not filtered
+	 */
+	uint32_t item_types;
+
+	/* Value to indicate only items with attachments are included
+	 */
+	uint8_t has_attachments;
+
+	/* The number of items that did not match the filter
+	 */
+	uint64_t number_of_filtered_items;
+};
+
+int export_filter_initialize(
+     export_filter_t **export_filter,
+     libcerror_error_t **error );
+
+int export_filter_free(
+     export_filter_t **export_filter,
+     libcerror_error_t **error );
+
+int export_filter_is_set(
+     export_filter_t *export_filter );
+
+int export_filter_set_folder_path_pattern(
+     export_filter_t *export_filter,
+     const libcstring_system_character_t *folder_path_pattern,
+     libcerror_error_t **error );
+
+int export_filter_copy_time_from_string(
+     const libcstring_system_character_t *string,
+     uint64_t *filetime,
+     uint8_t *has_time_of_day,
+     libcerror_error_t **error );
+
+int export_filter_set_start_time(
+     export_filter_t *export_filter,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error );
+
+int export_filter_set_end_time(
+     export_filter_t *export_filter,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error );
+
+int export_filter_set_item_types(
+     export_filter_t *export_filter,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error );
+
+int export_filter_match_pattern(
+     const libcstring_system_character_t *pattern,
+     size_t pattern_length,
+     const libcstring_system_character_t *string,
+     size_t string_length );
+
+int export_filter_match_folder_path(
+     export_filter_t *export_filter,
+     const libcstring_system_character_t *folder_path,
+     size_t folder_path_length );
+
+int export_filter_get_sub_message_time(
+     libpff_item_t *folder,
+     int sub_message_index,
+     libpff_item_t *sub_message,
+     uint64_t *filetime,
+     libcerror_error_t **error );
+
+int export_filter_get_sub_message_has_attachments(
+     libpff_item_t *folder,
+     int sub_message_index,
+     libpff_item_t *sub_message,
+     uint8_t *has_attachments,
+     libcerror_error_t **error );
+
+int export_filter_match_sub_message(
+     export_filter_t *export_filter,
+     libpff_item_t *folder,
+     int sub_message_index,
+     libpff_item_t *sub_message,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -25,6 +25,22 @@
 #include <memory.h>
 #include <types.h>
 
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_SYS_SENDFILE_H )
+#include <sys/sendfile.h>
+#endif
+
 /* Define HAVE_LOCAL_LIBFMAPI for local use of libfmapi
  */
 #if defined( HAVE_LOCAL_LIBFMAPI )
@@ -47,8 +63,13 @@
 #error Missing libfmapi.h
 #endif
 
+#include "archive_file.h"
+#include "attachment_store.h"
+#include "export_filter.h"
 #include "export_handle.h"
+#include "export_manifest.h"
 #include "item_file.h"
+#include "json_file.h"
 #include "pffinput.h"
 #include "pfftools_libcerror.h"
 #include "pfftools_libclocale.h"
@@ -61,8 +82,16 @@
 #include "pfftools_libfguid.h"
 #include "pfftools_libpff.h"
 
-#define EXPORT_HANDLE_BUFFER_SIZE	8192
-#define EXPORT_HANDLE_NOTIFY_STREAM	stdout
+/* Attachment data is read in large chunks so that entire data array
+ * segments are read directly into the buffer by libpff
+ */
+#define EXPORT_HANDLE_ATTACHMENT_DATA_BUFFER_SIZE	( 1024 * 1024 )
+#define EXPORT_HANDLE_NOTIFY_STREAM			stdout
+
+/* HTML and RTF message bodies are copied in bounded chunks
+ * so that large bodies are never held in memory as a whole
+ */
+#define EXPORT_HANDLE_MESSAGE_BODY_BUFFER_SIZE		( 64 * 1024 )
 
 /* Initializes the export handle
  * Returns 1 if successful or -1 on error
@@ -123,11 +152,26 @@ int export_handle_initialize(
 
 		goto on_error;
 	}
+	if( export_filter_initialize(
+	     &( ( *export_handle )->export_filter ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create export filter.",
+		 function );
+
+		goto on_error;
+	}
 	( *export_handle )->export_mode              = EXPORT_MODE_ITEMS;
 	( *export_handle )->preferred_export_format  = EXPORT_FORMAT_TEXT;
+	( *export_handle )->output_format            = EXPORT_OUTPUT_FORMAT_DIRECTORY;
 	( *export_handle )->ascii_codepage           = LIBPFF_CODEPAGE_WINDOWS_1252;
 	( *export_handle )->print_status_information = 1;
 	( *export_handle )->notify_stream            = EXPORT_HANDLE_NOTIFY_STREAM;
+	( *export_handle )->source_file_descriptor   = -1;
 
 	return( 1 );
 
@@ -150,6 +194,7 @@ int export_handle_free(
      libcerror_error_t **error )
 {
 	static char *function = "export_handle_free";
+	int result            = 1;
 
 	if( export_handle == NULL )
 	{
@@ -184,12 +229,96 @@ int export_handle_free(
 			memory_free(
 			 ( *export_handle )->recovered_export_path );
 		}
+		if( export_handle_close_source(
+		     *export_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close source.",
+			 function );
+
+			result = -1;
+		}
+		if( export_handle_close_archive(
+		     *export_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close archive.",
+			 function );
+
+			result = -1;
+		}
+		if( export_handle_close_json(
+		     *export_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close JSON file.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *export_handle )->attachment_store != NULL )
+		{
+			if( attachment_store_free(
+			     &( ( *export_handle )->attachment_store ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free attachment store.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *export_handle )->export_manifest != NULL )
+		{
+			if( export_manifest_free(
+			     &( ( *export_handle )->export_manifest ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free export manifest.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( export_filter_free(
+		     &( ( *export_handle )->export_filter ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free export filter.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *export_handle );
 
 		*export_handle = NULL;
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Signals the export handle to abort its current activity
@@ -411,6 +540,177 @@ int export_handle_set_ascii_codepage(
 	return( result );
 }
 
+/* Sets the output format
+ * Returns 1 if successful, 0 if unsupported values or -1 on error
+ */
+int export_handle_set_output_format(
+     export_handle_t *export_handle,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_output_format";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = libcstring_system_string_length(
+	                 string );
+
+	if( string_length == 3 )
+	{
+		if( libcstring_system_string_compare(
+		     string,
+		     _LIBCSTRING_SYSTEM_STRING( "tar" ),
+		     3 ) == 0 )
+		{
+			export_handle->output_format = EXPORT_OUTPUT_FORMAT_TAR;
+
+			result = 1;
+		}
+	}
+	else if( string_length == 9 )
+	{
+		if( libcstring_system_string_compare(
+		     string,
+		     _LIBCSTRING_SYSTEM_STRING( "directory" ),
+		     9 ) == 0 )
+		{
+			export_handle->output_format = EXPORT_OUTPUT_FORMAT_DIRECTORY;
+
+			result = 1;
+		}
+	}
+	return( result );
+}
+
+/* Sets the attachment deduplication mode
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_deduplication_mode(
+     export_handle_t *export_handle,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_deduplication_mode";
+	size_t string_length  = 0;
+	uint8_t use_sha256    = 0;
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = libcstring_system_string_length(
+	                 string );
+
+	if( string_length == 4 )
+	{
+		if( libcstring_system_string_compare(
+		     string,
+		     _LIBCSTRING_SYSTEM_STRING( "fast" ),
+		     4 ) == 0 )
+		{
+			result = 1;
+		}
+		else if( libcstring_system_string_compare(
+		          string,
+		          _LIBCSTRING_SYSTEM_STRING( "none" ),
+		          4 ) == 0 )
+		{
+			result = 1;
+		}
+	}
+	else if( string_length == 6 )
+	{
+		if( libcstring_system_string_compare(
+		     string,
+		     _LIBCSTRING_SYSTEM_STRING( "sha256" ),
+		     6 ) == 0 )
+		{
+			use_sha256 = 1;
+			result     = 1;
+		}
+	}
+	if( result != 1 )
+	{
+		return( result );
+	}
+	if( export_handle->attachment_store != NULL )
+	{
+		if( attachment_store_free(
+		     &( export_handle->attachment_store ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free attachment store.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( string[ 0 ] == (libcstring_system_character_t) 'n' )
+	{
+		return( 1 );
+	}
+	if( attachment_store_initialize(
+	     &( export_handle->attachment_store ),
+	     use_sha256,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create attachment store.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Sets the target path
  * Returns 1 if successful or -1 on error
  */
@@ -420,6 +720,7 @@ int export_handle_set_target_path(
      libcerror_error_t **error )
 {
 	static char *function                           = "export_handle_set_target_path";
+	size_t path_index                               = 0;
 	size_t target_path_length                       = 0;
 
 #if defined( WINAPI )
@@ -528,6 +829,22 @@ int export_handle_set_target_path(
 
 		export_handle->target_path_size = target_path_length + 1;
 	}
+	/* The names of archive file entries and the paths in JSON records
+	 * are relative to the directory that contains the target path
+	 */
+	export_handle->base_path_length = 0;
+
+	for( path_index = target_path_length;
+	     path_index > 0;
+	     path_index-- )
+	{
+		if( target_path[ path_index - 1 ] == (libcstring_system_character_t) LIBCPATH_SEPARATOR )
+		{
+			export_handle->base_path_length = path_index;
+
+			break;
+		}
+	}
 #if defined( WINAPI )
 	memory_free(
 	 full_target_path );
@@ -553,20 +870,17 @@ on_error:
 	return( -1 );
 }
 
-/* Sets an export path consisting of a base path and a suffix
- * Returns 1 if successful or -1 on error
+/* Opens the source file for copying attachment data extents
+ * The source is only opened if the platform supports copying extents,
+ * if it cannot be opened attachment data is read using libpff
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int export_handle_set_export_path(
+int export_handle_open_source(
      export_handle_t *export_handle,
-     const libcstring_system_character_t *base_path,
-     size_t base_path_length,
-     const libcstring_system_character_t *suffix,
-     size_t suffix_length,
-     libcstring_system_character_t **export_path,
-     size_t *export_path_size,
+     const libcstring_system_character_t *filename,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_set_export_path";
+	static char *function = "export_handle_open_source";
 
 	if( export_handle == NULL )
 	{
@@ -579,148 +893,240 @@ int export_handle_set_export_path(
 
 		return( -1 );
 	}
-	if( base_path == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid base path.",
-		 function );
-
-		return( -1 );
-	}
-	if( base_path_length > (size_t) SSIZE_MAX )
+	if( export_handle->source_file_descriptor != -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid base path length value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - source file descriptor value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( suffix == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid suffix.",
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( suffix_length > (size_t) SSIZE_MAX )
+#if defined( EXPORT_HANDLE_HAVE_COPY_EXTENTS )
+	export_handle->source_file_descriptor = open(
+	                                         filename,
+	                                         O_RDONLY );
+
+	if( export_handle->source_file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Closes the source file
+ * Returns the 0 if succesful or -1 on error
+ */
+int export_handle_close_source(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_close_source";
+
+	if( export_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid suffix length value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( export_path == NULL )
+#if defined( EXPORT_HANDLE_HAVE_COPY_EXTENTS )
+	if( export_handle->source_file_descriptor != -1 )
+	{
+		if( close(
+		     export_handle->source_file_descriptor ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 errno,
+			 "%s: unable to close source file descriptor.",
+			 function );
+
+			export_handle->source_file_descriptor = -1;
+
+			return( -1 );
+		}
+		export_handle->source_file_descriptor = -1;
+	}
+#endif
+	return( 0 );
+}
+
+/* Opens the archive file the export is written to
+ * The archive file is only opened if the output format is an archive format
+ * Returns 1 if successful, 0 if already exists or not an archive format or -1 on error
+ */
+int export_handle_open_archive(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	libcstring_system_character_t *archive_path = NULL;
+	static char *function                       = "export_handle_open_archive";
+	size_t archive_path_size                    = 0;
+	int result                                  = 0;
+
+	if( export_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export path.",
+		 "%s: invalid export handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( export_path_size == NULL )
+	if( export_handle->archive_file != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export path size.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - archive file value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( *export_path != NULL )
+	if( export_handle->target_path == NULL )
 	{
-		memory_free(
-		 *export_path );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing target path.",
+		 function );
 
-		*export_path      = NULL;
-		*export_path_size = 0;
+		return( -1 );
 	}
-	*export_path_size = base_path_length + suffix_length + 1;
-
-	*export_path = libcstring_system_string_allocate(
-	                *export_path_size );
-
-	if( *export_path == NULL )
+	if( export_handle->output_format != EXPORT_OUTPUT_FORMAT_TAR )
+	{
+		return( 0 );
+	}
+	if( export_handle_set_export_path(
+	     export_handle,
+	     export_handle->target_path,
+	     export_handle->target_path_size - 1,
+	     _LIBCSTRING_SYSTEM_STRING( ".tar" ),
+	     4,
+	     &archive_path,
+	     &archive_path_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create export path.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set archive path.",
 		 function );
 
 		goto on_error;
 	}
-	if( libcstring_system_string_copy(
-	     *export_path,
-	     base_path,
-	     base_path_length ) == NULL )
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_exists_wide(
+	          archive_path,
+	          error );
+#else
+	result = libcfile_file_exists(
+	          archive_path,
+	          error );
+#endif
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy base path to item export path.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if %" PRIs_LIBCSTRING_SYSTEM " exists.",
+		 function,
+		 archive_path );
 
 		goto on_error;
 	}
-	if( libcstring_system_string_copy(
-	     &( ( *export_path )[ base_path_length ] ),
-	     suffix,
-	     suffix_length ) == NULL )
+	else if( result == 1 )
+	{
+		memory_free(
+		 archive_path );
+
+		return( 0 );
+	}
+	if( archive_file_initialize(
+	     &( export_handle->archive_file ),
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy suffix to item export path.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create archive file.",
 		 function );
 
 		goto on_error;
 	}
-	( *export_path )[ *export_path_size - 1 ] = 0;
+	if( archive_file_open(
+	     export_handle->archive_file,
+	     archive_path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open archive file: %" PRIs_LIBCSTRING_SYSTEM ".",
+		 function,
+		 archive_path );
+
+		goto on_error;
+	}
+	memory_free(
+	 archive_path );
 
 	return( 1 );
 
 on_error:
-	if( *export_path != NULL )
+	if( export_handle->archive_file != NULL )
+	{
+		archive_file_free(
+		 &( export_handle->archive_file ),
+		 NULL );
+	}
+	if( archive_path != NULL )
 	{
 		memory_free(
-		 *export_path );
-
-		*export_path      = NULL;
-		*export_path_size = 0;
+		 archive_path );
 	}
 	return( -1 );
 }
 
-/* Creates the items export path
- * Returns 1 if successful, 0 if already exists or -1 on error
+/* Closes the archive file
+ * Returns the 0 if succesful or -1 on error
  */
-int export_handle_create_items_export_path(
+int export_handle_close_archive(
      export_handle_t *export_handle,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_create_items_export_path";
+	static char *function = "export_handle_close_archive";
 	int result            = 0;
 
 	if( export_handle == NULL )
@@ -734,68 +1140,52 @@ int export_handle_create_items_export_path(
 
 		return( -1 );
 	}
-	if( ( export_handle->export_mode == EXPORT_MODE_ALL )
-	 || ( export_handle->export_mode == EXPORT_MODE_DEBUG )
-	 || ( export_handle->export_mode == EXPORT_MODE_ITEMS )
-	 || ( export_handle->export_mode == EXPORT_MODE_ITEMS_NO_ATTACHMENTS ) )
+	if( export_handle->archive_file != NULL )
 	{
-		if( export_handle_set_export_path(
-		     export_handle,
-		     export_handle->target_path,
-		     export_handle->target_path_size - 1,
-		     _LIBCSTRING_SYSTEM_STRING( ".export" ),
-		     7,
-		     &( export_handle->items_export_path ),
-		     &( export_handle->items_export_path_size ),
-		     error ) != 1 )
+		if( archive_file_close(
+		     export_handle->archive_file,
+		     error ) != 0 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set items export path.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close archive file.",
 			 function );
 
-			return( -1 );
+			result = -1;
 		}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libcfile_file_exists_wide(
-			  export_handle->items_export_path,
-			  error );
-#else
-		result = libcfile_file_exists(
-			  export_handle->items_export_path,
-			  error );
-#endif
-		if( result == -1 )
+		if( archive_file_free(
+		     &( export_handle->archive_file ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_GENERIC,
-			 "%s: unable to determine if %" PRIs_LIBCSTRING_SYSTEM " exists.",
-			 function,
-			 export_handle->items_export_path );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free archive file.",
+			 function );
 
-			return( -1 );
-		}
-		else if( result == 1 )
-		{
-			return( 0 );
+			result = -1;
 		}
 	}
-	return( 1 );
+	return( result );
 }
 
-/* Creates the orphans export path
- * Returns 1 if successful, 0 if already exists or -1 on error
+/* Opens the JSON file the export is written to
+ * The JSON file is only opened if the preferred export format is JSON Lines
+ * Returns 1 if successful, 0 if already exists or not JSON Lines or -1 on error
  */
-int export_handle_create_orphans_export_path(
+int export_handle_open_json(
      export_handle_t *export_handle,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_create_orphans_export_path";
-	int result            = 0;
+	libcstring_system_character_t *blob_path = NULL;
+	libcstring_system_character_t *json_path = NULL;
+	static char *function                    = "export_handle_open_json";
+	size_t blob_path_size                    = 0;
+	size_t json_path_size                    = 0;
+	int result                               = 0;
 
 	if( export_handle == NULL )
 	{
@@ -808,267 +1198,77 @@ int export_handle_create_orphans_export_path(
 
 		return( -1 );
 	}
-	if( ( export_handle->export_mode == EXPORT_MODE_ALL )
-	 || ( export_handle->export_mode == EXPORT_MODE_RECOVERED ) )
+	if( export_handle->json_file != NULL )
 	{
-		if( export_handle_set_export_path(
-		     export_handle,
-		     export_handle->target_path,
-		     export_handle->target_path_size - 1,
-		     _LIBCSTRING_SYSTEM_STRING( ".orphans" ),
-		     8,
-		     &( export_handle->orphans_export_path ),
-		     &( export_handle->orphans_export_path_size ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set orphans export path.",
-			 function );
-
-			return( -1 );
-		}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libcfile_file_exists_wide(
-			  export_handle->orphans_export_path,
-			  error );
-#else
-		result = libcfile_file_exists(
-			  export_handle->orphans_export_path,
-			  error );
-#endif
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_GENERIC,
-			 "%s: unable to determine if %" PRIs_LIBCSTRING_SYSTEM " exists.",
-			 function,
-			 export_handle->orphans_export_path );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - JSON file value already set.",
+		 function );
 
-			return( -1 );
-		}
-		else if( result == 1 )
-		{
-			return( 0 );
-		}
+		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Creates the recovered export path
- * Returns 1 if successful, 0 if already exists or -1 on error
- */
-int export_handle_create_recovered_export_path(
-     export_handle_t *export_handle,
-     libcerror_error_t **error )
-{
-	static char *function = "export_handle_create_recovered_export_path";
-	int result            = 0;
-
-	if( export_handle == NULL )
+	if( export_handle->target_path == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing target path.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( export_handle->export_mode == EXPORT_MODE_ALL )
-	 || ( export_handle->export_mode == EXPORT_MODE_RECOVERED ) )
+	if( export_handle->preferred_export_format != EXPORT_FORMAT_JSONL )
 	{
-		if( export_handle_set_export_path(
-		     export_handle,
-		     export_handle->target_path,
-		     export_handle->target_path_size - 1,
-		     _LIBCSTRING_SYSTEM_STRING( ".recovered" ),
-		     10,
-		     &( export_handle->recovered_export_path ),
-		     &( export_handle->recovered_export_path_size ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set recovered export path.",
-			 function );
-
-			return( -1 );
-		}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libcfile_file_exists_wide(
-			  export_handle->recovered_export_path,
-			  error );
-#else
-		result = libcfile_file_exists(
-			  export_handle->recovered_export_path,
-			  error );
-#endif
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_GENERIC,
-			 "%s: unable to determine if %" PRIs_LIBCSTRING_SYSTEM " exists.",
-			 function,
-			 export_handle->recovered_export_path );
-
-			return( -1 );
-		}
-		else if( result == 1 )
-		{
-			return( 0 );
-		}
-	}
-	return( 1 );
-}
-
-/* Creates the default item directory path
- * Returns 1 if successful or -1 on error
- */
-int export_handle_create_default_item_directory(
-     export_handle_t *export_handle,
-     int item_index,
-     const libcstring_system_character_t *item_prefix,
-     size_t item_prefix_length,
-     const libcstring_system_character_t *export_path,
-     size_t export_path_length,
-     libcstring_system_character_t **item_directory_path,
-     size_t *item_directory_path_size,
-     log_handle_t *log_handle,
-     libcerror_error_t **error )
-{
-	libcstring_system_character_t item_directory_name[ 64 ];
-
-	static char *function             = "export_handle_create_default_item_directory";
-	size_t item_directory_name_length = 0;
-	int print_count                   = 0;
-	int result                        = 0;
-
-	if( export_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export handle.",
-		 function );
-
-		return( -1 );
-	}
-	if( item_index < 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
-		 "%s: invalid item index value less than zero.",
-		 function );
-
-		return( -1 );
-	}
-	if( item_prefix == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid item prefix.",
-		 function );
-
-		return( -1 );
-	}
-	if( item_prefix_length > (size_t) 63 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid item prefix length value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( item_directory_path == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid item directory path.",
-		 function );
-
-		return( -1 );
+		return( 0 );
 	}
-	/* Create the item directory
-	 */
-	print_count = libcstring_system_string_sprintf(
-	               item_directory_name,
-	               64,
-	               _LIBCSTRING_SYSTEM_STRING( "%s%05d" ),
-	               item_prefix,
-	               item_index + 1 );
-
-	if( ( print_count < 0 )
-	 || ( (size_t) print_count > ( item_prefix_length + 5 ) ) )
+	if( export_handle_set_export_path(
+	     export_handle,
+	     export_handle->target_path,
+	     export_handle->target_path_size - 1,
+	     _LIBCSTRING_SYSTEM_STRING( ".jsonl" ),
+	     6,
+	     &json_path,
+	     &json_path_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set item directory name.",
+		 "%s: unable to set JSON path.",
 		 function );
 
 		goto on_error;
 	}
-	item_directory_name[ item_prefix_length + 5 ] = 0;
-	item_directory_name_length                    = item_prefix_length + 5;
-
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcpath_path_join_wide(
-	          item_directory_path,
-	          item_directory_path_size,
-	          export_path,
-	          export_path_length,
-	          item_directory_name,
-	          item_directory_name_length,
-	          error );
-#else
-	result = libcpath_path_join(
-	          item_directory_path,
-	          item_directory_path_size,
-	          export_path,
-	          export_path_length,
-	          item_directory_name,
-	          item_directory_name_length,
-	          error );
-#endif
-	if( result != 1 )
+	if( export_handle_set_export_path(
+	     export_handle,
+	     export_handle->target_path,
+	     export_handle->target_path_size - 1,
+	     _LIBCSTRING_SYSTEM_STRING( ".blob" ),
+	     5,
+	     &blob_path,
+	     &blob_path_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable create item directory path.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set blob path.",
 		 function );
 
 		goto on_error;
 	}
 #if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
 	result = libcfile_file_exists_wide(
-	          *item_directory_path,
+	          json_path,
 	          error );
 #else
 	result = libcfile_file_exists(
-	          *item_directory_path,
+	          json_path,
 	          error );
 #endif
 	if( result == -1 )
@@ -1079,77 +1279,108 @@ int export_handle_create_default_item_directory(
 		 LIBCERROR_IO_ERROR_GENERIC,
 		 "%s: unable to determine if %" PRIs_LIBCSTRING_SYSTEM " exists.",
 		 function,
-		 *item_directory_path );
+		 json_path );
 
 		goto on_error;
 	}
-	else if( result != 0 )
+	else if( result == 0 )
+	{
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcfile_file_exists_wide(
+		          blob_path,
+		          error );
+#else
+		result = libcfile_file_exists(
+		          blob_path,
+		          error );
+#endif
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to determine if %" PRIs_LIBCSTRING_SYSTEM " exists.",
+			 function,
+			 blob_path );
+
+			goto on_error;
+		}
+	}
+	if( result == 1 )
+	{
+		memory_free(
+		 blob_path );
+		memory_free(
+		 json_path );
+
+		return( 0 );
+	}
+	if( json_file_initialize(
+	     &( export_handle->json_file ),
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_GENERIC,
-		 "%s: %" PRIs_LIBCSTRING_SYSTEM " already exists.",
-		 function,
-		 *item_directory_path );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create JSON file.",
+		 function );
 
 		goto on_error;
 	}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libcpath_path_make_directory_wide(
-	     *item_directory_path,
+	if( json_file_open(
+	     export_handle->json_file,
+	     json_path,
+	     blob_path,
 	     error ) != 1 )
-#else
-	if( libcpath_path_make_directory(
-	     *item_directory_path,
-	     error ) != 1 )
-#endif
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to make directory: %" PRIs_LIBCSTRING_SYSTEM ".",
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open JSON file: %" PRIs_LIBCSTRING_SYSTEM ".",
 		 function,
-		 *item_directory_path );
+		 json_path );
 
 		goto on_error;
 	}
-	log_handle_printf(
-	 log_handle,
-	 "Created directory: %" PRIs_LIBCSTRING_SYSTEM ".\n",
-	 *item_directory_path );
+	memory_free(
+	 blob_path );
+	memory_free(
+	 json_path );
 
 	return( 1 );
 
 on_error:
-	if( *item_directory_path != NULL )
+	if( export_handle->json_file != NULL )
+	{
+		json_file_free(
+		 &( export_handle->json_file ),
+		 NULL );
+	}
+	if( blob_path != NULL )
 	{
 		memory_free(
-		 *item_directory_path );
-
-		*item_directory_path      = NULL;
-		*item_directory_path_size = 0;
+		 blob_path );
+	}
+	if( json_path != NULL )
+	{
+		memory_free(
+		 json_path );
 	}
 	return( -1 );
 }
 
-/* Creates an item file
- * Returns 1 if successful, 0 if the file already exists or -1 on error
+/* Closes the JSON file
+ * Returns the 0 if succesful or -1 on error
  */
-int export_handle_create_item_file(
+int export_handle_close_json(
      export_handle_t *export_handle,
-     const libcstring_system_character_t *path,
-     size_t path_length,
-     const libcstring_system_character_t *filename,
-     size_t filename_length,
-     item_file_t **item_file,
      libcerror_error_t **error )
 {
-	libcstring_system_character_t *item_file_path = NULL;
-	static char *function                         = "export_handle_create_item_file";
-	size_t item_file_path_size                    = 0;
-	int result                                    = 0;
+	static char *function = "export_handle_close_json";
+	int result            = 0;
 
 	if( export_handle == NULL )
 	{
@@ -1162,146 +1393,125 @@ int export_handle_create_item_file(
 
 		return( -1 );
 	}
-	if( item_file == NULL )
+	if( export_handle->json_file != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid item file.",
-		 function );
+		if( json_file_close(
+		     export_handle->json_file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close JSON file.",
+			 function );
 
-		return( -1 );
-	}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcpath_path_join_wide(
-	          &item_file_path,
-	          &item_file_path_size,
-	          path,
-	          path_length,
-	          filename,
-	          filename_length,
-	          error );
-#else
-	result = libcpath_path_join(
-	          &item_file_path,
-	          &item_file_path_size,
-	          path,
-	          path_length,
-	          filename,
-	          filename_length,
-	          error );
-#endif
-	if( result != 1 )
+			result = -1;
+		}
+		if( json_file_free(
+		     &( export_handle->json_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free JSON file.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Opens the manifest of an incremental export
+ * The manifest file of the previous export is read if it exists
+ * Returns 1 if successful, 0 if there is no previous export or -1 on error
+ */
+int export_handle_open_manifest(
+     export_handle_t *export_handle,
+     const libcstring_system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_open_manifest";
+	int result            = 0;
+
+	if( export_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create item file path.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcfile_file_exists_wide(
-	          item_file_path,
-	          error );
-#else
-	result = libcfile_file_exists(
-	          item_file_path,
-	          error );
-#endif
-	if( result == -1 )
+	if( export_handle->export_manifest != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_GENERIC,
-		 "%s: unable to determine if %" PRIs_LIBCSTRING_SYSTEM " exists.",
-		 function,
-		 item_file_path );
-
-		goto on_error;
-	}
-	else if( result != 0 )
-	{
-		memory_free(
-		 item_file_path );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - export manifest already set.",
+		 function );
 
-		return( 0 );
+		return( -1 );
 	}
-	if( item_file_initialize(
-	     item_file,
+	if( export_manifest_initialize(
+	     &( export_handle->export_manifest ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create item file.", 
+		 "%s: unable to create export manifest.",
 		 function );
 
 		goto on_error;
 	}
-	if( item_file_open(
-	     *item_file,
-	     item_file_path,
-	     error ) != 1 )
+	result = export_manifest_read(
+	          export_handle->export_manifest,
+	          filename,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open: %" PRIs_LIBCSTRING_SYSTEM ".",
-		 function,
-		 item_file_path );
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read export manifest.",
+		 function );
 
 		goto on_error;
 	}
-	memory_free(
-	 item_file_path );
-
-	item_file_path = NULL;
-
-	return( 1 );
+	return( result );
 
 on_error:
-	if( *item_file != NULL )
+	if( export_handle->export_manifest != NULL )
 	{
-		item_file_free(
-		 item_file,
+		export_manifest_free(
+		 &( export_handle->export_manifest ),
 		 NULL );
 	}
-	if( item_file_path != NULL )
-	{
-		memory_free(
-		 item_file_path );
-	}
 	return( -1 );
 }
 
-/* Exports the item
- * Returns 1 if successful or -1 on error
+/* Closes the manifest of an incremental export
+ * The manifest file is only written after a completed export
+ * so that an interrupted export does not lose the previous manifest
+ * Returns the 0 if succesful or -1 on error
  */
-int export_handle_export_item(
+int export_handle_close_manifest(
      export_handle_t *export_handle,
-     libpff_item_t *item,
-     int item_index,
-     int number_of_items,
-     const libcstring_system_character_t *export_path,
-     size_t export_path_length,
-     log_handle_t *log_handle,
+     const libcstring_system_character_t *filename,
      libcerror_error_t **error )
 {
-	libcstring_system_character_t *entry_value_string = NULL;
-	libcstring_system_character_t *item_path          = NULL;
-	char *item_type_string                            = NULL;
-	static char *function                             = "export_handle_export_item";
-	size_t entry_value_string_size                    = 0;
-	size_t item_path_size                             = 0;
-	uint8_t item_type                                 = 0;
-	int result                                        = 0;
+	static char *function = "export_handle_close_manifest";
+	int result            = 0;
 
 	if( export_handle == NULL )
 	{
@@ -1314,501 +1524,272 @@ int export_handle_export_item(
 
 		return( -1 );
 	}
-	if( libpff_item_get_type(
-	     item,
-	     &item_type,
-	     error ) != 1 )
+	if( export_handle->export_manifest != NULL )
 	{
-		fprintf(
-		 export_handle->notify_stream,
-		 "Unable to retrieve type of item %d out of %d.\n",
-		 item_index + 1,
-		 number_of_items );
+		if( export_manifest_write(
+		     export_handle->export_manifest,
+		     filename,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write export manifest.",
+			 function );
+
+			result = -1;
+		}
+		if( export_manifest_free(
+		     &( export_handle->export_manifest ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free export manifest.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Sets an export path consisting of a base path and a suffix
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_export_path(
+     export_handle_t *export_handle,
+     const libcstring_system_character_t *base_path,
+     size_t base_path_length,
+     const libcstring_system_character_t *suffix,
+     size_t suffix_length,
+     libcstring_system_character_t **export_path,
+     size_t *export_path_size,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_export_path";
 
+	if( export_handle == NULL )
+	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve item type.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
 		 function );
 
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-			libcnotify_print_error_backtrace(
-			 *error );
-		}
-		libcerror_error_free(
-		 error );
+		return( -1 );
+	}
+	if( base_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base path.",
+		 function );
 
-		log_handle_printf(
-		 log_handle,
-		 "Unable to retrieve type of item %d out of %d.\n",
-		 item_index + 1,
-		 number_of_items );
+		return( -1 );
+	}
+	if( base_path_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid base path length value exceeds maximum.",
+		 function );
 
-		return( 1 );
+		return( -1 );
 	}
-	switch( item_type )
+	if( suffix == NULL )
 	{
-		case LIBPFF_ITEM_TYPE_ACTIVITY:
-			item_type_string = "activity";
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid suffix.",
+		 function );
 
-			if( export_handle->print_status_information != 0 )
-			{
-				fprintf(
-				 export_handle->notify_stream,
-				 "Exporting %s item %d out of %d.\n",
-				 item_type_string,
-				 item_index + 1,
-				 number_of_items );
-			}
-			result = export_handle_export_activity(
-			          export_handle,
-			          item,
-			          item_index,
-			          export_path,
-			          export_path_length,
-			          log_handle,
-			          error );
-			break;
+		return( -1 );
+	}
+	if( suffix_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid suffix length value exceeds maximum.",
+		 function );
 
-		case LIBPFF_ITEM_TYPE_APPOINTMENT:
-			item_type_string = "appointment";
+		return( -1 );
+	}
+	if( export_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export path.",
+		 function );
 
-			if( export_handle->print_status_information != 0 )
-			{
-				fprintf(
-				 export_handle->notify_stream,
-				 "Exporting %s item %d out of %d.\n",
-				 item_type_string,
-				 item_index + 1,
-				 number_of_items );
-			}
-			result = export_handle_export_appointment(
-			          export_handle,
-			          item,
-			          item_index,
-			          export_path,
-			          export_path_length,
-			          log_handle,
-			          error );
-			break;
-
-		case LIBPFF_ITEM_TYPE_CONTACT:
-			item_type_string = "contact";
-
-			if( export_handle->print_status_information != 0 )
-			{
-				fprintf(
-				 export_handle->notify_stream,
-				 "Exporting %s item %d out of %d.\n",
-				 item_type_string,
-				 item_index + 1,
-				 number_of_items );
-			}
-			result = export_handle_export_contact(
-			          export_handle,
-			          item,
-			          item_index,
-			          export_path,
-			          export_path_length,
-			          log_handle,
-			          error );
-			break;
+		return( -1 );
+	}
+	if( export_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export path size.",
+		 function );
 
-		case LIBPFF_ITEM_TYPE_DOCUMENT:
-			item_type_string = "document";
+		return( -1 );
+	}
+	if( *export_path != NULL )
+	{
+		memory_free(
+		 *export_path );
 
-			if( export_handle->print_status_information != 0 )
-			{
-				fprintf(
-				 export_handle->notify_stream,
-				 "Exporting %s item %d out of %d.\n",
-				 item_type_string,
-				 item_index + 1,
-				 number_of_items );
-			}
-			result = export_handle_export_document(
-			          export_handle,
-			          item,
-			          item_index,
-			          export_path,
-			          export_path_length,
-			          log_handle,
-			          error );
-			break;
+		*export_path      = NULL;
+		*export_path_size = 0;
+	}
+	*export_path_size = base_path_length + suffix_length + 1;
 
-		case LIBPFF_ITEM_TYPE_CONFLICT_MESSAGE:
-		case LIBPFF_ITEM_TYPE_EMAIL:
-		case LIBPFF_ITEM_TYPE_EMAIL_SMIME:
-			item_type_string = "email";
+	*export_path = libcstring_system_string_allocate(
+	                *export_path_size );
 
-			if( export_handle->print_status_information != 0 )
-			{
-				fprintf(
-				 export_handle->notify_stream,
-				 "Exporting %s item %d out of %d.\n",
-				 item_type_string,
-				 item_index + 1,
-				 number_of_items );
-			}
-			result = export_handle_export_email(
-			          export_handle,
-			          item,
-			          item_index,
-			          export_path,
-			          export_path_length,
-			          log_handle,
-			          error );
-			break;
+	if( *export_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export path.",
+		 function );
 
-		case LIBPFF_ITEM_TYPE_FOLDER:
-			item_type_string = "folder";
+		goto on_error;
+	}
+	if( libcstring_system_string_copy(
+	     *export_path,
+	     base_path,
+	     base_path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy base path to item export path.",
+		 function );
 
-			if( export_handle->print_status_information != 0 )
-			{
-				fprintf(
-				 export_handle->notify_stream,
-				 "Exporting %s item %d out of %d.\n",
-				 item_type_string,
-				 item_index + 1,
-				 number_of_items );
-			}
-			result = export_handle_export_folder(
-			          export_handle,
-			          item,
-			          item_index,
-			          export_path,
-			          export_path_length,
-			          log_handle,
-			          error );
-			break;
+		goto on_error;
+	}
+	if( libcstring_system_string_copy(
+	     &( ( *export_path )[ base_path_length ] ),
+	     suffix,
+	     suffix_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy suffix to item export path.",
+		 function );
 
-		case LIBPFF_ITEM_TYPE_MEETING:
-			item_type_string = "meeting";
+		goto on_error;
+	}
+	( *export_path )[ *export_path_size - 1 ] = 0;
 
-			if( export_handle->print_status_information != 0 )
-			{
-				fprintf(
-				 export_handle->notify_stream,
-				 "Exporting %s item %d out of %d.\n",
-				 item_type_string,
-				 item_index + 1,
-				 number_of_items );
-			}
-			result = export_handle_export_meeting(
-			          export_handle,
-			          item,
-			          item_index,
-			          export_path,
-			          export_path_length,
-			          log_handle,
-			          error );
-			break;
+	return( 1 );
 
-		case LIBPFF_ITEM_TYPE_NOTE:
-			item_type_string = "note";
+on_error:
+	if( *export_path != NULL )
+	{
+		memory_free(
+		 *export_path );
 
-			if( export_handle->print_status_information != 0 )
-			{
-				fprintf(
-				 export_handle->notify_stream,
-				 "Exporting %s item %d out of %d.\n",
-				 item_type_string,
-				 item_index + 1,
-				 number_of_items );
-			}
-			result = export_handle_export_note(
-			          export_handle,
-			          item,
-			          item_index,
-			          export_path,
-			          export_path_length,
-			          log_handle,
-			          error );
-			break;
+		*export_path      = NULL;
+		*export_path_size = 0;
+	}
+	return( -1 );
+}
 
-		case LIBPFF_ITEM_TYPE_RSS_FEED:
-			item_type_string = "RSS feed";
+/* Determines if a path exists
+ * If the export is written to an archive file the path is looked up in the archive file
+ * If the export is written as JSON records no paths are created
+ * Returns 1 if the path exists, 0 if not or -1 on error
+ */
+int export_handle_path_exists(
+     export_handle_t *export_handle,
+     const libcstring_system_character_t *path,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_path_exists";
+	int result            = 0;
 
-			if( export_handle->print_status_information != 0 )
-			{
-				fprintf(
-				 export_handle->notify_stream,
-				 "Exporting %s item %d out of %d.\n",
-				 item_type_string,
-				 item_index + 1,
-				 number_of_items );
-			}
-			result = export_handle_export_rss_feed(
-			          export_handle,
-			          item,
-			          item_index,
-			          export_path,
-			          export_path_length,
-			          log_handle,
-			          error );
-			break;
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
 
-		case LIBPFF_ITEM_TYPE_TASK:
-			item_type_string = "task";
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
 
-			if( export_handle->print_status_information != 0 )
-			{
-				fprintf(
-				 export_handle->notify_stream,
-				 "Exporting %s item %d out of %d.\n",
-				 item_type_string,
-				 item_index + 1,
-				 number_of_items );
-			}
-			result = export_handle_export_task(
-			          export_handle,
-			          item,
-			          item_index,
-			          export_path,
-			          export_path_length,
-			          log_handle,
-			          error );
-			break;
-
-		default:
-			result = 0;
-
-			break;
+		return( -1 );
 	}
-	if( result == -1 )
+	if( export_handle->json_file != NULL )
 	{
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: unable to export %s item: %d out of: %d.\n",
-			 function,
-			 item_type_string,
-			 item_index + 1,
-			 number_of_items );
-		}
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-			libcnotify_print_error_backtrace(
-			 *error );
-		}
-		libcerror_error_free(
-		 error );
-
-		log_handle_printf(
-		 log_handle,
-		 "Unable to export %s item: %d out of: %d.\n",
-		 item_type_string,
-		 item_index + 1,
-		 number_of_items );
+		result = 0;
 	}
-	else if( result == 0 )
+	else if( export_handle->archive_file != NULL )
+	{
+		result = archive_file_directory_exists(
+		          export_handle->archive_file,
+		          &( path[ export_handle->base_path_length ] ),
+		          error );
+	}
+	else
 	{
-		if( export_handle->export_mode == EXPORT_MODE_DEBUG )
-		{
-			if( export_handle_create_default_item_directory(
-			     export_handle,
-			     item_index,
-			     _LIBCSTRING_SYSTEM_STRING( "Item" ),
-			     4,
-			     export_path,
-			     export_path_length,
-			     &item_path,
-			     &item_path_size,
-			     log_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable create item directory.",
-				 function );
-
-				goto on_error;
-			}
-			if( export_handle_export_item_values(
-			     export_handle,
-			     item,
-			     _LIBCSTRING_SYSTEM_STRING( "ItemValues.txt" ),
-			     14,
-			     item_path,
-			     item_path_size - 1,
-			     log_handle,
-			     error ) != 1 )
-			{
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: unable to export values of item: %d out of: %d.\n",
-					 function,
-					 item_index + 1,
-					 number_of_items );
-				}
-				if( ( error != NULL )
-				 && ( *error != NULL ) )
-				{
-					libcnotify_print_error_backtrace(
-					 *error );
-				}
-				libcerror_error_free(
-				 error );
-
-				log_handle_printf(
-				 log_handle,
-				 "Unable to export values of item: %d out of: %d.\n",
-				 item_index + 1,
-				 number_of_items );
-			}
-			memory_free(
-			 item_path );
-		}
-		else
-		{
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libpff_message_get_utf16_class_size(
-			          item,
-			          &entry_value_string_size,
-			          error );
-#else
-			result = libpff_message_get_utf8_class_size(
-			          item,
-			          &entry_value_string_size,
-			          error );
-#endif
-			if( result != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve message class size.",
-				 function );
-
-				goto on_error;
-			}
-			if( ( entry_value_string_size == 0 )
-			 || ( entry_value_string_size > (size_t) SSIZE_MAX ) )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid entry value string size.",
-				 function );
-
-				goto on_error;
-			}
-			entry_value_string = libcstring_system_string_allocate(
-			                      entry_value_string_size );
-
-			if( entry_value_string == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create entry value string.",
-				 function );
-
-				goto on_error;
-			}
 #if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libpff_message_get_utf16_class(
-			          item,
-			          (uint16_t *) entry_value_string,
-			          entry_value_string_size,
-			          error );
+		result = libcfile_file_exists_wide(
+		          path,
+		          error );
 #else
-			result = libpff_message_get_utf8_class(
-			          item,
-			          (uint8_t *) entry_value_string,
-			          entry_value_string_size,
-			          error );
+		result = libcfile_file_exists(
+		          path,
+		          error );
 #endif
-			if( result != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve message class.",
-				 function );
-
-				goto on_error;
-			}
-			fprintf(
-			 export_handle->notify_stream,
-			 "Skipped item %d out of %d of type: %" PRIs_LIBCSTRING_SYSTEM ".\n",
-			 item_index + 1,
-			 number_of_items,
-			 entry_value_string );
-
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: skipped export of item: %d out of: %d of type: %" PRIs_LIBCSTRING_SYSTEM " (0x%02" PRIx8 ").\n",
-				 function,
-				 item_index + 1,
-				 number_of_items,
-				 entry_value_string,
-				 item_type );
-			}
-			log_handle_printf(
-			 log_handle,
-			 "Skipped export of item: %d out of: %d of type: %" PRIs_LIBCSTRING_SYSTEM " (0x%02" PRIx8 ").\n",
-			 item_index + 1,
-			 number_of_items,
-			 entry_value_string,
-			 item_type );
-
-			memory_free(
-			 entry_value_string );
-
-			entry_value_string = NULL;
-		}
-	}
-	return( 1 );
-
-on_error:
-	if( entry_value_string != NULL )
-	{
-		memory_free(
-		 entry_value_string );
 	}
-	return( -1 );
+	return( result );
 }
 
-/* Exports a specific item value to the item file
+/* Creates a directory
+ * If the export is written to an archive file a directory entry is added to the archive file
+ * If the export is written as JSON records the directory is only part of the item paths
  * Returns 1 if successful or -1 on error
  */
-int export_handle_export_item_value_to_item_file(
+int export_handle_make_directory(
      export_handle_t *export_handle,
-     libpff_item_t *item,
-     uint32_t set_index,
-     uint32_t entry_index,
-     item_file_t *item_file,
+     const libcstring_system_character_t *path,
      libcerror_error_t **error )
 {
-	libcstring_system_character_t *name_to_id_map_entry_string = NULL;
-	libpff_name_to_id_map_entry_t *name_to_id_map_entry        = NULL;
-	uint8_t *value_data                                        = NULL;
-	static char *function                                      = "export_handle_export_item_value_to_item_file";
-	size_t name_to_id_map_entry_string_size                    = 0;
-	size_t value_data_size                                     = 0;
-	uint32_t entry_type                                        = 0;
-	uint32_t matched_value_type                                = LIBPFF_VALUE_TYPE_UNSPECIFIED;
-	uint32_t name_to_id_map_entry_number                       = 0;
-	uint32_t value_type                                        = LIBPFF_VALUE_TYPE_UNSPECIFIED;
-	uint8_t name_to_id_map_entry_type                          = 0;
-	int result                                                 = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	libpff_multi_value_t *multi_value                          = NULL;
-#endif
+	static char *function = "export_handle_make_directory";
+	int result            = 0;
 
 	if( export_handle == NULL )
 	{
@@ -1821,598 +1802,521 @@ int export_handle_export_item_value_to_item_file(
 
 		return( -1 );
 	}
-	if( item_file_write_value_integer_32bit_as_decimal(
-	     item_file,
-	     _LIBCSTRING_SYSTEM_STRING( "Set:\t\t\t\t" ),
-	     set_index,
-	     error ) != 1 )
+	if( path == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write 32-bit integer value.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( item_file_write_value_integer_32bit_as_decimal(
-	     item_file,
-	     _LIBCSTRING_SYSTEM_STRING( "Entry:\t\t\t\t" ),
-	     entry_index,
-	     error ) != 1 )
+	if( export_handle->json_file != NULL )
+	{
+		result = 1;
+	}
+	else if( export_handle->archive_file != NULL )
+	{
+		result = archive_file_add_directory(
+		          export_handle->archive_file,
+		          &( path[ export_handle->base_path_length ] ),
+		          error );
+	}
+	else
+	{
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcpath_path_make_directory_wide(
+		          path,
+		          error );
+#else
+		result = libcpath_path_make_directory(
+		          path,
+		          error );
+#endif
+	}
+	return( result );
+}
+
+/* Creates the items export path
+ * Returns 1 if successful, 0 if already exists or -1 on error
+ */
+int export_handle_create_items_export_path(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_create_items_export_path";
+	int result            = 0;
+
+	if( export_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write 32-bit integer value.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libpff_item_get_entry_type(
-	     item,
-	     set_index,
-	     entry_index,
-	     &entry_type,
-	     &value_type,
-	     &name_to_id_map_entry,
-	     error ) != 1 )
+	if( ( export_handle->export_mode == EXPORT_MODE_ALL )
+	 || ( export_handle->export_mode == EXPORT_MODE_DEBUG )
+	 || ( export_handle->export_mode == EXPORT_MODE_ITEMS )
+	 || ( export_handle->export_mode == EXPORT_MODE_ITEMS_NO_ATTACHMENTS ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve entry type of set: %" PRIu32 " entry: %" PRIu32 ".",
-		 function,
-		 set_index,
-		 entry_index );
+		if( export_handle_set_export_path(
+		     export_handle,
+		     export_handle->target_path,
+		     export_handle->target_path_size - 1,
+		     _LIBCSTRING_SYSTEM_STRING( ".export" ),
+		     7,
+		     &( export_handle->items_export_path ),
+		     &( export_handle->items_export_path_size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set items export path.",
+			 function );
 
-		goto on_error;
+			return( -1 );
+		}
+		result = export_handle_path_exists(
+		          export_handle,
+		          export_handle->items_export_path,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to determine if %" PRIs_LIBCSTRING_SYSTEM " exists.",
+			 function,
+			 export_handle->items_export_path );
+
+			return( -1 );
+		}
+		else if( result == 1 )
+		{
+			return( 0 );
+		}
 	}
-	if( item_file_write_value_integer_32bit_as_hexadecimal(
-	     item_file,
-	     _LIBCSTRING_SYSTEM_STRING( "Entry type:\t\t\t" ),
-	     entry_type,
-	     error ) != 1 )
+	return( 1 );
+}
+
+/* Creates the orphans export path
+ * Returns 1 if successful, 0 if already exists or -1 on error
+ */
+int export_handle_create_orphans_export_path(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_create_orphans_export_path";
+	int result            = 0;
+
+	if( export_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write 32-bit integer value.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( item_file_write_value_integer_32bit_as_hexadecimal(
-	     item_file,
-	     _LIBCSTRING_SYSTEM_STRING( "Value type:\t\t\t" ),
-	     value_type,
-	     error ) != 1 )
+	if( ( export_handle->export_mode == EXPORT_MODE_ALL )
+	 || ( export_handle->export_mode == EXPORT_MODE_RECOVERED ) )
+	{
+		if( export_handle_set_export_path(
+		     export_handle,
+		     export_handle->target_path,
+		     export_handle->target_path_size - 1,
+		     _LIBCSTRING_SYSTEM_STRING( ".orphans" ),
+		     8,
+		     &( export_handle->orphans_export_path ),
+		     &( export_handle->orphans_export_path_size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set orphans export path.",
+			 function );
+
+			return( -1 );
+		}
+		result = export_handle_path_exists(
+		          export_handle,
+		          export_handle->orphans_export_path,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to determine if %" PRIs_LIBCSTRING_SYSTEM " exists.",
+			 function,
+			 export_handle->orphans_export_path );
+
+			return( -1 );
+		}
+		else if( result == 1 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Creates the recovered export path
+ * Returns 1 if successful, 0 if already exists or -1 on error
+ */
+int export_handle_create_recovered_export_path(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_create_recovered_export_path";
+	int result            = 0;
+
+	if( export_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write 32-bit integer value.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( name_to_id_map_entry != NULL )
+	if( ( export_handle->export_mode == EXPORT_MODE_ALL )
+	 || ( export_handle->export_mode == EXPORT_MODE_RECOVERED ) )
 	{
-		if( libpff_name_to_id_map_entry_get_type(
-		     name_to_id_map_entry,
-		     &name_to_id_map_entry_type,
+		if( export_handle_set_export_path(
+		     export_handle,
+		     export_handle->target_path,
+		     export_handle->target_path_size - 1,
+		     _LIBCSTRING_SYSTEM_STRING( ".recovered" ),
+		     10,
+		     &( export_handle->recovered_export_path ),
+		     &( export_handle->recovered_export_path_size ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve name to identifier map entry type of set: %" PRIu32 " entry: %" PRIu32 ".",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set recovered export path.",
+			 function );
+
+			return( -1 );
+		}
+		result = export_handle_path_exists(
+		          export_handle,
+		          export_handle->recovered_export_path,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to determine if %" PRIs_LIBCSTRING_SYSTEM " exists.",
 			 function,
-			 set_index,
-			 entry_index );
+			 export_handle->recovered_export_path );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( name_to_id_map_entry_type == LIBPFF_NAME_TO_ID_MAP_ENTRY_TYPE_NUMERIC )
+		else if( result == 1 )
 		{
-			if( libpff_name_to_id_map_entry_get_number(
-			     name_to_id_map_entry,
-			     &name_to_id_map_entry_number,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve name to identifier map entry number of set: %" PRIu32 " entry: %" PRIu32 ".",
-				 function,
-				 set_index,
-				 entry_index );
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
 
-				goto on_error;
-			}
-			if( item_file_write_value_integer_32bit_as_hexadecimal(
-			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( "Maps to entry type:\t\t" ),
-			     name_to_id_map_entry_number,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write 32-bit integer value.",
-				 function );
-
-				goto on_error;
-			}
-		}
-		else if( name_to_id_map_entry_type == LIBPFF_NAME_TO_ID_MAP_ENTRY_TYPE_STRING )
-		{
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libpff_name_to_id_map_entry_get_utf16_string_size(
-				  name_to_id_map_entry,
-				  &name_to_id_map_entry_string_size,
-				  error );
-#else
-			result = libpff_name_to_id_map_entry_get_utf8_string_size(
-				  name_to_id_map_entry,
-				  &name_to_id_map_entry_string_size,
-				  error );
-#endif
-			if( result != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve name to identifier map entry string size of set: %" PRIu32 " entry: %" PRIu32 ".",
-				 function,
-				 set_index,
-				 entry_index );
-
-				goto on_error;
-			}
-			name_to_id_map_entry_string = libcstring_system_string_allocate(
-			                               name_to_id_map_entry_string_size );
-
-			if( name_to_id_map_entry_string == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create name to identifier map entry string.",
-				 function );
-
-				goto on_error;
-			}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libpff_name_to_id_map_entry_get_utf16_string(
-				  name_to_id_map_entry,
-				  (uint16_t *) name_to_id_map_entry_string,
-				  name_to_id_map_entry_string_size,
-				  error );
-#else
-			result = libpff_name_to_id_map_entry_get_utf8_string(
-				  name_to_id_map_entry,
-				  (uint8_t *) name_to_id_map_entry_string,
-				  name_to_id_map_entry_string_size,
-				  error );
-#endif
-			if( result != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve name to identifier map entry string of set: %" PRIu32 " entry: %" PRIu32 ".",
-				 function,
-				 set_index,
-				 entry_index );
-
-				goto on_error;
-			}
-			if( item_file_write_value_string(
-			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( "Maps to entry:\t\t\t" ),
-			     name_to_id_map_entry_string,
-			     name_to_id_map_entry_string_size - 1,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write string.",
-				 function );
-
-				goto on_error;
-			}
-			memory_free(
-			 name_to_id_map_entry_string );
-
-			name_to_id_map_entry_string = NULL;
-		}
-	}
-	matched_value_type = LIBPFF_VALUE_TYPE_UNSPECIFIED;
+/* Retrieves the default item directory path
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_get_default_item_directory_path(
+     export_handle_t *export_handle,
+     int item_index,
+     const libcstring_system_character_t *item_prefix,
+     size_t item_prefix_length,
+     const libcstring_system_character_t *export_path,
+     size_t export_path_length,
+     libcstring_system_character_t **item_directory_path,
+     size_t *item_directory_path_size,
+     libcerror_error_t **error )
+{
+	libcstring_system_character_t item_directory_name[ 64 ];
 
-	result = libpff_item_get_entry_value(
-		  item,
-		  set_index,
-		  entry_type,
-		  &matched_value_type,
-		  &value_data,
-		  &value_data_size,
-		  LIBPFF_ENTRY_VALUE_FLAG_MATCH_ANY_VALUE_TYPE | LIBPFF_ENTRY_VALUE_FLAG_IGNORE_NAME_TO_ID_MAP,
-		  error );
+	static char *function             = "export_handle_get_default_item_directory_path";
+	size_t item_directory_name_length = 0;
+	int print_count                   = 0;
+	int result                        = 0;
 
-	if( result == -1 )
+	if( export_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve entry value of set: %" PRIu32 " entry: %" PRIu32 ".",
-		 function,
-		 set_index,
-		 entry_index );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( item_file_write_string(
-	     item_file,
-	     _LIBCSTRING_SYSTEM_STRING( "Matched value type:\t\t" ),
-	     21,
-	     error ) != 1 )
+	if( item_index < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write string.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid item index value less than zero.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( item_file_write_integer_32bit_as_hexadecimal(
-	     item_file,
-	     matched_value_type,
-	     error ) != 1 )
+	if( item_prefix == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write 32-bit integer.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item prefix.",
 		 function );
 
-		goto on_error;
-	}
-	if( value_type != matched_value_type )
-	{
-		if( item_file_write_string(
-		     item_file,
-		     _LIBCSTRING_SYSTEM_STRING( " (mismatch)" ),
-		     11,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write string.",
-			 function );
-
-			goto on_error;
-		}
+		return( -1 );
 	}
-	if( item_file_write_new_line(
-	     item_file,
-	     error ) != 1 )
+	if( item_prefix_length > (size_t) 63 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write new line.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid item prefix length value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( item_file_write_value_description(
-	     item_file,
-	     _LIBCSTRING_SYSTEM_STRING( "Value:" ),
-	     error ) != 1 )
+	if( item_directory_path == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write string.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item directory path.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( item_file_write_buffer_as_hexdump(
-	     item_file,
-	     value_data,
-	     value_data_size,
-	     error ) != 1 )
+	/* Determine the item directory name
+	 */
+	print_count = libcstring_system_string_sprintf(
+	               item_directory_name,
+	               64,
+	               _LIBCSTRING_SYSTEM_STRING( "%s%05d" ),
+	               item_prefix,
+	               item_index + 1 );
+
+	if( ( print_count < 0 )
+	 || ( (size_t) print_count > ( item_prefix_length + 5 ) ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write buffer.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set item directory name.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( ( value_type & 0x1000 ) != 0 )
-	{
-		if( libpff_item_get_entry_multi_value(
-		     item,
-		     set_index,
-		     entry_type,
-		     &multi_value,
-		     LIBPFF_ENTRY_VALUE_FLAG_IGNORE_NAME_TO_ID_MAP,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve entry multi value of set: %" PRIu32 " entry: %" PRIu32 ".",
-			 function,
-			 set_index,
-			 entry_index );
+	item_directory_name[ item_prefix_length + 5 ] = 0;
+	item_directory_name_length                    = item_prefix_length + 5;
 
-			goto on_error;
-		}
-		if( libpff_multi_value_free(
-		     &multi_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free multi value.\n",
-			 function );
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcpath_path_join_wide(
+	          item_directory_path,
+	          item_directory_path_size,
+	          export_path,
+	          export_path_length,
+	          item_directory_name,
+	          item_directory_name_length,
+	          error );
+#else
+	result = libcpath_path_join(
+	          item_directory_path,
+	          item_directory_path_size,
+	          export_path,
+	          export_path_length,
+	          item_directory_name,
+	          item_directory_name_length,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable create item directory path.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
-#endif
 	return( 1 );
 
 on_error:
-	if( name_to_id_map_entry_string != NULL )
+	if( *item_directory_path != NULL )
 	{
 		memory_free(
-		 name_to_id_map_entry_string );
+		 *item_directory_path );
+
+		*item_directory_path      = NULL;
+		*item_directory_path_size = 0;
 	}
 	return( -1 );
 }
 
-/* Exports the item values
+/* Creates the default item directory path
  * Returns 1 if successful or -1 on error
  */
-int export_handle_export_item_values(
+int export_handle_create_default_item_directory(
      export_handle_t *export_handle,
-     libpff_item_t *item,
-     const libcstring_system_character_t *item_values_filename,
-     size_t item_values_filename_length,
+     int item_index,
+     const libcstring_system_character_t *item_prefix,
+     size_t item_prefix_length,
      const libcstring_system_character_t *export_path,
      size_t export_path_length,
+     libcstring_system_character_t **item_directory_path,
+     size_t *item_directory_path_size,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	item_file_t *item_file     = NULL;
-	static char *function      = "export_handle_export_item_values";
-	uint32_t entry_index       = 0;
-	uint32_t number_of_entries = 0;
-	uint32_t number_of_sets    = 0;
-	uint32_t set_index         = 0;
-	int result                 = 0;
-
-	if( export_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export handle.",
-		 function );
+	static char *function = "export_handle_create_default_item_directory";
+	int result            = 0;
 
-		return( -1 );
-	}
-	if( item_values_filename == NULL )
+	if( item_directory_path == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid item value filename.",
-		 function );
-
-		return( -1 );
-	}
-	result = export_handle_create_item_file(
-	          export_handle,
-	          export_path,
-	          export_path_length,
-                  item_values_filename,
-                  item_values_filename_length,
-	          &item_file,
-	          error );
-
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create item file.",
+		 "%s: invalid item directory path.",
 		 function );
 
 		return( -1 );
 	}
-	else if( result == 0 )
-	{
-		log_handle_printf(
-		 log_handle,
-		 "Skipping item values file: %" PRIs_LIBCSTRING_SYSTEM " it already exists.\n",
-		 item_values_filename );
-
-		return( 1 );
-	}
-	if( libpff_item_get_number_of_sets(
-	     item,
-	     &number_of_sets,
+	if( export_handle_get_default_item_directory_path(
+	     export_handle,
+	     item_index,
+	     item_prefix,
+	     item_prefix_length,
+	     export_path,
+	     export_path_length,
+	     item_directory_path,
+	     item_directory_path_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of sets.",
+		 "%s: unable to retrieve item directory path.",
 		 function );
 
 		goto on_error;
 	}
-	if( libpff_item_get_number_of_entries(
-	     item,
-	     &number_of_entries,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries.",
-		 function );
+	result = export_handle_path_exists(
+	          export_handle,
+	          *item_directory_path,
+	          error );
 
-		goto on_error;
-	}
-	if( item_file_write_value_integer_32bit_as_decimal(
-	     item_file,
-	     _LIBCSTRING_SYSTEM_STRING( "Number of sets:\t\t\t" ),
-	     number_of_sets,
-	     error ) != 1 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write 32-bit integer value.",
-		 function );
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if %" PRIs_LIBCSTRING_SYSTEM " exists.",
+		 function,
+		 *item_directory_path );
 
 		goto on_error;
 	}
-	if( item_file_write_value_integer_32bit_as_decimal(
-	     item_file,
-	     _LIBCSTRING_SYSTEM_STRING( "Number of entries per set:\t" ),
-	     number_of_entries,
-	     error ) != 1 )
+	else if( result != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write 32-bit integer value.",
-		 function );
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: %" PRIs_LIBCSTRING_SYSTEM " already exists.",
+		 function,
+		 *item_directory_path );
 
 		goto on_error;
 	}
-	for( set_index = 0;
-	     set_index < number_of_sets;
-	     set_index++ )
-	{
-		for( entry_index = 0;
-		     entry_index < number_of_entries;
-		     entry_index++ )
-		{
-			if( export_handle_export_item_value_to_item_file(
-			     export_handle,
-			     item,
-			     set_index,
-			     entry_index,
-			     item_file,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_GENERIC,
-				 "%s: unable to export item value.",
-				 function );
-
-				goto on_error;
-			}
-		}
-	}
-	if( item_file_close(
-	     item_file,
-	     error ) != 0 )
+	if( export_handle_make_directory(
+	     export_handle,
+	     *item_directory_path,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-		 "%s: unable to close item file.",
-		 function );
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to make directory: %" PRIs_LIBCSTRING_SYSTEM ".",
+		 function,
+		 *item_directory_path );
 
 		goto on_error;
 	}
-	if( item_file_free(
-	     &item_file,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free item file.",
-		 function );
+	log_handle_printf(
+	 log_handle,
+	 "Created directory: %" PRIs_LIBCSTRING_SYSTEM ".\n",
+	 *item_directory_path );
 
-		goto on_error;
-	}
 	return( 1 );
 
 on_error:
-	if( item_file != NULL )
+	if( *item_directory_path != NULL )
 	{
-		item_file_free(
-		 &item_file,
-		 NULL );
+		memory_free(
+		 *item_directory_path );
+
+		*item_directory_path      = NULL;
+		*item_directory_path_size = 0;
 	}
 	return( -1 );
 }
 
-/* Exports the sub items
- * Returns 1 if successful or -1 on error
+/* Creates an item file
+ * Returns 1 if successful, 0 if the file already exists or -1 on error
  */
-int export_handle_export_sub_items(
+int export_handle_create_item_file(
      export_handle_t *export_handle,
-     libpff_item_t *item,
-     const libcstring_system_character_t *export_path,
-     size_t export_path_length,
-     log_handle_t *log_handle,
+     const libcstring_system_character_t *path,
+     size_t path_length,
+     const libcstring_system_character_t *filename,
+     size_t filename_length,
+     item_file_t **item_file,
      libcerror_error_t **error )
 {
-	libpff_item_t *sub_item = NULL;
-	static char *function   = "export_handle_export_sub_items";
-	int number_of_sub_items = 0;
-	int sub_item_iterator   = 0;
+	libcstring_system_character_t *item_file_path = NULL;
+	static char *function                         = "export_handle_create_item_file";
+	size_t item_file_path_size                    = 0;
+	int result                                    = 0;
 
 	if( export_handle == NULL )
 	{
@@ -2425,219 +2329,154 @@ int export_handle_export_sub_items(
 
 		return( -1 );
 	}
-	if( libpff_item_get_number_of_sub_items(
-	     item,
-	     &number_of_sub_items,
-	     error ) != 1 )
+	if( item_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of sub items.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item file.",
 		 function );
 
 		return( -1 );
 	}
-	for( sub_item_iterator = 0;
-	     sub_item_iterator < number_of_sub_items;
-	     sub_item_iterator++ )
-	{
-		if( export_handle->abort != 0 )
-		{
-			return( -1 );
-		}
-		if( libpff_item_get_sub_item(
-		     item,
-		     sub_item_iterator,
-		     &sub_item,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub item: %d.",
-			 function,
-			 sub_item_iterator + 1 );
-
-			return( -1 );
-		}
-		if( export_handle_export_item(
-		     export_handle,
-		     sub_item,
-		     sub_item_iterator,
-		     number_of_sub_items,
-		     export_path,
-		     export_path_length,
-		     log_handle,
-		     error ) != 1 )
-		{
-			fprintf(
-			 export_handle->notify_stream,
-			 "Unable to export sub item %d out of %d.\n",
-			 sub_item_iterator + 1,
-			 number_of_sub_items );
-
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: unable to export sub item: %d.\n",
-				 function,
-				 sub_item_iterator + 1 );
-			}
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
-			{
-				libcnotify_print_error_backtrace(
-				 *error );
-			}
-			libcerror_error_free(
-			 error );
-
-			log_handle_printf(
-			 log_handle,
-			 "Unable to export sub item: %d.\n",
-			 sub_item_iterator + 1 );
-		}
-		if( libpff_item_free(
-		     &sub_item,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free sub item: %d.",
-			 function,
-			 sub_item_iterator + 1 );
-
-			return( -1 );
-		}
-	}
-	return( 1 );
-}
-
-/* Exports the Outlook message header
- * Returns 1 if successful or -1 on error
- */
-int export_handle_export_message_header(
-     export_handle_t *export_handle,
-     libpff_item_t *message,
-     const libcstring_system_character_t *export_path,
-     size_t export_path_length,
-     log_handle_t *log_handle,
-     libcerror_error_t **error )
-{
-	item_file_t *item_file = NULL;
-	static char *function  = "export_handle_export_message_header";
-	int result             = 0;
-
-	if( export_handle == NULL )
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcpath_path_join_wide(
+	          &item_file_path,
+	          &item_file_path_size,
+	          path,
+	          path_length,
+	          filename,
+	          filename_length,
+	          error );
+#else
+	result = libcpath_path_join(
+	          &item_file_path,
+	          &item_file_path_size,
+	          path,
+	          path_length,
+	          filename,
+	          filename_length,
+	          error );
+#endif
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item file path.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	result = export_handle_create_item_file(
+	result = export_handle_path_exists(
 	          export_handle,
-	          export_path,
-	          export_path_length,
-	          _LIBCSTRING_SYSTEM_STRING( "OutlookHeaders.txt" ),
-	          18,
-	          &item_file,
+	          item_file_path,
 	          error );
 
 	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create item file.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if %" PRIs_LIBCSTRING_SYSTEM " exists.",
+		 function,
+		 item_file_path );
 
-		return( -1 );
+		goto on_error;
 	}
-	else if( result == 0 )
+	else if( result != 0 )
 	{
-		log_handle_printf(
-		 log_handle,
-		 "Skipping message header file it already exists.\n" );
+		memory_free(
+		 item_file_path );
 
-		return( 1 );
+		return( 0 );
 	}
-	if( export_handle_export_message_header_to_item_file(
-	     export_handle,
-	     message,
+	if( item_file_initialize(
 	     item_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_GENERIC,
-		 "%s: unable to export message header.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item file.", 
 		 function );
 
 		goto on_error;
 	}
-	if( item_file_close(
-	     item_file,
-	     error ) != 0 )
+	if( export_handle->archive_file != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-		 "%s: unable to close item file.",
-		 function );
-
-		goto on_error;
+		result = item_file_open_archive_entry(
+		          *item_file,
+		          export_handle->archive_file,
+		          &( item_file_path[ export_handle->base_path_length ] ),
+		          error );
 	}
-	if( item_file_free(
-	     &item_file,
-	     error ) != 1 )
+	else
+	{
+		result = item_file_open(
+		          *item_file,
+		          item_file_path,
+		          error );
+	}
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free item file.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open: %" PRIs_LIBCSTRING_SYSTEM ".",
+		 function,
+		 item_file_path );
 
 		goto on_error;
 	}
+	memory_free(
+	 item_file_path );
+
+	item_file_path = NULL;
+
 	return( 1 );
 
 on_error:
-	if( item_file != NULL )
+	if( *item_file != NULL )
 	{
 		item_file_free(
-		 &item_file,
+		 item_file,
 		 NULL );
 	}
+	if( item_file_path != NULL )
+	{
+		memory_free(
+		 item_file_path );
+	}
 	return( -1 );
 }
 
-/* Exports the message flags to an item file
+/* Exports the item
  * Returns 1 if successful or -1 on error
  */
-int export_handle_export_message_flags_to_item_file(
+int export_handle_export_item(
      export_handle_t *export_handle,
-     libpff_item_t *message,
-     const libcstring_system_character_t *description,
-     item_file_t *item_file,
+     libpff_item_t *item,
+     int item_index,
+     int number_of_items,
+     const libcstring_system_character_t *export_path,
+     size_t export_path_length,
+     log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_export_message_flags_to_item_file";
-	uint32_t value_32bit  = 0;
-	int result            = 0;
+	libcstring_system_character_t *entry_value_string = NULL;
+	libcstring_system_character_t *item_path          = NULL;
+	char *item_type_string                            = NULL;
+	static char *function                             = "export_handle_export_item";
+	size_t entry_value_string_size                    = 0;
+	size_t item_path_size                             = 0;
+	uint8_t item_type                                 = 0;
+	int result                                        = 0;
 
 	if( export_handle == NULL )
 	{
@@ -2650,332 +2489,539 @@ int export_handle_export_message_flags_to_item_file(
 
 		return( -1 );
 	}
-	if( description == NULL )
+	if( libpff_item_get_type(
+	     item,
+	     &item_type,
+	     error ) != 1 )
 	{
+		fprintf(
+		 export_handle->notify_stream,
+		 "Unable to retrieve type of item %d out of %d.\n",
+		 item_index + 1,
+		 number_of_items );
+
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid description.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve item type.",
 		 function );
 
-		return( -1 );
-	}
-	result = libpff_message_get_flags(
-	          message,
-	          &value_32bit,
-	          error );
-
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve flags.",
-		 function );
-
-#if defined( HAVE_DEBUG_OUTPUT )
 		if( ( error != NULL )
 		 && ( *error != NULL ) )
 		{
 			libcnotify_print_error_backtrace(
 			 *error );
 		}
-#endif
 		libcerror_error_free(
 		 error );
+
+		log_handle_printf(
+		 log_handle,
+		 "Unable to retrieve type of item %d out of %d.\n",
+		 item_index + 1,
+		 number_of_items );
+
+		return( 1 );
 	}
-	else if( result != 0 )
+	switch( item_type )
 	{
-		if( item_file_write_string(
-		     item_file,
-		     description,
-		     libcstring_system_string_length(
-		      description ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write description.",
-			 function );
+		case LIBPFF_ITEM_TYPE_ACTIVITY:
+			item_type_string = "activity";
 
-			return( -1 );
-		}
-		if( item_file_write_integer_32bit_as_hexadecimal(
-		     item_file,
-		     value_32bit,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write 32-bit integer.",
-			 function );
+			if( export_handle->print_status_information != 0 )
+			{
+				fprintf(
+				 export_handle->notify_stream,
+				 "Exporting %s item %d out of %d.\n",
+				 item_type_string,
+				 item_index + 1,
+				 number_of_items );
+			}
+			result = export_handle_export_activity(
+			          export_handle,
+			          item,
+			          item_index,
+			          export_path,
+			          export_path_length,
+			          log_handle,
+			          error );
+			break;
 
-			return( -1 );
-		}
-		if( item_file_write_string(
-		     item_file,
-		     _LIBCSTRING_SYSTEM_STRING( " (" ),
-		     2,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write string.",
-			 function );
+		case LIBPFF_ITEM_TYPE_APPOINTMENT:
+			item_type_string = "appointment";
 
-			return( -1 );
-		}
-		if( ( value_32bit & LIBPFF_MESSAGE_FLAG_READ ) != 0 )
-		{
-			if( item_file_write_string(
-			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( "Read" ),
-			     4,
-			     error ) != 1 )
+			if( export_handle->print_status_information != 0 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write string.",
-				 function );
-
-				return( -1 );
+				fprintf(
+				 export_handle->notify_stream,
+				 "Exporting %s item %d out of %d.\n",
+				 item_type_string,
+				 item_index + 1,
+				 number_of_items );
 			}
-		}
-		else
-		{
-			if( item_file_write_string(
-			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( "Unread" ),
-			     6,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write string.",
-				 function );
+			result = export_handle_export_appointment(
+			          export_handle,
+			          item,
+			          item_index,
+			          export_path,
+			          export_path_length,
+			          log_handle,
+			          error );
+			break;
 
-				return( -1 );
-			}
-		}
-		if( ( value_32bit & LIBPFF_MESSAGE_FLAG_UNMODIFIED ) != 0 )
-		{
-			if( item_file_write_string(
-			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( ", Unmodified" ),
-			     12,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write string.",
-				 function );
+		case LIBPFF_ITEM_TYPE_CONTACT:
+			item_type_string = "contact";
 
-				return( -1 );
-			}
-		}
-		if( ( value_32bit & LIBPFF_MESSAGE_FLAG_SUBMIT ) != 0 )
-		{
-			if( item_file_write_string(
-			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( ", Submit" ),
-			     8,
-			     error ) != 1 )
+			if( export_handle->print_status_information != 0 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write string.",
-				 function );
-
-				return( -1 );
+				fprintf(
+				 export_handle->notify_stream,
+				 "Exporting %s item %d out of %d.\n",
+				 item_type_string,
+				 item_index + 1,
+				 number_of_items );
 			}
-		}
-		if( ( value_32bit & LIBPFF_MESSAGE_FLAG_UNSENT ) != 0 )
-		{
-			if( item_file_write_string(
-			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( ", Unsent" ),
-			     8,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write string.",
-				 function );
+			result = export_handle_export_contact(
+			          export_handle,
+			          item,
+			          item_index,
+			          export_path,
+			          export_path_length,
+			          log_handle,
+			          error );
+			break;
 
-				return( -1 );
-			}
-		}
-		if( ( value_32bit & LIBPFF_MESSAGE_FLAG_HAS_ATTACHMENTS ) != 0 )
-		{
-			if( item_file_write_string(
-			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( ", Has attachments" ),
-			     17,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write string.",
-				 function );
+		case LIBPFF_ITEM_TYPE_DOCUMENT:
+			item_type_string = "document";
 
-				return( -1 );
-			}
-		}
-		if( ( value_32bit & LIBPFF_MESSAGE_FLAG_FROM_ME ) != 0 )
-		{
-			if( item_file_write_string(
-			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( ", From me" ),
-			     9,
-			     error ) != 1 )
+			if( export_handle->print_status_information != 0 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write string.",
-				 function );
-
-				return( -1 );
+				fprintf(
+				 export_handle->notify_stream,
+				 "Exporting %s item %d out of %d.\n",
+				 item_type_string,
+				 item_index + 1,
+				 number_of_items );
 			}
-		}
-		if( ( value_32bit & LIBPFF_MESSAGE_FLAG_ASSOCIATED ) != 0 )
-		{
-			if( item_file_write_string(
-			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( ", Associated" ),
-			     12,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write string.",
-				 function );
+			result = export_handle_export_document(
+			          export_handle,
+			          item,
+			          item_index,
+			          export_path,
+			          export_path_length,
+			          log_handle,
+			          error );
+			break;
 
-				return( -1 );
+		case LIBPFF_ITEM_TYPE_CONFLICT_MESSAGE:
+		case LIBPFF_ITEM_TYPE_EMAIL:
+		case LIBPFF_ITEM_TYPE_EMAIL_SMIME:
+			item_type_string = "email";
+
+			if( export_handle->print_status_information != 0 )
+			{
+				fprintf(
+				 export_handle->notify_stream,
+				 "Exporting %s item %d out of %d.\n",
+				 item_type_string,
+				 item_index + 1,
+				 number_of_items );
 			}
-		}
-		if( ( value_32bit & LIBPFF_MESSAGE_FLAG_RESEND ) != 0 )
-		{
-			if( item_file_write_string(
-			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( ", Resend" ),
-			     8,
-			     error ) != 1 )
+			result = export_handle_export_email(
+			          export_handle,
+			          item,
+			          item_index,
+			          export_path,
+			          export_path_length,
+			          log_handle,
+			          error );
+			break;
+
+		case LIBPFF_ITEM_TYPE_FOLDER:
+			item_type_string = "folder";
+
+			if( export_handle->print_status_information != 0 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write string.",
-				 function );
+				fprintf(
+				 export_handle->notify_stream,
+				 "Exporting %s item %d out of %d.\n",
+				 item_type_string,
+				 item_index + 1,
+				 number_of_items );
+			}
+			result = export_handle_export_folder(
+			          export_handle,
+			          item,
+			          item_index,
+			          export_path,
+			          export_path_length,
+			          log_handle,
+			          error );
+			break;
 
-				return( -1 );
+		case LIBPFF_ITEM_TYPE_MEETING:
+			item_type_string = "meeting";
+
+			if( export_handle->print_status_information != 0 )
+			{
+				fprintf(
+				 export_handle->notify_stream,
+				 "Exporting %s item %d out of %d.\n",
+				 item_type_string,
+				 item_index + 1,
+				 number_of_items );
+			}
+			result = export_handle_export_meeting(
+			          export_handle,
+			          item,
+			          item_index,
+			          export_path,
+			          export_path_length,
+			          log_handle,
+			          error );
+			break;
+
+		case LIBPFF_ITEM_TYPE_NOTE:
+			item_type_string = "note";
+
+			if( export_handle->print_status_information != 0 )
+			{
+				fprintf(
+				 export_handle->notify_stream,
+				 "Exporting %s item %d out of %d.\n",
+				 item_type_string,
+				 item_index + 1,
+				 number_of_items );
+			}
+			result = export_handle_export_note(
+			          export_handle,
+			          item,
+			          item_index,
+			          export_path,
+			          export_path_length,
+			          log_handle,
+			          error );
+			break;
+
+		case LIBPFF_ITEM_TYPE_RSS_FEED:
+			item_type_string = "RSS feed";
+
+			if( export_handle->print_status_information != 0 )
+			{
+				fprintf(
+				 export_handle->notify_stream,
+				 "Exporting %s item %d out of %d.\n",
+				 item_type_string,
+				 item_index + 1,
+				 number_of_items );
+			}
+			result = export_handle_export_rss_feed(
+			          export_handle,
+			          item,
+			          item_index,
+			          export_path,
+			          export_path_length,
+			          log_handle,
+			          error );
+			break;
+
+		case LIBPFF_ITEM_TYPE_TASK:
+			item_type_string = "task";
+
+			if( export_handle->print_status_information != 0 )
+			{
+				fprintf(
+				 export_handle->notify_stream,
+				 "Exporting %s item %d out of %d.\n",
+				 item_type_string,
+				 item_index + 1,
+				 number_of_items );
 			}
+			result = export_handle_export_task(
+			          export_handle,
+			          item,
+			          item_index,
+			          export_path,
+			          export_path_length,
+			          log_handle,
+			          error );
+			break;
+
+		default:
+			result = 0;
+
+			break;
+	}
+	if( result == -1 )
+	{
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to export %s item: %d out of: %d.\n",
+			 function,
+			 item_type_string,
+			 item_index + 1,
+			 number_of_items );
 		}
-		if( ( value_32bit & LIBPFF_MESSAGE_FLAG_RN_PENDING ) != 0 )
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
 		{
-			if( item_file_write_string(
-			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( ", RN pending" ),
-			     12,
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+		libcerror_error_free(
+		 error );
+
+		log_handle_printf(
+		 log_handle,
+		 "Unable to export %s item: %d out of: %d.\n",
+		 item_type_string,
+		 item_index + 1,
+		 number_of_items );
+	}
+	else if( result == 0 )
+	{
+		if( ( export_handle->export_mode == EXPORT_MODE_DEBUG )
+		 && ( export_handle->json_file != NULL ) )
+		{
+			if( export_handle_export_item_json(
+			     export_handle,
+			     item,
+			     item_index,
+			     _LIBCSTRING_SYSTEM_STRING( "Item" ),
+			     4,
+			     export_path,
+			     export_path_length,
+			     log_handle,
 			     error ) != 1 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write string.",
-				 function );
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: unable to export values of item: %d out of: %d.\n",
+					 function,
+					 item_index + 1,
+					 number_of_items );
+				}
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+				libcerror_error_free(
+				 error );
 
-				return( -1 );
+				log_handle_printf(
+				 log_handle,
+				 "Unable to export values of item: %d out of: %d.\n",
+				 item_index + 1,
+				 number_of_items );
 			}
 		}
-		if( ( value_32bit & LIBPFF_MESSAGE_FLAG_NRN_PENDING ) != 0 )
+		else if( export_handle->export_mode == EXPORT_MODE_DEBUG )
 		{
-			if( item_file_write_string(
-			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( ", NRN pending" ),
-			     13,
+			if( export_handle_create_default_item_directory(
+			     export_handle,
+			     item_index,
+			     _LIBCSTRING_SYSTEM_STRING( "Item" ),
+			     4,
+			     export_path,
+			     export_path_length,
+			     &item_path,
+			     &item_path_size,
+			     log_handle,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write string.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable create item directory.",
 				 function );
 
-				return( -1 );
+				goto on_error;
 			}
-		}
-		if( item_file_write_string(
-		     item_file,
-		     _LIBCSTRING_SYSTEM_STRING( ")" ),
-		     1,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write string.",
-			 function );
+			if( export_handle_export_item_values(
+			     export_handle,
+			     item,
+			     _LIBCSTRING_SYSTEM_STRING( "ItemValues.txt" ),
+			     14,
+			     item_path,
+			     item_path_size - 1,
+			     log_handle,
+			     error ) != 1 )
+			{
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: unable to export values of item: %d out of: %d.\n",
+					 function,
+					 item_index + 1,
+					 number_of_items );
+				}
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+				libcerror_error_free(
+				 error );
 
-			return( -1 );
+				log_handle_printf(
+				 log_handle,
+				 "Unable to export values of item: %d out of: %d.\n",
+				 item_index + 1,
+				 number_of_items );
+			}
+			memory_free(
+			 item_path );
 		}
-		if( item_file_write_new_line(
-		     item_file,
-		     error ) != 1 )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write new line.",
-			 function );
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libpff_message_get_utf16_class_size(
+			          item,
+			          &entry_value_string_size,
+			          error );
+#else
+			result = libpff_message_get_utf8_class_size(
+			          item,
+			          &entry_value_string_size,
+			          error );
+#endif
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve message class size.",
+				 function );
 
-			return( -1 );
+				goto on_error;
+			}
+			if( ( entry_value_string_size == 0 )
+			 || ( entry_value_string_size > (size_t) SSIZE_MAX ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid entry value string size.",
+				 function );
+
+				goto on_error;
+			}
+			entry_value_string = libcstring_system_string_allocate(
+			                      entry_value_string_size );
+
+			if( entry_value_string == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create entry value string.",
+				 function );
+
+				goto on_error;
+			}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libpff_message_get_utf16_class(
+			          item,
+			          (uint16_t *) entry_value_string,
+			          entry_value_string_size,
+			          error );
+#else
+			result = libpff_message_get_utf8_class(
+			          item,
+			          (uint8_t *) entry_value_string,
+			          entry_value_string_size,
+			          error );
+#endif
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve message class.",
+				 function );
+
+				goto on_error;
+			}
+			fprintf(
+			 export_handle->notify_stream,
+			 "Skipped item %d out of %d of type: %" PRIs_LIBCSTRING_SYSTEM ".\n",
+			 item_index + 1,
+			 number_of_items,
+			 entry_value_string );
+
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: skipped export of item: %d out of: %d of type: %" PRIs_LIBCSTRING_SYSTEM " (0x%02" PRIx8 ").\n",
+				 function,
+				 item_index + 1,
+				 number_of_items,
+				 entry_value_string,
+				 item_type );
+			}
+			log_handle_printf(
+			 log_handle,
+			 "Skipped export of item: %d out of: %d of type: %" PRIs_LIBCSTRING_SYSTEM " (0x%02" PRIx8 ").\n",
+			 item_index + 1,
+			 number_of_items,
+			 entry_value_string,
+			 item_type );
+
+			memory_free(
+			 entry_value_string );
+
+			entry_value_string = NULL;
 		}
 	}
 	return( 1 );
+
+on_error:
+	if( entry_value_string != NULL )
+	{
+		memory_free(
+		 entry_value_string );
+	}
+	return( -1 );
 }
 
-/* Exports the message importance to an item file
+/* Exports a specific item value to the item file
  * Returns 1 if successful or -1 on error
  */
-int export_handle_export_message_importance_to_item_file(
+int export_handle_export_item_value_to_item_file(
      export_handle_t *export_handle,
-     libpff_item_t *message,
-     const libcstring_system_character_t *description,
+     libpff_item_t *item,
+     uint32_t set_index,
+     uint32_t entry_index,
      item_file_t *item_file,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_export_message_importance_to_item_file";
-	uint32_t value_32bit  = 0;
-	int result            = 0;
+	libcstring_system_character_t *name_to_id_map_entry_string = NULL;
+	libpff_name_to_id_map_entry_t *name_to_id_map_entry        = NULL;
+	uint8_t *value_data                                        = NULL;
+	static char *function                                      = "export_handle_export_item_value_to_item_file";
+	size_t name_to_id_map_entry_string_size                    = 0;
+	size_t value_data_size                                     = 0;
+	uint32_t entry_type                                        = 0;
+	uint32_t matched_value_type                                = LIBPFF_VALUE_TYPE_UNSPECIFIED;
+	uint32_t name_to_id_map_entry_number                       = 0;
+	uint32_t value_type                                        = LIBPFF_VALUE_TYPE_UNSPECIFIED;
+	uint8_t name_to_id_map_entry_type                          = 0;
+	int result                                                 = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	libpff_multi_value_t *multi_value                          = NULL;
+#endif
 
 	if( export_handle == NULL )
 	{
@@ -2988,149 +3034,209 @@ int export_handle_export_message_importance_to_item_file(
 
 		return( -1 );
 	}
-	if( description == NULL )
+	if( item_file_write_value_integer_32bit_as_decimal(
+	     item_file,
+	     _LIBCSTRING_SYSTEM_STRING( "Set:\t\t\t\t" ),
+	     set_index,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid description.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write 32-bit integer value.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	result = libpff_message_get_importance(
-	          message,
-	          &value_32bit,
-	          error );
+	if( item_file_write_value_integer_32bit_as_decimal(
+	     item_file,
+	     _LIBCSTRING_SYSTEM_STRING( "Entry:\t\t\t\t" ),
+	     entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write 32-bit integer value.",
+		 function );
 
-	if( result == -1 )
+		goto on_error;
+	}
+	if( libpff_item_get_entry_type(
+	     item,
+	     set_index,
+	     entry_index,
+	     &entry_type,
+	     &value_type,
+	     &name_to_id_map_entry,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve importance.",
-		 function );
+		 "%s: unable to retrieve entry type of set: %" PRIu32 " entry: %" PRIu32 ".",
+		 function,
+		 set_index,
+		 entry_index );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-			libcnotify_print_error_backtrace(
-			 *error );
-		}
-#endif
-		libcerror_error_free(
-		 error );
+		goto on_error;
 	}
-	else if( result != 0 )
-	{
-		if( item_file_write_string(
-		     item_file,
-		     description,
-		     libcstring_system_string_length(
-		      description ),
+	if( item_file_write_value_integer_32bit_as_hexadecimal(
+	     item_file,
+	     _LIBCSTRING_SYSTEM_STRING( "Entry type:\t\t\t" ),
+	     entry_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write 32-bit integer value.",
+		 function );
+
+		goto on_error;
+	}
+	if( item_file_write_value_integer_32bit_as_hexadecimal(
+	     item_file,
+	     _LIBCSTRING_SYSTEM_STRING( "Value type:\t\t\t" ),
+	     value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write 32-bit integer value.",
+		 function );
+
+		goto on_error;
+	}
+	if( name_to_id_map_entry != NULL )
+	{
+		if( libpff_name_to_id_map_entry_get_type(
+		     name_to_id_map_entry,
+		     &name_to_id_map_entry_type,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write description.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve name to identifier map entry type of set: %" PRIu32 " entry: %" PRIu32 ".",
+			 function,
+			 set_index,
+			 entry_index );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( value_32bit == (uint32_t) LIBPFF_MESSAGE_IMPORTANCE_TYPE_LOW )
+		if( name_to_id_map_entry_type == LIBPFF_NAME_TO_ID_MAP_ENTRY_TYPE_NUMERIC )
 		{
-			if( item_file_write_string(
-			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( "Low" ),
-			     3,
+			if( libpff_name_to_id_map_entry_get_number(
+			     name_to_id_map_entry,
+			     &name_to_id_map_entry_number,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write string.",
-				 function );
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve name to identifier map entry number of set: %" PRIu32 " entry: %" PRIu32 ".",
+				 function,
+				 set_index,
+				 entry_index );
 
-				return( -1 );
+				goto on_error;
 			}
-		}
-		else if( value_32bit == (uint32_t) LIBPFF_MESSAGE_IMPORTANCE_TYPE_NORMAL )
-		{
-			if( item_file_write_string(
+			if( item_file_write_value_integer_32bit_as_hexadecimal(
 			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( "Normal" ),
-			     6,
+			     _LIBCSTRING_SYSTEM_STRING( "Maps to entry type:\t\t" ),
+			     name_to_id_map_entry_number,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_IO,
 				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write string.",
+				 "%s: unable to write 32-bit integer value.",
 				 function );
 
-				return( -1 );
+				goto on_error;
 			}
 		}
-		else if( value_32bit == (uint32_t) LIBPFF_MESSAGE_IMPORTANCE_TYPE_HIGH )
+		else if( name_to_id_map_entry_type == LIBPFF_NAME_TO_ID_MAP_ENTRY_TYPE_STRING )
 		{
-			if( item_file_write_string(
-			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( "High" ),
-			     4,
-			     error ) != 1 )
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libpff_name_to_id_map_entry_get_utf16_string_size(
+				  name_to_id_map_entry,
+				  &name_to_id_map_entry_string_size,
+				  error );
+#else
+			result = libpff_name_to_id_map_entry_get_utf8_string_size(
+				  name_to_id_map_entry,
+				  &name_to_id_map_entry_string_size,
+				  error );
+#endif
+			if( result != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write string.",
-				 function );
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve name to identifier map entry string size of set: %" PRIu32 " entry: %" PRIu32 ".",
+				 function,
+				 set_index,
+				 entry_index );
 
-				return( -1 );
+				goto on_error;
 			}
-		}
-		else
-		{
-			if( item_file_write_string(
-			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( "Unknown (" ),
-			     9,
-			     error ) != 1 )
+			name_to_id_map_entry_string = libcstring_system_string_allocate(
+			                               name_to_id_map_entry_string_size );
+
+			if( name_to_id_map_entry_string == NULL )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write string.",
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create name to identifier map entry string.",
 				 function );
 
-				return( -1 );
+				goto on_error;
 			}
-			if( item_file_write_integer_32bit_as_hexadecimal(
-			     item_file,
-			     value_32bit,
-			     error ) != 1 )
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libpff_name_to_id_map_entry_get_utf16_string(
+				  name_to_id_map_entry,
+				  (uint16_t *) name_to_id_map_entry_string,
+				  name_to_id_map_entry_string_size,
+				  error );
+#else
+			result = libpff_name_to_id_map_entry_get_utf8_string(
+				  name_to_id_map_entry,
+				  (uint8_t *) name_to_id_map_entry_string,
+				  name_to_id_map_entry_string_size,
+				  error );
+#endif
+			if( result != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write 32-bit integer.",
-				 function );
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve name to identifier map entry string of set: %" PRIu32 " entry: %" PRIu32 ".",
+				 function,
+				 set_index,
+				 entry_index );
 
-				return( -1 );
+				goto on_error;
 			}
-			if( item_file_write_string(
+			if( item_file_write_value_string(
 			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( ")" ),
-			     1,
+			     _LIBCSTRING_SYSTEM_STRING( "Maps to entry:\t\t\t" ),
+			     name_to_id_map_entry_string,
+			     name_to_id_map_entry_string_size - 1,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -3140,236 +3246,196 @@ int export_handle_export_message_importance_to_item_file(
 				 "%s: unable to write string.",
 				 function );
 
-				return( -1 );
+				goto on_error;
 			}
-		}
-		if( item_file_write_new_line(
-		     item_file,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write new line.",
-			 function );
+			memory_free(
+			 name_to_id_map_entry_string );
 
-			return( -1 );
+			name_to_id_map_entry_string = NULL;
 		}
 	}
-	return( 1 );
-}
+	matched_value_type = LIBPFF_VALUE_TYPE_UNSPECIFIED;
 
-/* Exports the message priority to an item file
- * Returns 1 if successful or -1 on error
- */
-int export_handle_export_message_priority_to_item_file(
-     export_handle_t *export_handle,
-     libpff_item_t *message,
-     const libcstring_system_character_t *description,
-     item_file_t *item_file,
-     libcerror_error_t **error )
-{
-	static char *function = "export_handle_export_message_priority_to_item_file";
-	uint32_t value_32bit  = 0;
-	int result            = 0;
+	result = libpff_item_get_entry_value(
+		  item,
+		  set_index,
+		  entry_type,
+		  &matched_value_type,
+		  &value_data,
+		  &value_data_size,
+		  LIBPFF_ENTRY_VALUE_FLAG_MATCH_ANY_VALUE_TYPE | LIBPFF_ENTRY_VALUE_FLAG_IGNORE_NAME_TO_ID_MAP,
+		  error );
 
-	if( export_handle == NULL )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export handle.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry value of set: %" PRIu32 " entry: %" PRIu32 ".",
+		 function,
+		 set_index,
+		 entry_index );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( description == NULL )
+	if( item_file_write_string(
+	     item_file,
+	     _LIBCSTRING_SYSTEM_STRING( "Matched value type:\t\t" ),
+	     21,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid description.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write string.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	result = libpff_message_get_priority(
-	          message,
-	          &value_32bit,
-	          error );
-
-	if( result == -1 )
+	if( item_file_write_integer_32bit_as_hexadecimal(
+	     item_file,
+	     matched_value_type,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve priority.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write 32-bit integer.",
 		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-			libcnotify_print_error_backtrace(
-			 *error );
-		}
-#endif
-		libcerror_error_free(
-		 error );
+		goto on_error;
 	}
-	else if( result != 0 )
+	if( value_type != matched_value_type )
 	{
 		if( item_file_write_string(
 		     item_file,
-		     description,
-		     libcstring_system_string_length(
-		      description ),
+		     _LIBCSTRING_SYSTEM_STRING( " (mismatch)" ),
+		     11,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write description.",
+			 "%s: unable to write string.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( value_32bit == (uint32_t) LIBPFF_MESSAGE_PRIORITY_TYPE_NON_URGENT )
-		{
-			if( item_file_write_string(
-			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( "Non Urgent" ),
-			     10,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write string.",
-				 function );
+	}
+	if( item_file_write_new_line(
+	     item_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write new line.",
+		 function );
 
-				return( -1 );
-			}
-		}
-		else if( value_32bit == (uint32_t) LIBPFF_MESSAGE_PRIORITY_TYPE_NORMAL )
-		{
-			if( item_file_write_string(
-			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( "Normal" ),
-			     6,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write string.",
-				 function );
+		goto on_error;
+	}
+	if( item_file_write_value_description(
+	     item_file,
+	     _LIBCSTRING_SYSTEM_STRING( "Value:" ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write string.",
+		 function );
 
-				return( -1 );
-			}
-		}
-		else if( value_32bit == (uint32_t) LIBPFF_MESSAGE_PRIORITY_TYPE_URGENT )
-		{
-			if( item_file_write_string(
-			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( "Urgent" ),
-			     6,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write string.",
-				 function );
+		goto on_error;
+	}
+	if( item_file_write_buffer_as_hexdump(
+	     item_file,
+	     value_data,
+	     value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write buffer.",
+		 function );
 
-				return( -1 );
-			}
-		}
-		else
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( ( value_type & 0x1000 ) != 0 )
+	{
+		if( libpff_item_get_entry_multi_value(
+		     item,
+		     set_index,
+		     entry_type,
+		     &multi_value,
+		     LIBPFF_ENTRY_VALUE_FLAG_IGNORE_NAME_TO_ID_MAP,
+		     error ) != 1 )
 		{
-			if( item_file_write_string(
-			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( "Unknown (" ),
-			     9,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write string.",
-				 function );
-
-				return( -1 );
-			}
-			if( item_file_write_integer_32bit_as_hexadecimal(
-			     item_file,
-			     value_32bit,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write 32-bit integer.",
-				 function );
-
-				return( -1 );
-			}
-			if( item_file_write_string(
-			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( ")" ),
-			     1,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write string.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry multi value of set: %" PRIu32 " entry: %" PRIu32 ".",
+			 function,
+			 set_index,
+			 entry_index );
 
-				return( -1 );
-			}
+			goto on_error;
 		}
-		if( item_file_write_new_line(
-		     item_file,
+		if( libpff_multi_value_free(
+		     &multi_value,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write new line.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free multi value.\n",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 	}
+#endif
 	return( 1 );
+
+on_error:
+	if( name_to_id_map_entry_string != NULL )
+	{
+		memory_free(
+		 name_to_id_map_entry_string );
+	}
+	return( -1 );
 }
 
-/* Exports the message sensitivity to an item file
+/* Exports the item values
  * Returns 1 if successful or -1 on error
  */
-int export_handle_export_message_sensitivity_to_item_file(
+int export_handle_export_item_values(
      export_handle_t *export_handle,
-     libpff_item_t *message,
-     const libcstring_system_character_t *description,
-     item_file_t *item_file,
+     libpff_item_t *item,
+     const libcstring_system_character_t *item_values_filename,
+     size_t item_values_filename_length,
+     const libcstring_system_character_t *export_path,
+     size_t export_path_length,
+     log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_export_message_sensitivity_to_item_file";
-	uint32_t value_32bit  = 0;
-	int result            = 0;
+	item_file_t *item_file     = NULL;
+	static char *function      = "export_handle_export_item_values";
+	uint32_t entry_index       = 0;
+	uint32_t number_of_entries = 0;
+	uint32_t number_of_sets    = 0;
+	uint32_t set_index         = 0;
+	int result                 = 0;
 
 	if( export_handle == NULL )
 	{
@@ -3382,20 +3448,30 @@ int export_handle_export_message_sensitivity_to_item_file(
 
 		return( -1 );
 	}
-	if( description == NULL )
+	if( item_values_filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid description.",
+		 "%s: invalid item value filename.",
 		 function );
 
 		return( -1 );
 	}
-	result = libpff_message_get_sensitivity(
-	          message,
-	          &value_32bit,
+	/* In JSON mode the item values are part of the record of the item
+	 */
+	if( export_handle->json_file != NULL )
+	{
+		return( 1 );
+	}
+	result = export_handle_create_item_file(
+	          export_handle,
+	          export_path,
+	          export_path_length,
+                  item_values_filename,
+                  item_values_filename_length,
+	          &item_file,
 	          error );
 
 	if( result == -1 )
@@ -3403,339 +3479,284 @@ int export_handle_export_message_sensitivity_to_item_file(
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve sensitivity.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item file.",
 		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-			libcnotify_print_error_backtrace(
-			 *error );
-		}
-#endif
-		libcerror_error_free(
-		 error );
+		return( -1 );
 	}
-	else if( result != 0 )
+	else if( result == 0 )
 	{
-		if( item_file_write_string(
-		     item_file,
-		     description,
-		     libcstring_system_string_length(
-		      description ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write description.",
-			 function );
+		log_handle_printf(
+		 log_handle,
+		 "Skipping item values file: %" PRIs_LIBCSTRING_SYSTEM " it already exists.\n",
+		 item_values_filename );
 
-			return( -1 );
-		}
-		if( value_32bit == (uint32_t) LIBPFF_MESSAGE_SENSITIVITY_TYPE_NONE )
-		{
-			if( item_file_write_string(
-			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( "None" ),
-			     4,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write string.",
-				 function );
+		return( 1 );
+	}
+	if( libpff_item_get_number_of_sets(
+	     item,
+	     &number_of_sets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sets.",
+		 function );
 
-				return( -1 );
-			}
-		}
-		else if( value_32bit == (uint32_t) LIBPFF_MESSAGE_SENSITIVITY_TYPE_PERSONAL )
-		{
-			if( item_file_write_string(
-			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( "Personal" ),
-			     8,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write string.",
-				 function );
+		goto on_error;
+	}
+	if( libpff_item_get_number_of_entries(
+	     item,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
 
-				return( -1 );
-			}
-		}
-		else if( value_32bit == (uint32_t) LIBPFF_MESSAGE_SENSITIVITY_TYPE_PRIVATE )
-		{
-			if( item_file_write_string(
-			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( "Private" ),
-			     7,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write string.",
-				 function );
+		goto on_error;
+	}
+	if( item_file_write_value_integer_32bit_as_decimal(
+	     item_file,
+	     _LIBCSTRING_SYSTEM_STRING( "Number of sets:\t\t\t" ),
+	     number_of_sets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write 32-bit integer value.",
+		 function );
 
-				return( -1 );
-			}
-		}
-		else if( value_32bit == (uint32_t) LIBPFF_MESSAGE_SENSITIVITY_TYPE_CONFIDENTIAL )
-		{
-			if( item_file_write_string(
-			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( "Confidential" ),
-			     12,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write string.",
-				 function );
+		goto on_error;
+	}
+	if( item_file_write_value_integer_32bit_as_decimal(
+	     item_file,
+	     _LIBCSTRING_SYSTEM_STRING( "Number of entries per set:\t" ),
+	     number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write 32-bit integer value.",
+		 function );
 
-				return( -1 );
-			}
-		}
-		else
+		goto on_error;
+	}
+	for( set_index = 0;
+	     set_index < number_of_sets;
+	     set_index++ )
+	{
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
 		{
-			if( item_file_write_string(
-			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( "Unknown (" ),
-			     9,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write string.",
-				 function );
-
-				return( -1 );
-			}
-			if( item_file_write_integer_32bit_as_hexadecimal(
-			     item_file,
-			     value_32bit,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write 32-bit integer.",
-				 function );
-
-				return( -1 );
-			}
-			if( item_file_write_string(
+			if( export_handle_export_item_value_to_item_file(
+			     export_handle,
+			     item,
+			     set_index,
+			     entry_index,
 			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( ")" ),
-			     1,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write string.",
+				 LIBCERROR_IO_ERROR_GENERIC,
+				 "%s: unable to export item value.",
 				 function );
 
-				return( -1 );
+				goto on_error;
 			}
 		}
-		if( item_file_write_new_line(
-		     item_file,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write new line.",
-			 function );
-
-			return( -1 );
-		}
 	}
-	return( 1 );
-}
-
-/* Exports the message subject to an item file
- * Returns 1 if successful or -1 on error
- */
-int export_handle_export_message_subject_to_item_file(
-     export_handle_t *export_handle,
-     libpff_item_t *message,
-     const libcstring_system_character_t *description,
-     item_file_t *item_file,
-     libcerror_error_t **error )
-{
-	libcstring_system_character_t *value_string = NULL;
-	static char *function                       = "export_handle_export_message_subject_to_item_file";
-	size_t value_string_size                    = 0;
-	int result                                  = 0;
-
-	if( export_handle == NULL )
+	if( item_file_close(
+	     item_file,
+	     error ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export handle.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close item file.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libpff_message_get_utf16_subject_size(
-	          message,
-	          &value_string_size,
-	          error );
-#else
-	result = libpff_message_get_utf8_subject_size(
-	          message,
-	          &value_string_size,
-	          error );
-#endif
-	if( result == -1 )
+	if( item_file_free(
+	     &item_file,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve subject size.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free item file.",
 		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-			libcnotify_print_error_backtrace(
-			 *error );
-		}
-#endif
-		libcerror_error_free(
-		 error );
+		goto on_error;
 	}
-	else if( ( result != 0 )
-	      && ( value_string_size > 0 ) )
+	return( 1 );
+
+on_error:
+	if( item_file != NULL )
 	{
-		value_string = libcstring_system_string_allocate(
-		                value_string_size );
+		item_file_free(
+		 &item_file,
+		 NULL );
+	}
+	return( -1 );
+}
 
-		if( value_string == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create subject.",
-			 function );
+/* Exports the sub items
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_sub_items(
+     export_handle_t *export_handle,
+     libpff_item_t *item,
+     const libcstring_system_character_t *export_path,
+     size_t export_path_length,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libpff_item_t *sub_item = NULL;
+	static char *function   = "export_handle_export_sub_items";
+	int number_of_sub_items = 0;
+	int sub_item_iterator   = 0;
 
-			goto on_error;
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_item_get_number_of_sub_items(
+	     item,
+	     &number_of_sub_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub items.",
+		 function );
+
+		return( -1 );
+	}
+	for( sub_item_iterator = 0;
+	     sub_item_iterator < number_of_sub_items;
+	     sub_item_iterator++ )
+	{
+		if( export_handle->abort != 0 )
+		{
+			return( -1 );
 		}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libpff_message_get_utf16_subject(
-		          message,
-		          (uint16_t *) value_string,
-		          value_string_size,
-		          error );
-#else
-		result = libpff_message_get_utf8_subject(
-		          message,
-		          (uint8_t *) value_string,
-		          value_string_size,
-		          error );
-#endif
-		if( result != 1 )
+		if( libpff_item_get_sub_item(
+		     item,
+		     sub_item_iterator,
+		     &sub_item,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve subject.",
-			 function );
+			 "%s: unable to retrieve sub item: %d.",
+			 function,
+			 sub_item_iterator + 1 );
 
-			goto on_error;
+			return( -1 );
 		}
-		/* Ignore the subject control codes for now
-		 */
-		if( value_string[ 0 ] < 0x20 )
+		if( export_handle_export_item(
+		     export_handle,
+		     sub_item,
+		     sub_item_iterator,
+		     number_of_sub_items,
+		     export_path,
+		     export_path_length,
+		     log_handle,
+		     error ) != 1 )
 		{
-			if( item_file_write_value_string(
-			     item_file,
-			     description,
-			     &( value_string[ 2 ] ),
-			     value_string_size - 3,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write subject.",
-				 function );
+			fprintf(
+			 export_handle->notify_stream,
+			 "Unable to export sub item %d out of %d.\n",
+			 sub_item_iterator + 1,
+			 number_of_sub_items );
 
-				goto on_error;
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to export sub item: %d.\n",
+				 function,
+				 sub_item_iterator + 1 );
 			}
-		}
-		else
-		{
-			if( item_file_write_value_string(
-			     item_file,
-			     description,
-			     value_string,
-			     value_string_size - 1,
-			     error ) != 1 )
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write subject.",
-				 function );
-
-				goto on_error;
+				libcnotify_print_error_backtrace(
+				 *error );
 			}
+			libcerror_error_free(
+			 error );
+
+			log_handle_printf(
+			 log_handle,
+			 "Unable to export sub item: %d.\n",
+			 sub_item_iterator + 1 );
 		}
-		memory_free(
-		 value_string );
+		if( libpff_item_free(
+		     &sub_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub item: %d.",
+			 function,
+			 sub_item_iterator + 1 );
 
-		value_string = NULL;
+			return( -1 );
+		}
 	}
 	return( 1 );
-
-on_error:
-	if( value_string != NULL )
-	{
-		memory_free(
-		 value_string );
-	}
-	return( -1 );
 }
 
-/* Exports the Outlook message header to an item file
+/* Exports the item as a JSON record
+ * The record contains the path of the item directory of a directory export
  * Returns 1 if successful or -1 on error
  */
-int export_handle_export_message_header_to_item_file(
+int export_handle_export_item_json(
      export_handle_t *export_handle,
-     libpff_item_t *message,
-     item_file_t *item_file,
+     libpff_item_t *item,
+     int item_index,
+     const libcstring_system_character_t *item_prefix,
+     size_t item_prefix_length,
+     const libcstring_system_character_t *export_path,
+     size_t export_path_length,
+     log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_export_message_header_to_item_file";
+	libcstring_system_character_t *item_path = NULL;
+	uint8_t *item_path_string                = NULL;
+	static char *function                    = "export_handle_export_item_json";
+	size_t item_path_size                    = 0;
+	size_t item_path_string_size             = 0;
 
 	if( export_handle == NULL )
 	{
@@ -3748,457 +3769,418 @@ int export_handle_export_message_header_to_item_file(
 
 		return( -1 );
 	}
-	if( item_file_write_value_description(
-	     item_file,
-	     _LIBCSTRING_SYSTEM_STRING( "Message:" ),
-	     error ) != 1 )
+	if( export_handle->json_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write string.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing JSON file.",
 		 function );
 
 		return( -1 );
 	}
-	if( item_file_write_item_value(
-	     item_file,
-	     message,
-	     0,
-	     LIBPFF_ENTRY_TYPE_MESSAGE_CLIENT_SUBMIT_TIME,
-	     _LIBCSTRING_SYSTEM_STRING( "Client submit time:\t\t\t" ),
-	     0,
+	if( export_handle_get_default_item_directory_path(
+	     export_handle,
+	     item_index,
+	     item_prefix,
+	     item_prefix_length,
+	     export_path,
+	     export_path_length,
+	     &item_path,
+	     &item_path_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write client submit time.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve item directory path.",
 		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-			libcnotify_print_error_backtrace(
-			 *error );
-		}
-#endif
-		libcerror_error_free(
-		 error );
+		goto on_error;
 	}
-	if( item_file_write_item_value(
-	     item_file,
-	     message,
-	     0,
-	     LIBPFF_ENTRY_TYPE_MESSAGE_DELIVERY_TIME,
-	     _LIBCSTRING_SYSTEM_STRING( "Delivery time:\t\t\t\t" ),
-	     0,
-	     error ) != 1 )
+	if( export_handle->base_path_length >= item_path_size )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write delivery time.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid item directory path size value out of bounds.",
 		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-			libcnotify_print_error_backtrace(
-			 *error );
-		}
-#endif
-		libcerror_error_free(
-		 error );
+		goto on_error;
 	}
-	if( item_file_write_item_value(
-	     item_file,
-	     message,
-	     0,
-	     LIBPFF_ENTRY_TYPE_MESSAGE_CREATION_TIME,
-	     _LIBCSTRING_SYSTEM_STRING( "Creation time:\t\t\t\t" ),
-	     0,
+	if( archive_file_get_entry_name(
+	     &( item_path[ export_handle->base_path_length ] ),
+	     &item_path_string,
+	     &item_path_string_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write creation time.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve item path string.",
 		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-			libcnotify_print_error_backtrace(
-			 *error );
-		}
-#endif
-		libcerror_error_free(
-		 error );
+		goto on_error;
 	}
-	if( item_file_write_item_value(
-	     item_file,
-	     message,
-	     0,
-	     LIBPFF_ENTRY_TYPE_MESSAGE_MODIFICATION_TIME,
-	     _LIBCSTRING_SYSTEM_STRING( "Modification time:\t\t\t" ),
-	     0,
+	if( json_file_start_object(
+	     export_handle->json_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write modification time.",
+		 "%s: unable to write start of object.",
 		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-			libcnotify_print_error_backtrace(
-			 *error );
-		}
-#endif
-		libcerror_error_free(
-		 error );
+		goto on_error;
 	}
-	if( item_file_write_item_value(
-	     item_file,
-	     message,
-	     0,
-	     LIBPFF_ENTRY_TYPE_MESSAGE_SIZE,
-	     _LIBCSTRING_SYSTEM_STRING( "Size:\t\t\t\t\t" ),
-	     0,
+	if( json_file_write_key(
+	     export_handle->json_file,
+	     "path",
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write size.",
+		 "%s: unable to write key.",
 		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-			libcnotify_print_error_backtrace(
-			 *error );
-		}
-#endif
-		libcerror_error_free(
-		 error );
+		goto on_error;
 	}
-	if( export_handle_export_message_flags_to_item_file(
-	     export_handle,
-	     message,
-	     _LIBCSTRING_SYSTEM_STRING( "Flags:\t\t\t\t\t" ),
-	     item_file,
+	if( json_file_write_utf8_string(
+	     export_handle->json_file,
+	     item_path_string,
+	     item_path_string_size - 1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write flags.",
+		 "%s: unable to write item path.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( item_file_write_item_value(
-	     item_file,
-	     message,
-	     0,
-	     LIBPFF_ENTRY_TYPE_DISPLAY_NAME,
-	     _LIBCSTRING_SYSTEM_STRING( "Display name:\t\t\t\t" ),
-	     0,
+	if( export_handle_export_item_values_json(
+	     export_handle,
+	     item,
+	     log_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write display name.",
+		 "%s: unable to export item values.",
 		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-			libcnotify_print_error_backtrace(
-			 *error );
-		}
-#endif
-		libcerror_error_free(
-		 error );
+		goto on_error;
 	}
-	if( item_file_write_item_value(
-	     item_file,
-	     message,
-	     0,
-	     LIBPFF_ENTRY_TYPE_MESSAGE_CONVERSATION_TOPIC,
-	     _LIBCSTRING_SYSTEM_STRING( "Conversation topic:\t\t\t" ),
-	     0,
+	if( json_file_end_object(
+	     export_handle->json_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write conversation topic.",
+		 "%s: unable to write end of object.",
 		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-			libcnotify_print_error_backtrace(
-			 *error );
-		}
-#endif
-		libcerror_error_free(
-		 error );
+		goto on_error;
 	}
-	if( export_handle_export_message_subject_to_item_file(
-	     export_handle,
-	     message,
-	     _LIBCSTRING_SYSTEM_STRING( "Subject:\t\t\t\t" ),
-	     item_file,
+	if( json_file_end_record(
+	     export_handle->json_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write subject.",
+		 "%s: unable to write end of record.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( item_file_write_item_value(
-	     item_file,
-	     message,
-	     0,
-	     LIBPFF_ENTRY_TYPE_MESSAGE_SENDER_NAME,
-	     _LIBCSTRING_SYSTEM_STRING( "Sender name:\t\t\t\t" ),
-	     0,
-	     error ) != 1 )
+	log_handle_printf(
+	 log_handle,
+	 "Exported record: %" PRIs_LIBCSTRING_SYSTEM ".\n",
+	 item_path );
+
+	memory_free(
+	 item_path_string );
+	memory_free(
+	 item_path );
+
+	return( 1 );
+
+on_error:
+	/* A partially written record is discarded to keep the JSON file consistent
+	 */
+	json_file_discard_record(
+	 export_handle->json_file,
+	 NULL );
+
+	if( item_path_string != NULL )
+	{
+		memory_free(
+		 item_path_string );
+	}
+	if( item_path != NULL )
+	{
+		memory_free(
+		 item_path );
+	}
+	return( -1 );
+}
+
+/* Exports the item values as members of the current JSON object
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_item_values_json(
+     export_handle_t *export_handle,
+     libpff_item_t *item,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	char *item_type_string = NULL;
+	static char *function  = "export_handle_export_item_values_json";
+	uint32_t identifier    = 0;
+	uint8_t item_type      = 0;
+
+	if( export_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write sender name.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
 		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-			libcnotify_print_error_backtrace(
-			 *error );
-		}
-#endif
-		libcerror_error_free(
-		 error );
+		return( -1 );
 	}
-	if( item_file_write_item_value(
-	     item_file,
-	     message,
-	     0,
-	     LIBPFF_ENTRY_TYPE_MESSAGE_SENDER_EMAIL_ADDRESS,
-	     _LIBCSTRING_SYSTEM_STRING( "Sender email address:\t\t\t" ),
-	     0,
+	if( libpff_item_get_identifier(
+	     item,
+	     &identifier,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write sender email address.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier.",
 		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-			libcnotify_print_error_backtrace(
-			 *error );
-		}
-#endif
-		libcerror_error_free(
-		 error );
+		return( -1 );
 	}
-	if( item_file_write_item_value(
-	     item_file,
-	     message,
-	     0,
-	     LIBPFF_ENTRY_TYPE_MESSAGE_SENT_REPRESENTING_NAME,
-	     _LIBCSTRING_SYSTEM_STRING( "Sent representing name:\t\t\t" ),
-	     0,
+	if( libpff_item_get_type(
+	     item,
+	     &item_type,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write sent representing name.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve item type.",
 		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-			libcnotify_print_error_backtrace(
-			 *error );
-		}
-#endif
-		libcerror_error_free(
-		 error );
+		return( -1 );
 	}
-	if( item_file_write_item_value(
-	     item_file,
-	     message,
-	     0,
-	     LIBPFF_ENTRY_TYPE_MESSAGE_SENT_REPRESENTING_EMAIL_ADDRESS,
-	     _LIBCSTRING_SYSTEM_STRING( "Sent representing email address:\t" ),
-	     0,
-	     error ) != 1 )
+	switch( item_type )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write sent representing email address.",
-		 function );
+		case LIBPFF_ITEM_TYPE_ACTIVITY:
+			item_type_string = "activity";
+			break;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-			libcnotify_print_error_backtrace(
-			 *error );
-		}
-#endif
-		libcerror_error_free(
-		 error );
+		case LIBPFF_ITEM_TYPE_APPOINTMENT:
+			item_type_string = "appointment";
+			break;
+
+		case LIBPFF_ITEM_TYPE_CONTACT:
+			item_type_string = "contact";
+			break;
+
+		case LIBPFF_ITEM_TYPE_DISTRIBUTION_LIST:
+			item_type_string = "distribution_list";
+			break;
+
+		case LIBPFF_ITEM_TYPE_DOCUMENT:
+			item_type_string = "document";
+			break;
+
+		case LIBPFF_ITEM_TYPE_CONFLICT_MESSAGE:
+		case LIBPFF_ITEM_TYPE_EMAIL:
+		case LIBPFF_ITEM_TYPE_EMAIL_SMIME:
+			item_type_string = "email";
+			break;
+
+		case LIBPFF_ITEM_TYPE_FOLDER:
+			item_type_string = "folder";
+			break;
+
+		case LIBPFF_ITEM_TYPE_MEETING:
+			item_type_string = "meeting";
+			break;
+
+		case LIBPFF_ITEM_TYPE_NOTE:
+			item_type_string = "note";
+			break;
+
+		case LIBPFF_ITEM_TYPE_RSS_FEED:
+			item_type_string = "rss_feed";
+			break;
+
+		case LIBPFF_ITEM_TYPE_TASK:
+			item_type_string = "task";
+			break;
+
+		default:
+			item_type_string = "unknown";
+			break;
 	}
-	if( export_handle_export_message_importance_to_item_file(
-	     export_handle,
-	     message,
-	     _LIBCSTRING_SYSTEM_STRING( "Importance:\t\t\t\t" ),
-	     item_file,
+	if( json_file_write_key(
+	     export_handle->json_file,
+	     "identifier",
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write importance.",
+		 "%s: unable to write key.",
 		 function );
 
 		return( -1 );
 	}
-	if( export_handle_export_message_priority_to_item_file(
+	if( json_file_write_unsigned_integer(
+	     export_handle->json_file,
+	     (uint64_t) identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_file_write_key(
+	     export_handle->json_file,
+	     "type",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write key.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_file_write_string(
+	     export_handle->json_file,
+	     item_type_string,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write item type.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_export_entry_string_json(
 	     export_handle,
-	     message,
-	     _LIBCSTRING_SYSTEM_STRING( "Priority:\t\t\t\t" ),
-	     item_file,
+	     item,
+	     0,
+	     LIBPFF_ENTRY_TYPE_MESSAGE_CLASS,
+	     "message_class",
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to export message class.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_export_message_body_json(
+	     export_handle,
+	     item,
+	     EXPORT_FORMAT_TEXT,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write priority.",
+		 "%s: unable to export plain text body.",
 		 function );
 
 		return( -1 );
 	}
-	if( export_handle_export_message_sensitivity_to_item_file(
+	if( export_handle_export_message_body_json(
 	     export_handle,
-	     message,
-	     _LIBCSTRING_SYSTEM_STRING( "Sensitivity:\t\t\t\t" ),
-	     item_file,
+	     item,
+	     EXPORT_FORMAT_HTML,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write sensitivity.",
+		 "%s: unable to export HTML body.",
 		 function );
 
 		return( -1 );
 	}
-	if( item_file_write_item_value(
-	     item_file,
-	     message,
-	     0,
-	     LIBPFF_ENTRY_TYPE_MESSAGE_IS_REMINDER,
-	     _LIBCSTRING_SYSTEM_STRING( "Is a reminder:\t\t\t\t" ),
-	     0,
+	if( export_handle_export_message_body_json(
+	     export_handle,
+	     item,
+	     EXPORT_FORMAT_RTF,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write is reminder.",
+		 "%s: unable to export RTF body.",
 		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-			libcnotify_print_error_backtrace(
-			 *error );
-		}
-#endif
-		libcerror_error_free(
-		 error );
+		return( -1 );
 	}
-	if( item_file_write_item_value(
-	     item_file,
-	     message,
-	     0,
-	     LIBPFF_ENTRY_TYPE_MESSAGE_REMINDER_TIME,
-	     _LIBCSTRING_SYSTEM_STRING( "Reminder time:\t\t\t\t" ),
-	     0,
+	if( json_file_write_key(
+	     export_handle->json_file,
+	     "properties",
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write reminder time.",
+		 "%s: unable to write key.",
 		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-			libcnotify_print_error_backtrace(
-			 *error );
-		}
-#endif
-		libcerror_error_free(
-		 error );
+		return( -1 );
 	}
-	if( item_file_write_item_value(
-	     item_file,
-	     message,
-	     0,
-	     LIBPFF_ENTRY_TYPE_MESSAGE_REMINDER_SIGNAL_TIME,
-	     _LIBCSTRING_SYSTEM_STRING( "Reminder signal time:\t\t\t" ),
+	if( export_handle_export_item_entries_json(
+	     export_handle,
+	     item,
 	     0,
 	     error ) != 1 )
 	{
@@ -4206,56 +4188,36 @@ int export_handle_export_message_header_to_item_file(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write reminder signal time.",
+		 "%s: unable to export properties.",
 		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-			libcnotify_print_error_backtrace(
-			 *error );
-		}
-#endif
-		libcerror_error_free(
-		 error );
+		return( -1 );
 	}
-	if( item_file_write_item_value(
-	     item_file,
-	     message,
-	     0,
-	     LIBPFF_ENTRY_TYPE_MESSAGE_IS_PRIVATE,
-	     _LIBCSTRING_SYSTEM_STRING( "Is private:\t\t\t\t" ),
-	     0,
+	if( export_handle_export_recipients_json(
+	     export_handle,
+	     item,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write is private.",
+		 "%s: unable to export recipients.",
 		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-			libcnotify_print_error_backtrace(
-			 *error );
-		}
-#endif
-		libcerror_error_free(
-		 error );
+		return( -1 );
 	}
-	if( item_file_write_new_line(
-	     item_file,
+	if( export_handle_export_attachments_json(
+	     export_handle,
+	     item,
+	     log_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write new line.",
+		 "%s: unable to export attachments.",
 		 function );
 
 		return( -1 );
@@ -4263,25 +4225,21 @@ int export_handle_export_message_header_to_item_file(
 	return( 1 );
 }
 
-/* Exports the message body
- * Returns 1 if successful or -1 on error
+/* Exports a specific string entry value as a member of the current JSON object
+ * Returns 1 if successful, 0 if the item does not contain such value or -1 on error
  */
-int export_handle_export_message_body(
+int export_handle_export_entry_string_json(
      export_handle_t *export_handle,
-     libpff_item_t *message,
-     const libcstring_system_character_t *export_path,
-     size_t export_path_length,
-     log_handle_t *log_handle,
+     libpff_item_t *item,
+     int set_index,
+     uint32_t entry_type,
+     const char *key,
      libcerror_error_t **error )
 {
-	static char *function         = "export_handle_export_message_body";
-	size_t message_html_body_size = 0;
-	size_t message_rtf_body_size  = 0;
-	size_t message_text_body_size = 0;
-	int export_format             = 0;
-	int has_html_body             = 0;
-	int has_rtf_body              = 0;
-	int has_text_body             = 0;
+	uint8_t *value_string    = NULL;
+	static char *function    = "export_handle_export_entry_string_json";
+	size_t value_string_size = 0;
+	int result               = 0;
 
 	if( export_handle == NULL )
 	{
@@ -4294,265 +4252,131 @@ int export_handle_export_message_body(
 
 		return( -1 );
 	}
-	/* Determine the available message body types
-	 */
-	has_html_body = libpff_message_get_html_body_size(
-	                 message,
-	                 &message_html_body_size,
-	                 error );
+	result = libpff_item_get_entry_value_utf8_string_size(
+	          item,
+	          set_index,
+	          entry_type,
+	          &value_string_size,
+	          0,
+	          error );
 
-	if( has_html_body == -1 )
+	if( result == -1 )
 	{
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-			libcnotify_print_error_backtrace(
-			 *error );
-		}
-		libcerror_error_free(
-		 error );
-	}
-	has_rtf_body = libpff_message_get_rtf_body_size(
-	                message,
-	                &message_rtf_body_size,
-	                error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry value string size.",
+		 function );
 
-	if( has_rtf_body == -1 )
+		goto on_error;
+	}
+	else if( ( result == 0 )
+	      || ( value_string_size == 0 ) )
 	{
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-			libcnotify_print_error_backtrace(
-			 *error );
-		}
-		libcerror_error_free(
-		 error );
+		return( 0 );
 	}
-	has_text_body = libpff_message_get_plain_text_body_size(
-	                 message,
-	                 &message_text_body_size,
-	                 error );
-
-	if( has_text_body == -1 )
-	{
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
-		{
-			libcnotify_print_error_backtrace(
-			 *error );
-		}
-		libcerror_error_free(
-		 error );
-	}
-	/* Determine the message body export format
-	 */
-	if( export_handle->preferred_export_format == EXPORT_FORMAT_ALL )
-	{
-		export_format = EXPORT_FORMAT_ALL;
-	}
-	if( export_format == 0 )
-	{
-		if( ( has_text_body == 1 )
-		 && ( message_text_body_size > 0 ) )
-		{
-			export_format = EXPORT_FORMAT_TEXT;
-		}
-		if( ( has_html_body == 1 )
-		 && ( message_html_body_size > 0 )
-		 && ( export_handle->preferred_export_format == EXPORT_FORMAT_HTML ) )
-		{
-			export_format = EXPORT_FORMAT_HTML;
-		}
-		if( ( has_rtf_body == 1 )
-		 && ( message_rtf_body_size > 0 )
-		 && ( export_handle->preferred_export_format == EXPORT_FORMAT_RTF ) )
-		{
-			export_format = EXPORT_FORMAT_RTF;
-		}
-	}
-	if( export_format == 0 )
-	{
-		if( ( has_text_body == 1 )
-		 && ( message_text_body_size > 0 ) )
-		{
-			export_format = EXPORT_FORMAT_TEXT;
-		}
-		else if( ( has_html_body == 1 )
-		 && ( message_html_body_size > 0 ) )
-		{
-			export_format = EXPORT_FORMAT_HTML;
-		}
-		else if( ( has_rtf_body == 1 )
-		 && ( message_rtf_body_size > 0 ) )
-		{
-			export_format = EXPORT_FORMAT_RTF;
-		}
-	}
-	if( export_format == 0 )
-	{
-		if( has_text_body == 1 )
-		{
-			export_format = EXPORT_FORMAT_TEXT;
-		}
-		else if( has_html_body == 1 )
-		{
-			export_format = EXPORT_FORMAT_HTML;
-		}
-		else if( has_rtf_body == 1 )
-		{
-			export_format = EXPORT_FORMAT_RTF;
-		}
-	}
-	if( export_format == EXPORT_FORMAT_ALL )
+	if( value_string_size > (size_t) SSIZE_MAX )
 	{
-		if( has_html_body == 1 )
-		{
-			if( export_handle_export_message_body_html(
-			     export_handle,
-			     message,
-			     message_html_body_size,
-			     export_path,
-			     export_path_length,
-			     log_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to export HTML message body.",
-				 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry value string size value out of bounds.",
+		 function );
 
-				return( -1 );
-			}
-		}
-		if( has_rtf_body == 1 )
-		{
-			if( export_handle_export_message_body_rtf(
-			     export_handle,
-			     message,
-			     message_rtf_body_size,
-			     export_path,
-			     export_path_length,
-			     log_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to export RTF message body.",
-				 function );
+		goto on_error;
+	}
+	value_string = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * value_string_size );
 
-				return( -1 );
-			}
-		}
-		if( has_text_body == 1 )
-		{
-			if( export_handle_export_message_body_plain_text(
-			     export_handle,
-			     message,
-			     message_text_body_size,
-			     export_path,
-			     export_path_length,
-			     log_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to export plain text message body.",
-				 function );
+	if( value_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry value string.",
+		 function );
 
-				return( -1 );
-			}
-		}
+		goto on_error;
 	}
-	else if( export_format == EXPORT_FORMAT_HTML )
+	if( libpff_item_get_entry_value_utf8_string(
+	     item,
+	     set_index,
+	     entry_type,
+	     value_string,
+	     value_string_size,
+	     0,
+	     error ) != 1 )
 	{
-		if( export_handle_export_message_body_html(
-		     export_handle,
-		     message,
-		     message_html_body_size,
-		     export_path,
-		     export_path_length,
-		     log_handle,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to export HTML message body.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry value string.",
+		 function );
 
-			return( -1 );
-		}
+		goto on_error;
 	}
-	else if( export_format == EXPORT_FORMAT_RTF )
+	if( json_file_write_key(
+	     export_handle->json_file,
+	     key,
+	     error ) != 1 )
 	{
-		if( export_handle_export_message_body_rtf(
-		     export_handle,
-		     message,
-		     message_rtf_body_size,
-		     export_path,
-		     export_path_length,
-		     log_handle,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to export RTF message body.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write key.",
+		 function );
 
-			return( -1 );
-		}
+		goto on_error;
 	}
-	else if( export_format == EXPORT_FORMAT_TEXT )
+	if( json_file_write_utf8_string(
+	     export_handle->json_file,
+	     value_string,
+	     value_string_size - 1,
+	     error ) != 1 )
 	{
-		if( export_handle_export_message_body_plain_text(
-		     export_handle,
-		     message,
-		     message_text_body_size,
-		     export_path,
-		     export_path_length,
-		     log_handle,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to export plain text message body.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write entry value string.",
+		 function );
 
-			return( -1 );
-		}
+		goto on_error;
 	}
+	memory_free(
+	 value_string );
+
 	return( 1 );
+
+on_error:
+	if( value_string != NULL )
+	{
+		memory_free(
+		 value_string );
+	}
+	return( -1 );
 }
 
-/* Exports the HTML message body
+/* Exports a message body as a member of the current JSON object
+ * The body format is one of the text, HTML or RTF export formats
  * Returns 1 if successful or -1 on error
  */
-int export_handle_export_message_body_html(
+int export_handle_export_message_body_json(
      export_handle_t *export_handle,
      libpff_item_t *message,
-     size_t message_html_body_size,
-     const libcstring_system_character_t *export_path,
-     size_t export_path_length,
-     log_handle_t *log_handle,
+     int body_format,
      libcerror_error_t **error )
 {
-	libcstring_system_character_t filename[ 13 ];
-
-	item_file_t *item_file = NULL;
-	static char *function  = "export_handle_export_message_body_html";
-	size_t filename_size   = 0;
-	int result             = 0;
+	uint8_t *message_body    = NULL;
+	char *key                = NULL;
+	static char *function    = "export_handle_export_message_body_json";
+	size_t message_body_size = 0;
+	int result               = 0;
 
 	if( export_handle == NULL )
 	{
@@ -4565,123 +4389,182 @@ int export_handle_export_message_body_html(
 
 		return( -1 );
 	}
-	if( libcstring_system_string_copy(
-	     filename,
-	     _LIBCSTRING_SYSTEM_STRING( "Message.html" ),
-	     12 ) == NULL )
+	switch( body_format )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to set filename.",
-		 function );
+		case EXPORT_FORMAT_HTML:
+			key    = "body_html";
+			result = libpff_message_get_html_body_size(
+			          message,
+			          &message_body_size,
+			          error );
+			break;
 
-		goto on_error;
-	}
-	filename[ 12 ] = 0;
-	filename_size  = 13;
+		case EXPORT_FORMAT_RTF:
+			key    = "body_rtf";
+			result = libpff_message_get_rtf_body_size(
+			          message,
+			          &message_body_size,
+			          error );
+			break;
 
-	log_handle_printf(
-	 log_handle,
-	 "Saving HTML message body as: %" PRIs_LIBCSTRING_SYSTEM "\n",
-	 filename );
+		case EXPORT_FORMAT_TEXT:
+			key    = "body_plain_text";
+			result = libpff_message_get_plain_text_body_size(
+			          message,
+			          &message_body_size,
+			          error );
+			break;
 
-	result = export_handle_create_item_file(
-	          export_handle,
-	          export_path,
-	          export_path_length,
-	          filename,
-	          filename_size - 1,
-	          &item_file,
-	          error );
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported body format.",
+			 function );
 
+			return( -1 );
+	}
 	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create item file.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve message body size.",
 		 function );
 
 		goto on_error;
 	}
-	else if( result == 0 )
+	else if( ( result == 0 )
+	      || ( message_body_size == 0 ) )
 	{
-		log_handle_printf(
-		 log_handle,
-		 "Skipping message body file: %" PRIs_LIBCSTRING_SYSTEM " it already exists.",
-		 filename );
-
 		return( 1 );
 	}
-	if( export_handle_export_message_body_html_to_item_file(
-	     export_handle,
-	     message,
-	     message_html_body_size,
-	     item_file,
-	     error ) != 1 )
+	if( message_body_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to export HTML message body.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid message body size value out of bounds.",
 		 function );
 
 		goto on_error;
 	}
-	if( item_file_close(
-	     item_file,
-	     error ) != 0 )
+	message_body = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * message_body_size );
+
+	if( message_body == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create message body.",
+		 function );
+
+		goto on_error;
+	}
+	switch( body_format )
+	{
+		case EXPORT_FORMAT_HTML:
+			result = libpff_message_get_html_body(
+			          message,
+			          message_body,
+			          message_body_size,
+			          error );
+			break;
+
+		case EXPORT_FORMAT_RTF:
+			result = libpff_message_get_rtf_body(
+			          message,
+			          message_body,
+			          message_body_size,
+			          error );
+			break;
+
+		case EXPORT_FORMAT_TEXT:
+			result = libpff_message_get_plain_text_body(
+			          message,
+			          message_body,
+			          message_body_size,
+			          error );
+			break;
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve message body.",
+		 function );
+
+		goto on_error;
+	}
+	/* The end of string characters are not part of the body
+	 */
+	while( ( message_body_size > 0 )
+	    && ( message_body[ message_body_size - 1 ] == 0 ) )
+	{
+		message_body_size--;
+	}
+	if( json_file_write_key(
+	     export_handle->json_file,
+	     key,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-		 "%s: unable to close item file.",
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write key.",
 		 function );
 
 		goto on_error;
 	}
-	if( item_file_free(
-	     &item_file,
+	if( json_file_write_utf8_string(
+	     export_handle->json_file,
+	     message_body,
+	     message_body_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free item file.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write message body.",
 		 function );
 
 		goto on_error;
 	}
+	memory_free(
+	 message_body );
+
 	return( 1 );
 
 on_error:
-	if( item_file != NULL )
+	if( message_body != NULL )
 	{
-		item_file_free(
-		 &item_file,
-		 NULL );
+		memory_free(
+		 message_body );
 	}
 	return( -1 );
 }
 
-/* Exports the HTML message body to an item file
+/* Exports the entries of a specific item set as a JSON array
  * Returns 1 if successful or -1 on error
  */
-int export_handle_export_message_body_html_to_item_file(
+int export_handle_export_item_entries_json(
      export_handle_t *export_handle,
-     libpff_item_t *message,
-     size_t message_html_body_size,
-     item_file_t *item_file,
+     libpff_item_t *item,
+     int set_index,
      libcerror_error_t **error )
 {
-	uint8_t *value_string = NULL;
-	static char *function = "export_handle_export_message_body_html_to_item_file";
+	static char *function      = "export_handle_export_item_entries_json";
+	uint32_t entry_index       = 0;
+	uint32_t number_of_entries = 0;
 
 	if( export_handle == NULL )
 	{
@@ -4694,99 +4577,100 @@ int export_handle_export_message_body_html_to_item_file(
 
 		return( -1 );
 	}
-	if( message_html_body_size > (size_t) SSIZE_MAX )
+	if( libpff_item_get_number_of_entries(
+	     item,
+	     &number_of_entries,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid message HTML body size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
 		 function );
 
 		return( -1 );
 	}
-	if( message_html_body_size > 0 )
+	if( json_file_start_array(
+	     export_handle->json_file,
+	     error ) != 1 )
 	{
-		value_string = (uint8_t *) memory_allocate(
-		                            sizeof( uint8_t ) * message_html_body_size );
-
-		if( value_string == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create HTML body.",
-			 function );
-
-			goto on_error;
-		}
-		if( libpff_message_get_html_body(
-		     message,
-		     value_string,
-		     message_html_body_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve HTML body.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write start of array.",
+		 function );
 
-			goto on_error;
-		}
-		/* Do not write the end-of-string byte
-		 */
-		if( item_file_write_buffer(
-		     item_file,
-		     value_string,
-		     message_html_body_size - 1,
-		     error ) != 1 )
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( export_handle_export_item_value_json(
+		     export_handle,
+		     item,
+		     set_index,
+		     (int) entry_index,
+		     error ) == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write HTML body.",
-			 function );
+			 "%s: unable to export value of set: %d entry: %" PRIu32 ".",
+			 function,
+			 set_index,
+			 entry_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		memory_free(
-		 value_string );
-
-		value_string = NULL;
 	}
-	return( 1 );
-
-on_error:
-	if( value_string != NULL )
+	if( json_file_end_array(
+	     export_handle->json_file,
+	     error ) != 1 )
 	{
-		memory_free(
-		 value_string );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write end of array.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Exports the RTF message body
- * Returns 1 if successful or -1 on error
+/* Exports a specific item value as a JSON object
+ * The message bodies and attachment data are not exported as item values
+ * Returns 1 if successful, 0 if the item value is not exported or -1 on error
  */
-int export_handle_export_message_body_rtf(
+int export_handle_export_item_value_json(
      export_handle_t *export_handle,
-     libpff_item_t *message,
-     size_t message_rtf_body_size,
-     const libcstring_system_character_t *export_path,
-     size_t export_path_length,
-     log_handle_t *log_handle,
+     libpff_item_t *item,
+     int set_index,
+     int entry_index,
      libcerror_error_t **error )
 {
-	libcstring_system_character_t filename[ 12 ];
-
-	item_file_t *item_file = NULL;
-	static char *function  = "export_handle_export_message_body_rtf";
-	size_t filename_size   = 0;
-	int result             = 0;
+	byte_stream_float32_t value_float32;
+	byte_stream_float64_t value_float64;
+
+	libpff_name_to_id_map_entry_t *name_to_id_map_entry = NULL;
+	uint8_t *value_data                                 = NULL;
+	uint8_t *value_string                               = NULL;
+	static char *function                               = "export_handle_export_item_value_json";
+	size_t value_data_size                              = 0;
+	size_t value_string_size                            = 0;
+	uint64_t value_64bit                                = 0;
+	uint32_t entry_type                                 = 0;
+	uint32_t name_to_id_map_entry_number                = 0;
+	uint32_t value_32bit                                = 0;
+	uint32_t value_type                                 = LIBPFF_VALUE_TYPE_UNSPECIFIED;
+	uint16_t value_16bit                                = 0;
+	uint8_t name_to_id_map_entry_type                   = 0;
+	int result                                          = 0;
 
 	if( export_handle == NULL )
 	{
@@ -4799,295 +4683,4942 @@ int export_handle_export_message_body_rtf(
 
 		return( -1 );
 	}
-	if( libcstring_system_string_copy(
-	     filename,
-	     _LIBCSTRING_SYSTEM_STRING( "Message.rtf" ),
-	     11 ) == NULL )
+	if( libpff_item_get_entry_type(
+	     item,
+	     set_index,
+	     entry_index,
+	     &entry_type,
+	     &value_type,
+	     &name_to_id_map_entry,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to set RTF message body filename.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry type of set: %d entry: %d.",
+		 function,
+		 set_index,
+		 entry_index );
 
 		goto on_error;
 	}
-	filename[ 11 ] = 0;
-	filename_size  = 12;
-
-	log_handle_printf(
-	 log_handle,
-	 "Saving RTF message body as: %" PRIs_LIBCSTRING_SYSTEM "\n",
-	 filename );
-
-	result = export_handle_create_item_file(
-	          export_handle,
-	          export_path,
-	          export_path_length,
-	          filename,
-	          filename_size - 1,
-	          &item_file,
-	          error );
+	if( ( entry_type == LIBPFF_ENTRY_TYPE_MESSAGE_BODY_PLAIN_TEXT )
+	 || ( entry_type == LIBPFF_ENTRY_TYPE_MESSAGE_BODY_COMPRESSED_RTF )
+	 || ( entry_type == LIBPFF_ENTRY_TYPE_MESSAGE_BODY_HTML )
+	 || ( entry_type == LIBPFF_ENTRY_TYPE_ATTACHMENT_DATA_OBJECT ) )
+	{
+		return( 0 );
+	}
+	result = libpff_item_get_entry_value(
+		  item,
+		  set_index,
+		  entry_type,
+		  &value_type,
+		  &value_data,
+		  &value_data_size,
+		  LIBPFF_ENTRY_VALUE_FLAG_MATCH_ANY_VALUE_TYPE | LIBPFF_ENTRY_VALUE_FLAG_IGNORE_NAME_TO_ID_MAP,
+		  error );
 
 	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create item file.",
-		 function );
-
-		goto on_error;
-	}
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry value of set: %d entry: %d.",
+		 function,
+		 set_index,
+		 entry_index );
+
+		goto on_error;
+	}
 	else if( result == 0 )
 	{
-		log_handle_printf(
-		 log_handle,
-		 "Skipping message body file: %" PRIs_LIBCSTRING_SYSTEM " it already exists.",
-		 filename );
-
-		return( 1 );
+		return( 0 );
 	}
-	if( export_handle_export_message_body_rtf_to_item_file(
-	     export_handle,
-	     message,
-	     message_rtf_body_size,
-	     item_file,
+	if( json_file_start_object(
+	     export_handle->json_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to export RTF message body.",
+		 "%s: unable to write start of object.",
 		 function );
 
 		goto on_error;
 	}
-	if( item_file_close(
-	     item_file,
-	     error ) != 0 )
+	if( json_file_write_key(
+	     export_handle->json_file,
+	     "entry_type",
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-		 "%s: unable to close item file.",
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write key.",
 		 function );
 
 		goto on_error;
 	}
-	if( item_file_free(
-	     &item_file,
+	if( json_file_write_unsigned_integer(
+	     export_handle->json_file,
+	     (uint64_t) entry_type,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free item file.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write entry type.",
 		 function );
 
 		goto on_error;
 	}
-	return( 1 );
-
-on_error:
-	if( item_file != NULL )
-	{
-		item_file_free(
-		 &item_file,
-		 NULL );
-	}
-	return( -1 );
-}
-
-/* Exports the RTF message body to an item file
- * Returns 1 if successful or -1 on error
- */
-int export_handle_export_message_body_rtf_to_item_file(
-     export_handle_t *export_handle,
-     libpff_item_t *message,
-     size_t message_rtf_body_size,
-     item_file_t *item_file,
-     libcerror_error_t **error )
-{
-	uint8_t *value_string = NULL;
-	static char *function = "export_handle_export_message_body_rtf_to_item_file";
-
-	if( export_handle == NULL )
+	if( json_file_write_key(
+	     export_handle->json_file,
+	     "value_type",
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export handle.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write key.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( message_rtf_body_size > (size_t) SSIZE_MAX )
+	if( json_file_write_unsigned_integer(
+	     export_handle->json_file,
+	     (uint64_t) value_type,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid message RTF body size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write value type.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( message_rtf_body_size > 0 )
+	if( name_to_id_map_entry != NULL )
 	{
-		value_string = (uint8_t *) memory_allocate(
-					    sizeof( uint8_t ) * message_rtf_body_size );
-
-		if( value_string == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create RTF body.",
-			 function );
-
-			goto on_error;
-		}
-		if( libpff_message_get_rtf_body(
-		     message,
-		     value_string,
-		     message_rtf_body_size,
+		if( libpff_name_to_id_map_entry_get_type(
+		     name_to_id_map_entry,
+		     &name_to_id_map_entry_type,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve RTF body.",
-			 function );
+			 "%s: unable to retrieve name to identifier map entry type of set: %d entry: %d.",
+			 function,
+			 set_index,
+			 entry_index );
 
 			goto on_error;
 		}
-		/* Do not write the end of string byte
-		 */
-		if( item_file_write_buffer(
-		     item_file,
-		     value_string,
-		     message_rtf_body_size - 1,
-		     error ) != 1 )
+		if( name_to_id_map_entry_type == LIBPFF_NAME_TO_ID_MAP_ENTRY_TYPE_NUMERIC )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write RTF body.",
-			 function );
+			if( libpff_name_to_id_map_entry_get_number(
+			     name_to_id_map_entry,
+			     &name_to_id_map_entry_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve name to identifier map entry number of set: %d entry: %d.",
+				 function,
+				 set_index,
+				 entry_index );
 
-			goto on_error;
+				goto on_error;
+			}
+			if( json_file_write_key(
+			     export_handle->json_file,
+			     "maps_to_entry_type",
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write key.",
+				 function );
+
+				goto on_error;
+			}
+			if( json_file_write_unsigned_integer(
+			     export_handle->json_file,
+			     (uint64_t) name_to_id_map_entry_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write name to identifier map entry number.",
+				 function );
+
+				goto on_error;
+			}
 		}
-		memory_free(
-		 value_string );
+		else if( name_to_id_map_entry_type == LIBPFF_NAME_TO_ID_MAP_ENTRY_TYPE_STRING )
+		{
+			if( libpff_name_to_id_map_entry_get_utf8_string_size(
+			     name_to_id_map_entry,
+			     &value_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve name to identifier map entry string size of set: %d entry: %d.",
+				 function,
+				 set_index,
+				 entry_index );
 
-		value_string = NULL;
-	}
-	return( 1 );
+				goto on_error;
+			}
+			if( ( value_string_size == 0 )
+			 || ( value_string_size > (size_t) SSIZE_MAX ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid name to identifier map entry string size value out of bounds.",
+				 function );
 
-on_error:
-	if( value_string != NULL )
-	{
-		memory_free(
-		 value_string );
-	}
-	return( -1 );
-}
+				goto on_error;
+			}
+			value_string = (uint8_t *) memory_allocate(
+			                            sizeof( uint8_t ) * value_string_size );
 
-/* Exports the plain text message body
- * Returns 1 if successful or -1 on error
- */
-int export_handle_export_message_body_plain_text(
-     export_handle_t *export_handle,
-     libpff_item_t *message,
-     size_t plain_text_body_size,
-     const libcstring_system_character_t *export_path,
-     size_t export_path_length,
-     log_handle_t *log_handle,
-     libcerror_error_t **error )
-{
-	libcstring_system_character_t filename[ 12 ];
+			if( value_string == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create name to identifier map entry string.",
+				 function );
 
-	item_file_t *item_file = NULL;
-	static char *function  = "export_handle_export_message_body_plain_text";
-	size_t filename_size   = 0;
-	int result             = 0;
+				goto on_error;
+			}
+			if( libpff_name_to_id_map_entry_get_utf8_string(
+			     name_to_id_map_entry,
+			     value_string,
+			     value_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve name to identifier map entry string of set: %d entry: %d.",
+				 function,
+				 set_index,
+				 entry_index );
 
-	if( export_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export handle.",
-		 function );
+				goto on_error;
+			}
+			if( json_file_write_key(
+			     export_handle->json_file,
+			     "maps_to_entry",
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write key.",
+				 function );
 
-		return( -1 );
+				goto on_error;
+			}
+			if( json_file_write_utf8_string(
+			     export_handle->json_file,
+			     value_string,
+			     value_string_size - 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write name to identifier map entry string.",
+				 function );
+
+				goto on_error;
+			}
+			memory_free(
+			 value_string );
+
+			value_string = NULL;
+		}
 	}
-	if( libcstring_system_string_copy(
-	     filename,
-	     _LIBCSTRING_SYSTEM_STRING( "Message.txt" ),
-	     11 ) == NULL )
+	/* Values that can be represented as JSON values are stored in value
+	 * other values are stored as hexadecimal data
+	 */
+	result = 0;
+
+	switch( value_type )
+	{
+		case LIBPFF_VALUE_TYPE_NULL:
+			result = 1;
+			break;
+
+		case LIBPFF_VALUE_TYPE_BOOLEAN:
+			result = ( value_data_size >= 1 );
+			break;
+
+		case LIBPFF_VALUE_TYPE_INTEGER_16BIT_SIGNED:
+			result = ( value_data_size == 2 );
+			break;
+
+		case LIBPFF_VALUE_TYPE_INTEGER_32BIT_SIGNED:
+		case LIBPFF_VALUE_TYPE_FLOAT_32BIT:
+			result = ( value_data_size == 4 );
+			break;
+
+		case LIBPFF_VALUE_TYPE_DOUBLE_64BIT:
+		case LIBPFF_VALUE_TYPE_CURRENCY:
+		case LIBPFF_VALUE_TYPE_APPLICATION_TIME:
+		case LIBPFF_VALUE_TYPE_INTEGER_64BIT_SIGNED:
+		case LIBPFF_VALUE_TYPE_FILETIME:
+			result = ( value_data_size == 8 );
+			break;
+
+		case LIBPFF_VALUE_TYPE_GUID:
+			result = ( value_data_size == 16 );
+			break;
+
+		case LIBPFF_VALUE_TYPE_STRING_ASCII:
+		case LIBPFF_VALUE_TYPE_STRING_UNICODE:
+			result = libpff_item_get_entry_value_utf8_string_size(
+			          item,
+			          set_index,
+			          entry_type,
+			          &value_string_size,
+			          LIBPFF_ENTRY_VALUE_FLAG_IGNORE_NAME_TO_ID_MAP,
+			          NULL );
+
+			if( ( result == 1 )
+			 && ( ( value_string_size == 0 )
+			  ||  ( value_string_size > (size_t) SSIZE_MAX ) ) )
+			{
+				result = 0;
+			}
+			if( result == 1 )
+			{
+				value_string = (uint8_t *) memory_allocate(
+				                            sizeof( uint8_t ) * value_string_size );
+
+				if( value_string == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create entry value string.",
+					 function );
+
+					goto on_error;
+				}
+				/* A string that cannot be converted is stored as hexadecimal data
+				 */
+				result = libpff_item_get_entry_value_utf8_string(
+				          item,
+				          set_index,
+				          entry_type,
+				          value_string,
+				          value_string_size,
+				          LIBPFF_ENTRY_VALUE_FLAG_IGNORE_NAME_TO_ID_MAP,
+				          NULL );
+			}
+			if( result != 1 )
+			{
+				result = 0;
+			}
+			break;
+
+		default:
+			break;
+	}
+	if( json_file_write_key(
+	     export_handle->json_file,
+	     ( result != 0 ) ? "value" : "data",
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to set plain text message body filename.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write key.",
 		 function );
 
 		goto on_error;
 	}
-	filename[ 11 ] = 0;
-	filename_size  = 12;
+	if( result == 0 )
+	{
+		result = json_file_write_data_as_hexadecimal(
+		          export_handle->json_file,
+		          value_data,
+		          value_data_size,
+		          error );
+	}
+	else switch( value_type )
+	{
+		case LIBPFF_VALUE_TYPE_NULL:
+			result = json_file_write_null(
+			          export_handle->json_file,
+			          error );
+			break;
 
-	log_handle_printf(
-	 log_handle,
-	 "Saving plain text message body as: %" PRIs_LIBCSTRING_SYSTEM "\n",
-	 filename );
+		case LIBPFF_VALUE_TYPE_BOOLEAN:
+			result = json_file_write_boolean(
+			          export_handle->json_file,
+			          value_data[ 0 ],
+			          error );
+			break;
 
-	result = export_handle_create_item_file(
-	          export_handle,
-	          export_path,
-	          export_path_length,
-	          filename,
-	          filename_size - 1,
-	          &item_file,
+		case LIBPFF_VALUE_TYPE_INTEGER_16BIT_SIGNED:
+			byte_stream_copy_to_uint16_little_endian(
+			 value_data,
+			 value_16bit );
+
+			result = json_file_write_signed_integer(
+			          export_handle->json_file,
+			          (int64_t) ( (int16_t) value_16bit ),
+			          error );
+			break;
+
+		case LIBPFF_VALUE_TYPE_INTEGER_32BIT_SIGNED:
+			byte_stream_copy_to_uint32_little_endian(
+			 value_data,
+			 value_32bit );
+
+			result = json_file_write_signed_integer(
+			          export_handle->json_file,
+			          (int64_t) ( (int32_t) value_32bit ),
+			          error );
+			break;
+
+		case LIBPFF_VALUE_TYPE_CURRENCY:
+		case LIBPFF_VALUE_TYPE_INTEGER_64BIT_SIGNED:
+			byte_stream_copy_to_uint64_little_endian(
+			 value_data,
+			 value_64bit );
+
+			result = json_file_write_signed_integer(
+			          export_handle->json_file,
+			          (int64_t) value_64bit,
+			          error );
+			break;
+
+		case LIBPFF_VALUE_TYPE_FLOAT_32BIT:
+			byte_stream_copy_to_uint32_little_endian(
+			 value_data,
+			 value_float32.integer );
+
+			result = json_file_write_floating_point(
+			          export_handle->json_file,
+			          (double) value_float32.floating_point,
+			          error );
+			break;
+
+		case LIBPFF_VALUE_TYPE_DOUBLE_64BIT:
+		case LIBPFF_VALUE_TYPE_APPLICATION_TIME:
+			byte_stream_copy_to_uint64_little_endian(
+			 value_data,
+			 value_float64.integer );
+
+			result = json_file_write_floating_point(
+			          export_handle->json_file,
+			          value_float64.floating_point,
+			          error );
+			break;
+
+		case LIBPFF_VALUE_TYPE_FILETIME:
+			byte_stream_copy_to_uint64_little_endian(
+			 value_data,
+			 value_64bit );
+
+			result = json_file_write_filetime(
+			          export_handle->json_file,
+			          value_64bit,
+			          error );
+			break;
+
+		case LIBPFF_VALUE_TYPE_GUID:
+			result = json_file_write_guid(
+			          export_handle->json_file,
+			          value_data,
+			          value_data_size,
+			          error );
+			break;
+
+		case LIBPFF_VALUE_TYPE_STRING_ASCII:
+		case LIBPFF_VALUE_TYPE_STRING_UNICODE:
+			result = json_file_write_utf8_string(
+			          export_handle->json_file,
+			          value_string,
+			          value_string_size - 1,
+			          error );
+			break;
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write value.",
+		 function );
+
+		goto on_error;
+	}
+	if( value_string != NULL )
+	{
+		memory_free(
+		 value_string );
+
+		value_string = NULL;
+	}
+	if( json_file_end_object(
+	     export_handle->json_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write end of object.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( value_string != NULL )
+	{
+		memory_free(
+		 value_string );
+	}
+	return( -1 );
+}
+
+/* Exports the recipients as a member of the current JSON object
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_recipients_json(
+     export_handle_t *export_handle,
+     libpff_item_t *item,
+     libcerror_error_t **error )
+{
+	libpff_item_t *recipients   = NULL;
+	char *recipient_type_string = NULL;
+	static char *function       = "export_handle_export_recipients_json";
+	uint32_t number_of_sets     = 0;
+	uint32_t recipient_type     = 0;
+	uint32_t set_index          = 0;
+	int result                  = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libpff_message_get_recipients(
+	          item,
+	          &recipients,
 	          error );
 
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create message body file.",
-		 function );
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve recipients.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	if( libpff_item_get_number_of_sets(
+	     recipients,
+	     &number_of_sets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of recipients.",
+		 function );
+
+		goto on_error;
+	}
+	if( json_file_write_key(
+	     export_handle->json_file,
+	     "recipients",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write key.",
+		 function );
+
+		goto on_error;
+	}
+	if( json_file_start_array(
+	     export_handle->json_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write start of array.",
+		 function );
+
+		goto on_error;
+	}
+	for( set_index = 0;
+	     set_index < number_of_sets;
+	     set_index++ )
+	{
+		if( json_file_start_object(
+		     export_handle->json_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write start of object.",
+			 function );
+
+			goto on_error;
+		}
+		if( export_handle_export_entry_string_json(
+		     export_handle,
+		     recipients,
+		     (int) set_index,
+		     LIBPFF_ENTRY_TYPE_DISPLAY_NAME,
+		     "display_name",
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to export display name of recipient: %" PRIu32 ".",
+			 function,
+			 set_index );
+
+			goto on_error;
+		}
+		if( export_handle_export_entry_string_json(
+		     export_handle,
+		     recipients,
+		     (int) set_index,
+		     LIBPFF_ENTRY_TYPE_EMAIL_ADDRESS,
+		     "email_address",
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to export email address of recipient: %" PRIu32 ".",
+			 function,
+			 set_index );
+
+			goto on_error;
+		}
+		if( export_handle_export_entry_string_json(
+		     export_handle,
+		     recipients,
+		     (int) set_index,
+		     LIBPFF_ENTRY_TYPE_ADDRESS_TYPE,
+		     "address_type",
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to export address type of recipient: %" PRIu32 ".",
+			 function,
+			 set_index );
+
+			goto on_error;
+		}
+		result = libpff_recipients_get_type(
+		          recipients,
+		          (int) set_index,
+		          &recipient_type,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve type of recipient: %" PRIu32 ".",
+			 function,
+			 set_index );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			switch( recipient_type )
+			{
+				case LIBPFF_RECIPIENT_TYPE_ORIGINATOR:
+					recipient_type_string = "originator";
+					break;
+
+				case LIBPFF_RECIPIENT_TYPE_TO:
+					recipient_type_string = "to";
+					break;
+
+				case LIBPFF_RECIPIENT_TYPE_CC:
+					recipient_type_string = "cc";
+					break;
+
+				case LIBPFF_RECIPIENT_TYPE_BCC:
+					recipient_type_string = "bcc";
+					break;
+
+				default:
+					recipient_type_string = "unknown";
+					break;
+			}
+			if( json_file_write_key(
+			     export_handle->json_file,
+			     "recipient_type",
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write key.",
+				 function );
+
+				goto on_error;
+			}
+			if( json_file_write_string(
+			     export_handle->json_file,
+			     recipient_type_string,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write recipient type.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( json_file_write_key(
+		     export_handle->json_file,
+		     "properties",
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write key.",
+			 function );
+
+			goto on_error;
+		}
+		if( export_handle_export_item_entries_json(
+		     export_handle,
+		     recipients,
+		     (int) set_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to export properties of recipient: %" PRIu32 ".",
+			 function,
+			 set_index );
+
+			goto on_error;
+		}
+		if( json_file_end_object(
+		     export_handle->json_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write end of object.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( json_file_end_array(
+	     export_handle->json_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write end of array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libpff_item_free(
+	     &recipients,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free recipients.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( recipients != NULL )
+	{
+		libpff_item_free(
+		 &recipients,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports the attachments as a member of the current JSON object
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_attachments_json(
+     export_handle_t *export_handle,
+     libpff_item_t *item,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libpff_item_t *attached_item = NULL;
+	libpff_item_t *attachment    = NULL;
+	char *attachment_type_string = NULL;
+	static char *function        = "export_handle_export_attachments_json";
+	int attachment_index         = 0;
+	int attachment_type          = 0;
+	int number_of_attachments    = 0;
+	int result                   = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_message_get_number_of_attachments(
+	     item,
+	     &number_of_attachments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of attachments.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_attachments <= 0 )
+	{
+		return( 1 );
+	}
+	if( json_file_write_key(
+	     export_handle->json_file,
+	     "attachments",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write key.",
+		 function );
+
+		goto on_error;
+	}
+	if( json_file_start_array(
+	     export_handle->json_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write start of array.",
+		 function );
+
+		goto on_error;
+	}
+	for( attachment_index = 0;
+	     attachment_index < number_of_attachments;
+	     attachment_index++ )
+	{
+		if( export_handle->abort != 0 )
+		{
+			goto on_error;
+		}
+		if( libpff_message_get_attachment(
+		     item,
+		     attachment_index,
+		     &attachment,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attachment: %d.",
+			 function,
+			 attachment_index );
+
+			goto on_error;
+		}
+		if( libpff_attachment_get_type(
+		     attachment,
+		     &attachment_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve type of attachment: %d.",
+			 function,
+			 attachment_index );
+
+			goto on_error;
+		}
+		switch( attachment_type )
+		{
+			case LIBPFF_ATTACHMENT_TYPE_DATA:
+				attachment_type_string = "data";
+				break;
+
+			case LIBPFF_ATTACHMENT_TYPE_ITEM:
+				attachment_type_string = "item";
+				break;
+
+			case LIBPFF_ATTACHMENT_TYPE_REFERENCE:
+				attachment_type_string = "reference";
+				break;
+
+			default:
+				attachment_type_string = "unknown";
+				break;
+		}
+		if( json_file_start_object(
+		     export_handle->json_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write start of object.",
+			 function );
+
+			goto on_error;
+		}
+		if( json_file_write_key(
+		     export_handle->json_file,
+		     "index",
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write key.",
+			 function );
+
+			goto on_error;
+		}
+		if( json_file_write_unsigned_integer(
+		     export_handle->json_file,
+		     (uint64_t) attachment_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write attachment index.",
+			 function );
+
+			goto on_error;
+		}
+		if( json_file_write_key(
+		     export_handle->json_file,
+		     "type",
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write key.",
+			 function );
+
+			goto on_error;
+		}
+		if( json_file_write_string(
+		     export_handle->json_file,
+		     attachment_type_string,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write attachment type.",
+			 function );
+
+			goto on_error;
+		}
+		if( export_handle_export_entry_string_json(
+		     export_handle,
+		     attachment,
+		     0,
+		     LIBPFF_ENTRY_TYPE_ATTACHMENT_FILENAME_LONG,
+		     "filename",
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to export filename of attachment: %d.",
+			 function,
+			 attachment_index );
+
+			goto on_error;
+		}
+		if( attachment_type == LIBPFF_ATTACHMENT_TYPE_DATA )
+		{
+			if( export_handle_export_attachment_data_json(
+			     export_handle,
+			     attachment,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to export data of attachment: %d.",
+				 function,
+				 attachment_index );
+
+				goto on_error;
+			}
+		}
+		else if( attachment_type == LIBPFF_ATTACHMENT_TYPE_ITEM )
+		{
+			result = libpff_attachment_get_item(
+			          attachment,
+			          &attached_item,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve item of attachment: %d.",
+				 function,
+				 attachment_index );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				if( json_file_write_key(
+				     export_handle->json_file,
+				     "item",
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write key.",
+					 function );
+
+					goto on_error;
+				}
+				if( json_file_start_object(
+				     export_handle->json_file,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write start of object.",
+					 function );
+
+					goto on_error;
+				}
+				if( export_handle_export_item_values_json(
+				     export_handle,
+				     attached_item,
+				     log_handle,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to export item of attachment: %d.",
+					 function,
+					 attachment_index );
+
+					goto on_error;
+				}
+				if( json_file_end_object(
+				     export_handle->json_file,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write end of object.",
+					 function );
+
+					goto on_error;
+				}
+				if( libpff_item_free(
+				     &attached_item,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free attached item.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+		if( json_file_write_key(
+		     export_handle->json_file,
+		     "properties",
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write key.",
+			 function );
+
+			goto on_error;
+		}
+		if( export_handle_export_item_entries_json(
+		     export_handle,
+		     attachment,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to export properties of attachment: %d.",
+			 function,
+			 attachment_index );
+
+			goto on_error;
+		}
+		if( json_file_end_object(
+		     export_handle->json_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write end of object.",
+			 function );
+
+			goto on_error;
+		}
+		if( libpff_item_free(
+		     &attachment,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free attachment.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( json_file_end_array(
+	     export_handle->json_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write end of array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( attached_item != NULL )
+	{
+		libpff_item_free(
+		 &attached_item,
+		 NULL );
+	}
+	if( attachment != NULL )
+	{
+		libpff_item_free(
+		 &attachment,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports the attachment data to the blob file
+ * The size and offset of the data in the blob file are exported
+ * as members of the current JSON object
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_attachment_data_json(
+     export_handle_t *export_handle,
+     libpff_item_t *attachment,
+     libcerror_error_t **error )
+{
+	attachment_store_entry_t *stored_entry = NULL;
+	uint8_t *attachment_data               = NULL;
+	static char *function                  = "export_handle_export_attachment_data_json";
+	size64_t attachment_data_size          = 0;
+	size64_t data_size                     = 0;
+	off64_t blob_offset                    = 0;
+	size_t read_size                       = 0;
+	ssize_t read_count                     = 0;
+	uint8_t hash_attachment_data           = 0;
+	uint8_t is_duplicate                   = 0;
+	int result                             = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libpff_attachment_get_data_size(
+		  attachment,
+		  &attachment_data_size,
+		  error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve attachment data size.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	data_size   = attachment_data_size;
+	blob_offset = export_handle->json_file->blob_offset;
+
+	if( ( export_handle->attachment_store != NULL )
+	 && ( attachment_data_size > 0 ) )
+	{
+		result = export_handle_get_duplicate_attachment_data(
+		          export_handle,
+		          attachment,
+		          attachment_data_size,
+		          &stored_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if attachment data is a duplicate.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			/* A duplicate refers to the data already written to the blob file
+			 */
+			blob_offset  = stored_entry->offset;
+			is_duplicate = 1;
+		}
+		else if( export_handle->attachment_store->digests_are_set == 0 )
+		{
+			hash_attachment_data = 1;
+		}
+	}
+	if( json_file_write_key(
+	     export_handle->json_file,
+	     "data_size",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write key.",
+		 function );
+
+		goto on_error;
+	}
+	if( json_file_write_unsigned_integer(
+	     export_handle->json_file,
+	     (uint64_t) attachment_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write attachment data size.",
+		 function );
+
+		goto on_error;
+	}
+	if( json_file_write_key(
+	     export_handle->json_file,
+	     "blob_offset",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write key.",
+		 function );
+
+		goto on_error;
+	}
+	if( json_file_write_unsigned_integer(
+	     export_handle->json_file,
+	     (uint64_t) blob_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write blob offset.",
+		 function );
+
+		goto on_error;
+	}
+	if( attachment_data_size == 0 )
+	{
+		return( 1 );
+	}
+	if( is_duplicate != 0 )
+	{
+		if( attachment_store_add_duplicate(
+		     export_handle->attachment_store,
+		     attachment_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to add duplicate to attachment store.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	if( libpff_attachment_data_seek_offset(
+	     attachment,
+	     0,
+	     SEEK_SET,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek the start of the attachment data.",
+		 function );
+
+		goto on_error;
+	}
+	attachment_data = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * EXPORT_HANDLE_ATTACHMENT_DATA_BUFFER_SIZE );
+
+	if( attachment_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create attachment data.",
+		 function );
+
+		goto on_error;
+	}
+	while( attachment_data_size > 0 )
+	{
+		if( export_handle->abort != 0 )
+		{
+			goto on_error;
+		}
+		if( attachment_data_size >= EXPORT_HANDLE_ATTACHMENT_DATA_BUFFER_SIZE )
+		{
+			read_size = EXPORT_HANDLE_ATTACHMENT_DATA_BUFFER_SIZE;
+		}
+		else
+		{
+			read_size = (size_t) attachment_data_size;
+		}
+		read_count = libpff_attachment_data_read_buffer(
+			      attachment,
+			      attachment_data,
+			      read_size,
+			      error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read attachment data.",
+			 function );
+
+			goto on_error;
+		}
+		if( hash_attachment_data != 0 )
+		{
+			if( attachment_store_update_data(
+			     export_handle->attachment_store,
+			     attachment_data,
+			     read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to hash attachment data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( json_file_write_blob_data(
+		     export_handle->json_file,
+		     attachment_data,
+		     read_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write attachment data to blob file.",
+			 function );
+
+			goto on_error;
+		}
+		attachment_data_size -= read_size;
+	}
+	memory_free(
+	 attachment_data );
+
+	attachment_data = NULL;
+
+	if( export_handle->attachment_store != NULL )
+	{
+		if( hash_attachment_data != 0 )
+		{
+			if( attachment_store_finish_data(
+			     export_handle->attachment_store,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to finish hashing attachment data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( attachment_store_add_entry(
+		     export_handle->attachment_store,
+		     data_size,
+		     NULL,
+		     0,
+		     blob_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to add attachment data to attachment store.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( attachment_data != NULL )
+	{
+		memory_free(
+		 attachment_data );
+	}
+	return( -1 );
+}
+
+/* Exports the Outlook message header
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_message_header(
+     export_handle_t *export_handle,
+     libpff_item_t *message,
+     const libcstring_system_character_t *export_path,
+     size_t export_path_length,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	item_file_t *item_file = NULL;
+	static char *function  = "export_handle_export_message_header";
+	int result             = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = export_handle_create_item_file(
+	          export_handle,
+	          export_path,
+	          export_path_length,
+	          _LIBCSTRING_SYSTEM_STRING( "OutlookHeaders.txt" ),
+	          18,
+	          &item_file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item file.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		log_handle_printf(
+		 log_handle,
+		 "Skipping message header file it already exists.\n" );
+
+		return( 1 );
+	}
+	if( export_handle_export_message_header_to_item_file(
+	     export_handle,
+	     message,
+	     item_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to export message header.",
+		 function );
+
+		goto on_error;
+	}
+	if( item_file_close(
+	     item_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close item file.",
+		 function );
+
+		goto on_error;
+	}
+	if( item_file_free(
+	     &item_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free item file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( item_file != NULL )
+	{
+		item_file_free(
+		 &item_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports the message flags to an item file
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_message_flags_to_item_file(
+     export_handle_t *export_handle,
+     libpff_item_t *message,
+     const libcstring_system_character_t *description,
+     item_file_t *item_file,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_export_message_flags_to_item_file";
+	uint32_t value_32bit  = 0;
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( description == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid description.",
+		 function );
+
+		return( -1 );
+	}
+	result = libpff_message_get_flags(
+	          message,
+	          &value_32bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve flags.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+	}
+	else if( result != 0 )
+	{
+		if( item_file_write_string(
+		     item_file,
+		     description,
+		     libcstring_system_string_length(
+		      description ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write description.",
+			 function );
+
+			return( -1 );
+		}
+		if( item_file_write_integer_32bit_as_hexadecimal(
+		     item_file,
+		     value_32bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write 32-bit integer.",
+			 function );
+
+			return( -1 );
+		}
+		if( item_file_write_string(
+		     item_file,
+		     _LIBCSTRING_SYSTEM_STRING( " (" ),
+		     2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write string.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( value_32bit & LIBPFF_MESSAGE_FLAG_READ ) != 0 )
+		{
+			if( item_file_write_string(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( "Read" ),
+			     4,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			if( item_file_write_string(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( "Unread" ),
+			     6,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( ( value_32bit & LIBPFF_MESSAGE_FLAG_UNMODIFIED ) != 0 )
+		{
+			if( item_file_write_string(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( ", Unmodified" ),
+			     12,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( ( value_32bit & LIBPFF_MESSAGE_FLAG_SUBMIT ) != 0 )
+		{
+			if( item_file_write_string(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( ", Submit" ),
+			     8,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( ( value_32bit & LIBPFF_MESSAGE_FLAG_UNSENT ) != 0 )
+		{
+			if( item_file_write_string(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( ", Unsent" ),
+			     8,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( ( value_32bit & LIBPFF_MESSAGE_FLAG_HAS_ATTACHMENTS ) != 0 )
+		{
+			if( item_file_write_string(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( ", Has attachments" ),
+			     17,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( ( value_32bit & LIBPFF_MESSAGE_FLAG_FROM_ME ) != 0 )
+		{
+			if( item_file_write_string(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( ", From me" ),
+			     9,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( ( value_32bit & LIBPFF_MESSAGE_FLAG_ASSOCIATED ) != 0 )
+		{
+			if( item_file_write_string(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( ", Associated" ),
+			     12,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( ( value_32bit & LIBPFF_MESSAGE_FLAG_RESEND ) != 0 )
+		{
+			if( item_file_write_string(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( ", Resend" ),
+			     8,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( ( value_32bit & LIBPFF_MESSAGE_FLAG_RN_PENDING ) != 0 )
+		{
+			if( item_file_write_string(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( ", RN pending" ),
+			     12,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( ( value_32bit & LIBPFF_MESSAGE_FLAG_NRN_PENDING ) != 0 )
+		{
+			if( item_file_write_string(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( ", NRN pending" ),
+			     13,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( item_file_write_string(
+		     item_file,
+		     _LIBCSTRING_SYSTEM_STRING( ")" ),
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write string.",
+			 function );
+
+			return( -1 );
+		}
+		if( item_file_write_new_line(
+		     item_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write new line.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Exports the message importance to an item file
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_message_importance_to_item_file(
+     export_handle_t *export_handle,
+     libpff_item_t *message,
+     const libcstring_system_character_t *description,
+     item_file_t *item_file,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_export_message_importance_to_item_file";
+	uint32_t value_32bit  = 0;
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( description == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid description.",
+		 function );
+
+		return( -1 );
+	}
+	result = libpff_message_get_importance(
+	          message,
+	          &value_32bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve importance.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+	}
+	else if( result != 0 )
+	{
+		if( item_file_write_string(
+		     item_file,
+		     description,
+		     libcstring_system_string_length(
+		      description ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write description.",
+			 function );
+
+			return( -1 );
+		}
+		if( value_32bit == (uint32_t) LIBPFF_MESSAGE_IMPORTANCE_TYPE_LOW )
+		{
+			if( item_file_write_string(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( "Low" ),
+			     3,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else if( value_32bit == (uint32_t) LIBPFF_MESSAGE_IMPORTANCE_TYPE_NORMAL )
+		{
+			if( item_file_write_string(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( "Normal" ),
+			     6,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else if( value_32bit == (uint32_t) LIBPFF_MESSAGE_IMPORTANCE_TYPE_HIGH )
+		{
+			if( item_file_write_string(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( "High" ),
+			     4,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			if( item_file_write_string(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( "Unknown (" ),
+			     9,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string.",
+				 function );
+
+				return( -1 );
+			}
+			if( item_file_write_integer_32bit_as_hexadecimal(
+			     item_file,
+			     value_32bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write 32-bit integer.",
+				 function );
+
+				return( -1 );
+			}
+			if( item_file_write_string(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( ")" ),
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( item_file_write_new_line(
+		     item_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write new line.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Exports the message priority to an item file
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_message_priority_to_item_file(
+     export_handle_t *export_handle,
+     libpff_item_t *message,
+     const libcstring_system_character_t *description,
+     item_file_t *item_file,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_export_message_priority_to_item_file";
+	uint32_t value_32bit  = 0;
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( description == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid description.",
+		 function );
+
+		return( -1 );
+	}
+	result = libpff_message_get_priority(
+	          message,
+	          &value_32bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve priority.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+	}
+	else if( result != 0 )
+	{
+		if( item_file_write_string(
+		     item_file,
+		     description,
+		     libcstring_system_string_length(
+		      description ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write description.",
+			 function );
+
+			return( -1 );
+		}
+		if( value_32bit == (uint32_t) LIBPFF_MESSAGE_PRIORITY_TYPE_NON_URGENT )
+		{
+			if( item_file_write_string(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( "Non Urgent" ),
+			     10,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else if( value_32bit == (uint32_t) LIBPFF_MESSAGE_PRIORITY_TYPE_NORMAL )
+		{
+			if( item_file_write_string(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( "Normal" ),
+			     6,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else if( value_32bit == (uint32_t) LIBPFF_MESSAGE_PRIORITY_TYPE_URGENT )
+		{
+			if( item_file_write_string(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( "Urgent" ),
+			     6,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			if( item_file_write_string(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( "Unknown (" ),
+			     9,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string.",
+				 function );
+
+				return( -1 );
+			}
+			if( item_file_write_integer_32bit_as_hexadecimal(
+			     item_file,
+			     value_32bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write 32-bit integer.",
+				 function );
+
+				return( -1 );
+			}
+			if( item_file_write_string(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( ")" ),
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( item_file_write_new_line(
+		     item_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write new line.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Exports the message sensitivity to an item file
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_message_sensitivity_to_item_file(
+     export_handle_t *export_handle,
+     libpff_item_t *message,
+     const libcstring_system_character_t *description,
+     item_file_t *item_file,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_export_message_sensitivity_to_item_file";
+	uint32_t value_32bit  = 0;
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( description == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid description.",
+		 function );
+
+		return( -1 );
+	}
+	result = libpff_message_get_sensitivity(
+	          message,
+	          &value_32bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sensitivity.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+	}
+	else if( result != 0 )
+	{
+		if( item_file_write_string(
+		     item_file,
+		     description,
+		     libcstring_system_string_length(
+		      description ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write description.",
+			 function );
+
+			return( -1 );
+		}
+		if( value_32bit == (uint32_t) LIBPFF_MESSAGE_SENSITIVITY_TYPE_NONE )
+		{
+			if( item_file_write_string(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( "None" ),
+			     4,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else if( value_32bit == (uint32_t) LIBPFF_MESSAGE_SENSITIVITY_TYPE_PERSONAL )
+		{
+			if( item_file_write_string(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( "Personal" ),
+			     8,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else if( value_32bit == (uint32_t) LIBPFF_MESSAGE_SENSITIVITY_TYPE_PRIVATE )
+		{
+			if( item_file_write_string(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( "Private" ),
+			     7,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else if( value_32bit == (uint32_t) LIBPFF_MESSAGE_SENSITIVITY_TYPE_CONFIDENTIAL )
+		{
+			if( item_file_write_string(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( "Confidential" ),
+			     12,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			if( item_file_write_string(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( "Unknown (" ),
+			     9,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string.",
+				 function );
+
+				return( -1 );
+			}
+			if( item_file_write_integer_32bit_as_hexadecimal(
+			     item_file,
+			     value_32bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write 32-bit integer.",
+				 function );
+
+				return( -1 );
+			}
+			if( item_file_write_string(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( ")" ),
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( item_file_write_new_line(
+		     item_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write new line.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Exports the message subject to an item file
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_message_subject_to_item_file(
+     export_handle_t *export_handle,
+     libpff_item_t *message,
+     const libcstring_system_character_t *description,
+     item_file_t *item_file,
+     libcerror_error_t **error )
+{
+	libcstring_system_character_t *value_string = NULL;
+	static char *function                       = "export_handle_export_message_subject_to_item_file";
+	size_t value_string_size                    = 0;
+	int result                                  = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libpff_message_get_utf16_subject_size(
+	          message,
+	          &value_string_size,
+	          error );
+#else
+	result = libpff_message_get_utf8_subject_size(
+	          message,
+	          &value_string_size,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve subject size.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+	}
+	else if( ( result != 0 )
+	      && ( value_string_size > 0 ) )
+	{
+		value_string = libcstring_system_string_allocate(
+		                value_string_size );
+
+		if( value_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create subject.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libpff_message_get_utf16_subject(
+		          message,
+		          (uint16_t *) value_string,
+		          value_string_size,
+		          error );
+#else
+		result = libpff_message_get_utf8_subject(
+		          message,
+		          (uint8_t *) value_string,
+		          value_string_size,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve subject.",
+			 function );
+
+			goto on_error;
+		}
+		/* Ignore the subject control codes for now
+		 */
+		if( value_string[ 0 ] < 0x20 )
+		{
+			if( item_file_write_value_string(
+			     item_file,
+			     description,
+			     &( value_string[ 2 ] ),
+			     value_string_size - 3,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write subject.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			if( item_file_write_value_string(
+			     item_file,
+			     description,
+			     value_string,
+			     value_string_size - 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write subject.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		memory_free(
+		 value_string );
+
+		value_string = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( value_string != NULL )
+	{
+		memory_free(
+		 value_string );
+	}
+	return( -1 );
+}
+
+/* Exports the Outlook message header to an item file
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_message_header_to_item_file(
+     export_handle_t *export_handle,
+     libpff_item_t *message,
+     item_file_t *item_file,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_export_message_header_to_item_file";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_file_write_value_description(
+	     item_file,
+	     _LIBCSTRING_SYSTEM_STRING( "Message:" ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write string.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_file_write_item_value(
+	     item_file,
+	     message,
+	     0,
+	     LIBPFF_ENTRY_TYPE_MESSAGE_CLIENT_SUBMIT_TIME,
+	     _LIBCSTRING_SYSTEM_STRING( "Client submit time:\t\t\t" ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write client submit time.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+	}
+	if( item_file_write_item_value(
+	     item_file,
+	     message,
+	     0,
+	     LIBPFF_ENTRY_TYPE_MESSAGE_DELIVERY_TIME,
+	     _LIBCSTRING_SYSTEM_STRING( "Delivery time:\t\t\t\t" ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write delivery time.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+	}
+	if( item_file_write_item_value(
+	     item_file,
+	     message,
+	     0,
+	     LIBPFF_ENTRY_TYPE_MESSAGE_CREATION_TIME,
+	     _LIBCSTRING_SYSTEM_STRING( "Creation time:\t\t\t\t" ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write creation time.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+	}
+	if( item_file_write_item_value(
+	     item_file,
+	     message,
+	     0,
+	     LIBPFF_ENTRY_TYPE_MESSAGE_MODIFICATION_TIME,
+	     _LIBCSTRING_SYSTEM_STRING( "Modification time:\t\t\t" ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write modification time.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+	}
+	if( item_file_write_item_value(
+	     item_file,
+	     message,
+	     0,
+	     LIBPFF_ENTRY_TYPE_MESSAGE_SIZE,
+	     _LIBCSTRING_SYSTEM_STRING( "Size:\t\t\t\t\t" ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write size.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+	}
+	if( export_handle_export_message_flags_to_item_file(
+	     export_handle,
+	     message,
+	     _LIBCSTRING_SYSTEM_STRING( "Flags:\t\t\t\t\t" ),
+	     item_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_file_write_item_value(
+	     item_file,
+	     message,
+	     0,
+	     LIBPFF_ENTRY_TYPE_DISPLAY_NAME,
+	     _LIBCSTRING_SYSTEM_STRING( "Display name:\t\t\t\t" ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write display name.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+	}
+	if( item_file_write_item_value(
+	     item_file,
+	     message,
+	     0,
+	     LIBPFF_ENTRY_TYPE_MESSAGE_CONVERSATION_TOPIC,
+	     _LIBCSTRING_SYSTEM_STRING( "Conversation topic:\t\t\t" ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write conversation topic.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+	}
+	if( export_handle_export_message_subject_to_item_file(
+	     export_handle,
+	     message,
+	     _LIBCSTRING_SYSTEM_STRING( "Subject:\t\t\t\t" ),
+	     item_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write subject.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_file_write_item_value(
+	     item_file,
+	     message,
+	     0,
+	     LIBPFF_ENTRY_TYPE_MESSAGE_SENDER_NAME,
+	     _LIBCSTRING_SYSTEM_STRING( "Sender name:\t\t\t\t" ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write sender name.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+	}
+	if( item_file_write_item_value(
+	     item_file,
+	     message,
+	     0,
+	     LIBPFF_ENTRY_TYPE_MESSAGE_SENDER_EMAIL_ADDRESS,
+	     _LIBCSTRING_SYSTEM_STRING( "Sender email address:\t\t\t" ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write sender email address.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+	}
+	if( item_file_write_item_value(
+	     item_file,
+	     message,
+	     0,
+	     LIBPFF_ENTRY_TYPE_MESSAGE_SENT_REPRESENTING_NAME,
+	     _LIBCSTRING_SYSTEM_STRING( "Sent representing name:\t\t\t" ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write sent representing name.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+	}
+	if( item_file_write_item_value(
+	     item_file,
+	     message,
+	     0,
+	     LIBPFF_ENTRY_TYPE_MESSAGE_SENT_REPRESENTING_EMAIL_ADDRESS,
+	     _LIBCSTRING_SYSTEM_STRING( "Sent representing email address:\t" ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write sent representing email address.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+	}
+	if( export_handle_export_message_importance_to_item_file(
+	     export_handle,
+	     message,
+	     _LIBCSTRING_SYSTEM_STRING( "Importance:\t\t\t\t" ),
+	     item_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write importance.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_export_message_priority_to_item_file(
+	     export_handle,
+	     message,
+	     _LIBCSTRING_SYSTEM_STRING( "Priority:\t\t\t\t" ),
+	     item_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write priority.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_export_message_sensitivity_to_item_file(
+	     export_handle,
+	     message,
+	     _LIBCSTRING_SYSTEM_STRING( "Sensitivity:\t\t\t\t" ),
+	     item_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write sensitivity.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_file_write_item_value(
+	     item_file,
+	     message,
+	     0,
+	     LIBPFF_ENTRY_TYPE_MESSAGE_IS_REMINDER,
+	     _LIBCSTRING_SYSTEM_STRING( "Is a reminder:\t\t\t\t" ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write is reminder.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+	}
+	if( item_file_write_item_value(
+	     item_file,
+	     message,
+	     0,
+	     LIBPFF_ENTRY_TYPE_MESSAGE_REMINDER_TIME,
+	     _LIBCSTRING_SYSTEM_STRING( "Reminder time:\t\t\t\t" ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write reminder time.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+	}
+	if( item_file_write_item_value(
+	     item_file,
+	     message,
+	     0,
+	     LIBPFF_ENTRY_TYPE_MESSAGE_REMINDER_SIGNAL_TIME,
+	     _LIBCSTRING_SYSTEM_STRING( "Reminder signal time:\t\t\t" ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write reminder signal time.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+	}
+	if( item_file_write_item_value(
+	     item_file,
+	     message,
+	     0,
+	     LIBPFF_ENTRY_TYPE_MESSAGE_IS_PRIVATE,
+	     _LIBCSTRING_SYSTEM_STRING( "Is private:\t\t\t\t" ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write is private.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+	}
+	if( item_file_write_new_line(
+	     item_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write new line.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Exports the message body
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_message_body(
+     export_handle_t *export_handle,
+     libpff_item_t *message,
+     const libcstring_system_character_t *export_path,
+     size_t export_path_length,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function         = "export_handle_export_message_body";
+	size_t message_html_body_size = 0;
+	size_t message_rtf_body_size  = 0;
+	size_t message_text_body_size = 0;
+	int export_format             = 0;
+	int has_html_body             = 0;
+	int has_rtf_body              = 0;
+	int has_text_body             = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine the available message body types
+	 */
+	has_html_body = libpff_message_get_html_body_size(
+	                 message,
+	                 &message_html_body_size,
+	                 error );
+
+	if( has_html_body == -1 )
+	{
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+		libcerror_error_free(
+		 error );
+	}
+	has_rtf_body = libpff_message_get_rtf_body_size(
+	                message,
+	                &message_rtf_body_size,
+	                error );
+
+	if( has_rtf_body == -1 )
+	{
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+		libcerror_error_free(
+		 error );
+	}
+	has_text_body = libpff_message_get_plain_text_body_size(
+	                 message,
+	                 &message_text_body_size,
+	                 error );
+
+	if( has_text_body == -1 )
+	{
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+		libcerror_error_free(
+		 error );
+	}
+	/* Determine the message body export format
+	 */
+	if( export_handle->preferred_export_format == EXPORT_FORMAT_ALL )
+	{
+		export_format = EXPORT_FORMAT_ALL;
+	}
+	if( export_format == 0 )
+	{
+		if( ( has_text_body == 1 )
+		 && ( message_text_body_size > 0 ) )
+		{
+			export_format = EXPORT_FORMAT_TEXT;
+		}
+		if( ( has_html_body == 1 )
+		 && ( message_html_body_size > 0 )
+		 && ( export_handle->preferred_export_format == EXPORT_FORMAT_HTML ) )
+		{
+			export_format = EXPORT_FORMAT_HTML;
+		}
+		if( ( has_rtf_body == 1 )
+		 && ( message_rtf_body_size > 0 )
+		 && ( export_handle->preferred_export_format == EXPORT_FORMAT_RTF ) )
+		{
+			export_format = EXPORT_FORMAT_RTF;
+		}
+	}
+	if( export_format == 0 )
+	{
+		if( ( has_text_body == 1 )
+		 && ( message_text_body_size > 0 ) )
+		{
+			export_format = EXPORT_FORMAT_TEXT;
+		}
+		else if( ( has_html_body == 1 )
+		 && ( message_html_body_size > 0 ) )
+		{
+			export_format = EXPORT_FORMAT_HTML;
+		}
+		else if( ( has_rtf_body == 1 )
+		 && ( message_rtf_body_size > 0 ) )
+		{
+			export_format = EXPORT_FORMAT_RTF;
+		}
+	}
+	if( export_format == 0 )
+	{
+		if( has_text_body == 1 )
+		{
+			export_format = EXPORT_FORMAT_TEXT;
+		}
+		else if( has_html_body == 1 )
+		{
+			export_format = EXPORT_FORMAT_HTML;
+		}
+		else if( has_rtf_body == 1 )
+		{
+			export_format = EXPORT_FORMAT_RTF;
+		}
+	}
+	if( export_format == EXPORT_FORMAT_ALL )
+	{
+		if( has_html_body == 1 )
+		{
+			if( export_handle_export_message_body_html(
+			     export_handle,
+			     message,
+			     message_html_body_size,
+			     export_path,
+			     export_path_length,
+			     log_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to export HTML message body.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( has_rtf_body == 1 )
+		{
+			if( export_handle_export_message_body_rtf(
+			     export_handle,
+			     message,
+			     message_rtf_body_size,
+			     export_path,
+			     export_path_length,
+			     log_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to export RTF message body.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( has_text_body == 1 )
+		{
+			if( export_handle_export_message_body_plain_text(
+			     export_handle,
+			     message,
+			     message_text_body_size,
+			     export_path,
+			     export_path_length,
+			     log_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to export plain text message body.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	else if( export_format == EXPORT_FORMAT_HTML )
+	{
+		if( export_handle_export_message_body_html(
+		     export_handle,
+		     message,
+		     message_html_body_size,
+		     export_path,
+		     export_path_length,
+		     log_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to export HTML message body.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( export_format == EXPORT_FORMAT_RTF )
+	{
+		if( export_handle_export_message_body_rtf(
+		     export_handle,
+		     message,
+		     message_rtf_body_size,
+		     export_path,
+		     export_path_length,
+		     log_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to export RTF message body.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( export_format == EXPORT_FORMAT_TEXT )
+	{
+		if( export_handle_export_message_body_plain_text(
+		     export_handle,
+		     message,
+		     message_text_body_size,
+		     export_path,
+		     export_path_length,
+		     log_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to export plain text message body.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Exports the HTML message body
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_message_body_html(
+     export_handle_t *export_handle,
+     libpff_item_t *message,
+     size_t message_html_body_size,
+     const libcstring_system_character_t *export_path,
+     size_t export_path_length,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libcstring_system_character_t filename[ 13 ];
+
+	item_file_t *item_file = NULL;
+	static char *function  = "export_handle_export_message_body_html";
+	size_t filename_size   = 0;
+	int result             = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcstring_system_string_copy(
+	     filename,
+	     _LIBCSTRING_SYSTEM_STRING( "Message.html" ),
+	     12 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to set filename.",
+		 function );
+
+		goto on_error;
+	}
+	filename[ 12 ] = 0;
+	filename_size  = 13;
+
+	log_handle_printf(
+	 log_handle,
+	 "Saving HTML message body as: %" PRIs_LIBCSTRING_SYSTEM "\n",
+	 filename );
+
+	result = export_handle_create_item_file(
+	          export_handle,
+	          export_path,
+	          export_path_length,
+	          filename,
+	          filename_size - 1,
+	          &item_file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item file.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		log_handle_printf(
+		 log_handle,
+		 "Skipping message body file: %" PRIs_LIBCSTRING_SYSTEM " it already exists.",
+		 filename );
+
+		return( 1 );
+	}
+	if( export_handle_export_message_body_html_to_item_file(
+	     export_handle,
+	     message,
+	     message_html_body_size,
+	     item_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to export HTML message body.",
+		 function );
+
+		goto on_error;
+	}
+	if( item_file_close(
+	     item_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close item file.",
+		 function );
+
+		goto on_error;
+	}
+	if( item_file_free(
+	     &item_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free item file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( item_file != NULL )
+	{
+		item_file_free(
+		 &item_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports the HTML message body to an item file
+ * The body is copied in chunks of EXPORT_HANDLE_MESSAGE_BODY_BUFFER_SIZE bytes
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_message_body_html_to_item_file(
+     export_handle_t *export_handle,
+     libpff_item_t *message,
+     size_t message_html_body_size,
+     item_file_t *item_file,
+     libcerror_error_t **error )
+{
+	uint8_t *body_data    = NULL;
+	static char *function = "export_handle_export_message_body_html_to_item_file";
+	size_t buffer_offset  = 0;
+	size_t write_size     = 0;
+	ssize_t read_count    = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_html_body_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid message HTML body size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_html_body_size == 0 )
+	{
+		return( 1 );
+	}
+	if( libpff_message_html_body_seek_offset(
+	     message,
+	     0,
+	     SEEK_SET,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek the start of the HTML body.",
+		 function );
+
+		goto on_error;
+	}
+	body_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * EXPORT_HANDLE_MESSAGE_BODY_BUFFER_SIZE );
+
+	if( body_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create HTML body data.",
+		 function );
+
+		goto on_error;
+	}
+	do
+	{
+		if( export_handle->abort != 0 )
+		{
+			goto on_error;
+		}
+		read_count = libpff_message_html_body_read_buffer(
+		              message,
+		              &( body_data[ buffer_offset ] ),
+		              EXPORT_HANDLE_MESSAGE_BODY_BUFFER_SIZE - buffer_offset,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read HTML body data.",
+			 function );
+
+			goto on_error;
+		}
+		if( read_count > 0 )
+		{
+			/* Hold back the last byte since it could be the end-of-string byte
+			 */
+			write_size = buffer_offset + (size_t) read_count - 1;
+
+			if( item_file_write_buffer(
+			     item_file,
+			     body_data,
+			     write_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write HTML body.",
+				 function );
+
+				goto on_error;
+			}
+			body_data[ 0 ] = body_data[ write_size ];
+			buffer_offset  = 1;
+		}
+	}
+	while( read_count > 0 );
+
+	/* Do not write the end-of-string byte
+	 */
+	if( ( buffer_offset > 0 )
+	 && ( body_data[ 0 ] != 0 ) )
+	{
+		if( item_file_write_buffer(
+		     item_file,
+		     body_data,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write HTML body.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 body_data );
+
+	return( 1 );
+
+on_error:
+	if( body_data != NULL )
+	{
+		memory_free(
+		 body_data );
+	}
+	return( -1 );
+}
+
+/* Exports the RTF message body
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_message_body_rtf(
+     export_handle_t *export_handle,
+     libpff_item_t *message,
+     size_t message_rtf_body_size,
+     const libcstring_system_character_t *export_path,
+     size_t export_path_length,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libcstring_system_character_t filename[ 12 ];
+
+	item_file_t *item_file = NULL;
+	static char *function  = "export_handle_export_message_body_rtf";
+	size_t filename_size   = 0;
+	int result             = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcstring_system_string_copy(
+	     filename,
+	     _LIBCSTRING_SYSTEM_STRING( "Message.rtf" ),
+	     11 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to set RTF message body filename.",
+		 function );
+
+		goto on_error;
+	}
+	filename[ 11 ] = 0;
+	filename_size  = 12;
+
+	log_handle_printf(
+	 log_handle,
+	 "Saving RTF message body as: %" PRIs_LIBCSTRING_SYSTEM "\n",
+	 filename );
+
+	result = export_handle_create_item_file(
+	          export_handle,
+	          export_path,
+	          export_path_length,
+	          filename,
+	          filename_size - 1,
+	          &item_file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item file.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		log_handle_printf(
+		 log_handle,
+		 "Skipping message body file: %" PRIs_LIBCSTRING_SYSTEM " it already exists.",
+		 filename );
+
+		return( 1 );
+	}
+	if( export_handle_export_message_body_rtf_to_item_file(
+	     export_handle,
+	     message,
+	     message_rtf_body_size,
+	     item_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to export RTF message body.",
+		 function );
+
+		goto on_error;
+	}
+	if( item_file_close(
+	     item_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close item file.",
+		 function );
+
+		goto on_error;
+	}
+	if( item_file_free(
+	     &item_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free item file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( item_file != NULL )
+	{
+		item_file_free(
+		 &item_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports the RTF message body to an item file
+ * The body is copied in chunks of EXPORT_HANDLE_MESSAGE_BODY_BUFFER_SIZE bytes
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_message_body_rtf_to_item_file(
+     export_handle_t *export_handle,
+     libpff_item_t *message,
+     size_t message_rtf_body_size,
+     item_file_t *item_file,
+     libcerror_error_t **error )
+{
+	uint8_t *body_data    = NULL;
+	static char *function = "export_handle_export_message_body_rtf_to_item_file";
+	ssize_t read_count    = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_rtf_body_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid message RTF body size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_rtf_body_size == 0 )
+	{
+		return( 1 );
+	}
+	if( libpff_message_rtf_body_seek_offset(
+	     message,
+	     0,
+	     SEEK_SET,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek the start of the RTF body.",
+		 function );
+
+		goto on_error;
+	}
+	body_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * EXPORT_HANDLE_MESSAGE_BODY_BUFFER_SIZE );
+
+	if( body_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create RTF body data.",
+		 function );
+
+		goto on_error;
+	}
+	do
+	{
+		if( export_handle->abort != 0 )
+		{
+			goto on_error;
+		}
+		read_count = libpff_message_rtf_body_read_buffer(
+		              message,
+		              body_data,
+		              EXPORT_HANDLE_MESSAGE_BODY_BUFFER_SIZE,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read RTF body data.",
+			 function );
+
+			goto on_error;
+		}
+		if( read_count > 0 )
+		{
+			if( item_file_write_buffer(
+			     item_file,
+			     body_data,
+			     (size_t) read_count,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write RTF body.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	while( read_count > 0 );
+	memory_free(
+	 body_data );
+
+	return( 1 );
+
+on_error:
+	if( body_data != NULL )
+	{
+		memory_free(
+		 body_data );
+	}
+	return( -1 );
+}
+
+/* Exports the plain text message body
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_message_body_plain_text(
+     export_handle_t *export_handle,
+     libpff_item_t *message,
+     size_t plain_text_body_size,
+     const libcstring_system_character_t *export_path,
+     size_t export_path_length,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libcstring_system_character_t filename[ 12 ];
+
+	item_file_t *item_file = NULL;
+	static char *function  = "export_handle_export_message_body_plain_text";
+	size_t filename_size   = 0;
+	int result             = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcstring_system_string_copy(
+	     filename,
+	     _LIBCSTRING_SYSTEM_STRING( "Message.txt" ),
+	     11 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to set plain text message body filename.",
+		 function );
+
+		goto on_error;
+	}
+	filename[ 11 ] = 0;
+	filename_size  = 12;
+
+	log_handle_printf(
+	 log_handle,
+	 "Saving plain text message body as: %" PRIs_LIBCSTRING_SYSTEM "\n",
+	 filename );
+
+	result = export_handle_create_item_file(
+	          export_handle,
+	          export_path,
+	          export_path_length,
+	          filename,
+	          filename_size - 1,
+	          &item_file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create message body file.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		log_handle_printf(
+		 log_handle,
+		 "Skipping message body file: %" PRIs_LIBCSTRING_SYSTEM " it already exists.",
+		 filename );
+
+		return( 1 );
+	}
+	if( export_handle_export_message_body_plain_text_to_item_file(
+	     export_handle,
+	     message,
+	     plain_text_body_size,
+	     item_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to export plain text message body.",
+		 function );
+
+		goto on_error;
+	}
+	if( item_file_close(
+	     item_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close item file.",
+		 function );
+
+		goto on_error;
+	}
+	if( item_file_free(
+	     &item_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free item file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( item_file != NULL )
+	{
+		item_file_free(
+		 &item_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports the plain text message body to an item file
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_message_body_plain_text_to_item_file(
+     export_handle_t *export_handle,
+     libpff_item_t *message,
+     size_t plain_text_body_size,
+     item_file_t *item_file,
+     libcerror_error_t **error )
+{
+	uint8_t *plain_text_body = NULL;
+	static char *function    = "export_handle_export_message_body_plain_text_to_item_file";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( plain_text_body_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid plain text body size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( plain_text_body_size > 0 )
+	{
+		plain_text_body = (uint8_t *) memory_allocate(
+		                               sizeof( uint8_t ) * plain_text_body_size );
+
+		if( plain_text_body == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create plain text body.",
+			 function );
+
+			goto on_error;
+		}
+		if( libpff_message_get_plain_text_body(
+		     message,
+		     plain_text_body,
+		     plain_text_body_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve plain text body.",
+			 function );
+
+			goto on_error;
+		}
+		/* Do not write the end of string byte
+		 */
+		if( item_file_write_buffer(
+		     item_file,
+		     plain_text_body,
+		     plain_text_body_size - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write plain text body.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 plain_text_body );
+
+		plain_text_body = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( plain_text_body != NULL )
+	{
+		memory_free(
+		 plain_text_body );
+	}
+	return( -1 );
+}
+
+/* Exports the Outlook message conversation index
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_message_conversation_index(
+     export_handle_t *export_handle,
+     libpff_item_t *message,
+     const libcstring_system_character_t *export_path,
+     size_t export_path_length,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	item_file_t *item_file = NULL;
+	static char *function  = "export_handle_export_message_conversation_index";
+	int result             = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = export_handle_create_item_file(
+	          export_handle,
+	          export_path,
+	          export_path_length,
+	          _LIBCSTRING_SYSTEM_STRING( "ConversationIndex.txt" ),
+	          21,
+	          &item_file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item file.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		log_handle_printf(
+		 log_handle,
+		 "Skipping conversation index file it already exists.\n" );
+
+		return( 1 );
+	}
+	if( export_handle_export_message_conversation_index_to_item_file(
+	     export_handle,
+	     message,
+	     item_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to export message conversation index.",
+		 function );
+
+		goto on_error;
+	}
+	if( item_file_close(
+	     item_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close item file.",
+		 function );
+
+		goto on_error;
+	}
+	if( item_file_free(
+	     &item_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free item file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( item_file != NULL )
+	{
+		item_file_free(
+		 &item_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports the Outlook message conversation index to an item file
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_message_conversation_index_to_item_file(
+     export_handle_t *export_handle,
+     libpff_item_t *message,
+     item_file_t *item_file,
+     libcerror_error_t **error )
+{
+	uint8_t filetime_buffer[ 8 ];
+
+	libfdatetime_filetime_t *delta_filetime = NULL;
+	libfdatetime_filetime_t *filetime       = NULL;
+	libfguid_identifier_t *guid             = NULL;
+	uint8_t *entry_value                    = NULL;
+	uint8_t *entry_value_pointer            = NULL;
+	static char *function                   = "export_handle_export_message_conversation_index_to_item_file";
+	size_t entry_value_size                 = 0;
+	uint64_t entry_value_64bit              = 0;
+	uint32_t entry_value_index              = 0;
+	int list_iterator                       = 0;
+	int result                              = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libpff_message_get_conversation_index_size(
+	          message,
+	          &entry_value_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve conversation index size.",
+		 function );
+
+		 goto on_error;
+	}
+	if( ( result == 0 )
+	 || ( entry_value_size == 0 ) )
+	{
+		return( 1 );
+	}
+	entry_value = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * entry_value_size );
+
+	if( entry_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry value.",
+		 function );
+
+		goto on_error;
+	}
+	result = libpff_message_get_conversation_index(
+		  message,
+		  entry_value,
+		  entry_value_size,
+		  error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve conversation index.",
+		 function );
+
+		goto on_error;
+	}
+	if( item_file_write_value_description(
+	     item_file,
+	     _LIBCSTRING_SYSTEM_STRING( "Conversation index:" ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write value description.",
+		 function );
+
+		goto on_error;
+	}
+	if( entry_value_size >= 22 )
+	{
+		/* According to MSDN the first byte is reserved
+		 * and should always be 0x01 however it makes
+		 * more sense that it's the most significant
+		 * part of the current system filetime data
+		 */
+		if( entry_value[ 0 ] == 0x01 )
+		{
+			if( libfdatetime_filetime_initialize(
+			     &filetime,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create filetime.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfdatetime_filetime_initialize(
+			     &delta_filetime,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create delta filetime.",
+				 function );
+
+				goto on_error;
+			}
+			if( item_file_write_value_description(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( "Header block:" ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write value description.",
+				 function );
+
+				goto on_error;
+			}
+			/* The current system file data is in big-endian
+			 */
+			filetime_buffer[ 0 ] = 0;
+			filetime_buffer[ 1 ] = 0;
+			filetime_buffer[ 2 ] = entry_value[ 5 ];
+			filetime_buffer[ 3 ] = entry_value[ 4 ];
+			filetime_buffer[ 4 ] = entry_value[ 3 ];
+			filetime_buffer[ 5 ] = entry_value[ 2 ];
+			filetime_buffer[ 6 ] = entry_value[ 1 ];
+			filetime_buffer[ 7 ] = entry_value[ 0 ];
+
+			if( libfdatetime_filetime_copy_from_byte_stream(
+			     filetime,
+			     filetime_buffer,
+			     8,
+			     LIBFDATETIME_ENDIAN_LITTLE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_GENERIC,
+				 "%s: unable to create filetime.",
+				 function );
+
+				goto on_error;
+			}
+			if( item_file_write_value_filetime(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( "\tFiletime:\t" ),
+			     filetime,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write value filetime.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfguid_identifier_initialize(
+			     &guid,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create GUID.",
+				 function );
+
+				goto on_error;
+			}
+			/* Currently it is assumed that the GUID is in big-endian
+			 */
+			if( libfguid_identifier_copy_from_byte_stream(
+			     guid,
+			     &( entry_value[ 6 ] ),
+			     16,
+			     LIBFGUID_ENDIAN_BIG,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy byte stream to GUID.",
+				 function );
+
+				goto on_error;
+			}
+			if( item_file_write_string(
+			     item_file,
+			     _LIBCSTRING_SYSTEM_STRING( "\tGUID:\t\t" ),
+			     8,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string.",
+				 function );
+
+				goto on_error;
+			}
+			if( item_file_write_guid(
+			     item_file,
+			     guid,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write GUID.",
+				 function );
+
+				goto on_error;
+			}
+			if( item_file_write_new_line(
+			     item_file,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write new line.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfguid_identifier_free(
+			     &guid,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free GUID.",
+				 function );
+
+				goto on_error;
+			}
+			list_iterator = 1;
+
+			for( entry_value_index = 22;
+			     entry_value_index < entry_value_size; 
+			     entry_value_index += 5 )
+			{
+				if( item_file_write_value_integer_32bit_as_decimal(
+				     item_file,
+				     _LIBCSTRING_SYSTEM_STRING( "Child block: " ),
+				     (uint32_t) list_iterator,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write 32-bit integer value.",
+					 function );
+
+					goto on_error;
+				}
+				entry_value_pointer = &( entry_value[ entry_value_index ] );
+
+				/* Use a 64-bit value to be able to shift the bits in the right position
+				 * current system time delta is in big-endian
+				 */
+				byte_stream_copy_to_uint32_little_endian(
+				 entry_value_pointer,
+				 entry_value_64bit );
+
+				/* Make sure only 31-bits are set and the rest is cleared
+				 */
+				entry_value_64bit &= 0x07fffffffUL;
+
+				/* Check if the highest bit is set
+				 */
+				if( ( entry_value[ entry_value_index ] & 0x80 ) == 0 )
+				{
+					/* Discard the highest 15-bits and the lowest 18-bits
+					 */
+					entry_value_64bit <<= 18;
+				}
+				else
+				{
+					/* Discard the highest 10-bits and the lowest 23-bits
+					 */
+					entry_value_64bit <<= 23;
+				}
+				if( libfdatetime_filetime_copy_from_64bit(
+				     delta_filetime,
+				     entry_value_64bit,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+					 LIBCERROR_CONVERSION_ERROR_GENERIC,
+					 "%s: unable to create delta filetime.",
+					 function );
+
+					goto on_error;
+				}
+				/* The next child block uses the previous filetime as its base
+				 * not the filetime in the header block as MSDN states
+				 * so the filetime is updated
+				 */
+				if( libfdatetime_filetime_add(
+				     filetime,
+				     delta_filetime,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to create filetime.",
+					 function );
+
+					goto on_error;
+				}
+				if( item_file_write_value_filetime(
+				     item_file,
+				     _LIBCSTRING_SYSTEM_STRING( "\tFiletime:\t" ),
+				     filetime,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write value filetime.",
+					 function );
+
+					goto on_error;
+				}
+				if( item_file_write_value_integer_32bit_as_decimal(
+				     item_file,
+				     _LIBCSTRING_SYSTEM_STRING( "\tRandom number:\t" ),
+				     (uint32_t) ( ( entry_value[ entry_value_index + 4 ] & 0xf0 ) >> 4 ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write 32-bit integer value.",
+					 function );
+
+					goto on_error;
+				}
+				if( item_file_write_value_integer_32bit_as_decimal(
+				     item_file,
+				     _LIBCSTRING_SYSTEM_STRING( "\tSequence count:\t" ),
+				     (uint32_t) ( entry_value[ entry_value_index + 4 ] & 0x0f ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write 32-bit integer value.",
+					 function );
+
+					goto on_error;
+				}
+				list_iterator++;
+			}
+			if( item_file_write_new_line(
+			     item_file,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write new line.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfdatetime_filetime_free(
+			     &delta_filetime,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free delta filetime.",
+				 function );
 
-		goto on_error;
-	}
-	else if( result == 0 )
-	{
-		log_handle_printf(
-		 log_handle,
-		 "Skipping message body file: %" PRIs_LIBCSTRING_SYSTEM " it already exists.",
-		 filename );
+				goto on_error;
+			}
+			if( libfdatetime_filetime_free(
+			     &filetime,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free filetime.",
+				 function );
 
-		return( 1 );
+				goto on_error;
+			}
+		}
 	}
-	if( export_handle_export_message_body_plain_text_to_item_file(
-	     export_handle,
-	     message,
-	     plain_text_body_size,
+	if( item_file_write_new_line(
 	     item_file,
 	     error ) != 1 )
 	{
@@ -5095,61 +9626,63 @@ int export_handle_export_message_body_plain_text(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to export plain text message body.",
+		 "%s: unable to write new line.",
 		 function );
 
 		goto on_error;
 	}
-	if( item_file_close(
-	     item_file,
-	     error ) != 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-		 "%s: unable to close item file.",
-		 function );
+	memory_free(
+	 entry_value );
 
-		goto on_error;
-	}
-	if( item_file_free(
-	     &item_file,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free item file.",
-		 function );
+	entry_value = NULL;
 
-		goto on_error;
-	}
 	return( 1 );
 
 on_error:
-	if( item_file != NULL )
+	if( guid != NULL )
 	{
-		item_file_free(
-		 &item_file,
+		libfguid_identifier_free(
+		 &guid,
+		 NULL );
+	}
+	if( delta_filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &delta_filetime,
+		 NULL );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
 		 NULL );
 	}
+	if( entry_value != NULL )
+	{
+		memory_free(
+		 entry_value );
+	}
 	return( -1 );
 }
 
-/* Exports the plain text message body to an item file
+/* Exports the transport message headers to a separate file
  * Returns 1 if successful or -1 on error
  */
-int export_handle_export_message_body_plain_text_to_item_file(
+int export_handle_export_message_transport_headers(
      export_handle_t *export_handle,
      libpff_item_t *message,
-     size_t plain_text_body_size,
-     item_file_t *item_file,
+     const libcstring_system_character_t *export_path,
+     size_t export_path_length,
+     log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	uint8_t *plain_text_body = NULL;
-	static char *function    = "export_handle_export_message_body_plain_text_to_item_file";
+	libcstring_system_character_t transport_headers_filename[ 20 ];
+
+	item_file_t *item_file                 = NULL;
+	static char *function                  = "export_handle_export_message_transport_headers";
+	size_t transport_headers_filename_size = 20;
+	size_t message_transport_headers_size  = 0;
+	int result                             = 0;
 
 	if( export_handle == NULL )
 	{
@@ -5162,113 +9695,56 @@ int export_handle_export_message_body_plain_text_to_item_file(
 
 		return( -1 );
 	}
-	if( plain_text_body_size > (size_t) SSIZE_MAX )
+	/* Determine the message transport headers size
+	 */
+	result = libpff_message_get_utf8_transport_headers_size(
+	          message,
+	          &message_transport_headers_size,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid plain text body size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable determine message transport headers size.",
 		 function );
 
-		return( -1 );
-	}
-	if( plain_text_body_size > 0 )
-	{
-		plain_text_body = (uint8_t *) memory_allocate(
-		                               sizeof( uint8_t ) * plain_text_body_size );
-
-		if( plain_text_body == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create plain text body.",
-			 function );
-
-			goto on_error;
-		}
-		if( libpff_message_get_plain_text_body(
-		     message,
-		     plain_text_body,
-		     plain_text_body_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve plain text body.",
-			 function );
-
-			goto on_error;
-		}
-		/* Do not write the end of string byte
-		 */
-		if( item_file_write_buffer(
-		     item_file,
-		     plain_text_body,
-		     plain_text_body_size - 1,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write plain text body.",
-			 function );
-
-			goto on_error;
-		}
-		memory_free(
-		 plain_text_body );
-
-		plain_text_body = NULL;
+		goto on_error;
 	}
-	return( 1 );
-
-on_error:
-	if( plain_text_body != NULL )
+	if( ( result == 0 )
+	 || ( message_transport_headers_size == 0 ) )
 	{
-		memory_free(
-		 plain_text_body );
+		return( 1 );
 	}
-	return( -1 );
-}
-
-/* Exports the Outlook message conversation index
- * Returns 1 if successful or -1 on error
- */
-int export_handle_export_message_conversation_index(
-     export_handle_t *export_handle,
-     libpff_item_t *message,
-     const libcstring_system_character_t *export_path,
-     size_t export_path_length,
-     log_handle_t *log_handle,
-     libcerror_error_t **error )
-{
-	item_file_t *item_file = NULL;
-	static char *function  = "export_handle_export_message_conversation_index";
-	int result             = 0;
-
-	if( export_handle == NULL )
+	if( libcstring_system_string_copy(
+	     transport_headers_filename,
+	     _LIBCSTRING_SYSTEM_STRING( "InternetHeaders.txt" ),
+	     19 ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export handle.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to set message transport headers filename.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
+	transport_headers_filename[ 19 ] = 0;
+
+	log_handle_printf(
+	 log_handle,
+	 "Saving message transport headers as: %" PRIs_LIBCSTRING_SYSTEM "\n",
+	 transport_headers_filename );
+
 	result = export_handle_create_item_file(
 	          export_handle,
 	          export_path,
 	          export_path_length,
-	          _LIBCSTRING_SYSTEM_STRING( "ConversationIndex.txt" ),
-	          21,
+	          transport_headers_filename,
+	          transport_headers_filename_size - 1,
 	          &item_file,
 	          error );
 
@@ -5287,21 +9763,23 @@ int export_handle_export_message_conversation_index(
 	{
 		log_handle_printf(
 		 log_handle,
-		 "Skipping conversation index file it already exists.\n" );
+		 "Skipping message transport headers file: %" PRIs_LIBCSTRING_SYSTEM " it already exists.",
+		 transport_headers_filename );
 
 		return( 1 );
 	}
-	if( export_handle_export_message_conversation_index_to_item_file(
+	if( export_handle_export_message_transport_headers_to_item_file(
 	     export_handle,
 	     message,
+	     message_transport_headers_size,
 	     item_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_GENERIC,
-		 "%s: unable to export message conversation index.",
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to export message transport headers.",
 		 function );
 
 		goto on_error;
@@ -5344,28 +9822,18 @@ on_error:
 	return( -1 );
 }
 
-/* Exports the Outlook message conversation index to an item file
+/* Exports the transport message headers to an item file
  * Returns 1 if successful or -1 on error
  */
-int export_handle_export_message_conversation_index_to_item_file(
+int export_handle_export_message_transport_headers_to_item_file(
      export_handle_t *export_handle,
      libpff_item_t *message,
+     size_t message_transport_headers_size,
      item_file_t *item_file,
      libcerror_error_t **error )
 {
-	uint8_t filetime_buffer[ 8 ];
-
-	libfdatetime_filetime_t *delta_filetime = NULL;
-	libfdatetime_filetime_t *filetime       = NULL;
-	libfguid_identifier_t *guid             = NULL;
-	uint8_t *entry_value                    = NULL;
-	uint8_t *entry_value_pointer            = NULL;
-	static char *function                   = "export_handle_export_message_conversation_index_to_item_file";
-	size_t entry_value_size                 = 0;
-	uint64_t entry_value_64bit              = 0;
-	uint32_t entry_value_index              = 0;
-	int list_iterator                       = 0;
-	int result                              = 0;
+	uint8_t *entry_string = NULL;
+	static char *function = "export_handle_export_message_transport_headers_to_item_file";
 
 	if( export_handle == NULL )
 	{
@@ -5378,482 +9846,380 @@ int export_handle_export_message_conversation_index_to_item_file(
 
 		return( -1 );
 	}
-	result = libpff_message_get_conversation_index_size(
-	          message,
-	          &entry_value_size,
-	          error );
-
-	if( result == -1 )
+	if( message_transport_headers_size > 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve conversation index size.",
-		 function );
+		entry_string = (uint8_t *) memory_allocate(
+					    sizeof( uint8_t ) * message_transport_headers_size );
 
-		 goto on_error;
+		if( entry_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create transport headers.",
+			 function );
+
+			goto on_error;
+		}
+		if( libpff_message_get_utf8_transport_headers(
+		     message,
+		     entry_string,
+		     message_transport_headers_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve transport headers.",
+			 function );
+
+			goto on_error;
+		}
+		/* Do not write the end of string
+		 */
+		if( item_file_write_buffer(
+		     item_file,
+		     entry_string,
+		     message_transport_headers_size - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write transport headers.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 entry_string );
+
+		entry_string = NULL;
 	}
-	if( ( result == 0 )
-	 || ( entry_value_size == 0 ) )
+	return( 1 );
+
+on_error:
+	if( entry_string != NULL )
 	{
-		return( 1 );
+		memory_free(
+		 entry_string );
 	}
-	entry_value = (uint8_t *) memory_allocate(
-	                           sizeof( uint8_t ) * entry_value_size );
+	return( -1 );
+}
 
-	if( entry_value == NULL )
+/* Exports the attachments
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_attachments(
+     export_handle_t *export_handle,
+     libpff_item_t *item,
+     const libcstring_system_character_t *export_path,
+     size_t export_path_length,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libpff_item_t *attachment                       = NULL;
+	libpff_item_t *attachments                      = NULL;
+	libcstring_system_character_t *attachments_path = NULL;
+	static char *function                           = "export_handle_export_attachments";
+	size_t attachments_path_size                    = 0;
+	int attachment_index                            = 0;
+	int number_of_attachments                       = 0;
+	int result                                      = 0;
+
+	if( export_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create entry value.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	result = libpff_message_get_conversation_index(
-		  message,
-		  entry_value,
-		  entry_value_size,
-		  error );
-
-	if( result != 1 )
+	if( item == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve conversation index.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( item_file_write_value_description(
-	     item_file,
-	     _LIBCSTRING_SYSTEM_STRING( "Conversation index:" ),
+	if( libpff_message_get_number_of_attachments(
+	     item,
+	     &number_of_attachments,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write value description.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of attachments.",
 		 function );
 
 		goto on_error;
 	}
-	if( entry_value_size >= 22 )
+	if( number_of_attachments > 0 )
 	{
-		/* According to MSDN the first byte is reserved
-		 * and should always be 0x01 however it makes
-		 * more sense that it's the most significant
-		 * part of the current system filetime data
+		/* Create the attachments directory
 		 */
-		if( entry_value[ 0 ] == 0x01 )
-		{
-			if( libfdatetime_filetime_initialize(
-			     &filetime,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create filetime.",
-				 function );
-
-				goto on_error;
-			}
-			if( libfdatetime_filetime_initialize(
-			     &delta_filetime,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create delta filetime.",
-				 function );
-
-				goto on_error;
-			}
-			if( item_file_write_value_description(
-			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( "Header block:" ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write value description.",
-				 function );
-
-				goto on_error;
-			}
-			/* The current system file data is in big-endian
-			 */
-			filetime_buffer[ 0 ] = 0;
-			filetime_buffer[ 1 ] = 0;
-			filetime_buffer[ 2 ] = entry_value[ 5 ];
-			filetime_buffer[ 3 ] = entry_value[ 4 ];
-			filetime_buffer[ 4 ] = entry_value[ 3 ];
-			filetime_buffer[ 5 ] = entry_value[ 2 ];
-			filetime_buffer[ 6 ] = entry_value[ 1 ];
-			filetime_buffer[ 7 ] = entry_value[ 0 ];
-
-			if( libfdatetime_filetime_copy_from_byte_stream(
-			     filetime,
-			     filetime_buffer,
-			     8,
-			     LIBFDATETIME_ENDIAN_LITTLE,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-				 LIBCERROR_CONVERSION_ERROR_GENERIC,
-				 "%s: unable to create filetime.",
-				 function );
-
-				goto on_error;
-			}
-			if( item_file_write_value_filetime(
-			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( "\tFiletime:\t" ),
-			     filetime,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write value filetime.",
-				 function );
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcpath_path_join_wide(
+		          &attachments_path,
+		          &attachments_path_size,
+		          export_path,
+		          export_path_length,
+		          _LIBCSTRING_SYSTEM_STRING( "Attachments" ),
+		          11,
+		          error );
+#else
+		result = libcpath_path_join(
+		          &attachments_path,
+		          &attachments_path_size,
+		          export_path,
+		          export_path_length,
+		          _LIBCSTRING_SYSTEM_STRING( "Attachments" ),
+		          11,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable create attachments path.",
+			 function );
 
-				goto on_error;
-			}
-			if( libfguid_identifier_initialize(
-			     &guid,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create GUID.",
-				 function );
+			goto on_error;
+		}
+		result = export_handle_path_exists(
+		          export_handle,
+		          attachments_path,
+		          error );
 
-				goto on_error;
-			}
-			/* Currently it is assumed that the GUID is in big-endian
-			 */
-			if( libfguid_identifier_copy_from_byte_stream(
-			     guid,
-			     &( entry_value[ 6 ] ),
-			     16,
-			     LIBFGUID_ENDIAN_BIG,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy byte stream to GUID.",
-				 function );
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to determine if %" PRIs_LIBCSTRING_SYSTEM " exists.",
+			 function,
+			 attachments_path );
 
-				goto on_error;
-			}
-			if( item_file_write_string(
-			     item_file,
-			     _LIBCSTRING_SYSTEM_STRING( "\tGUID:\t\t" ),
-			     8,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write string.",
-				 function );
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: %" PRIs_LIBCSTRING_SYSTEM " already exists.",
+			 function,
+			 attachments_path );
 
-				goto on_error;
-			}
-			if( item_file_write_guid(
-			     item_file,
-			     guid,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write GUID.",
-				 function );
+			goto on_error;
+		}
+		if( export_handle_make_directory(
+		     export_handle,
+		     attachments_path,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to make directory: %" PRIs_LIBCSTRING_SYSTEM ".",
+			 function,
+			 attachments_path );
 
-				goto on_error;
-			}
-			if( item_file_write_new_line(
-			     item_file,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write new line.",
-				 function );
+			goto on_error;
+		}
+		log_handle_printf(
+		 log_handle,
+		 "Created directory: %" PRIs_LIBCSTRING_SYSTEM ".\n",
+		 attachments_path );
 
-				goto on_error;
-			}
-			if( libfguid_identifier_free(
-			     &guid,
-			     error ) != 1 )
+		if( export_handle->dump_item_values != 0 )
+		{
+			result = libpff_message_get_attachments(
+				  item,
+				  &attachments,
+				  error );
+
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free GUID.",
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attachments.",
 				 function );
 
 				goto on_error;
 			}
-			list_iterator = 1;
-
-			for( entry_value_index = 22;
-			     entry_value_index < entry_value_size; 
-			     entry_value_index += 5 )
+			else if( result == 1 )
 			{
-				if( item_file_write_value_integer_32bit_as_decimal(
-				     item_file,
-				     _LIBCSTRING_SYSTEM_STRING( "Child block: " ),
-				     (uint32_t) list_iterator,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_WRITE_FAILED,
-					 "%s: unable to write 32-bit integer value.",
-					 function );
-
-					goto on_error;
-				}
-				entry_value_pointer = &( entry_value[ entry_value_index ] );
-
-				/* Use a 64-bit value to be able to shift the bits in the right position
-				 * current system time delta is in big-endian
-				 */
-				byte_stream_copy_to_uint32_little_endian(
-				 entry_value_pointer,
-				 entry_value_64bit );
-
-				/* Make sure only 31-bits are set and the rest is cleared
-				 */
-				entry_value_64bit &= 0x07fffffffUL;
-
-				/* Check if the highest bit is set
-				 */
-				if( ( entry_value[ entry_value_index ] & 0x80 ) == 0 )
-				{
-					/* Discard the highest 15-bits and the lowest 18-bits
-					 */
-					entry_value_64bit <<= 18;
-				}
-				else
-				{
-					/* Discard the highest 10-bits and the lowest 23-bits
-					 */
-					entry_value_64bit <<= 23;
-				}
-				if( libfdatetime_filetime_copy_from_64bit(
-				     delta_filetime,
-				     entry_value_64bit,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-					 LIBCERROR_CONVERSION_ERROR_GENERIC,
-					 "%s: unable to create delta filetime.",
-					 function );
-
-					goto on_error;
-				}
-				/* The next child block uses the previous filetime as its base
-				 * not the filetime in the header block as MSDN states
-				 * so the filetime is updated
-				 */
-				if( libfdatetime_filetime_add(
-				     filetime,
-				     delta_filetime,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to create filetime.",
-					 function );
-
-					goto on_error;
-				}
-				if( item_file_write_value_filetime(
-				     item_file,
-				     _LIBCSTRING_SYSTEM_STRING( "\tFiletime:\t" ),
-				     filetime,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_WRITE_FAILED,
-					 "%s: unable to write value filetime.",
-					 function );
-
-					goto on_error;
-				}
-				if( item_file_write_value_integer_32bit_as_decimal(
-				     item_file,
-				     _LIBCSTRING_SYSTEM_STRING( "\tRandom number:\t" ),
-				     (uint32_t) ( ( entry_value[ entry_value_index + 4 ] & 0xf0 ) >> 4 ),
+				if( export_handle_export_item_values(
+				     export_handle,
+				     attachments,
+				     _LIBCSTRING_SYSTEM_STRING( "ItemValues.txt" ),
+				     14,
+				     attachments_path,
+				     attachments_path_size - 1,
+				     log_handle,
 				     error ) != 1 )
 				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_WRITE_FAILED,
-					 "%s: unable to write 32-bit integer value.",
-					 function );
+					if( libcnotify_verbose != 0 )
+					{
+						libcnotify_printf(
+						 "%s: unable to export item values.\n",
+						 function );
+					}
+					if( ( error != NULL )
+					 && ( *error != NULL ) )
+					{
+						libcnotify_print_error_backtrace(
+						 *error );
+					}
+					libcerror_error_free(
+					 error );
 
-					goto on_error;
+					log_handle_printf(
+					 log_handle,
+					 "Unable to export attachments item values.\n" );
 				}
-				if( item_file_write_value_integer_32bit_as_decimal(
-				     item_file,
-				     _LIBCSTRING_SYSTEM_STRING( "\tSequence count:\t" ),
-				     (uint32_t) ( entry_value[ entry_value_index + 4 ] & 0x0f ),
+				if( libpff_item_free(
+				     &attachments,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_WRITE_FAILED,
-					 "%s: unable to write 32-bit integer value.",
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free attachments.",
 					 function );
 
 					goto on_error;
 				}
-				list_iterator++;
 			}
-			if( item_file_write_new_line(
-			     item_file,
+		}
+		/* Create the attachments files
+		 */
+		for( attachment_index = 0;
+		     attachment_index < number_of_attachments;
+		     attachment_index++ )
+		{
+			if( export_handle->abort != 0 )
+			{
+				return( -1 );
+			}
+			if( export_handle->print_status_information != 0 )
+			{
+				fprintf(
+				 export_handle->notify_stream,
+				 "Exporting attachment %d out of %d.\n",
+				 attachment_index + 1,
+				 number_of_attachments );
+			}
+			if( libpff_message_get_attachment(
+			     item,
+			     attachment_index,
+			     &attachment,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write new line.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attachment.",
 				 function );
 
 				goto on_error;
 			}
-			if( libfdatetime_filetime_free(
-			     &delta_filetime,
+			if( export_handle_export_attachment(
+			     export_handle,
+			     attachment,
+			     attachment_index,
+			     number_of_attachments,
+			     attachments_path,
+			     attachments_path_size - 1,
+			     log_handle,
 			     error ) != 1 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free delta filetime.",
-				 function );
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: unable to export attachment: %d.\n",
+					 function,
+					 attachment_index + 1 );
+				}
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+				libcerror_error_free(
+				 error );
 
-				goto on_error;
+				log_handle_printf(
+				 log_handle,
+				 "Unable to export attachment: %d.\n",
+				 attachment_index + 1 );
 			}
-			if( libfdatetime_filetime_free(
-			     &filetime,
+			if( libpff_item_free(
+			     &attachment,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free filetime.",
+				 "%s: unable to free attachment.",
 				 function );
 
 				goto on_error;
 			}
 		}
+		memory_free(
+		 attachments_path );
 	}
-	if( item_file_write_new_line(
-	     item_file,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write new line.",
-		 function );
-
-		goto on_error;
-	}
-	memory_free(
-	 entry_value );
-
-	entry_value = NULL;
-
 	return( 1 );
 
 on_error:
-	if( guid != NULL )
-	{
-		libfguid_identifier_free(
-		 &guid,
-		 NULL );
-	}
-	if( delta_filetime != NULL )
-	{
-		libfdatetime_filetime_free(
-		 &delta_filetime,
-		 NULL );
-	}
-	if( filetime != NULL )
-	{
-		libfdatetime_filetime_free(
-		 &filetime,
-		 NULL );
-	}
-	if( entry_value != NULL )
+	if( attachments_path != NULL )
 	{
 		memory_free(
-		 entry_value );
+		 attachments_path );
 	}
 	return( -1 );
 }
 
-/* Exports the transport message headers to a separate file
+/* Exports the attachment
  * Returns 1 if successful or -1 on error
  */
-int export_handle_export_message_transport_headers(
+int export_handle_export_attachment(
      export_handle_t *export_handle,
-     libpff_item_t *message,
+     libpff_item_t *attachment,
+     int attachment_index,
+     int number_of_attachments,
      const libcstring_system_character_t *export_path,
      size_t export_path_length,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	libcstring_system_character_t transport_headers_filename[ 20 ];
-
-	item_file_t *item_file                 = NULL;
-	static char *function                  = "export_handle_export_message_transport_headers";
-	size_t transport_headers_filename_size = 20;
-	size_t message_transport_headers_size  = 0;
-	int result                             = 0;
+	static char *function = "export_handle_export_attachment";
+	int attachment_type   = 0;
 
 	if( export_handle == NULL )
 	{
@@ -5866,240 +10232,307 @@ int export_handle_export_message_transport_headers(
 
 		return( -1 );
 	}
-	/* Determine the message transport headers size
-	 */
-	result = libpff_message_get_utf8_transport_headers_size(
-	          message,
-	          &message_transport_headers_size,
-	          error );
-
-	if( result == -1 )
+	if( libpff_attachment_get_type(
+	     attachment,
+	     &attachment_type,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable determine message transport headers size.",
+		 "%s: unable to retrieve attachment type.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( ( result == 0 )
-	 || ( message_transport_headers_size == 0 ) )
+	if( ( attachment_type != LIBPFF_ATTACHMENT_TYPE_DATA )
+	 && ( attachment_type != LIBPFF_ATTACHMENT_TYPE_ITEM )
+	 && ( attachment_type != LIBPFF_ATTACHMENT_TYPE_REFERENCE ) )
 	{
+		fprintf(
+		 export_handle->notify_stream,
+		 "Unsupported attachment type.\n" );
+
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unsupported attachment type.\n",
+			 function );
+		}
+		log_handle_printf(
+		 log_handle,
+		 "Unsupported attachment type.\n" );
+
 		return( 1 );
 	}
-	if( libcstring_system_string_copy(
-	     transport_headers_filename,
-	     _LIBCSTRING_SYSTEM_STRING( "InternetHeaders.txt" ),
-	     19 ) == NULL )
+	if( attachment_type == LIBPFF_ATTACHMENT_TYPE_REFERENCE )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to set message transport headers filename.",
-		 function );
-
-		goto on_error;
-	}
-	transport_headers_filename[ 19 ] = 0;
-
-	log_handle_printf(
-	 log_handle,
-	 "Saving message transport headers as: %" PRIs_LIBCSTRING_SYSTEM "\n",
-	 transport_headers_filename );
+		fprintf(
+		 export_handle->notify_stream,
+		 "Attachment is stored externally.\n" );
 
-	result = export_handle_create_item_file(
-	          export_handle,
-	          export_path,
-	          export_path_length,
-	          transport_headers_filename,
-	          transport_headers_filename_size - 1,
-	          &item_file,
-	          error );
+		log_handle_printf(
+		 log_handle,
+		 "Attachment is stored externally.\n" );
 
-	if( result == -1 )
+		return( 1 );
+	}
+	if( attachment_type == LIBPFF_ATTACHMENT_TYPE_DATA )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create item file.",
-		 function );
+		if( export_handle_export_attachment_data(
+		     export_handle,
+		     attachment,
+		     attachment_index,
+		     number_of_attachments,
+		     export_path,
+		     export_path_length,
+		     log_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to export attachment data.",
+			 function );
 
-		goto on_error;
+			return( -1 );
+		}
 	}
-	else if( result == 0 )
+	else if( attachment_type == LIBPFF_ATTACHMENT_TYPE_ITEM )
 	{
-		log_handle_printf(
-		 log_handle,
-		 "Skipping message transport headers file: %" PRIs_LIBCSTRING_SYSTEM " it already exists.",
-		 transport_headers_filename );
+		if( export_handle_export_attachment_item(
+		     export_handle,
+		     attachment,
+		     attachment_index,
+		     export_path,
+		     export_path_length,
+		     log_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to export attachment item.",
+			 function );
 
-		return( 1 );
+			return( -1 );
+		}
 	}
-	if( export_handle_export_message_transport_headers_to_item_file(
-	     export_handle,
-	     message,
-	     message_transport_headers_size,
-	     item_file,
-	     error ) != 1 )
+	return( 1 );
+}
+
+/* Copies the attachment data extents from the source file to the attachment file
+ * This bypasses reading the attachment data into a buffer and is only available
+ * if the attachment data is stored unencrypted in data blocks
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int export_handle_copy_attachment_data_extents(
+     export_handle_t *export_handle,
+     libpff_item_t *attachment,
+     size64_t attachment_data_size,
+     FILE *attachment_file_stream,
+     libcerror_error_t **error )
+{
+	static char *function          = "export_handle_copy_attachment_data_extents";
+
+#if defined( EXPORT_HANDLE_HAVE_COPY_EXTENTS )
+	off64_t extent_offset          = 0;
+	off_t source_offset            = 0;
+	size64_t extent_size           = 0;
+	size64_t extents_size          = 0;
+	size_t copy_size               = 0;
+	ssize_t copy_count             = 0;
+	int extent_index               = 0;
+	int number_of_extents          = 0;
+	int result                     = 0;
+	int target_file_descriptor     = 0;
+#endif
+
+	if( export_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to export message transport headers.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( item_file_close(
-	     item_file,
-	     error ) != 0 )
+	if( attachment_file_stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-		 "%s: unable to close item file.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attachment file stream.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( item_file_free(
-	     &item_file,
-	     error ) != 1 )
+#if defined( EXPORT_HANDLE_HAVE_COPY_EXTENTS )
+	if( export_handle->source_file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	result = libpff_attachment_get_number_of_data_extents(
+	          attachment,
+	          &number_of_extents,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free item file.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of attachment data extents.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	return( 1 );
-
-on_error:
-	if( item_file != NULL )
+	else if( result == 0 )
 	{
-		item_file_free(
-		 &item_file,
-		 NULL );
+		return( 0 );
 	}
-	return( -1 );
-}
-
-/* Exports the transport message headers to an item file
- * Returns 1 if successful or -1 on error
- */
-int export_handle_export_message_transport_headers_to_item_file(
-     export_handle_t *export_handle,
-     libpff_item_t *message,
-     size_t message_transport_headers_size,
-     item_file_t *item_file,
-     libcerror_error_t **error )
-{
-	uint8_t *entry_string = NULL;
-	static char *function = "export_handle_export_message_transport_headers_to_item_file";
+	/* Only copy the extents if they contain exactly the attachment data
+	 */
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		if( libpff_attachment_get_data_extent_by_index(
+		     attachment,
+		     extent_index,
+		     &extent_offset,
+		     &extent_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attachment data extent: %d.",
+			 function,
+			 extent_index );
 
-	if( export_handle == NULL )
+			return( -1 );
+		}
+		extents_size += extent_size;
+	}
+	if( extents_size != attachment_data_size )
+	{
+		return( 0 );
+	}
+	if( fflush(
+	     attachment_file_stream ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export handle.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush attachment file stream.",
 		 function );
 
 		return( -1 );
 	}
-	if( message_transport_headers_size > 0 )
-	{
-		entry_string = (uint8_t *) memory_allocate(
-					    sizeof( uint8_t ) * message_transport_headers_size );
-
-		if( entry_string == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create transport headers.",
-			 function );
+	target_file_descriptor = fileno(
+	                          attachment_file_stream );
 
-			goto on_error;
-		}
-		if( libpff_message_get_utf8_transport_headers(
-		     message,
-		     entry_string,
-		     message_transport_headers_size,
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		if( libpff_attachment_get_data_extent_by_index(
+		     attachment,
+		     extent_index,
+		     &extent_offset,
+		     &extent_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve transport headers.",
-			 function );
+			 "%s: unable to retrieve attachment data extent: %d.",
+			 function,
+			 extent_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		/* Do not write the end of string
-		 */
-		if( item_file_write_buffer(
-		     item_file,
-		     entry_string,
-		     message_transport_headers_size - 1,
-		     error ) != 1 )
+		source_offset = (off_t) extent_offset;
+
+		while( extent_size > 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write transport headers.",
-			 function );
+			if( extent_size > (size64_t) INT32_MAX )
+			{
+				copy_size = (size_t) INT32_MAX;
+			}
+			else
+			{
+				copy_size = (size_t) extent_size;
+			}
+			copy_count = sendfile(
+			              target_file_descriptor,
+			              export_handle->source_file_descriptor,
+			              &source_offset,
+			              copy_size );
 
-			goto on_error;
-		}
-		memory_free(
-		 entry_string );
+			if( copy_count <= 0 )
+			{
+				/* Remove the partially copied data and fall back to reading
+				 * the attachment data using libpff
+				 */
+				if( ( ftruncate(
+				       target_file_descriptor,
+				       0 ) != 0 )
+				 || ( lseek(
+				       target_file_descriptor,
+				       0,
+				       SEEK_SET ) == -1 ) )
+				{
+					libcerror_system_set_error(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 errno,
+					 "%s: unable to truncate attachment file.",
+					 function );
 
-		entry_string = NULL;
+					return( -1 );
+				}
+				return( 0 );
+			}
+			extent_size -= (size64_t) copy_count;
+		}
 	}
 	return( 1 );
-
-on_error:
-	if( entry_string != NULL )
-	{
-		memory_free(
-		 entry_string );
-	}
-	return( -1 );
+#else
+	return( 0 );
+#endif
 }
 
-/* Exports the attachments
- * Returns 1 if successful or -1 on error
+/* Determines if the attachment data is a duplicate of attachment data in the attachment store
+ * The attachment data is only hashed here if attachment data of the same size was stored,
+ * otherwise the hash is calculated while the attachment data is written
+ * Returns 1 if the attachment data is a duplicate, 0 if not or -1 on error
  */
-int export_handle_export_attachments(
+int export_handle_get_duplicate_attachment_data(
      export_handle_t *export_handle,
-     libpff_item_t *item,
-     const libcstring_system_character_t *export_path,
-     size_t export_path_length,
-     log_handle_t *log_handle,
+     libpff_item_t *attachment,
+     size64_t attachment_data_size,
+     attachment_store_entry_t **stored_entry,
      libcerror_error_t **error )
 {
-	libpff_item_t *attachment                       = NULL;
-	libpff_item_t *attachments                      = NULL;
-	libcstring_system_character_t *attachments_path = NULL;
-	static char *function                           = "export_handle_export_attachments";
-	size_t attachments_path_size                    = 0;
-	int attachment_index                            = 0;
-	int number_of_attachments                       = 0;
-	int result                                      = 0;
+	uint8_t *attachment_data     = NULL;
+	static char *function        = "export_handle_get_duplicate_attachment_data";
+	size64_t remaining_data_size = 0;
+	size_t read_size             = 0;
+	ssize_t read_count           = 0;
+	int result                   = 0;
 
 	if( export_handle == NULL )
 	{
@@ -6112,294 +10545,194 @@ int export_handle_export_attachments(
 
 		return( -1 );
 	}
-	if( item == NULL )
+	if( export_handle->attachment_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing attachment store.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid item.",
+		 "%s: invalid stored entry.",
 		 function );
 
 		return( -1 );
 	}
-	if( libpff_message_get_number_of_attachments(
-	     item,
-	     &number_of_attachments,
+	if( attachment_store_start_data(
+	     export_handle->attachment_store,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to start hashing attachment data.",
+		 function );
+
+		goto on_error;
+	}
+	result = attachment_store_has_data_size(
+	          export_handle->attachment_store,
+	          attachment_data_size,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of attachments.",
+		 "%s: unable to determine if attachment store contains data size.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libpff_attachment_data_seek_offset(
+	     attachment,
+	     0,
+	     SEEK_SET,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek the start of the attachment data.",
+		 function );
+
+		goto on_error;
+	}
+	attachment_data = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * EXPORT_HANDLE_ATTACHMENT_DATA_BUFFER_SIZE );
+
+	if( attachment_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create attachment data.",
 		 function );
 
 		goto on_error;
 	}
-	if( number_of_attachments > 0 )
+	remaining_data_size = attachment_data_size;
+
+	while( remaining_data_size > 0 )
 	{
-		/* Create the attachments directory
-		 */
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libcpath_path_join_wide(
-		          &attachments_path,
-		          &attachments_path_size,
-		          export_path,
-		          export_path_length,
-		          _LIBCSTRING_SYSTEM_STRING( "Attachments" ),
-		          11,
-		          error );
-#else
-		result = libcpath_path_join(
-		          &attachments_path,
-		          &attachments_path_size,
-		          export_path,
-		          export_path_length,
-		          _LIBCSTRING_SYSTEM_STRING( "Attachments" ),
-		          11,
-		          error );
-#endif
-		if( result != 1 )
+		if( remaining_data_size >= EXPORT_HANDLE_ATTACHMENT_DATA_BUFFER_SIZE )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable create attachments path.",
-			 function );
-
-			goto on_error;
+			read_size = EXPORT_HANDLE_ATTACHMENT_DATA_BUFFER_SIZE;
 		}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libcfile_file_exists_wide(
-			  attachments_path,
-		          error );
-#else
-		result = libcfile_file_exists(
-			  attachments_path,
-		          error );
-#endif
-		if( result == -1 )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_GENERIC,
-			 "%s: unable to determine if %" PRIs_LIBCSTRING_SYSTEM " exists.",
-			 function,
-			 attachments_path );
-
-			goto on_error;
+			read_size = (size_t) remaining_data_size;
 		}
-		else if( result != 0 )
+		remaining_data_size -= read_size;
+
+		read_count = libpff_attachment_data_read_buffer(
+		              attachment,
+		              attachment_data,
+		              read_size,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_GENERIC,
-			 "%s: %" PRIs_LIBCSTRING_SYSTEM " already exists.",
-			 function,
-			 attachments_path );
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read attachment data.",
+			 function );
 
 			goto on_error;
 		}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		if( libcpath_path_make_directory_wide(
-		     attachments_path,
-		     error ) != 1 )
-#else
-		if( libcpath_path_make_directory(
-		     attachments_path,
+		if( attachment_store_update_data(
+		     export_handle->attachment_store,
+		     attachment_data,
+		     read_size,
 		     error ) != 1 )
-#endif
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to make directory: %" PRIs_LIBCSTRING_SYSTEM ".",
-			 function,
-			 attachments_path );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to hash attachment data.",
+			 function );
 
 			goto on_error;
 		}
-		log_handle_printf(
-		 log_handle,
-		 "Created directory: %" PRIs_LIBCSTRING_SYSTEM ".\n",
-		 attachments_path );
-
-		if( export_handle->dump_item_values != 0 )
-		{
-			result = libpff_message_get_attachments(
-				  item,
-				  &attachments,
-				  error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve attachments.",
-				 function );
-
-				goto on_error;
-			}
-			else if( result == 1 )
-			{
-				if( export_handle_export_item_values(
-				     export_handle,
-				     attachments,
-				     _LIBCSTRING_SYSTEM_STRING( "ItemValues.txt" ),
-				     14,
-				     attachments_path,
-				     attachments_path_size - 1,
-				     log_handle,
-				     error ) != 1 )
-				{
-					if( libcnotify_verbose != 0 )
-					{
-						libcnotify_printf(
-						 "%s: unable to export item values.\n",
-						 function );
-					}
-					if( ( error != NULL )
-					 && ( *error != NULL ) )
-					{
-						libcnotify_print_error_backtrace(
-						 *error );
-					}
-					libcerror_error_free(
-					 error );
+	}
+	memory_free(
+	 attachment_data );
 
-					log_handle_printf(
-					 log_handle,
-					 "Unable to export attachments item values.\n" );
-				}
-				if( libpff_item_free(
-				     &attachments,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free attachments.",
-					 function );
+	attachment_data = NULL;
 
-					goto on_error;
-				}
-			}
-		}
-		/* Create the attachments files
-		 */
-		for( attachment_index = 0;
-		     attachment_index < number_of_attachments;
-		     attachment_index++ )
-		{
-			if( export_handle->abort != 0 )
-			{
-				return( -1 );
-			}
-			if( export_handle->print_status_information != 0 )
-			{
-				fprintf(
-				 export_handle->notify_stream,
-				 "Exporting attachment %d out of %d.\n",
-				 attachment_index + 1,
-				 number_of_attachments );
-			}
-			if( libpff_message_get_attachment(
-			     item,
-			     attachment_index,
-			     &attachment,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve attachment.",
-				 function );
+	if( attachment_store_finish_data(
+	     export_handle->attachment_store,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to finish hashing attachment data.",
+		 function );
 
-				goto on_error;
-			}
-			if( export_handle_export_attachment(
-			     export_handle,
-			     attachment,
-			     attachment_index,
-			     number_of_attachments,
-			     attachments_path,
-			     attachments_path_size - 1,
-			     log_handle,
-			     error ) != 1 )
-			{
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: unable to export attachment: %d.\n",
-					 function,
-					 attachment_index + 1 );
-				}
-				if( ( error != NULL )
-				 && ( *error != NULL ) )
-				{
-					libcnotify_print_error_backtrace(
-					 *error );
-				}
-				libcerror_error_free(
-				 error );
+		goto on_error;
+	}
+	result = attachment_store_get_entry(
+	          export_handle->attachment_store,
+	          attachment_data_size,
+	          stored_entry,
+	          error );
 
-				log_handle_printf(
-				 log_handle,
-				 "Unable to export attachment: %d.\n",
-				 attachment_index + 1 );
-			}
-			if( libpff_item_free(
-			     &attachment,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free attachment.",
-				 function );
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry from attachment store.",
+		 function );
 
-				goto on_error;
-			}
-		}
-		memory_free(
-		 attachments_path );
+		goto on_error;
 	}
-	return( 1 );
+	return( result );
 
 on_error:
-	if( attachments_path != NULL )
+	if( attachment_data != NULL )
 	{
 		memory_free(
-		 attachments_path );
+		 attachment_data );
 	}
 	return( -1 );
 }
 
-/* Exports the attachment
- * Returns 1 if successful or -1 on error
+/* Links the attachment data to previously written attachment data
+ * In an archive a link entry is added, otherwise a hard link is created
+ * Returns 1 if successful, 0 if the attachment data could not be linked or -1 on error
  */
-int export_handle_export_attachment(
+int export_handle_link_attachment_data(
      export_handle_t *export_handle,
-     libpff_item_t *attachment,
-     int attachment_index,
-     int number_of_attachments,
-     const libcstring_system_character_t *export_path,
-     size_t export_path_length,
-     log_handle_t *log_handle,
+     const libcstring_system_character_t *stored_path,
+     const libcstring_system_character_t *target_path,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_export_attachment";
-	int attachment_type   = 0;
+	static char *function = "export_handle_link_attachment_data";
 
 	if( export_handle == NULL )
 	{
@@ -6412,96 +10745,63 @@ int export_handle_export_attachment(
 
 		return( -1 );
 	}
-	if( libpff_attachment_get_type(
-	     attachment,
-	     &attachment_type,
-	     error ) != 1 )
+	if( stored_path == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve attachment type.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stored path.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( attachment_type != LIBPFF_ATTACHMENT_TYPE_DATA )
-	 && ( attachment_type != LIBPFF_ATTACHMENT_TYPE_ITEM )
-	 && ( attachment_type != LIBPFF_ATTACHMENT_TYPE_REFERENCE ) )
-	{
-		fprintf(
-		 export_handle->notify_stream,
-		 "Unsupported attachment type.\n" );
-
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: unsupported attachment type.\n",
-			 function );
-		}
-		log_handle_printf(
-		 log_handle,
-		 "Unsupported attachment type.\n" );
-
-		return( 1 );
-	}
-	if( attachment_type == LIBPFF_ATTACHMENT_TYPE_REFERENCE )
+	if( target_path == NULL )
 	{
-		fprintf(
-		 export_handle->notify_stream,
-		 "Attachment is stored externally.\n" );
-
-		log_handle_printf(
-		 log_handle,
-		 "Attachment is stored externally.\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target path.",
+		 function );
 
-		return( 1 );
+		return( -1 );
 	}
-	if( attachment_type == LIBPFF_ATTACHMENT_TYPE_DATA )
+	if( export_handle->archive_file != NULL )
 	{
-		if( export_handle_export_attachment_data(
-		     export_handle,
-		     attachment,
-		     attachment_index,
-		     number_of_attachments,
-		     export_path,
-		     export_path_length,
-		     log_handle,
+		/* The entry names in the archive are relative to the base path
+		 */
+		if( archive_file_add_link(
+		     export_handle->archive_file,
+		     &( target_path[ export_handle->base_path_length ] ),
+		     &( stored_path[ export_handle->base_path_length ] ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to export attachment data.",
-			 function );
+			 "%s: unable to add archive link: %" PRIs_LIBCSTRING_SYSTEM ".",
+			 function,
+			 target_path );
 
 			return( -1 );
 		}
+		return( 1 );
 	}
-	else if( attachment_type == LIBPFF_ATTACHMENT_TYPE_ITEM )
+#if defined( HAVE_LINK ) && !defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	/* If the file system does not support hard links the attachment data is written instead
+	 */
+	if( link(
+	     stored_path,
+	     target_path ) != 0 )
 	{
-		if( export_handle_export_attachment_item(
-		     export_handle,
-		     attachment,
-		     attachment_index,
-		     export_path,
-		     export_path_length,
-		     log_handle,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to export attachment item.",
-			 function );
-
-			return( -1 );
-		}
+		return( 0 );
 	}
 	return( 1 );
+#else
+	return( 0 );
+#endif
 }
 
 /* Exports the attachment data
@@ -6517,12 +10817,14 @@ int export_handle_export_attachment_data(
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
+	attachment_store_entry_t *stored_entry             = NULL;
 	libcstring_system_character_t *attachment_filename = NULL;
 	libcstring_system_character_t *target_path         = NULL;
 	uint8_t *attachment_data                           = NULL;
 	FILE *attachment_file_stream                       = NULL;
 	static char *function                              = "export_handle_export_attachment_data";
 	size64_t attachment_data_size                      = 0;
+	size64_t data_size                                 = 0;
 	size_t attachment_filename_index                   = 0;
 	size_t attachment_filename_size                    = 0;
 	size_t read_size                                   = 0;
@@ -6530,6 +10832,9 @@ int export_handle_export_attachment_data(
 	size_t target_path_size                            = 0;
 	size_t write_count                                 = 0;
 	ssize_t read_count                                 = 0;
+	uint8_t archive_entry_is_open                      = 0;
+	uint8_t hash_attachment_data                       = 0;
+	uint8_t is_duplicate                               = 0;
 	int print_count                                    = 0;
 	int result                                         = 0;
 
@@ -6728,15 +11033,11 @@ int export_handle_export_attachment_data(
 
 		goto on_error;
 	}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcfile_file_exists_wide(
-		  target_path,
-	          error );
-#else
-	result = libcfile_file_exists(
-		  target_path,
+	result = export_handle_path_exists(
+	          export_handle,
+	          target_path,
 	          error );
-#endif
+
 	if( result == -1 )
 	{
 		libcerror_error_set(
@@ -6777,29 +11078,6 @@ int export_handle_export_attachment_data(
 
 		goto on_error;
 	}
-	/* Create the attachment file
-	 */
-	attachment_file_stream = libcsystem_file_stream_open(
-				  target_path,
-				  _LIBCSTRING_SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
-
-	if( attachment_file_stream == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open: %" PRIs_LIBCSTRING_SYSTEM ".",
-		 function,
-		 target_path );
-
-		goto on_error;
-	}
-	memory_free(
-	 target_path );
-
-	target_path = NULL;
-
 	result = libpff_attachment_get_data_size(
 		  attachment,
 		  &attachment_data_size,
@@ -6816,10 +11094,163 @@ int export_handle_export_attachment_data(
 
 		goto on_error;
 	}
+	else if( result == 0 )
+	{
+		attachment_data_size = 0;
+	}
+	data_size = attachment_data_size;
+
+	if( ( export_handle->attachment_store != NULL )
+	 && ( attachment_data_size > 0 ) )
+	{
+		result = export_handle_get_duplicate_attachment_data(
+		          export_handle,
+		          attachment,
+		          attachment_data_size,
+		          &stored_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if attachment data is a duplicate.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			is_duplicate = 1;
+
+			result = export_handle_link_attachment_data(
+			          export_handle,
+			          stored_entry->location,
+			          target_path,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to link attachment data.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				log_handle_printf(
+				 log_handle,
+				 "Attachment data is a duplicate of: %" PRIs_LIBCSTRING_SYSTEM "\n",
+				 stored_entry->location );
+
+				if( attachment_store_add_duplicate(
+				     export_handle->attachment_store,
+				     attachment_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to add duplicate to attachment store.",
+					 function );
+
+					goto on_error;
+				}
+				memory_free(
+				 target_path );
+
+				return( 1 );
+			}
+			/* The attachment data is written if it cannot be linked
+			 */
+		}
+		/* Attachment data of a unique size is hashed while it is written
+		 */
+		else if( export_handle->attachment_store->digests_are_set == 0 )
+		{
+			hash_attachment_data = 1;
+		}
+	}
+	/* Create the attachment file
+	 */
+	if( export_handle->archive_file != NULL )
+	{
+		/* The size of an archive entry is written before its data
+		 */
+		if( archive_file_open_entry(
+		     export_handle->archive_file,
+		     &( target_path[ export_handle->base_path_length ] ),
+		     attachment_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open archive entry: %" PRIs_LIBCSTRING_SYSTEM ".",
+			 function,
+			 target_path );
+
+			goto on_error;
+		}
+		archive_entry_is_open = 1;
+	}
+	else
+	{
+		attachment_file_stream = libcsystem_file_stream_open(
+					  target_path,
+					  _LIBCSTRING_SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+
+		if( attachment_file_stream == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open: %" PRIs_LIBCSTRING_SYSTEM ".",
+			 function,
+			 target_path );
+
+			goto on_error;
+		}
+	}
+	if( ( attachment_file_stream != NULL )
+	 && ( attachment_data_size > 0 )
+	 && ( hash_attachment_data == 0 ) )
+	{
+		result = export_handle_copy_attachment_data_extents(
+		          export_handle,
+		          attachment,
+		          attachment_data_size,
+		          attachment_file_stream,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to copy attachment data extents.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			attachment_data_size = 0;
+		}
+	}
 	/* If there is no attachment data an empty file is written
 	 */
-	if( ( result != 0 )
-	 && ( attachment_data_size > 0 ) )
+	if( attachment_data_size > 0 )
 	{
 		/* This function in not necessary for normal use
 		 * but it was added for testing
@@ -6840,7 +11271,7 @@ int export_handle_export_attachment_data(
 			goto on_error;
 		}
 		attachment_data = (uint8_t *) memory_allocate(
-					       sizeof( uint8_t ) * EXPORT_HANDLE_BUFFER_SIZE );
+					       sizeof( uint8_t ) * EXPORT_HANDLE_ATTACHMENT_DATA_BUFFER_SIZE );
 
 		if( attachment_data == NULL )
 		{
@@ -6855,9 +11286,9 @@ int export_handle_export_attachment_data(
 		}
 		while( attachment_data_size > 0 )
 		{
-			if( attachment_data_size >= EXPORT_HANDLE_BUFFER_SIZE )
+			if( attachment_data_size >= EXPORT_HANDLE_ATTACHMENT_DATA_BUFFER_SIZE )
 			{
-				read_size = EXPORT_HANDLE_BUFFER_SIZE;
+				read_size = EXPORT_HANDLE_ATTACHMENT_DATA_BUFFER_SIZE;
 			}
 			else
 			{
@@ -6882,6 +11313,43 @@ int export_handle_export_attachment_data(
 
 				goto on_error;
 			}
+			if( hash_attachment_data != 0 )
+			{
+				if( attachment_store_update_data(
+				     export_handle->attachment_store,
+				     attachment_data,
+				     read_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to hash attachment data.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( archive_entry_is_open != 0 )
+			{
+				if( archive_file_write_entry_data(
+				     export_handle->archive_file,
+				     attachment_data,
+				     read_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write attachment data to archive entry.",
+					 function );
+
+					goto on_error;
+				}
+				continue;
+			}
 			write_count = libcsystem_file_stream_write(
 				       attachment_file_stream,
 				       attachment_data,
@@ -6891,34 +11359,98 @@ int export_handle_export_attachment_data(
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write attachment data.",
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write attachment data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		memory_free(
+		 attachment_data );
+
+		attachment_data = NULL;
+
+		if( hash_attachment_data != 0 )
+		{
+			if( attachment_store_finish_data(
+			     export_handle->attachment_store,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to finish hashing attachment data.",
 				 function );
 
 				goto on_error;
 			}
 		}
-		memory_free(
-		 attachment_data );
+	}
+	if( archive_entry_is_open != 0 )
+	{
+		archive_entry_is_open = 0;
 
-		attachment_data = NULL;
+		if( archive_file_close_entry(
+		     export_handle->archive_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close archive entry.",
+			 function );
+
+			goto on_error;
+		}
 	}
-	if( libcsystem_file_stream_close(
-	     attachment_file_stream ) != 0 )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-		 "%s: unable to close attachment file.",
-		 function );
+		if( libcsystem_file_stream_close(
+		     attachment_file_stream ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close attachment file.",
+			 function );
+
+			attachment_file_stream = NULL;
 
+			goto on_error;
+		}
 		attachment_file_stream = NULL;
+	}
+	/* The written attachment data is stored for later duplicates to refer to
+	 */
+	if( ( export_handle->attachment_store != NULL )
+	 && ( data_size > 0 )
+	 && ( is_duplicate == 0 ) )
+	{
+		if( attachment_store_add_entry(
+		     export_handle->attachment_store,
+		     data_size,
+		     target_path,
+		     target_path_size - 1,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to add attachment data to attachment store.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-	attachment_file_stream = NULL;
+	memory_free(
+	 target_path );
 
 	return( 1 );
 
@@ -6928,6 +11460,14 @@ on_error:
 		memory_free(
 		 attachment_data );
 	}
+	/* The archive entry is closed to keep the archive file consistent
+	 */
+	if( archive_entry_is_open != 0 )
+	{
+		archive_file_close_entry(
+		 export_handle->archive_file,
+		 NULL );
+	}
 	if( attachment_file_stream != NULL )
 	{
 		libcsystem_file_stream_close(
@@ -7053,15 +11593,11 @@ int export_handle_export_attachment_item(
 
 	attachment_filename = NULL;
 
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcfile_file_exists_wide(
-		  target_path,
-	          error );
-#else
-	result = libcfile_file_exists(
-		  target_path,
+	result = export_handle_path_exists(
+	          export_handle,
+	          target_path,
 	          error );
-#endif
+
 	if( result == -1 )
 	{
 		libcerror_error_set(
@@ -7086,15 +11622,10 @@ int export_handle_export_attachment_item(
 
 		return( -1 );
 	}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libcpath_path_make_directory_wide(
-	     target_path,
-	     error ) != 1 )
-#else
-	if( libcpath_path_make_directory(
+	if( export_handle_make_directory(
+	     export_handle,
 	     target_path,
 	     error ) != 1 )
-#endif
 	{
 		libcerror_error_set(
 		 error,
@@ -7905,6 +12436,19 @@ int export_handle_export_activity(
 			 identifier );
 		}
 	}
+	if( export_handle->json_file != NULL )
+	{
+		return( export_handle_export_item_json(
+		         export_handle,
+		         activity,
+		         activity_index,
+		         _LIBCSTRING_SYSTEM_STRING( "Activity" ),
+		         8,
+		         export_path,
+		         export_path_length,
+		         log_handle,
+		         error ) );
+	}
 	if( export_handle_create_default_item_directory(
 	     export_handle,
 	     activity_index,
@@ -8285,6 +12829,19 @@ int export_handle_export_appointment(
 			 identifier );
 		}
 	}
+	if( export_handle->json_file != NULL )
+	{
+		return( export_handle_export_item_json(
+		         export_handle,
+		         appointment,
+		         appointment_index,
+		         _LIBCSTRING_SYSTEM_STRING( "Appointment" ),
+		         11,
+		         export_path,
+		         export_path_length,
+		         log_handle,
+		         error ) );
+	}
 	if( export_handle_create_default_item_directory(
 	     export_handle,
 	     appointment_index,
@@ -8804,6 +13361,19 @@ int export_handle_export_contact(
 			 identifier );
 		}
 	}
+	if( export_handle->json_file != NULL )
+	{
+		return( export_handle_export_item_json(
+		         export_handle,
+		         contact,
+		         contact_index,
+		         _LIBCSTRING_SYSTEM_STRING( "Contact" ),
+		         7,
+		         export_path,
+		         export_path_length,
+		         log_handle,
+		         error ) );
+	}
 	if( export_handle_create_default_item_directory(
 	     export_handle,
 	     contact_index,
@@ -9794,6 +14364,19 @@ int export_handle_export_document(
 			 identifier );
 		}
 	}
+	if( export_handle->json_file != NULL )
+	{
+		return( export_handle_export_item_json(
+		         export_handle,
+		         document,
+		         document_index,
+		         _LIBCSTRING_SYSTEM_STRING( "Document" ),
+		         8,
+		         export_path,
+		         export_path_length,
+		         log_handle,
+		         error ) );
+	}
 	if( export_handle_create_default_item_directory(
 	     export_handle,
 	     document_index,
@@ -10087,6 +14670,19 @@ int export_handle_export_email(
 			 identifier );
 		}
 	}
+	if( export_handle->json_file != NULL )
+	{
+		return( export_handle_export_item_json(
+		         export_handle,
+		         email,
+		         email_index,
+		         _LIBCSTRING_SYSTEM_STRING( "Message" ),
+		         7,
+		         export_path,
+		         export_path_length,
+		         log_handle,
+		         error ) );
+	}
 	if( export_handle_create_default_item_directory(
 	     export_handle,
 	     email_index,
@@ -10936,6 +15532,19 @@ int export_handle_export_meeting(
 			 identifier );
 		}
 	}
+	if( export_handle->json_file != NULL )
+	{
+		return( export_handle_export_item_json(
+		         export_handle,
+		         meeting,
+		         meeting_index,
+		         _LIBCSTRING_SYSTEM_STRING( "Meeting" ),
+		         7,
+		         export_path,
+		         export_path_length,
+		         log_handle,
+		         error ) );
+	}
 	if( export_handle_create_default_item_directory(
 	     export_handle,
 	     meeting_index,
@@ -11262,6 +15871,19 @@ int export_handle_export_note(
 			 identifier );
 		}
 	}
+	if( export_handle->json_file != NULL )
+	{
+		return( export_handle_export_item_json(
+		         export_handle,
+		         note,
+		         note_index,
+		         _LIBCSTRING_SYSTEM_STRING( "Note" ),
+		         4,
+		         export_path,
+		         export_path_length,
+		         log_handle,
+		         error ) );
+	}
 	if( export_handle_create_default_item_directory(
 	     export_handle,
 	     note_index,
@@ -11645,6 +16267,19 @@ int export_handle_export_rss_feed(
 			 identifier );
 		}
 	}
+	if( export_handle->json_file != NULL )
+	{
+		return( export_handle_export_item_json(
+		         export_handle,
+		         rss_feed,
+		         rss_feed_index,
+		         _LIBCSTRING_SYSTEM_STRING( "Feed" ),
+		         4,
+		         export_path,
+		         export_path_length,
+		         log_handle,
+		         error ) );
+	}
 	if( export_handle_create_default_item_directory(
 	     export_handle,
 	     rss_feed_index,
@@ -12053,6 +16688,19 @@ int export_handle_export_task(
 			 identifier );
 		}
 	}
+	if( export_handle->json_file != NULL )
+	{
+		return( export_handle_export_item_json(
+		         export_handle,
+		         task,
+		         task_index,
+		         _LIBCSTRING_SYSTEM_STRING( "Task" ),
+		         4,
+		         export_path,
+		         export_path_length,
+		         log_handle,
+		         error ) );
+	}
 	if( export_handle_create_default_item_directory(
 	     export_handle,
 	     task_index,
@@ -12808,15 +17456,11 @@ int export_handle_export_folder(
 
 		goto on_error;
 	}
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcfile_file_exists_wide(
-	          target_path,
-	          error );
-#else
-	result = libcfile_file_exists(
+	result = export_handle_path_exists(
+	          export_handle,
 	          target_path,
 	          error );
-#endif
+
 	if( result == -1 )
 	{
 		libcerror_error_set(
@@ -12898,15 +17542,10 @@ int export_handle_export_folder(
 
 	folder_name = NULL;
 
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libcpath_path_make_directory_wide(
-	     target_path,
-	     error ) != 1 )
-#else
-	if( libcpath_path_make_directory(
+	if( export_handle_make_directory(
+	     export_handle,
 	     target_path,
 	     error ) != 1 )
-#endif
 	{
 		libcerror_error_set(
 		 error,
@@ -13206,6 +17845,127 @@ int export_handle_export_sub_folders(
 	return( 1 );
 }
 
+/* Determines if a sub message is unchanged since the previous export
+ * The identifiers are retrieved from the item descriptor and the modification time
+ * from the folder contents table, so the sub message itself is not read
+ * Returns 1 if the sub message is unchanged, 0 if new or changed or -1 on error
+ */
+int export_handle_sub_message_is_unchanged(
+     export_handle_t *export_handle,
+     libpff_item_t *folder,
+     int sub_message_index,
+     libpff_item_t *sub_message,
+     uint32_t *sub_message_identifier,
+     uint64_t *data_identifier,
+     uint64_t *modification_time,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_sub_message_is_unchanged";
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_message_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub message identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( modification_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid modification time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_item_get_identifier(
+	     sub_message,
+	     sub_message_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub message identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_item_get_data_identifier(
+	     sub_message,
+	     data_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub message data identifier.",
+		 function );
+
+		return( -1 );
+	}
+	result = libpff_folder_get_sub_message_modification_time(
+	          folder,
+	          sub_message_index,
+	          modification_time,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub message modification time.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		*modification_time = 0;
+	}
+	result = export_manifest_item_is_unchanged(
+	          export_handle->export_manifest,
+	          *sub_message_identifier,
+	          *data_identifier,
+	          *modification_time,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if sub message is unchanged.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Exports the sub messages
  * Returns 1 if successful or -1 on error
  */
@@ -13217,10 +17977,17 @@ int export_handle_export_sub_messages(
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	libpff_item_t *sub_message = NULL;
-	static char *function      = "export_handle_export_sub_messages";
-	int number_of_sub_messages = 0;
-	int sub_message_iterator   = 0;
+	const libcstring_system_character_t *folder_path = NULL;
+	libpff_item_t *sub_message                      = NULL;
+	static char *function                           = "export_handle_export_sub_messages";
+	size_t folder_path_length                       = 0;
+	uint64_t data_identifier                        = 0;
+	uint64_t modification_time                      = 0;
+	uint32_t sub_message_identifier                 = 0;
+	int folder_path_matches                         = 1;
+	int number_of_sub_messages                      = 0;
+	int result                                      = 0;
+	int sub_message_iterator                        = 0;
 
 	if( export_handle == NULL )
 	{
@@ -13269,6 +18036,37 @@ int export_handle_export_sub_messages(
 
 		return( -1 );
 	}
+	/* The folder path is matched relative to the items export path
+	 */
+	if( export_path_length >= export_handle->items_export_path_size )
+	{
+		folder_path        = &( export_path[ export_handle->items_export_path_size ] );
+		folder_path_length = export_path_length - export_handle->items_export_path_size;
+	}
+	else
+	{
+		folder_path = _LIBCSTRING_SYSTEM_STRING( "" );
+	}
+	folder_path_matches = export_filter_match_folder_path(
+	                       export_handle->export_filter,
+	                       folder_path,
+	                       folder_path_length );
+
+	/* Without a manifest the sub messages of a folder that does not match
+	 * are skipped without retrieving them
+	 */
+	if( ( folder_path_matches == 0 )
+	 && ( export_handle->export_manifest == NULL ) )
+	{
+		log_handle_printf(
+		 log_handle,
+		 "Skipped %d sub messages of folder not matching the folder path filter.\n",
+		 number_of_sub_messages );
+
+		export_handle->export_filter->number_of_filtered_items += (uint64_t) number_of_sub_messages;
+
+		return( 1 );
+	}
 	for( sub_message_iterator = 0;
 	     sub_message_iterator < number_of_sub_messages;
 	     sub_message_iterator++ )
@@ -13292,44 +18090,222 @@ int export_handle_export_sub_messages(
 			 sub_message_iterator + 1,
 			 number_of_sub_messages );
 
-			return( -1 );
+			return( -1 );
+		}
+		if( folder_path_matches == 0 )
+		{
+			result = 0;
+		}
+		else if( export_filter_is_set(
+		          export_handle->export_filter ) != 0 )
+		{
+			result = export_filter_match_sub_message(
+			          export_handle->export_filter,
+			          folder,
+			          sub_message_iterator,
+			          sub_message,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if sub message: %d matches the export filter.",
+				 function,
+				 sub_message_iterator + 1 );
+
+				libpff_item_free(
+				 &sub_message,
+				 NULL );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			result = 1;
+		}
+		if( result == 0 )
+		{
+			log_handle_printf(
+			 log_handle,
+			 "Skipped sub message: %d not matching the export filter.\n",
+			 sub_message_iterator + 1 );
+
+			export_handle->export_filter->number_of_filtered_items += 1;
+
+			/* A sub message that was exported before is kept in the manifest
+			 * so that it is not reported as deleted
+			 */
+			if( export_handle->export_manifest != NULL )
+			{
+				if( libpff_item_get_identifier(
+				     sub_message,
+				     &sub_message_identifier,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve sub message: %d identifier.",
+					 function,
+					 sub_message_iterator + 1 );
+
+					libpff_item_free(
+					 &sub_message,
+					 NULL );
+
+					return( -1 );
+				}
+				if( export_manifest_keep_entry(
+				     export_handle->export_manifest,
+				     sub_message_identifier,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to keep sub message: %d in export manifest.",
+					 function,
+					 sub_message_iterator + 1 );
+
+					libpff_item_free(
+					 &sub_message,
+					 NULL );
+
+					return( -1 );
+				}
+			}
+			if( libpff_item_free(
+			     &sub_message,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sub message: %d.",
+				 function,
+				 sub_message_iterator + 1 );
+
+				return( -1 );
+			}
+			continue;
 		}
-		if( export_handle_export_item(
-		     export_handle,
-		     sub_message,
-		     sub_message_iterator,
-		     number_of_sub_messages,
-		     export_path,
-		     export_path_length,
-		     log_handle,
-		     error ) != 1 )
+		result = 0;
+
+		if( export_handle->export_manifest != NULL )
 		{
-			fprintf(
-			 export_handle->notify_stream,
-			 "Unable to export sub message %d out of %d.\n",
-			 sub_message_iterator + 1,
-			 number_of_sub_messages );
+			result = export_handle_sub_message_is_unchanged(
+			          export_handle,
+			          folder,
+			          sub_message_iterator,
+			          sub_message,
+			          &sub_message_identifier,
+			          &data_identifier,
+			          &modification_time,
+			          error );
 
-			if( libcnotify_verbose != 0 )
+			if( result == -1 )
 			{
-				libcnotify_printf(
-				 "%s: unable to export sub message: %d.\n",
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if sub message: %d is unchanged.",
 				 function,
 				 sub_message_iterator + 1 );
+
+				libpff_item_free(
+				 &sub_message,
+				 NULL );
+
+				return( -1 );
 			}
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
+			else if( result != 0 )
 			{
-				libcnotify_print_error_backtrace(
-				 *error );
+				log_handle_printf(
+				 log_handle,
+				 "Skipped unchanged sub message: %d with identifier: %" PRIu32 ".\n",
+				 sub_message_iterator + 1,
+				 sub_message_identifier );
 			}
-			libcerror_error_free(
-			 error );
+		}
+		/* An unchanged sub message is not exported again
+		 */
+		if( result == 0 )
+		{
+			if( export_handle_export_item(
+			     export_handle,
+			     sub_message,
+			     sub_message_iterator,
+			     number_of_sub_messages,
+			     export_path,
+			     export_path_length,
+			     log_handle,
+			     error ) != 1 )
+			{
+				fprintf(
+				 export_handle->notify_stream,
+				 "Unable to export sub message %d out of %d.\n",
+				 sub_message_iterator + 1,
+				 number_of_sub_messages );
 
-			log_handle_printf(
-			 log_handle,
-			 "Unable to export sub message: %d.\n",
-			 sub_message_iterator + 1 );
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: unable to export sub message: %d.\n",
+					 function,
+					 sub_message_iterator + 1 );
+				}
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+				libcerror_error_free(
+				 error );
+
+				log_handle_printf(
+				 log_handle,
+				 "Unable to export sub message: %d.\n",
+				 sub_message_iterator + 1 );
+
+				/* A sub message that could not be exported is not added to the manifest
+				 * so that the next incremental export tries to export it again
+				 */
+				result = -1;
+			}
+		}
+		if( ( export_handle->export_manifest != NULL )
+		 && ( result != -1 ) )
+		{
+			if( export_manifest_append_entry(
+			     export_handle->export_manifest,
+			     sub_message_identifier,
+			     data_identifier,
+			     modification_time,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append sub message: %d to export manifest.",
+				 function,
+				 sub_message_iterator + 1 );
+
+				libpff_item_free(
+				 &sub_message,
+				 NULL );
+
+				return( -1 );
+			}
 		}
 		if( libpff_item_free(
 		     &sub_message,
@@ -13500,15 +18476,10 @@ int export_handle_export_items(
 	 export_handle->notify_stream,
 	 "Exporting items.\n" );
 
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libcpath_path_make_directory_wide(
-	     export_path,
-	     error ) != 1 )
-#else
-	if( libcpath_path_make_directory(
+	if( export_handle_make_directory(
+	     export_handle,
 	     export_path,
 	     error ) != 1 )
-#endif
 	{
 		libcerror_error_set(
 		 error,
@@ -13689,15 +18660,10 @@ int export_handle_export_orphan_items(
 		 export_handle->notify_stream,
 		 "Exporting orphan items.\n" );
 
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		if( libcpath_path_make_directory_wide(
-		     export_path,
-		     error ) != 1 )
-#else
-		if( libcpath_path_make_directory(
+		if( export_handle_make_directory(
+		     export_handle,
 		     export_path,
 		     error ) != 1 )
-#endif
 		{
 			libcerror_error_set(
 			 error,
@@ -13881,15 +18847,10 @@ int export_handle_export_recovered_items(
 		 export_handle->notify_stream,
 		 "Exporting recovered items.\n" );
 
-#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
-		if( libcpath_path_make_directory_wide(
-		     export_path,
-		     error ) != 1 )
-#else
-		if( libcpath_path_make_directory(
+		if( export_handle_make_directory(
+		     export_handle,
 		     export_path,
 		     error ) != 1 )
-#endif
 		{
 			libcerror_error_set(
 			 error,
@@ -14005,6 +18966,234 @@ int export_handle_export_recovered_items(
 	return( 1 );
 }
 
+/* Prints the recovery progress
+ * The callback data contains the export handle
+ * Returns 1 to continue the recovery or 0 to cancel it
+ */
+int export_handle_recovery_progress_callback(
+     libpff_file_t *file,
+     intptr_t *callback_data )
+{
+	export_handle_t *export_handle = NULL;
+	libcerror_error_t *error       = NULL;
+	size64_t bytes_scanned         = 0;
+	size64_t bytes_to_scan         = 0;
+	uint64_t bytes_per_second      = 0;
+	uint64_t number_of_candidates  = 0;
+	uint64_t number_of_validated   = 0;
+	uint64_t percentage            = 0;
+	uint64_t remaining_seconds     = 0;
+	off64_t current_offset         = 0;
+	uint8_t stage                  = 0;
+	int counter                    = 0;
+
+	export_handle = (export_handle_t *) callback_data;
+
+	if( export_handle == NULL )
+	{
+		return( 0 );
+	}
+	if( export_handle->abort != 0 )
+	{
+		return( 0 );
+	}
+	if( libpff_file_get_recovery_progress(
+	     file,
+	     &stage,
+	     &current_offset,
+	     &bytes_scanned,
+	     &bytes_to_scan,
+	     &bytes_per_second,
+	     &error ) != 1 )
+	{
+		libcerror_error_free(
+		 &error );
+
+		return( 1 );
+	}
+	switch( stage )
+	{
+		case LIBPFF_RECOVERY_STAGE_INDEX_TREES:
+			fprintf(
+			 export_handle->notify_stream,
+			 "Recovering items: scanning index trees.\n" );
+			break;
+
+		case LIBPFF_RECOVERY_STAGE_UNALLOCATED_SPACE:
+			if( bytes_to_scan > 0 )
+			{
+				percentage = ( (uint64_t) bytes_scanned * 100 ) / (uint64_t) bytes_to_scan;
+			}
+			fprintf(
+			 export_handle->notify_stream,
+			 "Recovering items: scanning unallocated space: %" PRIu64 "%% (%" PRIu64 " of %" PRIu64 " MiB) at offset: 0x%08" PRIx64 ", %" PRIu64 " KiB/s",
+			 percentage,
+			 (uint64_t) bytes_scanned / ( 1024 * 1024 ),
+			 (uint64_t) bytes_to_scan / ( 1024 * 1024 ),
+			 current_offset,
+			 bytes_per_second / 1024 );
+
+			if( bytes_per_second > 0 )
+			{
+				remaining_seconds = (uint64_t) ( bytes_to_scan - bytes_scanned ) / bytes_per_second;
+
+				fprintf(
+				 export_handle->notify_stream,
+				 ", ETA: %02" PRIu64 ":%02" PRIu64 ":%02" PRIu64 "",
+				 remaining_seconds / 3600,
+				 ( remaining_seconds / 60 ) % 60,
+				 remaining_seconds % 60 );
+			}
+			fprintf(
+			 export_handle->notify_stream,
+			 ".\n" );
+			break;
+
+		case LIBPFF_RECOVERY_STAGE_ITEMS:
+			if( libpff_file_get_recovery_counter(
+			     file,
+			     LIBPFF_RECOVERY_COUNTER_ITEMS,
+			     &number_of_candidates,
+			     &number_of_validated,
+			     &error ) != 1 )
+			{
+				libcerror_error_free(
+				 &error );
+
+				return( 1 );
+			}
+			fprintf(
+			 export_handle->notify_stream,
+			 "Recovering items: validating items: %" PRIu64 " of %" PRIu64 " candidates recoverable.\n",
+			 number_of_validated,
+			 number_of_candidates );
+			break;
+
+		case LIBPFF_RECOVERY_STAGE_COMPLETED:
+			fprintf(
+			 export_handle->notify_stream,
+			 "Recovering items: completed" );
+
+			for( counter = LIBPFF_RECOVERY_COUNTER_INDEX_NODES;
+			     counter <= LIBPFF_RECOVERY_COUNTER_ITEMS;
+			     counter++ )
+			{
+				if( libpff_file_get_recovery_counter(
+				     file,
+				     counter,
+				     &number_of_candidates,
+				     &number_of_validated,
+				     &error ) != 1 )
+				{
+					libcerror_error_free(
+					 &error );
+
+					break;
+				}
+				switch( counter )
+				{
+					case LIBPFF_RECOVERY_COUNTER_INDEX_NODES:
+						fprintf(
+						 export_handle->notify_stream,
+						 ", index nodes: " );
+						break;
+
+					case LIBPFF_RECOVERY_COUNTER_DATA_BLOCKS:
+						fprintf(
+						 export_handle->notify_stream,
+						 ", data blocks: " );
+						break;
+
+					case LIBPFF_RECOVERY_COUNTER_LOCAL_DESCRIPTORS:
+						fprintf(
+						 export_handle->notify_stream,
+						 ", local descriptors: " );
+						break;
+
+					case LIBPFF_RECOVERY_COUNTER_ITEMS:
+						fprintf(
+						 export_handle->notify_stream,
+						 ", items: " );
+						break;
+				}
+				fprintf(
+				 export_handle->notify_stream,
+				 "%" PRIu64 " of %" PRIu64 "",
+				 number_of_validated,
+				 number_of_candidates );
+			}
+			fprintf(
+			 export_handle->notify_stream,
+			 ".\n" );
+			break;
+
+		default:
+			break;
+	}
+	return( 1 );
+}
+
+/* Exports the identifiers of the items of the previous export that are no longer present
+ * The identifiers are written to the log
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_deleted_items(
+     export_handle_t *export_handle,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	export_manifest_entry_t *entry   = NULL;
+	static char *function            = "export_handle_export_deleted_items";
+	uint64_t number_of_deleted_items = 0;
+	size_t entry_index               = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->export_manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing export manifest.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < export_handle->export_manifest->number_of_previous_entries;
+	     entry_index++ )
+	{
+		entry = &( export_handle->export_manifest->previous_entries[ entry_index ] );
+
+		if( entry->is_present == 0 )
+		{
+			log_handle_printf(
+			 log_handle,
+			 "Deleted item with identifier: %" PRIu32 ".\n",
+			 entry->identifier );
+
+			number_of_deleted_items += 1;
+		}
+	}
+	fprintf(
+	 export_handle->notify_stream,
+	 "Unchanged items: %" PRIu64 ", deleted items: %" PRIu64 ".\n",
+	 export_handle->export_manifest->number_of_unchanged_items,
+	 number_of_deleted_items );
+
+	return( 1 );
+}
+
 /* Exports the items in the file according to the export mode
  * Returns 1 if successful or -1 on error
  */
@@ -14046,6 +19235,21 @@ int export_handle_export_file(
 		 export_handle->notify_stream,
 		 "Recovering items.\n" );
 
+		if( libpff_file_set_recovery_progress_callback(
+		     file,
+		     &export_handle_recovery_progress_callback,
+		     (intptr_t *) export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set recovery progress callback.",
+			 function );
+
+			return( -1 );
+		}
 /* TODO set recovery flags somewhere */
 		if( libpff_file_recover_items(
 		     file,
@@ -14139,6 +19343,39 @@ int export_handle_export_file(
 			return( -1 );
 		}
 	}
+	if( export_handle->export_manifest != NULL )
+	{
+		if( export_handle_export_deleted_items(
+		     export_handle,
+		     log_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export deleted items.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( export_filter_is_set(
+	     export_handle->export_filter ) != 0 )
+	{
+		fprintf(
+		 export_handle->notify_stream,
+		 "Items not matching the export filter: %" PRIu64 ".\n",
+		 export_handle->export_filter->number_of_filtered_items );
+	}
+	if( export_handle->attachment_store != NULL )
+	{
+		fprintf(
+		 export_handle->notify_stream,
+		 "Duplicate attachments: %" PRIu64 " (%" PRIu64 " bytes not written).\n",
+		 export_handle->attachment_store->number_of_duplicates,
+		 (uint64_t) export_handle->attachment_store->duplicate_data_size );
+	}
 	if( export_handle->abort != 0 )
 	{
 		export_handle->abort = 0;
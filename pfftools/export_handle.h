@@ -25,7 +25,12 @@
 #include <common.h>
 #include <types.h>
 
+#include "archive_file.h"
+#include "attachment_store.h"
+#include "export_filter.h"
+#include "export_manifest.h"
 #include "item_file.h"
+#include "json_file.h"
 #include "log_handle.h"
 #include "pfftools_libcerror.h"
 #include "pfftools_libcstring.h"
@@ -37,6 +42,13 @@
 extern "C" {
 #endif
 
+/* Unencrypted attachment data can be copied from the source file
+ * to the target file directly by the kernel
+ */
+#if defined( HAVE_SENDFILE ) && defined( HAVE_SYS_SENDFILE_H ) && !defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+#define EXPORT_HANDLE_HAVE_COPY_EXTENTS
+#endif
+
 enum EXPORT_MODES
 {
 	EXPORT_MODE_ALL				= (int) 'a',
@@ -51,10 +63,17 @@ enum EXPORT_FORMATS
 	EXPORT_FORMAT_ALL			= (int) 'a',
 	EXPORT_FORMAT_FTK			= (int) 'f',
 	EXPORT_FORMAT_HTML			= (int) 'h',
+	EXPORT_FORMAT_JSONL			= (int) 'j',
 	EXPORT_FORMAT_RTF			= (int) 'r',
 	EXPORT_FORMAT_TEXT			= (int) 't'
 };
 
+enum EXPORT_OUTPUT_FORMATS
+{
+	EXPORT_OUTPUT_FORMAT_DIRECTORY		= (int) 'd',
+	EXPORT_OUTPUT_FORMAT_TAR		= (int) 't'
+};
+
 typedef struct export_handle export_handle_t;
 
 struct export_handle
@@ -75,6 +94,40 @@ struct export_handle
 	 */
 	int ascii_codepage;
 
+	/* The output format
+	 */
+	int output_format;
+
+	/* The archive file the export is written to
+	 * or NULL if the export is written to a directory
+	 */
+	archive_file_t *archive_file;
+
+	/* The JSON file the export is written to
+	 * or NULL if the export is not written as JSON records
+	 */
+	json_file_t *json_file;
+
+	/* The store used to write duplicate attachment data only once
+	 * or NULL if attachment data is not deduplicated
+	 */
+	attachment_store_t *attachment_store;
+
+	/* The manifest of the exported items used to skip items
+	 * that are unchanged since the previous export
+	 * or NULL if the export is not incremental
+	 */
+	export_manifest_t *export_manifest;
+
+	/* The filter that selects the sub messages of the folders to export
+	 */
+	export_filter_t *export_filter;
+
+	/* The length of the part of the target path that is not stored
+	 * in the names of the archive file entries or the JSON records
+	 */
+	size_t base_path_length;
+
 	/* The target path
 	 */
 	libcstring_system_character_t *target_path;
@@ -140,6 +193,11 @@ struct export_handle
 	 */
 	FILE *notify_stream;
 
+	/* The source file descriptor
+	 * used to copy attachment data extents, -1 if not available
+	 */
+	int source_file_descriptor;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -172,11 +230,56 @@ int export_handle_set_ascii_codepage(
      const libcstring_system_character_t *string,
      libcerror_error_t **error );
 
+int export_handle_set_output_format(
+     export_handle_t *export_handle,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_deduplication_mode(
+     export_handle_t *export_handle,
+     const libcstring_system_character_t *string,
+     libcerror_error_t **error );
+
 int export_handle_set_target_path(
      export_handle_t *export_handle,
      const libcstring_system_character_t *target_path,
      libcerror_error_t **error );
 
+int export_handle_open_source(
+     export_handle_t *export_handle,
+     const libcstring_system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_close_source(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_open_archive(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_close_archive(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_open_json(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_close_json(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_open_manifest(
+     export_handle_t *export_handle,
+     const libcstring_system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_close_manifest(
+     export_handle_t *export_handle,
+     const libcstring_system_character_t *filename,
+     libcerror_error_t **error );
+
 int export_handle_set_export_path(
      export_handle_t *export_handle,
      const libcstring_system_character_t *base_path,
@@ -187,6 +290,16 @@ int export_handle_set_export_path(
      size_t *export_path_size,
      libcerror_error_t **error );
 
+int export_handle_path_exists(
+     export_handle_t *export_handle,
+     const libcstring_system_character_t *path,
+     libcerror_error_t **error );
+
+int export_handle_make_directory(
+     export_handle_t *export_handle,
+     const libcstring_system_character_t *path,
+     libcerror_error_t **error );
+
 int export_handle_create_items_export_path(
      export_handle_t *export_handle,
      libcerror_error_t **error );
@@ -201,6 +314,17 @@ int export_handle_create_recovered_export_path(
 
 /* Item generic export functions
  */
+int export_handle_get_default_item_directory_path(
+     export_handle_t *export_handle,
+     int item_index,
+     const libcstring_system_character_t *item_prefix,
+     size_t item_prefix_length,
+     const libcstring_system_character_t *export_path,
+     size_t export_path_length,
+     libcstring_system_character_t **item_directory_path,
+     size_t *item_directory_path_size,
+     libcerror_error_t **error );
+
 int export_handle_create_default_item_directory(
      export_handle_t *export_handle,
      int item_index,
@@ -258,6 +382,68 @@ int export_handle_export_sub_items(
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+/* Item JSON export functions
+ */
+int export_handle_export_item_json(
+     export_handle_t *export_handle,
+     libpff_item_t *item,
+     int item_index,
+     const libcstring_system_character_t *item_prefix,
+     size_t item_prefix_length,
+     const libcstring_system_character_t *export_path,
+     size_t export_path_length,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int export_handle_export_item_values_json(
+     export_handle_t *export_handle,
+     libpff_item_t *item,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int export_handle_export_entry_string_json(
+     export_handle_t *export_handle,
+     libpff_item_t *item,
+     int set_index,
+     uint32_t entry_type,
+     const char *key,
+     libcerror_error_t **error );
+
+int export_handle_export_message_body_json(
+     export_handle_t *export_handle,
+     libpff_item_t *message,
+     int body_format,
+     libcerror_error_t **error );
+
+int export_handle_export_item_entries_json(
+     export_handle_t *export_handle,
+     libpff_item_t *item,
+     int set_index,
+     libcerror_error_t **error );
+
+int export_handle_export_item_value_json(
+     export_handle_t *export_handle,
+     libpff_item_t *item,
+     int set_index,
+     int entry_index,
+     libcerror_error_t **error );
+
+int export_handle_export_recipients_json(
+     export_handle_t *export_handle,
+     libpff_item_t *item,
+     libcerror_error_t **error );
+
+int export_handle_export_attachments_json(
+     export_handle_t *export_handle,
+     libpff_item_t *item,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int export_handle_export_attachment_data_json(
+     export_handle_t *export_handle,
+     libpff_item_t *attachment,
+     libcerror_error_t **error );
+
 /* Message item export functions
  */
 int export_handle_export_message_header(
@@ -412,6 +598,26 @@ int export_handle_export_attachment(
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+int export_handle_copy_attachment_data_extents(
+     export_handle_t *export_handle,
+     libpff_item_t *attachment,
+     size64_t attachment_data_size,
+     FILE *attachment_file_stream,
+     libcerror_error_t **error );
+
+int export_handle_get_duplicate_attachment_data(
+     export_handle_t *export_handle,
+     libpff_item_t *attachment,
+     size64_t attachment_data_size,
+     attachment_store_entry_t **stored_entry,
+     libcerror_error_t **error );
+
+int export_handle_link_attachment_data(
+     export_handle_t *export_handle,
+     const libcstring_system_character_t *stored_path,
+     const libcstring_system_character_t *target_path,
+     libcerror_error_t **error );
+
 int export_handle_export_attachment_data(
      export_handle_t *export_handle,
      libpff_item_t *attachment,
@@ -566,6 +772,16 @@ int export_handle_export_sub_folders(
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+int export_handle_sub_message_is_unchanged(
+     export_handle_t *export_handle,
+     libpff_item_t *folder,
+     int sub_message_index,
+     libpff_item_t *sub_message,
+     uint32_t *sub_message_identifier,
+     uint64_t *data_identifier,
+     uint64_t *modification_time,
+     libcerror_error_t **error );
+
 int export_handle_export_sub_messages(
      export_handle_t *export_handle,
      libpff_item_t *folder,
@@ -605,6 +821,15 @@ int export_handle_export_recovered_items(
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+int export_handle_recovery_progress_callback(
+     libpff_file_t *file,
+     intptr_t *callback_data );
+
+int export_handle_export_deleted_items(
+     export_handle_t *export_handle,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
 int export_handle_export_file(
      export_handle_t *export_handle,
      libpff_file_t *file,
@@ -0,0 +1,961 @@
+/* 
+ * Export manifest functions
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "export_manifest.h"
+#include "pfftools_libcerror.h"
+#include "pfftools_libcfile.h"
+#include "pfftools_libcstring.h"
+
+/* The manifest file signature
+ */
+const uint8_t export_manifest_signature[ 8 ] = { 'p', 'f', 'f', 'm', 'n', 'f', 't', 0x01 };
+
+/* Initializes the export manifest
+ * Returns 1 if successful or -1 on error
+ */
+int export_manifest_initialize(
+     export_manifest_t **export_manifest,
+     libcerror_error_t **error )
+{
+	static char *function = "export_manifest_initialize";
+
+	if( export_manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_manifest != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export manifest value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*export_manifest = memory_allocate_structure(
+	                    export_manifest_t );
+
+	if( *export_manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *export_manifest,
+	     0,
+	     sizeof( export_manifest_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear export manifest.",
+		 function );
+
+		memory_free(
+		 *export_manifest );
+
+		*export_manifest = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees the export manifest and its elements
+ * Returns 1 if successful or -1 on error
+ */
+int export_manifest_free(
+     export_manifest_t **export_manifest,
+     libcerror_error_t **error )
+{
+	static char *function = "export_manifest_free";
+
+	if( export_manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_manifest != NULL )
+	{
+		if( ( *export_manifest )->previous_entries != NULL )
+		{
+			memory_free(
+			 ( *export_manifest )->previous_entries );
+		}
+		if( ( *export_manifest )->entries != NULL )
+		{
+			memory_free(
+			 ( *export_manifest )->entries );
+		}
+		memory_free(
+		 *export_manifest );
+
+		*export_manifest = NULL;
+	}
+	return( 1 );
+}
+
+/* Compares two entries by their identifier
+ * Returns -1 if the first entry is smaller, 1 if larger or 0 if equal
+ */
+int export_manifest_compare_entries(
+     const export_manifest_entry_t *first_entry,
+     const export_manifest_entry_t *second_entry )
+{
+	if( first_entry->identifier < second_entry->identifier )
+	{
+		return( -1 );
+	}
+	else if( first_entry->identifier > second_entry->identifier )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Reads the entries of the previous export from a manifest file
+ * Returns 1 if successful, 0 if the manifest file does not exist or -1 on error
+ */
+int export_manifest_read(
+     export_manifest_t *export_manifest,
+     const libcstring_system_character_t *filename,
+     libcerror_error_t **error )
+{
+	uint8_t header_data[ EXPORT_MANIFEST_HEADER_SIZE ];
+
+	export_manifest_entry_t *entries = NULL;
+	libcfile_file_t *file_handle     = NULL;
+	uint8_t *record_data             = NULL;
+	static char *function            = "export_manifest_read";
+	size64_t file_size               = 0;
+	size_t entry_index               = 0;
+	size_t record_data_offset        = 0;
+	size_t record_data_size          = 0;
+	ssize_t read_count               = 0;
+	uint64_t number_of_entries       = 0;
+	int result                       = 0;
+
+	if( export_manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_manifest->previous_entries != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export manifest - previous entries already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_exists_wide(
+	          filename,
+	          error );
+#else
+	result = libcfile_file_exists(
+	          filename,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if manifest file exists.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libcfile_file_initialize(
+	     &file_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          file_handle,
+	          filename,
+	          LIBCFILE_OPEN_READ,
+	          error );
+#else
+	result = libcfile_file_open(
+	          file_handle,
+	          filename,
+	          LIBCFILE_OPEN_READ,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open manifest file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_get_size(
+	     file_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve manifest file size.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libcfile_file_read_buffer(
+	              file_handle,
+	              header_data,
+	              EXPORT_MANIFEST_HEADER_SIZE,
+	              error );
+
+	if( read_count != (ssize_t) EXPORT_MANIFEST_HEADER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read manifest header.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_compare(
+	     header_data,
+	     export_manifest_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_SIGNATURE_MISMATCH,
+		 "%s: invalid manifest signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 &( header_data[ 8 ] ),
+	 number_of_entries );
+
+	if( number_of_entries > (uint64_t) ( ( SSIZE_MAX - EXPORT_MANIFEST_HEADER_SIZE ) / EXPORT_MANIFEST_RECORD_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of entries value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	record_data_size = (size_t) number_of_entries * EXPORT_MANIFEST_RECORD_SIZE;
+
+	if( file_size != (size64_t) ( EXPORT_MANIFEST_HEADER_SIZE + record_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: manifest file size does not match number of entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_entries > 0 )
+	{
+		record_data = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * record_data_size );
+
+		if( record_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create record data.",
+			 function );
+
+			goto on_error;
+		}
+		entries = (export_manifest_entry_t *) memory_allocate(
+		                                       sizeof( export_manifest_entry_t ) * (size_t) number_of_entries );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entries.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libcfile_file_read_buffer(
+		              file_handle,
+		              record_data,
+		              record_data_size,
+		              error );
+
+		if( read_count != (ssize_t) record_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read manifest records.",
+			 function );
+
+			goto on_error;
+		}
+		for( entry_index = 0;
+		     entry_index < (size_t) number_of_entries;
+		     entry_index++ )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( record_data[ record_data_offset ] ),
+			 entries[ entry_index ].identifier );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 &( record_data[ record_data_offset + 8 ] ),
+			 entries[ entry_index ].data_identifier );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 &( record_data[ record_data_offset + 16 ] ),
+			 entries[ entry_index ].modification_time );
+
+			entries[ entry_index ].is_present = 0;
+
+			record_data_offset += EXPORT_MANIFEST_RECORD_SIZE;
+		}
+		memory_free(
+		 record_data );
+
+		record_data = NULL;
+
+		/* The manifest file is written sorted, the entries are sorted again
+		 * so that a modified manifest file cannot break the lookup
+		 */
+		qsort(
+		 entries,
+		 (size_t) number_of_entries,
+		 sizeof( export_manifest_entry_t ),
+		 (int (*)(const void *, const void *)) &export_manifest_compare_entries );
+	}
+	if( libcfile_file_close(
+	     file_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close manifest file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &file_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file handle.",
+		 function );
+
+		goto on_error;
+	}
+	export_manifest->previous_entries           = entries;
+	export_manifest->number_of_previous_entries = (size_t) number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( entries != NULL )
+	{
+		memory_free(
+		 entries );
+	}
+	if( record_data != NULL )
+	{
+		memory_free(
+		 record_data );
+	}
+	if( file_handle != NULL )
+	{
+		libcfile_file_free(
+		 &file_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the entries of the current export to a manifest file
+ * Returns 1 if successful or -1 on error
+ */
+int export_manifest_write(
+     export_manifest_t *export_manifest,
+     const libcstring_system_character_t *filename,
+     libcerror_error_t **error )
+{
+	uint8_t header_data[ EXPORT_MANIFEST_HEADER_SIZE ];
+
+	libcfile_file_t *file_handle = NULL;
+	uint8_t *record_data         = NULL;
+	static char *function        = "export_manifest_write";
+	size_t entry_index           = 0;
+	size_t record_data_offset    = 0;
+	size_t record_data_size      = 0;
+	ssize_t write_count          = 0;
+	int result                   = 0;
+
+	if( export_manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_manifest->number_of_entries > (size_t) ( ( SSIZE_MAX - EXPORT_MANIFEST_HEADER_SIZE ) / EXPORT_MANIFEST_RECORD_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid export manifest - number of entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	record_data_size = export_manifest->number_of_entries * EXPORT_MANIFEST_RECORD_SIZE;
+
+	if( export_manifest->number_of_entries > 0 )
+	{
+		qsort(
+		 export_manifest->entries,
+		 export_manifest->number_of_entries,
+		 sizeof( export_manifest_entry_t ),
+		 (int (*)(const void *, const void *)) &export_manifest_compare_entries );
+
+		record_data = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * record_data_size );
+
+		if( record_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create record data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     record_data,
+		     0,
+		     record_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear record data.",
+			 function );
+
+			goto on_error;
+		}
+		for( entry_index = 0;
+		     entry_index < export_manifest->number_of_entries;
+		     entry_index++ )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 &( record_data[ record_data_offset ] ),
+			 export_manifest->entries[ entry_index ].identifier );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 &( record_data[ record_data_offset + 8 ] ),
+			 export_manifest->entries[ entry_index ].data_identifier );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 &( record_data[ record_data_offset + 16 ] ),
+			 export_manifest->entries[ entry_index ].modification_time );
+
+			record_data_offset += EXPORT_MANIFEST_RECORD_SIZE;
+		}
+	}
+	if( memory_copy(
+	     header_data,
+	     export_manifest_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 &( header_data[ 8 ] ),
+	 (uint64_t) export_manifest->number_of_entries );
+
+	if( libcfile_file_initialize(
+	     &file_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          file_handle,
+	          filename,
+	          LIBCFILE_OPEN_WRITE_TRUNCATE,
+	          error );
+#else
+	result = libcfile_file_open(
+	          file_handle,
+	          filename,
+	          LIBCFILE_OPEN_WRITE_TRUNCATE,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open manifest file.",
+		 function );
+
+		goto on_error;
+	}
+	write_count = libcfile_file_write_buffer(
+	               file_handle,
+	               header_data,
+	               EXPORT_MANIFEST_HEADER_SIZE,
+	               error );
+
+	if( write_count != (ssize_t) EXPORT_MANIFEST_HEADER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write manifest header.",
+		 function );
+
+		goto on_error;
+	}
+	if( record_data != NULL )
+	{
+		write_count = libcfile_file_write_buffer(
+		               file_handle,
+		               record_data,
+		               record_data_size,
+		               error );
+
+		if( write_count != (ssize_t) record_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write manifest records.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 record_data );
+
+		record_data = NULL;
+	}
+	if( libcfile_file_close(
+	     file_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close manifest file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &file_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( record_data != NULL )
+	{
+		memory_free(
+		 record_data );
+	}
+	if( file_handle != NULL )
+	{
+		libcfile_file_free(
+		 &file_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the entry of the previous export for a specific identifier
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int export_manifest_get_previous_entry(
+     export_manifest_t *export_manifest,
+     uint32_t identifier,
+     export_manifest_entry_t **entry,
+     libcerror_error_t **error )
+{
+	export_manifest_entry_t *previous_entry = NULL;
+	static char *function                   = "export_manifest_get_previous_entry";
+	size_t entry_index                      = 0;
+	size_t first_entry_index                = 0;
+	size_t last_entry_index                 = 0;
+
+	if( export_manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	/* The previous entries are sorted by identifier
+	 */
+	last_entry_index = export_manifest->number_of_previous_entries;
+
+	while( first_entry_index < last_entry_index )
+	{
+		entry_index = first_entry_index + ( ( last_entry_index - first_entry_index ) / 2 );
+
+		previous_entry = &( export_manifest->previous_entries[ entry_index ] );
+
+		if( previous_entry->identifier < identifier )
+		{
+			first_entry_index = entry_index + 1;
+		}
+		else if( previous_entry->identifier > identifier )
+		{
+			last_entry_index = entry_index;
+		}
+		else
+		{
+			*entry = previous_entry;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Determines if an item is unchanged since the previous export
+ * The entry of the previous export, if any, is marked as present
+ * Returns 1 if the item is unchanged, 0 if the item is new or changed or -1 on error
+ */
+int export_manifest_item_is_unchanged(
+     export_manifest_t *export_manifest,
+     uint32_t identifier,
+     uint64_t data_identifier,
+     uint64_t modification_time,
+     libcerror_error_t **error )
+{
+	export_manifest_entry_t *entry = NULL;
+	static char *function          = "export_manifest_item_is_unchanged";
+	int result                     = 0;
+
+	result = export_manifest_get_previous_entry(
+	          export_manifest,
+	          identifier,
+	          &entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve previous entry: %" PRIu32 ".",
+		 function,
+		 identifier );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	entry->is_present = 1;
+
+	if( ( entry->data_identifier != data_identifier )
+	 || ( entry->modification_time != modification_time ) )
+	{
+		return( 0 );
+	}
+	export_manifest->number_of_unchanged_items += 1;
+
+	return( 1 );
+}
+
+/* Keeps the entry of the previous export of an item that is not part of the current export
+ * This is used for items that were excluded by an export filter, so that the item
+ * is neither reported as deleted nor lost from the manifest
+ * Returns 1 if successful or -1 on error
+ */
+int export_manifest_keep_entry(
+     export_manifest_t *export_manifest,
+     uint32_t identifier,
+     libcerror_error_t **error )
+{
+	export_manifest_entry_t *entry = NULL;
+	static char *function          = "export_manifest_keep_entry";
+	int result                     = 0;
+
+	result = export_manifest_get_previous_entry(
+	          export_manifest,
+	          identifier,
+	          &entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve previous entry: %" PRIu32 ".",
+		 function,
+		 identifier );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	entry->is_present = 1;
+
+	if( export_manifest_append_entry(
+	     export_manifest,
+	     entry->identifier,
+	     entry->data_identifier,
+	     entry->modification_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append entry: %" PRIu32 ".",
+		 function,
+		 identifier );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends an entry for an item of the current export
+ * Returns 1 if successful or -1 on error
+ */
+int export_manifest_append_entry(
+     export_manifest_t *export_manifest,
+     uint32_t identifier,
+     uint64_t data_identifier,
+     uint64_t modification_time,
+     libcerror_error_t **error )
+{
+	export_manifest_entry_t *entries = NULL;
+	export_manifest_entry_t *entry   = NULL;
+	static char *function            = "export_manifest_append_entry";
+	size_t entries_size              = 0;
+
+	if( export_manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_manifest->number_of_entries >= export_manifest->entries_size )
+	{
+		if( export_manifest->entries_size == 0 )
+		{
+			entries_size = 1024;
+		}
+		else
+		{
+			entries_size = export_manifest->entries_size * 2;
+		}
+		if( entries_size > (size_t) ( SSIZE_MAX / sizeof( export_manifest_entry_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid entries size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		entries = (export_manifest_entry_t *) memory_reallocate(
+		                                       export_manifest->entries,
+		                                       sizeof( export_manifest_entry_t ) * entries_size );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		export_manifest->entries      = entries;
+		export_manifest->entries_size = entries_size;
+	}
+	entry = &( export_manifest->entries[ export_manifest->number_of_entries ] );
+
+	entry->identifier        = identifier;
+	entry->data_identifier   = data_identifier;
+	entry->modification_time = modification_time;
+	entry->is_present        = 1;
+
+	export_manifest->number_of_entries += 1;
+
+	return( 1 );
+}
+
@@ -0,0 +1,143 @@
+/* 
+ * Export manifest functions
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _EXPORT_MANIFEST_H )
+#define _EXPORT_MANIFEST_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pfftools_libcerror.h"
+#include "pfftools_libcstring.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define EXPORT_MANIFEST_HEADER_SIZE	16
+#define EXPORT_MANIFEST_RECORD_SIZE	24
+
+typedef struct export_manifest_entry export_manifest_entry_t;
+
+struct export_manifest_entry
+{
+	/* The (descriptor) identifier of the item
+	 */
+	uint32_t identifier;
+
+	/* The data identifier of the item
+	 */
+	uint64_t data_identifier;
+
+	/* The modification time of the item
+	 * Contains a FILETIME or 0 if not available
+	 */
+	uint64_t modification_time;
+
+	/* Value to indicate the item is still present
+	 * This value is not stored in the manifest file
+	 */
+	uint8_t is_present;
+};
+
+typedef struct export_manifest export_manifest_t;
+
+struct export_manifest
+{
+	/* The entries of the previous export, sorted by identifier
+	 */
+	export_manifest_entry_t *previous_entries;
+
+	/* The number of entries of the previous export
+	 */
+	size_t number_of_previous_entries;
+
+	/* The entries of the current export
+	 */
+	export_manifest_entry_t *entries;
+
+	/* The number of allocated entries of the current export
+	 */
+	size_t entries_size;
+
+	/* The number of entries of the current export
+	 */
+	size_t number_of_entries;
+
+	/* The number of items that were unchanged since the previous export
+	 */
+	uint64_t number_of_unchanged_items;
+};
+
+int export_manifest_initialize(
+     export_manifest_t **export_manifest,
+     libcerror_error_t **error );
+
+int export_manifest_free(
+     export_manifest_t **export_manifest,
+     libcerror_error_t **error );
+
+int export_manifest_compare_entries(
+     const export_manifest_entry_t *first_entry,
+     const export_manifest_entry_t *second_entry );
+
+int export_manifest_read(
+     export_manifest_t *export_manifest,
+     const libcstring_system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_manifest_write(
+     export_manifest_t *export_manifest,
+     const libcstring_system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_manifest_get_previous_entry(
+     export_manifest_t *export_manifest,
+     uint32_t identifier,
+     export_manifest_entry_t **entry,
+     libcerror_error_t **error );
+
+int export_manifest_item_is_unchanged(
+     export_manifest_t *export_manifest,
+     uint32_t identifier,
+     uint64_t data_identifier,
+     uint64_t modification_time,
+     libcerror_error_t **error );
+
+int export_manifest_keep_entry(
+     export_manifest_t *export_manifest,
+     uint32_t identifier,
+     libcerror_error_t **error );
+
+int export_manifest_append_entry(
+     export_manifest_t *export_manifest,
+     uint32_t identifier,
+     uint64_t data_identifier,
+     uint64_t modification_time,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
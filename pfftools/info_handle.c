@@ -846,3 +846,319 @@ int info_handle_unallocated_blocks_fprint(
 	return( 1 );
 }
 
+/* Traverses the item and its sub items
+ * Retrieving the number of sets of every item causes its values to be read
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_item_traverse(
+     info_handle_t *info_handle,
+     libpff_item_t *item,
+     libcerror_error_t **error )
+{
+	libpff_item_t *sub_item = NULL;
+	static char *function   = "info_handle_item_traverse";
+	uint32_t identifier     = 0;
+	uint32_t number_of_sets = 0;
+	int number_of_sub_items = 0;
+	int sub_item_index      = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_item_get_identifier(
+	     item,
+	     &identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier.",
+		 function );
+
+		return( -1 );
+	}
+	/* The root item of the item tree has no item values
+	 */
+	if( identifier != 0 )
+	{
+		if( libpff_item_get_number_of_sets(
+		     item,
+		     &number_of_sets,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of sets.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libpff_item_get_number_of_sub_items(
+	     item,
+	     &number_of_sub_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub items.",
+		 function );
+
+		return( -1 );
+	}
+	for( sub_item_index = 0;
+	     sub_item_index < number_of_sub_items;
+	     sub_item_index++ )
+	{
+		if( libpff_item_get_sub_item(
+		     item,
+		     sub_item_index,
+		     &sub_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			return( -1 );
+		}
+		if( info_handle_item_traverse(
+		     info_handle,
+		     sub_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to traverse sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			libpff_item_free(
+			 &sub_item,
+			 NULL );
+
+			return( -1 );
+		}
+		if( libpff_item_free(
+		     &sub_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub item: %d.",
+			 function,
+			 sub_item_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Prints the statistics to a stream
+ * The items are traversed first, so that the statistics cover a full read of the file
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_statistics_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	const char *cache_names[ 7 ] = {
+		"Index nodes",
+		"Descriptor index values",
+		"Offset index values",
+		"Data blocks",
+		"Local descriptors",
+		"Item values",
+		"Local descriptor nodes" };
+
+	const char *statistic_names[ 9 ] = {
+		"Bytes read:\t\t",
+		"Read operations:\t",
+		"Bytes decrypted:\t",
+		"Bytes CRC checked:\t",
+		"Bytes decompressed:\t",
+		"Tables read:\t\t",
+		"Buffer pool hits:\t",
+		"Buffer pool allocated:\t",
+		"Buffer pool peak size:\t" };
+
+	libpff_item_t *root_item     = NULL;
+	static char *function        = "info_handle_statistics_fprint";
+	uint64_t number_of_evictions = 0;
+	uint64_t number_of_hits      = 0;
+	uint64_t number_of_misses    = 0;
+	uint64_t value               = 0;
+	int cache                    = 0;
+	int statistic                = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_file_get_root_item(
+	     info_handle->input_file,
+	     &root_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root item.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle_item_traverse(
+	     info_handle,
+	     root_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to traverse root item.",
+		 function );
+
+		goto on_error;
+	}
+	if( libpff_item_free(
+	     &root_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free root item.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "Statistics:\n" );
+
+	for( statistic = LIBPFF_STATISTIC_NUMBER_OF_BYTES_READ;
+	     statistic <= LIBPFF_STATISTIC_BUFFER_POOL_PEAK_USED_SIZE;
+	     statistic++ )
+	{
+		if( libpff_file_get_statistics(
+		     info_handle->input_file,
+		     statistic,
+		     &value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve statistic: %d.",
+			 function,
+			 statistic );
+
+			goto on_error;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\t%s%" PRIu64 "\n",
+		 statistic_names[ statistic ],
+		 value );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "Cache statistics:\n" );
+
+	for( cache = LIBPFF_CACHE_INDEX_NODES;
+	     cache <= LIBPFF_CACHE_LOCAL_DESCRIPTOR_NODES;
+	     cache++ )
+	{
+		if( libpff_file_get_cache_statistics(
+		     info_handle->input_file,
+		     cache,
+		     &number_of_hits,
+		     &number_of_misses,
+		     &number_of_evictions,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve statistics of cache: %d.",
+			 function,
+			 cache );
+
+			goto on_error;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\t%s:\n",
+		 cache_names[ cache ] );
+
+		fprintf(
+		 info_handle->notify_stream,
+		 "\t\tHits:\t\t%" PRIu64 "\n",
+		 number_of_hits );
+
+		fprintf(
+		 info_handle->notify_stream,
+		 "\t\tMisses:\t\t%" PRIu64 "\n",
+		 number_of_misses );
+
+		fprintf(
+		 info_handle->notify_stream,
+		 "\t\tEvictions:\t%" PRIu64 "\n",
+		 number_of_evictions );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+
+on_error:
+	if( root_item != NULL )
+	{
+		libpff_item_free(
+		 &root_item,
+		 NULL );
+	}
+	return( -1 );
+}
+
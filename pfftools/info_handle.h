@@ -99,6 +99,15 @@ int info_handle_unallocated_blocks_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_item_traverse(
+     info_handle_t *info_handle,
+     libpff_item_t *item,
+     libcerror_error_t **error );
+
+int info_handle_statistics_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "archive_file.h"
 #include "item_file.h"
 #include "pfftools_libcerror.h"
 #include "pfftools_libcfile.h"
@@ -154,6 +155,16 @@ int item_file_free(
 
 			result = -1;
 		}
+		if( ( *item_file )->entry_name != NULL )
+		{
+			memory_free(
+			 ( *item_file )->entry_name );
+		}
+		if( ( *item_file )->entry_data != NULL )
+		{
+			memory_free(
+			 ( *item_file )->entry_data );
+		}
 		memory_free(
 		 *item_file );
 
@@ -209,6 +220,105 @@ int item_file_open(
 	return( 1 );
 }
 
+/* Opens the item file as an entry of an archive file
+ * The entry is written to the archive file when the item file is closed
+ * Returns 1 if successful or -1 on error
+ */
+int item_file_open_archive_entry(
+     item_file_t *item_file,
+     archive_file_t *archive_file,
+     const libcstring_system_character_t *name,
+     libcerror_error_t **error )
+{
+	static char *function = "item_file_open_archive_entry";
+	size_t name_size      = 0;
+
+	if( item_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item file.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_file->entry_name != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid item file - entry name value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( archive_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive file.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	name_size = 1 + libcstring_system_string_length(
+	                 name );
+
+	item_file->entry_name = libcstring_system_string_allocate(
+	                         name_size );
+
+	if( item_file->entry_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry name.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcstring_system_string_copy(
+	     item_file->entry_name,
+	     name,
+	     name_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy entry name.",
+		 function );
+
+		memory_free(
+		 item_file->entry_name );
+
+		item_file->entry_name = NULL;
+
+		return( -1 );
+	}
+	item_file->archive_file    = archive_file;
+	item_file->entry_data_size = 0;
+
+	return( 1 );
+}
+
 /* Closes the item file
  * Returns the 0 if succesful or -1 on error
  */
@@ -217,6 +327,7 @@ int item_file_close(
      libcerror_error_t **error )
 {
 	static char *function = "item_file_close";
+	int result            = 1;
 
 	if( item_file == NULL )
 	{
@@ -229,6 +340,69 @@ int item_file_close(
 
 		return( -1 );
 	}
+	if( item_file->archive_file != NULL )
+	{
+		if( archive_file_open_entry(
+		     item_file->archive_file,
+		     item_file->entry_name,
+		     (size64_t) item_file->entry_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open archive entry.",
+			 function );
+
+			return( -1 );
+		}
+		if( item_file->entry_data_size > 0 )
+		{
+			result = archive_file_write_entry_data(
+			          item_file->archive_file,
+			          item_file->entry_data,
+			          item_file->entry_data_size,
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write archive entry data.",
+				 function );
+			}
+		}
+		/* Always close the entry to keep the archive file consistent
+		 */
+		if( archive_file_close_entry(
+		     item_file->archive_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close archive entry.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 item_file->entry_name );
+
+		item_file->entry_name      = NULL;
+		item_file->archive_file    = NULL;
+		item_file->entry_data_size = 0;
+
+		if( result != 1 )
+		{
+			return( -1 );
+		}
+		return( 0 );
+	}
 	if( libcfile_file_close(
 	     item_file->file_handle,
 	     error ) != 0 )
@@ -254,8 +428,10 @@ int item_file_write_buffer(
      size_t buffer_size,
      libcerror_error_t **error )
 {
-	static char *function = "item_file_write_buffer";
-	ssize_t write_count   = 0;
+	uint8_t *entry_data    = NULL;
+	static char *function  = "item_file_write_buffer";
+	size_t entry_data_size = 0;
+	ssize_t write_count    = 0;
 
 	if( item_file == NULL )
 	{
@@ -290,6 +466,67 @@ int item_file_write_buffer(
 
 		return( -1 );
 	}
+	if( item_file->archive_file != NULL )
+	{
+		if( buffer_size > ( (size_t) SSIZE_MAX - item_file->entry_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid buffer size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		entry_data_size = item_file->entry_data_size + buffer_size;
+
+		if( entry_data_size > item_file->entry_data_allocated_size )
+		{
+			if( entry_data_size < 4096 )
+			{
+				entry_data_size = 4096;
+			}
+			else if( entry_data_size < ( (size_t) SSIZE_MAX / 2 ) )
+			{
+				entry_data_size *= 2;
+			}
+			entry_data = (uint8_t *) memory_reallocate(
+			                          item_file->entry_data,
+			                          sizeof( uint8_t ) * entry_data_size );
+
+			if( entry_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize entry data.",
+				 function );
+
+				return( -1 );
+			}
+			item_file->entry_data                = entry_data;
+			item_file->entry_data_allocated_size = entry_data_size;
+		}
+		if( memory_copy(
+		     &( item_file->entry_data[ item_file->entry_data_size ] ),
+		     buffer,
+		     buffer_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy buffer to entry data.",
+			 function );
+
+			return( -1 );
+		}
+		item_file->entry_data_size += buffer_size;
+
+		return( 1 );
+	}
 	write_count = libcfile_file_write_buffer(
 		       item_file->file_handle,
 		       buffer,
@@ -26,6 +26,7 @@
 #include <file_stream.h>
 #include <types.h>
 
+#include "archive_file.h"
 #include "pfftools_libcerror.h"
 #include "pfftools_libcfile.h"
 #include "pfftools_libcstring.h"
@@ -50,6 +51,28 @@ struct item_file
 	/* The file handle
 	 */
 	libcfile_file_t *file_handle;
+
+	/* The archive file
+	 * The item file is written as an entry of the archive file when set
+	 */
+	archive_file_t *archive_file;
+
+	/* The archive entry name
+	 */
+	libcstring_system_character_t *entry_name;
+
+	/* The data of the archive entry
+	 * The entry data is buffered since its size is stored before the data
+	 */
+	uint8_t *entry_data;
+
+	/* The size of the entry data
+	 */
+	size_t entry_data_size;
+
+	/* The allocated size of the entry data
+	 */
+	size_t entry_data_allocated_size;
 };
 
 int item_file_initialize(
@@ -65,6 +88,12 @@ int item_file_open(
      const libcstring_system_character_t *filename,
      libcerror_error_t **error );
 
+int item_file_open_archive_entry(
+     item_file_t *item_file,
+     archive_file_t *archive_file,
+     const libcstring_system_character_t *name,
+     libcerror_error_t **error );
+
 int item_file_close(
      item_file_t *item_file,
      libcerror_error_t **error );
@@ -0,0 +1,1993 @@
+/* 
+ * JSON file
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "json_file.h"
+#include "pfftools_libcerror.h"
+#include "pfftools_libcfile.h"
+#include "pfftools_libcstring.h"
+#include "pfftools_libfdatetime.h"
+#include "pfftools_libfguid.h"
+
+/* Initializes the JSON file
+ * Returns 1 if successful or -1 on error
+ */
+int json_file_initialize(
+     json_file_t **json_file,
+     libcerror_error_t **error )
+{
+	static char *function = "json_file_initialize";
+
+	if( json_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *json_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid JSON file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*json_file = memory_allocate_structure(
+	              json_file_t );
+
+	if( *json_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create JSON file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *json_file,
+	     0,
+	     sizeof( json_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear JSON file.",
+		 function );
+
+		memory_free(
+		 *json_file );
+
+		*json_file = NULL;
+
+		return( -1 );
+	}
+	if( libcfile_file_initialize(
+	     &( ( *json_file )->file_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_initialize(
+	     &( ( *json_file )->blob_file_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create blob file handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *json_file )->buffer = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * JSON_FILE_BUFFER_SIZE );
+
+	if( ( *json_file )->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	( *json_file )->buffer_size = JSON_FILE_BUFFER_SIZE;
+
+	( *json_file )->blob_buffer = (uint8_t *) memory_allocate(
+	                                           sizeof( uint8_t ) * JSON_FILE_BUFFER_SIZE );
+
+	if( ( *json_file )->blob_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create blob buffer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *json_file != NULL )
+	{
+		if( ( *json_file )->buffer != NULL )
+		{
+			memory_free(
+			 ( *json_file )->buffer );
+		}
+		if( ( *json_file )->blob_file_handle != NULL )
+		{
+			libcfile_file_free(
+			 &( ( *json_file )->blob_file_handle ),
+			 NULL );
+		}
+		if( ( *json_file )->file_handle != NULL )
+		{
+			libcfile_file_free(
+			 &( ( *json_file )->file_handle ),
+			 NULL );
+		}
+		memory_free(
+		 *json_file );
+
+		*json_file = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees the JSON file and its elements
+ * Returns 1 if successful or -1 on error
+ */
+int json_file_free(
+     json_file_t **json_file,
+     libcerror_error_t **error )
+{
+	static char *function = "json_file_free";
+	int result            = 1;
+
+	if( json_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *json_file != NULL )
+	{
+		if( libcfile_file_free(
+		     &( ( *json_file )->file_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file handle.",
+			 function );
+
+			result = -1;
+		}
+		if( libcfile_file_free(
+		     &( ( *json_file )->blob_file_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free blob file handle.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *json_file )->buffer != NULL )
+		{
+			memory_free(
+			 ( *json_file )->buffer );
+		}
+		if( ( *json_file )->blob_buffer != NULL )
+		{
+			memory_free(
+			 ( *json_file )->blob_buffer );
+		}
+		memory_free(
+		 *json_file );
+
+		*json_file = NULL;
+	}
+	return( result );
+}
+
+/* Opens the JSON file and its blob file
+ * Returns 1 if successful or -1 on error
+ */
+int json_file_open(
+     json_file_t *json_file,
+     const libcstring_system_character_t *filename,
+     const libcstring_system_character_t *blob_filename,
+     libcerror_error_t **error )
+{
+	static char *function = "json_file_open";
+
+	if( json_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcfile_file_open_wide(
+	     json_file->file_handle,
+	     filename,
+	     LIBCFILE_OPEN_WRITE,
+	     error ) != 1 )
+#else
+	if( libcfile_file_open(
+	     json_file->file_handle,
+	     filename,
+	     LIBCFILE_OPEN_WRITE,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcfile_file_open_wide(
+	     json_file->blob_file_handle,
+	     blob_filename,
+	     LIBCFILE_OPEN_WRITE,
+	     error ) != 1 )
+#else
+	if( libcfile_file_open(
+	     json_file->blob_file_handle,
+	     blob_filename,
+	     LIBCFILE_OPEN_WRITE,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open blob file handle.",
+		 function );
+
+		libcfile_file_close(
+		 json_file->file_handle,
+		 NULL );
+
+		return( -1 );
+	}
+	json_file->buffer_offset      = 0;
+	json_file->record_offset      = 0;
+	json_file->depth              = 0;
+	json_file->key_is_set         = 0;
+	json_file->blob_buffer_offset = 0;
+	json_file->blob_offset        = 0;
+
+	return( 1 );
+}
+
+/* Closes the JSON file and its blob file
+ * A record that was not ended is discarded
+ * Returns the 0 if succesful or -1 on error
+ */
+int json_file_close(
+     json_file_t *json_file,
+     libcerror_error_t **error )
+{
+	static char *function = "json_file_close";
+	int result            = 0;
+
+	if( json_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON file.",
+		 function );
+
+		return( -1 );
+	}
+	json_file->buffer_offset = json_file->record_offset;
+
+	if( json_file_flush(
+	     json_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush buffer.",
+		 function );
+
+		result = -1;
+	}
+	if( json_file_flush_blob(
+	     json_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush blob buffer.",
+		 function );
+
+		result = -1;
+	}
+	if( libcfile_file_close(
+	     json_file->file_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file handle.",
+		 function );
+
+		result = -1;
+	}
+	if( libcfile_file_close(
+	     json_file->blob_file_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close blob file handle.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Writes the buffered records that were ended to the file handle
+ * Returns 1 if successful or -1 on error
+ */
+int json_file_flush(
+     json_file_t *json_file,
+     libcerror_error_t **error )
+{
+	static char *function = "json_file_flush";
+	ssize_t write_count   = 0;
+
+	if( json_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON file.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_file->record_offset > 0 )
+	{
+		write_count = libcfile_file_write_buffer(
+		               json_file->file_handle,
+		               json_file->buffer,
+		               json_file->record_offset,
+		               error );
+
+		if( write_count != (ssize_t) json_file->record_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write buffer to file handle.",
+			 function );
+
+			return( -1 );
+		}
+		/* Keep the part of the current record that was already written
+		 */
+		if( json_file->buffer_offset > json_file->record_offset )
+		{
+			if( memory_move(
+			     json_file->buffer,
+			     &( json_file->buffer[ json_file->record_offset ] ),
+			     json_file->buffer_offset - json_file->record_offset ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to move buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		json_file->buffer_offset -= json_file->record_offset;
+		json_file->record_offset  = 0;
+	}
+	return( 1 );
+}
+
+/* Resizes the record buffer if it cannot hold a specific amount of additional data
+ * A record is kept in the buffer until it is ended so it can be discarded
+ * Returns 1 if successful or -1 on error
+ */
+int json_file_resize_buffer(
+     json_file_t *json_file,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "json_file_resize_buffer";
+	size_t buffer_size    = 0;
+
+	if( json_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON file.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > ( (size_t) SSIZE_MAX - json_file->buffer_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( json_file->buffer_offset + data_size ) <= json_file->buffer_size )
+	{
+		return( 1 );
+	}
+	/* Write the records that were ended before growing the buffer
+	 */
+	if( json_file_flush(
+	     json_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush buffer.",
+		 function );
+
+		return( -1 );
+	}
+	buffer_size = json_file->buffer_size;
+
+	while( ( json_file->buffer_offset + data_size ) > buffer_size )
+	{
+		if( buffer_size > ( (size_t) SSIZE_MAX / 2 ) )
+		{
+			buffer_size = (size_t) SSIZE_MAX;
+
+			break;
+		}
+		buffer_size *= 2;
+	}
+	if( buffer_size == json_file->buffer_size )
+	{
+		return( 1 );
+	}
+	reallocation = (uint8_t *) memory_reallocate(
+	                            json_file->buffer,
+	                            sizeof( uint8_t ) * buffer_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize buffer.",
+		 function );
+
+		return( -1 );
+	}
+	json_file->buffer      = reallocation;
+	json_file->buffer_size = buffer_size;
+
+	return( 1 );
+}
+
+/* Writes a buffer to the current record of the JSON file
+ * Returns 1 if successful or -1 on error
+ */
+int json_file_write_buffer(
+     json_file_t *json_file,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "json_file_write_buffer";
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_file_resize_buffer(
+	     json_file,
+	     buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( json_file->buffer[ json_file->buffer_offset ] ),
+	     buffer,
+	     buffer_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy buffer.",
+		 function );
+
+		return( -1 );
+	}
+	json_file->buffer_offset += buffer_size;
+
+	return( 1 );
+}
+
+/* Writes the separator that precedes a value
+ * A value that follows a key is not separated
+ * Returns 1 if successful or -1 on error
+ */
+int json_file_write_value_separator(
+     json_file_t *json_file,
+     libcerror_error_t **error )
+{
+	static char *function = "json_file_write_value_separator";
+
+	if( json_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON file.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_file->key_is_set != 0 )
+	{
+		json_file->key_is_set = 0;
+
+		return( 1 );
+	}
+	if( json_file->depth > 0 )
+	{
+		if( json_file->has_values[ json_file->depth ] != 0 )
+		{
+			if( json_file_write_buffer(
+			     json_file,
+			     (uint8_t *) ",",
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write separator.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		json_file->has_values[ json_file->depth ] = 1;
+	}
+	return( 1 );
+}
+
+/* Writes the start of an object or array
+ * Returns 1 if successful or -1 on error
+ */
+int json_file_write_start(
+     json_file_t *json_file,
+     uint8_t character,
+     libcerror_error_t **error )
+{
+	static char *function = "json_file_write_start";
+
+	if( json_file_write_value_separator(
+	     json_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write value separator.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_file->depth >= JSON_FILE_MAXIMUM_DEPTH )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid JSON file - depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_file_write_buffer(
+	     json_file,
+	     &character,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write start character.",
+		 function );
+
+		return( -1 );
+	}
+	json_file->depth += 1;
+
+	json_file->has_values[ json_file->depth ] = 0;
+
+	return( 1 );
+}
+
+/* Writes the end of an object or array
+ * Returns 1 if successful or -1 on error
+ */
+int json_file_write_end(
+     json_file_t *json_file,
+     uint8_t character,
+     libcerror_error_t **error )
+{
+	static char *function = "json_file_write_end";
+
+	if( json_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( json_file->depth <= 0 )
+	 || ( json_file->key_is_set != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid JSON file - no object or array to end.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_file_write_buffer(
+	     json_file,
+	     &character,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write end character.",
+		 function );
+
+		return( -1 );
+	}
+	json_file->depth -= 1;
+
+	return( 1 );
+}
+
+/* Writes the start of an object
+ * Returns 1 if successful or -1 on error
+ */
+int json_file_start_object(
+     json_file_t *json_file,
+     libcerror_error_t **error )
+{
+	return( json_file_write_start(
+	         json_file,
+	         (uint8_t) '{',
+	         error ) );
+}
+
+/* Writes the end of an object
+ * Returns 1 if successful or -1 on error
+ */
+int json_file_end_object(
+     json_file_t *json_file,
+     libcerror_error_t **error )
+{
+	return( json_file_write_end(
+	         json_file,
+	         (uint8_t) '}',
+	         error ) );
+}
+
+/* Writes the start of an array
+ * Returns 1 if successful or -1 on error
+ */
+int json_file_start_array(
+     json_file_t *json_file,
+     libcerror_error_t **error )
+{
+	return( json_file_write_start(
+	         json_file,
+	         (uint8_t) '[',
+	         error ) );
+}
+
+/* Writes the end of an array
+ * Returns 1 if successful or -1 on error
+ */
+int json_file_end_array(
+     json_file_t *json_file,
+     libcerror_error_t **error )
+{
+	return( json_file_write_end(
+	         json_file,
+	         (uint8_t) ']',
+	         error ) );
+}
+
+/* Ends the current record
+ * Every record is written on a single line
+ * Returns 1 if successful or -1 on error
+ */
+int json_file_end_record(
+     json_file_t *json_file,
+     libcerror_error_t **error )
+{
+	static char *function = "json_file_end_record";
+
+	if( json_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( json_file->depth != 0 )
+	 || ( json_file->key_is_set != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid JSON file - record contains an unterminated value.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_file_write_buffer(
+	     json_file,
+	     (uint8_t *) "\n",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write end of record.",
+		 function );
+
+		return( -1 );
+	}
+	json_file->record_offset = json_file->buffer_offset;
+
+	if( json_file->buffer_offset >= JSON_FILE_BUFFER_SIZE )
+	{
+		if( json_file_flush(
+		     json_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Discards the current record
+ * Returns 1 if successful or -1 on error
+ */
+int json_file_discard_record(
+     json_file_t *json_file,
+     libcerror_error_t **error )
+{
+	static char *function = "json_file_discard_record";
+
+	if( json_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON file.",
+		 function );
+
+		return( -1 );
+	}
+	json_file->buffer_offset = json_file->record_offset;
+	json_file->depth         = 0;
+	json_file->key_is_set    = 0;
+
+	return( 1 );
+}
+
+/* Writes the key of an object member
+ * Returns 1 if successful or -1 on error
+ */
+int json_file_write_key(
+     json_file_t *json_file,
+     const char *key,
+     libcerror_error_t **error )
+{
+	static char *function = "json_file_write_key";
+
+	if( json_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON file.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_file->key_is_set != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid JSON file - key already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_file_write_string(
+	     json_file,
+	     key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write key.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_file_write_buffer(
+	     json_file,
+	     (uint8_t *) ":",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write key separator.",
+		 function );
+
+		return( -1 );
+	}
+	json_file->key_is_set = 1;
+
+	return( 1 );
+}
+
+/* Writes an UTF-8 string as a string value
+ * Characters that cannot be part of a JSON string are escaped
+ * and invalid UTF-8 sequences are replaced by U+FFFD
+ * Returns 1 if successful or -1 on error
+ */
+int json_file_write_utf8_string(
+     json_file_t *json_file,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	static const char *hexadecimal_digits = "0123456789abcdef";
+	static char *function                 = "json_file_write_utf8_string";
+	uint8_t *buffer                       = NULL;
+	size_t sequence_index                 = 0;
+	size_t sequence_length                = 0;
+	size_t string_index                   = 0;
+	uint8_t byte_value                    = 0;
+	uint8_t lower_bound                   = 0;
+	uint8_t upper_bound                   = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > ( ( (size_t) SSIZE_MAX - 2 ) / 6 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_file_write_value_separator(
+	     json_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write value separator.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every byte is escaped in at most 6 bytes
+	 */
+	if( json_file_resize_buffer(
+	     json_file,
+	     ( utf8_string_length * 6 ) + 2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize buffer.",
+		 function );
+
+		return( -1 );
+	}
+	buffer = &( json_file->buffer[ json_file->buffer_offset ] );
+
+	*( buffer++ ) = (uint8_t) '"';
+
+	while( string_index < utf8_string_length )
+	{
+		byte_value = utf8_string[ string_index ];
+
+		if( byte_value < 0x80 )
+		{
+			if( ( byte_value == (uint8_t) '"' )
+			 || ( byte_value == (uint8_t) '\\' ) )
+			{
+				*( buffer++ ) = (uint8_t) '\\';
+				*( buffer++ ) = byte_value;
+			}
+			else if( byte_value == (uint8_t) '\n' )
+			{
+				*( buffer++ ) = (uint8_t) '\\';
+				*( buffer++ ) = (uint8_t) 'n';
+			}
+			else if( byte_value == (uint8_t) '\r' )
+			{
+				*( buffer++ ) = (uint8_t) '\\';
+				*( buffer++ ) = (uint8_t) 'r';
+			}
+			else if( byte_value == (uint8_t) '\t' )
+			{
+				*( buffer++ ) = (uint8_t) '\\';
+				*( buffer++ ) = (uint8_t) 't';
+			}
+			else if( byte_value < 0x20 )
+			{
+				*( buffer++ ) = (uint8_t) '\\';
+				*( buffer++ ) = (uint8_t) 'u';
+				*( buffer++ ) = (uint8_t) '0';
+				*( buffer++ ) = (uint8_t) '0';
+				*( buffer++ ) = (uint8_t) hexadecimal_digits[ byte_value >> 4 ];
+				*( buffer++ ) = (uint8_t) hexadecimal_digits[ byte_value & 0x0f ];
+			}
+			else
+			{
+				*( buffer++ ) = byte_value;
+			}
+			string_index++;
+
+			continue;
+		}
+		/* Determine the length of the UTF-8 sequence and the valid range
+		 * of its second byte, which excludes overlong forms and surrogates
+		 */
+		sequence_length = 0;
+		lower_bound     = 0x80;
+		upper_bound     = 0xbf;
+
+		if( ( byte_value >= 0xc2 )
+		 && ( byte_value <= 0xdf ) )
+		{
+			sequence_length = 2;
+		}
+		else if( ( byte_value >= 0xe0 )
+		      && ( byte_value <= 0xef ) )
+		{
+			sequence_length = 3;
+
+			if( byte_value == 0xe0 )
+			{
+				lower_bound = 0xa0;
+			}
+			else if( byte_value == 0xed )
+			{
+				upper_bound = 0x9f;
+			}
+		}
+		else if( ( byte_value >= 0xf0 )
+		      && ( byte_value <= 0xf4 ) )
+		{
+			sequence_length = 4;
+
+			if( byte_value == 0xf0 )
+			{
+				lower_bound = 0x90;
+			}
+			else if( byte_value == 0xf4 )
+			{
+				upper_bound = 0x8f;
+			}
+		}
+		if( ( sequence_length == 0 )
+		 || ( sequence_length > ( utf8_string_length - string_index ) ) )
+		{
+			sequence_length = 0;
+		}
+		else if( ( utf8_string[ string_index + 1 ] < lower_bound )
+		      || ( utf8_string[ string_index + 1 ] > upper_bound ) )
+		{
+			sequence_length = 0;
+		}
+		else
+		{
+			for( sequence_index = 2;
+			     sequence_index < sequence_length;
+			     sequence_index++ )
+			{
+				if( ( utf8_string[ string_index + sequence_index ] < 0x80 )
+				 || ( utf8_string[ string_index + sequence_index ] > 0xbf ) )
+				{
+					sequence_length = 0;
+
+					break;
+				}
+			}
+		}
+		if( sequence_length == 0 )
+		{
+			*( buffer++ ) = (uint8_t) '\\';
+			*( buffer++ ) = (uint8_t) 'u';
+			*( buffer++ ) = (uint8_t) 'f';
+			*( buffer++ ) = (uint8_t) 'f';
+			*( buffer++ ) = (uint8_t) 'f';
+			*( buffer++ ) = (uint8_t) 'd';
+
+			string_index++;
+		}
+		else
+		{
+			for( sequence_index = 0;
+			     sequence_index < sequence_length;
+			     sequence_index++ )
+			{
+				*( buffer++ ) = utf8_string[ string_index++ ];
+			}
+		}
+	}
+	*( buffer++ ) = (uint8_t) '"';
+
+	json_file->buffer_offset = (size_t) ( buffer - json_file->buffer );
+
+	return( 1 );
+}
+
+/* Writes a narrow string as a string value
+ * Returns 1 if successful or -1 on error
+ */
+int json_file_write_string(
+     json_file_t *json_file,
+     const char *string,
+     libcerror_error_t **error )
+{
+	static char *function = "json_file_write_string";
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_file_write_utf8_string(
+	     json_file,
+	     (uint8_t *) string,
+	     libcstring_narrow_string_length(
+	      string ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a value that is not a string
+ * Returns 1 if successful or -1 on error
+ */
+int json_file_write_literal(
+     json_file_t *json_file,
+     const char *literal,
+     size_t literal_length,
+     libcerror_error_t **error )
+{
+	static char *function = "json_file_write_literal";
+
+	if( json_file_write_value_separator(
+	     json_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write value separator.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_file_write_buffer(
+	     json_file,
+	     (uint8_t *) literal,
+	     literal_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write literal.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes an unsigned integer as a number value
+ * Returns 1 if successful or -1 on error
+ */
+int json_file_write_unsigned_integer(
+     json_file_t *json_file,
+     uint64_t value_64bit,
+     libcerror_error_t **error )
+{
+	char integer_string[ 24 ];
+
+	static char *function = "json_file_write_unsigned_integer";
+	size_t string_index   = 24;
+
+	do
+	{
+		string_index--;
+
+		integer_string[ string_index ] = (char) ( '0' + ( value_64bit % 10 ) );
+
+		value_64bit /= 10;
+	}
+	while( value_64bit > 0 );
+
+	if( json_file_write_literal(
+	     json_file,
+	     &( integer_string[ string_index ] ),
+	     24 - string_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write integer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a signed integer as a number value
+ * Returns 1 if successful or -1 on error
+ */
+int json_file_write_signed_integer(
+     json_file_t *json_file,
+     int64_t value_64bit,
+     libcerror_error_t **error )
+{
+	char integer_string[ 24 ];
+
+	static char *function = "json_file_write_signed_integer";
+	size_t string_index   = 24;
+	uint64_t magnitude    = 0;
+
+	if( value_64bit < 0 )
+	{
+		magnitude = ( ~( (uint64_t) value_64bit ) ) + 1;
+	}
+	else
+	{
+		magnitude = (uint64_t) value_64bit;
+	}
+	do
+	{
+		string_index--;
+
+		integer_string[ string_index ] = (char) ( '0' + ( magnitude % 10 ) );
+
+		magnitude /= 10;
+	}
+	while( magnitude > 0 );
+
+	if( value_64bit < 0 )
+	{
+		string_index--;
+
+		integer_string[ string_index ] = '-';
+	}
+	if( json_file_write_literal(
+	     json_file,
+	     &( integer_string[ string_index ] ),
+	     24 - string_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write integer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a floating point as a number value
+ * Values that cannot be represented as a number, such as NaN, are written as null
+ * Returns 1 if successful or -1 on error
+ */
+int json_file_write_floating_point(
+     json_file_t *json_file,
+     double floating_point,
+     libcerror_error_t **error )
+{
+	char floating_point_string[ 32 ];
+
+	static char *function = "json_file_write_floating_point";
+	size_t string_index   = 0;
+	int print_count       = 0;
+
+	/* NaN is not equal to itself and infinity minus itself is NaN
+	 */
+	if( ( floating_point != floating_point )
+	 || ( ( floating_point - floating_point ) != 0.0 ) )
+	{
+		return( json_file_write_null(
+		         json_file,
+		         error ) );
+	}
+	print_count = libcstring_narrow_string_snprintf(
+	               floating_point_string,
+	               32,
+	               "%.17g",
+	               floating_point );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= 32 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set floating point string.",
+		 function );
+
+		return( -1 );
+	}
+	/* The decimal point of the current locale is not necessarily a period
+	 */
+	for( string_index = 0;
+	     string_index < (size_t) print_count;
+	     string_index++ )
+	{
+		if( floating_point_string[ string_index ] == ',' )
+		{
+			floating_point_string[ string_index ] = '.';
+		}
+	}
+	if( json_file_write_literal(
+	     json_file,
+	     floating_point_string,
+	     (size_t) print_count,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write floating point.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a boolean value
+ * Returns 1 if successful or -1 on error
+ */
+int json_file_write_boolean(
+     json_file_t *json_file,
+     uint8_t value_boolean,
+     libcerror_error_t **error )
+{
+	static char *function = "json_file_write_boolean";
+	int result            = 0;
+
+	if( value_boolean == 0 )
+	{
+		result = json_file_write_literal(
+		          json_file,
+		          "false",
+		          5,
+		          error );
+	}
+	else
+	{
+		result = json_file_write_literal(
+		          json_file,
+		          "true",
+		          4,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write boolean.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a null value
+ * Returns 1 if successful or -1 on error
+ */
+int json_file_write_null(
+     json_file_t *json_file,
+     libcerror_error_t **error )
+{
+	static char *function = "json_file_write_null";
+
+	if( json_file_write_literal(
+	     json_file,
+	     "null",
+	     4,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write null.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a filetime as an ISO 8601 date and time string value in UTC
+ * A filetime that cannot be represented as a date and time is written as a number value
+ * Returns 1 if successful or -1 on error
+ */
+int json_file_write_filetime(
+     json_file_t *json_file,
+     uint64_t filetime,
+     libcerror_error_t **error )
+{
+	uint8_t filetime_string[ 48 ];
+
+	libfdatetime_filetime_t *date_time = NULL;
+	static char *function              = "json_file_write_filetime";
+	size_t filetime_string_length      = 0;
+	int result                         = 0;
+
+	if( libfdatetime_filetime_initialize(
+	     &date_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create filetime.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdatetime_filetime_copy_from_64bit(
+	     date_time,
+	     filetime,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy filetime from 64-bit value.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfdatetime_filetime_copy_to_utf8_string(
+	          date_time,
+	          filetime_string,
+	          47,
+	          LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
+	          NULL );
+
+	if( libfdatetime_filetime_free(
+	     &date_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free filetime.",
+		 function );
+
+		goto on_error;
+	}
+	if( result != 1 )
+	{
+		result = json_file_write_unsigned_integer(
+		          json_file,
+		          filetime,
+		          error );
+	}
+	else
+	{
+		filetime_string_length = libcstring_narrow_string_length(
+		                          (char *) filetime_string );
+
+		filetime_string[ filetime_string_length++ ] = (uint8_t) 'Z';
+
+		result = json_file_write_utf8_string(
+		          json_file,
+		          filetime_string,
+		          filetime_string_length,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write filetime.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( date_time != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &date_time,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes a GUID as a string value
+ * Returns 1 if successful or -1 on error
+ */
+int json_file_write_guid(
+     json_file_t *json_file,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t guid_string[ 48 ];
+
+	libfguid_identifier_t *guid = NULL;
+	static char *function       = "json_file_write_guid";
+	size_t guid_string_length   = 0;
+
+	if( libfguid_identifier_initialize(
+	     &guid,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create GUID.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfguid_identifier_copy_from_byte_stream(
+	     guid,
+	     guid_data,
+	     guid_data_size,
+	     LIBFGUID_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy byte stream to GUID.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfguid_identifier_copy_to_utf8_string(
+	     guid,
+	     guid_string,
+	     48,
+	     LIBFGUID_STRING_FORMAT_USE_LOWER_CASE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy GUID to string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfguid_identifier_free(
+	     &guid,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free GUID.",
+		 function );
+
+		goto on_error;
+	}
+	guid_string_length = libcstring_narrow_string_length(
+	                      (char *) guid_string );
+
+	if( json_file_write_utf8_string(
+	     json_file,
+	     guid_string,
+	     guid_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write GUID.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( guid != NULL )
+	{
+		libfguid_identifier_free(
+		 &guid,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes data as a string value of hexadecimal digits
+ * Returns 1 if successful or -1 on error
+ */
+int json_file_write_data_as_hexadecimal(
+     json_file_t *json_file,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static const char *hexadecimal_digits = "0123456789abcdef";
+	static char *function                 = "json_file_write_data_as_hexadecimal";
+	uint8_t *buffer                       = NULL;
+	size_t data_index                     = 0;
+
+	if( ( data == NULL )
+	 && ( data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > ( ( (size_t) SSIZE_MAX - 2 ) / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_file_write_value_separator(
+	     json_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write value separator.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_file_resize_buffer(
+	     json_file,
+	     ( data_size * 2 ) + 2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize buffer.",
+		 function );
+
+		return( -1 );
+	}
+	buffer = &( json_file->buffer[ json_file->buffer_offset ] );
+
+	*( buffer++ ) = (uint8_t) '"';
+
+	for( data_index = 0;
+	     data_index < data_size;
+	     data_index++ )
+	{
+		*( buffer++ ) = (uint8_t) hexadecimal_digits[ data[ data_index ] >> 4 ];
+		*( buffer++ ) = (uint8_t) hexadecimal_digits[ data[ data_index ] & 0x0f ];
+	}
+	*( buffer++ ) = (uint8_t) '"';
+
+	json_file->buffer_offset = (size_t) ( buffer - json_file->buffer );
+
+	return( 1 );
+}
+
+/* Writes the buffered blob data to the blob file handle
+ * Returns 1 if successful or -1 on error
+ */
+int json_file_flush_blob(
+     json_file_t *json_file,
+     libcerror_error_t **error )
+{
+	static char *function = "json_file_flush_blob";
+	ssize_t write_count   = 0;
+
+	if( json_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON file.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_file->blob_buffer_offset > 0 )
+	{
+		write_count = libcfile_file_write_buffer(
+		               json_file->blob_file_handle,
+		               json_file->blob_buffer,
+		               json_file->blob_buffer_offset,
+		               error );
+
+		if( write_count != (ssize_t) json_file->blob_buffer_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write blob buffer to blob file handle.",
+			 function );
+
+			return( -1 );
+		}
+		json_file->blob_buffer_offset = 0;
+	}
+	return( 1 );
+}
+
+/* Writes data to the blob file
+ * The blob data is not part of a record, the offset of the data
+ * in the blob file is the value of blob offset before the write
+ * Returns 1 if successful or -1 on error
+ */
+int json_file_write_blob_data(
+     json_file_t *json_file,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "json_file_write_blob_data";
+	size_t copy_size      = 0;
+	ssize_t write_count   = 0;
+
+	if( json_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON file.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	json_file->blob_offset += (off64_t) data_size;
+
+	while( data_size > 0 )
+	{
+		if( ( json_file->blob_buffer_offset == 0 )
+		 && ( data_size >= JSON_FILE_BUFFER_SIZE ) )
+		{
+			write_count = libcfile_file_write_buffer(
+			               json_file->blob_file_handle,
+			               data,
+			               data_size,
+			               error );
+
+			if( write_count != (ssize_t) data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write data to blob file handle.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+		}
+		copy_size = JSON_FILE_BUFFER_SIZE - json_file->blob_buffer_offset;
+
+		if( copy_size > data_size )
+		{
+			copy_size = data_size;
+		}
+		if( memory_copy(
+		     &( json_file->blob_buffer[ json_file->blob_buffer_offset ] ),
+		     data,
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+		json_file->blob_buffer_offset += copy_size;
+		data                          += copy_size;
+		data_size                     -= copy_size;
+
+		if( json_file->blob_buffer_offset == JSON_FILE_BUFFER_SIZE )
+		{
+			if( json_file_flush_blob(
+			     json_file,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to flush blob buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,248 @@
+/* 
+ * JSON file
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _JSON_FILE_H )
+#define _JSON_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pfftools_libcerror.h"
+#include "pfftools_libcfile.h"
+#include "pfftools_libcstring.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* Data is written to the file handles in large sequential chunks
+ */
+#define JSON_FILE_BUFFER_SIZE		( 1024 * 1024 )
+
+/* The maximum nesting depth of objects and arrays
+ */
+#define JSON_FILE_MAXIMUM_DEPTH		64
+
+typedef struct json_file json_file_t;
+
+struct json_file
+{
+	/* The file handle the records are written to
+	 */
+	libcfile_file_t *file_handle;
+
+	/* The record buffer
+	 */
+	uint8_t *buffer;
+
+	/* The record buffer size
+	 */
+	size_t buffer_size;
+
+	/* The record buffer offset
+	 */
+	size_t buffer_offset;
+
+	/* The offset of the start of the current record in the record buffer
+	 */
+	size_t record_offset;
+
+	/* The current nesting depth
+	 */
+	int depth;
+
+	/* Values to indicate an object or array at a specific depth
+	 * already contains a value
+	 */
+	uint8_t has_values[ JSON_FILE_MAXIMUM_DEPTH + 1 ];
+
+	/* Value to indicate a key was written and its value is expected
+	 */
+	uint8_t key_is_set;
+
+	/* The file handle the blob data is written to
+	 */
+	libcfile_file_t *blob_file_handle;
+
+	/* The blob buffer
+	 */
+	uint8_t *blob_buffer;
+
+	/* The blob buffer offset
+	 */
+	size_t blob_buffer_offset;
+
+	/* The offset of the next blob data in the blob file
+	 */
+	off64_t blob_offset;
+};
+
+int json_file_initialize(
+     json_file_t **json_file,
+     libcerror_error_t **error );
+
+int json_file_free(
+     json_file_t **json_file,
+     libcerror_error_t **error );
+
+int json_file_open(
+     json_file_t *json_file,
+     const libcstring_system_character_t *filename,
+     const libcstring_system_character_t *blob_filename,
+     libcerror_error_t **error );
+
+int json_file_close(
+     json_file_t *json_file,
+     libcerror_error_t **error );
+
+int json_file_flush(
+     json_file_t *json_file,
+     libcerror_error_t **error );
+
+int json_file_resize_buffer(
+     json_file_t *json_file,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int json_file_write_buffer(
+     json_file_t *json_file,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int json_file_write_value_separator(
+     json_file_t *json_file,
+     libcerror_error_t **error );
+
+int json_file_write_start(
+     json_file_t *json_file,
+     uint8_t character,
+     libcerror_error_t **error );
+
+int json_file_write_end(
+     json_file_t *json_file,
+     uint8_t character,
+     libcerror_error_t **error );
+
+int json_file_start_object(
+     json_file_t *json_file,
+     libcerror_error_t **error );
+
+int json_file_end_object(
+     json_file_t *json_file,
+     libcerror_error_t **error );
+
+int json_file_start_array(
+     json_file_t *json_file,
+     libcerror_error_t **error );
+
+int json_file_end_array(
+     json_file_t *json_file,
+     libcerror_error_t **error );
+
+int json_file_end_record(
+     json_file_t *json_file,
+     libcerror_error_t **error );
+
+int json_file_discard_record(
+     json_file_t *json_file,
+     libcerror_error_t **error );
+
+int json_file_write_key(
+     json_file_t *json_file,
+     const char *key,
+     libcerror_error_t **error );
+
+int json_file_write_utf8_string(
+     json_file_t *json_file,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+int json_file_write_string(
+     json_file_t *json_file,
+     const char *string,
+     libcerror_error_t **error );
+
+int json_file_write_literal(
+     json_file_t *json_file,
+     const char *literal,
+     size_t literal_length,
+     libcerror_error_t **error );
+
+int json_file_write_unsigned_integer(
+     json_file_t *json_file,
+     uint64_t value_64bit,
+     libcerror_error_t **error );
+
+int json_file_write_signed_integer(
+     json_file_t *json_file,
+     int64_t value_64bit,
+     libcerror_error_t **error );
+
+int json_file_write_floating_point(
+     json_file_t *json_file,
+     double floating_point,
+     libcerror_error_t **error );
+
+int json_file_write_boolean(
+     json_file_t *json_file,
+     uint8_t value_boolean,
+     libcerror_error_t **error );
+
+int json_file_write_null(
+     json_file_t *json_file,
+     libcerror_error_t **error );
+
+int json_file_write_filetime(
+     json_file_t *json_file,
+     uint64_t filetime,
+     libcerror_error_t **error );
+
+int json_file_write_guid(
+     json_file_t *json_file,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error );
+
+int json_file_write_data_as_hexadecimal(
+     json_file_t *json_file,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int json_file_flush_blob(
+     json_file_t *json_file,
+     libcerror_error_t **error );
+
+int json_file_write_blob_data(
+     json_file_t *json_file,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -59,32 +59,69 @@ void usage_fprint(
 	fprintf( stream, "Use pffexport to export items stored in a Personal Folder File (OST, PAB\n"
 	                 "and PST).\n\n" );
 
-	fprintf( stream, "Usage: pffexport [ -c codepage ] [ -f format ] [ -l logfile ] [ -m mode ]\n"
-	                 "                 [ -t target ] [ -dhqvV ] source\n\n" );
+	fprintf( stream, "Usage: pffexport [ -c codepage ] [ -e end ] [ -f format ]\n"
+	                 "                 [ -i manifest ] [ -k checkpoint ] [ -l logfile ]\n"
+	                 "                 [ -m mode ] [ -o output ] [ -p folder ] [ -s start ]\n"
+	                 "                 [ -t target ] [ -u mode ] [ -y types ]\n"
+	                 "                 [ -adhqvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
+	fprintf( stream, "\t-a:     only exports the messages that have attachments\n" );
 	fprintf( stream, "\t-c:     codepage of ASCII strings, options: ascii, windows-1250,\n"
 	                 "\t        windows-1251, windows-1252 (default), windows-1253,\n"
 	                 "\t        windows-1254, windows-1255, windows-1256, windows-1257\n"
 	                 "\t        or windows-1258\n" );
 	fprintf( stream, "\t-d:     dumps the item values in a separate file: ItemValues.txt\n" );
-	fprintf( stream, "\t-f:     preferred output format, options: all, html, rtf,\n"
-	                 "\t        text (default)\n" );
+	fprintf( stream, "\t-e:     only exports the messages delivered before the end date,\n"
+	                 "\t        in the format: YYYY-MM-DD [HH:MM[:SS]] in UTC. A date\n"
+	                 "\t        without a time includes the whole day. Messages without\n"
+	                 "\t        a delivery time are matched on their client submit time\n" );
+	fprintf( stream, "\t-f:     preferred output format, options: all, html, jsonl, rtf,\n"
+	                 "\t        text (default). 'jsonl' writes one JSON record per item\n"
+	                 "\t        to a file named after the target with the suffix: .jsonl\n"
+	                 "\t        and the attachment data to a file with the suffix: .blob\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-i:     incremental export, only exports the messages that are new\n"
+	                 "\t        or changed since the export that wrote the manifest file.\n"
+	                 "\t        The manifest file is updated when the export completes and\n"
+	                 "\t        the identifiers of deleted items are written to the log\n" );
+	fprintf( stream, "\t-k:     stores the item recovery state in a checkpoint file so that\n"
+	                 "\t        an interrupted recovery continues where it stopped when\n"
+	                 "\t        pffexport is run again with the same checkpoint file\n" );
 	fprintf( stream, "\t-l:     logs information about the exported items\n" );
 	fprintf( stream, "\t-m:     export mode, option: all, debug, items (default), recovered.\n"
 	                 "\t        'all' exports the (allocated) items, orphan and recovered\n"
 	                 "\t        items. 'debug' exports all the (allocated) items, also those\n"
 	                 "\t        outside the the root folder. 'items' exports the (allocated)\n"
 	                 "\t        items. 'recovered' exports the orphan and recovered items.\n" );
+	fprintf( stream, "\t-o:     output format, options: directory (default), tar.\n"
+	                 "\t        'tar' writes the export to a single (GNU) tar archive\n"
+	                 "\t        named after the target with the suffix: .tar\n" );
+	fprintf( stream, "\t-p:     only exports the messages in the folders of which the path\n"
+	                 "\t        matches the pattern. The path is relative to the export\n"
+	                 "\t        directory, e.g. 'Top of Personal Folders/Sent Items'. '*'\n"
+	                 "\t        matches any sequence of characters and '?' any character\n" );
 	fprintf( stream, "\t-q:     quiet shows minimal status information\n" );
+	fprintf( stream, "\t-s:     only exports the messages delivered at or after the start\n"
+	                 "\t        date, in the format: YYYY-MM-DD [HH:MM[:SS]] in UTC\n" );
 	fprintf( stream, "\t-t:     specify the basename of the target directory to export to\n"
 	                 "\t        (default is the source filename) pffexport will add the\n"
 	                 "\t        following suffixes to the basename: .export, .orphans,\n"
 	                 "\t        .recovered\n" );
+	fprintf( stream, "\t-u:     deduplicate attachment data, options: none (default), fast,\n"
+	                 "\t        sha256. Attachment data is compared by its size and\n"
+	                 "\t        a fast hash, 'sha256' also compares a SHA-256 digest.\n"
+	                 "\t        Duplicates are written as hard links, tar link entries\n"
+	                 "\t        or refer to the blob offset of the first copy\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\t-y:     only exports the messages of the item types, a comma\n"
+	                 "\t        separated list of: activity, appointment, common,\n"
+	                 "\t        configuration, conflict_message, contact,\n"
+	                 "\t        distribution_list, document, email, email_smime, fax,\n"
+	                 "\t        meeting, mms, note, posting_note, rss_feed, sharing, sms,\n"
+	                 "\t        task, task_request, unknown, voicemail\n" );
 }
 
 /* Signal handler for pffexport
@@ -152,10 +189,18 @@ int main( int argc, char * const argv[] )
 {
 	libcerror_error_t *error                                       = NULL;
 	log_handle_t *log_handle                                      = NULL;
+	libcstring_system_character_t *checkpoint_filename            = NULL;
 	libcstring_system_character_t *log_filename                   = NULL;
+	libcstring_system_character_t *manifest_filename              = NULL;
 	libcstring_system_character_t *option_ascii_codepage          = NULL;
+	libcstring_system_character_t *option_deduplication_mode      = NULL;
+	libcstring_system_character_t *option_end_time                = NULL;
 	libcstring_system_character_t *option_export_mode             = NULL;
+	libcstring_system_character_t *option_folder_path_pattern     = NULL;
+	libcstring_system_character_t *option_item_types              = NULL;
+	libcstring_system_character_t *option_output_format           = NULL;
 	libcstring_system_character_t *option_preferred_export_format = NULL;
+	libcstring_system_character_t *option_start_time              = NULL;
 	libcstring_system_character_t *option_target_path             = NULL;
 	libcstring_system_character_t *path_separator                 = NULL;
 	libcstring_system_character_t *source                         = NULL;
@@ -163,6 +208,7 @@ int main( int argc, char * const argv[] )
 	size_t source_length                                          = 0;
 	libcstring_system_integer_t option                            = 0;
 	uint8_t dump_item_values                                      = 0;
+	uint8_t has_attachments                                       = 0;
 	uint8_t print_status_information                              = 1;
 	int result                                                    = 0;
 	int verbose                                                   = 0;
@@ -200,7 +246,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = libcsystem_getopt(
 	                   argc,
 	                   argv,
-	                   _LIBCSTRING_SYSTEM_STRING( "c:df:hl:m:qt:vV" ) ) ) != (libcstring_system_integer_t) -1 )
+	                   _LIBCSTRING_SYSTEM_STRING( "ac:de:f:hi:k:l:m:o:p:qs:t:u:vVy:" ) ) ) != (libcstring_system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -216,6 +262,11 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (libcstring_system_integer_t) 'a':
+				has_attachments = 1;
+
+				break;
+
 			case (libcstring_system_integer_t) 'c':
 				option_ascii_codepage = optarg;
 
@@ -226,6 +277,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (libcstring_system_integer_t) 'e':
+				option_end_time = optarg;
+
+				break;
+
 			case (libcstring_system_integer_t) 'f':
 				option_preferred_export_format = optarg;
 
@@ -237,6 +293,16 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+			case (libcstring_system_integer_t) 'i':
+				manifest_filename = optarg;
+
+				break;
+
+			case (libcstring_system_integer_t) 'k':
+				checkpoint_filename = optarg;
+
+				break;
+
 			case (libcstring_system_integer_t) 'l':
 				log_filename = optarg;
 
@@ -247,16 +313,36 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (libcstring_system_integer_t) 'o':
+				option_output_format = optarg;
+
+				break;
+
+			case (libcstring_system_integer_t) 'p':
+				option_folder_path_pattern = optarg;
+
+				break;
+
 			case (libcstring_system_integer_t) 'q':
 				print_status_information = 0;
 
 				break;
 
+			case (libcstring_system_integer_t) 's':
+				option_start_time = optarg;
+
+				break;
+
 			case (libcstring_system_integer_t) 't':
 				option_target_path = optarg;
 
 				break;
 
+			case (libcstring_system_integer_t) 'u':
+				option_deduplication_mode = optarg;
+
+				break;
+
 			case (libcstring_system_integer_t) 'v':
 				verbose = 1;
 
@@ -267,6 +353,11 @@ int main( int argc, char * const argv[] )
 				 stdout );
 
 				return( EXIT_SUCCESS );
+
+			case (libcstring_system_integer_t) 'y':
+				option_item_types = optarg;
+
+				break;
 		}
 	}
 	if( optind == argc )
@@ -368,6 +459,28 @@ int main( int argc, char * const argv[] )
 			 "Unsupported preferred export format defaulting to: text.\n" );
 		}
 	}
+	if( option_output_format != NULL )
+	{
+		result = export_handle_set_output_format(
+			  pffexport_export_handle,
+			  option_output_format,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set output format.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported output format defaulting to: directory.\n" );
+		}
+	}
 	if( option_ascii_codepage != NULL )
 	{
 		result = export_handle_set_ascii_codepage(
@@ -390,6 +503,119 @@ int main( int argc, char * const argv[] )
 			 "Unsupported ASCII codepage defaulting to: windows-1252.\n" );
 		}
 	}
+	if( option_deduplication_mode != NULL )
+	{
+		result = export_handle_set_deduplication_mode(
+		          pffexport_export_handle,
+		          option_deduplication_mode,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set deduplication mode.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported deduplication mode defaulting to: none.\n" );
+		}
+	}
+	if( option_folder_path_pattern != NULL )
+	{
+		if( export_filter_set_folder_path_pattern(
+		     pffexport_export_handle->export_filter,
+		     option_folder_path_pattern,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set folder path pattern.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_start_time != NULL )
+	{
+		result = export_filter_set_start_time(
+		          pffexport_export_handle->export_filter,
+		          option_start_time,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set start time.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported start time: %" PRIs_LIBCSTRING_SYSTEM ".\n",
+			 option_start_time );
+
+			goto on_error;
+		}
+	}
+	if( option_end_time != NULL )
+	{
+		result = export_filter_set_end_time(
+		          pffexport_export_handle->export_filter,
+		          option_end_time,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set end time.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported end time: %" PRIs_LIBCSTRING_SYSTEM ".\n",
+			 option_end_time );
+
+			goto on_error;
+		}
+	}
+	if( option_item_types != NULL )
+	{
+		result = export_filter_set_item_types(
+		          pffexport_export_handle->export_filter,
+		          option_item_types,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set item types.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported item types: %" PRIs_LIBCSTRING_SYSTEM ".\n",
+			 option_item_types );
+
+			goto on_error;
+		}
+	}
+	pffexport_export_handle->export_filter->has_attachments = has_attachments;
+
 	if( export_handle_set_target_path(
 	     pffexport_export_handle,
 	     option_target_path,
@@ -401,6 +627,59 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( ( pffexport_export_handle->preferred_export_format == EXPORT_FORMAT_JSONL )
+	 && ( pffexport_export_handle->output_format == EXPORT_OUTPUT_FORMAT_TAR ) )
+	{
+		fprintf(
+		 stderr,
+		 "Output format: tar not supported with format: jsonl defaulting to: directory.\n" );
+
+		pffexport_export_handle->output_format = EXPORT_OUTPUT_FORMAT_DIRECTORY;
+	}
+	result = export_handle_open_json(
+	          pffexport_export_handle,
+	          &error );
+
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open JSON file.\n" );
+
+		goto on_error;
+	}
+	else if( ( result == 0 )
+	      && ( pffexport_export_handle->preferred_export_format == EXPORT_FORMAT_JSONL ) )
+	{
+		fprintf(
+		 stderr,
+		 "%" PRIs_LIBCSTRING_SYSTEM ".jsonl or .blob already exists.\n",
+		 pffexport_export_handle->target_path );
+
+		goto on_error;
+	}
+	result = export_handle_open_archive(
+	          pffexport_export_handle,
+	          &error );
+
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open archive.\n" );
+
+		goto on_error;
+	}
+	else if( ( result == 0 )
+	      && ( pffexport_export_handle->output_format == EXPORT_OUTPUT_FORMAT_TAR ) )
+	{
+		fprintf(
+		 stderr,
+		 "%" PRIs_LIBCSTRING_SYSTEM ".tar already exists.\n",
+		 pffexport_export_handle->target_path );
+
+		goto on_error;
+	}
 	result = export_handle_create_items_export_path(
 	          pffexport_export_handle,
 	          &error );
@@ -542,6 +821,63 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( checkpoint_filename != NULL )
+	{
+#if defined( LIBCSTRING_HAVE_WIDE_SYSTEM_CHARACTER )
+		if( libpff_file_set_recovery_checkpoint_file_wide(
+		     pffexport_file,
+		     checkpoint_filename,
+		     &error ) != 1 )
+#else
+		if( libpff_file_set_recovery_checkpoint_file(
+		     pffexport_file,
+		     checkpoint_filename,
+		     &error ) != 1 )
+#endif
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set checkpoint file: %" PRIs_LIBCSTRING_SYSTEM ".\n",
+			 checkpoint_filename );
+
+			goto on_error;
+		}
+	}
+	if( export_handle_open_source(
+	     pffexport_export_handle,
+	     source,
+	     &error ) == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open source: %" PRIs_LIBCSTRING_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	if( manifest_filename != NULL )
+	{
+		result = export_handle_open_manifest(
+		          pffexport_export_handle,
+		          manifest_filename,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open manifest file: %" PRIs_LIBCSTRING_SYSTEM ".\n",
+			 manifest_filename );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stdout,
+			 "No previous manifest, exporting all items.\n" );
+		}
+	}
 	if( export_handle_export_file(
 	     pffexport_export_handle,
 	     pffexport_file,
@@ -554,6 +890,37 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( export_handle_close_manifest(
+	     pffexport_export_handle,
+	     manifest_filename,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close manifest file.\n" );
+
+		goto on_error;
+	}
+	if( export_handle_close_archive(
+	     pffexport_export_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close archive.\n" );
+
+		goto on_error;
+	}
+	if( export_handle_close_json(
+	     pffexport_export_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close JSON file.\n" );
+
+		goto on_error;
+	}
 	if( libpff_file_close(
 	     pffexport_file,
 	     &error ) != 0 )
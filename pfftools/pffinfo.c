@@ -58,7 +58,7 @@ void usage_fprint(
 	fprintf( stream, "Use pffinfo to determine information about a Personal Folder File (OST, PAB\n"
 	                 "and PST).\n\n" );
 
-	fprintf( stream, "Usage: pffinfo [ -c codepage ] [ -ahvV ] source\n\n" );
+	fprintf( stream, "Usage: pffinfo [ -c codepage ] [ -ahsvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
@@ -68,6 +68,8 @@ void usage_fprint(
 	                 "\t        windows-1254, windows-1255, windows-1256, windows-1257\n"
 	                 "\t        or windows-1258\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-s:     reads all items and shows the IO, buffer pool and cache\n"
+	                 "\t        statistics\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 }
@@ -125,6 +127,7 @@ int main( int argc, char * const argv[] )
 	char *program                                        = "pffinfo";
 	libcstring_system_integer_t option                   = 0;
 	uint8_t show_allocation_information                  = 0;
+	uint8_t show_statistics                              = 0;
 	int result                                           = 0;
 	int verbose                                          = 0;
 
@@ -161,7 +164,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = libcsystem_getopt(
 	                   argc,
 	                   argv,
-	                   _LIBCSTRING_SYSTEM_STRING( "ac:hvV" ) ) ) != (libcstring_system_integer_t) -1 )
+	                   _LIBCSTRING_SYSTEM_STRING( "ac:hsvV" ) ) ) != (libcstring_system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -193,6 +196,11 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+			case (libcstring_system_integer_t) 's':
+				show_statistics = 1;
+
+				break;
+
 			case (libcstring_system_integer_t) 'v':
 				verbose = 1;
 
@@ -318,6 +326,19 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	if( show_statistics != 0 )
+	{
+		if( info_handle_statistics_fprint(
+		     pffinfo_info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print statistics.\n" );
+
+			goto on_error;
+		}
+	}
 /* TODO
 	if( libcsystem_signal_detach(
 	     &error ) != 1 )
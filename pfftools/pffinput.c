@@ -127,6 +127,17 @@ int pffinput_determine_export_format(
 			result         = 1;
 		}
 	}
+	else if( string_length == 5 )
+	{
+		if( libcstring_system_string_compare(
+		     string,
+		     _LIBCSTRING_SYSTEM_STRING( "jsonl" ),
+		     5 ) == 0 )
+		{
+			*export_format = EXPORT_FORMAT_JSONL;
+			result         = 1;
+		}
+	}
 	return( result );
 }
 
@@ -27,9 +27,11 @@
 #endif
 
 #include "pypff.h"
+#include "pypff_attachment.h"
 #include "pypff_file.h"
 #include "pypff_folder.h"
 #include "pypff_item.h"
+#include "pypff_items.h"
 #include "pypff_libcerror.h"
 #include "pypff_libcstring.h"
 #include "pypff_libpff.h"
@@ -126,10 +128,14 @@ PyObject *pypff_check_file_signature(
 	{
 		return( NULL );
 	}
+	Py_BEGIN_ALLOW_THREADS
+
 	result = libpff_check_file_signature(
 	          filename,
 	          &error );
 
+	Py_END_ALLOW_THREADS
+
 	if( result == -1 )
 	{
 		if( libcerror_error_backtrace_sprint(
@@ -173,12 +179,14 @@ PyObject *pypff_check_file_signature(
 PyMODINIT_FUNC initpypff(
                 void ) 
 {
-	PyObject *module                  = NULL;
-	PyTypeObject *file_type_object    = NULL;
-	PyTypeObject *folder_type_object  = NULL;
-	PyTypeObject *item_type_object    = NULL;
-	PyTypeObject *message_type_object = NULL;
-	PyGILState_STATE gil_state        = 0;
+	PyObject *module                     = NULL;
+	PyTypeObject *attachment_type_object = NULL;
+	PyTypeObject *file_type_object       = NULL;
+	PyTypeObject *folder_type_object     = NULL;
+	PyTypeObject *item_type_object       = NULL;
+	PyTypeObject *items_type_object      = NULL;
+	PyTypeObject *message_type_object    = NULL;
+	PyGILState_STATE gil_state           = 0;
 
 	PyEval_InitThreads();
 
@@ -191,6 +199,25 @@ PyMODINIT_FUNC initpypff(
 	          pypff_module_methods,
 	          "Python libpff module (pypff)." );
 
+	/* Setup the attachment type object
+	 */
+	pypff_attachment_type_object.tp_new = PyType_GenericNew;
+
+	if( PyType_Ready(
+	     &pypff_attachment_type_object ) < 0 )
+	{
+		return;
+	}
+	Py_IncRef(
+	 (PyObject *) &pypff_attachment_type_object );
+
+	attachment_type_object = &pypff_attachment_type_object;
+
+	PyModule_AddObject(
+	 module,
+	 "attachment",
+	 (PyObject *) attachment_type_object );
+
 	/* Setup the file type object
 	 */
 	pypff_file_type_object.tp_new = PyType_GenericNew;
@@ -248,6 +275,25 @@ PyMODINIT_FUNC initpypff(
 	 "item",
 	 (PyObject *) item_type_object );
 
+	/* Setup the items type object
+	 */
+	pypff_items_type_object.tp_new = PyType_GenericNew;
+
+	if( PyType_Ready(
+	     &pypff_items_type_object ) < 0 )
+	{
+		return;
+	}
+	Py_IncRef(
+	 (PyObject *) &pypff_items_type_object );
+
+	items_type_object = &pypff_items_type_object;
+
+	PyModule_AddObject(
+	 module,
+	 "_items",
+	 (PyObject *) items_type_object );
+
 	/* Setup the message type object
 	 */
 	pypff_message_type_object.tp_new = PyType_GenericNew;
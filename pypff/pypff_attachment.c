@@ -0,0 +1,1284 @@
+/*
+ * Python object definition of the attachment type libpff item
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pypff.h"
+#include "pypff_attachment.h"
+#include "pypff_libcerror.h"
+#include "pypff_libcstring.h"
+#include "pypff_libpff.h"
+#include "pypff_python.h"
+#include "pypff_value.h"
+
+PyMethodDef pypff_attachment_object_methods[] = {
+
+	/* Functions to access the attachment values */
+
+	{ "get_type",
+	  (PyCFunction) pypff_attachment_get_type,
+	  METH_NOARGS,
+	  "Retrieves the attachment type" },
+
+	{ "get_long_filename",
+	  (PyCFunction) pypff_attachment_get_long_filename,
+	  METH_NOARGS,
+	  "Retrieves the long filename" },
+
+	/* Functions to access the attachment data */
+
+	{ "get_size",
+	  (PyCFunction) pypff_attachment_get_size,
+	  METH_NOARGS,
+	  "Retrieves the size of the data" },
+
+	{ "read_buffer",
+	  (PyCFunction) pypff_attachment_read_buffer,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "Reads a buffer of data from the current offset\n"
+	  "\n"
+	  "Reads the remainder of the data if no size is specified" },
+
+	{ "read",
+	  (PyCFunction) pypff_attachment_read_buffer,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "Reads a buffer of data from the current offset\n"
+	  "\n"
+	  "Reads the remainder of the data if no size is specified" },
+
+	{ "readinto",
+	  (PyCFunction) pypff_attachment_read_into_buffer,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "Reads data from the current offset into a writable buffer object\n"
+	  "\n"
+	  "Returns the number of bytes read" },
+
+	{ "seek_offset",
+	  (PyCFunction) pypff_attachment_seek_offset,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "Seeks an offset within the data" },
+
+	{ "seek",
+	  (PyCFunction) pypff_attachment_seek_offset,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "Seeks an offset within the data" },
+
+	{ "get_offset",
+	  (PyCFunction) pypff_attachment_get_offset,
+	  METH_NOARGS,
+	  "Retrieves the current offset within the data" },
+
+	{ "tell",
+	  (PyCFunction) pypff_attachment_get_offset,
+	  METH_NOARGS,
+	  "Retrieves the current offset within the data" },
+
+	/* Sentinel */
+	{ NULL, NULL, 0, NULL }
+};
+
+PyGetSetDef pypff_attachment_object_get_set_definitions[] = {
+
+	{ "type",
+	  (getter) pypff_attachment_get_type,
+	  (setter) 0,
+	  "The attachment type",
+	  NULL },
+
+	{ "long_filename",
+	  (getter) pypff_attachment_get_long_filename,
+	  (setter) 0,
+	  "The long filename",
+	  NULL },
+
+	{ "size",
+	  (getter) pypff_attachment_get_size,
+	  (setter) 0,
+	  "The size of the data",
+	  NULL },
+
+	/* Sentinel */
+	{ NULL, NULL, NULL, NULL, NULL }
+};
+
+PyBufferProcs pypff_attachment_buffer_procedures = {
+	/* bf_getreadbuffer */
+	(readbufferproc) pypff_attachment_buffer_get_segment,
+	/* bf_getwritebuffer */
+	0,
+	/* bf_getsegcount */
+	(segcountproc) pypff_attachment_buffer_get_number_of_segments,
+	/* bf_getcharbuffer */
+	(charbufferproc) pypff_attachment_buffer_get_segment,
+	/* bf_getbuffer */
+	(getbufferproc) pypff_attachment_buffer_get_buffer,
+	/* bf_releasebuffer */
+	0
+};
+
+PyTypeObject pypff_attachment_type_object = {
+	PyObject_HEAD_INIT( NULL )
+
+	/* ob_size */
+	0,
+	/* tp_name */
+	"pypff.attachment",
+	/* tp_basicsize */
+	sizeof( pypff_attachment_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pypff_attachment_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_compare */
+	0,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	0,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+	&pypff_attachment_buffer_procedures,
+        /* tp_flags */
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_NEWBUFFER,
+	/* tp_doc */
+	"pypff attachment object (wraps attachment type libpff_item_t)",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	0,
+	/* tp_iternext */
+	0,
+	/* tp_methods */
+	pypff_attachment_object_methods,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	pypff_attachment_object_get_set_definitions,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pypff_attachment_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0
+};
+
+/* Creates a new attachment object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pypff_attachment_new(
+           PyObject *self )
+{
+	pypff_attachment_t *pypff_attachment = NULL;
+	static char *function                = "pypff_attachment_new";
+
+	pypff_attachment = PyObject_New(
+	                    struct pypff_attachment,
+	                    &pypff_attachment_type_object );
+
+	if( pypff_attachment == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to initialize attachment.",
+		 function );
+
+		return( NULL );
+	}
+	if( pypff_attachment_init(
+	     pypff_attachment ) != 0 )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to initialize attachment.",
+		 function );
+
+		goto on_error;
+	}
+	return( (PyObject *) pypff_attachment );
+
+on_error:
+	if( pypff_attachment != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pypff_attachment );
+	}
+	return( NULL );
+}
+
+/* Intializes an attachment object
+ * Returns 0 if successful or -1 on error
+ */
+int pypff_attachment_init(
+     pypff_attachment_t *pypff_attachment )
+{
+	static char *function = "pypff_attachment_init";
+
+	if( pypff_attachment == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid attachment.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure libpff item is set to NULL
+	 */
+	pypff_attachment->item        = NULL;
+	pypff_attachment->file_object = NULL;
+	pypff_attachment->data        = NULL;
+	pypff_attachment->data_size   = 0;
+
+	return( 0 );
+}
+
+/* Frees an attachment object
+ */
+void pypff_attachment_free(
+      pypff_attachment_t *pypff_attachment )
+{
+	char error_string[ PYPFF_ERROR_STRING_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	static char *function   = "pypff_attachment_free";
+	int result               = 0;
+
+	if( pypff_attachment == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid attachment.",
+		 function );
+
+		return;
+	}
+	if( pypff_attachment->ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid attachment - missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( pypff_attachment->ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid attachment - invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+	if( pypff_attachment->item == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid attachment - missing libpff attachment.",
+		 function );
+
+		return;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_attachment->file_object );
+
+	result = libpff_item_free(
+	          &( pypff_attachment->item ),
+	          &error );
+
+	pypff_file_release_lock(
+	 pypff_attachment->file_object );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		if( libcerror_error_backtrace_sprint(
+		     error,
+		     error_string,
+		     PYPFF_ERROR_STRING_SIZE ) == -1 )
+                {
+			PyErr_Format(
+			 PyExc_IOError,
+			 "%s: unable to free libpff item.",
+			 function );
+		}
+		else
+                {
+			PyErr_Format(
+			 PyExc_IOError,
+			 "%s: unable to free libpff item.\n%s",
+			 function,
+			 error_string );
+		}
+		libcerror_error_free(
+		 &error );
+	}
+	if( pypff_attachment->data != NULL )
+	{
+		PyMem_Free(
+		 pypff_attachment->data );
+	}
+	if( pypff_attachment->file_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pypff_attachment->file_object );
+	}
+	pypff_attachment->ob_type->tp_free(
+	 (PyObject*) pypff_attachment );
+}
+
+/* Retrieves the attachment type
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pypff_attachment_get_type(
+           pypff_attachment_t *pypff_attachment )
+{
+	char error_string[ PYPFF_ERROR_STRING_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	static char *function   = "pypff_attachment_get_type";
+	int attachment_type     = 0;
+	int result              = 0;
+
+	if( pypff_attachment == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid attachment.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_attachment->file_object );
+
+	result = libpff_attachment_get_type(
+	          pypff_attachment->item,
+	          &attachment_type,
+	          &error );
+
+	pypff_file_release_lock(
+	 pypff_attachment->file_object );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		if( libcerror_error_backtrace_sprint(
+		     error,
+		     error_string,
+		     PYPFF_ERROR_STRING_SIZE ) == -1 )
+                {
+			PyErr_Format(
+			 PyExc_IOError,
+			 "%s: unable to retrieve attachment type.",
+			 function );
+		}
+		else
+		{
+			PyErr_Format(
+			 PyExc_IOError,
+			 "%s: unable to retrieve attachment type.\n%s",
+			 function,
+			 error_string );
+		}
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( PyInt_FromLong(
+	         (long) attachment_type ) );
+}
+
+/* Retrieves the long filename
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pypff_attachment_get_long_filename(
+           pypff_attachment_t *pypff_attachment )
+{
+	char error_string[ PYPFF_ERROR_STRING_SIZE ];
+
+	pypff_value_t value;
+
+	libcerror_error_t *error = NULL;
+	PyObject *string_object = NULL;
+	static char *function   = "pypff_attachment_get_long_filename";
+	int result              = 0;
+
+	if( pypff_attachment == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid attachment.",
+		 function );
+
+		return( NULL );
+	}
+	if( memory_set(
+	     &value,
+	     0,
+	     sizeof( pypff_value_t ) ) == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to clear value.",
+		 function );
+
+		return( NULL );
+	}
+	value.entry_type = LIBPFF_ENTRY_TYPE_ATTACHMENT_FILENAME_LONG;
+
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_attachment->file_object );
+
+	result = pypff_value_copy_from_item(
+	          &value,
+	          pypff_attachment->item,
+	          &error );
+
+	pypff_file_release_lock(
+	 pypff_attachment->file_object );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		if( libcerror_error_backtrace_sprint(
+		     error,
+		     error_string,
+		     PYPFF_ERROR_STRING_SIZE ) == -1 )
+                {
+			PyErr_Format(
+			 PyExc_IOError,
+			 "%s: unable to retrieve long filename.",
+			 function );
+		}
+		else
+		{
+			PyErr_Format(
+			 PyExc_IOError,
+			 "%s: unable to retrieve long filename.\n%s",
+			 function,
+			 error_string );
+		}
+		libcerror_error_free(
+		 &error );
+	}
+	else
+	{
+		string_object = pypff_value_get_object(
+		                 &value );
+	}
+	if( value.data != NULL )
+	{
+		memory_free(
+		 value.data );
+	}
+	return( string_object );
+}
+
+/* Retrieves the size of the data
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pypff_attachment_get_size(
+           pypff_attachment_t *pypff_attachment )
+{
+	char error_string[ PYPFF_ERROR_STRING_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	static char *function   = "pypff_attachment_get_size";
+	size64_t data_size      = 0;
+	int result              = 0;
+
+	if( pypff_attachment == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid attachment.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_attachment->file_object );
+
+	result = libpff_attachment_get_data_size(
+	          pypff_attachment->item,
+	          &data_size,
+	          &error );
+
+	pypff_file_release_lock(
+	 pypff_attachment->file_object );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		if( libcerror_error_backtrace_sprint(
+		     error,
+		     error_string,
+		     PYPFF_ERROR_STRING_SIZE ) == -1 )
+                {
+			PyErr_Format(
+			 PyExc_IOError,
+			 "%s: unable to retrieve data size.",
+			 function );
+		}
+		else
+		{
+			PyErr_Format(
+			 PyExc_IOError,
+			 "%s: unable to retrieve data size.\n%s",
+			 function,
+			 error_string );
+		}
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( PyLong_FromUnsignedLongLong(
+	         (unsigned PY_LONG_LONG) data_size ) );
+}
+
+/* Reads a buffer of data from the current offset
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pypff_attachment_read_buffer(
+           pypff_attachment_t *pypff_attachment,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	char error_string[ PYPFF_ERROR_STRING_SIZE ];
+
+	libcerror_error_t *error    = NULL;
+	PyObject *string_object     = NULL;
+	static char *keyword_list[] = { "size", NULL };
+	static char *function       = "pypff_attachment_read_buffer";
+	size64_t data_size          = 0;
+	off64_t current_offset      = 0;
+	ssize_t read_count          = 0;
+	int read_size               = -1;
+	int result                  = 0;
+
+	if( pypff_attachment == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid attachment.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "|i",
+	     keyword_list,
+	     &read_size ) == 0 )
+	{
+		return( NULL );
+	}
+	if( read_size < 0 )
+	{
+		/* Determine the size of the remainder of the data
+		 */
+		Py_BEGIN_ALLOW_THREADS
+
+		pypff_file_acquire_lock(
+		 pypff_attachment->file_object );
+
+		result = libpff_attachment_get_data_size(
+		          pypff_attachment->item,
+		          &data_size,
+		          &error );
+
+		if( result == 1 )
+		{
+			current_offset = libpff_attachment_data_seek_offset(
+			                  pypff_attachment->item,
+			                  0,
+			                  SEEK_CUR,
+			                  &error );
+
+			if( current_offset < 0 )
+			{
+				result = -1;
+			}
+		}
+		pypff_file_release_lock(
+		 pypff_attachment->file_object );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			if( libcerror_error_backtrace_sprint(
+			     error,
+			     error_string,
+			     PYPFF_ERROR_STRING_SIZE ) == -1 )
+			{
+				PyErr_Format(
+				 PyExc_IOError,
+				 "%s: unable to determine remaining data size.",
+				 function );
+			}
+			else
+			{
+				PyErr_Format(
+				 PyExc_IOError,
+				 "%s: unable to determine remaining data size.\n%s",
+				 function,
+				 error_string );
+			}
+			libcerror_error_free(
+			 &error );
+
+			return( NULL );
+		}
+		if( (size64_t) current_offset >= data_size )
+		{
+			read_size = 0;
+		}
+		else if( ( data_size - (size64_t) current_offset ) > (size64_t) INT_MAX )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: remaining data size value exceeds maximum.",
+			 function );
+
+			return( NULL );
+		}
+		else
+		{
+			read_size = (int) ( data_size - (size64_t) current_offset );
+		}
+	}
+	/* Read the data directly into the string object
+	 * the string is not shared yet hence the GIL can be released
+	 */
+	string_object = PyString_FromStringAndSize(
+	                 NULL,
+	                 (Py_ssize_t) read_size );
+
+	if( string_object == NULL )
+	{
+		return( NULL );
+	}
+	if( read_size == 0 )
+	{
+		return( string_object );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_attachment->file_object );
+
+	read_count = libpff_attachment_data_read_buffer(
+	              pypff_attachment->item,
+	              (uint8_t *) PyString_AS_STRING( string_object ),
+	              (size_t) read_size,
+	              &error );
+
+	pypff_file_release_lock(
+	 pypff_attachment->file_object );
+
+	Py_END_ALLOW_THREADS
+
+	if( read_count <= -1 )
+	{
+		if( libcerror_error_backtrace_sprint(
+		     error,
+		     error_string,
+		     PYPFF_ERROR_STRING_SIZE ) == -1 )
+                {
+			PyErr_Format(
+			 PyExc_IOError,
+			 "%s: unable to read data.",
+			 function );
+		}
+		else
+		{
+			PyErr_Format(
+			 PyExc_IOError,
+			 "%s: unable to read data.\n%s",
+			 function,
+			 error_string );
+		}
+		libcerror_error_free(
+		 &error );
+
+		Py_DecRef(
+		 string_object );
+
+		return( NULL );
+	}
+	/* Shrink the string object if less data was read than requested
+	 */
+	if( read_count != (ssize_t) read_size )
+	{
+		if( _PyString_Resize(
+		     &string_object,
+		     (Py_ssize_t) read_count ) != 0 )
+		{
+			return( NULL );
+		}
+	}
+	return( string_object );
+}
+
+/* Reads data from the current offset into a writable buffer object
+ * The data is read directly into the memory of the buffer object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pypff_attachment_read_into_buffer(
+           pypff_attachment_t *pypff_attachment,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	char error_string[ PYPFF_ERROR_STRING_SIZE ];
+
+	Py_buffer buffer;
+
+	libcerror_error_t *error    = NULL;
+	static char *keyword_list[] = { "buffer", NULL };
+	static char *function       = "pypff_attachment_read_into_buffer";
+	ssize_t read_count          = 0;
+
+	if( pypff_attachment == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid attachment.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "w*",
+	     keyword_list,
+	     &buffer ) == 0 )
+	{
+		return( NULL );
+	}
+	if( buffer.len > 0 )
+	{
+		/* The buffer object is locked by the Py_buffer
+		 * hence the GIL can be released
+		 */
+		Py_BEGIN_ALLOW_THREADS
+
+		pypff_file_acquire_lock(
+		 pypff_attachment->file_object );
+
+		read_count = libpff_attachment_data_read_buffer(
+		              pypff_attachment->item,
+		              (uint8_t *) buffer.buf,
+		              (size_t) buffer.len,
+		              &error );
+
+		pypff_file_release_lock(
+		 pypff_attachment->file_object );
+
+		Py_END_ALLOW_THREADS
+	}
+	PyBuffer_Release(
+	 &buffer );
+
+	if( read_count <= -1 )
+	{
+		if( libcerror_error_backtrace_sprint(
+		     error,
+		     error_string,
+		     PYPFF_ERROR_STRING_SIZE ) == -1 )
+                {
+			PyErr_Format(
+			 PyExc_IOError,
+			 "%s: unable to read data.",
+			 function );
+		}
+		else
+		{
+			PyErr_Format(
+			 PyExc_IOError,
+			 "%s: unable to read data.\n%s",
+			 function,
+			 error_string );
+		}
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( PyInt_FromSsize_t(
+	         (Py_ssize_t) read_count ) );
+}
+
+/* Seeks an offset within the data
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pypff_attachment_seek_offset(
+           pypff_attachment_t *pypff_attachment,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	char error_string[ PYPFF_ERROR_STRING_SIZE ];
+
+	libcerror_error_t *error    = NULL;
+	static char *keyword_list[] = { "offset", "whence", NULL };
+	static char *function       = "pypff_attachment_seek_offset";
+	PY_LONG_LONG offset         = 0;
+	int whence                  = SEEK_SET;
+
+	if( pypff_attachment == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid attachment.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "L|i",
+	     keyword_list,
+	     &offset,
+	     &whence ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_attachment->file_object );
+
+	offset = (PY_LONG_LONG) libpff_attachment_data_seek_offset(
+	                         pypff_attachment->item,
+	                         (off64_t) offset,
+	                         whence,
+	                         &error );
+
+	pypff_file_release_lock(
+	 pypff_attachment->file_object );
+
+	Py_END_ALLOW_THREADS
+
+	if( offset < 0 )
+	{
+		if( libcerror_error_backtrace_sprint(
+		     error,
+		     error_string,
+		     PYPFF_ERROR_STRING_SIZE ) == -1 )
+                {
+			PyErr_Format(
+			 PyExc_IOError,
+			 "%s: unable to seek offset.",
+			 function );
+		}
+		else
+		{
+			PyErr_Format(
+			 PyExc_IOError,
+			 "%s: unable to seek offset.\n%s",
+			 function,
+			 error_string );
+		}
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Retrieves the current offset within the data
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pypff_attachment_get_offset(
+           pypff_attachment_t *pypff_attachment )
+{
+	char error_string[ PYPFF_ERROR_STRING_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	static char *function   = "pypff_attachment_get_offset";
+	off64_t current_offset  = 0;
+
+	if( pypff_attachment == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid attachment.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_attachment->file_object );
+
+	current_offset = libpff_attachment_data_seek_offset(
+	                  pypff_attachment->item,
+	                  0,
+	                  SEEK_CUR,
+	                  &error );
+
+	pypff_file_release_lock(
+	 pypff_attachment->file_object );
+
+	Py_END_ALLOW_THREADS
+
+	if( current_offset < 0 )
+	{
+		if( libcerror_error_backtrace_sprint(
+		     error,
+		     error_string,
+		     PYPFF_ERROR_STRING_SIZE ) == -1 )
+                {
+			PyErr_Format(
+			 PyExc_IOError,
+			 "%s: unable to retrieve current offset.",
+			 function );
+		}
+		else
+		{
+			PyErr_Format(
+			 PyExc_IOError,
+			 "%s: unable to retrieve current offset.\n%s",
+			 function,
+			 error_string );
+		}
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( PyLong_FromLongLong(
+	         (PY_LONG_LONG) current_offset ) );
+}
+
+/* Reads all the data for the buffer interface
+ * The data is only read once and the current offset is not changed
+ * Returns 0 if successful or -1 on error
+ */
+int pypff_attachment_read_data(
+     pypff_attachment_t *pypff_attachment )
+{
+	char error_string[ PYPFF_ERROR_STRING_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	uint8_t *data           = NULL;
+	static char *function   = "pypff_attachment_read_data";
+	size64_t data_size      = 0;
+	off64_t current_offset  = 0;
+	ssize_t read_count      = 0;
+	int result              = 0;
+
+	if( pypff_attachment == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid attachment.",
+		 function );
+
+		return( -1 );
+	}
+	if( pypff_attachment->data != NULL )
+	{
+		return( 0 );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_attachment->file_object );
+
+	result = libpff_attachment_get_data_size(
+	          pypff_attachment->item,
+	          &data_size,
+	          &error );
+
+	pypff_file_release_lock(
+	 pypff_attachment->file_object );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		goto on_error;
+	}
+	if( data_size > (size64_t) SSIZE_MAX )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Allocate at least 1 byte to mark the data as read
+	 */
+	data = (uint8_t *) PyMem_Malloc(
+	                    (size_t) data_size + 1 );
+
+	if( data == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > 0 )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		pypff_file_acquire_lock(
+		 pypff_attachment->file_object );
+
+		current_offset = libpff_attachment_data_seek_offset(
+		                  pypff_attachment->item,
+		                  0,
+		                  SEEK_CUR,
+		                  &error );
+
+		if( current_offset >= 0 )
+		{
+			if( libpff_attachment_data_seek_offset(
+			     pypff_attachment->item,
+			     0,
+			     SEEK_SET,
+			     &error ) == 0 )
+			{
+				read_count = libpff_attachment_data_read_buffer(
+				              pypff_attachment->item,
+				              data,
+				              (size_t) data_size,
+				              &error );
+
+				if( libpff_attachment_data_seek_offset(
+				     pypff_attachment->item,
+				     current_offset,
+				     SEEK_SET,
+				     ( read_count == (ssize_t) data_size ) ? &error : NULL ) == -1 )
+				{
+					read_count = -1;
+				}
+			}
+		}
+		pypff_file_release_lock(
+		 pypff_attachment->file_object );
+
+		Py_END_ALLOW_THREADS
+
+		if( read_count != (ssize_t) data_size )
+		{
+			goto on_error;
+		}
+	}
+	pypff_attachment->data      = data;
+	pypff_attachment->data_size = (size_t) data_size;
+
+	return( 0 );
+
+on_error:
+	if( libcerror_error_backtrace_sprint(
+	     error,
+	     error_string,
+	     PYPFF_ERROR_STRING_SIZE ) == -1 )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+	}
+	else
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: unable to read data.\n%s",
+		 function,
+		 error_string );
+	}
+	libcerror_error_free(
+	 &error );
+
+	if( data != NULL )
+	{
+		PyMem_Free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Retrieves a segment of the data for the (old) buffer interface
+ * Returns the size of the segment or -1 on error
+ */
+Py_ssize_t pypff_attachment_buffer_get_segment(
+            pypff_attachment_t *pypff_attachment,
+            Py_ssize_t segment_index,
+            void **segment_data )
+{
+	static char *function = "pypff_attachment_buffer_get_segment";
+
+	if( segment_index != 0 )
+	{
+		PyErr_Format(
+		 PyExc_SystemError,
+		 "%s: invalid segment index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( pypff_attachment_read_data(
+	     pypff_attachment ) != 0 )
+	{
+		return( -1 );
+	}
+	*segment_data = (void *) pypff_attachment->data;
+
+	return( (Py_ssize_t) pypff_attachment->data_size );
+}
+
+/* Retrieves the number of segments of the data for the (old) buffer interface
+ * The data is contained in a single segment
+ * Returns the number of segments
+ */
+Py_ssize_t pypff_attachment_buffer_get_number_of_segments(
+            pypff_attachment_t *pypff_attachment,
+            Py_ssize_t *data_size )
+{
+	if( data_size != NULL )
+	{
+		if( pypff_attachment_read_data(
+		     pypff_attachment ) != 0 )
+		{
+			/* The interface does not allow to return an error
+			 * the error is raised by the subsequent request of the segment
+			 */
+			PyErr_Clear();
+
+			*data_size = 0;
+		}
+		else
+		{
+			*data_size = (Py_ssize_t) pypff_attachment->data_size;
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves a read-only buffer of the data for the (new) buffer interface
+ * Returns 0 if successful or -1 on error
+ */
+int pypff_attachment_buffer_get_buffer(
+     pypff_attachment_t *pypff_attachment,
+     Py_buffer *buffer,
+     int flags )
+{
+	if( pypff_attachment_read_data(
+	     pypff_attachment ) != 0 )
+	{
+		return( -1 );
+	}
+	return( PyBuffer_FillInfo(
+	         buffer,
+	         (PyObject *) pypff_attachment,
+	         (void *) pypff_attachment->data,
+	         (Py_ssize_t) pypff_attachment->data_size,
+	         1,
+	         flags ) );
+}
+
@@ -0,0 +1,126 @@
+/*
+ * Python object definition of the attachment type libpff item
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYPFF_ATTACHMENT_H )
+#define _PYPFF_ATTACHMENT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pypff_file.h"
+#include "pypff_libcerror.h"
+#include "pypff_libpff.h"
+#include "pypff_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct pypff_attachment pypff_attachment_t;
+
+struct pypff_attachment
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The attachment type libpff item
+	 */
+	libpff_item_t *item;
+
+	/* The file object the item belongs to
+	 */
+	pypff_file_t *file_object;
+
+	/* The attachment data exposed by the buffer interface
+	 * the data is read on the first request of a buffer
+	 */
+	uint8_t *data;
+
+	/* The attachment data size
+	 */
+	size_t data_size;
+};
+
+extern PyMethodDef pypff_attachment_object_methods[];
+extern PyGetSetDef pypff_attachment_object_get_set_definitions[];
+extern PyBufferProcs pypff_attachment_buffer_procedures;
+extern PyTypeObject pypff_attachment_type_object;
+
+PyObject *pypff_attachment_new(
+           PyObject *self );
+
+int pypff_attachment_init(
+     pypff_attachment_t *pypff_attachment );
+
+void pypff_attachment_free(
+      pypff_attachment_t *pypff_attachment );
+
+PyObject *pypff_attachment_get_type(
+           pypff_attachment_t *pypff_attachment );
+
+PyObject *pypff_attachment_get_long_filename(
+           pypff_attachment_t *pypff_attachment );
+
+PyObject *pypff_attachment_get_size(
+           pypff_attachment_t *pypff_attachment );
+
+PyObject *pypff_attachment_read_buffer(
+           pypff_attachment_t *pypff_attachment,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pypff_attachment_read_into_buffer(
+           pypff_attachment_t *pypff_attachment,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pypff_attachment_seek_offset(
+           pypff_attachment_t *pypff_attachment,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pypff_attachment_get_offset(
+           pypff_attachment_t *pypff_attachment );
+
+int pypff_attachment_read_data(
+     pypff_attachment_t *pypff_attachment );
+
+Py_ssize_t pypff_attachment_buffer_get_segment(
+            pypff_attachment_t *pypff_attachment,
+            Py_ssize_t segment_index,
+            void **segment_data );
+
+Py_ssize_t pypff_attachment_buffer_get_number_of_segments(
+            pypff_attachment_t *pypff_attachment,
+            Py_ssize_t *data_size );
+
+int pypff_attachment_buffer_get_buffer(
+     pypff_attachment_t *pypff_attachment,
+     Py_buffer *buffer,
+     int flags );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -320,6 +320,7 @@ int pypff_file_init(
 	/* Make sure libpff file is set to NULL
 	 */
 	pypff_file->file = NULL;
+	pypff_file->lock = NULL;
 
 	if( libpff_file_initialize(
 	     &( pypff_file->file ),
@@ -348,6 +349,21 @@ int pypff_file_init(
 
 		return( -1 );
 	}
+	pypff_file->lock = PyThread_allocate_lock();
+
+	if( pypff_file->lock == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create lock.",
+		 function );
+
+		libpff_file_free(
+		 &( pypff_file->file ),
+		 NULL );
+
+		return( -1 );
+	}
 	return( 0 );
 }
 
@@ -360,6 +376,7 @@ void pypff_file_free(
 
 	libcerror_error_t *error = NULL;
 	static char *function   = "pypff_file_free";
+	int result               = 0;
 
 	if( pypff_file == NULL )
 	{
@@ -397,9 +414,15 @@ void pypff_file_free(
 
 		return;
 	}
-	if( libpff_file_free(
-	     &( pypff_file->file ),
-	     &error ) != 1 )
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libpff_file_free(
+	          &( pypff_file->file ),
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
 	{
 		if( libcerror_error_backtrace_sprint(
 		     error,
@@ -422,10 +445,47 @@ void pypff_file_free(
 		libcerror_error_free(
 		 &error );
 	}
+	if( pypff_file->lock != NULL )
+	{
+		PyThread_free_lock(
+		 pypff_file->lock );
+
+		pypff_file->lock = NULL;
+	}
 	pypff_file->ob_type->tp_free(
 	 (PyObject*) pypff_file );
 }
 
+/* Acquires the lock of the file
+ * The GIL must be released before calling this function,
+ * otherwise a thread waiting for the GIL while holding the lock
+ * can dead lock
+ */
+void pypff_file_acquire_lock(
+      pypff_file_t *pypff_file )
+{
+	if( ( pypff_file != NULL )
+	 && ( pypff_file->lock != NULL ) )
+	{
+		PyThread_acquire_lock(
+		 pypff_file->lock,
+		 WAIT_LOCK );
+	}
+}
+
+/* Releases the lock of the file
+ */
+void pypff_file_release_lock(
+      pypff_file_t *pypff_file )
+{
+	if( ( pypff_file != NULL )
+	 && ( pypff_file->lock != NULL ) )
+	{
+		PyThread_release_lock(
+		 pypff_file->lock );
+	}
+}
+
 /* Signals the file to abort the current activity
  * Returns a Python object if successful or NULL on error
  */
@@ -436,6 +496,7 @@ PyObject *pypff_file_signal_abort(
 
 	libcerror_error_t *error = NULL;
 	static char *function   = "pypff_file_signal_abort";
+	int result               = 0;
 
 	if( pypff_file == NULL )
 	{
@@ -446,9 +507,18 @@ PyObject *pypff_file_signal_abort(
 
 		return( NULL );
 	}
-	if( libpff_file_signal_abort(
-	     pypff_file->file,
-	     &error ) != 1 )
+	/* The lock is not acquired so that the abort can be signalled
+	 * while another thread is using the file
+	 */
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libpff_file_signal_abort(
+	          pypff_file->file,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
 	{
 		if( libcerror_error_backtrace_sprint(
 		     error,
@@ -494,6 +564,7 @@ PyObject *pypff_file_open(
 	static char *keyword_list[] = { "filename", "access_flags", NULL };
 	static char *function       = "pypff_file_open";
 	int access_flags            = 0;
+	int result                  = 0;
 
 	if( pypff_file == NULL )
 	{
@@ -514,11 +585,29 @@ PyObject *pypff_file_open(
         {
                 return( NULL );
         }
-	if( libpff_file_open(
-	     pypff_file->file,
-             filename,
-             (uint8_t) access_flags,
-	     &error ) != 1 )
+	/* Default to read-only if no access flags were provided
+	 */
+	if( access_flags == 0 )
+	{
+		access_flags = libpff_get_access_flags_read();
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_file );
+
+	result = libpff_file_open(
+	          pypff_file->file,
+	          filename,
+	          (uint8_t) access_flags,
+	          &error );
+
+	pypff_file_release_lock(
+	 pypff_file );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
 	{
 		if( libcerror_error_backtrace_sprint(
 		     error,
@@ -622,12 +711,18 @@ PyObject *pypff_file_open_file_object(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
+	pypff_file_acquire_lock(
+	 pypff_file );
+
 	result = libpff_file_open_file_io_handle(
 	          pypff_file->file,
                   file_io_handle,
                   access_flags,
 	          &error );
 
+	pypff_file_release_lock(
+	 pypff_file );
+
 	Py_END_ALLOW_THREADS
 
 	if( result != 1 )
@@ -680,6 +775,7 @@ PyObject *pypff_file_close(
 
 	libcerror_error_t *error = NULL;
 	static char *function   = "pypff_file_close";
+	int result               = 0;
 
 	if( pypff_file == NULL )
 	{
@@ -690,9 +786,21 @@ PyObject *pypff_file_close(
 
 		return( NULL );
 	}
-	if( libpff_file_close(
-	     pypff_file->file,
-	     &error ) != 0 )
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_file );
+
+	result = libpff_file_close(
+	          pypff_file->file,
+	          &error );
+
+	pypff_file_release_lock(
+	 pypff_file );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 0 )
 	{
 		if( libcerror_error_backtrace_sprint(
 		     error,
@@ -736,6 +844,7 @@ PyObject *pypff_file_get_ascii_codepage(
 	const char *codepage_string = NULL;
 	static char *function       = "pypff_file_get_ascii_codepage";
 	int ascii_codepage          = 0;
+	int result                  = 0;
 
 	if( pypff_file == NULL )
 	{
@@ -746,10 +855,22 @@ PyObject *pypff_file_get_ascii_codepage(
 
 		return( NULL );
 	}
-	if( libpff_file_get_ascii_codepage(
-	     pypff_file->file,
-	     &ascii_codepage,
-	     &error ) != 1 )
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_file );
+
+	result = libpff_file_get_ascii_codepage(
+	          pypff_file->file,
+	          &ascii_codepage,
+	          &error );
+
+	pypff_file_release_lock(
+	 pypff_file );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
 	{
 		if( libcerror_error_backtrace_sprint(
 		     error,
@@ -819,6 +940,7 @@ PyObject *pypff_file_set_ascii_codepage(
 	size_t codepage_string_length = 0;
 	uint32_t feature_flags        = 0;
 	int ascii_codepage            = 0;
+	int result                    = 0;
 
 	if( pypff_file == NULL )
 	{
@@ -883,10 +1005,22 @@ PyObject *pypff_file_set_ascii_codepage(
 
 		return( NULL );
 	}
-	if( libpff_file_set_ascii_codepage(
-	     pypff_file->file,
-	     ascii_codepage,
-	     &error ) != 1 )
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_file );
+
+	result = libpff_file_set_ascii_codepage(
+	          pypff_file->file,
+	          ascii_codepage,
+	          &error );
+
+	pypff_file_release_lock(
+	 pypff_file );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
 	{
 		if( libcerror_error_backtrace_sprint(
 		     error,
@@ -927,6 +1061,7 @@ PyObject *pypff_file_recover_items(
 
 	libcerror_error_t *error = NULL;
 	static char *function   = "pypff_file_recover_items";
+	int result               = 0;
 
 	if( pypff_file == NULL )
 	{
@@ -937,10 +1072,22 @@ PyObject *pypff_file_recover_items(
 
 		return( NULL );
 	}
-	if( libpff_file_recover_items(
-	     pypff_file->file,
-	     0,
-	     &error ) != 1 )
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_file );
+
+	result = libpff_file_recover_items(
+	          pypff_file->file,
+	          0,
+	          &error );
+
+	pypff_file_release_lock(
+	 pypff_file );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
 	{
 		if( libcerror_error_backtrace_sprint(
 		     error,
@@ -983,6 +1130,7 @@ PyObject *pypff_file_get_root_folder(
 	libpff_item_t *root_folder = NULL;
 	PyObject *folder_object    = NULL;
 	static char *function      = "pypff_file_get_root_folder";
+	int result                 = 0;
 
 	if( pypff_file == NULL )
 	{
@@ -993,10 +1141,22 @@ PyObject *pypff_file_get_root_folder(
 
 		return( NULL );
 	}
-	if( libpff_file_get_root_folder(
-	     pypff_file->file,
-	     &root_folder,
-	     &error ) != 1 )
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_file );
+
+	result = libpff_file_get_root_folder(
+	          pypff_file->file,
+	          &root_folder,
+	          &error );
+
+	pypff_file_release_lock(
+	 pypff_file );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
 	{
 		if( libcerror_error_backtrace_sprint(
 		     error,
@@ -1033,16 +1193,30 @@ PyObject *pypff_file_get_root_folder(
 
 		goto on_error;
 	}
-	( (pypff_folder_t *) folder_object )->item = root_folder;
+	( (pypff_folder_t *) folder_object )->item        = root_folder;
+	( (pypff_folder_t *) folder_object )->file_object = pypff_file;
+
+	Py_IncRef(
+	 (PyObject *) pypff_file );
 
 	return( folder_object );
 
 on_error:
 	if( root_folder != NULL )
 	{
+		Py_BEGIN_ALLOW_THREADS
+
+		pypff_file_acquire_lock(
+		 pypff_file );
+
 		libpff_item_free(
 		 &root_folder,
 		 NULL );
+
+		pypff_file_release_lock(
+		 pypff_file );
+
+		Py_END_ALLOW_THREADS
 	}
 	return( NULL );
 }
@@ -1058,6 +1232,7 @@ PyObject *pypff_file_get_number_of_recovered_items(
 	libcerror_error_t *error = NULL;
 	static char *function   = "pypff_file_get_number_of_recovered_items";
 	int number_of_items     = 0;
+	int result              = 0;
 
 	if( pypff_file == NULL )
 	{
@@ -1068,10 +1243,22 @@ PyObject *pypff_file_get_number_of_recovered_items(
 
 		return( NULL );
 	}
-	if( libpff_file_get_number_of_recovered_items(
-	     pypff_file->file,
-	     &number_of_items,
-	     &error ) != 1 )
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_file );
+
+	result = libpff_file_get_number_of_recovered_items(
+	          pypff_file->file,
+	          &number_of_items,
+	          &error );
+
+	pypff_file_release_lock(
+	 pypff_file );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
 	{
 		if( libcerror_error_backtrace_sprint(
 		     error,
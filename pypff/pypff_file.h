@@ -44,6 +44,11 @@ struct pypff_file
 	/* The libpff file
 	 */
 	libpff_file_t *file;
+
+	/* The lock that serializes access to the libpff file
+	 * libpff is not thread-safe and the items of a file share its state
+	 */
+	PyThread_type_lock lock;
 };
 
 extern PyMethodDef pypff_file_object_methods[];
@@ -63,6 +68,12 @@ int pypff_file_init(
 void pypff_file_free(
       pypff_file_t *pypff_file );
 
+void pypff_file_acquire_lock(
+      pypff_file_t *pypff_file );
+
+void pypff_file_release_lock(
+      pypff_file_t *pypff_file );
+
 PyObject *pypff_file_signal_abort(
            pypff_file_t *pypff_file );
 
@@ -29,11 +29,13 @@
 
 #include "pypff.h"
 #include "pypff_folder.h"
+#include "pypff_items.h"
 #include "pypff_libcerror.h"
 #include "pypff_libcstring.h"
 #include "pypff_libpff.h"
 #include "pypff_message.h"
 #include "pypff_python.h"
+#include "pypff_value.h"
 
 PyMethodDef pypff_folder_object_methods[] = {
 
@@ -61,6 +63,11 @@ PyMethodDef pypff_folder_object_methods[] = {
 	  METH_VARARGS | METH_KEYWORDS,
 	  "Retrieves a specific sub folder" },
 
+	{ "get_sub_folders",
+	  (PyCFunction) pypff_folder_get_sub_folders,
+	  METH_NOARGS,
+	  "Retrieves a sequence and iterator of the sub folders" },
+
 	/* Functions to access the sub messages */
 
 	{ "get_number_of_sub_messages",
@@ -73,10 +80,53 @@ PyMethodDef pypff_folder_object_methods[] = {
 	  METH_VARARGS | METH_KEYWORDS,
 	  "Retrieves a specific sub message" },
 
+	{ "get_sub_messages",
+	  (PyCFunction) pypff_folder_get_sub_messages,
+	  METH_NOARGS,
+	  "Retrieves a sequence and iterator of the sub messages" },
+
+	{ "get_sub_messages_values",
+	  (PyCFunction) pypff_folder_get_sub_messages_values,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "Retrieves the values of specific entry types of all the sub messages\n"
+	  "\n"
+	  "Returns a list per entry type containing the value of every sub message\n"
+	  "or None if the sub message does not contain the value" },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
 
+PyGetSetDef pypff_folder_object_get_set_definitions[] = {
+
+	{ "number_of_sub_folders",
+	  (getter) pypff_folder_get_number_of_sub_folders,
+	  (setter) 0,
+	  "The number of sub folders",
+	  NULL },
+
+	{ "sub_folders",
+	  (getter) pypff_folder_get_sub_folders,
+	  (setter) 0,
+	  "The sub folders",
+	  NULL },
+
+	{ "number_of_sub_messages",
+	  (getter) pypff_folder_get_number_of_sub_messages,
+	  (setter) 0,
+	  "The number of sub messages",
+	  NULL },
+
+	{ "sub_messages",
+	  (getter) pypff_folder_get_sub_messages,
+	  (setter) 0,
+	  "The sub messages",
+	  NULL },
+
+	/* Sentinel */
+	{ NULL, NULL, NULL, NULL, NULL }
+};
+
 PyTypeObject pypff_folder_type_object = {
 	PyObject_HEAD_INIT( NULL )
 
@@ -139,7 +189,7 @@ PyTypeObject pypff_folder_type_object = {
 	/* tp_members */
 	0,
 	/* tp_getset */
-	0,
+	pypff_folder_object_get_set_definitions,
 	/* tp_base */
 	0,
 	/* tp_dict */
@@ -236,7 +286,8 @@ int pypff_folder_init(
 	}
 	/* Make sure libpff item is set to NULL
 	 */
-	pypff_folder->item = NULL;
+	pypff_folder->item        = NULL;
+	pypff_folder->file_object = NULL;
 
 	return( 0 );
 }
@@ -250,6 +301,7 @@ void pypff_folder_free(
 
 	libcerror_error_t *error = NULL;
 	static char *function   = "pypff_folder_free";
+	int result               = 0;
 
 	if( pypff_folder == NULL )
 	{
@@ -287,9 +339,21 @@ void pypff_folder_free(
 
 		return;
 	}
-	if( libpff_item_free(
-	     &( pypff_folder->item ),
-	     &error ) != 1 )
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_folder->file_object );
+
+	result = libpff_item_free(
+	          &( pypff_folder->item ),
+	          &error );
+
+	pypff_file_release_lock(
+	 pypff_folder->file_object );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
 	{
 		if( libcerror_error_backtrace_sprint(
 		     error,
@@ -312,6 +376,11 @@ void pypff_folder_free(
 		libcerror_error_free(
 		 &error );
 	}
+	if( pypff_folder->file_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pypff_folder->file_object );
+	}
 	pypff_folder->ob_type->tp_free(
 	 (PyObject*) pypff_folder );
 }
@@ -341,6 +410,11 @@ PyObject *pypff_folder_get_display_name(
 
 		return( NULL );
 	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_folder->file_object );
+
 	result = libpff_item_get_entry_value_utf8_string_size(
 	          pypff_folder->item,
 	          0,
@@ -349,6 +423,11 @@ PyObject *pypff_folder_get_display_name(
 	          0,
 	          &error );
 
+	pypff_file_release_lock(
+	 pypff_folder->file_object );
+
+	Py_END_ALLOW_THREADS
+
 	if( result == -1 )
 	{
 		if( libcerror_error_backtrace_sprint(
@@ -394,6 +473,11 @@ PyObject *pypff_folder_get_display_name(
 
 		goto on_error;
 	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_folder->file_object );
+
 	result = libpff_item_get_entry_value_utf8_string(
 		  pypff_folder->item,
 		  0,
@@ -403,6 +487,11 @@ PyObject *pypff_folder_get_display_name(
 		  0,
 		  &error );
 
+	pypff_file_release_lock(
+	 pypff_folder->file_object );
+
+	Py_END_ALLOW_THREADS
+
 	if( result != 1 )
 	{
 		if( libcerror_error_backtrace_sprint(
@@ -462,6 +551,7 @@ PyObject *pypff_folder_get_number_of_sub_folders(
 	libcerror_error_t *error   = NULL;
 	static char *function     = "pypff_folder_get_number_of_sub_folders";
 	int number_of_sub_folders = 0;
+	int result                = 0;
 
 	if( pypff_folder == NULL )
 	{
@@ -472,10 +562,22 @@ PyObject *pypff_folder_get_number_of_sub_folders(
 
 		return( NULL );
 	}
-	if( libpff_folder_get_number_of_sub_folders(
-	     pypff_folder->item,
-	     &number_of_sub_folders,
-	     &error ) != 1 )
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_folder->file_object );
+
+	result = libpff_folder_get_number_of_sub_folders(
+	          pypff_folder->item,
+	          &number_of_sub_folders,
+	          &error );
+
+	pypff_file_release_lock(
+	 pypff_folder->file_object );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
 	{
 		if( libcerror_error_backtrace_sprint(
 		     error,
@@ -504,22 +606,20 @@ PyObject *pypff_folder_get_number_of_sub_folders(
 	         (long) number_of_sub_folders ) );
 }
 
-/* Retrieves a specific sub folder
+/* Retrieves a specific sub folder by index
  * Returns a Python object if successful or NULL on error
  */
-PyObject *pypff_folder_get_sub_folder(
+PyObject *pypff_folder_get_sub_folder_by_index(
            pypff_folder_t *pypff_folder,
-           PyObject *arguments,
-           PyObject *keywords )
+           int sub_folder_index )
 {
 	char error_string[ PYPFF_ERROR_STRING_SIZE ];
 
-	libcerror_error_t *error     = NULL;
-	libpff_item_t *sub_folder   = NULL;
-	PyObject *folder_object     = NULL;
-	static char *keyword_list[] = { "sub_folder_index", NULL };
-	static char *function       = "pypff_folder_get_sub_folder";
-	int sub_folder_index        = 0;
+	libcerror_error_t *error   = NULL;
+	libpff_item_t *sub_folder = NULL;
+	PyObject *folder_object   = NULL;
+	static char *function     = "pypff_folder_get_sub_folder_by_index";
+	int result                = 0;
 
 	if( pypff_folder == NULL )
 	{
@@ -530,20 +630,23 @@ PyObject *pypff_folder_get_sub_folder(
 
 		return( NULL );
 	}
-	if( PyArg_ParseTupleAndKeywords(
-	     arguments,
-	     keywords,
-	     "i",
-	     keyword_list,
-	     &sub_folder_index ) == 0 )
-        {
-		goto on_error;
-        }
-	if( libpff_folder_get_sub_folder(
-	     pypff_folder->item,
-	     sub_folder_index,
-	     &sub_folder,
-	     &error ) != 1 )
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_folder->file_object );
+
+	result = libpff_folder_get_sub_folder(
+	          pypff_folder->item,
+	          sub_folder_index,
+	          &sub_folder,
+	          &error );
+
+	pypff_file_release_lock(
+	 pypff_folder->file_object );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
 	{
 		if( libcerror_error_backtrace_sprint(
 		     error,
@@ -582,20 +685,102 @@ PyObject *pypff_folder_get_sub_folder(
 
 		goto on_error;
 	}
-	( (pypff_folder_t *) folder_object )->item = sub_folder;
+	( (pypff_folder_t *) folder_object )->item        = sub_folder;
+	( (pypff_folder_t *) folder_object )->file_object = pypff_folder->file_object;
 
+	if( pypff_folder->file_object != NULL )
+	{
+		Py_IncRef(
+		 (PyObject *) pypff_folder->file_object );
+	}
 	return( folder_object );
 
 on_error:
 	if( sub_folder != NULL )
 	{
+		Py_BEGIN_ALLOW_THREADS
+
+		pypff_file_acquire_lock(
+		 pypff_folder->file_object );
+
 		libpff_item_free(
 		 &sub_folder,
 		 NULL );
+
+		pypff_file_release_lock(
+		 pypff_folder->file_object );
+
+		Py_END_ALLOW_THREADS
 	}
 	return( NULL );
 }
 
+/* Retrieves a specific sub folder
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pypff_folder_get_sub_folder(
+           pypff_folder_t *pypff_folder,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	static char *keyword_list[] = { "sub_folder_index", NULL };
+	int sub_folder_index        = 0;
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &sub_folder_index ) == 0 )
+        {
+		return( NULL );
+        }
+	return( pypff_folder_get_sub_folder_by_index(
+	         pypff_folder,
+	         sub_folder_index ) );
+}
+
+/* Retrieves a sequence and iterator object for the sub folders
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pypff_folder_get_sub_folders(
+           pypff_folder_t *pypff_folder )
+{
+	PyObject *number_of_sub_folders_object = NULL;
+	PyObject *sub_folders_object           = NULL;
+	static char *function                  = "pypff_folder_get_sub_folders";
+	long number_of_sub_folders             = 0;
+
+	number_of_sub_folders_object = pypff_folder_get_number_of_sub_folders(
+	                                pypff_folder );
+
+	if( number_of_sub_folders_object == NULL )
+	{
+		return( NULL );
+	}
+	number_of_sub_folders = PyInt_AsLong(
+	                         number_of_sub_folders_object );
+
+	Py_DecRef(
+	 number_of_sub_folders_object );
+
+	sub_folders_object = pypff_items_new(
+	                      (PyObject *) pypff_folder,
+	                      (PyObject* (*)(PyObject *, int)) &pypff_folder_get_sub_folder_by_index,
+	                      (int) number_of_sub_folders );
+
+	if( sub_folders_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create sub folders object.",
+		 function );
+
+		return( NULL );
+	}
+	return( sub_folders_object );
+}
+
 /* Retrieves the number of sub messages
  * Returns a Python object if successful or NULL on error
  */
@@ -607,6 +792,7 @@ PyObject *pypff_folder_get_number_of_sub_messages(
 	libcerror_error_t *error    = NULL;
 	static char *function      = "pypff_folder_get_number_of_sub_messages";
 	int number_of_sub_messages = 0;
+	int result                 = 0;
 
 	if( pypff_folder == NULL )
 	{
@@ -617,10 +803,22 @@ PyObject *pypff_folder_get_number_of_sub_messages(
 
 		return( NULL );
 	}
-	if( libpff_folder_get_number_of_sub_messages(
-	     pypff_folder->item,
-	     &number_of_sub_messages,
-	     &error ) != 1 )
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_folder->file_object );
+
+	result = libpff_folder_get_number_of_sub_messages(
+	          pypff_folder->item,
+	          &number_of_sub_messages,
+	          &error );
+
+	pypff_file_release_lock(
+	 pypff_folder->file_object );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
 	{
 		if( libcerror_error_backtrace_sprint(
 		     error,
@@ -649,22 +847,20 @@ PyObject *pypff_folder_get_number_of_sub_messages(
 	         (long) number_of_sub_messages ) );
 }
 
-/* Retrieves a specific sub message
+/* Retrieves a specific sub message by index
  * Returns a Python object if successful or NULL on error
  */
-PyObject *pypff_folder_get_sub_message(
+PyObject *pypff_folder_get_sub_message_by_index(
            pypff_folder_t *pypff_folder,
-           PyObject *arguments,
-           PyObject *keywords )
+           int sub_message_index )
 {
 	char error_string[ PYPFF_ERROR_STRING_SIZE ];
 
-	libcerror_error_t *error     = NULL;
-	libpff_item_t *sub_message  = NULL;
-	PyObject *message_object    = NULL;
-	static char *keyword_list[] = { "sub_message_index", NULL };
-	static char *function       = "pypff_folder_get_sub_message";
-	int sub_message_index       = 0;
+	libcerror_error_t *error    = NULL;
+	libpff_item_t *sub_message = NULL;
+	PyObject *message_object   = NULL;
+	static char *function      = "pypff_folder_get_sub_message_by_index";
+	int result                 = 0;
 
 	if( pypff_folder == NULL )
 	{
@@ -675,20 +871,23 @@ PyObject *pypff_folder_get_sub_message(
 
 		return( NULL );
 	}
-	if( PyArg_ParseTupleAndKeywords(
-	     arguments,
-	     keywords,
-	     "i",
-	     keyword_list,
-	     &sub_message_index ) == 0 )
-        {
-		goto on_error;
-        }
-	if( libpff_folder_get_sub_message(
-	     pypff_folder->item,
-	     sub_message_index,
-	     &sub_message,
-	     &error ) != 1 )
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_folder->file_object );
+
+	result = libpff_folder_get_sub_message(
+	          pypff_folder->item,
+	          sub_message_index,
+	          &sub_message,
+	          &error );
+
+	pypff_file_release_lock(
+	 pypff_folder->file_object );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
 	{
 		if( libcerror_error_backtrace_sprint(
 		     error,
@@ -727,18 +926,413 @@ PyObject *pypff_folder_get_sub_message(
 
 		goto on_error;
 	}
-	( (pypff_message_t *) message_object )->item = sub_message;
+	( (pypff_message_t *) message_object )->item        = sub_message;
+	( (pypff_message_t *) message_object )->file_object = pypff_folder->file_object;
 
+	if( pypff_folder->file_object != NULL )
+	{
+		Py_IncRef(
+		 (PyObject *) pypff_folder->file_object );
+	}
 	return( message_object );
 
 on_error:
 	if( sub_message != NULL )
 	{
+		Py_BEGIN_ALLOW_THREADS
+
+		pypff_file_acquire_lock(
+		 pypff_folder->file_object );
+
 		libpff_item_free(
 		 &sub_message,
 		 NULL );
+
+		pypff_file_release_lock(
+		 pypff_folder->file_object );
+
+		Py_END_ALLOW_THREADS
 	}
 	return( NULL );
 }
 
+/* Retrieves a specific sub message
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pypff_folder_get_sub_message(
+           pypff_folder_t *pypff_folder,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	static char *keyword_list[] = { "sub_message_index", NULL };
+	int sub_message_index       = 0;
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &sub_message_index ) == 0 )
+        {
+		return( NULL );
+        }
+	return( pypff_folder_get_sub_message_by_index(
+	         pypff_folder,
+	         sub_message_index ) );
+}
+
+/* Retrieves a sequence and iterator object for the sub messages
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pypff_folder_get_sub_messages(
+           pypff_folder_t *pypff_folder )
+{
+	PyObject *number_of_sub_messages_object = NULL;
+	PyObject *sub_messages_object           = NULL;
+	static char *function                   = "pypff_folder_get_sub_messages";
+	long number_of_sub_messages             = 0;
+
+	number_of_sub_messages_object = pypff_folder_get_number_of_sub_messages(
+	                                 pypff_folder );
+
+	if( number_of_sub_messages_object == NULL )
+	{
+		return( NULL );
+	}
+	number_of_sub_messages = PyInt_AsLong(
+	                          number_of_sub_messages_object );
+
+	Py_DecRef(
+	 number_of_sub_messages_object );
+
+	sub_messages_object = pypff_items_new(
+	                       (PyObject *) pypff_folder,
+	                       (PyObject* (*)(PyObject *, int)) &pypff_folder_get_sub_message_by_index,
+	                       (int) number_of_sub_messages );
+
+	if( sub_messages_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create sub messages object.",
+		 function );
+
+		return( NULL );
+	}
+	return( sub_messages_object );
+}
+
+/* Retrieves the values of specific entry types of all the sub messages
+ * The values are returned as a list per entry type that contains
+ * the value of every sub message or None if the sub message does not
+ * contain the value
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pypff_folder_get_sub_messages_values(
+           pypff_folder_t *pypff_folder,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	char error_string[ PYPFF_ERROR_STRING_SIZE ];
+
+	libcerror_error_t *error        = NULL;
+	libpff_item_t *sub_message      = NULL;
+	pypff_value_t *values           = NULL;
+	PyObject *entry_types_object    = NULL;
+	PyObject *entry_types_sequence  = NULL;
+	PyObject *list_object           = NULL;
+	PyObject *value_object          = NULL;
+	PyObject *values_object         = NULL;
+	static char *keyword_list[]     = { "entry_types", NULL };
+	static char *function           = "pypff_folder_get_sub_messages_values";
+	long entry_type                 = 0;
+	int entry_type_index            = 0;
+	int number_of_entry_types       = 0;
+	int number_of_sub_messages      = 0;
+	int result                      = 0;
+	int sub_message_index           = 0;
+
+	if( pypff_folder == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid folder.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O",
+	     keyword_list,
+	     &entry_types_object ) == 0 )
+	{
+		return( NULL );
+	}
+	entry_types_sequence = PySequence_Fast(
+	                        entry_types_object,
+	                        "entry types must be a sequence of integers" );
+
+	if( entry_types_sequence == NULL )
+	{
+		return( NULL );
+	}
+	number_of_entry_types = (int) PySequence_Fast_GET_SIZE(
+	                               entry_types_sequence );
+
+	if( number_of_entry_types > 0 )
+	{
+		values = (pypff_value_t *) PyMem_Malloc(
+		                            sizeof( pypff_value_t ) * number_of_entry_types );
+
+		if( values == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to create values.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     values,
+		     0,
+		     sizeof( pypff_value_t ) * number_of_entry_types ) == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to clear values.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( entry_type_index = 0;
+	     entry_type_index < number_of_entry_types;
+	     entry_type_index++ )
+	{
+		entry_type = PyInt_AsLong(
+		              PySequence_Fast_GET_ITEM(
+		               entry_types_sequence,
+		               entry_type_index ) );
+
+		if( ( entry_type == -1 )
+		 && ( PyErr_Occurred() != NULL ) )
+		{
+			goto on_error;
+		}
+		if( ( entry_type < 0 )
+		 || ( entry_type > (long) UINT16_MAX ) )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: invalid entry type: %ld value out of bounds.",
+			 function,
+			 entry_type );
+
+			goto on_error;
+		}
+		values[ entry_type_index ].entry_type = (uint32_t) entry_type;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_folder->file_object );
+
+	result = libpff_folder_get_number_of_sub_messages(
+	          pypff_folder->item,
+	          &number_of_sub_messages,
+	          &error );
+
+	pypff_file_release_lock(
+	 pypff_folder->file_object );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		if( libcerror_error_backtrace_sprint(
+		     error,
+		     error_string,
+		     PYPFF_ERROR_STRING_SIZE ) == -1 )
+                {
+			PyErr_Format(
+			 PyExc_IOError,
+			 "%s: unable to retrieve number of sub messages.",
+			 function );
+		}
+		else
+                {
+			PyErr_Format(
+			 PyExc_IOError,
+			 "%s: unable to retrieve number of sub messages.\n%s",
+			 function,
+			 error_string );
+		}
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	values_object = PyList_New(
+	                 (Py_ssize_t) number_of_entry_types );
+
+	if( values_object == NULL )
+	{
+		goto on_error;
+	}
+	for( entry_type_index = 0;
+	     entry_type_index < number_of_entry_types;
+	     entry_type_index++ )
+	{
+		list_object = PyList_New(
+		               (Py_ssize_t) number_of_sub_messages );
+
+		if( list_object == NULL )
+		{
+			goto on_error;
+		}
+		/* PyList_SetItem steals the reference to the list
+		 */
+		PyList_SET_ITEM(
+		 values_object,
+		 (Py_ssize_t) entry_type_index,
+		 list_object );
+	}
+	for( sub_message_index = 0;
+	     sub_message_index < number_of_sub_messages;
+	     sub_message_index++ )
+	{
+		/* Copy all the values of the sub message at once
+		 * to release the GIL and acquire the lock only once per sub message
+		 */
+		Py_BEGIN_ALLOW_THREADS
+
+		pypff_file_acquire_lock(
+		 pypff_folder->file_object );
+
+		result = libpff_folder_get_sub_message(
+		          pypff_folder->item,
+		          sub_message_index,
+		          &sub_message,
+		          &error );
+
+		for( entry_type_index = 0;
+		     ( result == 1 ) && ( entry_type_index < number_of_entry_types );
+		     entry_type_index++ )
+		{
+			if( pypff_value_copy_from_item(
+			     &( values[ entry_type_index ] ),
+			     sub_message,
+			     &error ) == -1 )
+			{
+				result = -1;
+			}
+		}
+		if( sub_message != NULL )
+		{
+			libpff_item_free(
+			 &sub_message,
+			 NULL );
+		}
+		pypff_file_release_lock(
+		 pypff_folder->file_object );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			if( libcerror_error_backtrace_sprint(
+			     error,
+			     error_string,
+			     PYPFF_ERROR_STRING_SIZE ) == -1 )
+			{
+				PyErr_Format(
+				 PyExc_IOError,
+				 "%s: unable to retrieve values of sub message: %d.",
+				 function,
+				 sub_message_index );
+			}
+			else
+			{
+				PyErr_Format(
+				 PyExc_IOError,
+				 "%s: unable to retrieve values of sub message: %d.\n%s",
+				 function,
+				 sub_message_index,
+				 error_string );
+			}
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+		for( entry_type_index = 0;
+		     entry_type_index < number_of_entry_types;
+		     entry_type_index++ )
+		{
+			value_object = pypff_value_get_object(
+			                &( values[ entry_type_index ] ) );
+
+			if( value_object == NULL )
+			{
+				goto on_error;
+			}
+			/* PyList_SET_ITEM steals the reference to the value
+			 */
+			PyList_SET_ITEM(
+			 PyList_GET_ITEM(
+			  values_object,
+			  (Py_ssize_t) entry_type_index ),
+			 (Py_ssize_t) sub_message_index,
+			 value_object );
+		}
+	}
+	for( entry_type_index = 0;
+	     entry_type_index < number_of_entry_types;
+	     entry_type_index++ )
+	{
+		if( values[ entry_type_index ].data != NULL )
+		{
+			memory_free(
+			 values[ entry_type_index ].data );
+		}
+	}
+	if( values != NULL )
+	{
+		PyMem_Free(
+		 values );
+	}
+	Py_DecRef(
+	 entry_types_sequence );
+
+	return( values_object );
+
+on_error:
+	if( values_object != NULL )
+	{
+		Py_DecRef(
+		 values_object );
+	}
+	if( values != NULL )
+	{
+		for( entry_type_index = 0;
+		     entry_type_index < number_of_entry_types;
+		     entry_type_index++ )
+		{
+			if( values[ entry_type_index ].data != NULL )
+			{
+				memory_free(
+				 values[ entry_type_index ].data );
+			}
+		}
+		PyMem_Free(
+		 values );
+	}
+	Py_DecRef(
+	 entry_types_sequence );
+
+	return( NULL );
+}
 
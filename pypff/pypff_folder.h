@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "pypff_file.h"
 #include "pypff_libcerror.h"
 #include "pypff_libpff.h"
 #include "pypff_python.h"
@@ -44,9 +45,14 @@ struct pypff_folder
 	/* The folder type libpff item
 	 */
 	libpff_item_t *item;
+
+	/* The file object the item belongs to
+	 */
+	pypff_file_t *file_object;
 };
 
 extern PyMethodDef pypff_folder_object_methods[];
+extern PyGetSetDef pypff_folder_object_get_set_definitions[];
 extern PyTypeObject pypff_folder_type_object;
 
 PyObject *pypff_folder_new(
@@ -64,19 +70,38 @@ PyObject *pypff_folder_get_display_name(
 PyObject *pypff_folder_get_number_of_sub_folders(
            pypff_folder_t *pypff_folder );
 
+PyObject *pypff_folder_get_sub_folder_by_index(
+           pypff_folder_t *pypff_folder,
+           int sub_folder_index );
+
 PyObject *pypff_folder_get_sub_folder(
            pypff_folder_t *pypff_folder,
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pypff_folder_get_sub_folders(
+           pypff_folder_t *pypff_folder );
+
 PyObject *pypff_folder_get_number_of_sub_messages(
            pypff_folder_t *pypff_folder );
 
+PyObject *pypff_folder_get_sub_message_by_index(
+           pypff_folder_t *pypff_folder,
+           int sub_message_index );
+
 PyObject *pypff_folder_get_sub_message(
            pypff_folder_t *pypff_folder,
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pypff_folder_get_sub_messages(
+           pypff_folder_t *pypff_folder );
+
+PyObject *pypff_folder_get_sub_messages_values(
+           pypff_folder_t *pypff_folder,
+           PyObject *arguments,
+           PyObject *keywords );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -29,6 +29,7 @@
 
 #include "pypff.h"
 #include "pypff_item.h"
+#include "pypff_items.h"
 #include "pypff_libcerror.h"
 #include "pypff_libcstring.h"
 #include "pypff_libpff.h"
@@ -55,10 +56,33 @@ PyMethodDef pypff_item_object_methods[] = {
 	  METH_VARARGS | METH_KEYWORDS,
 	  "Retrieves a specific sub item" },
 
+	{ "get_sub_items",
+	  (PyCFunction) pypff_item_get_sub_items,
+	  METH_NOARGS,
+	  "Retrieves a sequence and iterator of the sub items" },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
 
+PyGetSetDef pypff_item_object_get_set_definitions[] = {
+
+	{ "number_of_sub_items",
+	  (getter) pypff_item_get_number_of_sub_items,
+	  (setter) 0,
+	  "The number of sub items",
+	  NULL },
+
+	{ "sub_items",
+	  (getter) pypff_item_get_sub_items,
+	  (setter) 0,
+	  "The sub items",
+	  NULL },
+
+	/* Sentinel */
+	{ NULL, NULL, NULL, NULL, NULL }
+};
+
 PyTypeObject pypff_item_type_object = {
 	PyObject_HEAD_INIT( NULL )
 
@@ -121,7 +145,7 @@ PyTypeObject pypff_item_type_object = {
 	/* tp_members */
 	0,
 	/* tp_getset */
-	0,
+	pypff_item_object_get_set_definitions,
 	/* tp_base */
 	0,
 	/* tp_dict */
@@ -218,7 +242,8 @@ int pypff_item_init(
 	}
 	/* Make sure libpff item is set to NULL
 	 */
-	pypff_item->item = NULL;
+	pypff_item->item        = NULL;
+	pypff_item->file_object = NULL;
 
 	return( 0 );
 }
@@ -232,6 +257,7 @@ void pypff_item_free(
 
 	libcerror_error_t *error = NULL;
 	static char *function   = "pypff_item_free";
+	int result               = 0;
 
 	if( pypff_item == NULL )
 	{
@@ -269,9 +295,21 @@ void pypff_item_free(
 
 		return;
 	}
-	if( libpff_item_free(
-	     &( pypff_item->item ),
-	     &error ) != 1 )
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_item->file_object );
+
+	result = libpff_item_free(
+	          &( pypff_item->item ),
+	          &error );
+
+	pypff_file_release_lock(
+	 pypff_item->file_object );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
 	{
 		if( libcerror_error_backtrace_sprint(
 		     error,
@@ -294,6 +332,11 @@ void pypff_item_free(
 		libcerror_error_free(
 		 &error );
 	}
+	if( pypff_item->file_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pypff_item->file_object );
+	}
 	pypff_item->ob_type->tp_free(
 	 (PyObject*) pypff_item );
 }
@@ -323,6 +366,11 @@ PyObject *pypff_item_get_display_name(
 
 		return( NULL );
 	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_item->file_object );
+
 	result = libpff_item_get_entry_value_utf8_string_size(
 	          pypff_item->item,
 	          0,
@@ -331,6 +379,11 @@ PyObject *pypff_item_get_display_name(
 	          0,
 	          &error );
 
+	pypff_file_release_lock(
+	 pypff_item->file_object );
+
+	Py_END_ALLOW_THREADS
+
 	if( result == -1 )
 	{
 		if( libcerror_error_backtrace_sprint(
@@ -376,6 +429,11 @@ PyObject *pypff_item_get_display_name(
 
 		goto on_error;
 	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_item->file_object );
+
 	result = libpff_item_get_entry_value_utf8_string(
 		  pypff_item->item,
 		  0,
@@ -385,6 +443,11 @@ PyObject *pypff_item_get_display_name(
 		  0,
 		  &error );
 
+	pypff_file_release_lock(
+	 pypff_item->file_object );
+
+	Py_END_ALLOW_THREADS
+
 	if( result != 1 )
 	{
 		if( libcerror_error_backtrace_sprint(
@@ -444,6 +507,7 @@ PyObject *pypff_item_get_number_of_sub_items(
 	libcerror_error_t *error = NULL;
 	static char *function   = "pypff_item_get_number_of_sub_items";
 	int number_of_sub_items = 0;
+	int result              = 0;
 
 	if( pypff_item == NULL )
 	{
@@ -454,10 +518,22 @@ PyObject *pypff_item_get_number_of_sub_items(
 
 		return( NULL );
 	}
-	if( libpff_item_get_number_of_sub_items(
-	     pypff_item->item,
-	     &number_of_sub_items,
-	     &error ) != 1 )
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_item->file_object );
+
+	result = libpff_item_get_number_of_sub_items(
+	          pypff_item->item,
+	          &number_of_sub_items,
+	          &error );
+
+	pypff_file_release_lock(
+	 pypff_item->file_object );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
 	{
 		if( libcerror_error_backtrace_sprint(
 		     error,
@@ -486,22 +562,20 @@ PyObject *pypff_item_get_number_of_sub_items(
 	         (long) number_of_sub_items ) );
 }
 
-/* Retrieves a specific sub item
+/* Retrieves a specific sub item by index
  * Returns a Python object if successful or NULL on error
  */
-PyObject *pypff_item_get_sub_item(
+PyObject *pypff_item_get_sub_item_by_index(
            pypff_item_t *pypff_item,
-           PyObject *arguments,
-           PyObject *keywords )
+           int sub_item_index )
 {
 	char error_string[ PYPFF_ERROR_STRING_SIZE ];
 
-	libcerror_error_t *error     = NULL;
-	libpff_item_t *sub_item     = NULL;
-	PyObject *item_object       = NULL;
-	static char *keyword_list[] = { "sub_item_index", NULL };
-	static char *function       = "pypff_item_get_sub_item";
-	int sub_item_index          = 0;
+	libcerror_error_t *error = NULL;
+	libpff_item_t *sub_item = NULL;
+	PyObject *item_object   = NULL;
+	static char *function   = "pypff_item_get_sub_item_by_index";
+	int result              = 0;
 
 	if( pypff_item == NULL )
 	{
@@ -512,20 +586,23 @@ PyObject *pypff_item_get_sub_item(
 
 		return( NULL );
 	}
-	if( PyArg_ParseTupleAndKeywords(
-	     arguments,
-	     keywords,
-	     "i",
-	     keyword_list,
-	     &sub_item_index ) == 0 )
-        {
-		goto on_error;
-        }
-	if( libpff_item_get_sub_item(
-	     pypff_item->item,
-	     sub_item_index,
-	     &sub_item,
-	     &error ) != 1 )
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_item->file_object );
+
+	result = libpff_item_get_sub_item(
+	          pypff_item->item,
+	          sub_item_index,
+	          &sub_item,
+	          &error );
+
+	pypff_file_release_lock(
+	 pypff_item->file_object );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
 	{
 		if( libcerror_error_backtrace_sprint(
 		     error,
@@ -564,17 +641,99 @@ PyObject *pypff_item_get_sub_item(
 
 		goto on_error;
 	}
-	( (pypff_item_t *) item_object )->item = sub_item;
+	( (pypff_item_t *) item_object )->item        = sub_item;
+	( (pypff_item_t *) item_object )->file_object = pypff_item->file_object;
 
+	if( pypff_item->file_object != NULL )
+	{
+		Py_IncRef(
+		 (PyObject *) pypff_item->file_object );
+	}
 	return( item_object );
 
 on_error:
 	if( sub_item != NULL )
 	{
+		Py_BEGIN_ALLOW_THREADS
+
+		pypff_file_acquire_lock(
+		 pypff_item->file_object );
+
 		libpff_item_free(
 		 &sub_item,
 		 NULL );
+
+		pypff_file_release_lock(
+		 pypff_item->file_object );
+
+		Py_END_ALLOW_THREADS
 	}
 	return( NULL );
 }
 
+/* Retrieves a specific sub item
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pypff_item_get_sub_item(
+           pypff_item_t *pypff_item,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	static char *keyword_list[] = { "sub_item_index", NULL };
+	int sub_item_index          = 0;
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &sub_item_index ) == 0 )
+        {
+		return( NULL );
+        }
+	return( pypff_item_get_sub_item_by_index(
+	         pypff_item,
+	         sub_item_index ) );
+}
+
+/* Retrieves a sequence and iterator object for the sub items
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pypff_item_get_sub_items(
+           pypff_item_t *pypff_item )
+{
+	PyObject *number_of_sub_items_object = NULL;
+	PyObject *sub_items_object           = NULL;
+	static char *function                = "pypff_item_get_sub_items";
+	long number_of_sub_items             = 0;
+
+	number_of_sub_items_object = pypff_item_get_number_of_sub_items(
+	                              pypff_item );
+
+	if( number_of_sub_items_object == NULL )
+	{
+		return( NULL );
+	}
+	number_of_sub_items = PyInt_AsLong(
+	                       number_of_sub_items_object );
+
+	Py_DecRef(
+	 number_of_sub_items_object );
+
+	sub_items_object = pypff_items_new(
+	                    (PyObject *) pypff_item,
+	                    (PyObject* (*)(PyObject *, int)) &pypff_item_get_sub_item_by_index,
+	                    (int) number_of_sub_items );
+
+	if( sub_items_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create sub items object.",
+		 function );
+
+		return( NULL );
+	}
+	return( sub_items_object );
+}
+
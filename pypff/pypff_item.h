@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "pypff_file.h"
 #include "pypff_libcerror.h"
 #include "pypff_libpff.h"
 #include "pypff_python.h"
@@ -44,9 +45,14 @@ struct pypff_item
 	/* The libpff item
 	 */
 	libpff_item_t *item;
+
+	/* The file object the item belongs to
+	 */
+	pypff_file_t *file_object;
 };
 
 extern PyMethodDef pypff_item_object_methods[];
+extern PyGetSetDef pypff_item_object_get_set_definitions[];
 extern PyTypeObject pypff_item_type_object;
 
 PyObject *pypff_item_new(
@@ -64,11 +70,18 @@ PyObject *pypff_item_get_display_name(
 PyObject *pypff_item_get_number_of_sub_items(
            pypff_item_t *pypff_item );
 
+PyObject *pypff_item_get_sub_item_by_index(
+           pypff_item_t *pypff_item,
+           int sub_item_index );
+
 PyObject *pypff_item_get_sub_item(
            pypff_item_t *pypff_item,
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pypff_item_get_sub_items(
+           pypff_item_t *pypff_item );
+
 #if defined( __cplusplus )
 }
 #endif
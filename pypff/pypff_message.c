@@ -28,6 +28,8 @@
 #endif
 
 #include "pypff.h"
+#include "pypff_attachment.h"
+#include "pypff_items.h"
 #include "pypff_libcerror.h"
 #include "pypff_libcstring.h"
 #include "pypff_libpff.h"
@@ -48,10 +50,45 @@ PyMethodDef pypff_message_object_methods[] = {
 	  METH_NOARGS,
 	  "Retrieves the plain-text body" },
 
+	/* Functions to access the attachments */
+
+	{ "get_number_of_attachments",
+	  (PyCFunction) pypff_message_get_number_of_attachments,
+	  METH_NOARGS,
+	  "Retrieves the number of attachments" },
+
+	{ "get_attachment",
+	  (PyCFunction) pypff_message_get_attachment,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "Retrieves a specific attachment" },
+
+	{ "get_attachments",
+	  (PyCFunction) pypff_message_get_attachments,
+	  METH_NOARGS,
+	  "Retrieves a sequence and iterator of the attachments" },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
 
+PyGetSetDef pypff_message_object_get_set_definitions[] = {
+
+	{ "number_of_attachments",
+	  (getter) pypff_message_get_number_of_attachments,
+	  (setter) 0,
+	  "The number of attachments",
+	  NULL },
+
+	{ "attachments",
+	  (getter) pypff_message_get_attachments,
+	  (setter) 0,
+	  "The attachments",
+	  NULL },
+
+	/* Sentinel */
+	{ NULL, NULL, NULL, NULL, NULL }
+};
+
 PyTypeObject pypff_message_type_object = {
 	PyObject_HEAD_INIT( NULL )
 
@@ -114,7 +151,7 @@ PyTypeObject pypff_message_type_object = {
 	/* tp_members */
 	0,
 	/* tp_getset */
-	0,
+	pypff_message_object_get_set_definitions,
 	/* tp_base */
 	0,
 	/* tp_dict */
@@ -211,7 +248,8 @@ int pypff_message_init(
 	}
 	/* Make sure libpff item is set to NULL
 	 */
-	pypff_message->item = NULL;
+	pypff_message->item        = NULL;
+	pypff_message->file_object = NULL;
 
 	return( 0 );
 }
@@ -225,6 +263,7 @@ void pypff_message_free(
 
 	libcerror_error_t *error = NULL;
 	static char *function   = "pypff_message_free";
+	int result               = 0;
 
 	if( pypff_message == NULL )
 	{
@@ -262,9 +301,21 @@ void pypff_message_free(
 
 		return;
 	}
-	if( libpff_item_free(
-	     &( pypff_message->item ),
-	     &error ) != 1 )
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_message->file_object );
+
+	result = libpff_item_free(
+	          &( pypff_message->item ),
+	          &error );
+
+	pypff_file_release_lock(
+	 pypff_message->file_object );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
 	{
 		if( libcerror_error_backtrace_sprint(
 		     error,
@@ -287,6 +338,11 @@ void pypff_message_free(
 		libcerror_error_free(
 		 &error );
 	}
+	if( pypff_message->file_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pypff_message->file_object );
+	}
 	pypff_message->ob_type->tp_free(
 	 (PyObject*) pypff_message );
 }
@@ -316,6 +372,11 @@ PyObject *pypff_message_get_subject(
 
 		return( NULL );
 	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_message->file_object );
+
 	result = libpff_item_get_entry_value_utf8_string_size(
 	          pypff_message->item,
 	          0,
@@ -324,6 +385,11 @@ PyObject *pypff_message_get_subject(
 	          0,
 	          &error );
 
+	pypff_file_release_lock(
+	 pypff_message->file_object );
+
+	Py_END_ALLOW_THREADS
+
 	if( result == -1 )
 	{
 		if( libcerror_error_backtrace_sprint(
@@ -369,6 +435,11 @@ PyObject *pypff_message_get_subject(
 
 		goto on_error;
 	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_message->file_object );
+
 	result = libpff_item_get_entry_value_utf8_string(
 		  pypff_message->item,
 		  0,
@@ -378,6 +449,11 @@ PyObject *pypff_message_get_subject(
 		  0,
 		  &error );
 
+	pypff_file_release_lock(
+	 pypff_message->file_object );
+
+	Py_END_ALLOW_THREADS
+
 	if( result != 1 )
 	{
 		if( libcerror_error_backtrace_sprint(
@@ -466,11 +542,21 @@ PyObject *pypff_message_get_plain_text_body(
 
 		return( NULL );
 	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_message->file_object );
+
 	result = libpff_message_get_plain_text_body_size(
 	          pypff_message->item,
 	          &value_string_size,
 	          &error );
 
+	pypff_file_release_lock(
+	 pypff_message->file_object );
+
+	Py_END_ALLOW_THREADS
+
 	if( result == -1 )
 	{
 		if( libcerror_error_backtrace_sprint(
@@ -516,12 +602,22 @@ PyObject *pypff_message_get_plain_text_body(
 
 		goto on_error;
 	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_message->file_object );
+
 	result = libpff_message_get_plain_text_body(
 		  pypff_message->item,
 		  value_string,
 		  value_string_size,
 		  &error );
 
+	pypff_file_release_lock(
+	 pypff_message->file_object );
+
+	Py_END_ALLOW_THREADS
+
 	if( result != 1 )
 	{
 		if( libcerror_error_backtrace_sprint(
@@ -570,3 +666,244 @@ on_error:
 	return( NULL );
 }
 
+/* Retrieves the number of attachments
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pypff_message_get_number_of_attachments(
+           pypff_message_t *pypff_message )
+{
+	char error_string[ PYPFF_ERROR_STRING_SIZE ];
+
+	libcerror_error_t *error   = NULL;
+	static char *function     = "pypff_message_get_number_of_attachments";
+	int number_of_attachments = 0;
+	int result                = 0;
+
+	if( pypff_message == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid message.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_message->file_object );
+
+	result = libpff_message_get_number_of_attachments(
+	          pypff_message->item,
+	          &number_of_attachments,
+	          &error );
+
+	pypff_file_release_lock(
+	 pypff_message->file_object );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		if( libcerror_error_backtrace_sprint(
+		     error,
+		     error_string,
+		     PYPFF_ERROR_STRING_SIZE ) == -1 )
+                {
+			PyErr_Format(
+			 PyExc_IOError,
+			 "%s: unable to retrieve number of attachments.",
+			 function );
+		}
+		else
+		{
+			PyErr_Format(
+			 PyExc_IOError,
+			 "%s: unable to retrieve number of attachments.\n%s",
+			 function,
+			 error_string );
+		}
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( PyInt_FromLong(
+	         (long) number_of_attachments ) );
+}
+
+/* Retrieves a specific attachment by index
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pypff_message_get_attachment_by_index(
+           pypff_message_t *pypff_message,
+           int attachment_index )
+{
+	char error_string[ PYPFF_ERROR_STRING_SIZE ];
+
+	libcerror_error_t *error    = NULL;
+	libpff_item_t *attachment  = NULL;
+	PyObject *attachment_object = NULL;
+	static char *function       = "pypff_message_get_attachment_by_index";
+	int result                  = 0;
+
+	if( pypff_message == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid message.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	pypff_file_acquire_lock(
+	 pypff_message->file_object );
+
+	result = libpff_message_get_attachment(
+	          pypff_message->item,
+	          attachment_index,
+	          &attachment,
+	          &error );
+
+	pypff_file_release_lock(
+	 pypff_message->file_object );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		if( libcerror_error_backtrace_sprint(
+		     error,
+		     error_string,
+		     PYPFF_ERROR_STRING_SIZE ) == -1 )
+                {
+			PyErr_Format(
+			 PyExc_IOError,
+			 "%s: unable to retrieve attachment: %d.",
+			 function,
+			 attachment_index );
+		}
+		else
+		{
+			PyErr_Format(
+			 PyExc_IOError,
+			 "%s: unable to retrieve attachment: %d.\n%s",
+			 function,
+			 attachment_index,
+			 error_string );
+		}
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	attachment_object = pypff_attachment_new(
+	                     NULL );
+
+	if( attachment_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create attachment object.",
+		 function );
+
+		goto on_error;
+	}
+	( (pypff_attachment_t *) attachment_object )->item        = attachment;
+	( (pypff_attachment_t *) attachment_object )->file_object = pypff_message->file_object;
+
+	if( pypff_message->file_object != NULL )
+	{
+		Py_IncRef(
+		 (PyObject *) pypff_message->file_object );
+	}
+	return( attachment_object );
+
+on_error:
+	if( attachment != NULL )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		pypff_file_acquire_lock(
+		 pypff_message->file_object );
+
+		libpff_item_free(
+		 &attachment,
+		 NULL );
+
+		pypff_file_release_lock(
+		 pypff_message->file_object );
+
+		Py_END_ALLOW_THREADS
+	}
+	return( NULL );
+}
+
+/* Retrieves a specific attachment
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pypff_message_get_attachment(
+           pypff_message_t *pypff_message,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	static char *keyword_list[] = { "attachment_index", NULL };
+	int attachment_index        = 0;
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &attachment_index ) == 0 )
+        {
+		return( NULL );
+        }
+	return( pypff_message_get_attachment_by_index(
+	         pypff_message,
+	         attachment_index ) );
+}
+
+/* Retrieves a sequence and iterator object for the attachments
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pypff_message_get_attachments(
+           pypff_message_t *pypff_message )
+{
+	PyObject *attachments_object           = NULL;
+	PyObject *number_of_attachments_object = NULL;
+	static char *function                  = "pypff_message_get_attachments";
+	long number_of_attachments             = 0;
+
+	number_of_attachments_object = pypff_message_get_number_of_attachments(
+	                                pypff_message );
+
+	if( number_of_attachments_object == NULL )
+	{
+		return( NULL );
+	}
+	number_of_attachments = PyInt_AsLong(
+	                         number_of_attachments_object );
+
+	Py_DecRef(
+	 number_of_attachments_object );
+
+	attachments_object = pypff_items_new(
+	                      (PyObject *) pypff_message,
+	                      (PyObject* (*)(PyObject *, int)) &pypff_message_get_attachment_by_index,
+	                      (int) number_of_attachments );
+
+	if( attachments_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create attachments object.",
+		 function );
+
+		return( NULL );
+	}
+	return( attachments_object );
+}
+
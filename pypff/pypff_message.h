@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "pypff_file.h"
 #include "pypff_libcerror.h"
 #include "pypff_libpff.h"
 #include "pypff_python.h"
@@ -44,9 +45,14 @@ struct pypff_message
 	/* The message type libpff item
 	 */
 	libpff_item_t *item;
+
+	/* The file object the item belongs to
+	 */
+	pypff_file_t *file_object;
 };
 
 extern PyMethodDef pypff_message_object_methods[];
+extern PyGetSetDef pypff_message_object_get_set_definitions[];
 extern PyTypeObject pypff_message_type_object;
 
 PyObject *pypff_message_new(
@@ -64,6 +70,21 @@ PyObject *pypff_message_get_subject(
 PyObject *pypff_message_get_plain_text_body(
            pypff_message_t *pypff_message );
 
+PyObject *pypff_message_get_number_of_attachments(
+           pypff_message_t *pypff_message );
+
+PyObject *pypff_message_get_attachment_by_index(
+           pypff_message_t *pypff_message,
+           int attachment_index );
+
+PyObject *pypff_message_get_attachment(
+           pypff_message_t *pypff_message,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pypff_message_get_attachments(
+           pypff_message_t *pypff_message );
+
 #if defined( __cplusplus )
 }
 #endif
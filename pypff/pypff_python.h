@@ -34,6 +34,7 @@
 #undef HAVE_STAT
 
 #include <Python.h>
+#include <pythread.h>
 
 #endif
 
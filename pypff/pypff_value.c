@@ -0,0 +1,417 @@
+/*
+ * Python conversion functions for libpff item entry values
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "pypff_datetime.h"
+#include "pypff_libcerror.h"
+#include "pypff_libpff.h"
+#include "pypff_python.h"
+#include "pypff_value.h"
+
+/* Resizes the value data
+ * Returns 1 if successful or -1 on error
+ */
+int pypff_value_resize_data(
+     pypff_value_t *value,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "pypff_value_resize_data";
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > value->allocated_data_size )
+	{
+		reallocation = (uint8_t *) memory_reallocate(
+		                            value->data,
+		                            sizeof( uint8_t ) * data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize data.",
+			 function );
+
+			return( -1 );
+		}
+		value->data                = reallocation;
+		value->allocated_data_size = data_size;
+	}
+	value->data_size = data_size;
+
+	return( 1 );
+}
+
+/* Copies the value of the entry type from an item
+ * The data is copied since the item values can be flushed from the cache,
+ * this function does not use the Python API hence the GIL can be released
+ * Returns 1 if successful, 0 if the item does not contain such value or -1 on error
+ */
+int pypff_value_copy_from_item(
+     pypff_value_t *value,
+     libpff_item_t *item,
+     libcerror_error_t **error )
+{
+	uint8_t *value_data    = NULL;
+	static char *function  = "pypff_value_copy_from_item";
+	size_t value_data_size = 0;
+	int result             = 0;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	value->value_type = 0;
+	value->is_set     = 0;
+	value->data_size  = 0;
+
+	result = libpff_item_get_entry_value(
+	          item,
+	          0,
+	          value->entry_type,
+	          &( value->value_type ),
+	          &value_data,
+	          &value_data_size,
+	          LIBPFF_ENTRY_VALUE_FLAG_MATCH_ANY_VALUE_TYPE,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry value: 0x%04" PRIx32 ".",
+		 function,
+		 value->entry_type );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( value->value_type == LIBPFF_VALUE_TYPE_STRING_ASCII )
+	{
+		/* Convert the ASCII string using the codepage of the file
+		 */
+		if( libpff_item_get_entry_value_utf8_string_size(
+		     item,
+		     0,
+		     value->entry_type,
+		     &value_data_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string size of entry value: 0x%04" PRIx32 ".",
+			 function,
+			 value->entry_type );
+
+			return( -1 );
+		}
+		if( pypff_value_resize_data(
+		     value,
+		     value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize value data.",
+			 function );
+
+			return( -1 );
+		}
+		if( value_data_size > 0 )
+		{
+			if( libpff_item_get_entry_value_utf8_string(
+			     item,
+			     0,
+			     value->entry_type,
+			     value->data,
+			     value->data_size,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve UTF-8 string of entry value: 0x%04" PRIx32 ".",
+				 function,
+				 value->entry_type );
+
+				return( -1 );
+			}
+		}
+	}
+	else
+	{
+		if( pypff_value_resize_data(
+		     value,
+		     value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize value data.",
+			 function );
+
+			return( -1 );
+		}
+		if( value_data_size > 0 )
+		{
+			if( memory_copy(
+			     value->data,
+			     value_data,
+			     value_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy value data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	value->is_set = 1;
+
+	return( 1 );
+}
+
+/* Converts the value into a Python object
+ * Values of an unsupported type or size are returned as a string of bytes
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pypff_value_get_object(
+           pypff_value_t *value )
+{
+	union
+	{
+		uint32_t integer;
+		float floating_point;
+	} floating_point_32bit;
+
+	union
+	{
+		uint64_t integer;
+		double floating_point;
+	} floating_point_64bit;
+
+	const char *errors    = NULL;
+	static char *function = "pypff_value_get_object";
+	uint64_t value_64bit  = 0;
+	uint32_t value_32bit  = 0;
+	uint16_t value_16bit  = 0;
+	int byte_order        = -1;
+
+	if( value == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid value.",
+		 function );
+
+		return( NULL );
+	}
+	if( value->is_set == 0 )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	switch( value->value_type )
+	{
+		case LIBPFF_VALUE_TYPE_BOOLEAN:
+			if( value->data_size < 1 )
+			{
+				break;
+			}
+			if( value->data[ 0 ] != 0 )
+			{
+				Py_IncRef(
+				 Py_True );
+
+				return( Py_True );
+			}
+			Py_IncRef(
+			 Py_False );
+
+			return( Py_False );
+
+		case LIBPFF_VALUE_TYPE_INTEGER_16BIT_SIGNED:
+			if( value->data_size != 2 )
+			{
+				break;
+			}
+			byte_stream_copy_to_uint16_little_endian(
+			 value->data,
+			 value_16bit );
+
+			return( PyInt_FromLong(
+			         (long) (int16_t) value_16bit ) );
+
+		case LIBPFF_VALUE_TYPE_INTEGER_32BIT_SIGNED:
+		case LIBPFF_VALUE_TYPE_ERROR:
+			if( value->data_size != 4 )
+			{
+				break;
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 value->data,
+			 value_32bit );
+
+			return( PyInt_FromLong(
+			         (long) (int32_t) value_32bit ) );
+
+		case LIBPFF_VALUE_TYPE_INTEGER_64BIT_SIGNED:
+		case LIBPFF_VALUE_TYPE_CURRENCY:
+			if( value->data_size != 8 )
+			{
+				break;
+			}
+			byte_stream_copy_to_uint64_little_endian(
+			 value->data,
+			 value_64bit );
+
+			return( PyLong_FromLongLong(
+			         (PY_LONG_LONG) (int64_t) value_64bit ) );
+
+		case LIBPFF_VALUE_TYPE_FLOAT_32BIT:
+			if( value->data_size != 4 )
+			{
+				break;
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 value->data,
+			 floating_point_32bit.integer );
+
+			return( PyFloat_FromDouble(
+			         (double) floating_point_32bit.floating_point ) );
+
+		case LIBPFF_VALUE_TYPE_DOUBLE_64BIT:
+		case LIBPFF_VALUE_TYPE_APPLICATION_TIME:
+			if( value->data_size != 8 )
+			{
+				break;
+			}
+			byte_stream_copy_to_uint64_little_endian(
+			 value->data,
+			 floating_point_64bit.integer );
+
+			return( PyFloat_FromDouble(
+			         floating_point_64bit.floating_point ) );
+
+		case LIBPFF_VALUE_TYPE_FILETIME:
+			if( value->data_size != 8 )
+			{
+				break;
+			}
+			byte_stream_copy_to_uint64_little_endian(
+			 value->data,
+			 value_64bit );
+
+			return( pypff_datetime_new_from_filetime(
+			         value_64bit ) );
+
+		case LIBPFF_VALUE_TYPE_STRING_ASCII:
+			/* The string was converted to UTF-8 and includes the end of string character
+			 */
+			if( value->data_size == 0 )
+			{
+				return( PyUnicode_FromUnicode(
+				         NULL,
+				         0 ) );
+			}
+			return( PyUnicode_DecodeUTF8(
+			         (char *) value->data,
+			         (Py_ssize_t) value->data_size - 1,
+			         errors ) );
+
+		case LIBPFF_VALUE_TYPE_STRING_UNICODE:
+			/* Strip the end of string character if present
+			 */
+			if( ( value->data_size >= 2 )
+			 && ( value->data[ value->data_size - 2 ] == 0 )
+			 && ( value->data[ value->data_size - 1 ] == 0 ) )
+			{
+				value->data_size -= 2;
+			}
+			return( PyUnicode_DecodeUTF16(
+			         (char *) value->data,
+			         (Py_ssize_t) value->data_size,
+			         errors,
+			         &byte_order ) );
+
+		default:
+			break;
+	}
+	return( PyString_FromStringAndSize(
+	         (char *) value->data,
+	         (Py_ssize_t) value->data_size ) );
+}
+
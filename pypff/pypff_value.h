@@ -0,0 +1,87 @@
+/*
+ * Python conversion functions for libpff item entry values
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYPFF_VALUE_H )
+#define _PYPFF_VALUE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pypff_libcerror.h"
+#include "pypff_libpff.h"
+#include "pypff_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct pypff_value pypff_value_t;
+
+/* A copy of an item entry value that can be converted
+ * into a Python object after the GIL has been reacquired
+ */
+struct pypff_value
+{
+	/* The entry type
+	 */
+	uint32_t entry_type;
+
+	/* The value type
+	 */
+	uint32_t value_type;
+
+	/* Value to indicate the item contains the value
+	 */
+	int is_set;
+
+	/* The value data
+	 * ASCII strings are stored as UTF-8 including the end of string character
+	 */
+	uint8_t *data;
+
+	/* The value data size
+	 */
+	size_t data_size;
+
+	/* The allocated value data size
+	 */
+	size_t allocated_data_size;
+};
+
+int pypff_value_resize_data(
+     pypff_value_t *value,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int pypff_value_copy_from_item(
+     pypff_value_t *value,
+     libpff_item_t *item,
+     libcerror_error_t **error );
+
+PyObject *pypff_value_get_object(
+           pypff_value_t *value );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif
+
@@ -0,0 +1,127 @@
+#!/bin/bash
+#
+# Benchmarks libpff and pffexport on synthetic Personal Folder Files
+#
+# Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+#
+# Refer to AUTHORS for acknowledgements.
+#
+# This software is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This software is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this software.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+EXIT_SUCCESS=0;
+EXIT_FAILURE=1;
+
+# The size of the generated files in MiB and the number of iterations
+# per phase can be overridden from the environment
+BENCH_SIZE=${BENCH_SIZE:-64};
+BENCH_ITERATIONS=${BENCH_ITERATIONS:-3};
+BENCH_DIRECTORY=${BENCH_DIRECTORY:-bench};
+
+PFF_BENCH="./pff_bench";
+PFF_GENERATE="./pff_generate";
+PFFEXPORT="../pfftools/pffexport";
+PYPFF_DIRECTORY="../pypff/.libs";
+PYTHON=${PYTHON:-python};
+
+if ! test -x ${PFF_BENCH} || ! test -x ${PFF_GENERATE};
+then
+	echo "Missing executables: ${PFF_BENCH} or ${PFF_GENERATE}";
+
+	exit ${EXIT_FAILURE};
+fi
+
+# Generates a synthetic file
+# Arguments: the name of the file followed by the pff_generate options
+generate()
+{
+	NAME=$1;
+	shift;
+
+	if ! test -f "${BENCH_DIRECTORY}/${NAME}";
+	then
+		if ! ${PFF_GENERATE} -S ${BENCH_SIZE} $* "${BENCH_DIRECTORY}/${NAME}";
+		then
+			echo "Unable to generate: ${NAME}";
+
+			exit ${EXIT_FAILURE};
+		fi
+	fi
+}
+
+# Benchmarks a synthetic file
+# Arguments: the name of the file
+benchmark()
+{
+	NAME=$1;
+
+	echo "";
+
+	if ! ${PFF_BENCH} -i ${BENCH_ITERATIONS} "${BENCH_DIRECTORY}/${NAME}";
+	then
+		echo "Unable to benchmark: ${NAME}";
+
+		exit ${EXIT_FAILURE};
+	fi
+	if test -x ${PFFEXPORT};
+	then
+		rm -rf "${BENCH_DIRECTORY}/${NAME}.export";
+
+		START=`date +%s%N`;
+
+		if ! ${PFFEXPORT} -q -t "${BENCH_DIRECTORY}/${NAME}" "${BENCH_DIRECTORY}/${NAME}" > /dev/null;
+		then
+			echo "Unable to export: ${NAME}";
+
+			exit ${EXIT_FAILURE};
+		fi
+		END=`date +%s%N`;
+
+		echo "pffexport    $(( ( ${END} - ${START} ) / 1000000 )) milli seconds";
+
+		rm -rf "${BENCH_DIRECTORY}/${NAME}.export";
+	fi
+}
+
+mkdir -p "${BENCH_DIRECTORY}";
+
+generate "unicode.pst" -t 64 -c pst -e compressible;
+generate "ansi.pst" -t 32 -c pst -e compressible;
+generate "unicode.ost" -t 64 -c ost -e none;
+generate "encrypted.pst" -t 64 -c pst -e high;
+generate "attachments.pst" -t 64 -a 4 -A 1048576;
+generate "properties.pst" -t 64 -n 128 -b 16384;
+generate "deleted.pst" -t 64 -d 20 -F 64;
+generate "ansi_deleted.pst" -t 32 -d 20 -F 64;
+
+for NAME in unicode.pst ansi.pst unicode.ost encrypted.pst attachments.pst properties.pst deleted.pst ansi_deleted.pst;
+do
+	benchmark ${NAME};
+done
+
+# Benchmarks the multi-threaded throughput of the Python bindings if they were built
+if test -f "${PYPFF_DIRECTORY}/pypff.so";
+then
+	echo "";
+
+	if ! PYTHONPATH="${PYPFF_DIRECTORY}" ${PYTHON} pypff_threads.py -i ${BENCH_ITERATIONS} "${BENCH_DIRECTORY}/unicode.pst" "${BENCH_DIRECTORY}/ansi.pst" "${BENCH_DIRECTORY}/encrypted.pst" "${BENCH_DIRECTORY}/properties.pst";
+	then
+		echo "Unable to benchmark: pypff";
+
+		exit ${EXIT_FAILURE};
+	fi
+fi
+
+exit ${EXIT_SUCCESS};
+
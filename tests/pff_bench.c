@@ -0,0 +1,1120 @@
+/*
+ * Benchmarks libpff on (synthetic) Personal Folder Files
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include <stdio.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_STRING_H ) || defined( WINAPI )
+#include <string.h>
+#endif
+
+#if defined( TIME_WITH_SYS_TIME )
+#include <sys/time.h>
+#include <time.h>
+#elif defined( HAVE_SYS_TIME_H )
+#include <sys/time.h>
+#else
+#include <time.h>
+#endif
+
+#if defined( HAVE_SYS_RESOURCE_H )
+#include <sys/resource.h>
+#endif
+
+#if defined( HAVE_SYS_WAIT_H )
+#include <sys/wait.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include <libpff.h>
+
+/* Each phase runs in a separate process when supported
+ * so that the peak resident set size can be determined per phase
+ */
+#if defined( HAVE_FORK ) && defined( HAVE_WAIT4 ) && defined( HAVE_SYS_RESOURCE_H ) && defined( HAVE_SYS_WAIT_H )
+#define PFF_BENCH_HAVE_PHASE_PROCESSES	1
+#endif
+
+enum PFF_BENCH_PHASES
+{
+	PFF_BENCH_PHASE_OPEN		= 0,
+	PFF_BENCH_PHASE_TRAVERSE	= 1,
+	PFF_BENCH_PHASE_PROPERTIES	= 2,
+	PFF_BENCH_PHASE_ATTACHMENTS	= 3,
+	PFF_BENCH_PHASE_EXPORT		= 4,
+	PFF_BENCH_PHASE_RECOVER		= 5
+};
+
+#define PFF_BENCH_NUMBER_OF_PHASES	6
+
+static const char *pff_bench_phase_names[ PFF_BENCH_NUMBER_OF_PHASES ] = {
+	"open", "traverse", "properties", "attachments", "export", "recover" };
+
+typedef struct pff_bench_result pff_bench_result_t;
+
+struct pff_bench_result
+{
+	/* The elapsed time in micro seconds
+	 */
+	uint64_t elapsed_time;
+
+	/* The number of items processed
+	 */
+	uint64_t number_of_items;
+
+	/* The number of value bytes processed
+	 */
+	uint64_t number_of_value_bytes;
+
+	/* The number of bytes read from the file
+	 */
+	uint64_t number_of_bytes_read;
+
+	/* The peak resident set size in KiB
+	 */
+	uint64_t peak_resident_set_size;
+};
+
+/* The buffer used to read values and attachment data
+ */
+static uint8_t pff_bench_buffer[ 65536 ];
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use pff_bench to benchmark reading a Personal Folder File (OST, PAB\n"
+	                 "and PST).\n\n" );
+
+	fprintf( stream, "Usage: pff_bench [ -i iterations ] [ -p phases ] [ -h ] source\n\n" );
+
+	fprintf( stream, "\tsource: the source file\n\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-i:     number of iterations per phase, the fastest is reported\n"
+	                 "\t        (default is 1)\n" );
+	fprintf( stream, "\t-p:     comma separated list of phases, options: open, traverse,\n"
+	                 "\t        properties, attachments, export, recover\n"
+	                 "\t        (default is all)\n" );
+}
+
+/* Retrieves the current time in micro seconds
+ */
+uint64_t pff_bench_get_time(
+          void )
+{
+#if defined( HAVE_GETTIMEOFDAY )
+	struct timeval time_value;
+
+	if( gettimeofday(
+	     &time_value,
+	     NULL ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_value.tv_sec * 1000000 ) + (uint64_t) time_value.tv_usec );
+#else
+	return( (uint64_t) time( NULL ) * 1000000 );
+#endif
+}
+
+/* Prints and frees an error
+ */
+void pff_bench_error_fprint(
+      const char *message,
+      libpff_error_t **error )
+{
+	fprintf(
+	 stderr,
+	 "%s\n",
+	 message );
+
+	libpff_error_backtrace_fprint(
+	 *error,
+	 stderr );
+
+	libpff_error_free(
+	 error );
+}
+
+/* Reads all the values of an item
+ * Returns 1 if successful or -1 on error
+ */
+int pff_bench_read_item_values(
+     libpff_item_t *item,
+     pff_bench_result_t *result )
+{
+	libpff_error_t *error                           = NULL;
+	libpff_name_to_id_map_entry_t *name_to_id_entry = NULL;
+	uint8_t *value_data                             = NULL;
+	size_t value_data_size                          = 0;
+	uint32_t entry_index                            = 0;
+	uint32_t entry_type                             = 0;
+	uint32_t number_of_entries                      = 0;
+	uint32_t number_of_sets                         = 0;
+	uint32_t set_index                              = 0;
+	uint32_t value_type                             = 0;
+	int value_result                                = 0;
+
+	if( libpff_item_get_number_of_sets(
+	     item,
+	     &number_of_sets,
+	     &error ) != 1 )
+	{
+		pff_bench_error_fprint(
+		 "Unable to retrieve number of sets.",
+		 &error );
+
+		return( -1 );
+	}
+	if( libpff_item_get_number_of_entries(
+	     item,
+	     &number_of_entries,
+	     &error ) != 1 )
+	{
+		pff_bench_error_fprint(
+		 "Unable to retrieve number of entries.",
+		 &error );
+
+		return( -1 );
+	}
+	for( set_index = 0;
+	     set_index < number_of_sets;
+	     set_index++ )
+	{
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			if( libpff_item_get_entry_type(
+			     item,
+			     (int) set_index,
+			     (int) entry_index,
+			     &entry_type,
+			     &value_type,
+			     &name_to_id_entry,
+			     &error ) != 1 )
+			{
+				pff_bench_error_fprint(
+				 "Unable to retrieve entry type.",
+				 &error );
+
+				return( -1 );
+			}
+			value_result = libpff_item_get_entry_value(
+			                item,
+			                (int) set_index,
+			                entry_type,
+			                &value_type,
+			                &value_data,
+			                &value_data_size,
+			                LIBPFF_ENTRY_VALUE_FLAG_MATCH_ANY_VALUE_TYPE | LIBPFF_ENTRY_VALUE_FLAG_IGNORE_NAME_TO_ID_MAP,
+			                &error );
+
+			if( value_result == -1 )
+			{
+				pff_bench_error_fprint(
+				 "Unable to retrieve entry value.",
+				 &error );
+
+				return( -1 );
+			}
+			else if( value_result == 1 )
+			{
+				result->number_of_value_bytes += value_data_size;
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the data of all the attachments of a message
+ * Returns 1 if successful or -1 on error
+ */
+int pff_bench_read_attachments(
+     libpff_item_t *message,
+     pff_bench_result_t *result )
+{
+	libpff_error_t *error     = NULL;
+	libpff_item_t *attachment = NULL;
+	size64_t data_size        = 0;
+	size_t read_size          = 0;
+	ssize_t read_count        = 0;
+	int attachment_index      = 0;
+	int attachment_type       = 0;
+	int number_of_attachments = 0;
+
+	if( libpff_message_get_number_of_attachments(
+	     message,
+	     &number_of_attachments,
+	     &error ) != 1 )
+	{
+		pff_bench_error_fprint(
+		 "Unable to retrieve number of attachments.",
+		 &error );
+
+		return( -1 );
+	}
+	for( attachment_index = 0;
+	     attachment_index < number_of_attachments;
+	     attachment_index++ )
+	{
+		if( libpff_message_get_attachment(
+		     message,
+		     attachment_index,
+		     &attachment,
+		     &error ) != 1 )
+		{
+			pff_bench_error_fprint(
+			 "Unable to retrieve attachment.",
+			 &error );
+
+			return( -1 );
+		}
+		if( libpff_attachment_get_type(
+		     attachment,
+		     &attachment_type,
+		     &error ) != 1 )
+		{
+			pff_bench_error_fprint(
+			 "Unable to retrieve attachment type.",
+			 &error );
+
+			libpff_item_free(
+			 &attachment,
+			 NULL );
+
+			return( -1 );
+		}
+		if( attachment_type == LIBPFF_ATTACHMENT_TYPE_DATA )
+		{
+			if( libpff_attachment_get_data_size(
+			     attachment,
+			     &data_size,
+			     &error ) != 1 )
+			{
+				pff_bench_error_fprint(
+				 "Unable to retrieve attachment data size.",
+				 &error );
+
+				libpff_item_free(
+				 &attachment,
+				 NULL );
+
+				return( -1 );
+			}
+			while( data_size > 0 )
+			{
+				read_size = sizeof( pff_bench_buffer );
+
+				if( data_size < (size64_t) read_size )
+				{
+					read_size = (size_t) data_size;
+				}
+				read_count = libpff_attachment_data_read_buffer(
+				              attachment,
+				              pff_bench_buffer,
+				              read_size,
+				              &error );
+
+				if( read_count != (ssize_t) read_size )
+				{
+					pff_bench_error_fprint(
+					 "Unable to read attachment data.",
+					 &error );
+
+					libpff_item_free(
+					 &attachment,
+					 NULL );
+
+					return( -1 );
+				}
+				result->number_of_value_bytes += (uint64_t) read_count;
+
+				data_size -= read_size;
+			}
+		}
+		result->number_of_items += 1;
+
+		if( libpff_item_free(
+		     &attachment,
+		     &error ) != 1 )
+		{
+			pff_bench_error_fprint(
+			 "Unable to free attachment.",
+			 &error );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the values an exporter needs from a message
+ * Returns 1 if successful or -1 on error
+ */
+int pff_bench_export_message(
+     libpff_item_t *message,
+     pff_bench_result_t *result )
+{
+	libpff_error_t *error = NULL;
+	uint8_t *body         = NULL;
+	size_t body_size      = 0;
+	int value_result      = 0;
+
+	value_result = libpff_message_get_utf8_subject(
+	                message,
+	                pff_bench_buffer,
+	                sizeof( pff_bench_buffer ),
+	                &error );
+
+	if( value_result == -1 )
+	{
+		pff_bench_error_fprint(
+		 "Unable to retrieve subject.",
+		 &error );
+
+		return( -1 );
+	}
+	value_result = libpff_message_get_plain_text_body_size(
+	                message,
+	                &body_size,
+	                &error );
+
+	if( value_result == -1 )
+	{
+		pff_bench_error_fprint(
+		 "Unable to retrieve plain text body size.",
+		 &error );
+
+		return( -1 );
+	}
+	else if( ( value_result == 1 )
+	      && ( body_size > 0 ) )
+	{
+		body = (uint8_t *) malloc(
+		                    body_size );
+
+		if( body == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create plain text body.\n" );
+
+			return( -1 );
+		}
+		if( libpff_message_get_plain_text_body(
+		     message,
+		     body,
+		     body_size,
+		     &error ) != 1 )
+		{
+			pff_bench_error_fprint(
+			 "Unable to retrieve plain text body.",
+			 &error );
+
+			free(
+			 body );
+
+			return( -1 );
+		}
+		result->number_of_value_bytes += body_size;
+
+		free(
+		 body );
+	}
+	return( pff_bench_read_attachments(
+	         message,
+	         result ) );
+}
+
+/* Walks an item and its sub items
+ * Returns 1 if successful or -1 on error
+ */
+int pff_bench_walk_item(
+     libpff_item_t *item,
+     int phase,
+     pff_bench_result_t *result )
+{
+	libpff_error_t *error   = NULL;
+	libpff_item_t *sub_item = NULL;
+	uint8_t item_type       = 0;
+	int number_of_sub_items = 0;
+	int sub_item_index      = 0;
+
+	if( libpff_item_get_type(
+	     item,
+	     &item_type,
+	     &error ) != 1 )
+	{
+		pff_bench_error_fprint(
+		 "Unable to retrieve item type.",
+		 &error );
+
+		return( -1 );
+	}
+	result->number_of_items += 1;
+
+	if( phase == PFF_BENCH_PHASE_PROPERTIES )
+	{
+		if( pff_bench_read_item_values(
+		     item,
+		     result ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	else if( ( phase == PFF_BENCH_PHASE_ATTACHMENTS )
+	      && ( item_type == LIBPFF_ITEM_TYPE_EMAIL ) )
+	{
+		if( pff_bench_read_attachments(
+		     item,
+		     result ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	else if( ( phase == PFF_BENCH_PHASE_EXPORT )
+	      && ( item_type == LIBPFF_ITEM_TYPE_EMAIL ) )
+	{
+		if( pff_bench_export_message(
+		     item,
+		     result ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	if( libpff_item_get_number_of_sub_items(
+	     item,
+	     &number_of_sub_items,
+	     &error ) != 1 )
+	{
+		pff_bench_error_fprint(
+		 "Unable to retrieve number of sub items.",
+		 &error );
+
+		return( -1 );
+	}
+	for( sub_item_index = 0;
+	     sub_item_index < number_of_sub_items;
+	     sub_item_index++ )
+	{
+		if( libpff_item_get_sub_item(
+		     item,
+		     sub_item_index,
+		     &sub_item,
+		     &error ) != 1 )
+		{
+			pff_bench_error_fprint(
+			 "Unable to retrieve sub item.",
+			 &error );
+
+			return( -1 );
+		}
+		if( pff_bench_walk_item(
+		     sub_item,
+		     phase,
+		     result ) != 1 )
+		{
+			libpff_item_free(
+			 &sub_item,
+			 NULL );
+
+			return( -1 );
+		}
+		if( libpff_item_free(
+		     &sub_item,
+		     &error ) != 1 )
+		{
+			pff_bench_error_fprint(
+			 "Unable to free sub item.",
+			 &error );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Runs a benchmark phase
+ * Returns 1 if successful or -1 on error
+ */
+int pff_bench_run_phase(
+     const char *filename,
+     int phase,
+     pff_bench_result_t *result )
+{
+	libpff_error_t *error         = NULL;
+	libpff_file_t *file           = NULL;
+	libpff_item_t *root_folder    = NULL;
+	uint64_t start_time           = 0;
+	int number_of_recovered_items = 0;
+	int phase_result              = 1;
+
+	memory_set(
+	 result,
+	 0,
+	 sizeof( pff_bench_result_t ) );
+
+	if( libpff_file_initialize(
+	     &file,
+	     &error ) != 1 )
+	{
+		pff_bench_error_fprint(
+		 "Unable to create file.",
+		 &error );
+
+		return( -1 );
+	}
+	start_time = pff_bench_get_time();
+
+	if( libpff_file_open(
+	     file,
+	     filename,
+	     LIBPFF_OPEN_READ,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %s.\n",
+		 filename );
+
+		pff_bench_error_fprint(
+		 "",
+		 &error );
+
+		libpff_file_free(
+		 &file,
+		 NULL );
+
+		return( -1 );
+	}
+	if( phase == PFF_BENCH_PHASE_OPEN )
+	{
+		result->number_of_items = 1;
+	}
+	else if( phase == PFF_BENCH_PHASE_RECOVER )
+	{
+		if( libpff_file_recover_items(
+		     file,
+		     0,
+		     &error ) != 1 )
+		{
+			pff_bench_error_fprint(
+			 "Unable to recover items.",
+			 &error );
+
+			phase_result = -1;
+		}
+		else if( libpff_file_get_number_of_recovered_items(
+		          file,
+		          &number_of_recovered_items,
+		          &error ) != 1 )
+		{
+			pff_bench_error_fprint(
+			 "Unable to retrieve number of recovered items.",
+			 &error );
+
+			phase_result = -1;
+		}
+		result->number_of_items = (uint64_t) number_of_recovered_items;
+	}
+	else
+	{
+		if( libpff_file_get_root_folder(
+		     file,
+		     &root_folder,
+		     &error ) != 1 )
+		{
+			pff_bench_error_fprint(
+			 "Unable to retrieve root folder.",
+			 &error );
+
+			phase_result = -1;
+		}
+		else
+		{
+			phase_result = pff_bench_walk_item(
+			                root_folder,
+			                phase,
+			                result );
+
+			libpff_item_free(
+			 &root_folder,
+			 NULL );
+		}
+	}
+	result->elapsed_time = pff_bench_get_time() - start_time;
+
+	if( libpff_file_get_statistics(
+	     file,
+	     LIBPFF_STATISTIC_NUMBER_OF_BYTES_READ,
+	     &( result->number_of_bytes_read ),
+	     &error ) != 1 )
+	{
+		pff_bench_error_fprint(
+		 "Unable to retrieve number of bytes read.",
+		 &error );
+
+		phase_result = -1;
+	}
+	if( libpff_file_close(
+	     file,
+	     &error ) != 0 )
+	{
+		pff_bench_error_fprint(
+		 "Unable to close file.",
+		 &error );
+
+		phase_result = -1;
+	}
+	if( libpff_file_free(
+	     &file,
+	     &error ) != 1 )
+	{
+		pff_bench_error_fprint(
+		 "Unable to free file.",
+		 &error );
+
+		phase_result = -1;
+	}
+	return( phase_result );
+}
+
+/* Runs a benchmark phase in a separate process if supported
+ * Returns 1 if successful or -1 on error
+ */
+int pff_bench_run_phase_process(
+     const char *filename,
+     int phase,
+     pff_bench_result_t *result )
+{
+#if defined( PFF_BENCH_HAVE_PHASE_PROCESSES )
+	struct rusage resource_usage;
+
+	int pipe_descriptors[ 2 ];
+
+	pid_t process_identifier = 0;
+	ssize_t read_count       = 0;
+	int status               = 0;
+
+	if( pipe(
+	     pipe_descriptors ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create pipe.\n" );
+
+		return( -1 );
+	}
+	fflush(
+	 stdout );
+
+	process_identifier = fork();
+
+	if( process_identifier == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create process.\n" );
+
+		close(
+		 pipe_descriptors[ 0 ] );
+		close(
+		 pipe_descriptors[ 1 ] );
+
+		return( -1 );
+	}
+	else if( process_identifier == 0 )
+	{
+		close(
+		 pipe_descriptors[ 0 ] );
+
+		if( pff_bench_run_phase(
+		     filename,
+		     phase,
+		     result ) != 1 )
+		{
+			_exit( EXIT_FAILURE );
+		}
+		if( write(
+		     pipe_descriptors[ 1 ],
+		     result,
+		     sizeof( pff_bench_result_t ) ) != (ssize_t) sizeof( pff_bench_result_t ) )
+		{
+			_exit( EXIT_FAILURE );
+		}
+		_exit( EXIT_SUCCESS );
+	}
+	close(
+	 pipe_descriptors[ 1 ] );
+
+	read_count = read(
+	              pipe_descriptors[ 0 ],
+	              result,
+	              sizeof( pff_bench_result_t ) );
+
+	close(
+	 pipe_descriptors[ 0 ] );
+
+	if( wait4(
+	     process_identifier,
+	     &status,
+	     0,
+	     &resource_usage ) != process_identifier )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to wait for process.\n" );
+
+		return( -1 );
+	}
+	if( ( WIFEXITED( status ) == 0 )
+	 || ( WEXITSTATUS( status ) != EXIT_SUCCESS )
+	 || ( read_count != (ssize_t) sizeof( pff_bench_result_t ) ) )
+	{
+		return( -1 );
+	}
+	/* On Linux the maximum resident set size is in KiB
+	 */
+	result->peak_resident_set_size = (uint64_t) resource_usage.ru_maxrss;
+
+	return( 1 );
+#else
+	return( pff_bench_run_phase(
+	         filename,
+	         phase,
+	         result ) );
+#endif
+}
+
+/* Prints the result of a benchmark phase
+ */
+void pff_bench_result_fprint(
+      FILE *stream,
+      int phase,
+      pff_bench_result_t *result,
+      size64_t file_size )
+{
+	double elapsed_seconds    = 0.0;
+	double file_throughput    = 0.0;
+	double read_throughput    = 0.0;
+	double value_throughput   = 0.0;
+
+	elapsed_seconds = (double) result->elapsed_time / 1000000.0;
+
+	if( result->elapsed_time > 0 )
+	{
+		file_throughput  = ( (double) file_size / ( 1024.0 * 1024.0 ) ) / elapsed_seconds;
+		read_throughput  = ( (double) result->number_of_bytes_read / ( 1024.0 * 1024.0 ) ) / elapsed_seconds;
+		value_throughput = ( (double) result->number_of_value_bytes / ( 1024.0 * 1024.0 ) ) / elapsed_seconds;
+	}
+	fprintf(
+	 stream,
+	 "%-12s %10.3f %10" PRIu64 " %12.1f %12.1f %12.1f",
+	 pff_bench_phase_names[ phase ],
+	 elapsed_seconds,
+	 result->number_of_items,
+	 file_throughput,
+	 read_throughput,
+	 value_throughput );
+
+#if defined( PFF_BENCH_HAVE_PHASE_PROCESSES )
+	fprintf(
+	 stream,
+	 " %12" PRIu64 "\n",
+	 result->peak_resident_set_size );
+#else
+	fprintf(
+	 stream,
+	 " %12s\n",
+	 "n/a" );
+#endif
+}
+
+/* Parses the comma separated phases
+ * Returns 1 if successful or -1 on error
+ */
+int pff_bench_parse_phases(
+     const char *string,
+     int *phases )
+{
+	const char *segment_end = NULL;
+	size_t segment_length   = 0;
+	int phase               = 0;
+
+	for( phase = 0;
+	     phase < PFF_BENCH_NUMBER_OF_PHASES;
+	     phase++ )
+	{
+		phases[ phase ] = 0;
+	}
+	while( *string != 0 )
+	{
+		segment_end = strchr(
+		               string,
+		               ',' );
+
+		if( segment_end == NULL )
+		{
+			segment_length = strlen(
+			                  string );
+		}
+		else
+		{
+			segment_length = (size_t) ( segment_end - string );
+		}
+		for( phase = 0;
+		     phase < PFF_BENCH_NUMBER_OF_PHASES;
+		     phase++ )
+		{
+			if( ( strlen( pff_bench_phase_names[ phase ] ) == segment_length )
+			 && ( strncmp( pff_bench_phase_names[ phase ], string, segment_length ) == 0 ) )
+			{
+				phases[ phase ] = 1;
+
+				break;
+			}
+		}
+		if( phase >= PFF_BENCH_NUMBER_OF_PHASES )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported phase: %.*s.\n",
+			 (int) segment_length,
+			 string );
+
+			return( -1 );
+		}
+		string += segment_length;
+
+		if( *string == ',' )
+		{
+			string++;
+		}
+	}
+	return( 1 );
+}
+
+/* The main program
+ */
+int main( int argc, char * const argv[] )
+{
+	pff_bench_result_t best_result;
+	pff_bench_result_t result;
+
+	libpff_error_t *error      = NULL;
+	libpff_file_t *file        = NULL;
+	const char *source         = NULL;
+	size64_t file_size         = 0;
+	int phases[ PFF_BENCH_NUMBER_OF_PHASES ];
+	int iteration              = 0;
+	int number_of_iterations   = 1;
+	int option                 = 0;
+	int phase                  = 0;
+
+	for( phase = 0;
+	     phase < PFF_BENCH_NUMBER_OF_PHASES;
+	     phase++ )
+	{
+		phases[ phase ] = 1;
+	}
+	while( ( option = getopt(
+	                   argc,
+	                   argv,
+	                   "hi:p:" ) ) != -1 )
+	{
+		switch( option )
+		{
+			case 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case 'i':
+				number_of_iterations = atoi( optarg );
+
+				if( number_of_iterations < 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Invalid number of iterations.\n" );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case 'p':
+				if( pff_bench_parse_phases(
+				     optarg,
+				     phases ) != 1 )
+				{
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			default:
+				usage_fprint(
+				 stderr );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stderr );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	if( libpff_file_initialize(
+	     &file,
+	     &error ) != 1 )
+	{
+		pff_bench_error_fprint(
+		 "Unable to create file.",
+		 &error );
+
+		return( EXIT_FAILURE );
+	}
+	if( libpff_file_open(
+	     file,
+	     source,
+	     LIBPFF_OPEN_READ,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %s.\n",
+		 source );
+
+		pff_bench_error_fprint(
+		 "",
+		 &error );
+
+		libpff_file_free(
+		 &file,
+		 NULL );
+
+		return( EXIT_FAILURE );
+	}
+	if( libpff_file_get_size(
+	     file,
+	     &file_size,
+	     &error ) != 1 )
+	{
+		pff_bench_error_fprint(
+		 "Unable to retrieve file size.",
+		 &error );
+
+		libpff_file_free(
+		 &file,
+		 NULL );
+
+		return( EXIT_FAILURE );
+	}
+	libpff_file_close(
+	 file,
+	 NULL );
+	libpff_file_free(
+	 &file,
+	 NULL );
+
+	fprintf(
+	 stdout,
+	 "Benchmarking: %s (%" PRIu64 " bytes)\n\n",
+	 source,
+	 file_size );
+
+	fprintf(
+	 stdout,
+	 "%-12s %10s %10s %12s %12s %12s %12s\n",
+	 "phase",
+	 "seconds",
+	 "items",
+	 "file MiB/s",
+	 "read MiB/s",
+	 "value MiB/s",
+	 "peak RSS KiB" );
+
+	for( phase = 0;
+	     phase < PFF_BENCH_NUMBER_OF_PHASES;
+	     phase++ )
+	{
+		if( phases[ phase ] == 0 )
+		{
+			continue;
+		}
+		for( iteration = 0;
+		     iteration < number_of_iterations;
+		     iteration++ )
+		{
+			if( pff_bench_run_phase_process(
+			     source,
+			     phase,
+			     &result ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to run phase: %s.\n",
+				 pff_bench_phase_names[ phase ] );
+
+				return( EXIT_FAILURE );
+			}
+			if( ( iteration == 0 )
+			 || ( result.elapsed_time < best_result.elapsed_time ) )
+			{
+				memory_copy(
+				 &best_result,
+				 &result,
+				 sizeof( pff_bench_result_t ) );
+			}
+		}
+		pff_bench_result_fprint(
+		 stdout,
+		 phase,
+		 &best_result,
+		 file_size );
+	}
+	return( EXIT_SUCCESS );
+}
+
@@ -0,0 +1,5720 @@
+/*
+ * Generates synthetic Personal Folder Files (OST and PST) for benchmarking
+ *
+ * Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include <stdio.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_STRING_H ) || defined( WINAPI )
+#include <string.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "pff_allocation_table.h"
+#include "pff_array.h"
+#include "pff_block.h"
+#include "pff_file_header.h"
+#include "pff_index_node.h"
+#include "pff_local_descriptor_node.h"
+#include "pff_table.h"
+
+#define PFF_GENERATE_FILE_TYPE_32BIT			32
+#define PFF_GENERATE_FILE_TYPE_64BIT			64
+
+#define PFF_GENERATE_ENCRYPTION_TYPE_NONE		0
+#define PFF_GENERATE_ENCRYPTION_TYPE_COMPRESSIBLE	1
+#define PFF_GENERATE_ENCRYPTION_TYPE_HIGH		2
+
+#define PFF_GENERATE_INDEX_TYPE_OFFSET			0x80
+#define PFF_GENERATE_INDEX_TYPE_DESCRIPTOR		0x81
+
+#define PFF_GENERATE_ALLOCATION_TABLE_TYPE_PAGE		0x83
+#define PFF_GENERATE_ALLOCATION_TABLE_TYPE_DATA		0x84
+
+/* The first data allocation table and the amount of data it covers
+ */
+#define PFF_GENERATE_ALLOCATION_TABLE_OFFSET		0x4400
+#define PFF_GENERATE_DATA_ALLOCATION_TABLE_COVERAGE	( 496 * 8 * 64 )
+#define PFF_GENERATE_PAGE_ALLOCATION_TABLE_INTERVAL	8
+
+#define PFF_GENERATE_MAXIMUM_BLOCK_DATA_SIZE		8176
+#define PFF_GENERATE_MAXIMUM_HEAP_ALLOCATION_SIZE	3580
+#define PFF_GENERATE_MAXIMUM_HEAP_ALLOCATIONS		2047
+#define PFF_GENERATE_MAXIMUM_NUMBER_OF_ATTACHMENTS	128
+#define PFF_GENERATE_MAXIMUM_NUMBER_OF_NAMED_PROPERTIES	256
+
+#define PFF_GENERATE_OFFSET_INDEX_FLAG_INTERNAL		0x00000002UL
+
+#define PFF_GENERATE_NODE_TYPE_INTERNAL			0x01
+#define PFF_GENERATE_NODE_TYPE_FOLDER			0x02
+#define PFF_GENERATE_NODE_TYPE_MESSAGE			0x04
+#define PFF_GENERATE_NODE_TYPE_ATTACHMENT		0x05
+#define PFF_GENERATE_NODE_TYPE_SUB_FOLDERS		0x0d
+#define PFF_GENERATE_NODE_TYPE_SUB_MESSAGES		0x0e
+#define PFF_GENERATE_NODE_TYPE_SUB_ASSOCIATED_CONTENTS	0x0f
+#define PFF_GENERATE_NODE_TYPE_LOCAL_DESCRIPTOR_VALUE	0x1f
+
+#define PFF_GENERATE_DESCRIPTOR_MESSAGE_STORE		0x0021
+#define PFF_GENERATE_DESCRIPTOR_NAME_TO_ID_MAP		0x0061
+#define PFF_GENERATE_DESCRIPTOR_ROOT_FOLDER		0x0122
+#define PFF_GENERATE_DESCRIPTOR_ATTACHMENTS		0x0671
+
+/* The first descriptor index used for generated folders and messages
+ */
+#define PFF_GENERATE_FIRST_DESCRIPTOR_INDEX		0x0800
+
+#define PFF_GENERATE_VALUE_TYPE_INTEGER_32BIT_SIGNED	0x0003
+#define PFF_GENERATE_VALUE_TYPE_BOOLEAN			0x000b
+#define PFF_GENERATE_VALUE_TYPE_STRING_UNICODE		0x001f
+#define PFF_GENERATE_VALUE_TYPE_FILETIME		0x0040
+#define PFF_GENERATE_VALUE_TYPE_BINARY_DATA		0x0102
+
+/* The Windows FILETIME of 2012-01-01 00:00:00 UTC
+ */
+#define PFF_GENERATE_BASE_FILETIME			0x01ccc81e0b0e0000ULL
+
+typedef struct pff_generate_options pff_generate_options_t;
+
+struct pff_generate_options
+{
+	/* The file type, either 32 or 64
+	 */
+	int file_type;
+
+	/* The content type
+	 */
+	uint16_t content_type;
+
+	/* The encryption type
+	 */
+	uint8_t encryption_type;
+
+	/* The number of folders
+	 */
+	int number_of_folders;
+
+	/* The number of messages per folder
+	 */
+	int number_of_messages;
+
+	/* The number of attachments per message
+	 */
+	int number_of_attachments;
+
+	/* The attachment data size
+	 */
+	size_t attachment_size;
+
+	/* The number of characters in the message body
+	 */
+	size_t body_size;
+
+	/* Value to indicate HTML and compressed RTF bodies are written
+	 */
+	int formatted_bodies;
+
+	/* The number of named properties
+	 */
+	int number_of_named_properties;
+
+	/* The percentage of messages that is deleted
+	 */
+	int deleted_percentage;
+
+	/* The number of blocks that are shuffled before they are placed
+	 */
+	int fragmentation_window;
+
+	/* The seed of the pseudo random generator
+	 */
+	uint32_t seed;
+
+	/* The approximate target file size in bytes
+	 */
+	uint64_t target_size;
+};
+
+typedef struct pff_generate_offset_entry pff_generate_offset_entry_t;
+
+struct pff_generate_offset_entry
+{
+	uint64_t identifier;
+	uint64_t file_offset;
+	uint16_t data_size;
+	uint8_t is_deleted;
+};
+
+typedef struct pff_generate_descriptor_entry pff_generate_descriptor_entry_t;
+
+struct pff_generate_descriptor_entry
+{
+	uint32_t identifier;
+	uint64_t data_identifier;
+	uint64_t local_descriptors_identifier;
+	uint32_t parent_identifier;
+	uint8_t is_deleted;
+};
+
+typedef struct pff_generate_pending_block pff_generate_pending_block_t;
+
+struct pff_generate_pending_block
+{
+	uint64_t identifier;
+	uint8_t *data;
+	size_t data_size;
+	uint8_t is_deleted;
+};
+
+typedef struct pff_generate_file pff_generate_file_t;
+
+struct pff_generate_file
+{
+	/* The output stream
+	 */
+	FILE *stream;
+
+	/* The options
+	 */
+	pff_generate_options_t *options;
+
+	/* The size of an identifier or offset, either 4 or 8
+	 */
+	size_t value_size;
+
+	/* The next block identifier
+	 */
+	uint64_t next_block_identifier;
+
+	/* The next descriptor index
+	 */
+	uint32_t next_descriptor_index;
+
+	/* The offset of the next allocation
+	 */
+	uint64_t current_offset;
+
+	/* The offset index entries
+	 */
+	pff_generate_offset_entry_t *offset_entries;
+	size_t number_of_offset_entries;
+	size_t maximum_number_of_offset_entries;
+
+	/* The descriptor index entries
+	 */
+	pff_generate_descriptor_entry_t *descriptor_entries;
+	size_t number_of_descriptor_entries;
+	size_t maximum_number_of_descriptor_entries;
+
+	/* The blocks that are waiting to be placed
+	 */
+	pff_generate_pending_block_t *pending_blocks;
+	int number_of_pending_blocks;
+
+	/* The allocation bitmap, one bit per 64 bytes
+	 */
+	uint8_t *allocation_bitmap;
+	size_t allocation_bitmap_size;
+
+	/* The highest descriptor index per node type
+	 */
+	uint32_t high_water_marks[ 32 ];
+
+	/* The state of the pseudo random generator
+	 */
+	uint32_t random_state;
+
+	/* Value to indicate the item currently being written is deleted
+	 */
+	uint8_t is_deleting;
+
+	/* Statistics
+	 */
+	uint64_t number_of_folders;
+	uint64_t number_of_messages;
+	uint64_t number_of_deleted_messages;
+	uint64_t number_of_attachments;
+};
+
+typedef struct pff_generate_local_descriptors pff_generate_local_descriptors_t;
+
+struct pff_generate_local_descriptors
+{
+	uint64_t identifier[ PFF_GENERATE_MAXIMUM_NUMBER_OF_ATTACHMENTS + 8 ];
+	uint64_t data_identifier[ PFF_GENERATE_MAXIMUM_NUMBER_OF_ATTACHMENTS + 8 ];
+	uint64_t local_descriptors_identifier[ PFF_GENERATE_MAXIMUM_NUMBER_OF_ATTACHMENTS + 8 ];
+	int number_of_entries;
+	uint32_t next_value_index;
+};
+
+typedef struct pff_generate_heap pff_generate_heap_t;
+
+struct pff_generate_heap
+{
+	/* The heap blocks
+	 */
+	uint8_t **blocks;
+	int number_of_blocks;
+	int maximum_number_of_blocks;
+
+	/* The allocation offsets of the current block
+	 */
+	uint16_t allocation_offsets[ PFF_GENERATE_MAXIMUM_HEAP_ALLOCATIONS + 1 ];
+	int number_of_allocations;
+
+	/* The used size of the current block
+	 */
+	size_t used_size;
+
+	/* The client signature
+	 */
+	uint8_t client_signature;
+};
+
+typedef struct pff_generate_property_context pff_generate_property_context_t;
+
+struct pff_generate_property_context
+{
+	pff_generate_heap_t heap;
+
+	/* The record entries, 8 bytes each
+	 */
+	uint8_t records[ ( 64 + PFF_GENERATE_MAXIMUM_NUMBER_OF_NAMED_PROPERTIES ) * 8 ];
+	int number_of_records;
+};
+
+typedef struct pff_generate_column pff_generate_column_t;
+
+struct pff_generate_column
+{
+	uint16_t entry_type;
+	uint16_t value_type;
+	uint8_t size;
+	uint16_t offset;
+};
+
+typedef struct pff_generate_table_context pff_generate_table_context_t;
+
+struct pff_generate_table_context
+{
+	pff_generate_heap_t heap;
+
+	/* The column definitions, the first column must be the row identifier
+	 */
+	pff_generate_column_t columns[ 16 ];
+	int number_of_columns;
+
+	/* The end offsets of the 4 and 8, 2 and 1 byte values and the cell existence block
+	 */
+	uint16_t end_offsets[ 4 ];
+
+	/* The rows data
+	 */
+	uint8_t *rows;
+	size_t number_of_rows;
+	size_t maximum_number_of_rows;
+};
+
+static uint32_t pff_generate_crc32_table[ 256 ];
+
+static uint8_t pff_generate_encryption_compressible[ 256 ];
+static uint8_t pff_generate_encryption_high1[ 256 ];
+static uint8_t pff_generate_encryption_high2[ 256 ];
+
+/* The decryption tables as used by libpff, the encryption tables are their inverse
+ */
+static const uint8_t pff_generate_decryption_compressible[ 256 ] = {
+	0x47, 0xf1, 0xb4, 0xe6, 0x0b, 0x6a, 0x72, 0x48, 0x85, 0x4e, 0x9e, 0xeb, 0xe2, 0xf8, 0x94, 0x53,
+	0xe0, 0xbb, 0xa0, 0x02, 0xe8, 0x5a, 0x09, 0xab, 0xdb, 0xe3, 0xba, 0xc6, 0x7c, 0xc3, 0x10, 0xdd,
+	0x39, 0x05, 0x96, 0x30, 0xf5, 0x37, 0x60, 0x82, 0x8c, 0xc9, 0x13, 0x4a, 0x6b, 0x1d, 0xf3, 0xfb,
+	0x8f, 0x26, 0x97, 0xca, 0x91, 0x17, 0x01, 0xc4, 0x32, 0x2d, 0x6e, 0x31, 0x95, 0xff, 0xd9, 0x23,
+	0xd1, 0x00, 0x5e, 0x79, 0xdc, 0x44, 0x3b, 0x1a, 0x28, 0xc5, 0x61, 0x57, 0x20, 0x90, 0x3d, 0x83,
+	0xb9, 0x43, 0xbe, 0x67, 0xd2, 0x46, 0x42, 0x76, 0xc0, 0x6d, 0x5b, 0x7e, 0xb2, 0x0f, 0x16, 0x29,
+	0x3c, 0xa9, 0x03, 0x54, 0x0d, 0xda, 0x5d, 0xdf, 0xf6, 0xb7, 0xc7, 0x62, 0xcd, 0x8d, 0x06, 0xd3,
+	0x69, 0x5c, 0x86, 0xd6, 0x14, 0xf7, 0xa5, 0x66, 0x75, 0xac, 0xb1, 0xe9, 0x45, 0x21, 0x70, 0x0c,
+	0x87, 0x9f, 0x74, 0xa4, 0x22, 0x4c, 0x6f, 0xbf, 0x1f, 0x56, 0xaa, 0x2e, 0xb3, 0x78, 0x33, 0x50,
+	0xb0, 0xa3, 0x92, 0xbc, 0xcf, 0x19, 0x1c, 0xa7, 0x63, 0xcb, 0x1e, 0x4d, 0x3e, 0x4b, 0x1b, 0x9b,
+	0x4f, 0xe7, 0xf0, 0xee, 0xad, 0x3a, 0xb5, 0x59, 0x04, 0xea, 0x40, 0x55, 0x25, 0x51, 0xe5, 0x7a,
+	0x89, 0x38, 0x68, 0x52, 0x7b, 0xfc, 0x27, 0xae, 0xd7, 0xbd, 0xfa, 0x07, 0xf4, 0xcc, 0x8e, 0x5f,
+	0xef, 0x35, 0x9c, 0x84, 0x2b, 0x15, 0xd5, 0x77, 0x34, 0x49, 0xb6, 0x12, 0x0a, 0x7f, 0x71, 0x88,
+	0xfd, 0x9d, 0x18, 0x41, 0x7d, 0x93, 0xd8, 0x58, 0x2c, 0xce, 0xfe, 0x24, 0xaf, 0xde, 0xb8, 0x36,
+	0xc8, 0xa1, 0x80, 0xa6, 0x99, 0x98, 0xa8, 0x2f, 0x0e, 0x81, 0x65, 0x73, 0xe4, 0xc2, 0xa2, 0x8a,
+	0xd4, 0xe1, 0x11, 0xd0, 0x08, 0x8b, 0x2a, 0xf2, 0xed, 0x9a, 0x64, 0x3f, 0xc1, 0x6c, 0xf9, 0xec
+};
+
+static const uint8_t pff_generate_decryption_high1[ 256 ] = {
+	0x41, 0x36, 0x13, 0x62, 0xa8, 0x21, 0x6e, 0xbb, 0xf4, 0x16, 0xcc, 0x04, 0x7f, 0x64, 0xe8, 0x5d,
+	0x1e, 0xf2, 0xcb, 0x2a, 0x74, 0xc5, 0x5e, 0x35, 0xd2, 0x95, 0x47, 0x9e, 0x96, 0x2d, 0x9a, 0x88,
+	0x4c, 0x7d, 0x84, 0x3f, 0xdb, 0xac, 0x31, 0xb6, 0x48, 0x5f, 0xf6, 0xc4, 0xd8, 0x39, 0x8b, 0xe7,
+	0x23, 0x3b, 0x38, 0x8e, 0xc8, 0xc1, 0xdf, 0x25, 0xb1, 0x20, 0xa5, 0x46, 0x60, 0x4e, 0x9c, 0xfb,
+	0xaa, 0xd3, 0x56, 0x51, 0x45, 0x7c, 0x55, 0x00, 0x07, 0xc9, 0x2b, 0x9d, 0x85, 0x9b, 0x09, 0xa0,
+	0x8f, 0xad, 0xb3, 0x0f, 0x63, 0xab, 0x89, 0x4b, 0xd7, 0xa7, 0x15, 0x5a, 0x71, 0x66, 0x42, 0xbf,
+	0x26, 0x4a, 0x6b, 0x98, 0xfa, 0xea, 0x77, 0x53, 0xb2, 0x70, 0x05, 0x2c, 0xfd, 0x59, 0x3a, 0x86,
+	0x7e, 0xce, 0x06, 0xeb, 0x82, 0x78, 0x57, 0xc7, 0x8d, 0x43, 0xaf, 0xb4, 0x1c, 0xd4, 0x5b, 0xcd,
+	0xe2, 0xe9, 0x27, 0x4f, 0xc3, 0x08, 0x72, 0x80, 0xcf, 0xb0, 0xef, 0xf5, 0x28, 0x6d, 0xbe, 0x30,
+	0x4d, 0x34, 0x92, 0xd5, 0x0e, 0x3c, 0x22, 0x32, 0xe5, 0xe4, 0xf9, 0x9f, 0xc2, 0xd1, 0x0a, 0x81,
+	0x12, 0xe1, 0xee, 0x91, 0x83, 0x76, 0xe3, 0x97, 0xe6, 0x61, 0x8a, 0x17, 0x79, 0xa4, 0xb7, 0xdc,
+	0x90, 0x7a, 0x5c, 0x8c, 0x02, 0xa6, 0xca, 0x69, 0xde, 0x50, 0x1a, 0x11, 0x93, 0xb9, 0x52, 0x87,
+	0x58, 0xfc, 0xed, 0x1d, 0x37, 0x49, 0x1b, 0x6a, 0xe0, 0x29, 0x33, 0x99, 0xbd, 0x6c, 0xd9, 0x94,
+	0xf3, 0x40, 0x54, 0x6f, 0xf0, 0xc6, 0x73, 0xb8, 0xd6, 0x3e, 0x65, 0x18, 0x44, 0x1f, 0xdd, 0x67,
+	0x10, 0xf1, 0x0c, 0x19, 0xec, 0xae, 0x03, 0xa1, 0x14, 0x7b, 0xa9, 0x0b, 0xff, 0xf8, 0xa3, 0xc0,
+	0xa2, 0x01, 0xf7, 0x2e, 0xbc, 0x24, 0x68, 0x75, 0x0d, 0xfe, 0xba, 0x2f, 0xb5, 0xd0, 0xda, 0x3d
+};
+
+static const uint8_t pff_generate_decryption_high2[ 256 ] = {
+	0x14, 0x53, 0x0f, 0x56, 0xb3, 0xc8, 0x7a, 0x9c, 0xeb, 0x65, 0x48, 0x17, 0x16, 0x15, 0x9f, 0x02,
+	0xcc, 0x54, 0x7c, 0x83, 0x00, 0x0d, 0x0c, 0x0b, 0xa2, 0x62, 0xa8, 0x76, 0xdb, 0xd9, 0xed, 0xc7,
+	0xc5, 0xa4, 0xdc, 0xac, 0x85, 0x74, 0xd6, 0xd0, 0xa7, 0x9b, 0xae, 0x9a, 0x96, 0x71, 0x66, 0xc3,
+	0x63, 0x99, 0xb8, 0xdd, 0x73, 0x92, 0x8e, 0x84, 0x7d, 0xa5, 0x5e, 0xd1, 0x5d, 0x93, 0xb1, 0x57,
+	0x51, 0x50, 0x80, 0x89, 0x52, 0x94, 0x4f, 0x4e, 0x0a, 0x6b, 0xbc, 0x8d, 0x7f, 0x6e, 0x47, 0x46,
+	0x41, 0x40, 0x44, 0x01, 0x11, 0xcb, 0x03, 0x3f, 0xf7, 0xf4, 0xe1, 0xa9, 0x8f, 0x3c, 0x3a, 0xf9,
+	0xfb, 0xf0, 0x19, 0x30, 0x82, 0x09, 0x2e, 0xc9, 0x9d, 0xa0, 0x86, 0x49, 0xee, 0x6f, 0x4d, 0x6d,
+	0xc4, 0x2d, 0x81, 0x34, 0x25, 0x87, 0x1b, 0x88, 0xaa, 0xfc, 0x06, 0xa1, 0x12, 0x38, 0xfd, 0x4c,
+	0x42, 0x72, 0x64, 0x13, 0x37, 0x24, 0x6a, 0x75, 0x77, 0x43, 0xff, 0xe6, 0xb4, 0x4b, 0x36, 0x5c,
+	0xe4, 0xd8, 0x35, 0x3d, 0x45, 0xb9, 0x2c, 0xec, 0xb7, 0x31, 0x2b, 0x29, 0x07, 0x68, 0xa3, 0x0e,
+	0x69, 0x7b, 0x18, 0x9e, 0x21, 0x39, 0xbe, 0x28, 0x1a, 0x5b, 0x78, 0xf5, 0x23, 0xca, 0x2a, 0xb0,
+	0xaf, 0x3e, 0xfe, 0x04, 0x8c, 0xe7, 0xe5, 0x98, 0x32, 0x95, 0xd3, 0xf6, 0x4a, 0xe8, 0xa6, 0xea,
+	0xe9, 0xf3, 0xd5, 0x2f, 0x70, 0x20, 0xf2, 0x1f, 0x05, 0x67, 0xad, 0x55, 0x10, 0xce, 0xcd, 0xe3,
+	0x27, 0x3b, 0xda, 0xba, 0xd7, 0xc2, 0x26, 0xd4, 0x91, 0x1d, 0xd2, 0x1c, 0x22, 0x33, 0xf8, 0xfa,
+	0xf1, 0x5a, 0xef, 0xcf, 0x90, 0xb6, 0x8b, 0xb5, 0xbd, 0xc0, 0xbf, 0x08, 0x97, 0x1e, 0x6c, 0xe2,
+	0x61, 0xe0, 0xc6, 0xc1, 0x59, 0xab, 0xbb, 0x58, 0xde, 0x5f, 0xdf, 0x60, 0x79, 0x7e, 0xb2, 0x8a
+};
+
+/* The class identifier of the generated numeric named properties
+ */
+static const uint8_t pff_generate_named_property_guid[ 16 ] = {
+	0x70, 0x66, 0x66, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00, 0x01 };
+
+static const char *pff_generate_words[] = {
+	"lorem", "ipsum", "dolor", "sit", "amet", "consectetur", "adipiscing", "elit",
+	"sed", "do", "eiusmod", "tempor", "incididunt", "ut", "labore", "et", "dolore",
+	"magna", "aliqua", "enim", "ad", "minim", "veniam", "quis", "nostrud",
+	"exercitation", "ullamco", "laboris", "nisi", "aliquip", "ex", "ea", "commodo" };
+
+#define PFF_GENERATE_NUMBER_OF_WORDS \
+	( sizeof( pff_generate_words ) / sizeof( const char * ) )
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use pff_generate to create a synthetic Personal Folder File (OST or PST)\n"
+	                 "for benchmarking and testing purposes.\n\n" );
+
+	fprintf( stream, "Usage: pff_generate [ -a number ] [ -A size ] [ -b size ] [ -c type ]\n"
+	                 "                    [ -d percentage ] [ -e type ] [ -f number ]\n"
+	                 "                    [ -F window ] [ -m number ] [ -n number ]\n"
+	                 "                    [ -r seed ] [ -S size ] [ -t type ] [ -Bh ] target\n\n" );
+
+	fprintf( stream, "\ttarget: the target file\n\n" );
+	fprintf( stream, "\t-a:     number of attachments per message (default is 1)\n" );
+	fprintf( stream, "\t-A:     attachment size in bytes (default is 16384)\n" );
+	fprintf( stream, "\t-b:     message body size in characters (default is 2048)\n" );
+	fprintf( stream, "\t-B:     also write a HTML and a LZFu compressed RTF message body\n" );
+	fprintf( stream, "\t-c:     content type, options: ost, pst (default)\n" );
+	fprintf( stream, "\t-d:     percentage of messages that is written as deleted\n"
+	                 "\t        (default is 0)\n" );
+	fprintf( stream, "\t-e:     encryption type, options: none, compressible (default),\n"
+	                 "\t        high\n" );
+	fprintf( stream, "\t-f:     number of folders (default is 4)\n" );
+	fprintf( stream, "\t-F:     fragmentation window, the number of blocks that are\n"
+	                 "\t        shuffled before they are placed (default is 1)\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-m:     number of messages per folder (default is 64)\n" );
+	fprintf( stream, "\t-n:     number of named properties (default is 8)\n" );
+	fprintf( stream, "\t-r:     seed of the pseudo random generator (default is 1)\n" );
+	fprintf( stream, "\t-S:     approximate target size in MiB, overrides -m\n" );
+	fprintf( stream, "\t-t:     file type, options: 32, 64 (default)\n" );
+}
+
+/* Initializes the weak CRC-32 table
+ */
+void pff_generate_crc32_initialize(
+      void )
+{
+	uint32_t crc32         = 0;
+	uint32_t table_index   = 0;
+	uint8_t bit_iterator   = 0;
+
+	for( table_index = 0;
+	     table_index < 256;
+	     table_index++ )
+	{
+		crc32 = table_index;
+
+		for( bit_iterator = 0;
+		     bit_iterator < 8;
+		     bit_iterator++ )
+		{
+			if( ( crc32 & 1 ) != 0 )
+			{
+				crc32 = 0xedb88320UL ^ ( crc32 >> 1 );
+			}
+			else
+			{
+				crc32 >>= 1;
+			}
+		}
+		pff_generate_crc32_table[ table_index ] = crc32;
+	}
+}
+
+/* Calculates the weak CRC-32 of the data
+ * Returns the CRC-32
+ */
+uint32_t pff_generate_crc32_calculate(
+          const uint8_t *data,
+          size_t data_size )
+{
+	uint32_t crc32     = 0;
+	size_t data_offset = 0;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		crc32 = pff_generate_crc32_table[ ( crc32 ^ data[ data_offset ] ) & 0xff ] ^ ( crc32 >> 8 );
+	}
+	return( crc32 );
+}
+
+/* Initializes the encryption tables from the decryption tables
+ */
+void pff_generate_encryption_initialize(
+      void )
+{
+	int table_index = 0;
+
+	for( table_index = 0;
+	     table_index < 256;
+	     table_index++ )
+	{
+		pff_generate_encryption_compressible[ pff_generate_decryption_compressible[ table_index ] ] = (uint8_t) table_index;
+		pff_generate_encryption_high1[ pff_generate_decryption_high1[ table_index ] ]               = (uint8_t) table_index;
+		pff_generate_encryption_high2[ pff_generate_decryption_high2[ table_index ] ]               = (uint8_t) table_index;
+	}
+}
+
+/* Encrypts the data
+ */
+void pff_generate_encrypt(
+      uint8_t encryption_type,
+      uint32_t key,
+      uint8_t *data,
+      size_t data_size )
+{
+	size_t data_offset = 0;
+	uint16_t salt      = 0;
+	uint8_t lower_salt = 0;
+	uint8_t upper_salt = 0;
+	uint8_t value      = 0;
+
+	if( encryption_type == PFF_GENERATE_ENCRYPTION_TYPE_COMPRESSIBLE )
+	{
+		for( data_offset = 0;
+		     data_offset < data_size;
+		     data_offset++ )
+		{
+			data[ data_offset ] = pff_generate_encryption_compressible[ data[ data_offset ] ];
+		}
+	}
+	else if( encryption_type == PFF_GENERATE_ENCRYPTION_TYPE_HIGH )
+	{
+		salt = (uint16_t) ( ( ( key & 0xffff0000UL ) >> 16 ) ^ ( key & 0x0000ffffUL ) );
+
+		for( data_offset = 0;
+		     data_offset < data_size;
+		     data_offset++ )
+		{
+			lower_salt = (uint8_t) ( salt & 0x00ff );
+			upper_salt = (uint8_t) ( ( salt & 0xff00 ) >> 8 );
+
+			/* Reverse the decryption steps
+			 */
+			value  = data[ data_offset ];
+			value += lower_salt;
+			value  = pff_generate_encryption_compressible[ value ];
+			value += upper_salt;
+			value  = pff_generate_encryption_high2[ value ];
+			value -= upper_salt;
+			value  = pff_generate_encryption_high1[ value ];
+			value -= lower_salt;
+
+			data[ data_offset ] = value;
+
+			salt++;
+		}
+	}
+}
+
+/* Retrieves a pseudo random value
+ * Returns the value
+ */
+uint32_t pff_generate_random(
+          pff_generate_file_t *file )
+{
+	uint32_t value = file->random_state;
+
+	value ^= value << 13;
+	value ^= value >> 17;
+	value ^= value << 5;
+
+	file->random_state = value;
+
+	return( value );
+}
+
+/* Computes the signature of a block or page
+ * Returns the signature
+ */
+uint16_t pff_generate_compute_signature(
+          uint64_t file_offset,
+          uint64_t identifier )
+{
+	file_offset ^= identifier;
+
+	return( (uint16_t) ( (uint16_t) ( file_offset >> 16 ) ^ (uint16_t) file_offset ) );
+}
+
+/* Writes data at a specific offset
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_write_at_offset(
+     pff_generate_file_t *file,
+     uint64_t file_offset,
+     const uint8_t *data,
+     size_t data_size )
+{
+	if( fseeko(
+	     file->stream,
+	     (off_t) file_offset,
+	     SEEK_SET ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to seek offset: %" PRIu64 ".\n",
+		 file_offset );
+
+		return( -1 );
+	}
+	if( fwrite(
+	     data,
+	     1,
+	     data_size,
+	     file->stream ) != data_size )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to write data at offset: %" PRIu64 ".\n",
+		 file_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Marks a range as allocated in the allocation bitmap
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_set_allocated(
+     pff_generate_file_t *file,
+     uint64_t file_offset,
+     uint64_t size )
+{
+	uint8_t *reallocation = NULL;
+	uint64_t unit_index   = 0;
+	uint64_t last_unit    = 0;
+	size_t required_size  = 0;
+
+	last_unit     = ( file_offset + size - 1 ) / 64;
+	required_size = (size_t) ( last_unit / 8 ) + 1;
+
+	if( required_size > file->allocation_bitmap_size )
+	{
+		required_size = ( required_size * 2 ) + 4096;
+
+		reallocation = (uint8_t *) realloc(
+		                            file->allocation_bitmap,
+		                            required_size );
+
+		if( reallocation == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to resize allocation bitmap.\n" );
+
+			return( -1 );
+		}
+		memory_set(
+		 &( reallocation[ file->allocation_bitmap_size ] ),
+		 0,
+		 required_size - file->allocation_bitmap_size );
+
+		file->allocation_bitmap      = reallocation;
+		file->allocation_bitmap_size = required_size;
+	}
+	for( unit_index = file_offset / 64;
+	     unit_index <= last_unit;
+	     unit_index++ )
+	{
+		file->allocation_bitmap[ unit_index / 8 ] |= (uint8_t) ( 0x80 >> ( unit_index % 8 ) );
+	}
+	return( 1 );
+}
+
+/* Allocates space in the file, skipping the allocation tables
+ * Returns the offset of the allocated space
+ */
+uint64_t pff_generate_allocate(
+          pff_generate_file_t *file,
+          size_t size,
+          size_t alignment )
+{
+	uint64_t allocation_table_offset = 0;
+	uint64_t allocation_table_index  = 0;
+	uint64_t file_offset             = 0;
+	uint64_t reserved_end_offset     = 0;
+
+	file_offset = file->current_offset;
+
+	while( 1 )
+	{
+		file_offset = ( ( file_offset + alignment - 1 ) / alignment ) * alignment;
+
+		allocation_table_index  = ( file_offset - PFF_GENERATE_ALLOCATION_TABLE_OFFSET ) / PFF_GENERATE_DATA_ALLOCATION_TABLE_COVERAGE;
+		allocation_table_offset = PFF_GENERATE_ALLOCATION_TABLE_OFFSET + ( allocation_table_index * PFF_GENERATE_DATA_ALLOCATION_TABLE_COVERAGE );
+		reserved_end_offset     = allocation_table_offset + 512;
+
+		if( ( allocation_table_index % PFF_GENERATE_PAGE_ALLOCATION_TABLE_INTERVAL ) == 0 )
+		{
+			reserved_end_offset += 512;
+		}
+		if( file_offset < reserved_end_offset )
+		{
+			file_offset = reserved_end_offset;
+
+			continue;
+		}
+		/* Blocks do not cross the area covered by an allocation table
+		 */
+		if( ( file_offset + size ) > ( allocation_table_offset + PFF_GENERATE_DATA_ALLOCATION_TABLE_COVERAGE ) )
+		{
+			file_offset = allocation_table_offset + PFF_GENERATE_DATA_ALLOCATION_TABLE_COVERAGE;
+
+			continue;
+		}
+		break;
+	}
+	file->current_offset = file_offset + size;
+
+	return( file_offset );
+}
+
+/* Appends an offset index entry
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_append_offset_entry(
+     pff_generate_file_t *file,
+     uint64_t identifier,
+     uint64_t file_offset,
+     size_t data_size,
+     uint8_t is_deleted )
+{
+	pff_generate_offset_entry_t *reallocation = NULL;
+	size_t maximum_number_of_entries          = 0;
+
+	if( file->number_of_offset_entries >= file->maximum_number_of_offset_entries )
+	{
+		maximum_number_of_entries = ( file->maximum_number_of_offset_entries * 2 ) + 1024;
+
+		reallocation = (pff_generate_offset_entry_t *) realloc(
+		                                                file->offset_entries,
+		                                                sizeof( pff_generate_offset_entry_t ) * maximum_number_of_entries );
+
+		if( reallocation == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to resize offset index entries.\n" );
+
+			return( -1 );
+		}
+		file->offset_entries                   = reallocation;
+		file->maximum_number_of_offset_entries = maximum_number_of_entries;
+	}
+	file->offset_entries[ file->number_of_offset_entries ].identifier  = identifier;
+	file->offset_entries[ file->number_of_offset_entries ].file_offset = file_offset;
+	file->offset_entries[ file->number_of_offset_entries ].data_size   = (uint16_t) data_size;
+	file->offset_entries[ file->number_of_offset_entries ].is_deleted  = is_deleted;
+
+	file->number_of_offset_entries++;
+
+	return( 1 );
+}
+
+/* Appends a descriptor index entry
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_append_descriptor_entry(
+     pff_generate_file_t *file,
+     uint32_t identifier,
+     uint64_t data_identifier,
+     uint64_t local_descriptors_identifier,
+     uint32_t parent_identifier )
+{
+	pff_generate_descriptor_entry_t *reallocation = NULL;
+	size_t maximum_number_of_entries              = 0;
+	uint32_t descriptor_index                     = 0;
+	uint8_t node_type                             = 0;
+
+	if( file->number_of_descriptor_entries >= file->maximum_number_of_descriptor_entries )
+	{
+		maximum_number_of_entries = ( file->maximum_number_of_descriptor_entries * 2 ) + 1024;
+
+		reallocation = (pff_generate_descriptor_entry_t *) realloc(
+		                                                    file->descriptor_entries,
+		                                                    sizeof( pff_generate_descriptor_entry_t ) * maximum_number_of_entries );
+
+		if( reallocation == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to resize descriptor index entries.\n" );
+
+			return( -1 );
+		}
+		file->descriptor_entries                   = reallocation;
+		file->maximum_number_of_descriptor_entries = maximum_number_of_entries;
+	}
+	file->descriptor_entries[ file->number_of_descriptor_entries ].identifier                   = identifier;
+	file->descriptor_entries[ file->number_of_descriptor_entries ].data_identifier              = data_identifier;
+	file->descriptor_entries[ file->number_of_descriptor_entries ].local_descriptors_identifier = local_descriptors_identifier;
+	file->descriptor_entries[ file->number_of_descriptor_entries ].parent_identifier            = parent_identifier;
+	file->descriptor_entries[ file->number_of_descriptor_entries ].is_deleted                   = file->is_deleting;
+
+	file->number_of_descriptor_entries++;
+
+	node_type        = (uint8_t) ( identifier & 0x1f );
+	descriptor_index = identifier >> 5;
+
+	if( descriptor_index >= file->high_water_marks[ node_type ] )
+	{
+		file->high_water_marks[ node_type ] = descriptor_index + 1;
+	}
+	return( 1 );
+}
+
+/* Places a pending block in the file
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_place_block(
+     pff_generate_file_t *file,
+     pff_generate_pending_block_t *pending_block )
+{
+	uint8_t footer[ 16 ];
+
+	size_t block_size    = 0;
+	size_t footer_size   = 0;
+	uint64_t file_offset = 0;
+	uint32_t crc32       = 0;
+	uint16_t signature   = 0;
+
+	if( file->options->file_type == PFF_GENERATE_FILE_TYPE_32BIT )
+	{
+		footer_size = sizeof( pff_block_footer_32bit_t );
+	}
+	else
+	{
+		footer_size = sizeof( pff_block_footer_64bit_t );
+	}
+	block_size = ( ( pending_block->data_size + footer_size + 63 ) / 64 ) * 64;
+
+	/* Leave the occasional unallocated gap when fragmenting
+	 */
+	if( ( file->options->fragmentation_window > 1 )
+	 && ( ( pff_generate_random( file ) % 8 ) == 0 ) )
+	{
+		file->current_offset += 64 * ( 1 + ( pff_generate_random( file ) % 16 ) );
+	}
+	file_offset = pff_generate_allocate(
+	               file,
+	               block_size,
+	               64 );
+
+	crc32     = pff_generate_crc32_calculate(
+	             pending_block->data,
+	             pending_block->data_size );
+	signature = pff_generate_compute_signature(
+	             file_offset,
+	             pending_block->identifier );
+
+	memory_set(
+	 footer,
+	 0,
+	 16 );
+
+	if( file->options->file_type == PFF_GENERATE_FILE_TYPE_32BIT )
+	{
+		byte_stream_copy_from_uint16_little_endian(
+		 ( (pff_block_footer_32bit_t *) footer )->size,
+		 pending_block->data_size );
+		byte_stream_copy_from_uint16_little_endian(
+		 ( (pff_block_footer_32bit_t *) footer )->signature,
+		 signature );
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (pff_block_footer_32bit_t *) footer )->back_pointer,
+		 pending_block->identifier );
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (pff_block_footer_32bit_t *) footer )->crc,
+		 crc32 );
+	}
+	else
+	{
+		byte_stream_copy_from_uint16_little_endian(
+		 ( (pff_block_footer_64bit_t *) footer )->size,
+		 pending_block->data_size );
+		byte_stream_copy_from_uint16_little_endian(
+		 ( (pff_block_footer_64bit_t *) footer )->signature,
+		 signature );
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (pff_block_footer_64bit_t *) footer )->crc,
+		 crc32 );
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (pff_block_footer_64bit_t *) footer )->back_pointer,
+		 pending_block->identifier );
+	}
+	if( pff_generate_write_at_offset(
+	     file,
+	     file_offset,
+	     pending_block->data,
+	     pending_block->data_size ) != 1 )
+	{
+		return( -1 );
+	}
+	if( pff_generate_write_at_offset(
+	     file,
+	     file_offset + block_size - footer_size,
+	     footer,
+	     footer_size ) != 1 )
+	{
+		return( -1 );
+	}
+	/* Deleted blocks remain in the file but are marked as unallocated
+	 */
+	if( pending_block->is_deleted == 0 )
+	{
+		if( pff_generate_set_allocated(
+		     file,
+		     file_offset,
+		     block_size ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	if( pff_generate_append_offset_entry(
+	     file,
+	     pending_block->identifier,
+	     file_offset,
+	     pending_block->data_size,
+	     pending_block->is_deleted ) != 1 )
+	{
+		return( -1 );
+	}
+	free(
+	 pending_block->data );
+
+	pending_block->data = NULL;
+
+	return( 1 );
+}
+
+/* Places a random pending block
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_place_pending_block(
+     pff_generate_file_t *file )
+{
+	int pending_block_index = 0;
+
+	if( file->number_of_pending_blocks > 1 )
+	{
+		pending_block_index = (int) ( pff_generate_random( file ) % (uint32_t) file->number_of_pending_blocks );
+	}
+	if( pff_generate_place_block(
+	     file,
+	     &( file->pending_blocks[ pending_block_index ] ) ) != 1 )
+	{
+		return( -1 );
+	}
+	file->number_of_pending_blocks--;
+
+	file->pending_blocks[ pending_block_index ] = file->pending_blocks[ file->number_of_pending_blocks ];
+
+	return( 1 );
+}
+
+/* Writes a data block
+ * The block is placed once it leaves the fragmentation window
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_write_block(
+     pff_generate_file_t *file,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t is_internal,
+     uint64_t *identifier )
+{
+	pff_generate_pending_block_t *pending_block = NULL;
+
+	if( ( data_size == 0 )
+	 || ( data_size > PFF_GENERATE_MAXIMUM_BLOCK_DATA_SIZE ) )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid block data size: %" PRIzd ".\n",
+		 data_size );
+
+		return( -1 );
+	}
+	*identifier = file->next_block_identifier;
+
+	file->next_block_identifier += 4;
+
+	if( is_internal != 0 )
+	{
+		*identifier |= PFF_GENERATE_OFFSET_INDEX_FLAG_INTERNAL;
+	}
+	pending_block = &( file->pending_blocks[ file->number_of_pending_blocks ] );
+
+	pending_block->data = (uint8_t *) malloc(
+	                                   data_size );
+
+	if( pending_block->data == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create block data.\n" );
+
+		return( -1 );
+	}
+	memory_copy(
+	 pending_block->data,
+	 data,
+	 data_size );
+
+	/* Internal blocks are never encrypted
+	 */
+	if( is_internal == 0 )
+	{
+		pff_generate_encrypt(
+		 file->options->encryption_type,
+		 (uint32_t) *identifier,
+		 pending_block->data,
+		 data_size );
+	}
+	pending_block->identifier = *identifier;
+	pending_block->data_size  = data_size;
+	pending_block->is_deleted = file->is_deleting;
+
+	file->number_of_pending_blocks++;
+
+	if( file->number_of_pending_blocks >= file->options->fragmentation_window )
+	{
+		if( pff_generate_place_pending_block(
+		     file ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Writes an array of block identifiers
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_write_array(
+     pff_generate_file_t *file,
+     uint8_t level,
+     const uint64_t *identifiers,
+     size_t number_of_identifiers,
+     size_t total_data_size,
+     uint64_t *identifier )
+{
+	uint8_t array_data[ PFF_GENERATE_MAXIMUM_BLOCK_DATA_SIZE ];
+
+	size_t array_data_offset = 0;
+	size_t identifier_index  = 0;
+
+	memory_set(
+	 array_data,
+	 0,
+	 sizeof( pff_array_t ) );
+
+	( (pff_array_t *) array_data )->signature           = 0x01;
+	( (pff_array_t *) array_data )->array_entries_level = level;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (pff_array_t *) array_data )->number_of_entries,
+	 number_of_identifiers );
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (pff_array_t *) array_data )->total_data_size,
+	 total_data_size );
+
+	array_data_offset = sizeof( pff_array_t );
+
+	for( identifier_index = 0;
+	     identifier_index < number_of_identifiers;
+	     identifier_index++ )
+	{
+		if( file->value_size == 4 )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 &( array_data[ array_data_offset ] ),
+			 identifiers[ identifier_index ] );
+		}
+		else
+		{
+			byte_stream_copy_from_uint64_little_endian(
+			 &( array_data[ array_data_offset ] ),
+			 identifiers[ identifier_index ] );
+		}
+		array_data_offset += file->value_size;
+	}
+	return( pff_generate_write_block(
+	         file,
+	         array_data,
+	         array_data_offset,
+	         1,
+	         identifier ) );
+}
+
+/* Writes data of arbitrary size as a single block or a (nested) data array
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_write_data(
+     pff_generate_file_t *file,
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t *identifier )
+{
+	uint64_t *block_identifiers       = NULL;
+	uint64_t *array_identifiers       = NULL;
+	size_t array_data_size            = 0;
+	size_t block_data_size            = 0;
+	size_t block_index                = 0;
+	size_t data_offset                = 0;
+	size_t maximum_number_of_entries  = 0;
+	size_t number_of_arrays           = 0;
+	size_t number_of_blocks           = 0;
+	size_t array_index                = 0;
+	size_t entries_in_array           = 0;
+	int result                        = 1;
+
+	if( data_size <= PFF_GENERATE_MAXIMUM_BLOCK_DATA_SIZE )
+	{
+		return( pff_generate_write_block(
+		         file,
+		         data,
+		         data_size,
+		         0,
+		         identifier ) );
+	}
+	maximum_number_of_entries = ( PFF_GENERATE_MAXIMUM_BLOCK_DATA_SIZE - sizeof( pff_array_t ) ) / file->value_size;
+	number_of_blocks          = ( data_size + PFF_GENERATE_MAXIMUM_BLOCK_DATA_SIZE - 1 ) / PFF_GENERATE_MAXIMUM_BLOCK_DATA_SIZE;
+	number_of_arrays          = ( number_of_blocks + maximum_number_of_entries - 1 ) / maximum_number_of_entries;
+
+	if( number_of_arrays > maximum_number_of_entries )
+	{
+		fprintf(
+		 stderr,
+		 "Data size: %" PRIzd " exceeds maximum.\n",
+		 data_size );
+
+		return( -1 );
+	}
+	block_identifiers = (uint64_t *) malloc(
+	                                  sizeof( uint64_t ) * number_of_blocks );
+	array_identifiers = (uint64_t *) malloc(
+	                                  sizeof( uint64_t ) * number_of_arrays );
+
+	if( ( block_identifiers == NULL )
+	 || ( array_identifiers == NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create block identifiers.\n" );
+
+		result = -1;
+	}
+	for( block_index = 0;
+	     ( result == 1 ) && ( block_index < number_of_blocks );
+	     block_index++ )
+	{
+		block_data_size = data_size - data_offset;
+
+		if( block_data_size > PFF_GENERATE_MAXIMUM_BLOCK_DATA_SIZE )
+		{
+			block_data_size = PFF_GENERATE_MAXIMUM_BLOCK_DATA_SIZE;
+		}
+		result = pff_generate_write_block(
+		          file,
+		          &( data[ data_offset ] ),
+		          block_data_size,
+		          0,
+		          &( block_identifiers[ block_index ] ) );
+
+		data_offset += block_data_size;
+	}
+	if( result == 1 )
+	{
+		if( number_of_arrays == 1 )
+		{
+			result = pff_generate_write_array(
+			          file,
+			          1,
+			          block_identifiers,
+			          number_of_blocks,
+			          data_size,
+			          identifier );
+		}
+		else
+		{
+			data_offset = 0;
+
+			for( array_index = 0;
+			     ( result == 1 ) && ( array_index < number_of_arrays );
+			     array_index++ )
+			{
+				entries_in_array = number_of_blocks - ( array_index * maximum_number_of_entries );
+
+				if( entries_in_array > maximum_number_of_entries )
+				{
+					entries_in_array = maximum_number_of_entries;
+				}
+				array_data_size = entries_in_array * PFF_GENERATE_MAXIMUM_BLOCK_DATA_SIZE;
+
+				if( array_data_size > ( data_size - data_offset ) )
+				{
+					array_data_size = data_size - data_offset;
+				}
+				result = pff_generate_write_array(
+				          file,
+				          1,
+				          &( block_identifiers[ array_index * maximum_number_of_entries ] ),
+				          entries_in_array,
+				          array_data_size,
+				          &( array_identifiers[ array_index ] ) );
+
+				data_offset += array_data_size;
+			}
+			if( result == 1 )
+			{
+				result = pff_generate_write_array(
+				          file,
+				          2,
+				          array_identifiers,
+				          number_of_arrays,
+				          data_size,
+				          identifier );
+			}
+		}
+	}
+	if( array_identifiers != NULL )
+	{
+		free(
+		 array_identifiers );
+	}
+	if( block_identifiers != NULL )
+	{
+		free(
+		 block_identifiers );
+	}
+	return( result );
+}
+
+/* Appends a local descriptor
+ */
+void pff_generate_local_descriptors_append(
+      pff_generate_local_descriptors_t *local_descriptors,
+      uint64_t identifier,
+      uint64_t data_identifier,
+      uint64_t local_descriptors_identifier )
+{
+	int entry_index = local_descriptors->number_of_entries;
+
+	/* Keep the entries sorted by identifier
+	 */
+	while( ( entry_index > 0 )
+	    && ( local_descriptors->identifier[ entry_index - 1 ] > identifier ) )
+	{
+		local_descriptors->identifier[ entry_index ]                   = local_descriptors->identifier[ entry_index - 1 ];
+		local_descriptors->data_identifier[ entry_index ]              = local_descriptors->data_identifier[ entry_index - 1 ];
+		local_descriptors->local_descriptors_identifier[ entry_index ] = local_descriptors->local_descriptors_identifier[ entry_index - 1 ];
+
+		entry_index--;
+	}
+	local_descriptors->identifier[ entry_index ]                   = identifier;
+	local_descriptors->data_identifier[ entry_index ]              = data_identifier;
+	local_descriptors->local_descriptors_identifier[ entry_index ] = local_descriptors_identifier;
+
+	local_descriptors->number_of_entries++;
+}
+
+/* Retrieves a new local descriptor identifier for a value
+ * Returns the identifier
+ */
+uint32_t pff_generate_local_descriptors_get_value_identifier(
+      pff_generate_local_descriptors_t *local_descriptors )
+{
+	uint32_t identifier = 0;
+
+	identifier = ( ( 0x0100 + local_descriptors->next_value_index ) << 5 ) | PFF_GENERATE_NODE_TYPE_LOCAL_DESCRIPTOR_VALUE;
+
+	local_descriptors->next_value_index++;
+
+	return( identifier );
+}
+
+/* Writes the local descriptors node
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_local_descriptors_write(
+     pff_generate_file_t *file,
+     pff_generate_local_descriptors_t *local_descriptors,
+     uint64_t *identifier )
+{
+	uint8_t node_data[ PFF_GENERATE_MAXIMUM_BLOCK_DATA_SIZE ];
+
+	size_t node_data_offset = 0;
+	int entry_index         = 0;
+
+	*identifier = 0;
+
+	if( local_descriptors->number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+	memory_set(
+	 node_data,
+	 0,
+	 sizeof( pff_local_descriptor_node_64bit_t ) );
+
+	node_data[ 0 ] = 0x02;
+	node_data[ 1 ] = PFF_LOCAL_DESCRIPTOR_NODE_LEVEL_LEAF;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( node_data[ 2 ] ),
+	 local_descriptors->number_of_entries );
+
+	if( file->options->file_type == PFF_GENERATE_FILE_TYPE_32BIT )
+	{
+		node_data_offset = sizeof( pff_local_descriptor_node_32bit_t );
+	}
+	else
+	{
+		node_data_offset = sizeof( pff_local_descriptor_node_64bit_t );
+	}
+	for( entry_index = 0;
+	     entry_index < local_descriptors->number_of_entries;
+	     entry_index++ )
+	{
+		if( file->value_size == 4 )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 &( node_data[ node_data_offset ] ),
+			 local_descriptors->identifier[ entry_index ] );
+			byte_stream_copy_from_uint32_little_endian(
+			 &( node_data[ node_data_offset + 4 ] ),
+			 local_descriptors->data_identifier[ entry_index ] );
+			byte_stream_copy_from_uint32_little_endian(
+			 &( node_data[ node_data_offset + 8 ] ),
+			 local_descriptors->local_descriptors_identifier[ entry_index ] );
+		}
+		else
+		{
+			byte_stream_copy_from_uint64_little_endian(
+			 &( node_data[ node_data_offset ] ),
+			 local_descriptors->identifier[ entry_index ] );
+			byte_stream_copy_from_uint64_little_endian(
+			 &( node_data[ node_data_offset + 8 ] ),
+			 local_descriptors->data_identifier[ entry_index ] );
+			byte_stream_copy_from_uint64_little_endian(
+			 &( node_data[ node_data_offset + 16 ] ),
+			 local_descriptors->local_descriptors_identifier[ entry_index ] );
+		}
+		node_data_offset += 3 * file->value_size;
+	}
+	return( pff_generate_write_block(
+	         file,
+	         node_data,
+	         node_data_offset,
+	         1,
+	         identifier ) );
+}
+
+/* Initializes a heap
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_heap_initialize(
+     pff_generate_heap_t *heap,
+     uint8_t client_signature )
+{
+	memory_set(
+	 heap,
+	 0,
+	 sizeof( pff_generate_heap_t ) );
+
+	heap->client_signature = client_signature;
+
+	return( 1 );
+}
+
+/* Frees a heap
+ */
+void pff_generate_heap_free(
+      pff_generate_heap_t *heap )
+{
+	int block_index = 0;
+
+	for( block_index = 0;
+	     block_index < heap->number_of_blocks;
+	     block_index++ )
+	{
+		free(
+		 heap->blocks[ block_index ] );
+	}
+	if( heap->blocks != NULL )
+	{
+		free(
+		 heap->blocks );
+	}
+	memory_set(
+	 heap,
+	 0,
+	 sizeof( pff_generate_heap_t ) );
+}
+
+/* Closes the current heap block by writing its page map
+ */
+void pff_generate_heap_close_block(
+      pff_generate_heap_t *heap )
+{
+	uint8_t *block_data  = NULL;
+	size_t page_map_size = 0;
+	int allocation_index = 0;
+
+	if( heap->number_of_blocks == 0 )
+	{
+		return;
+	}
+	block_data = heap->blocks[ heap->number_of_blocks - 1 ];
+
+	heap->used_size = ( heap->used_size + 1 ) & ~( (size_t) 1 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 block_data,
+	 heap->used_size );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( block_data[ heap->used_size ] ),
+	 heap->number_of_allocations );
+	byte_stream_copy_from_uint16_little_endian(
+	 &( block_data[ heap->used_size + 2 ] ),
+	 0 );
+
+	page_map_size = 4;
+
+	for( allocation_index = 0;
+	     allocation_index <= heap->number_of_allocations;
+	     allocation_index++ )
+	{
+		byte_stream_copy_from_uint16_little_endian(
+		 &( block_data[ heap->used_size + page_map_size ] ),
+		 heap->allocation_offsets[ allocation_index ] );
+
+		page_map_size += 2;
+	}
+	/* Store the block size in the used size of the closed block
+	 */
+	heap->used_size += page_map_size;
+
+	block_data[ PFF_GENERATE_MAXIMUM_BLOCK_DATA_SIZE ]     = (uint8_t) ( heap->used_size & 0xff );
+	block_data[ PFF_GENERATE_MAXIMUM_BLOCK_DATA_SIZE + 1 ] = (uint8_t) ( heap->used_size >> 8 );
+}
+
+/* Starts a new heap block
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_heap_open_block(
+     pff_generate_heap_t *heap )
+{
+	uint8_t **reallocation = NULL;
+	uint8_t *block_data    = NULL;
+	size_t header_size     = 0;
+	int block_index        = 0;
+
+	pff_generate_heap_close_block(
+	 heap );
+
+	if( heap->number_of_blocks >= heap->maximum_number_of_blocks )
+	{
+		reallocation = (uint8_t **) realloc(
+		                             heap->blocks,
+		                             sizeof( uint8_t * ) * ( heap->maximum_number_of_blocks + 16 ) );
+
+		if( reallocation == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to resize heap blocks.\n" );
+
+			return( -1 );
+		}
+		heap->blocks                    = reallocation;
+		heap->maximum_number_of_blocks += 16;
+	}
+	/* The 2 additional bytes store the size of a closed block
+	 */
+	block_data = (uint8_t *) malloc(
+	                          PFF_GENERATE_MAXIMUM_BLOCK_DATA_SIZE + 2 );
+
+	if( block_data == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create heap block.\n" );
+
+		return( -1 );
+	}
+	memory_set(
+	 block_data,
+	 0,
+	 PFF_GENERATE_MAXIMUM_BLOCK_DATA_SIZE + 2 );
+
+	block_index = heap->number_of_blocks;
+
+	if( block_index == 0 )
+	{
+		/* The heap header: page map offset, signature, client signature,
+		 * user root and fill levels
+		 */
+		block_data[ 2 ] = 0xec;
+		block_data[ 3 ] = heap->client_signature;
+
+		header_size = 12;
+	}
+	else if( ( ( block_index - 8 ) % 128 ) == 0 )
+	{
+		/* The heap bitmap header: page map offset and fill levels
+		 */
+		header_size = 66;
+	}
+	else
+	{
+		header_size = 2;
+	}
+	heap->blocks[ block_index ] = block_data;
+
+	heap->number_of_blocks++;
+
+	heap->used_size                = header_size;
+	heap->number_of_allocations    = 0;
+	heap->allocation_offsets[ 0 ] = (uint16_t) header_size;
+
+	return( 1 );
+}
+
+/* Allocates a value on the heap
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_heap_allocate(
+     pff_generate_heap_t *heap,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *heap_identifier )
+{
+	uint8_t *block_data   = NULL;
+	size_t aligned_offset = 0;
+	size_t required_size  = 0;
+
+	if( data_size > PFF_GENERATE_MAXIMUM_HEAP_ALLOCATION_SIZE )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid heap allocation size: %" PRIzd ".\n",
+		 data_size );
+
+		return( -1 );
+	}
+	if( heap->number_of_blocks > 0 )
+	{
+		aligned_offset = ( heap->used_size + 1 ) & ~( (size_t) 1 );
+		required_size  = aligned_offset + data_size + 4 + ( 2 * ( heap->number_of_allocations + 2 ) );
+	}
+	if( ( heap->number_of_blocks == 0 )
+	 || ( required_size > PFF_GENERATE_MAXIMUM_BLOCK_DATA_SIZE )
+	 || ( heap->number_of_allocations >= PFF_GENERATE_MAXIMUM_HEAP_ALLOCATIONS ) )
+	{
+		if( pff_generate_heap_open_block(
+		     heap ) != 1 )
+		{
+			return( -1 );
+		}
+		aligned_offset = heap->used_size;
+	}
+	block_data = heap->blocks[ heap->number_of_blocks - 1 ];
+
+	heap->allocation_offsets[ heap->number_of_allocations ] = (uint16_t) aligned_offset;
+
+	if( data != NULL )
+	{
+		memory_copy(
+		 &( block_data[ aligned_offset ] ),
+		 data,
+		 data_size );
+	}
+	heap->used_size = aligned_offset + data_size;
+
+	heap->number_of_allocations++;
+
+	heap->allocation_offsets[ heap->number_of_allocations ] = (uint16_t) heap->used_size;
+
+	*heap_identifier = ( (uint32_t) ( heap->number_of_blocks - 1 ) << 16 )
+	                 | ( (uint32_t) heap->number_of_allocations << 5 );
+
+	return( 1 );
+}
+
+/* Writes the heap
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_heap_write(
+     pff_generate_file_t *file,
+     pff_generate_heap_t *heap,
+     uint32_t user_root,
+     uint64_t *identifier )
+{
+	uint64_t *block_identifiers = NULL;
+	size_t block_size           = 0;
+	size_t total_data_size      = 0;
+	int block_index             = 0;
+	int result                  = 1;
+
+	pff_generate_heap_close_block(
+	 heap );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( heap->blocks[ 0 ][ 4 ] ),
+	 user_root );
+
+	if( heap->number_of_blocks == 1 )
+	{
+		block_size = (size_t) heap->blocks[ 0 ][ PFF_GENERATE_MAXIMUM_BLOCK_DATA_SIZE ]
+		           | ( (size_t) heap->blocks[ 0 ][ PFF_GENERATE_MAXIMUM_BLOCK_DATA_SIZE + 1 ] << 8 );
+
+		return( pff_generate_write_block(
+		         file,
+		         heap->blocks[ 0 ],
+		         block_size,
+		         0,
+		         identifier ) );
+	}
+	block_identifiers = (uint64_t *) malloc(
+	                                  sizeof( uint64_t ) * heap->number_of_blocks );
+
+	if( block_identifiers == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create block identifiers.\n" );
+
+		return( -1 );
+	}
+	for( block_index = 0;
+	     ( result == 1 ) && ( block_index < heap->number_of_blocks );
+	     block_index++ )
+	{
+		block_size = (size_t) heap->blocks[ block_index ][ PFF_GENERATE_MAXIMUM_BLOCK_DATA_SIZE ]
+		           | ( (size_t) heap->blocks[ block_index ][ PFF_GENERATE_MAXIMUM_BLOCK_DATA_SIZE + 1 ] << 8 );
+
+		result = pff_generate_write_block(
+		          file,
+		          heap->blocks[ block_index ],
+		          block_size,
+		          0,
+		          &( block_identifiers[ block_index ] ) );
+
+		total_data_size += block_size;
+	}
+	if( result == 1 )
+	{
+		result = pff_generate_write_array(
+		          file,
+		          1,
+		          block_identifiers,
+		          (size_t) heap->number_of_blocks,
+		          total_data_size,
+		          identifier );
+	}
+	free(
+	 block_identifiers );
+
+	return( result );
+}
+
+/* Initializes a property context
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_property_context_initialize(
+     pff_generate_property_context_t *property_context )
+{
+	property_context->number_of_records = 0;
+
+	return( pff_generate_heap_initialize(
+	         &( property_context->heap ),
+	         0xbc ) );
+}
+
+/* Adds a property record entry
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_property_context_add_record(
+     pff_generate_property_context_t *property_context,
+     uint16_t entry_type,
+     uint16_t value_type,
+     uint32_t value )
+{
+	uint8_t *record_data = NULL;
+	int record_index     = 0;
+
+	if( property_context->number_of_records >= (int) ( sizeof( property_context->records ) / 8 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Too many property record entries.\n" );
+
+		return( -1 );
+	}
+	/* Keep the record entries sorted by entry type
+	 */
+	record_index = property_context->number_of_records;
+
+	while( record_index > 0 )
+	{
+		record_data = &( property_context->records[ ( record_index - 1 ) * 8 ] );
+
+		if( ( (uint16_t) record_data[ 0 ] | ( (uint16_t) record_data[ 1 ] << 8 ) ) < entry_type )
+		{
+			break;
+		}
+		memory_copy(
+		 &( record_data[ 8 ] ),
+		 record_data,
+		 8 );
+
+		record_index--;
+	}
+	record_data = &( property_context->records[ record_index * 8 ] );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (pff_table_record_entry_bc_t *) record_data )->record_entry_type,
+	 entry_type );
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (pff_table_record_entry_bc_t *) record_data )->record_entry_value_type,
+	 value_type );
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (pff_table_record_entry_bc_t *) record_data )->record_entry_value,
+	 value );
+
+	property_context->number_of_records++;
+
+	return( 1 );
+}
+
+/* Adds a variable size property value, stored on the heap or in a local descriptor
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_property_context_add_data(
+     pff_generate_file_t *file,
+     pff_generate_property_context_t *property_context,
+     pff_generate_local_descriptors_t *local_descriptors,
+     uint16_t entry_type,
+     uint16_t value_type,
+     const uint8_t *data,
+     size_t data_size )
+{
+	uint64_t data_identifier = 0;
+	uint32_t value_reference = 0;
+
+	if( data_size == 0 )
+	{
+		value_reference = 0;
+	}
+	else if( data_size <= PFF_GENERATE_MAXIMUM_HEAP_ALLOCATION_SIZE )
+	{
+		if( pff_generate_heap_allocate(
+		     &( property_context->heap ),
+		     data,
+		     data_size,
+		     &value_reference ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( pff_generate_write_data(
+		     file,
+		     data,
+		     data_size,
+		     &data_identifier ) != 1 )
+		{
+			return( -1 );
+		}
+		value_reference = pff_generate_local_descriptors_get_value_identifier(
+		                   local_descriptors );
+
+		pff_generate_local_descriptors_append(
+		 local_descriptors,
+		 value_reference,
+		 data_identifier,
+		 0 );
+	}
+	return( pff_generate_property_context_add_record(
+	         property_context,
+	         entry_type,
+	         value_type,
+	         value_reference ) );
+}
+
+/* Converts a narrow string into an UTF-16 little-endian string without end-of-string character
+ * Returns the size of the UTF-16 string in bytes
+ */
+size_t pff_generate_string_to_utf16(
+        const char *string,
+        size_t string_length,
+        uint8_t *utf16_string )
+{
+	size_t string_index = 0;
+
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		utf16_string[ string_index * 2 ]       = (uint8_t) string[ string_index ];
+		utf16_string[ ( string_index * 2 ) + 1 ] = 0;
+	}
+	return( string_length * 2 );
+}
+
+/* Adds an Unicode string property value
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_property_context_add_string(
+     pff_generate_file_t *file,
+     pff_generate_property_context_t *property_context,
+     pff_generate_local_descriptors_t *local_descriptors,
+     uint16_t entry_type,
+     const char *string,
+     size_t string_length )
+{
+	uint8_t *utf16_string    = NULL;
+	size_t utf16_string_size = 0;
+	int result               = 0;
+
+	utf16_string = (uint8_t *) malloc(
+	                            ( string_length * 2 ) + 2 );
+
+	if( utf16_string == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create UTF-16 string.\n" );
+
+		return( -1 );
+	}
+	utf16_string_size = pff_generate_string_to_utf16(
+	                     string,
+	                     string_length,
+	                     utf16_string );
+
+	result = pff_generate_property_context_add_data(
+	          file,
+	          property_context,
+	          local_descriptors,
+	          entry_type,
+	          PFF_GENERATE_VALUE_TYPE_STRING_UNICODE,
+	          utf16_string,
+	          utf16_string_size );
+
+	free(
+	 utf16_string );
+
+	return( result );
+}
+
+/* Adds a FILETIME property value
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_property_context_add_filetime(
+     pff_generate_file_t *file,
+     pff_generate_property_context_t *property_context,
+     pff_generate_local_descriptors_t *local_descriptors,
+     uint16_t entry_type,
+     uint64_t filetime )
+{
+	uint8_t filetime_data[ 8 ];
+
+	byte_stream_copy_from_uint64_little_endian(
+	 filetime_data,
+	 filetime );
+
+	return( pff_generate_property_context_add_data(
+	         file,
+	         property_context,
+	         local_descriptors,
+	         entry_type,
+	         PFF_GENERATE_VALUE_TYPE_FILETIME,
+	         filetime_data,
+	         8 ) );
+}
+
+/* Compresses data using LZFu compression
+ * Repeated sequences are found using a hash table of 3-byte sequences
+ * and the compressed data is terminated with an end marker reference
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_lzfu_compress(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t **compressed_data,
+     size_t *compressed_data_size )
+{
+	uint32_t hash_table[ 4096 ];
+
+	uint8_t *lzfu_data        = NULL;
+	size_t data_offset        = 0;
+	size_t flag_byte_offset   = 0;
+	size_t lzfu_data_offset   = 0;
+	size_t match_offset       = 0;
+	size_t match_size         = 0;
+	uint32_t crc32            = 0;
+	uint16_t hash_value       = 0;
+	uint16_t reference        = 0;
+	uint8_t flag_byte         = 0;
+	uint8_t flag_byte_bit     = 0;
+
+	/* The worst case is a flag byte for every 8 literals and the end marker
+	 */
+	lzfu_data = (uint8_t *) malloc(
+	                         16 + data_size + ( data_size / 8 ) + 4 );
+
+	if( lzfu_data == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create LZFu data.\n" );
+
+		return( -1 );
+	}
+	memory_set(
+	 hash_table,
+	 0,
+	 sizeof( uint32_t ) * 4096 );
+
+	lzfu_data_offset = 16;
+	flag_byte_offset = lzfu_data_offset++;
+
+	while( data_offset < data_size )
+	{
+		if( flag_byte_bit == 8 )
+		{
+			lzfu_data[ flag_byte_offset ] = flag_byte;
+
+			flag_byte_offset = lzfu_data_offset++;
+			flag_byte        = 0;
+			flag_byte_bit    = 0;
+		}
+		match_size = 0;
+
+		if( ( data_offset + 3 ) <= data_size )
+		{
+			hash_value = (uint16_t) ( ( ( data[ data_offset ] << 8 ) ^ ( data[ data_offset + 1 ] << 4 ) ^ data[ data_offset + 2 ] ) & 0x0fff );
+
+			/* The hash table stores the offset + 1, 0 represents an unused entry
+			 */
+			if( ( hash_table[ hash_value ] != 0 )
+			 && ( ( data_offset - ( hash_table[ hash_value ] - 1 ) ) < 4000 ) )
+			{
+				match_offset = hash_table[ hash_value ] - 1;
+
+				while( ( match_size < 17 )
+				    && ( ( data_offset + match_size ) < data_size )
+				    && ( data[ match_offset + match_size ] == data[ data_offset + match_size ] ) )
+				{
+					match_size++;
+				}
+			}
+			hash_table[ hash_value ] = (uint32_t) ( data_offset + 1 );
+		}
+		if( match_size >= 2 )
+		{
+			/* The lz buffer starts with the 207 bytes of the RTF dictionary
+			 */
+			reference = (uint16_t) ( ( ( ( 207 + match_offset ) % 4096 ) << 4 ) | ( match_size - 2 ) );
+
+			byte_stream_copy_from_uint16_big_endian(
+			 &( lzfu_data[ lzfu_data_offset ] ),
+			 reference );
+
+			lzfu_data_offset += 2;
+			data_offset      += match_size;
+			flag_byte        |= (uint8_t) ( 1 << flag_byte_bit );
+		}
+		else
+		{
+			lzfu_data[ lzfu_data_offset++ ] = data[ data_offset++ ];
+		}
+		flag_byte_bit++;
+	}
+	if( flag_byte_bit == 8 )
+	{
+		lzfu_data[ flag_byte_offset ] = flag_byte;
+
+		flag_byte_offset = lzfu_data_offset++;
+		flag_byte        = 0;
+		flag_byte_bit    = 0;
+	}
+	/* The end marker refers to the current position in the lz buffer
+	 */
+	reference = (uint16_t) ( ( ( 207 + data_size ) % 4096 ) << 4 );
+
+	byte_stream_copy_from_uint16_big_endian(
+	 &( lzfu_data[ lzfu_data_offset ] ),
+	 reference );
+
+	lzfu_data_offset += 2;
+	flag_byte        |= (uint8_t) ( 1 << flag_byte_bit );
+
+	lzfu_data[ flag_byte_offset ] = flag_byte;
+
+	crc32 = pff_generate_crc32_calculate(
+	         &( lzfu_data[ 16 ] ),
+	         lzfu_data_offset - 16 );
+
+	/* The compressed data size includes 12 bytes of the header
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( lzfu_data[ 0 ] ),
+	 (uint32_t) ( lzfu_data_offset - 4 ) );
+	byte_stream_copy_from_uint32_little_endian(
+	 &( lzfu_data[ 4 ] ),
+	 (uint32_t) data_size );
+	byte_stream_copy_from_uint32_little_endian(
+	 &( lzfu_data[ 8 ] ),
+	 0x75465a4cUL );
+	byte_stream_copy_from_uint32_little_endian(
+	 &( lzfu_data[ 12 ] ),
+	 crc32 );
+
+	*compressed_data      = lzfu_data;
+	*compressed_data_size = lzfu_data_offset;
+
+	return( 1 );
+}
+
+/* Adds a HTML and a LZFu compressed RTF message body containing the plain text body
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_property_context_add_formatted_bodies(
+     pff_generate_file_t *file,
+     pff_generate_property_context_t *property_context,
+     pff_generate_local_descriptors_t *local_descriptors,
+     const char *body,
+     size_t body_length )
+{
+	uint8_t *compressed_data    = NULL;
+	char *formatted_body        = NULL;
+	size_t compressed_data_size = 0;
+	size_t formatted_body_size  = 0;
+	int result                  = -1;
+
+	formatted_body = (char *) malloc(
+	                           body_length + 64 );
+
+	if( formatted_body == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create formatted body.\n" );
+
+		return( -1 );
+	}
+	formatted_body_size = (size_t) snprintf(
+	                                formatted_body,
+	                                body_length + 64,
+	                                "<html><body><p>%.*s</p></body></html>",
+	                                (int) body_length,
+	                                body );
+
+	if( pff_generate_property_context_add_data(
+	     file,
+	     property_context,
+	     local_descriptors,
+	     0x1013,
+	     PFF_GENERATE_VALUE_TYPE_BINARY_DATA,
+	     (uint8_t *) formatted_body,
+	     formatted_body_size ) != 1 )
+	{
+		goto on_error;
+	}
+	formatted_body_size = (size_t) snprintf(
+	                                formatted_body,
+	                                body_length + 64,
+	                                "{\\rtf1\\ansi %.*s}",
+	                                (int) body_length,
+	                                body );
+
+	/* Heap allocations are 2-byte aligned, so line feeds are appended
+	 * until the compressed data size is even and matches the value size
+	 */
+	do
+	{
+		if( compressed_data != NULL )
+		{
+			free(
+			 compressed_data );
+
+			compressed_data = NULL;
+
+			formatted_body[ formatted_body_size++ ] = '\n';
+		}
+		if( pff_generate_lzfu_compress(
+		     (uint8_t *) formatted_body,
+		     formatted_body_size,
+		     &compressed_data,
+		     &compressed_data_size ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	while( ( compressed_data_size % 2 ) != 0 );
+
+	if( pff_generate_property_context_add_data(
+	     file,
+	     property_context,
+	     local_descriptors,
+	     0x1009,
+	     PFF_GENERATE_VALUE_TYPE_BINARY_DATA,
+	     compressed_data,
+	     compressed_data_size ) != 1 )
+	{
+		goto on_error;
+	}
+	result = 1;
+
+on_error:
+	if( compressed_data != NULL )
+	{
+		free(
+		 compressed_data );
+	}
+	free(
+	 formatted_body );
+
+	return( result );
+}
+
+/* Writes a property context
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_property_context_write(
+     pff_generate_file_t *file,
+     pff_generate_property_context_t *property_context,
+     uint64_t *identifier )
+{
+	uint8_t b5_header[ 8 ];
+
+	uint32_t b5_header_reference = 0;
+	uint32_t records_reference   = 0;
+	int result                   = 0;
+
+	if( property_context->number_of_records > 0 )
+	{
+		if( pff_generate_heap_allocate(
+		     &( property_context->heap ),
+		     property_context->records,
+		     (size_t) property_context->number_of_records * 8,
+		     &records_reference ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	( (pff_table_header_b5_t *) b5_header )->type                         = 0xb5;
+	( (pff_table_header_b5_t *) b5_header )->record_entry_identifier_size = 2;
+	( (pff_table_header_b5_t *) b5_header )->record_entry_value_size      = 6;
+	( (pff_table_header_b5_t *) b5_header )->record_entries_level         = 0;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (pff_table_header_b5_t *) b5_header )->record_entries_reference,
+	 records_reference );
+
+	if( pff_generate_heap_allocate(
+	     &( property_context->heap ),
+	     b5_header,
+	     8,
+	     &b5_header_reference ) != 1 )
+	{
+		goto on_error;
+	}
+	result = pff_generate_heap_write(
+	          file,
+	          &( property_context->heap ),
+	          b5_header_reference,
+	          identifier );
+
+	pff_generate_heap_free(
+	 &( property_context->heap ) );
+
+	return( result );
+
+on_error:
+	pff_generate_heap_free(
+	 &( property_context->heap ) );
+
+	return( -1 );
+}
+
+/* Initializes a table context
+ * The columns are ordered by value size in the rows: 4 and 8, 2 and 1 byte values
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_table_context_initialize(
+     pff_generate_table_context_t *table_context,
+     const pff_generate_column_t *columns,
+     int number_of_columns )
+{
+	uint16_t row_offset = 0;
+	int column_index    = 0;
+	int size_index      = 0;
+	uint8_t sizes[ 3 ]  = { 4, 2, 1 };
+
+	memory_set(
+	 table_context,
+	 0,
+	 sizeof( pff_generate_table_context_t ) );
+
+	if( pff_generate_heap_initialize(
+	     &( table_context->heap ),
+	     0x7c ) != 1 )
+	{
+		return( -1 );
+	}
+	memory_copy(
+	 table_context->columns,
+	 columns,
+	 sizeof( pff_generate_column_t ) * number_of_columns );
+
+	table_context->number_of_columns = number_of_columns;
+
+	for( size_index = 0;
+	     size_index < 3;
+	     size_index++ )
+	{
+		for( column_index = 0;
+		     column_index < number_of_columns;
+		     column_index++ )
+		{
+			if( ( table_context->columns[ column_index ].size == sizes[ size_index ] )
+			 || ( ( size_index == 0 )
+			  &&  ( table_context->columns[ column_index ].size > 4 ) ) )
+			{
+				table_context->columns[ column_index ].offset = row_offset;
+
+				row_offset += table_context->columns[ column_index ].size;
+			}
+		}
+		table_context->end_offsets[ size_index ] = row_offset;
+	}
+	table_context->end_offsets[ 3 ] = row_offset + (uint16_t) ( ( number_of_columns + 7 ) / 8 );
+
+	return( 1 );
+}
+
+/* Appends a row to the table context
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_table_context_append_row(
+     pff_generate_table_context_t *table_context,
+     uint8_t **row_data )
+{
+	uint8_t *reallocation    = NULL;
+	size_t maximum_rows      = 0;
+	size_t row_size          = 0;
+	int column_index         = 0;
+
+	row_size = table_context->end_offsets[ 3 ];
+
+	if( table_context->number_of_rows >= table_context->maximum_number_of_rows )
+	{
+		maximum_rows = ( table_context->maximum_number_of_rows * 2 ) + 64;
+
+		reallocation = (uint8_t *) realloc(
+		                            table_context->rows,
+		                            row_size * maximum_rows );
+
+		if( reallocation == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to resize table rows.\n" );
+
+			return( -1 );
+		}
+		table_context->rows                   = reallocation;
+		table_context->maximum_number_of_rows = maximum_rows;
+	}
+	*row_data = &( table_context->rows[ table_context->number_of_rows * row_size ] );
+
+	memory_set(
+	 *row_data,
+	 0,
+	 row_size );
+
+	/* Mark all the cells as existing
+	 */
+	for( column_index = 0;
+	     column_index < table_context->number_of_columns;
+	     column_index++ )
+	{
+		( *row_data )[ table_context->end_offsets[ 2 ] + ( column_index / 8 ) ] |= (uint8_t) ( 0x80 >> ( column_index % 8 ) );
+	}
+	table_context->number_of_rows++;
+
+	return( 1 );
+}
+
+/* Sets a 32-bit value in a row
+ */
+void pff_generate_table_context_set_32bit(
+      pff_generate_table_context_t *table_context,
+      uint8_t *row_data,
+      int column_index,
+      uint32_t value )
+{
+	byte_stream_copy_from_uint32_little_endian(
+	 &( row_data[ table_context->columns[ column_index ].offset ] ),
+	 value );
+}
+
+/* Sets a 64-bit value in a row
+ */
+void pff_generate_table_context_set_64bit(
+      pff_generate_table_context_t *table_context,
+      uint8_t *row_data,
+      int column_index,
+      uint64_t value )
+{
+	byte_stream_copy_from_uint64_little_endian(
+	 &( row_data[ table_context->columns[ column_index ].offset ] ),
+	 value );
+}
+
+/* Sets a 8-bit value in a row
+ */
+void pff_generate_table_context_set_8bit(
+      pff_generate_table_context_t *table_context,
+      uint8_t *row_data,
+      int column_index,
+      uint8_t value )
+{
+	row_data[ table_context->columns[ column_index ].offset ] = value;
+}
+
+/* Sets an Unicode string in a row, the string is stored on the table heap
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_table_context_set_string(
+     pff_generate_table_context_t *table_context,
+     uint8_t *row_data,
+     int column_index,
+     const char *string,
+     size_t string_length )
+{
+	uint8_t utf16_string[ 512 ];
+
+	uint32_t value_reference = 0;
+
+	if( string_length > 256 )
+	{
+		string_length = 256;
+	}
+	if( pff_generate_heap_allocate(
+	     &( table_context->heap ),
+	     utf16_string,
+	     pff_generate_string_to_utf16(
+	      string,
+	      string_length,
+	      utf16_string ),
+	     &value_reference ) != 1 )
+	{
+		return( -1 );
+	}
+	pff_generate_table_context_set_32bit(
+	 table_context,
+	 row_data,
+	 column_index,
+	 value_reference );
+
+	return( 1 );
+}
+
+/* Compares two row index records
+ * Returns -1, 0 or 1
+ */
+int pff_generate_row_index_record_compare(
+     const void *first,
+     const void *second )
+{
+	uint32_t first_identifier  = 0;
+	uint32_t second_identifier = 0;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 (const uint8_t *) first,
+	 first_identifier );
+	byte_stream_copy_to_uint32_little_endian(
+	 (const uint8_t *) second,
+	 second_identifier );
+
+	if( first_identifier < second_identifier )
+	{
+		return( -1 );
+	}
+	else if( first_identifier > second_identifier )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Writes a table context
+ * The rows are stored on the heap or in a local descriptor when too large
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_table_context_write(
+     pff_generate_file_t *file,
+     pff_generate_table_context_t *table_context,
+     pff_generate_local_descriptors_t *local_descriptors,
+     uint64_t *identifier )
+{
+	uint8_t b5_header[ 8 ];
+
+	uint8_t *branch_records           = NULL;
+	uint8_t *header_data              = NULL;
+	uint8_t *row_index_records        = NULL;
+	uint8_t *rows_data                = NULL;
+	uint64_t *block_identifiers       = NULL;
+	size_t branch_records_size        = 0;
+	size_t header_data_size           = 0;
+	size_t maximum_records_per_leaf   = 0;
+	size_t number_of_blocks           = 0;
+	size_t number_of_leaves           = 0;
+	size_t records_in_leaf            = 0;
+	size_t row_index                  = 0;
+	size_t row_size                   = 0;
+	size_t rows_data_size             = 0;
+	size_t rows_per_block             = 0;
+	size_t block_index                = 0;
+	size_t leaf_index                 = 0;
+	uint64_t rows_identifier          = 0;
+	uint32_t b5_header_reference      = 0;
+	uint32_t header_reference         = 0;
+	uint32_t leaf_reference           = 0;
+	uint32_t records_reference        = 0;
+	uint32_t rows_reference           = 0;
+	uint8_t records_level             = 0;
+	int column_index                  = 0;
+	int result                        = -1;
+
+	row_size = table_context->end_offsets[ 3 ];
+
+	if( table_context->number_of_rows > 0 )
+	{
+		/* The row index maps the row identifier to the row number
+		 */
+		row_index_records = (uint8_t *) malloc(
+		                                 table_context->number_of_rows * 8 );
+
+		if( row_index_records == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create row index records.\n" );
+
+			goto on_error;
+		}
+		for( row_index = 0;
+		     row_index < table_context->number_of_rows;
+		     row_index++ )
+		{
+			memory_copy(
+			 &( row_index_records[ row_index * 8 ] ),
+			 &( table_context->rows[ row_index * row_size ] ),
+			 4 );
+			byte_stream_copy_from_uint32_little_endian(
+			 &( row_index_records[ ( row_index * 8 ) + 4 ] ),
+			 row_index );
+		}
+		qsort(
+		 row_index_records,
+		 table_context->number_of_rows,
+		 8,
+		 &pff_generate_row_index_record_compare );
+
+		maximum_records_per_leaf = PFF_GENERATE_MAXIMUM_HEAP_ALLOCATION_SIZE / 8;
+
+		if( table_context->number_of_rows <= maximum_records_per_leaf )
+		{
+			if( pff_generate_heap_allocate(
+			     &( table_context->heap ),
+			     row_index_records,
+			     table_context->number_of_rows * 8,
+			     &records_reference ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		else
+		{
+			number_of_leaves = ( table_context->number_of_rows + maximum_records_per_leaf - 1 ) / maximum_records_per_leaf;
+
+			if( number_of_leaves > maximum_records_per_leaf )
+			{
+				fprintf(
+				 stderr,
+				 "Too many rows: %" PRIzd ".\n",
+				 table_context->number_of_rows );
+
+				goto on_error;
+			}
+			branch_records_size = number_of_leaves * 8;
+
+			branch_records = (uint8_t *) malloc(
+			                              branch_records_size );
+
+			if( branch_records == NULL )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to create branch records.\n" );
+
+				goto on_error;
+			}
+			for( leaf_index = 0;
+			     leaf_index < number_of_leaves;
+			     leaf_index++ )
+			{
+				records_in_leaf = table_context->number_of_rows - ( leaf_index * maximum_records_per_leaf );
+
+				if( records_in_leaf > maximum_records_per_leaf )
+				{
+					records_in_leaf = maximum_records_per_leaf;
+				}
+				if( pff_generate_heap_allocate(
+				     &( table_context->heap ),
+				     &( row_index_records[ leaf_index * maximum_records_per_leaf * 8 ] ),
+				     records_in_leaf * 8,
+				     &leaf_reference ) != 1 )
+				{
+					goto on_error;
+				}
+				memory_copy(
+				 &( branch_records[ leaf_index * 8 ] ),
+				 &( row_index_records[ leaf_index * maximum_records_per_leaf * 8 ] ),
+				 4 );
+				byte_stream_copy_from_uint32_little_endian(
+				 &( branch_records[ ( leaf_index * 8 ) + 4 ] ),
+				 leaf_reference );
+			}
+			if( pff_generate_heap_allocate(
+			     &( table_context->heap ),
+			     branch_records,
+			     branch_records_size,
+			     &records_reference ) != 1 )
+			{
+				goto on_error;
+			}
+			records_level = 1;
+		}
+		rows_data_size = table_context->number_of_rows * row_size;
+
+		if( rows_data_size <= PFF_GENERATE_MAXIMUM_HEAP_ALLOCATION_SIZE )
+		{
+			if( pff_generate_heap_allocate(
+			     &( table_context->heap ),
+			     table_context->rows,
+			     rows_data_size,
+			     &rows_reference ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		else
+		{
+			/* Rows do not cross block boundaries
+			 */
+			rows_per_block   = PFF_GENERATE_MAXIMUM_BLOCK_DATA_SIZE / row_size;
+			number_of_blocks = ( table_context->number_of_rows + rows_per_block - 1 ) / rows_per_block;
+
+			if( number_of_blocks == 1 )
+			{
+				if( pff_generate_write_block(
+				     file,
+				     table_context->rows,
+				     rows_data_size,
+				     0,
+				     &rows_identifier ) != 1 )
+				{
+					goto on_error;
+				}
+			}
+			else
+			{
+				block_identifiers = (uint64_t *) malloc(
+				                                  sizeof( uint64_t ) * number_of_blocks );
+
+				if( block_identifiers == NULL )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to create block identifiers.\n" );
+
+					goto on_error;
+				}
+				for( block_index = 0;
+				     block_index < number_of_blocks;
+				     block_index++ )
+				{
+					rows_data = &( table_context->rows[ block_index * rows_per_block * row_size ] );
+
+					if( ( ( block_index + 1 ) * rows_per_block ) <= table_context->number_of_rows )
+					{
+						rows_data_size = rows_per_block * row_size;
+					}
+					else
+					{
+						rows_data_size = ( table_context->number_of_rows - ( block_index * rows_per_block ) ) * row_size;
+					}
+					if( pff_generate_write_block(
+					     file,
+					     rows_data,
+					     rows_data_size,
+					     0,
+					     &( block_identifiers[ block_index ] ) ) != 1 )
+					{
+						goto on_error;
+					}
+				}
+				if( number_of_blocks > ( ( PFF_GENERATE_MAXIMUM_BLOCK_DATA_SIZE - sizeof( pff_array_t ) ) / file->value_size ) )
+				{
+					fprintf(
+					 stderr,
+					 "Too many rows blocks: %" PRIzd ".\n",
+					 number_of_blocks );
+
+					goto on_error;
+				}
+				if( pff_generate_write_array(
+				     file,
+				     1,
+				     block_identifiers,
+				     number_of_blocks,
+				     table_context->number_of_rows * row_size,
+				     &rows_identifier ) != 1 )
+				{
+					goto on_error;
+				}
+			}
+			rows_reference = pff_generate_local_descriptors_get_value_identifier(
+			                  local_descriptors );
+
+			pff_generate_local_descriptors_append(
+			 local_descriptors,
+			 rows_reference,
+			 rows_identifier,
+			 0 );
+		}
+	}
+	( (pff_table_header_b5_t *) b5_header )->type                         = 0xb5;
+	( (pff_table_header_b5_t *) b5_header )->record_entry_identifier_size = 4;
+	( (pff_table_header_b5_t *) b5_header )->record_entry_value_size      = 4;
+	( (pff_table_header_b5_t *) b5_header )->record_entries_level         = records_level;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (pff_table_header_b5_t *) b5_header )->record_entries_reference,
+	 records_reference );
+
+	if( pff_generate_heap_allocate(
+	     &( table_context->heap ),
+	     b5_header,
+	     8,
+	     &b5_header_reference ) != 1 )
+	{
+		goto on_error;
+	}
+	header_data_size = sizeof( pff_table_header_7c_t )
+	                 + ( table_context->number_of_columns * sizeof( pff_table_column_definition_7c_t ) );
+
+	header_data = (uint8_t *) malloc(
+	                           header_data_size );
+
+	if( header_data == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create table header.\n" );
+
+		goto on_error;
+	}
+	memory_set(
+	 header_data,
+	 0,
+	 header_data_size );
+
+	( (pff_table_header_7c_t *) header_data )->type                         = 0x7c;
+	( (pff_table_header_7c_t *) header_data )->number_of_column_definitions = (uint8_t) table_context->number_of_columns;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (pff_table_header_7c_t *) header_data )->values_array_end_offset_32bit_values,
+	 table_context->end_offsets[ 0 ] );
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (pff_table_header_7c_t *) header_data )->values_array_end_offset_16bit_values,
+	 table_context->end_offsets[ 1 ] );
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (pff_table_header_7c_t *) header_data )->values_array_end_offset_8bit_values,
+	 table_context->end_offsets[ 2 ] );
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (pff_table_header_7c_t *) header_data )->values_array_end_offset_cell_existence_block,
+	 table_context->end_offsets[ 3 ] );
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (pff_table_header_7c_t *) header_data )->b5_table_header_reference,
+	 b5_header_reference );
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (pff_table_header_7c_t *) header_data )->values_array_reference,
+	 rows_reference );
+
+	for( column_index = 0;
+	     column_index < table_context->number_of_columns;
+	     column_index++ )
+	{
+		pff_table_column_definition_7c_t *column_definition = (pff_table_column_definition_7c_t *) &( header_data[ sizeof( pff_table_header_7c_t ) + ( column_index * sizeof( pff_table_column_definition_7c_t ) ) ] );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 column_definition->record_entry_value_type,
+		 table_context->columns[ column_index ].value_type );
+		byte_stream_copy_from_uint16_little_endian(
+		 column_definition->record_entry_type,
+		 table_context->columns[ column_index ].entry_type );
+		byte_stream_copy_from_uint16_little_endian(
+		 column_definition->values_array_offset,
+		 table_context->columns[ column_index ].offset );
+
+		column_definition->values_array_size   = table_context->columns[ column_index ].size;
+		column_definition->values_array_number = (uint8_t) column_index;
+	}
+	if( pff_generate_heap_allocate(
+	     &( table_context->heap ),
+	     header_data,
+	     header_data_size,
+	     &header_reference ) != 1 )
+	{
+		goto on_error;
+	}
+	result = pff_generate_heap_write(
+	          file,
+	          &( table_context->heap ),
+	          header_reference,
+	          identifier );
+
+on_error:
+	if( header_data != NULL )
+	{
+		free(
+		 header_data );
+	}
+	if( block_identifiers != NULL )
+	{
+		free(
+		 block_identifiers );
+	}
+	if( branch_records != NULL )
+	{
+		free(
+		 branch_records );
+	}
+	if( row_index_records != NULL )
+	{
+		free(
+		 row_index_records );
+	}
+	if( table_context->rows != NULL )
+	{
+		free(
+		 table_context->rows );
+
+		table_context->rows = NULL;
+	}
+	pff_generate_heap_free(
+	 &( table_context->heap ) );
+
+	return( result );
+}
+
+/* Generates text of approximately the requested number of characters
+ * Returns the length of the text
+ */
+size_t pff_generate_text(
+        pff_generate_file_t *file,
+        char *text,
+        size_t text_size )
+{
+	const char *word   = NULL;
+	size_t text_length = 0;
+	size_t word_length = 0;
+
+	while( text_length < text_size )
+	{
+		word        = pff_generate_words[ pff_generate_random( file ) % PFF_GENERATE_NUMBER_OF_WORDS ];
+		word_length = strlen( word );
+
+		if( ( text_length + word_length + 1 ) > text_size )
+		{
+			word_length = text_size - text_length;
+		}
+		memory_copy(
+		 &( text[ text_length ] ),
+		 word,
+		 word_length );
+
+		text_length += word_length;
+
+		if( text_length < text_size )
+		{
+			text[ text_length++ ] = ( ( pff_generate_random( file ) % 12 ) == 0 ) ? '\n' : ' ';
+		}
+	}
+	return( text_length );
+}
+
+/* Writes an empty table context as a descriptor
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_write_table_descriptor(
+     pff_generate_file_t *file,
+     pff_generate_table_context_t *table_context,
+     uint32_t descriptor_identifier )
+{
+	pff_generate_local_descriptors_t local_descriptors;
+
+	uint64_t data_identifier              = 0;
+	uint64_t local_descriptors_identifier = 0;
+
+	memory_set(
+	 &local_descriptors,
+	 0,
+	 sizeof( pff_generate_local_descriptors_t ) );
+
+	if( pff_generate_table_context_write(
+	     file,
+	     table_context,
+	     &local_descriptors,
+	     &data_identifier ) != 1 )
+	{
+		return( -1 );
+	}
+	if( pff_generate_local_descriptors_write(
+	     file,
+	     &local_descriptors,
+	     &local_descriptors_identifier ) != 1 )
+	{
+		return( -1 );
+	}
+	return( pff_generate_append_descriptor_entry(
+	         file,
+	         descriptor_identifier,
+	         data_identifier,
+	         local_descriptors_identifier,
+	         0 ) );
+}
+
+static const pff_generate_column_t pff_generate_sub_folders_columns[] = {
+	{ 0x67f2, PFF_GENERATE_VALUE_TYPE_INTEGER_32BIT_SIGNED, 4, 0 },
+	{ 0x67f3, PFF_GENERATE_VALUE_TYPE_INTEGER_32BIT_SIGNED, 4, 0 },
+	{ 0x3001, PFF_GENERATE_VALUE_TYPE_STRING_UNICODE, 4, 0 },
+	{ 0x3602, PFF_GENERATE_VALUE_TYPE_INTEGER_32BIT_SIGNED, 4, 0 },
+	{ 0x3603, PFF_GENERATE_VALUE_TYPE_INTEGER_32BIT_SIGNED, 4, 0 },
+	{ 0x360a, PFF_GENERATE_VALUE_TYPE_BOOLEAN, 1, 0 } };
+
+static const pff_generate_column_t pff_generate_sub_messages_columns[] = {
+	{ 0x67f2, PFF_GENERATE_VALUE_TYPE_INTEGER_32BIT_SIGNED, 4, 0 },
+	{ 0x67f3, PFF_GENERATE_VALUE_TYPE_INTEGER_32BIT_SIGNED, 4, 0 },
+	{ 0x0e06, PFF_GENERATE_VALUE_TYPE_FILETIME, 8, 0 },
+	{ 0x0e08, PFF_GENERATE_VALUE_TYPE_INTEGER_32BIT_SIGNED, 4, 0 },
+	{ 0x0037, PFF_GENERATE_VALUE_TYPE_STRING_UNICODE, 4, 0 },
+	{ 0x0e1b, PFF_GENERATE_VALUE_TYPE_BOOLEAN, 1, 0 },
+	{ 0x001a, PFF_GENERATE_VALUE_TYPE_STRING_UNICODE, 4, 0 },
+	{ 0x3008, PFF_GENERATE_VALUE_TYPE_FILETIME, 8, 0 } };
+
+static const pff_generate_column_t pff_generate_attachments_columns[] = {
+	{ 0x67f2, PFF_GENERATE_VALUE_TYPE_INTEGER_32BIT_SIGNED, 4, 0 },
+	{ 0x67f3, PFF_GENERATE_VALUE_TYPE_INTEGER_32BIT_SIGNED, 4, 0 },
+	{ 0x0e20, PFF_GENERATE_VALUE_TYPE_INTEGER_32BIT_SIGNED, 4, 0 },
+	{ 0x3705, PFF_GENERATE_VALUE_TYPE_INTEGER_32BIT_SIGNED, 4, 0 },
+	{ 0x3704, PFF_GENERATE_VALUE_TYPE_STRING_UNICODE, 4, 0 } };
+
+#define PFF_GENERATE_NUMBER_OF_COLUMNS( columns ) \
+	(int) ( sizeof( columns ) / sizeof( pff_generate_column_t ) )
+
+/* Retrieves a new descriptor identifier
+ * Returns the identifier
+ */
+uint32_t pff_generate_get_descriptor_identifier(
+          pff_generate_file_t *file,
+          uint8_t node_type )
+{
+	uint32_t identifier = 0;
+
+	identifier = ( file->next_descriptor_index << 5 ) | node_type;
+
+	file->next_descriptor_index++;
+
+	return( identifier );
+}
+
+/* Writes an attachment and appends it to the message local descriptors
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_write_attachment(
+     pff_generate_file_t *file,
+     pff_generate_local_descriptors_t *message_local_descriptors,
+     pff_generate_table_context_t *attachments_table,
+     int attachment_index )
+{
+	char filename[ 64 ];
+
+	pff_generate_local_descriptors_t local_descriptors;
+	pff_generate_property_context_t property_context;
+
+	uint8_t *attachment_data              = NULL;
+	uint8_t *row_data                     = NULL;
+	size_t data_offset                    = 0;
+	size_t filename_length                = 0;
+	uint64_t data_identifier              = 0;
+	uint64_t local_descriptors_identifier = 0;
+	uint32_t attachment_identifier        = 0;
+	uint32_t random_value                 = 0;
+	int result                            = -1;
+
+	memory_set(
+	 &local_descriptors,
+	 0,
+	 sizeof( pff_generate_local_descriptors_t ) );
+
+	if( pff_generate_property_context_initialize(
+	     &property_context ) != 1 )
+	{
+		return( -1 );
+	}
+	attachment_identifier = ( (uint32_t) ( 0x0200 + attachment_index ) << 5 ) | PFF_GENERATE_NODE_TYPE_ATTACHMENT;
+
+	filename_length = (size_t) snprintf(
+	                            filename,
+	                            64,
+	                            "attachment%d.bin",
+	                            attachment_index + 1 );
+
+	attachment_data = (uint8_t *) malloc(
+	                               file->options->attachment_size + 1 );
+
+	if( attachment_data == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create attachment data.\n" );
+
+		goto on_error;
+	}
+	for( data_offset = 0;
+	     data_offset < file->options->attachment_size;
+	     data_offset++ )
+	{
+		if( ( data_offset % 4 ) == 0 )
+		{
+			random_value = pff_generate_random( file );
+		}
+		attachment_data[ data_offset ] = (uint8_t) ( random_value >> ( 8 * ( data_offset % 4 ) ) );
+	}
+	if( pff_generate_property_context_add_record(
+	     &property_context,
+	     0x0e20,
+	     PFF_GENERATE_VALUE_TYPE_INTEGER_32BIT_SIGNED,
+	     (uint32_t) file->options->attachment_size ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pff_generate_property_context_add_data(
+	     file,
+	     &property_context,
+	     &local_descriptors,
+	     0x3701,
+	     PFF_GENERATE_VALUE_TYPE_BINARY_DATA,
+	     attachment_data,
+	     file->options->attachment_size ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pff_generate_property_context_add_string(
+	     file,
+	     &property_context,
+	     &local_descriptors,
+	     0x3704,
+	     filename,
+	     filename_length ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pff_generate_property_context_add_record(
+	     &property_context,
+	     0x3705,
+	     PFF_GENERATE_VALUE_TYPE_INTEGER_32BIT_SIGNED,
+	     1 ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pff_generate_property_context_add_string(
+	     file,
+	     &property_context,
+	     &local_descriptors,
+	     0x3707,
+	     filename,
+	     filename_length ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pff_generate_property_context_add_record(
+	     &property_context,
+	     0x370b,
+	     PFF_GENERATE_VALUE_TYPE_INTEGER_32BIT_SIGNED,
+	     0xffffffffUL ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pff_generate_property_context_write(
+	     file,
+	     &property_context,
+	     &data_identifier ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pff_generate_local_descriptors_write(
+	     file,
+	     &local_descriptors,
+	     &local_descriptors_identifier ) != 1 )
+	{
+		goto on_error;
+	}
+	pff_generate_local_descriptors_append(
+	 message_local_descriptors,
+	 attachment_identifier,
+	 data_identifier,
+	 local_descriptors_identifier );
+
+	if( pff_generate_table_context_append_row(
+	     attachments_table,
+	     &row_data ) != 1 )
+	{
+		goto on_error;
+	}
+	pff_generate_table_context_set_32bit(
+	 attachments_table,
+	 row_data,
+	 0,
+	 attachment_identifier );
+	pff_generate_table_context_set_32bit(
+	 attachments_table,
+	 row_data,
+	 1,
+	 attachment_identifier );
+	pff_generate_table_context_set_32bit(
+	 attachments_table,
+	 row_data,
+	 2,
+	 (uint32_t) file->options->attachment_size );
+	pff_generate_table_context_set_32bit(
+	 attachments_table,
+	 row_data,
+	 3,
+	 1 );
+
+	if( pff_generate_table_context_set_string(
+	     attachments_table,
+	     row_data,
+	     4,
+	     filename,
+	     filename_length ) != 1 )
+	{
+		goto on_error;
+	}
+	file->number_of_attachments++;
+
+	result = 1;
+
+on_error:
+	if( attachment_data != NULL )
+	{
+		free(
+		 attachment_data );
+	}
+	if( result != 1 )
+	{
+		pff_generate_heap_free(
+		 &( property_context.heap ) );
+	}
+	return( result );
+}
+
+/* Writes a message and appends it to the folder contents table
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_write_message(
+     pff_generate_file_t *file,
+     uint32_t folder_identifier,
+     pff_generate_table_context_t *contents_table,
+     int message_index )
+{
+	char property_name[ 64 ];
+	char subject[ 128 ];
+
+	pff_generate_local_descriptors_t local_descriptors;
+	pff_generate_property_context_t property_context;
+	pff_generate_table_context_t attachments_table;
+
+	char *body                            = NULL;
+	uint8_t *row_data                     = NULL;
+	size_t body_length                    = 0;
+	size_t property_name_length           = 0;
+	size_t subject_length                 = 0;
+	uint64_t attachments_identifier       = 0;
+	uint64_t data_identifier              = 0;
+	uint64_t delivery_time                = 0;
+	uint64_t local_descriptors_identifier = 0;
+	uint32_t message_identifier           = 0;
+	uint32_t message_size                 = 0;
+	int attachment_index                  = 0;
+	int property_index                    = 0;
+	int result                            = -1;
+
+	memory_set(
+	 &local_descriptors,
+	 0,
+	 sizeof( pff_generate_local_descriptors_t ) );
+
+	memory_set(
+	 &attachments_table,
+	 0,
+	 sizeof( pff_generate_table_context_t ) );
+
+	if( pff_generate_property_context_initialize(
+	     &property_context ) != 1 )
+	{
+		return( -1 );
+	}
+	message_identifier = pff_generate_get_descriptor_identifier(
+	                      file,
+	                      PFF_GENERATE_NODE_TYPE_MESSAGE );
+
+	delivery_time = PFF_GENERATE_BASE_FILETIME
+	              + ( (uint64_t) ( pff_generate_random( file ) % ( 365 * 24 * 60 ) ) * 600000000ULL );
+
+	subject_length = (size_t) snprintf(
+	                           subject,
+	                           128,
+	                           "Message %d: ",
+	                           message_index + 1 );
+
+	subject_length += pff_generate_text(
+	                   file,
+	                   &( subject[ subject_length ] ),
+	                   40 );
+
+	body = (char *) malloc(
+	                 file->options->body_size + 1 );
+
+	if( body == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create body.\n" );
+
+		goto on_error;
+	}
+	body_length = pff_generate_text(
+	               file,
+	               body,
+	               file->options->body_size );
+
+	message_size = (uint32_t) ( ( body_length * 2 ) + ( file->options->number_of_attachments * file->options->attachment_size ) );
+
+	if( file->options->number_of_attachments > 0 )
+	{
+		if( pff_generate_table_context_initialize(
+		     &attachments_table,
+		     pff_generate_attachments_columns,
+		     PFF_GENERATE_NUMBER_OF_COLUMNS( pff_generate_attachments_columns ) ) != 1 )
+		{
+			goto on_error;
+		}
+		for( attachment_index = 0;
+		     attachment_index < file->options->number_of_attachments;
+		     attachment_index++ )
+		{
+			if( pff_generate_write_attachment(
+			     file,
+			     &local_descriptors,
+			     &attachments_table,
+			     attachment_index ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		if( pff_generate_table_context_write(
+		     file,
+		     &attachments_table,
+		     &local_descriptors,
+		     &attachments_identifier ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( pff_generate_property_context_add_record(
+	     &property_context,
+	     0x0017,
+	     PFF_GENERATE_VALUE_TYPE_INTEGER_32BIT_SIGNED,
+	     1 ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pff_generate_property_context_add_string(
+	     file,
+	     &property_context,
+	     &local_descriptors,
+	     0x001a,
+	     "IPM.Note",
+	     8 ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pff_generate_property_context_add_string(
+	     file,
+	     &property_context,
+	     &local_descriptors,
+	     0x0037,
+	     subject,
+	     subject_length ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pff_generate_property_context_add_filetime(
+	     file,
+	     &property_context,
+	     &local_descriptors,
+	     0x0039,
+	     delivery_time ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pff_generate_property_context_add_string(
+	     file,
+	     &property_context,
+	     &local_descriptors,
+	     0x0c1a,
+	     "Benchmark Sender",
+	     16 ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pff_generate_property_context_add_filetime(
+	     file,
+	     &property_context,
+	     &local_descriptors,
+	     0x0e06,
+	     delivery_time ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pff_generate_property_context_add_record(
+	     &property_context,
+	     0x0e07,
+	     PFF_GENERATE_VALUE_TYPE_INTEGER_32BIT_SIGNED,
+	     ( file->options->number_of_attachments > 0 ) ? 0x00000013UL : 0x00000003UL ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pff_generate_property_context_add_record(
+	     &property_context,
+	     0x0e08,
+	     PFF_GENERATE_VALUE_TYPE_INTEGER_32BIT_SIGNED,
+	     message_size ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pff_generate_property_context_add_record(
+	     &property_context,
+	     0x0e1b,
+	     PFF_GENERATE_VALUE_TYPE_BOOLEAN,
+	     ( file->options->number_of_attachments > 0 ) ? 1 : 0 ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pff_generate_property_context_add_string(
+	     file,
+	     &property_context,
+	     &local_descriptors,
+	     0x1000,
+	     body,
+	     body_length ) != 1 )
+	{
+		goto on_error;
+	}
+	if( file->options->formatted_bodies != 0 )
+	{
+		if( pff_generate_property_context_add_formatted_bodies(
+		     file,
+		     &property_context,
+		     &local_descriptors,
+		     body,
+		     body_length ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( pff_generate_property_context_add_filetime(
+	     file,
+	     &property_context,
+	     &local_descriptors,
+	     0x3008,
+	     delivery_time ) != 1 )
+	{
+		goto on_error;
+	}
+	/* The named properties alternate between string and numeric values
+	 */
+	for( property_index = 0;
+	     property_index < file->options->number_of_named_properties;
+	     property_index++ )
+	{
+		if( ( property_index % 2 ) == 0 )
+		{
+			property_name_length = (size_t) snprintf(
+			                                 property_name,
+			                                 64,
+			                                 "Value %d of message %d",
+			                                 property_index,
+			                                 message_index + 1 );
+
+			result = pff_generate_property_context_add_string(
+			          file,
+			          &property_context,
+			          &local_descriptors,
+			          (uint16_t) ( 0x8000 + property_index ),
+			          property_name,
+			          property_name_length );
+		}
+		else
+		{
+			result = pff_generate_property_context_add_record(
+			          &property_context,
+			          (uint16_t) ( 0x8000 + property_index ),
+			          PFF_GENERATE_VALUE_TYPE_INTEGER_32BIT_SIGNED,
+			          pff_generate_random( file ) );
+		}
+		if( result != 1 )
+		{
+			result = -1;
+
+			goto on_error;
+		}
+	}
+	result = -1;
+
+	if( pff_generate_property_context_write(
+	     file,
+	     &property_context,
+	     &data_identifier ) != 1 )
+	{
+		goto on_error;
+	}
+	if( attachments_identifier != 0 )
+	{
+		pff_generate_local_descriptors_append(
+		 &local_descriptors,
+		 PFF_GENERATE_DESCRIPTOR_ATTACHMENTS,
+		 attachments_identifier,
+		 0 );
+	}
+	if( pff_generate_local_descriptors_write(
+	     file,
+	     &local_descriptors,
+	     &local_descriptors_identifier ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pff_generate_append_descriptor_entry(
+	     file,
+	     message_identifier,
+	     data_identifier,
+	     local_descriptors_identifier,
+	     folder_identifier ) != 1 )
+	{
+		goto on_error;
+	}
+	/* Deleted messages are not referenced by the contents table
+	 */
+	if( file->is_deleting == 0 )
+	{
+		if( pff_generate_table_context_append_row(
+		     contents_table,
+		     &row_data ) != 1 )
+		{
+			goto on_error;
+		}
+		pff_generate_table_context_set_32bit(
+		 contents_table,
+		 row_data,
+		 0,
+		 message_identifier );
+		pff_generate_table_context_set_32bit(
+		 contents_table,
+		 row_data,
+		 1,
+		 message_identifier );
+		pff_generate_table_context_set_64bit(
+		 contents_table,
+		 row_data,
+		 2,
+		 delivery_time );
+		pff_generate_table_context_set_32bit(
+		 contents_table,
+		 row_data,
+		 3,
+		 message_size );
+
+		if( pff_generate_table_context_set_string(
+		     contents_table,
+		     row_data,
+		     4,
+		     subject,
+		     subject_length ) != 1 )
+		{
+			goto on_error;
+		}
+		pff_generate_table_context_set_8bit(
+		 contents_table,
+		 row_data,
+		 5,
+		 ( file->options->number_of_attachments > 0 ) ? 1 : 0 );
+
+		if( pff_generate_table_context_set_string(
+		     contents_table,
+		     row_data,
+		     6,
+		     "IPM.Note",
+		     8 ) != 1 )
+		{
+			goto on_error;
+		}
+		pff_generate_table_context_set_64bit(
+		 contents_table,
+		 row_data,
+		 7,
+		 delivery_time );
+		file->number_of_messages++;
+	}
+	else
+	{
+		file->number_of_deleted_messages++;
+	}
+	result = 1;
+
+on_error:
+	if( body != NULL )
+	{
+		free(
+		 body );
+	}
+	if( attachments_table.rows != NULL )
+	{
+		free(
+		 attachments_table.rows );
+	}
+	pff_generate_heap_free(
+	 &( attachments_table.heap ) );
+
+	if( result != 1 )
+	{
+		pff_generate_heap_free(
+		 &( property_context.heap ) );
+	}
+	return( result );
+}
+
+/* Writes a folder, its messages and its sub folders
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_write_folder(
+     pff_generate_file_t *file,
+     int folder_index,
+     uint32_t folder_identifier,
+     uint32_t parent_identifier,
+     const char *folder_name,
+     int *number_of_messages )
+{
+	char sub_folder_names[ 4 ][ 32 ];
+
+	pff_generate_local_descriptors_t local_descriptors;
+	pff_generate_property_context_t property_context;
+	pff_generate_table_context_t table_context;
+
+	uint8_t *row_data                     = NULL;
+	uint64_t data_identifier              = 0;
+	uint64_t local_descriptors_identifier = 0;
+	uint32_t sub_folder_identifiers[ 4 ];
+	int sub_folder_number_of_messages[ 4 ];
+	int sub_folder_has_sub_folders[ 4 ];
+	int first_sub_folder_index            = 0;
+	int message_index                     = 0;
+	int number_of_sub_folders             = 0;
+	int sub_folder_index                  = 0;
+	int sub_folder_iterator               = 0;
+
+	*number_of_messages = 0;
+
+	/* The folders form a tree with 4 sub folders per folder,
+	 * folder index -1 represents the top of the personal folders
+	 */
+	first_sub_folder_index = ( folder_index + 1 ) * 4;
+
+	for( sub_folder_iterator = 0;
+	     sub_folder_iterator < 4;
+	     sub_folder_iterator++ )
+	{
+		sub_folder_index = first_sub_folder_index + sub_folder_iterator;
+
+		if( sub_folder_index >= file->options->number_of_folders )
+		{
+			break;
+		}
+		sub_folder_identifiers[ sub_folder_iterator ] = ( (uint32_t) ( PFF_GENERATE_FIRST_DESCRIPTOR_INDEX + sub_folder_index ) << 5 )
+		                                              | PFF_GENERATE_NODE_TYPE_FOLDER;
+
+		snprintf(
+		 sub_folder_names[ sub_folder_iterator ],
+		 32,
+		 "Folder %d",
+		 sub_folder_index + 1 );
+
+		if( pff_generate_write_folder(
+		     file,
+		     sub_folder_index,
+		     sub_folder_identifiers[ sub_folder_iterator ],
+		     folder_identifier,
+		     sub_folder_names[ sub_folder_iterator ],
+		     &( sub_folder_number_of_messages[ sub_folder_iterator ] ) ) != 1 )
+		{
+			return( -1 );
+		}
+		sub_folder_has_sub_folders[ sub_folder_iterator ] = ( ( ( sub_folder_index + 1 ) * 4 ) < file->options->number_of_folders );
+
+		number_of_sub_folders++;
+	}
+	/* The top of the personal folders contains no messages
+	 */
+	if( pff_generate_table_context_initialize(
+	     &table_context,
+	     pff_generate_sub_messages_columns,
+	     PFF_GENERATE_NUMBER_OF_COLUMNS( pff_generate_sub_messages_columns ) ) != 1 )
+	{
+		return( -1 );
+	}
+	if( folder_index >= 0 )
+	{
+		for( message_index = 0;
+		     message_index < file->options->number_of_messages;
+		     message_index++ )
+		{
+			file->is_deleting = (uint8_t) ( ( pff_generate_random( file ) % 100 ) < (uint32_t) file->options->deleted_percentage );
+
+			if( pff_generate_write_message(
+			     file,
+			     folder_identifier,
+			     &table_context,
+			     message_index ) != 1 )
+			{
+				goto on_error;
+			}
+			if( file->is_deleting == 0 )
+			{
+				*number_of_messages += 1;
+			}
+			file->is_deleting = 0;
+		}
+	}
+	if( pff_generate_write_table_descriptor(
+	     file,
+	     &table_context,
+	     folder_identifier - PFF_GENERATE_NODE_TYPE_FOLDER + PFF_GENERATE_NODE_TYPE_SUB_MESSAGES ) != 1 )
+	{
+		return( -1 );
+	}
+	if( pff_generate_table_context_initialize(
+	     &table_context,
+	     pff_generate_sub_folders_columns,
+	     PFF_GENERATE_NUMBER_OF_COLUMNS( pff_generate_sub_folders_columns ) ) != 1 )
+	{
+		return( -1 );
+	}
+	for( sub_folder_iterator = 0;
+	     sub_folder_iterator < number_of_sub_folders;
+	     sub_folder_iterator++ )
+	{
+		if( pff_generate_table_context_append_row(
+		     &table_context,
+		     &row_data ) != 1 )
+		{
+			goto on_error;
+		}
+		pff_generate_table_context_set_32bit(
+		 &table_context,
+		 row_data,
+		 0,
+		 sub_folder_identifiers[ sub_folder_iterator ] );
+		pff_generate_table_context_set_32bit(
+		 &table_context,
+		 row_data,
+		 1,
+		 sub_folder_identifiers[ sub_folder_iterator ] );
+
+		if( pff_generate_table_context_set_string(
+		     &table_context,
+		     row_data,
+		     2,
+		     sub_folder_names[ sub_folder_iterator ],
+		     strlen( sub_folder_names[ sub_folder_iterator ] ) ) != 1 )
+		{
+			goto on_error;
+		}
+		pff_generate_table_context_set_32bit(
+		 &table_context,
+		 row_data,
+		 3,
+		 (uint32_t) sub_folder_number_of_messages[ sub_folder_iterator ] );
+		pff_generate_table_context_set_32bit(
+		 &table_context,
+		 row_data,
+		 4,
+		 0 );
+		pff_generate_table_context_set_8bit(
+		 &table_context,
+		 row_data,
+		 5,
+		 (uint8_t) sub_folder_has_sub_folders[ sub_folder_iterator ] );
+	}
+	if( pff_generate_write_table_descriptor(
+	     file,
+	     &table_context,
+	     folder_identifier - PFF_GENERATE_NODE_TYPE_FOLDER + PFF_GENERATE_NODE_TYPE_SUB_FOLDERS ) != 1 )
+	{
+		return( -1 );
+	}
+	if( pff_generate_table_context_initialize(
+	     &table_context,
+	     pff_generate_sub_messages_columns,
+	     PFF_GENERATE_NUMBER_OF_COLUMNS( pff_generate_sub_messages_columns ) ) != 1 )
+	{
+		return( -1 );
+	}
+	if( pff_generate_write_table_descriptor(
+	     file,
+	     &table_context,
+	     folder_identifier - PFF_GENERATE_NODE_TYPE_FOLDER + PFF_GENERATE_NODE_TYPE_SUB_ASSOCIATED_CONTENTS ) != 1 )
+	{
+		return( -1 );
+	}
+	memory_set(
+	 &local_descriptors,
+	 0,
+	 sizeof( pff_generate_local_descriptors_t ) );
+
+	if( pff_generate_property_context_initialize(
+	     &property_context ) != 1 )
+	{
+		return( -1 );
+	}
+	if( pff_generate_property_context_add_string(
+	     file,
+	     &property_context,
+	     &local_descriptors,
+	     0x3001,
+	     folder_name,
+	     strlen( folder_name ) ) != 1 )
+	{
+		goto on_error_property_context;
+	}
+	if( pff_generate_property_context_add_record(
+	     &property_context,
+	     0x3602,
+	     PFF_GENERATE_VALUE_TYPE_INTEGER_32BIT_SIGNED,
+	     (uint32_t) *number_of_messages ) != 1 )
+	{
+		goto on_error_property_context;
+	}
+	if( pff_generate_property_context_add_record(
+	     &property_context,
+	     0x3603,
+	     PFF_GENERATE_VALUE_TYPE_INTEGER_32BIT_SIGNED,
+	     0 ) != 1 )
+	{
+		goto on_error_property_context;
+	}
+	if( pff_generate_property_context_add_record(
+	     &property_context,
+	     0x360a,
+	     PFF_GENERATE_VALUE_TYPE_BOOLEAN,
+	     ( number_of_sub_folders > 0 ) ? 1 : 0 ) != 1 )
+	{
+		goto on_error_property_context;
+	}
+	if( pff_generate_property_context_add_string(
+	     file,
+	     &property_context,
+	     &local_descriptors,
+	     0x3613,
+	     "IPF.Note",
+	     8 ) != 1 )
+	{
+		goto on_error_property_context;
+	}
+	if( pff_generate_property_context_write(
+	     file,
+	     &property_context,
+	     &data_identifier ) != 1 )
+	{
+		return( -1 );
+	}
+	if( pff_generate_local_descriptors_write(
+	     file,
+	     &local_descriptors,
+	     &local_descriptors_identifier ) != 1 )
+	{
+		return( -1 );
+	}
+	if( pff_generate_append_descriptor_entry(
+	     file,
+	     folder_identifier,
+	     data_identifier,
+	     local_descriptors_identifier,
+	     parent_identifier ) != 1 )
+	{
+		return( -1 );
+	}
+	file->number_of_folders++;
+
+	return( 1 );
+
+on_error:
+	if( table_context.rows != NULL )
+	{
+		free(
+		 table_context.rows );
+	}
+	pff_generate_heap_free(
+	 &( table_context.heap ) );
+
+	return( -1 );
+
+on_error_property_context:
+	pff_generate_heap_free(
+	 &( property_context.heap ) );
+
+	return( -1 );
+}
+
+/* Writes the root folder
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_write_root_folder(
+     pff_generate_file_t *file,
+     uint32_t top_of_personal_folders_identifier )
+{
+	pff_generate_local_descriptors_t local_descriptors;
+	pff_generate_property_context_t property_context;
+	pff_generate_table_context_t table_context;
+
+	uint8_t *row_data                     = NULL;
+	uint64_t data_identifier              = 0;
+	uint64_t local_descriptors_identifier = 0;
+
+	memory_set(
+	 &local_descriptors,
+	 0,
+	 sizeof( pff_generate_local_descriptors_t ) );
+
+	if( pff_generate_table_context_initialize(
+	     &table_context,
+	     pff_generate_sub_folders_columns,
+	     PFF_GENERATE_NUMBER_OF_COLUMNS( pff_generate_sub_folders_columns ) ) != 1 )
+	{
+		return( -1 );
+	}
+	if( pff_generate_table_context_append_row(
+	     &table_context,
+	     &row_data ) != 1 )
+	{
+		return( -1 );
+	}
+	pff_generate_table_context_set_32bit(
+	 &table_context,
+	 row_data,
+	 0,
+	 top_of_personal_folders_identifier );
+	pff_generate_table_context_set_32bit(
+	 &table_context,
+	 row_data,
+	 1,
+	 top_of_personal_folders_identifier );
+
+	if( pff_generate_table_context_set_string(
+	     &table_context,
+	     row_data,
+	     2,
+	     "Top of Personal Folders",
+	     23 ) != 1 )
+	{
+		return( -1 );
+	}
+	pff_generate_table_context_set_8bit(
+	 &table_context,
+	 row_data,
+	 5,
+	 ( file->options->number_of_folders > 0 ) ? 1 : 0 );
+
+	if( pff_generate_write_table_descriptor(
+	     file,
+	     &table_context,
+	     PFF_GENERATE_DESCRIPTOR_ROOT_FOLDER - PFF_GENERATE_NODE_TYPE_FOLDER + PFF_GENERATE_NODE_TYPE_SUB_FOLDERS ) != 1 )
+	{
+		return( -1 );
+	}
+	if( pff_generate_table_context_initialize(
+	     &table_context,
+	     pff_generate_sub_messages_columns,
+	     PFF_GENERATE_NUMBER_OF_COLUMNS( pff_generate_sub_messages_columns ) ) != 1 )
+	{
+		return( -1 );
+	}
+	if( pff_generate_write_table_descriptor(
+	     file,
+	     &table_context,
+	     PFF_GENERATE_DESCRIPTOR_ROOT_FOLDER - PFF_GENERATE_NODE_TYPE_FOLDER + PFF_GENERATE_NODE_TYPE_SUB_MESSAGES ) != 1 )
+	{
+		return( -1 );
+	}
+	if( pff_generate_table_context_initialize(
+	     &table_context,
+	     pff_generate_sub_messages_columns,
+	     PFF_GENERATE_NUMBER_OF_COLUMNS( pff_generate_sub_messages_columns ) ) != 1 )
+	{
+		return( -1 );
+	}
+	if( pff_generate_write_table_descriptor(
+	     file,
+	     &table_context,
+	     PFF_GENERATE_DESCRIPTOR_ROOT_FOLDER - PFF_GENERATE_NODE_TYPE_FOLDER + PFF_GENERATE_NODE_TYPE_SUB_ASSOCIATED_CONTENTS ) != 1 )
+	{
+		return( -1 );
+	}
+	if( pff_generate_property_context_initialize(
+	     &property_context ) != 1 )
+	{
+		return( -1 );
+	}
+	if( pff_generate_property_context_add_string(
+	     file,
+	     &property_context,
+	     &local_descriptors,
+	     0x3001,
+	     "",
+	     0 ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pff_generate_property_context_add_record(
+	     &property_context,
+	     0x3602,
+	     PFF_GENERATE_VALUE_TYPE_INTEGER_32BIT_SIGNED,
+	     0 ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pff_generate_property_context_add_record(
+	     &property_context,
+	     0x3603,
+	     PFF_GENERATE_VALUE_TYPE_INTEGER_32BIT_SIGNED,
+	     0 ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pff_generate_property_context_add_record(
+	     &property_context,
+	     0x360a,
+	     PFF_GENERATE_VALUE_TYPE_BOOLEAN,
+	     1 ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pff_generate_property_context_write(
+	     file,
+	     &property_context,
+	     &data_identifier ) != 1 )
+	{
+		return( -1 );
+	}
+	if( pff_generate_local_descriptors_write(
+	     file,
+	     &local_descriptors,
+	     &local_descriptors_identifier ) != 1 )
+	{
+		return( -1 );
+	}
+	/* The root folder is its own parent
+	 */
+	return( pff_generate_append_descriptor_entry(
+	         file,
+	         PFF_GENERATE_DESCRIPTOR_ROOT_FOLDER,
+	         data_identifier,
+	         local_descriptors_identifier,
+	         PFF_GENERATE_DESCRIPTOR_ROOT_FOLDER ) );
+
+on_error:
+	pff_generate_heap_free(
+	 &( property_context.heap ) );
+
+	return( -1 );
+}
+
+/* Writes the message store
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_write_message_store(
+     pff_generate_file_t *file,
+     uint32_t top_of_personal_folders_identifier )
+{
+	uint8_t entry_identifier[ 24 ];
+	uint8_t record_key[ 16 ];
+
+	pff_generate_local_descriptors_t local_descriptors;
+	pff_generate_property_context_t property_context;
+
+	uint64_t data_identifier              = 0;
+	uint64_t local_descriptors_identifier = 0;
+	int byte_index                        = 0;
+
+	memory_set(
+	 &local_descriptors,
+	 0,
+	 sizeof( pff_generate_local_descriptors_t ) );
+
+	for( byte_index = 0;
+	     byte_index < 16;
+	     byte_index++ )
+	{
+		record_key[ byte_index ] = (uint8_t) pff_generate_random( file );
+	}
+	/* The entry identifier consists of flags, the record key and the descriptor identifier
+	 */
+	memory_set(
+	 entry_identifier,
+	 0,
+	 4 );
+	memory_copy(
+	 &( entry_identifier[ 4 ] ),
+	 record_key,
+	 16 );
+	byte_stream_copy_from_uint32_little_endian(
+	 &( entry_identifier[ 20 ] ),
+	 top_of_personal_folders_identifier );
+
+	if( pff_generate_property_context_initialize(
+	     &property_context ) != 1 )
+	{
+		return( -1 );
+	}
+	if( pff_generate_property_context_add_data(
+	     file,
+	     &property_context,
+	     &local_descriptors,
+	     0x0ff9,
+	     PFF_GENERATE_VALUE_TYPE_BINARY_DATA,
+	     record_key,
+	     16 ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pff_generate_property_context_add_string(
+	     file,
+	     &property_context,
+	     &local_descriptors,
+	     0x3001,
+	     "Personal Folders",
+	     16 ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pff_generate_property_context_add_record(
+	     &property_context,
+	     0x35df,
+	     PFF_GENERATE_VALUE_TYPE_INTEGER_32BIT_SIGNED,
+	     0x00000089UL ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pff_generate_property_context_add_data(
+	     file,
+	     &property_context,
+	     &local_descriptors,
+	     0x35e0,
+	     PFF_GENERATE_VALUE_TYPE_BINARY_DATA,
+	     entry_identifier,
+	     24 ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pff_generate_property_context_write(
+	     file,
+	     &property_context,
+	     &data_identifier ) != 1 )
+	{
+		return( -1 );
+	}
+	if( pff_generate_local_descriptors_write(
+	     file,
+	     &local_descriptors,
+	     &local_descriptors_identifier ) != 1 )
+	{
+		return( -1 );
+	}
+	return( pff_generate_append_descriptor_entry(
+	         file,
+	         PFF_GENERATE_DESCRIPTOR_MESSAGE_STORE,
+	         data_identifier,
+	         local_descriptors_identifier,
+	         0 ) );
+
+on_error:
+	pff_generate_heap_free(
+	 &( property_context.heap ) );
+
+	return( -1 );
+}
+
+/* Writes the name to id map
+ * The even named properties are string named properties in the public strings class,
+ * the odd named properties are numeric named properties in a generator specific class
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_write_name_to_id_map(
+     pff_generate_file_t *file )
+{
+	char property_name[ 32 ];
+
+	pff_generate_local_descriptors_t local_descriptors;
+	pff_generate_property_context_t property_context;
+
+	uint8_t *entries_data                 = NULL;
+	uint8_t *strings_data                 = NULL;
+	size_t entries_data_size              = 0;
+	size_t property_name_length           = 0;
+	size_t strings_data_size              = 0;
+	uint64_t data_identifier              = 0;
+	uint64_t local_descriptors_identifier = 0;
+	int property_index                    = 0;
+	int result                            = -1;
+
+	if( file->options->number_of_named_properties == 0 )
+	{
+		return( 1 );
+	}
+	memory_set(
+	 &local_descriptors,
+	 0,
+	 sizeof( pff_generate_local_descriptors_t ) );
+
+	if( pff_generate_property_context_initialize(
+	     &property_context ) != 1 )
+	{
+		return( -1 );
+	}
+	entries_data = (uint8_t *) malloc(
+	                            8 * file->options->number_of_named_properties );
+	strings_data = (uint8_t *) malloc(
+	                            72 * file->options->number_of_named_properties );
+
+	if( ( entries_data == NULL )
+	 || ( strings_data == NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create name to id map data.\n" );
+
+		goto on_error;
+	}
+	for( property_index = 0;
+	     property_index < file->options->number_of_named_properties;
+	     property_index++ )
+	{
+		if( ( property_index % 2 ) == 0 )
+		{
+			property_name_length = (size_t) snprintf(
+			                                 property_name,
+			                                 32,
+			                                 "BenchProperty%d",
+			                                 property_index );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 &( entries_data[ entries_data_size ] ),
+			 strings_data_size );
+
+			/* Type 5 is a string named property in the public strings class
+			 */
+			byte_stream_copy_from_uint16_little_endian(
+			 &( entries_data[ entries_data_size + 4 ] ),
+			 5 );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 &( strings_data[ strings_data_size ] ),
+			 property_name_length * 2 );
+
+			strings_data_size += 4;
+
+			strings_data_size += pff_generate_string_to_utf16(
+			                      property_name,
+			                      property_name_length,
+			                      &( strings_data[ strings_data_size ] ) );
+
+			while( ( strings_data_size % 4 ) != 0 )
+			{
+				strings_data[ strings_data_size++ ] = 0;
+			}
+		}
+		else
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 &( entries_data[ entries_data_size ] ),
+			 0x00a00000UL + property_index );
+
+			/* Type 6 is a numeric named property in the first class identifier
+			 */
+			byte_stream_copy_from_uint16_little_endian(
+			 &( entries_data[ entries_data_size + 4 ] ),
+			 6 );
+		}
+		byte_stream_copy_from_uint16_little_endian(
+		 &( entries_data[ entries_data_size + 6 ] ),
+		 property_index );
+
+		entries_data_size += 8;
+	}
+	if( pff_generate_property_context_add_record(
+	     &property_context,
+	     0x0001,
+	     PFF_GENERATE_VALUE_TYPE_INTEGER_32BIT_SIGNED,
+	     251 ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pff_generate_property_context_add_data(
+	     file,
+	     &property_context,
+	     &local_descriptors,
+	     0x0002,
+	     PFF_GENERATE_VALUE_TYPE_BINARY_DATA,
+	     pff_generate_named_property_guid,
+	     16 ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pff_generate_property_context_add_data(
+	     file,
+	     &property_context,
+	     &local_descriptors,
+	     0x0003,
+	     PFF_GENERATE_VALUE_TYPE_BINARY_DATA,
+	     entries_data,
+	     entries_data_size ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pff_generate_property_context_add_data(
+	     file,
+	     &property_context,
+	     &local_descriptors,
+	     0x0004,
+	     PFF_GENERATE_VALUE_TYPE_BINARY_DATA,
+	     strings_data,
+	     strings_data_size ) != 1 )
+	{
+		goto on_error;
+	}
+	result = pff_generate_property_context_write(
+	          file,
+	          &property_context,
+	          &data_identifier );
+
+	if( result == 1 )
+	{
+		result = pff_generate_local_descriptors_write(
+		          file,
+		          &local_descriptors,
+		          &local_descriptors_identifier );
+	}
+	if( result == 1 )
+	{
+		result = pff_generate_append_descriptor_entry(
+		          file,
+		          PFF_GENERATE_DESCRIPTOR_NAME_TO_ID_MAP,
+		          data_identifier,
+		          local_descriptors_identifier,
+		          0 );
+	}
+	free(
+	 strings_data );
+	free(
+	 entries_data );
+
+	return( result );
+
+on_error:
+	if( strings_data != NULL )
+	{
+		free(
+		 strings_data );
+	}
+	if( entries_data != NULL )
+	{
+		free(
+		 entries_data );
+	}
+	pff_generate_heap_free(
+	 &( property_context.heap ) );
+
+	return( -1 );
+}
+
+/* Compares two offset index entries
+ * Returns -1, 0 or 1
+ */
+int pff_generate_offset_entry_compare(
+     const void *first,
+     const void *second )
+{
+	uint64_t first_identifier  = ( (const pff_generate_offset_entry_t *) first )->identifier;
+	uint64_t second_identifier = ( (const pff_generate_offset_entry_t *) second )->identifier;
+
+	if( first_identifier < second_identifier )
+	{
+		return( -1 );
+	}
+	else if( first_identifier > second_identifier )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Compares two descriptor index entries
+ * Returns -1, 0 or 1
+ */
+int pff_generate_descriptor_entry_compare(
+     const void *first,
+     const void *second )
+{
+	uint32_t first_identifier  = ( (const pff_generate_descriptor_entry_t *) first )->identifier;
+	uint32_t second_identifier = ( (const pff_generate_descriptor_entry_t *) second )->identifier;
+
+	if( first_identifier < second_identifier )
+	{
+		return( -1 );
+	}
+	else if( first_identifier > second_identifier )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Writes an index node page
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_write_index_node(
+     pff_generate_file_t *file,
+     uint8_t index_type,
+     uint8_t level,
+     const uint8_t *entries_data,
+     int number_of_entries,
+     int number_of_used_entries,
+     uint8_t entry_size,
+     uint8_t maximum_number_of_entries,
+     uint8_t is_allocated,
+     uint64_t *back_pointer,
+     uint64_t *file_offset )
+{
+	uint8_t node_data[ 512 ];
+
+	uint32_t crc32     = 0;
+	uint16_t signature = 0;
+
+	memory_set(
+	 node_data,
+	 0,
+	 512 );
+
+	*back_pointer = file->next_block_identifier;
+	*file_offset  = pff_generate_allocate(
+	                 file,
+	                 512,
+	                 512 );
+
+	file->next_block_identifier += 4;
+
+	signature = pff_generate_compute_signature(
+	             *file_offset,
+	             *back_pointer );
+
+	memory_copy(
+	 node_data,
+	 entries_data,
+	 (size_t) number_of_entries * entry_size );
+
+	if( file->options->file_type == PFF_GENERATE_FILE_TYPE_32BIT )
+	{
+		( (pff_index_node_32bit_t *) node_data )->number_of_entries         = (uint8_t) number_of_used_entries;
+		( (pff_index_node_32bit_t *) node_data )->maximum_number_of_entries = maximum_number_of_entries;
+		( (pff_index_node_32bit_t *) node_data )->entry_size                = entry_size;
+		( (pff_index_node_32bit_t *) node_data )->level                     = level;
+		( (pff_index_node_32bit_t *) node_data )->type                      = index_type;
+		( (pff_index_node_32bit_t *) node_data )->type_copy                 = index_type;
+
+		byte_stream_copy_from_uint16_little_endian(
+		 ( (pff_index_node_32bit_t *) node_data )->signature,
+		 signature );
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (pff_index_node_32bit_t *) node_data )->back_pointer,
+		 *back_pointer );
+
+		crc32 = pff_generate_crc32_calculate(
+		         node_data,
+		         500 );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (pff_index_node_32bit_t *) node_data )->crc,
+		 crc32 );
+	}
+	else
+	{
+		( (pff_index_node_64bit_t *) node_data )->number_of_entries         = (uint8_t) number_of_used_entries;
+		( (pff_index_node_64bit_t *) node_data )->maximum_number_of_entries = maximum_number_of_entries;
+		( (pff_index_node_64bit_t *) node_data )->entry_size                = entry_size;
+		( (pff_index_node_64bit_t *) node_data )->level                     = level;
+		( (pff_index_node_64bit_t *) node_data )->type                      = index_type;
+		( (pff_index_node_64bit_t *) node_data )->type_copy                 = index_type;
+
+		byte_stream_copy_from_uint16_little_endian(
+		 ( (pff_index_node_64bit_t *) node_data )->signature,
+		 signature );
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (pff_index_node_64bit_t *) node_data )->back_pointer,
+		 *back_pointer );
+
+		crc32 = pff_generate_crc32_calculate(
+		         node_data,
+		         496 );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (pff_index_node_64bit_t *) node_data )->crc,
+		 crc32 );
+	}
+	if( is_allocated != 0 )
+	{
+		if( pff_generate_set_allocated(
+		     file,
+		     *file_offset,
+		     512 ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( pff_generate_write_at_offset(
+	         file,
+	         *file_offset,
+	         node_data,
+	         512 ) );
+}
+
+/* Copies an index entry into the node entries data
+ */
+void pff_generate_copy_index_entry(
+      pff_generate_file_t *file,
+      uint8_t index_type,
+      const void *index_entry,
+      uint8_t *entry_data )
+{
+	const pff_generate_descriptor_entry_t *descriptor_entry = NULL;
+	const pff_generate_offset_entry_t *offset_entry         = NULL;
+
+	if( index_type == PFF_GENERATE_INDEX_TYPE_DESCRIPTOR )
+	{
+		descriptor_entry = (const pff_generate_descriptor_entry_t *) index_entry;
+
+		if( file->value_size == 4 )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 &( entry_data[ 0 ] ),
+			 descriptor_entry->identifier );
+			byte_stream_copy_from_uint32_little_endian(
+			 &( entry_data[ 4 ] ),
+			 descriptor_entry->data_identifier );
+			byte_stream_copy_from_uint32_little_endian(
+			 &( entry_data[ 8 ] ),
+			 descriptor_entry->local_descriptors_identifier );
+			byte_stream_copy_from_uint32_little_endian(
+			 &( entry_data[ 12 ] ),
+			 descriptor_entry->parent_identifier );
+		}
+		else
+		{
+			byte_stream_copy_from_uint64_little_endian(
+			 &( entry_data[ 0 ] ),
+			 (uint64_t) descriptor_entry->identifier );
+			byte_stream_copy_from_uint64_little_endian(
+			 &( entry_data[ 8 ] ),
+			 descriptor_entry->data_identifier );
+			byte_stream_copy_from_uint64_little_endian(
+			 &( entry_data[ 16 ] ),
+			 descriptor_entry->local_descriptors_identifier );
+			byte_stream_copy_from_uint32_little_endian(
+			 &( entry_data[ 24 ] ),
+			 descriptor_entry->parent_identifier );
+			byte_stream_copy_from_uint32_little_endian(
+			 &( entry_data[ 28 ] ),
+			 0 );
+		}
+	}
+	else
+	{
+		offset_entry = (const pff_generate_offset_entry_t *) index_entry;
+
+		if( file->value_size == 4 )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 &( entry_data[ 0 ] ),
+			 offset_entry->identifier );
+			byte_stream_copy_from_uint32_little_endian(
+			 &( entry_data[ 4 ] ),
+			 offset_entry->file_offset );
+			byte_stream_copy_from_uint16_little_endian(
+			 &( entry_data[ 8 ] ),
+			 offset_entry->data_size );
+			byte_stream_copy_from_uint16_little_endian(
+			 &( entry_data[ 10 ] ),
+			 2 );
+		}
+		else
+		{
+			byte_stream_copy_from_uint64_little_endian(
+			 &( entry_data[ 0 ] ),
+			 offset_entry->identifier );
+			byte_stream_copy_from_uint64_little_endian(
+			 &( entry_data[ 8 ] ),
+			 offset_entry->file_offset );
+			byte_stream_copy_from_uint16_little_endian(
+			 &( entry_data[ 16 ] ),
+			 offset_entry->data_size );
+			byte_stream_copy_from_uint16_little_endian(
+			 &( entry_data[ 18 ] ),
+			 2 );
+			byte_stream_copy_from_uint32_little_endian(
+			 &( entry_data[ 20 ] ),
+			 0 );
+		}
+	}
+}
+
+/* Writes an index tree
+ * The deleted entries are stored in the unused entries of the leaf nodes
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_write_index(
+     pff_generate_file_t *file,
+     uint8_t index_type,
+     uint64_t *root_back_pointer,
+     uint64_t *root_file_offset )
+{
+	uint8_t entries_data[ 512 ];
+
+	uint8_t *index_entries              = NULL;
+	uint64_t *node_back_pointers        = NULL;
+	uint64_t *node_file_offsets         = NULL;
+	uint64_t *node_first_identifiers    = NULL;
+	size_t deleted_entry_index          = 0;
+	size_t entry_index                  = 0;
+	size_t index_entry_size             = 0;
+	size_t live_entry_index             = 0;
+	size_t number_of_deleted_entries    = 0;
+	size_t number_of_index_entries      = 0;
+	size_t number_of_live_entries       = 0;
+	size_t number_of_nodes              = 0;
+	size_t number_of_child_nodes        = 0;
+	size_t child_node_index             = 0;
+	size_t node_index                   = 0;
+	size_t entries_in_node              = 0;
+	uint8_t branch_entry_size           = 0;
+	uint8_t leaf_entry_size             = 0;
+	uint8_t maximum_branch_entries      = 0;
+	uint8_t maximum_leaf_entries        = 0;
+	uint8_t level                       = 0;
+	int number_of_entries               = 0;
+	int result                          = -1;
+
+	if( file->options->file_type == PFF_GENERATE_FILE_TYPE_32BIT )
+	{
+		leaf_entry_size   = ( index_type == PFF_GENERATE_INDEX_TYPE_DESCRIPTOR ) ? 16 : 12;
+		branch_entry_size = 12;
+	}
+	else
+	{
+		leaf_entry_size   = ( index_type == PFF_GENERATE_INDEX_TYPE_DESCRIPTOR ) ? 32 : 24;
+		branch_entry_size = 24;
+	}
+	if( file->options->file_type == PFF_GENERATE_FILE_TYPE_32BIT )
+	{
+		maximum_leaf_entries   = (uint8_t) ( 496 / leaf_entry_size );
+		maximum_branch_entries = (uint8_t) ( 496 / branch_entry_size );
+	}
+	else
+	{
+		maximum_leaf_entries   = (uint8_t) ( 488 / leaf_entry_size );
+		maximum_branch_entries = (uint8_t) ( 488 / branch_entry_size );
+	}
+	if( index_type == PFF_GENERATE_INDEX_TYPE_DESCRIPTOR )
+	{
+		index_entries           = (uint8_t *) file->descriptor_entries;
+		index_entry_size        = sizeof( pff_generate_descriptor_entry_t );
+		number_of_index_entries = file->number_of_descriptor_entries;
+
+		qsort(
+		 file->descriptor_entries,
+		 number_of_index_entries,
+		 index_entry_size,
+		 &pff_generate_descriptor_entry_compare );
+	}
+	else
+	{
+		index_entries           = (uint8_t *) file->offset_entries;
+		index_entry_size        = sizeof( pff_generate_offset_entry_t );
+		number_of_index_entries = file->number_of_offset_entries;
+
+		qsort(
+		 file->offset_entries,
+		 number_of_index_entries,
+		 index_entry_size,
+		 &pff_generate_offset_entry_compare );
+	}
+	/* The deleted entries follow the live entries
+	 */
+	for( entry_index = 0;
+	     entry_index < number_of_index_entries;
+	     entry_index++ )
+	{
+		if( ( ( index_type == PFF_GENERATE_INDEX_TYPE_DESCRIPTOR )
+		  &&  ( file->descriptor_entries[ entry_index ].is_deleted == 0 ) )
+		 || ( ( index_type == PFF_GENERATE_INDEX_TYPE_OFFSET )
+		  &&  ( file->offset_entries[ entry_index ].is_deleted == 0 ) ) )
+		{
+			number_of_live_entries++;
+		}
+	}
+	number_of_deleted_entries = number_of_index_entries - number_of_live_entries;
+
+	if( number_of_live_entries == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Missing index entries.\n" );
+
+		return( -1 );
+	}
+	number_of_nodes = ( number_of_index_entries + maximum_leaf_entries - 1 ) / maximum_leaf_entries;
+
+	/* Deleted entries that do not fit in the leaf nodes are dropped
+	 */
+	if( number_of_nodes > number_of_live_entries )
+	{
+		number_of_nodes = number_of_live_entries;
+	}
+	node_back_pointers     = (uint64_t *) malloc(
+	                                       sizeof( uint64_t ) * number_of_nodes );
+	node_file_offsets      = (uint64_t *) malloc(
+	                                       sizeof( uint64_t ) * number_of_nodes );
+	node_first_identifiers = (uint64_t *) malloc(
+	                                       sizeof( uint64_t ) * number_of_nodes );
+
+	if( ( node_back_pointers == NULL )
+	 || ( node_file_offsets == NULL )
+	 || ( node_first_identifiers == NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create index nodes.\n" );
+
+		goto on_error;
+	}
+	for( node_index = 0;
+	     node_index < number_of_nodes;
+	     node_index++ )
+	{
+		entries_in_node = number_of_live_entries / number_of_nodes;
+
+		if( node_index < ( number_of_live_entries % number_of_nodes ) )
+		{
+			entries_in_node++;
+		}
+		number_of_entries = 0;
+
+		memory_set(
+		 entries_data,
+		 0,
+		 512 );
+
+		while( number_of_entries < (int) entries_in_node )
+		{
+			if( ( ( index_type == PFF_GENERATE_INDEX_TYPE_DESCRIPTOR )
+			  &&  ( file->descriptor_entries[ live_entry_index ].is_deleted == 0 ) )
+			 || ( ( index_type == PFF_GENERATE_INDEX_TYPE_OFFSET )
+			  &&  ( file->offset_entries[ live_entry_index ].is_deleted == 0 ) ) )
+			{
+				if( number_of_entries == 0 )
+				{
+					if( index_type == PFF_GENERATE_INDEX_TYPE_DESCRIPTOR )
+					{
+						node_first_identifiers[ node_index ] = file->descriptor_entries[ live_entry_index ].identifier;
+					}
+					else
+					{
+						node_first_identifiers[ node_index ] = file->offset_entries[ live_entry_index ].identifier;
+					}
+				}
+				pff_generate_copy_index_entry(
+				 file,
+				 index_type,
+				 &( index_entries[ live_entry_index * index_entry_size ] ),
+				 &( entries_data[ number_of_entries * leaf_entry_size ] ) );
+
+				number_of_entries++;
+			}
+			live_entry_index++;
+		}
+		entries_in_node = (size_t) number_of_entries;
+
+		while( ( number_of_deleted_entries > 0 )
+		    && ( entries_in_node < maximum_leaf_entries ) )
+		{
+			while( ( ( index_type == PFF_GENERATE_INDEX_TYPE_DESCRIPTOR )
+			     &&  ( file->descriptor_entries[ deleted_entry_index ].is_deleted == 0 ) )
+			    || ( ( index_type == PFF_GENERATE_INDEX_TYPE_OFFSET )
+			     &&  ( file->offset_entries[ deleted_entry_index ].is_deleted == 0 ) ) )
+			{
+				deleted_entry_index++;
+			}
+			pff_generate_copy_index_entry(
+			 file,
+			 index_type,
+			 &( index_entries[ deleted_entry_index * index_entry_size ] ),
+			 &( entries_data[ entries_in_node * leaf_entry_size ] ) );
+
+			deleted_entry_index++;
+			entries_in_node++;
+			number_of_deleted_entries--;
+		}
+		if( pff_generate_write_index_node(
+		     file,
+		     index_type,
+		     0,
+		     entries_data,
+		     (int) entries_in_node,
+		     number_of_entries,
+		     leaf_entry_size,
+		     maximum_leaf_entries,
+		     1,
+		     &( node_back_pointers[ node_index ] ),
+		     &( node_file_offsets[ node_index ] ) ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	/* Build the branch levels until a single root node remains
+	 */
+	while( number_of_nodes > 1 )
+	{
+		level++;
+
+		number_of_child_nodes = number_of_nodes;
+		number_of_nodes       = ( number_of_child_nodes + maximum_branch_entries - 1 ) / maximum_branch_entries;
+		child_node_index      = 0;
+
+		for( node_index = 0;
+		     node_index < number_of_nodes;
+		     node_index++ )
+		{
+			entries_in_node = number_of_child_nodes / number_of_nodes;
+
+			if( node_index < ( number_of_child_nodes % number_of_nodes ) )
+			{
+				entries_in_node++;
+			}
+			memory_set(
+			 entries_data,
+			 0,
+			 512 );
+
+			for( number_of_entries = 0;
+			     number_of_entries < (int) entries_in_node;
+			     number_of_entries++ )
+			{
+				if( file->value_size == 4 )
+				{
+					byte_stream_copy_from_uint32_little_endian(
+					 &( entries_data[ number_of_entries * branch_entry_size ] ),
+					 node_first_identifiers[ child_node_index ] );
+					byte_stream_copy_from_uint32_little_endian(
+					 &( entries_data[ ( number_of_entries * branch_entry_size ) + 4 ] ),
+					 node_back_pointers[ child_node_index ] );
+					byte_stream_copy_from_uint32_little_endian(
+					 &( entries_data[ ( number_of_entries * branch_entry_size ) + 8 ] ),
+					 node_file_offsets[ child_node_index ] );
+				}
+				else
+				{
+					byte_stream_copy_from_uint64_little_endian(
+					 &( entries_data[ number_of_entries * branch_entry_size ] ),
+					 node_first_identifiers[ child_node_index ] );
+					byte_stream_copy_from_uint64_little_endian(
+					 &( entries_data[ ( number_of_entries * branch_entry_size ) + 8 ] ),
+					 node_back_pointers[ child_node_index ] );
+					byte_stream_copy_from_uint64_little_endian(
+					 &( entries_data[ ( number_of_entries * branch_entry_size ) + 16 ] ),
+					 node_file_offsets[ child_node_index ] );
+				}
+				if( number_of_entries == 0 )
+				{
+					node_first_identifiers[ node_index ] = node_first_identifiers[ child_node_index ];
+				}
+				child_node_index++;
+			}
+			if( pff_generate_write_index_node(
+			     file,
+			     index_type,
+			     level,
+			     entries_data,
+			     number_of_entries,
+			     number_of_entries,
+			     branch_entry_size,
+			     maximum_branch_entries,
+			     1,
+			     &( node_back_pointers[ node_index ] ),
+			     &( node_file_offsets[ node_index ] ) ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+	}
+	*root_back_pointer = node_back_pointers[ 0 ];
+	*root_file_offset  = node_file_offsets[ 0 ];
+
+	result = 1;
+
+on_error:
+	if( node_first_identifiers != NULL )
+	{
+		free(
+		 node_first_identifiers );
+	}
+	if( node_file_offsets != NULL )
+	{
+		free(
+		 node_file_offsets );
+	}
+	if( node_back_pointers != NULL )
+	{
+		free(
+		 node_back_pointers );
+	}
+	return( result );
+}
+
+/* Writes the deleted entries of an index as stale leaf nodes in unallocated space
+ * This mimics the index nodes that remain behind after the index was rebalanced
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_write_stale_index_nodes(
+     pff_generate_file_t *file,
+     uint8_t index_type )
+{
+	uint8_t entries_data[ 512 ];
+
+	uint8_t *index_entries       = NULL;
+	uint64_t back_pointer        = 0;
+	uint64_t file_offset         = 0;
+	size_t entry_index           = 0;
+	size_t index_entry_size      = 0;
+	size_t number_of_entries     = 0;
+	uint8_t is_deleted           = 0;
+	uint8_t leaf_entry_size      = 0;
+	uint8_t maximum_leaf_entries = 0;
+	int entries_in_node          = 0;
+
+	if( file->options->file_type == PFF_GENERATE_FILE_TYPE_32BIT )
+	{
+		leaf_entry_size      = ( index_type == PFF_GENERATE_INDEX_TYPE_DESCRIPTOR ) ? 16 : 12;
+		maximum_leaf_entries = (uint8_t) ( 496 / leaf_entry_size );
+	}
+	else
+	{
+		leaf_entry_size      = ( index_type == PFF_GENERATE_INDEX_TYPE_DESCRIPTOR ) ? 32 : 24;
+		maximum_leaf_entries = (uint8_t) ( 488 / leaf_entry_size );
+	}
+	if( index_type == PFF_GENERATE_INDEX_TYPE_DESCRIPTOR )
+	{
+		index_entries     = (uint8_t *) file->descriptor_entries;
+		index_entry_size  = sizeof( pff_generate_descriptor_entry_t );
+		number_of_entries = file->number_of_descriptor_entries;
+	}
+	else
+	{
+		index_entries     = (uint8_t *) file->offset_entries;
+		index_entry_size  = sizeof( pff_generate_offset_entry_t );
+		number_of_entries = file->number_of_offset_entries;
+	}
+	memory_set(
+	 entries_data,
+	 0,
+	 512 );
+
+	for( entry_index = 0;
+	     entry_index <= number_of_entries;
+	     entry_index++ )
+	{
+		if( entry_index < number_of_entries )
+		{
+			if( index_type == PFF_GENERATE_INDEX_TYPE_DESCRIPTOR )
+			{
+				is_deleted = file->descriptor_entries[ entry_index ].is_deleted;
+			}
+			else
+			{
+				is_deleted = file->offset_entries[ entry_index ].is_deleted;
+			}
+			if( is_deleted != 0 )
+			{
+				pff_generate_copy_index_entry(
+				 file,
+				 index_type,
+				 &( index_entries[ entry_index * index_entry_size ] ),
+				 &( entries_data[ entries_in_node * leaf_entry_size ] ) );
+
+				entries_in_node++;
+			}
+		}
+		if( ( entries_in_node == (int) maximum_leaf_entries )
+		 || ( ( entry_index == number_of_entries )
+		  &&  ( entries_in_node > 0 ) ) )
+		{
+			if( pff_generate_write_index_node(
+			     file,
+			     index_type,
+			     0,
+			     entries_data,
+			     entries_in_node,
+			     entries_in_node,
+			     leaf_entry_size,
+			     maximum_leaf_entries,
+			     0,
+			     &back_pointer,
+			     &file_offset ) != 1 )
+			{
+				return( -1 );
+			}
+			memory_set(
+			 entries_data,
+			 0,
+			 512 );
+
+			entries_in_node = 0;
+		}
+	}
+	return( 1 );
+}
+
+/* Writes an allocation table page
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_write_allocation_table(
+     pff_generate_file_t *file,
+     uint8_t allocation_table_type,
+     uint64_t file_offset,
+     const uint8_t *table_data )
+{
+	uint8_t page_data[ 512 ];
+
+	uint8_t *table_data_copy = NULL;
+	uint32_t crc32           = 0;
+	uint16_t signature       = 0;
+
+	memory_set(
+	 page_data,
+	 0,
+	 512 );
+
+	signature = pff_generate_compute_signature(
+	             file_offset,
+	             file_offset );
+
+	if( file->options->file_type == PFF_GENERATE_FILE_TYPE_32BIT )
+	{
+		table_data_copy = ( (pff_allocation_table_32bit_t *) page_data )->data;
+	}
+	else
+	{
+		table_data_copy = ( (pff_allocation_table_64bit_t *) page_data )->data;
+	}
+	memory_copy(
+	 table_data_copy,
+	 table_data,
+	 496 );
+
+	crc32 = pff_generate_crc32_calculate(
+	         table_data_copy,
+	         496 );
+
+	if( file->options->file_type == PFF_GENERATE_FILE_TYPE_32BIT )
+	{
+		( (pff_allocation_table_32bit_t *) page_data )->type      = allocation_table_type;
+		( (pff_allocation_table_32bit_t *) page_data )->type_copy = allocation_table_type;
+
+		byte_stream_copy_from_uint16_little_endian(
+		 ( (pff_allocation_table_32bit_t *) page_data )->signature,
+		 signature );
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (pff_allocation_table_32bit_t *) page_data )->back_pointer,
+		 file_offset );
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (pff_allocation_table_32bit_t *) page_data )->crc,
+		 crc32 );
+	}
+	else
+	{
+		( (pff_allocation_table_64bit_t *) page_data )->type      = allocation_table_type;
+		( (pff_allocation_table_64bit_t *) page_data )->type_copy = allocation_table_type;
+
+		byte_stream_copy_from_uint16_little_endian(
+		 ( (pff_allocation_table_64bit_t *) page_data )->signature,
+		 signature );
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (pff_allocation_table_64bit_t *) page_data )->crc,
+		 crc32 );
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (pff_allocation_table_64bit_t *) page_data )->back_pointer,
+		 file_offset );
+	}
+	return( pff_generate_write_at_offset(
+	         file,
+	         file_offset,
+	         page_data,
+	         512 ) );
+}
+
+/* Writes the data and page allocation tables
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_write_allocation_tables(
+     pff_generate_file_t *file,
+     uint64_t *file_size,
+     uint64_t *last_allocation_table_offset,
+     uint64_t *total_available_data_size )
+{
+	uint8_t table_data[ 496 ];
+
+	uint64_t allocation_table_index  = 0;
+	uint64_t allocation_table_offset = 0;
+	uint64_t table_end_offset        = 0;
+	size_t bitmap_offset             = 0;
+	size_t byte_index                = 0;
+	uint8_t bit_index                = 0;
+
+	*total_available_data_size = 0;
+
+	for( allocation_table_index = 0;
+	     1;
+	     allocation_table_index++ )
+	{
+		allocation_table_offset = PFF_GENERATE_ALLOCATION_TABLE_OFFSET
+		                        + ( allocation_table_index * PFF_GENERATE_DATA_ALLOCATION_TABLE_COVERAGE );
+
+		if( allocation_table_offset >= *file_size )
+		{
+			break;
+		}
+		table_end_offset = allocation_table_offset + 512;
+
+		if( ( allocation_table_index % PFF_GENERATE_PAGE_ALLOCATION_TABLE_INTERVAL ) == 0 )
+		{
+			table_end_offset += 512;
+		}
+		if( pff_generate_set_allocated(
+		     file,
+		     allocation_table_offset,
+		     table_end_offset - allocation_table_offset ) != 1 )
+		{
+			return( -1 );
+		}
+		if( table_end_offset > *file_size )
+		{
+			*file_size = table_end_offset;
+		}
+		bitmap_offset = (size_t) ( allocation_table_offset / ( 64 * 8 ) );
+
+		for( byte_index = 0;
+		     byte_index < 496;
+		     byte_index++ )
+		{
+			if( ( bitmap_offset + byte_index ) < file->allocation_bitmap_size )
+			{
+				table_data[ byte_index ] = file->allocation_bitmap[ bitmap_offset + byte_index ];
+			}
+			else
+			{
+				table_data[ byte_index ] = 0;
+			}
+			for( bit_index = 0;
+			     bit_index < 8;
+			     bit_index++ )
+			{
+				if( ( table_data[ byte_index ] & ( 0x80 >> bit_index ) ) == 0 )
+				{
+					*total_available_data_size += 64;
+				}
+			}
+		}
+		if( pff_generate_write_allocation_table(
+		     file,
+		     PFF_GENERATE_ALLOCATION_TABLE_TYPE_DATA,
+		     allocation_table_offset,
+		     table_data ) != 1 )
+		{
+			return( -1 );
+		}
+		*last_allocation_table_offset = allocation_table_offset;
+
+		/* The page allocation tables mark all pages as allocated
+		 */
+		if( ( allocation_table_index % PFF_GENERATE_PAGE_ALLOCATION_TABLE_INTERVAL ) == 0 )
+		{
+			memory_set(
+			 table_data,
+			 0xff,
+			 496 );
+
+			if( pff_generate_write_allocation_table(
+			     file,
+			     PFF_GENERATE_ALLOCATION_TABLE_TYPE_PAGE,
+			     allocation_table_offset + 512,
+			     table_data ) != 1 )
+			{
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Writes the file header
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_write_file_header(
+     pff_generate_file_t *file,
+     uint64_t file_size,
+     uint64_t last_allocation_table_offset,
+     uint64_t total_available_data_size,
+     uint64_t descriptor_index_back_pointer,
+     uint64_t descriptor_index_root_node_offset,
+     uint64_t offset_index_back_pointer,
+     uint64_t offset_index_root_node_offset )
+{
+	uint8_t file_header[ 564 ];
+
+	pff_file_header_data_32bit_t *file_header_data_32bit = NULL;
+	pff_file_header_data_64bit_t *file_header_data_64bit = NULL;
+	uint8_t *high_water_marks                            = NULL;
+	uint32_t crc32                                       = 0;
+	uint32_t seed_value                                  = 0;
+	int node_type                                        = 0;
+
+	memory_set(
+	 file_header,
+	 0,
+	 564 );
+
+	seed_value = pff_generate_random( file );
+
+	memory_copy(
+	 ( (pff_file_header_t *) file_header )->signature,
+	 "!BDN",
+	 4 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (pff_file_header_t *) file_header )->content_type,
+	 file->options->content_type );
+
+	if( file->options->file_type == PFF_GENERATE_FILE_TYPE_32BIT )
+	{
+		byte_stream_copy_from_uint16_little_endian(
+		 ( (pff_file_header_t *) file_header )->data_version,
+		 0x000e );
+	}
+	else
+	{
+		byte_stream_copy_from_uint16_little_endian(
+		 ( (pff_file_header_t *) file_header )->data_version,
+		 0x0017 );
+	}
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (pff_file_header_t *) file_header )->content_version,
+	 19 );
+
+	( (pff_file_header_t *) file_header )->creation_platform = 0x01;
+	( (pff_file_header_t *) file_header )->access_platform   = 0x01;
+
+	if( file->options->file_type == PFF_GENERATE_FILE_TYPE_32BIT )
+	{
+		file_header_data_32bit = (pff_file_header_data_32bit_t *) &( file_header[ sizeof( pff_file_header_t ) ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 file_header_data_32bit->next_index_pointer,
+		 file->next_block_identifier );
+		byte_stream_copy_from_uint32_little_endian(
+		 file_header_data_32bit->next_index_back_pointer,
+		 file->next_block_identifier );
+		byte_stream_copy_from_uint32_little_endian(
+		 file_header_data_32bit->seed_value,
+		 seed_value );
+		byte_stream_copy_from_uint32_little_endian(
+		 file_header_data_32bit->file_size,
+		 file_size );
+		byte_stream_copy_from_uint32_little_endian(
+		 file_header_data_32bit->last_data_allocation_table_offset,
+		 last_allocation_table_offset );
+		byte_stream_copy_from_uint32_little_endian(
+		 file_header_data_32bit->total_available_data_size,
+		 total_available_data_size );
+		byte_stream_copy_from_uint32_little_endian(
+		 file_header_data_32bit->descriptor_index_back_pointer,
+		 descriptor_index_back_pointer );
+		byte_stream_copy_from_uint32_little_endian(
+		 file_header_data_32bit->descriptor_index_root_node_offset,
+		 descriptor_index_root_node_offset );
+		byte_stream_copy_from_uint32_little_endian(
+		 file_header_data_32bit->offset_index_back_pointer,
+		 offset_index_back_pointer );
+		byte_stream_copy_from_uint32_little_endian(
+		 file_header_data_32bit->offset_index_root_node_offset,
+		 offset_index_root_node_offset );
+
+		file_header_data_32bit->allocation_table_validation_type = 0x02;
+		file_header_data_32bit->sentinal                         = 0x80;
+		file_header_data_32bit->encryption_type                  = file->options->encryption_type;
+
+		memory_set(
+		 file_header_data_32bit->initial_data_free_map,
+		 0xff,
+		 128 );
+		memory_set(
+		 file_header_data_32bit->initial_page_free_map,
+		 0xff,
+		 128 );
+
+		high_water_marks = file_header_data_32bit->descriptor_index_high_water_marks;
+	}
+	else
+	{
+		file_header_data_64bit = (pff_file_header_data_64bit_t *) &( file_header[ sizeof( pff_file_header_t ) ] );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 file_header_data_64bit->next_index_back_pointer,
+		 file->next_block_identifier );
+		byte_stream_copy_from_uint32_little_endian(
+		 file_header_data_64bit->seed_value,
+		 seed_value );
+		byte_stream_copy_from_uint64_little_endian(
+		 file_header_data_64bit->file_size,
+		 file_size );
+		byte_stream_copy_from_uint64_little_endian(
+		 file_header_data_64bit->last_data_allocation_table_offset,
+		 last_allocation_table_offset );
+		byte_stream_copy_from_uint64_little_endian(
+		 file_header_data_64bit->total_available_data_size,
+		 total_available_data_size );
+		byte_stream_copy_from_uint64_little_endian(
+		 file_header_data_64bit->descriptor_index_back_pointer,
+		 descriptor_index_back_pointer );
+		byte_stream_copy_from_uint64_little_endian(
+		 file_header_data_64bit->descriptor_index_root_node_offset,
+		 descriptor_index_root_node_offset );
+		byte_stream_copy_from_uint64_little_endian(
+		 file_header_data_64bit->offset_index_back_pointer,
+		 offset_index_back_pointer );
+		byte_stream_copy_from_uint64_little_endian(
+		 file_header_data_64bit->offset_index_root_node_offset,
+		 offset_index_root_node_offset );
+		byte_stream_copy_from_uint64_little_endian(
+		 file_header_data_64bit->next_index_pointer,
+		 file->next_block_identifier );
+
+		file_header_data_64bit->allocation_table_validation_type = 0x02;
+		file_header_data_64bit->sentinal                         = 0x80;
+		file_header_data_64bit->encryption_type                  = file->options->encryption_type;
+
+		memory_set(
+		 file_header_data_64bit->initial_data_free_map,
+		 0xff,
+		 128 );
+		memory_set(
+		 file_header_data_64bit->initial_page_free_map,
+		 0xff,
+		 128 );
+
+		high_water_marks = file_header_data_64bit->descriptor_index_high_water_marks;
+	}
+	for( node_type = 0;
+	     node_type < 32;
+	     node_type++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( high_water_marks[ node_type * 4 ] ),
+		 ( file->high_water_marks[ node_type ] << 5 ) | (uint32_t) node_type );
+	}
+	crc32 = pff_generate_crc32_calculate(
+	         &( file_header[ 8 ] ),
+	         471 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (pff_file_header_t *) file_header )->crc,
+	 crc32 );
+
+	if( file->options->file_type == PFF_GENERATE_FILE_TYPE_64BIT )
+	{
+		crc32 = pff_generate_crc32_calculate(
+		         &( file_header[ 8 ] ),
+		         516 );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 file_header_data_64bit->crc,
+		 crc32 );
+	}
+	return( pff_generate_write_at_offset(
+	         file,
+	         0,
+	         file_header,
+	         564 ) );
+}
+
+/* Generates the file
+ * Returns 1 if successful or -1 on error
+ */
+int pff_generate_file_write(
+     pff_generate_file_t *file )
+{
+	uint8_t padding[ 512 ];
+
+	uint64_t descriptor_index_back_pointer     = 0;
+	uint64_t descriptor_index_root_node_offset = 0;
+	uint64_t file_size                         = 0;
+	uint64_t last_allocation_table_offset      = 0;
+	uint64_t offset_index_back_pointer         = 0;
+	uint64_t offset_index_root_node_offset     = 0;
+	uint64_t total_available_data_size         = 0;
+	uint32_t top_of_personal_folders           = 0;
+	int number_of_messages                     = 0;
+
+	/* The top of the personal folders uses a descriptor index below the generated folders
+	 */
+	top_of_personal_folders = ( ( PFF_GENERATE_FIRST_DESCRIPTOR_INDEX - 1 ) << 5 ) | PFF_GENERATE_NODE_TYPE_FOLDER;
+
+	if( pff_generate_write_message_store(
+	     file,
+	     top_of_personal_folders ) != 1 )
+	{
+		return( -1 );
+	}
+	if( pff_generate_write_name_to_id_map(
+	     file ) != 1 )
+	{
+		return( -1 );
+	}
+	if( pff_generate_write_root_folder(
+	     file,
+	     top_of_personal_folders ) != 1 )
+	{
+		return( -1 );
+	}
+	if( pff_generate_write_folder(
+	     file,
+	     -1,
+	     top_of_personal_folders,
+	     PFF_GENERATE_DESCRIPTOR_ROOT_FOLDER,
+	     "Top of Personal Folders",
+	     &number_of_messages ) != 1 )
+	{
+		return( -1 );
+	}
+	while( file->number_of_pending_blocks > 0 )
+	{
+		if( pff_generate_place_pending_block(
+		     file ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	if( pff_generate_write_index(
+	     file,
+	     PFF_GENERATE_INDEX_TYPE_DESCRIPTOR,
+	     &descriptor_index_back_pointer,
+	     &descriptor_index_root_node_offset ) != 1 )
+	{
+		return( -1 );
+	}
+	if( pff_generate_write_index(
+	     file,
+	     PFF_GENERATE_INDEX_TYPE_OFFSET,
+	     &offset_index_back_pointer,
+	     &offset_index_root_node_offset ) != 1 )
+	{
+		return( -1 );
+	}
+	if( file->number_of_deleted_messages > 0 )
+	{
+		if( pff_generate_write_stale_index_nodes(
+		     file,
+		     PFF_GENERATE_INDEX_TYPE_DESCRIPTOR ) != 1 )
+		{
+			return( -1 );
+		}
+		if( pff_generate_write_stale_index_nodes(
+		     file,
+		     PFF_GENERATE_INDEX_TYPE_OFFSET ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	file_size = ( ( file->current_offset + 511 ) / 512 ) * 512;
+
+	if( pff_generate_write_allocation_tables(
+	     file,
+	     &file_size,
+	     &last_allocation_table_offset,
+	     &total_available_data_size ) != 1 )
+	{
+		return( -1 );
+	}
+	/* Make sure the file is extended to its full size
+	 */
+	memory_set(
+	 padding,
+	 0,
+	 512 );
+
+	if( file_size > file->current_offset )
+	{
+		if( pff_generate_write_at_offset(
+		     file,
+		     file_size - 1,
+		     padding,
+		     1 ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( pff_generate_write_file_header(
+	         file,
+	         file_size,
+	         last_allocation_table_offset,
+	         total_available_data_size,
+	         descriptor_index_back_pointer,
+	         descriptor_index_root_node_offset,
+	         offset_index_back_pointer,
+	         offset_index_root_node_offset ) );
+}
+
+/* The main program
+ */
+int main( int argc, char * const argv[] )
+{
+	pff_generate_options_t options;
+	pff_generate_file_t file;
+
+	const char *target_filename = NULL;
+	uint64_t message_size       = 0;
+	int option                  = 0;
+	int result                  = 0;
+
+	memory_set(
+	 &options,
+	 0,
+	 sizeof( pff_generate_options_t ) );
+
+	options.file_type                  = PFF_GENERATE_FILE_TYPE_64BIT;
+	options.content_type               = 0x4d53;
+	options.encryption_type            = PFF_GENERATE_ENCRYPTION_TYPE_COMPRESSIBLE;
+	options.number_of_folders          = 4;
+	options.number_of_messages         = 64;
+	options.number_of_attachments      = 1;
+	options.attachment_size            = 16384;
+	options.body_size                  = 2048;
+	options.number_of_named_properties = 8;
+	options.fragmentation_window       = 1;
+	options.seed                       = 1;
+
+	while( ( option = getopt(
+	                   argc,
+	                   argv,
+	                   "a:A:b:Bc:d:e:f:F:hm:n:r:S:t:" ) ) != -1 )
+	{
+		switch( option )
+		{
+			case 'a':
+				options.number_of_attachments = atoi( optarg );
+				break;
+
+			case 'A':
+				options.attachment_size = (size_t) strtoul( optarg, NULL, 10 );
+				break;
+
+			case 'b':
+				options.body_size = (size_t) strtoul( optarg, NULL, 10 );
+				break;
+
+			case 'B':
+				options.formatted_bodies = 1;
+				break;
+
+			case 'c':
+				if( strcmp( optarg, "ost" ) == 0 )
+				{
+					options.content_type = 0x4f53;
+				}
+				else if( strcmp( optarg, "pst" ) == 0 )
+				{
+					options.content_type = 0x4d53;
+				}
+				else
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported content type: %s.\n",
+					 optarg );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case 'd':
+				options.deleted_percentage = atoi( optarg );
+				break;
+
+			case 'e':
+				if( strcmp( optarg, "none" ) == 0 )
+				{
+					options.encryption_type = PFF_GENERATE_ENCRYPTION_TYPE_NONE;
+				}
+				else if( strcmp( optarg, "compressible" ) == 0 )
+				{
+					options.encryption_type = PFF_GENERATE_ENCRYPTION_TYPE_COMPRESSIBLE;
+				}
+				else if( strcmp( optarg, "high" ) == 0 )
+				{
+					options.encryption_type = PFF_GENERATE_ENCRYPTION_TYPE_HIGH;
+				}
+				else
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported encryption type: %s.\n",
+					 optarg );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case 'f':
+				options.number_of_folders = atoi( optarg );
+				break;
+
+			case 'F':
+				options.fragmentation_window = atoi( optarg );
+				break;
+
+			case 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case 'm':
+				options.number_of_messages = atoi( optarg );
+				break;
+
+			case 'n':
+				options.number_of_named_properties = atoi( optarg );
+				break;
+
+			case 'r':
+				options.seed = (uint32_t) strtoul( optarg, NULL, 10 );
+				break;
+
+			case 'S':
+				options.target_size = (uint64_t) strtoull( optarg, NULL, 10 ) * 1024 * 1024;
+				break;
+
+			case 't':
+				if( strcmp( optarg, "32" ) == 0 )
+				{
+					options.file_type = PFF_GENERATE_FILE_TYPE_32BIT;
+				}
+				else if( strcmp( optarg, "64" ) == 0 )
+				{
+					options.file_type = PFF_GENERATE_FILE_TYPE_64BIT;
+				}
+				else
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported file type: %s.\n",
+					 optarg );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			default:
+				usage_fprint(
+				 stderr );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing target file.\n" );
+
+		usage_fprint(
+		 stderr );
+
+		return( EXIT_FAILURE );
+	}
+	target_filename = argv[ optind ];
+
+	if( ( options.number_of_folders < 1 )
+	 || ( options.number_of_messages < 0 )
+	 || ( options.number_of_attachments < 0 )
+	 || ( options.number_of_attachments > PFF_GENERATE_MAXIMUM_NUMBER_OF_ATTACHMENTS )
+	 || ( options.number_of_named_properties < 0 )
+	 || ( options.number_of_named_properties > PFF_GENERATE_MAXIMUM_NUMBER_OF_NAMED_PROPERTIES )
+	 || ( options.deleted_percentage < 0 )
+	 || ( options.deleted_percentage > 100 )
+	 || ( options.fragmentation_window < 1 )
+	 || ( options.fragmentation_window > 4096 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid option value.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( options.target_size > 0 )
+	{
+		/* Estimate the size of a message including its overhead
+		 */
+		message_size = 2048
+		             + ( options.body_size * 2 )
+		             + ( options.number_of_attachments * ( options.attachment_size + 1024 ) )
+		             + ( options.number_of_named_properties * 48 );
+
+		options.number_of_messages = (int) ( options.target_size / ( message_size * options.number_of_folders ) );
+
+		if( options.number_of_messages < 1 )
+		{
+			options.number_of_messages = 1;
+		}
+	}
+	/* The contents table row index and rows are limited in size
+	 */
+	if( options.number_of_messages > 65000 )
+	{
+		fprintf(
+		 stderr,
+		 "Too many messages per folder, increase the number of folders.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	memory_set(
+	 &file,
+	 0,
+	 sizeof( pff_generate_file_t ) );
+
+	file.options               = &options;
+	file.value_size            = ( options.file_type == PFF_GENERATE_FILE_TYPE_32BIT ) ? 4 : 8;
+	file.next_block_identifier = 0x00000004UL;
+	file.next_descriptor_index = PFF_GENERATE_FIRST_DESCRIPTOR_INDEX + options.number_of_folders;
+	file.current_offset        = PFF_GENERATE_ALLOCATION_TABLE_OFFSET;
+	file.random_state          = ( options.seed == 0 ) ? 0x2545f491UL : options.seed;
+
+	file.pending_blocks = (pff_generate_pending_block_t *) malloc(
+	                                                        sizeof( pff_generate_pending_block_t ) * options.fragmentation_window );
+
+	if( file.pending_blocks == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create pending blocks.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	pff_generate_crc32_initialize();
+	pff_generate_encryption_initialize();
+
+	file.stream = fopen(
+	               target_filename,
+	               "wb" );
+
+	if( file.stream == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open target file: %s.\n",
+		 target_filename );
+
+		free(
+		 file.pending_blocks );
+
+		return( EXIT_FAILURE );
+	}
+	result = pff_generate_file_write(
+	          &file );
+
+	if( fclose(
+	     file.stream ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close target file.\n" );
+
+		result = -1;
+	}
+	while( file.number_of_pending_blocks > 0 )
+	{
+		file.number_of_pending_blocks--;
+
+		free(
+		 file.pending_blocks[ file.number_of_pending_blocks ].data );
+	}
+	free(
+	 file.pending_blocks );
+
+	if( file.allocation_bitmap != NULL )
+	{
+		free(
+		 file.allocation_bitmap );
+	}
+	if( file.descriptor_entries != NULL )
+	{
+		free(
+		 file.descriptor_entries );
+	}
+	if( file.offset_entries != NULL )
+	{
+		free(
+		 file.offset_entries );
+	}
+	if( result != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to generate file: %s.\n",
+		 target_filename );
+
+		return( EXIT_FAILURE );
+	}
+	fprintf(
+	 stdout,
+	 "Generated: %s with %" PRIu64 " folders, %" PRIu64 " messages, %" PRIu64 " deleted messages and %" PRIu64 " attachments.\n",
+	 target_filename,
+	 file.number_of_folders,
+	 file.number_of_messages,
+	 file.number_of_deleted_messages,
+	 file.number_of_attachments );
+
+	return( EXIT_SUCCESS );
+}
+
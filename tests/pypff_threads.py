@@ -0,0 +1,188 @@
+#!/usr/bin/env python
+#
+# Measures the multi-threaded throughput of pypff
+#
+# Copyright (c) 2008-2012, Joachim Metz <joachim.metz@gmail.com>
+#
+# Refer to AUTHORS for acknowledgements.
+#
+# This software is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This software is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this software.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+from __future__ import print_function
+
+import getopt
+import sys
+import threading
+import time
+
+import pypff
+
+
+def traverse_folder(folder, values):
+  """Reads the subject and plain text body of every message in a folder."""
+  for message_index in range(folder.get_number_of_sub_messages()):
+    message = folder.get_sub_message(message_index)
+
+    subject = message.get_subject()
+    body = message.get_plain_text_body()
+
+    values.append((subject, len(body or u'')))
+
+  for folder_index in range(folder.get_number_of_sub_folders()):
+    traverse_folder(folder.get_sub_folder(folder_index), values)
+
+
+def traverse_file(pff_file):
+  """Traverses an open file and returns the values read."""
+  values = []
+  root_folder = pff_file.get_root_folder()
+
+  if root_folder is not None:
+    traverse_folder(root_folder, values)
+
+  return values
+
+
+def process_file(filename):
+  """Opens a file, traverses it and returns the values read."""
+  pff_file = pypff.file()
+  pff_file.open(filename)
+
+  try:
+    return traverse_file(pff_file)
+  finally:
+    pff_file.close()
+
+
+def run_threads(number_of_threads, target, arguments):
+  """Runs the target in the threads on the arguments taken from a queue.
+
+  Returns the results in the order of the arguments and the elapsed time.
+  """
+  results = [None] * len(arguments)
+  exceptions = []
+  lock = threading.Lock()
+  next_index = [0]
+
+  def worker():
+    while True:
+      with lock:
+        index = next_index[0]
+        next_index[0] += 1
+
+      if index >= len(arguments):
+        return
+
+      try:
+        results[index] = target(arguments[index])
+      except Exception as exception:
+        with lock:
+          exceptions.append(exception)
+        return
+
+  threads = [
+      threading.Thread(target=worker) for _ in range(number_of_threads)]
+
+  start_time = time.time()
+
+  for thread in threads:
+    thread.start()
+  for thread in threads:
+    thread.join()
+
+  if exceptions:
+    raise exceptions[0]
+
+  return results, time.time() - start_time
+
+
+def usage():
+  print('Usage: pypff_threads.py [ -i iterations ] [ -t threads ] files...')
+  print('')
+  print('\t-i: number of times every file is processed, default is 4')
+  print('\t-t: number of threads, default is 4')
+
+
+def main():
+  number_of_iterations = 4
+  number_of_threads = 4
+
+  try:
+    options, filenames = getopt.getopt(sys.argv[1:], 'hi:t:')
+  except getopt.GetoptError as exception:
+    print(exception)
+    usage()
+    return 1
+
+  for option, value in options:
+    if option == '-h':
+      usage()
+      return 0
+    elif option == '-i':
+      number_of_iterations = int(value, 10)
+    elif option == '-t':
+      number_of_threads = int(value, 10)
+
+  if not filenames or number_of_iterations < 1 or number_of_threads < 1:
+    usage()
+    return 1
+
+  arguments = filenames * number_of_iterations
+
+  expected_results, single_time = run_threads(1, process_file, arguments)
+  results, multi_time = run_threads(
+      number_of_threads, process_file, arguments)
+
+  if results != expected_results:
+    print('Mismatch in values read by {0:d} threads.'.format(
+        number_of_threads))
+    return 1
+
+  number_of_values = sum(len(values) for values in expected_results)
+
+  print('pypff threads: {0:d} file(s), {1:d} messages per pass'.format(
+      len(arguments), number_of_values))
+  print('1 thread(s)\t{0:.3f} seconds\t{1:.0f} messages/s'.format(
+      single_time, number_of_values / max(single_time, 1e-6)))
+  print('{0:d} thread(s)\t{1:.3f} seconds\t{2:.0f} messages/s\t{3:.2f}x'.format(
+      number_of_threads, multi_time,
+      number_of_values / max(multi_time, 1e-6),
+      single_time / max(multi_time, 1e-6)))
+
+  # Share a single file object between the threads to check that access
+  # to the libpff file is serialized.
+  pff_file = pypff.file()
+  pff_file.open(filenames[0])
+
+  try:
+    shared_results, shared_time = run_threads(
+        number_of_threads, lambda _: traverse_file(pff_file),
+        range(number_of_threads * number_of_iterations))
+  finally:
+    pff_file.close()
+
+  for values in shared_results:
+    if values != expected_results[0]:
+      print('Mismatch in values read from a shared file object.')
+      return 1
+
+  print('{0:d} thread(s)\t{1:.3f} seconds\tshared file object'.format(
+      number_of_threads, shared_time))
+
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())